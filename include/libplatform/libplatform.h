@@ -106,6 +106,49 @@ V8_PLATFORM_EXPORT void RunIdleTasks(v8::Platform* platform,
 V8_PLATFORM_EXPORT void NotifyIsolateShutdown(v8::Platform* platform,
                                               Isolate* isolate);
 
+/**
+ * Creates a new worker group and returns its id. All worker groups share the
+ * worker threads of the platform, but each gets a fair share of them: Among
+ * the groups with pending tasks of the same priority, the one that currently
+ * runs the fewest tasks goes first, and jobs of a group that uses more than its
+ * share yield their threads. This keeps e.g. a large compilation job of one
+ * isolate from delaying the GC tasks of isolates in other groups.
+ *
+ * Isolates start out in the default group 0. At most 32 groups are supported.
+ * The |platform| has to be created using |NewDefaultPlatform|.
+ */
+V8_PLATFORM_EXPORT int NewWorkerGroup(v8::Platform* platform);
+
+/**
+ * Puts the worker tasks of the given isolate into the worker group |group|.
+ * This applies to the tasks posted while running the foreground tasks of the
+ * isolate, within a |WorkerGroupScope| for it, and from worker tasks of the
+ * group.
+ *
+ * The |platform| has to be created using |NewDefaultPlatform|.
+ */
+V8_PLATFORM_EXPORT void SetWorkerGroup(v8::Platform* platform,
+                                       v8::Isolate* isolate, int group);
+
+/**
+ * Makes the worker tasks that the current thread posts belong to the worker
+ * group of |isolate| for the lifetime of the scope. Embedders should enter it
+ * whenever they run the isolate on one of their threads.
+ *
+ * The |platform| has to be created using |NewDefaultPlatform|.
+ */
+class V8_PLATFORM_EXPORT WorkerGroupScope final {
+ public:
+  WorkerGroupScope(v8::Platform* platform, v8::Isolate* isolate);
+  ~WorkerGroupScope();
+
+  WorkerGroupScope(const WorkerGroupScope&) = delete;
+  WorkerGroupScope& operator=(const WorkerGroupScope&) = delete;
+
+ private:
+  int previous_group_;
+};
+
 }  // namespace platform
 }  // namespace v8
 
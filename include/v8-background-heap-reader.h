@@ -0,0 +1,125 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef INCLUDE_V8_BACKGROUND_HEAP_READER_H_
+#define INCLUDE_V8_BACKGROUND_HEAP_READER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8config.h"         // NOLINT(build/include_directory)
+
+namespace v8 {
+
+class Isolate;
+class Value;
+
+namespace internal {
+class BackgroundHeapReaderImpl;
+class BackgroundHeapReaderScopeImpl;
+}  // namespace internal
+
+/**
+ * Gives a background thread read access to values on the heap of an
+ * isolate, e.g. to serialize them in parallel without copying them into C++
+ * structures first.
+ *
+ * The values are registered on the isolate's thread with Add(). Supported are
+ * undefined, null, booleans, numbers, strings, typed arrays, and frozen
+ * objects whose own enumerable properties are data properties with supported
+ * values. A background thread can then read them while it holds a Scope. Each
+ * reader can be used by one Scope at a time; use several readers to read in
+ * parallel.
+ *
+ * Strings and frozen objects can't change while they are read. The contents
+ * of typed arrays can: the embedder must make sure that JavaScript doesn't
+ * write to them while a background thread reads them. Their memory is kept
+ * alive by the reader, even if their buffer is detached.
+ */
+class V8_EXPORT BackgroundHeapReader {
+ public:
+  enum class Type {
+    kUndefined,
+    kNull,
+    kBoolean,
+    kNumber,
+    kString,
+    kTypedArray,
+    kObject,
+  };
+
+  /** Returned by Add() for values that can't be read in the background. */
+  static constexpr int kUnsupported = -1;
+
+  explicit BackgroundHeapReader(Isolate* isolate);
+
+  /**
+   * Must be called on the isolate's thread, after the last Scope is gone.
+   */
+  ~BackgroundHeapReader();
+
+  BackgroundHeapReader(const BackgroundHeapReader&) = delete;
+  BackgroundHeapReader& operator=(const BackgroundHeapReader&) = delete;
+
+  /**
+   * Registers |value| and returns its id, or kUnsupported. Must be called on
+   * the isolate's thread while no Scope exists. Strings are flattened.
+   */
+  int Add(Local<Value> value);
+
+  /**
+   * Allows the calling thread to read the values of |reader|. The thread
+   * takes part in the isolate's safepoints while the scope exists, so
+   * garbage collections wait until it is gone; keep scopes short. Pointers
+   * returned by the scope are valid until it is destroyed.
+   */
+  class V8_EXPORT V8_NODISCARD Scope {
+   public:
+    explicit Scope(BackgroundHeapReader* reader);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    Type GetType(int id) const;
+
+    /** For kBoolean values. */
+    bool BooleanValue(int id) const;
+    /** For kNumber values. */
+    double NumberValue(int id) const;
+
+    /** For kString values. */
+    int StringLength(int id) const;
+    bool IsOneByte(int id) const;
+    /**
+     * Copies |length| characters starting at |start| into |buffer|. The
+     * one-byte variant requires IsOneByte().
+     */
+    void WriteOneByte(int id, uint8_t* buffer, int start, int length) const;
+    void Write(int id, uint16_t* buffer, int start, int length) const;
+
+    /** For kTypedArray values, the viewed bytes when they were added. */
+    const void* TypedArrayData(int id) const;
+    size_t TypedArrayByteLength(int id) const;
+
+    /**
+     * For kObject values, the number of properties, and the ids of the key
+     * and the value of the |index|th property.
+     */
+    int PropertyCount(int id) const;
+    int PropertyKey(int id, int index) const;
+    int PropertyValue(int id, int index) const;
+
+   private:
+    internal::BackgroundHeapReaderScopeImpl* impl_;
+  };
+
+ private:
+  internal::BackgroundHeapReaderImpl* impl_;
+};
+
+}  // namespace v8
+
+#endif  // INCLUDE_V8_BACKGROUND_HEAP_READER_H_
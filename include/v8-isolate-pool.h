@@ -0,0 +1,79 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef INCLUDE_V8_ISOLATE_POOL_H_
+#define INCLUDE_V8_ISOLATE_POOL_H_
+
+#include <stddef.h>
+
+#include "v8-isolate.h"  // NOLINT(build/include_directory)
+#include "v8config.h"    // NOLINT(build/include_directory)
+
+namespace v8 {
+
+namespace internal {
+class IsolatePoolImpl;
+}  // namespace internal
+
+/**
+ * A pool of isolates that are created ahead of time on the platform's worker
+ * threads, for embedders that run each request in a fresh isolate.
+ *
+ * Acquire() hands out a ready isolate, created from the snapshot in the
+ * CreateParams, and schedules the creation of a replacement. The isolate can
+ * be used on the thread that acquired it without a v8::Locker. Release()
+ * discards the garbage left in the young generation and puts the isolate back
+ * into the pool. Only the contexts are discarded, so embedders must create a
+ * new context for each use; state attached to the isolate itself, such as
+ * data slots, callbacks, or its compilation cache, is kept.
+ */
+class V8_EXPORT IsolatePool {
+ public:
+  struct Statistics {
+    /** Number of Acquire() calls that returned a pre-created isolate. */
+    size_t hits = 0;
+    /** Number of Acquire() calls that had to create the isolate. */
+    size_t misses = 0;
+    /** Number of isolates that are ready to be acquired. */
+    size_t available = 0;
+  };
+
+  /**
+   * Creates a pool that keeps |size| isolates ready. The pointers in |params|,
+   * such as the snapshot blob and the array buffer allocator, must stay valid
+   * until the pool is destroyed.
+   */
+  IsolatePool(const Isolate::CreateParams& params, size_t size);
+
+  /**
+   * Waits for isolates that are still being created, and disposes all
+   * isolates in the pool. Acquired isolates must be released or disposed by
+   * the embedder.
+   */
+  ~IsolatePool();
+
+  IsolatePool(const IsolatePool&) = delete;
+  IsolatePool& operator=(const IsolatePool&) = delete;
+
+  /**
+   * Returns an isolate that isn't entered, creating it on the calling thread
+   * if none is ready.
+   */
+  Isolate* Acquire();
+
+  /**
+   * Resets an isolate returned by Acquire() and keeps it for later use, or
+   * disposes it if the pool is full. The isolate must not be entered.
+   */
+  void Release(Isolate* isolate);
+
+  Statistics GetStatistics() const;
+
+ private:
+  internal::IsolatePoolImpl* impl_;
+};
+
+}  // namespace v8
+
+#endif  // INCLUDE_V8_ISOLATE_POOL_H_
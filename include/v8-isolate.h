@@ -281,6 +281,13 @@ class V8_EXPORT Isolate {
      */
     bool only_terminate_in_safe_scope = false;
 
+    /**
+     * The NUMA node this isolate runs on, or -1. When set, V8 prefers memory
+     * of this node for heap pages and restricts its GC worker threads to the
+     * node's CPUs while they work for this isolate. Only supported on Linux.
+     */
+    int numa_node = -1;
+
     /**
      * The following parameters describe the offsets for addressing type info
      * for wrapped API objects and are used by the fast C API
@@ -1335,6 +1342,56 @@ class V8_EXPORT Isolate {
    */
   void SetRAILMode(RAILMode rail_mode);
 
+  /**
+   * Tier-up thresholds for functions running in this isolate. Each field
+   * overrides the corresponding --invocation-count-for-* flag; fields left at
+   * zero keep the flag value. The thresholds are approximate invocation counts
+   * (or loop iteration counts for on-stack replacement), since V8 scales them
+   * by the size of each function internally.
+   */
+  struct TieringPolicy {
+    int sparkplug_invocation_count = 0;
+    int maglev_invocation_count = 0;
+    int maglev_osr_invocation_count = 0;
+    int turbofan_invocation_count = 0;
+    int turbofan_osr_invocation_count = 0;
+    /**
+     * Number of deoptimizations after which a function is kept at Maglev
+     * instead of being optimized with TurboFan again (overrides
+     * --max-deopt-count). After twice as many, optimization is disabled for
+     * the function.
+     */
+    int max_deopt_count = 0;
+  };
+
+  /**
+   * Sets the tiering policy of this isolate. Functions pick up the new
+   * thresholds the next time their interrupt budget is reset.
+   * This is an experimental feature. Semantics and implementation may change
+   * frequently.
+   */
+  void SetTieringPolicy(const TieringPolicy& policy);
+
+  /**
+   * Sets a target for the longest main-thread pause of a single incremental
+   * marking step. Steps are sized so that V8 and embedder marking together
+   * stay within the target, and steps that still exceed it are reported via
+   * v8::metrics::Recorder. A target of 0 restores the default step sizes.
+   * The atomic pause that finalizes marking is not affected.
+   */
+  void SetIncrementalMarkingPauseTarget(double target_in_ms);
+
+  /**
+   * Informs V8 about the memory budget of the process, e.g. the memory limit
+   * of the container it runs in, and about the memory the process currently
+   * uses, e.g. its resident set size. With a budget, the heap only grows
+   * within the remaining headroom and memory reducing garbage collections
+   * are only scheduled once the usage approaches the budget, instead of when
+   * the isolate appears idle. Should be called again whenever the usage
+   * changes significantly. A budget of 0 removes it.
+   */
+  void SetProcessMemoryBudget(size_t budget_in_bytes, size_t usage_in_bytes);
+
   /**
    * Update load start time of the RAIL mode
    */
@@ -1382,6 +1439,16 @@ class V8_EXPORT Isolate {
   void SetJitCodeEventHandler(JitCodeEventOptions options,
                               JitCodeEventHandler event_handler);
 
+  /**
+   * Starts or stops writing the jitdump file that Linux perf reads to
+   * symbolize and annotate generated code, like --perf-prof does for the
+   * whole lifetime of the process. When started, the code that already
+   * exists is written as well.
+   *
+   * \note Only supported on Linux, does nothing on other platforms.
+   */
+  void SetPerfJitDumpEnabled(bool enabled);
+
   /**
    * Modifies the stack limit for this Isolate.
    *
@@ -5,15 +5,26 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class OutputStream;
 class Value;
 class String;
 
+namespace internal {
+class JsonStreamingParser;
+}  // namespace internal
+
 /**
  * A JSON Parser and Stringifier.
  */
@@ -30,6 +41,21 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * Like Parse(), but takes the UTF-8 encoded source text directly. The bytes
+   * are consumed as is and only the contents of string literals are decoded,
+   * so no intermediate (and possibly two-byte) v8::String is created. Invalid
+   * UTF-8 sequences in string literals are replaced with U+FFFD.
+   *
+   * \param context The context in which to parse and create the value.
+   * \param utf8_data The UTF-8 encoded JSON text.
+   * \param length The length of |utf8_data| in bytes.
+   * \return The corresponding value if successfully parsed.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(Local<Context> context,
+                                                       const char* utf8_data,
+                                                       size_t length);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -40,6 +66,64 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Like Stringify(), but writes the result to |stream| as UTF-8 in chunks of
+   * stream->GetChunkSize() bytes instead of creating a string, so the full
+   * result never has to exist in memory at once. Calls stream->EndOfStream()
+   * once the last chunk has been written, unless the stream aborted.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream receiving the serialized output.
+   * \return Just(true) if the serialized value was completely written,
+   *   Just(false) if |json_object| does not serialize to anything (i.e.
+   *   Stringify() would return undefined) or the stream aborted, and Nothing
+   *   if an exception was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> Stringify(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
+
+  /**
+   * Collects the source text of a JSON document that arrives in chunks (e.g.
+   * from the network) and parses it once the last chunk has been appended.
+   *
+   * Chunks are accumulated in a single off-heap buffer which is handed to the
+   * parser without further copies, so the embedder does not need to build an
+   * intermediate v8::String out of the chunks. The buffer stays one-byte until
+   * a chunk containing characters outside of Latin-1 is appended.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    StreamingParser();
+    ~StreamingParser();
+
+    StreamingParser(const StreamingParser&) = delete;
+    StreamingParser& operator=(const StreamingParser&) = delete;
+
+    /**
+     * Appends |length| Latin-1 characters to the source text.
+     */
+    void AppendOneByte(const uint8_t* data, size_t length);
+
+    /**
+     * Appends |length| UTF-16 code units to the source text.
+     */
+    void AppendTwoByte(const uint16_t* data, size_t length);
+
+    /**
+     * Parses the accumulated source text and returns the resulting value if
+     * successful. The parser is reset afterwards and can be reused for
+     * another document.
+     *
+     * \param context The context in which to create the value.
+     * \return The corresponding value if successfully parsed.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+   private:
+    std::unique_ptr<internal::JsonStreamingParser> impl_;
+  };
 };
 
 }  // namespace v8
@@ -8,6 +8,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <string>
 #include <vector>
 
 #include "v8-internal.h"      // NOLINT(build/include_directory)
@@ -62,6 +63,13 @@ struct GarbageCollectionFullMainThreadIncrementalMark {
   int64_t cpp_wall_clock_duration_in_us = -1;
 };
 
+// Reported for every incremental marking step that takes longer than the
+// target set via Isolate::SetIncrementalMarkingPauseTarget().
+struct GarbageCollectionFullMainThreadIncrementalMarkPauseTargetViolation {
+  int64_t wall_clock_duration_in_us = -1;
+  int64_t target_in_us = -1;
+};
+
 struct GarbageCollectionFullMainThreadIncrementalSweep {
   int64_t wall_clock_duration_in_us = -1;
   int64_t cpp_wall_clock_duration_in_us = -1;
@@ -83,6 +91,10 @@ struct GarbageCollectionYoungCycle {
   int reason = -1;
   int64_t total_wall_clock_duration_in_us = -1;
   int64_t main_thread_wall_clock_duration_in_us = -1;
+  // Sizes of the young generation before and after the GC.
+  GarbageCollectionSizes objects;
+  // Bytes moved from the young to the old generation.
+  int64_t promoted_bytes = -1;
   double collection_rate_in_percent = -1.0;
   double efficiency_in_bytes_per_us = -1.0;
   double main_thread_efficiency_in_bytes_per_us = -1.0;
@@ -155,6 +167,42 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+struct TurbofanPhase {
+  // Static name of the phase, e.g. "V8.TFInlining".
+  const char* name = nullptr;
+  int64_t wall_clock_duration_in_us = -1;
+  // Peak size of all compiler zones of the compilation during this phase.
+  size_t peak_zone_size_in_bytes = 0;
+};
+
+struct TurbofanFunctionCompiled {
+  std::string function_name;
+  bool osr = false;
+  bool success = false;
+  int bytecode_size_in_bytes = 0;
+  // Sum of the time spent in all phases, across threads, excluding the time
+  // spent waiting in the concurrent compilation queue.
+  int64_t wall_clock_duration_in_us = -1;
+  size_t peak_zone_size_in_bytes = 0;
+  std::vector<TurbofanPhase> phases;
+};
+
+struct RuntimeCallCounterSamples {
+  // Static name of the runtime call counter, e.g. "JS_Execution".
+  const char* name = nullptr;
+  int64_t sample_count = 0;
+};
+
+// Reported with --rcs-sampling, where the isolate's thread is sampled
+// periodically instead of timing each runtime call.
+struct RuntimeCallStatsSampled {
+  int64_t sampling_interval_in_us = -1;
+  // Includes the samples that didn't hit any runtime call counter.
+  int64_t total_sample_count = 0;
+  // Only counters with samples, in no particular order.
+  std::vector<RuntimeCallCounterSamples> counters;
+};
+
 /**
  * This class serves as a base class for recording event-based metrics in V8.
  * There a two kinds of metrics, those which are expected to be thread-safe and
@@ -201,12 +249,16 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullCycle)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadIncrementalMark)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadBatchedIncrementalMark)
+  ADD_MAIN_THREAD_EVENT(
+      GarbageCollectionFullMainThreadIncrementalMarkPauseTargetViolation)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadBatchedIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionYoungCycle)
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
+  ADD_MAIN_THREAD_EVENT(TurbofanFunctionCompiled)
+  ADD_MAIN_THREAD_EVENT(RuntimeCallStatsSampled)
 #undef ADD_MAIN_THREAD_EVENT
 
   // Thread-safe events are not allowed to access the context and therefore do
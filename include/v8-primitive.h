@@ -267,6 +267,24 @@ class V8_EXPORT String : public Name {
      */
     virtual void Unlock() const {}
 
+    /**
+     * Called by V8 with an opaque value encoding the hash of the string's
+     * contents once it is known. Embedders that create several strings with
+     * the same contents, e.g. for different contexts, can keep the value and
+     * return it from |GetCachedHash()| of the other strings' resources, which
+     * saves V8 from hashing their contents again.
+     *
+     * Like |Lock()|, this function must be thread-safe.
+     */
+    virtual void SetCachedHash(uint64_t hash) const {}
+
+    /**
+     * Returns true and stores a value that was passed to |SetCachedHash()| for
+     * a resource with the same contents in |hash|, if there is one. Values
+     * from isolates with a different hash seed are ignored.
+     */
+    virtual bool GetCachedHash(uint64_t* hash) const { return false; }
+
    private:
     friend class internal::ExternalString;
     friend class v8::String;
@@ -397,6 +415,21 @@ class V8_EXPORT String : public Name {
    */
   const ExternalOneByteStringResource* GetExternalOneByteStringResource() const;
 
+  /**
+   * Like GetExternalOneByteStringResource(), but also returns the resource of
+   * an external one-byte string that this string is a substring of, without
+   * copying. The string's characters start at |*offset| in the resource's
+   * data. Returns NULL if the string's characters are not stored in an
+   * external one-byte string resource.
+   *
+   * The resource is only guaranteed to be alive as long as the string is.
+   * Embedders that need to keep the characters beyond that, e.g. to pass them
+   * on to I/O without a copy, can reference count their resources, and
+   * release them in their Dispose() method.
+   */
+  const ExternalOneByteStringResource* GetExternalOneByteStringResource(
+      size_t* offset) const;
+
   V8_INLINE static String* Cast(v8::Data* data) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(data);
@@ -210,7 +210,8 @@ class V8_EXPORT OutputStream {
 class V8_EXPORT CpuProfile {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,  // See format description near 'Serialize' method.
+    kPprof = 1  // See format description near 'Serialize' method.
   };
   /** Returns CPU profile title. */
   Local<String> GetTitle() const;
@@ -253,6 +254,13 @@ class V8_EXPORT CpuProfile {
    */
   EmbedderStateTag GetSampleEmbedderState(int index) const;
 
+  /**
+   * Returns the number of hardware events (as selected by the
+   * --cpu-profiler-hardware-event flag) counted on the profiled thread since
+   * the previous sample. Always 0 if no hardware event is being counted.
+   */
+  uint64_t GetSampleHardwareEventCount(int index) const;
+
   /**
    * Returns time when the profile recording was stopped (in microseconds)
    * since some unspecified starting point.
@@ -281,6 +289,10 @@ class V8_EXPORT CpuProfile {
    *    timeDeltas: [numbers array]
    *  }
    *
+   * The pprof format is the binary, uncompressed Profile message of
+   * https://github.com/google/pprof/blob/main/proto/profile.proto, with
+   * sample counts and CPU time per call stack. It is written through
+   * OutputStream::WriteAsciiChunk as well.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -817,6 +829,15 @@ class V8_EXPORT AllocationProfile {
 
   virtual ~AllocationProfile() = default;
 
+  /**
+   * Writes the call-graph as the binary, uncompressed Profile message of
+   * https://github.com/google/pprof/blob/main/proto/profile.proto, with the
+   * estimated object count and bytes per call stack and allocation size.
+   * The data is written through OutputStream::WriteAsciiChunk. Must be
+   * called within a HandleScope of |isolate|.
+   */
+  void Serialize(Isolate* isolate, OutputStream* stream);
+
   static const int kNoLineNumberInfo = Message::kNoLineNumberInfo;
   static const int kNoColumnNumberInfo = Message::kNoColumnInfo;
 };
@@ -933,6 +954,13 @@ class V8_EXPORT HeapProfiler {
     kSamplingForceGC = 1 << 0,
     kSamplingIncludeObjectsCollectedByMajorGC = 1 << 1,
     kSamplingIncludeObjectsCollectedByMinorGC = 1 << 2,
+    /**
+     * Attributes the allocations of each function to an "(allocation site)"
+     * child node per source position that allocated, whose line and column
+     * are those of the allocation. Together with a |stack_depth| of 1 this
+     * aggregates the samples per allocation site.
+     */
+    kSamplingSplitByAllocationSite = 1 << 3,
   };
 
   /**
@@ -1130,7 +1158,7 @@ class V8_EXPORT HeapProfiler {
    * Allocations are sampled using a randomized Poisson process. On average, one
    * allocation will be sampled every |sample_interval| bytes allocated. The
    * |stack_depth| parameter controls the maximum number of stack frames to be
-   * captured on each allocation.
+   * captured on each allocation. See `SamplingFlags` for the |flags|.
    *
    * NOTE: Support for native allocations doesn't exist yet, but is anticipated
    * in the future.
@@ -37,7 +37,10 @@ enum class MeasureMemoryMode { kSummary, kDetailed };
  * By default the measurement is folded with the next scheduled GC which may
  * happen after a while and is forced after some timeout.
  * The kEager mode starts incremental GC right away and is useful for testing.
- * The kLazy mode does not force GC.
+ * The kLazy mode does not force GC. Instead, the measurement is done by the
+ * marking of the next regular full GC. Issuing a new kLazy request from
+ * MeasurementComplete() thus meters memory continuously, without additional
+ * GCs.
  */
 enum class MeasureMemoryExecution { kDefault, kEager, kLazy };
 
@@ -133,6 +136,13 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the memory used by remembered sets (the buckets recording
+   * interesting slots on each heap page). The value is refreshed whenever
+   * statistics are requested while no sweeping is in progress.
+   */
+  size_t remembered_set_size() { return remembered_set_size_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -154,6 +164,7 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_detached_contexts_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
+  size_t remembered_set_size_;
 
   friend class V8;
   friend class Isolate;
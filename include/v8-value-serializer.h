@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
 #include "v8-maybe.h"         // NOLINT(build/include_directory)
@@ -18,6 +19,7 @@
 namespace v8 {
 
 class ArrayBuffer;
+class BackingStore;
 class Isolate;
 class Object;
 class SharedArrayBuffer;
@@ -190,6 +192,38 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Indicate whether to copy the contents of large ArrayBuffers (including the
+   * buffers of typed arrays and DataViews) into the buffer using worker
+   * threads of the platform's job API. The calling thread takes part in the
+   * copy and WriteValue returns only once it has finished. The wire format
+   * does not depend on this setting.
+   *
+   * The default is to copy on the calling thread only.
+   */
+  void SetCopyArrayBuffersInParallel(bool mode);
+
+  /**
+   * Makes the contents of ArrayBuffers with a byte length of at least
+   * |min_byte_length| travel out of band: rather than being copied into the
+   * buffer, their backing stores are collected in a list that is retrieved
+   * with ReleaseOutOfBandBackingStores. That list must be passed to
+   * ValueDeserializer::SetOutOfBandBackingStores in the deserializing context.
+   * The deserialized ArrayBuffers share the backing stores with the originals,
+   * so the embedder is responsible for not mutating them concurrently.
+   *
+   * SharedArrayBuffers and resizable ArrayBuffers are always handled as usual.
+   * By default, the contents of all ArrayBuffers are copied into the buffer.
+   */
+  void SetOutOfBandArrayBufferThreshold(size_t min_byte_length);
+
+  /**
+   * Returns the backing stores referenced by the buffer of a serializer that
+   * has an out-of-band threshold set, in the order expected by
+   * ValueDeserializer::SetOutOfBandBackingStores.
+   */
+  std::vector<std::shared_ptr<BackingStore>> ReleaseOutOfBandBackingStores();
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -277,6 +311,15 @@ class V8_EXPORT ValueDeserializer {
   void TransferSharedArrayBuffer(uint32_t id,
                                  Local<SharedArrayBuffer> shared_array_buffer);
 
+  /**
+   * Accepts the backing stores previously returned by
+   * ValueSerializer::ReleaseOutOfBandBackingStores for this buffer. Must be
+   * called before ReadValue if the buffer was written with an out-of-band
+   * threshold.
+   */
+  void SetOutOfBandBackingStores(
+      std::vector<std::shared_ptr<BackingStore>> backing_stores);
+
   /**
    * Must be called before ReadHeader to enable support for reading the legacy
    * wire format (i.e., which predates this being shipped).
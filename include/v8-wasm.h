@@ -39,6 +39,36 @@ struct OwnedBuffer {
 
 // Wrapper around a compiled WebAssembly module, which is potentially shared by
 // different WasmModuleObjects.
+/**
+ * Code memory statistics of a single compiled wasm module, see
+ * CompiledWasmModule::GetCodeStatistics.
+ */
+class V8_EXPORT WasmModuleCodeStatistics {
+ public:
+  WasmModuleCodeStatistics();
+  /**
+   * Size of the code pages that are currently committed for this module.
+   * Pages that only contained code which got freed are decommitted.
+   */
+  size_t committed_code_size() const { return committed_code_size_; }
+  /**
+   * Total size of all code ever allocated for this module, including code
+   * that was freed again.
+   */
+  size_t generated_code_size() const { return generated_code_size_; }
+  /**
+   * Size of the code that was freed by wasm code GC.
+   */
+  size_t freed_code_size() const { return freed_code_size_; }
+
+ private:
+  size_t committed_code_size_;
+  size_t generated_code_size_;
+  size_t freed_code_size_;
+
+  friend class CompiledWasmModule;
+};
+
 class V8_EXPORT CompiledWasmModule {
  public:
   /**
@@ -47,11 +77,36 @@ class V8_EXPORT CompiledWasmModule {
    */
   OwnedBuffer Serialize();
 
+  /**
+   * Serialize the profile collected for this module so far, i.e. which
+   * functions were executed or tiered up and the type feedback of optimized
+   * functions. Pass it to ApplyProfile in a later run to compile the hot
+   * functions with the optimizing tier right away.
+   */
+  OwnedBuffer SerializeProfile();
+
+  /**
+   * Apply a profile from SerializeProfile. Functions that were executed in
+   * the profiled run get compiled eagerly and the ones that were tiered up
+   * get compiled with the optimizing tier, both in the background; all other
+   * functions are still compiled lazily. Returns false without applying
+   * anything if the profile is malformed or was created by a different V8
+   * version or for a different module.
+   */
+  bool ApplyProfile(const uint8_t* bytes, size_t size);
+
   /**
    * Get the (wasm-encoded) wire bytes that were used to compile this module.
    */
   MemorySpan<const uint8_t> GetWireBytesRef();
 
+  /**
+   * Get the code memory statistics of this module. The code memory is
+   * released as soon as the last CompiledWasmModule and the last
+   * WebAssembly.Module referencing it die.
+   */
+  WasmModuleCodeStatistics GetCodeStatistics() const;
+
   const std::string& source_url() const { return source_url_; }
 
  private:
@@ -75,6 +130,14 @@ class V8_EXPORT WasmMemoryObject : public Object {
    */
   Local<ArrayBuffer> Buffer();
 
+  /**
+   * Zeroes the given byte range of the memory and returns the pages fully
+   * contained in it to the operating system, which lowers the memory's
+   * resident size until the pages are used again. Returns false (and does
+   * nothing) if the range is out of bounds or the memory is shared.
+   */
+  bool Discard(size_t offset, size_t length);
+
   V8_INLINE static WasmMemoryObject* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
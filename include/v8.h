@@ -33,6 +33,7 @@
 #include "v8-function.h"           // NOLINT(build/include_directory)
 #include "v8-initialization.h"     // NOLINT(build/include_directory)
 #include "v8-internal.h"           // NOLINT(build/include_directory)
+#include "v8-isolate-pool.h"       // NOLINT(build/include_directory)
 #include "v8-isolate.h"            // NOLINT(build/include_directory)
 #include "v8-json.h"               // NOLINT(build/include_directory)
 #include "v8-local-handle.h"       // NOLINT(build/include_directory)
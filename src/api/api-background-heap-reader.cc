@@ -0,0 +1,295 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "include/v8-background-heap-reader.h"
+#include "src/api/api-inl.h"
+#include "src/base/optional.h"
+#include "src/execution/isolate.h"
+#include "src/execution/local-isolate.h"
+#include "src/handles/persistent-handles.h"
+#include "src/heap/local-heap-inl.h"
+#include "src/heap/parked-scope.h"
+#include "src/objects/backing-store.h"
+#include "src/objects/js-array-buffer-inl.h"
+#include "src/objects/keys.h"
+#include "src/objects/lookup.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+using Type = BackgroundHeapReader::Type;
+
+class BackgroundHeapReaderImpl final {
+ public:
+  struct Entry {
+    Type type;
+    // Primitive values are read when they are added.
+    bool boolean_value = false;
+    double number_value = 0;
+    // kString
+    Handle<String> string;
+    int string_length = 0;
+    bool is_one_byte = false;
+    // kTypedArray
+    std::shared_ptr<BackingStore> backing_store;
+    size_t byte_offset = 0;
+    size_t byte_length = 0;
+    // kObject: the ids of the key and the value of each property.
+    std::vector<std::pair<int, int>> properties;
+  };
+
+  explicit BackgroundHeapReaderImpl(Isolate* isolate)
+      : isolate_(isolate),
+        persistent_handles_(isolate->NewPersistentHandles()) {}
+
+  int Add(Handle<Object> value) {
+    DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+    // Only possible while no Scope holds the handles.
+    CHECK_NOT_NULL(persistent_handles_);
+    HandleScope scope(isolate_);
+
+    Entry entry;
+    if (value->IsNumber()) {
+      entry.type = Type::kNumber;
+      entry.number_value = value->Number();
+    } else if (value->IsUndefined(isolate_)) {
+      entry.type = Type::kUndefined;
+    } else if (value->IsNull(isolate_)) {
+      entry.type = Type::kNull;
+    } else if (value->IsBoolean()) {
+      entry.type = Type::kBoolean;
+      entry.boolean_value = value->IsTrue(isolate_);
+    } else if (value->IsString()) {
+      Handle<String> string =
+          String::Flatten(isolate_, Handle<String>::cast(value));
+      entry.type = Type::kString;
+      entry.string = persistent_handles_->NewHandle(*string);
+      entry.string_length = string->length();
+      entry.is_one_byte = string->IsOneByteRepresentation();
+    } else if (value->IsJSTypedArray()) {
+      Handle<JSTypedArray> typed_array = Handle<JSTypedArray>::cast(value);
+      entry.type = Type::kTypedArray;
+      if (!typed_array->IsDetachedOrOutOfBounds()) {
+        // Move on-heap contents off the heap, so that they don't move.
+        Handle<JSArrayBuffer> buffer = typed_array->GetBuffer();
+        entry.backing_store = buffer->GetBackingStore();
+        entry.byte_offset = typed_array->byte_offset();
+        entry.byte_length = typed_array->GetByteLength();
+      }
+    } else if (value->IsJSObject()) {
+      return AddObject(Handle<JSObject>::cast(value));
+    } else {
+      return BackgroundHeapReader::kUnsupported;
+    }
+    entries_.push_back(std::move(entry));
+    return static_cast<int>(entries_.size() - 1);
+  }
+
+  const Entry& entry(int id) const {
+    CHECK_LT(static_cast<size_t>(id), entries_.size());
+    return entries_[id];
+  }
+
+  Isolate* isolate() const { return isolate_; }
+
+  std::unique_ptr<PersistentHandles> TakePersistentHandles() {
+    CHECK_NOT_NULL(persistent_handles_);
+    return std::move(persistent_handles_);
+  }
+
+  void ReturnPersistentHandles(std::unique_ptr<PersistentHandles> handles) {
+    DCHECK_NULL(persistent_handles_);
+    persistent_handles_ = std::move(handles);
+  }
+
+ private:
+  int AddObject(Handle<JSObject> object) {
+    // Objects with interceptors or access checks may run embedder code on
+    // every access.
+    Handle<Map> map(object->map(), isolate_);
+    if (map->is_access_check_needed() || map->has_named_interceptor() ||
+        map->has_indexed_interceptor()) {
+      return BackgroundHeapReader::kUnsupported;
+    }
+    Maybe<bool> frozen =
+        JSObject::TestIntegrityLevel(isolate_, object, FROZEN);
+    if (!frozen.FromMaybe(false)) return BackgroundHeapReader::kUnsupported;
+    for (Handle<JSObject> outer : adding_) {
+      if (outer.is_identical_to(object)) {
+        return BackgroundHeapReader::kUnsupported;
+      }
+    }
+
+    Handle<FixedArray> keys;
+    if (!KeyAccumulator::GetKeys(isolate_, object, KeyCollectionMode::kOwnOnly,
+                                 ENUMERABLE_STRINGS,
+                                 GetKeysConversion::kConvertToString)
+             .ToHandle(&keys)) {
+      isolate_->clear_pending_exception();
+      return BackgroundHeapReader::kUnsupported;
+    }
+
+    Entry entry;
+    entry.type = Type::kObject;
+    adding_.push_back(object);
+    for (int i = 0; i < keys->length(); ++i) {
+      Handle<String> key(String::cast(keys->get(i)), isolate_);
+      PropertyKey lookup_key(isolate_, Handle<Name>::cast(key));
+      LookupIterator it(isolate_, object, lookup_key, LookupIterator::OWN);
+      // Accessors of frozen objects can still return different values.
+      if (it.state() != LookupIterator::DATA) break;
+      int key_id = Add(key);
+      int value_id = Add(it.GetDataValue());
+      if (key_id == BackgroundHeapReader::kUnsupported ||
+          value_id == BackgroundHeapReader::kUnsupported) {
+        break;
+      }
+      entry.properties.emplace_back(key_id, value_id);
+    }
+    adding_.pop_back();
+    if (entry.properties.size() != static_cast<size_t>(keys->length())) {
+      return BackgroundHeapReader::kUnsupported;
+    }
+    entries_.push_back(std::move(entry));
+    return static_cast<int>(entries_.size() - 1);
+  }
+
+  Isolate* const isolate_;
+  // Owns the handles in {entries_}, while no Scope has them.
+  std::unique_ptr<PersistentHandles> persistent_handles_;
+  std::vector<Entry> entries_;
+  // The objects that are being added, to reject cycles.
+  std::vector<Handle<JSObject>> adding_;
+};
+
+class BackgroundHeapReaderScopeImpl final {
+ public:
+  explicit BackgroundHeapReaderScopeImpl(BackgroundHeapReaderImpl* reader)
+      : reader_(reader),
+        local_isolate_(reader->isolate(), ThreadKind::kBackground) {
+    local_isolate_.heap()->AttachPersistentHandles(
+        reader_->TakePersistentHandles());
+    unparked_scope_.emplace(local_isolate_.heap());
+  }
+
+  ~BackgroundHeapReaderScopeImpl() {
+    unparked_scope_.reset();
+    reader_->ReturnPersistentHandles(
+        local_isolate_.heap()->DetachPersistentHandles());
+  }
+
+  const BackgroundHeapReaderImpl::Entry& entry(int id) const {
+    return reader_->entry(id);
+  }
+
+  const BackgroundHeapReaderImpl::Entry& entry(int id, Type type) const {
+    const BackgroundHeapReaderImpl::Entry& result = reader_->entry(id);
+    CHECK_EQ(result.type, type);
+    return result;
+  }
+
+  const std::pair<int, int>& property(int id, int index) const {
+    const BackgroundHeapReaderImpl::Entry& object = entry(id, Type::kObject);
+    CHECK_LT(static_cast<size_t>(index), object.properties.size());
+    return object.properties[index];
+  }
+
+  template <typename Char>
+  void Write(int id, Char* buffer, int start, int length) {
+    const BackgroundHeapReaderImpl::Entry& string = entry(id, Type::kString);
+    CHECK_LE(0, start);
+    CHECK_LE(0, length);
+    CHECK_LE(length, string.string_length - start);
+    if constexpr (std::is_same_v<Char, uint8_t>) CHECK(string.is_one_byte);
+    // The main thread may internalize or externalize the string meanwhile,
+    // but it keeps its contents.
+    String::WriteToFlat(*string.string, buffer, start, length,
+                        GetPtrComprCageBase(*string.string),
+                        SharedStringAccessGuardIfNeeded(&local_isolate_));
+  }
+
+ private:
+  BackgroundHeapReaderImpl* const reader_;
+  LocalIsolate local_isolate_;
+  base::Optional<UnparkedScope> unparked_scope_;
+};
+
+}  // namespace internal
+
+BackgroundHeapReader::BackgroundHeapReader(Isolate* isolate)
+    : impl_(new internal::BackgroundHeapReaderImpl(
+          reinterpret_cast<internal::Isolate*>(isolate))) {}
+
+BackgroundHeapReader::~BackgroundHeapReader() { delete impl_; }
+
+int BackgroundHeapReader::Add(Local<Value> value) {
+  return impl_->Add(Utils::OpenHandle(*value));
+}
+
+BackgroundHeapReader::Scope::Scope(BackgroundHeapReader* reader)
+    : impl_(new internal::BackgroundHeapReaderScopeImpl(reader->impl_)) {}
+
+BackgroundHeapReader::Scope::~Scope() { delete impl_; }
+
+BackgroundHeapReader::Type BackgroundHeapReader::Scope::GetType(
+    int id) const {
+  return impl_->entry(id).type;
+}
+
+bool BackgroundHeapReader::Scope::BooleanValue(int id) const {
+  return impl_->entry(id, Type::kBoolean).boolean_value;
+}
+
+double BackgroundHeapReader::Scope::NumberValue(int id) const {
+  return impl_->entry(id, Type::kNumber).number_value;
+}
+
+int BackgroundHeapReader::Scope::StringLength(int id) const {
+  return impl_->entry(id, Type::kString).string_length;
+}
+
+bool BackgroundHeapReader::Scope::IsOneByte(int id) const {
+  return impl_->entry(id, Type::kString).is_one_byte;
+}
+
+void BackgroundHeapReader::Scope::WriteOneByte(int id, uint8_t* buffer,
+                                               int start, int length) const {
+  impl_->Write(id, buffer, start, length);
+}
+
+void BackgroundHeapReader::Scope::Write(int id, uint16_t* buffer, int start,
+                                        int length) const {
+  impl_->Write(id, buffer, start, length);
+}
+
+const void* BackgroundHeapReader::Scope::TypedArrayData(int id) const {
+  const internal::BackgroundHeapReaderImpl::Entry& entry =
+      impl_->entry(id, Type::kTypedArray);
+  if (!entry.backing_store) return nullptr;
+  return static_cast<const uint8_t*>(entry.backing_store->buffer_start()) +
+         entry.byte_offset;
+}
+
+size_t BackgroundHeapReader::Scope::TypedArrayByteLength(int id) const {
+  return impl_->entry(id, Type::kTypedArray).byte_length;
+}
+
+int BackgroundHeapReader::Scope::PropertyCount(int id) const {
+  return static_cast<int>(impl_->entry(id, Type::kObject).properties.size());
+}
+
+int BackgroundHeapReader::Scope::PropertyKey(int id, int index) const {
+  return impl_->property(id, index).first;
+}
+
+int BackgroundHeapReader::Scope::PropertyValue(int id, int index) const {
+  return impl_->property(id, index).second;
+}
+
+}  // namespace v8
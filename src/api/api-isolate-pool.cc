@@ -0,0 +1,146 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "include/v8-isolate-pool.h"
+#include "include/v8-platform.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/execution/isolate.h"
+#include "src/heap/heap.h"
+#include "src/init/v8.h"
+
+namespace v8 {
+namespace internal {
+
+class IsolatePoolImpl final {
+ public:
+  IsolatePoolImpl(const v8::Isolate::CreateParams& params, size_t size)
+      : params_(params), size_(size) {
+    base::MutexGuard guard(&mutex_);
+    ScheduleCreation();
+  }
+
+  ~IsolatePoolImpl() {
+    std::vector<v8::Isolate*> isolates;
+    {
+      base::MutexGuard guard(&mutex_);
+      shutting_down_ = true;
+      while (pending_creations_ > 0) creations_done_.Wait(&mutex_);
+      isolates.swap(available_);
+    }
+    for (v8::Isolate* isolate : isolates) isolate->Dispose();
+  }
+
+  v8::Isolate* Acquire() {
+    v8::Isolate* isolate = nullptr;
+    {
+      base::MutexGuard guard(&mutex_);
+      if (!available_.empty()) {
+        isolate = available_.back();
+        available_.pop_back();
+        stats_.hits++;
+      } else {
+        stats_.misses++;
+      }
+      ScheduleCreation();
+    }
+    if (isolate == nullptr) return v8::Isolate::New(params_);
+
+    // The isolate was set up on a worker thread, so its stack limit is that
+    // of the worker's stack.
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+    ExecutionAccess access(i_isolate);
+    i_isolate->stack_guard()->InitThread(access);
+    return isolate;
+  }
+
+  void Release(v8::Isolate* isolate) {
+    DCHECK(!isolate->IsInUse());
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      isolate->ContextDisposedNotification(false);
+      // The objects of the last use are garbage, and most of them are still
+      // in the young generation.
+      reinterpret_cast<Isolate*>(isolate)->heap()->CollectGarbage(
+          NEW_SPACE, GarbageCollectionReason::kContextDisposal);
+    }
+    {
+      base::MutexGuard guard(&mutex_);
+      if (available_.size() + pending_creations_ < size_) {
+        available_.push_back(isolate);
+        return;
+      }
+    }
+    isolate->Dispose();
+  }
+
+  IsolatePool::Statistics GetStatistics() {
+    base::MutexGuard guard(&mutex_);
+    IsolatePool::Statistics stats = stats_;
+    stats.available = available_.size();
+    return stats;
+  }
+
+ private:
+  class CreateIsolateTask final : public v8::Task {
+   public:
+    explicit CreateIsolateTask(IsolatePoolImpl* pool) : pool_(pool) {}
+
+    void Run() override {
+      pool_->AddIsolate(v8::Isolate::New(pool_->params_));
+    }
+
+   private:
+    IsolatePoolImpl* const pool_;
+  };
+
+  // Must be called with |mutex_| held.
+  void ScheduleCreation() {
+    while (!shutting_down_ && available_.size() + pending_creations_ < size_) {
+      pending_creations_++;
+      V8::GetCurrentPlatform()->CallOnWorkerThread(
+          std::make_unique<CreateIsolateTask>(this));
+    }
+  }
+
+  void AddIsolate(v8::Isolate* isolate) {
+    base::MutexGuard guard(&mutex_);
+    pending_creations_--;
+    if (!shutting_down_) {
+      available_.push_back(isolate);
+      return;
+    }
+    // Dispose the isolate before the destructor can return.
+    isolate->Dispose();
+    if (pending_creations_ == 0) creations_done_.NotifyOne();
+  }
+
+  const v8::Isolate::CreateParams params_;
+  const size_t size_;
+  base::Mutex mutex_;
+  base::ConditionVariable creations_done_;
+  std::vector<v8::Isolate*> available_;
+  size_t pending_creations_ = 0;
+  bool shutting_down_ = false;
+  IsolatePool::Statistics stats_;
+};
+
+}  // namespace internal
+
+IsolatePool::IsolatePool(const Isolate::CreateParams& params, size_t size)
+    : impl_(new internal::IsolatePoolImpl(params, size)) {}
+
+IsolatePool::~IsolatePool() { delete impl_; }
+
+Isolate* IsolatePool::Acquire() { return impl_->Acquire(); }
+
+void IsolatePool::Release(Isolate* isolate) { impl_->Release(isolate); }
+
+IsolatePool::Statistics IsolatePool::GetStatistics() const {
+  return impl_->GetStatistics();
+}
+
+}  // namespace v8
@@ -29,12 +29,14 @@
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
 #include "src/api/api-natives.h"
+#include "src/base/bounds.h"
 #include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/safe_conversions.h"
+#include "src/base/small-vector.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/builtins/accessors.h"
 #include "src/builtins/builtins-utils.h"
@@ -55,6 +57,7 @@
 #include "src/execution/messages.h"
 #include "src/execution/microtask-queue.h"
 #include "src/execution/simulator.h"
+#include "src/execution/tiering-manager.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles.h"
@@ -111,6 +114,7 @@
 #include "src/profiler/cpu-profiler.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
+#include "src/profiler/pprof-serializer.h"
 #include "src/profiler/profile-generator-inl.h"
 #include "src/profiler/tick-sample.h"
 #include "src/regexp/regexp-utils.h"
@@ -123,16 +127,19 @@
 #include "src/snapshot/snapshot.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/utils/detachable-vector.h"
 #include "src/utils/identity-map.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/version.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/debug/debug-wasm-objects.h"
 #include "src/trap-handler/trap-handler.h"
 #include "src/wasm/streaming-decoder.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/value-type.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-js.h"
@@ -3364,6 +3371,45 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+MaybeLocal<Value> JSON::Parse(Local<Context> context, const char* utf8_data,
+                              size_t length) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse, Value);
+  i::MaybeHandle<i::Object> maybe;
+  if (length > static_cast<size_t>(i::String::kMaxLength)) {
+    i_isolate->Throw(*i_isolate->factory()->NewInvalidStringLengthError());
+  } else {
+    maybe = i::JsonParser<uint8_t>::ParseUtf8(
+        i_isolate, base::Vector<const uint8_t>(
+                       reinterpret_cast<const uint8_t*>(utf8_data), length));
+  }
+  Local<Value> result;
+  has_pending_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
+JSON::StreamingParser::StreamingParser()
+    : impl_(new i::JsonStreamingParser()) {}
+
+JSON::StreamingParser::~StreamingParser() = default;
+
+void JSON::StreamingParser::AppendOneByte(const uint8_t* data, size_t length) {
+  impl_->AppendOneByte(data, length);
+}
+
+void JSON::StreamingParser::AppendTwoByte(const uint16_t* data,
+                                          size_t length) {
+  impl_->AppendTwoByte(data, length);
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Finish(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, StreamingParse, Value);
+  Local<Value> result;
+  has_pending_exception = !ToLocal<Value>(impl_->Finish(i_isolate), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3385,6 +3431,22 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::Stringify(Local<Context> context, Local<Value> json_object,
+                            OutputStream* stream, Local<String> gap) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, StringifyToStream, Nothing<bool>(),
+           i::HandleScope);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? i_isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result =
+      i::JsonStringifyToStream(i_isolate, object, gap_string, stream);
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -3502,6 +3564,26 @@ void ValueSerializer::TransferArrayBuffer(uint32_t transfer_id,
                                            Utils::OpenHandle(*array_buffer));
 }
 
+void ValueSerializer::SetCopyArrayBuffersInParallel(bool mode) {
+  private_->serializer.SetCopyArrayBuffersInParallel(mode);
+}
+
+void ValueSerializer::SetOutOfBandArrayBufferThreshold(size_t min_byte_length) {
+  private_->serializer.SetOutOfBandArrayBufferThreshold(min_byte_length);
+}
+
+std::vector<std::shared_ptr<BackingStore>>
+ValueSerializer::ReleaseOutOfBandBackingStores() {
+  std::vector<std::shared_ptr<i::BackingStore>> backing_stores =
+      private_->serializer.ReleaseOutOfBandBackingStores();
+  std::vector<std::shared_ptr<BackingStore>> result;
+  result.reserve(backing_stores.size());
+  for (std::shared_ptr<i::BackingStoreBase> backing_store : backing_stores) {
+    result.push_back(std::static_pointer_cast<BackingStore>(backing_store));
+  }
+  return result;
+}
+
 void ValueSerializer::WriteUint32(uint32_t value) {
   private_->serializer.WriteUint32(value);
 }
@@ -3634,6 +3716,18 @@ void ValueDeserializer::TransferSharedArrayBuffer(
       transfer_id, Utils::OpenHandle(*shared_array_buffer));
 }
 
+void ValueDeserializer::SetOutOfBandBackingStores(
+    std::vector<std::shared_ptr<BackingStore>> backing_stores) {
+  std::vector<std::shared_ptr<i::BackingStore>> internal_backing_stores;
+  internal_backing_stores.reserve(backing_stores.size());
+  for (std::shared_ptr<i::BackingStoreBase> backing_store : backing_stores) {
+    internal_backing_stores.push_back(
+        std::static_pointer_cast<i::BackingStore>(backing_store));
+  }
+  private_->deserializer.SetOutOfBandBackingStores(
+      std::move(internal_backing_stores));
+}
+
 bool ValueDeserializer::ReadUint32(uint32_t* value) {
   return private_->deserializer.ReadUint32(value);
 }
@@ -3653,64 +3747,68 @@ bool ValueDeserializer::ReadRawBytes(size_t length, const void** data) {
 // --- D a t a ---
 
 bool Value::FullIsUndefined() const {
-  i::Handle<i::Object> object = Utils::OpenHandle(this);
+  i::DirectHandle<i::Object> object = Utils::OpenDirectHandle(this);
   bool result = object->IsUndefined();
   DCHECK_EQ(result, QuickIsUndefined());
   return result;
 }
 
 bool Value::FullIsNull() const {
-  i::Handle<i::Object> object = Utils::OpenHandle(this);
+  i::DirectHandle<i::Object> object = Utils::OpenDirectHandle(this);
   bool result = object->IsNull();
   DCHECK_EQ(result, QuickIsNull());
   return result;
 }
 
 bool Value::IsTrue() const {
-  i::Object object = *Utils::OpenHandle(this);
+  i::Object object = *Utils::OpenDirectHandle(this);
   if (object.IsSmi()) return false;
   return object.IsTrue();
 }
 
 bool Value::IsFalse() const {
-  i::Object object = *Utils::OpenHandle(this);
+  i::Object object = *Utils::OpenDirectHandle(this);
   if (object.IsSmi()) return false;
   return object.IsFalse();
 }
 
-bool Value::IsFunction() const { return Utils::OpenHandle(this)->IsCallable(); }
+bool Value::IsFunction() const {
+  return Utils::OpenDirectHandle(this)->IsCallable();
+}
 
-bool Value::IsName() const { return Utils::OpenHandle(this)->IsName(); }
+bool Value::IsName() const { return Utils::OpenDirectHandle(this)->IsName(); }
 
 bool Value::FullIsString() const {
-  bool result = Utils::OpenHandle(this)->IsString();
+  bool result = Utils::OpenDirectHandle(this)->IsString();
   DCHECK_EQ(result, QuickIsString());
   return result;
 }
 
 bool Value::IsSymbol() const {
-  return Utils::OpenHandle(this)->IsPublicSymbol();
+  return Utils::OpenDirectHandle(this)->IsPublicSymbol();
 }
 
-bool Value::IsArray() const { return Utils::OpenHandle(this)->IsJSArray(); }
+bool Value::IsArray() const {
+  return Utils::OpenDirectHandle(this)->IsJSArray();
+}
 
 bool Value::IsArrayBuffer() const {
-  i::Object obj = *Utils::OpenHandle(this);
+  i::Object obj = *Utils::OpenDirectHandle(this);
   if (!obj.IsJSArrayBuffer()) return false;
   return !i::JSArrayBuffer::cast(obj)->is_shared();
 }
 
 bool Value::IsArrayBufferView() const {
-  return Utils::OpenHandle(this)->IsJSArrayBufferView();
+  return Utils::OpenDirectHandle(this)->IsJSArrayBufferView();
 }
 
 bool Value::IsTypedArray() const {
-  return Utils::OpenHandle(this)->IsJSTypedArray();
+  return Utils::OpenDirectHandle(this)->IsJSTypedArray();
 }
 
 #define VALUE_IS_TYPED_ARRAY(Type, typeName, TYPE, ctype)                    \
   bool Value::Is##Type##Array() const {                                      \
-    i::Handle<i::Object> obj = Utils::OpenHandle(this);                      \
+    i::DirectHandle<i::Object> obj = Utils::OpenDirectHandle(this);          \
     return obj->IsJSTypedArray() &&                                          \
            i::JSTypedArray::cast(*obj)->type() == i::kExternal##Type##Array; \
   }
@@ -3720,28 +3818,36 @@ TYPED_ARRAYS(VALUE_IS_TYPED_ARRAY)
 #undef VALUE_IS_TYPED_ARRAY
 
 bool Value::IsDataView() const {
-  i::Handle<i::Object> obj = Utils::OpenHandle(this);
+  i::DirectHandle<i::Object> obj = Utils::OpenDirectHandle(this);
   return obj->IsJSDataView() || obj->IsJSRabGsabDataView();
 }
 
 bool Value::IsSharedArrayBuffer() const {
-  i::Object obj = *Utils::OpenHandle(this);
+  i::Object obj = *Utils::OpenDirectHandle(this);
   if (!obj.IsJSArrayBuffer()) return false;
   return i::JSArrayBuffer::cast(obj)->is_shared();
 }
 
-bool Value::IsObject() const { return Utils::OpenHandle(this)->IsJSReceiver(); }
+bool Value::IsObject() const {
+  return Utils::OpenDirectHandle(this)->IsJSReceiver();
+}
 
-bool Value::IsNumber() const { return Utils::OpenHandle(this)->IsNumber(); }
+bool Value::IsNumber() const {
+  return Utils::OpenDirectHandle(this)->IsNumber();
+}
 
-bool Value::IsBigInt() const { return Utils::OpenHandle(this)->IsBigInt(); }
+bool Value::IsBigInt() const {
+  return Utils::OpenDirectHandle(this)->IsBigInt();
+}
 
-bool Value::IsProxy() const { return Utils::OpenHandle(this)->IsJSProxy(); }
+bool Value::IsProxy() const {
+  return Utils::OpenDirectHandle(this)->IsJSProxy();
+}
 
-#define VALUE_IS_SPECIFIC_TYPE(Type, Check)             \
-  bool Value::Is##Type() const {                        \
-    i::Handle<i::Object> obj = Utils::OpenHandle(this); \
-    return obj->Is##Check();                            \
+#define VALUE_IS_SPECIFIC_TYPE(Type, Check)                         \
+  bool Value::Is##Type() const {                                    \
+    i::DirectHandle<i::Object> obj = Utils::OpenDirectHandle(this); \
+    return obj->Is##Check();                                        \
   }
 
 VALUE_IS_SPECIFIC_TYPE(ArgumentsObject, JSArgumentsObject)
@@ -3768,15 +3874,17 @@ VALUE_IS_SPECIFIC_TYPE(WeakRef, JSWeakRef)
 
 #undef VALUE_IS_SPECIFIC_TYPE
 
-bool Value::IsBoolean() const { return Utils::OpenHandle(this)->IsBoolean(); }
+bool Value::IsBoolean() const {
+  return Utils::OpenDirectHandle(this)->IsBoolean();
+}
 
 bool Value::IsExternal() const {
-  i::Object obj = *Utils::OpenHandle(this);
+  i::Object obj = *Utils::OpenDirectHandle(this);
   return obj.IsJSExternalObject();
 }
 
 bool Value::IsInt32() const {
-  i::Object obj = *Utils::OpenHandle(this);
+  i::Object obj = *Utils::OpenDirectHandle(this);
   if (obj.IsSmi()) return true;
   if (obj.IsNumber()) {
     return i::IsInt32Double(obj.Number());
@@ -3785,7 +3893,7 @@ bool Value::IsInt32() const {
 }
 
 bool Value::IsUint32() const {
-  i::Handle<i::Object> obj = Utils::OpenHandle(this);
+  i::DirectHandle<i::Object> obj = Utils::OpenDirectHandle(this);
   if (obj->IsSmi()) return i::Smi::ToInt(*obj) >= 0;
   if (obj->IsNumber()) {
     double value = obj->Number();
@@ -3796,23 +3904,23 @@ bool Value::IsUint32() const {
 }
 
 bool Value::IsNativeError() const {
-  return Utils::OpenHandle(this)->IsJSError();
+  return Utils::OpenDirectHandle(this)->IsJSError();
 }
 
 bool Value::IsRegExp() const {
-  i::Handle<i::Object> obj = Utils::OpenHandle(this);
+  i::DirectHandle<i::Object> obj = Utils::OpenDirectHandle(this);
   return obj->IsJSRegExp();
 }
 
 bool Value::IsAsyncFunction() const {
-  i::Object obj = *Utils::OpenHandle(this);
+  i::Object obj = *Utils::OpenDirectHandle(this);
   if (!obj.IsJSFunction()) return false;
   i::JSFunction func = i::JSFunction::cast(obj);
   return i::IsAsyncFunction(func->shared()->kind());
 }
 
 bool Value::IsGeneratorFunction() const {
-  i::Object obj = *Utils::OpenHandle(this);
+  i::Object obj = *Utils::OpenDirectHandle(this);
   if (!obj.IsJSFunction()) return false;
   i::JSFunction func = i::JSFunction::cast(obj);
   DCHECK_NO_SCRIPT_NO_EXCEPTION(func->GetIsolate());
@@ -3820,21 +3928,23 @@ bool Value::IsGeneratorFunction() const {
 }
 
 bool Value::IsGeneratorObject() const {
-  return Utils::OpenHandle(this)->IsJSGeneratorObject();
+  return Utils::OpenDirectHandle(this)->IsJSGeneratorObject();
 }
 
 bool Value::IsMapIterator() const {
-  return Utils::OpenHandle(this)->IsJSMapIterator();
+  return Utils::OpenDirectHandle(this)->IsJSMapIterator();
 }
 
 bool Value::IsSetIterator() const {
-  return Utils::OpenHandle(this)->IsJSSetIterator();
+  return Utils::OpenDirectHandle(this)->IsJSSetIterator();
 }
 
-bool Value::IsPromise() const { return Utils::OpenHandle(this)->IsJSPromise(); }
+bool Value::IsPromise() const {
+  return Utils::OpenDirectHandle(this)->IsJSPromise();
+}
 
 bool Value::IsModuleNamespaceObject() const {
-  return Utils::OpenHandle(this)->IsJSModuleNamespace();
+  return Utils::OpenDirectHandle(this)->IsJSModuleNamespace();
 }
 
 MaybeLocal<String> Value::ToString(Local<Context> context) const {
@@ -3881,7 +3991,7 @@ MaybeLocal<BigInt> Value::ToBigInt(Local<Context> context) const {
 }
 
 bool Value::BooleanValue(Isolate* v8_isolate) const {
-  return Utils::OpenHandle(this)->BooleanValue(
+  return Utils::OpenDirectHandle(this)->BooleanValue(
       reinterpret_cast<i::Isolate*>(v8_isolate));
 }
 
@@ -4258,19 +4368,20 @@ void v8::RegExp::CheckCast(v8::Value* that) {
 }
 
 Maybe<double> Value::NumberValue(Local<Context> context) const {
-  auto obj = Utils::OpenHandle(this);
+  auto obj = Utils::OpenDirectHandle(this);
   if (obj->IsNumber()) return Just(obj->Number());
   auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
   ENTER_V8(i_isolate, context, Value, NumberValue, Nothing<double>(),
            i::HandleScope);
   i::Handle<i::Object> num;
-  has_pending_exception = !i::Object::ToNumber(i_isolate, obj).ToHandle(&num);
+  has_pending_exception =
+      !i::Object::ToNumber(i_isolate, Utils::OpenHandle(this)).ToHandle(&num);
   RETURN_ON_FAILED_EXECUTION_PRIMITIVE(double);
   return Just(num->Number());
 }
 
 Maybe<int64_t> Value::IntegerValue(Local<Context> context) const {
-  auto obj = Utils::OpenHandle(this);
+  auto obj = Utils::OpenDirectHandle(this);
   if (obj->IsNumber()) {
     return Just(NumberToInt64(*obj));
   }
@@ -4278,32 +4389,35 @@ Maybe<int64_t> Value::IntegerValue(Local<Context> context) const {
   ENTER_V8(i_isolate, context, Value, IntegerValue, Nothing<int64_t>(),
            i::HandleScope);
   i::Handle<i::Object> num;
-  has_pending_exception = !i::Object::ToInteger(i_isolate, obj).ToHandle(&num);
+  has_pending_exception =
+      !i::Object::ToInteger(i_isolate, Utils::OpenHandle(this)).ToHandle(&num);
   RETURN_ON_FAILED_EXECUTION_PRIMITIVE(int64_t);
   return Just(NumberToInt64(*num));
 }
 
 Maybe<int32_t> Value::Int32Value(Local<Context> context) const {
-  auto obj = Utils::OpenHandle(this);
+  auto obj = Utils::OpenDirectHandle(this);
   if (obj->IsNumber()) return Just(NumberToInt32(*obj));
   auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
   ENTER_V8(i_isolate, context, Value, Int32Value, Nothing<int32_t>(),
            i::HandleScope);
   i::Handle<i::Object> num;
-  has_pending_exception = !i::Object::ToInt32(i_isolate, obj).ToHandle(&num);
+  has_pending_exception =
+      !i::Object::ToInt32(i_isolate, Utils::OpenHandle(this)).ToHandle(&num);
   RETURN_ON_FAILED_EXECUTION_PRIMITIVE(int32_t);
   return Just(num->IsSmi() ? i::Smi::ToInt(*num)
                            : static_cast<int32_t>(num->Number()));
 }
 
 Maybe<uint32_t> Value::Uint32Value(Local<Context> context) const {
-  auto obj = Utils::OpenHandle(this);
+  auto obj = Utils::OpenDirectHandle(this);
   if (obj->IsNumber()) return Just(NumberToUint32(*obj));
   auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
   ENTER_V8(i_isolate, context, Value, Uint32Value, Nothing<uint32_t>(),
            i::HandleScope);
   i::Handle<i::Object> num;
-  has_pending_exception = !i::Object::ToUint32(i_isolate, obj).ToHandle(&num);
+  has_pending_exception =
+      !i::Object::ToUint32(i_isolate, Utils::OpenHandle(this)).ToHandle(&num);
   RETURN_ON_FAILED_EXECUTION_PRIMITIVE(uint32_t);
   return Just(num->IsSmi() ? static_cast<uint32_t>(i::Smi::ToInt(*num))
                            : static_cast<uint32_t>(num->Number()));
@@ -5247,7 +5361,7 @@ Local<v8::Context> v8::Object::GetCreationContextChecked() {
 
 int v8::Object::GetIdentityHash() {
   i::DisallowGarbageCollection no_gc;
-  auto self = Utils::OpenHandle(this);
+  auto self = Utils::OpenDirectHandle(this);
   auto i_isolate = self->GetIsolate();
   DCHECK_NO_SCRIPT_NO_EXCEPTION(i_isolate);
   i::HandleScope scope(i_isolate);
@@ -5255,26 +5369,66 @@ int v8::Object::GetIdentityHash() {
 }
 
 bool v8::Object::IsCallable() const {
-  auto self = Utils::OpenHandle(this);
+  auto self = Utils::OpenDirectHandle(this);
   return self->IsCallable();
 }
 
 bool v8::Object::IsConstructor() const {
-  auto self = Utils::OpenHandle(this);
+  auto self = Utils::OpenDirectHandle(this);
   return self->IsConstructor();
 }
 
 bool v8::Object::IsApiWrapper() const {
-  auto self = i::Handle<i::JSObject>::cast(Utils::OpenHandle(this));
+  auto self =
+      i::DirectHandle<i::JSObject>::cast(Utils::OpenDirectHandle(this));
   // Objects with embedder fields can wrap API objects.
   return self->MayHaveEmbedderFields();
 }
 
 bool v8::Object::IsUndetectable() const {
-  auto self = i::Handle<i::JSObject>::cast(Utils::OpenHandle(this));
+  auto self =
+      i::DirectHandle<i::JSObject>::cast(Utils::OpenDirectHandle(this));
   return self->IsUndetectable();
 }
 
+namespace {
+
+// The arguments of a call from the embedder, as internal handles. Without
+// direct locals the locals already are handles. With them, a handle is
+// created for each argument, and the array of handles stays on the stack for
+// the common argument counts.
+class CallArgumentHandles {
+ public:
+  CallArgumentHandles(int argc, Local<Value> argv[]) {
+#ifdef V8_ENABLE_DIRECT_LOCAL
+    handles_.reserve(argc);
+    for (int i = 0; i < argc; ++i) {
+      handles_.push_back(Utils::OpenHandle(*argv[i]));
+    }
+#else   // !V8_ENABLE_DIRECT_LOCAL
+    static_assert(sizeof(v8::Local<v8::Value>) == sizeof(i::Handle<i::Object>));
+    args_ = reinterpret_cast<i::Handle<i::Object>*>(argv);
+#endif  // V8_ENABLE_DIRECT_LOCAL
+  }
+
+  i::Handle<i::Object>* data() {
+#ifdef V8_ENABLE_DIRECT_LOCAL
+    return handles_.data();
+#else   // !V8_ENABLE_DIRECT_LOCAL
+    return args_;
+#endif  // V8_ENABLE_DIRECT_LOCAL
+  }
+
+ private:
+#ifdef V8_ENABLE_DIRECT_LOCAL
+  base::SmallVector<i::Handle<i::Object>, 8> handles_;
+#else   // !V8_ENABLE_DIRECT_LOCAL
+  i::Handle<i::Object>* args_;
+#endif  // V8_ENABLE_DIRECT_LOCAL
+};
+
+}  // namespace
+
 MaybeLocal<Value> Object::CallAsFunction(Local<Context> context,
                                          Local<Value> recv, int argc,
                                          Local<Value> argv[]) {
@@ -5287,11 +5441,11 @@ MaybeLocal<Value> Object::CallAsFunction(Local<Context> context,
                                              i_isolate);
   auto self = Utils::OpenHandle(this);
   auto recv_obj = Utils::OpenHandle(*recv);
-  static_assert(sizeof(v8::Local<v8::Value>) == sizeof(i::Handle<i::Object>));
-  i::Handle<i::Object>* args = reinterpret_cast<i::Handle<i::Object>*>(argv);
+  CallArgumentHandles args(argc, argv);
   Local<Value> result;
   has_pending_exception = !ToLocal<Value>(
-      i::Execution::Call(i_isolate, self, recv_obj, argc, args), &result);
+      i::Execution::Call(i_isolate, self, recv_obj, argc, args.data()),
+      &result);
   RETURN_ON_FAILED_EXECUTION(Value);
   RETURN_ESCAPED(result);
 }
@@ -5306,11 +5460,10 @@ MaybeLocal<Value> Object::CallAsConstructor(Local<Context> context, int argc,
   i::NestedTimedHistogramScope execute_timer(i_isolate->counters()->execute(),
                                              i_isolate);
   auto self = Utils::OpenHandle(this);
-  static_assert(sizeof(v8::Local<v8::Value>) == sizeof(i::Handle<i::Object>));
-  i::Handle<i::Object>* args = reinterpret_cast<i::Handle<i::Object>*>(argv);
+  CallArgumentHandles args(argc, argv);
   Local<Value> result;
   has_pending_exception = !ToLocal<Value>(
-      i::Execution::New(i_isolate, self, self, argc, args), &result);
+      i::Execution::New(i_isolate, self, self, argc, args.data()), &result);
   RETURN_ON_FAILED_EXECUTION(Value);
   RETURN_ESCAPED(result);
 }
@@ -5345,7 +5498,6 @@ MaybeLocal<Object> Function::NewInstanceWithSideEffectType(
   i::NestedTimedHistogramScope execute_timer(i_isolate->counters()->execute(),
                                              i_isolate);
   auto self = Utils::OpenHandle(this);
-  static_assert(sizeof(v8::Local<v8::Value>) == sizeof(i::Handle<i::Object>));
   bool should_set_has_no_side_effect =
       side_effect_type == SideEffectType::kHasNoSideEffect &&
       i_isolate->should_check_side_effects();
@@ -5363,10 +5515,10 @@ MaybeLocal<Object> Function::NewInstanceWithSideEffectType(
       }
     }
   }
-  i::Handle<i::Object>* args = reinterpret_cast<i::Handle<i::Object>*>(argv);
+  CallArgumentHandles args(argc, argv);
   Local<Object> result;
   has_pending_exception = !ToLocal<Object>(
-      i::Execution::New(i_isolate, self, self, argc, args), &result);
+      i::Execution::New(i_isolate, self, self, argc, args.data()), &result);
   RETURN_ON_FAILED_EXECUTION(Object);
   RETURN_ESCAPED(result);
 }
@@ -5385,20 +5537,11 @@ MaybeLocal<v8::Value> Function::Call(Local<Context> context,
   Utils::ApiCheck(!self.is_null(), "v8::Function::Call",
                   "Function to be called is a null pointer");
   i::Handle<i::Object> recv_obj = Utils::OpenHandle(*recv);
-  static_assert(sizeof(v8::Local<v8::Value>) == sizeof(i::Handle<i::Object>));
-
-#if V8_ENABLE_DIRECT_LOCAL
-  i::Handle<i::Object>* args = new i::Handle<i::Object>[argc];
-  for (int i = 0; i < argc; ++i) {
-    args[i] = Utils::OpenHandle(*argv[i]);
-  }
-#else   // !V8_ENABLE_DIRECT_LOCAL
-  i::Handle<i::Object>* args = reinterpret_cast<i::Handle<i::Object>*>(argv);
-#endif  // V8_ENABLE_DIRECT_LOCAL
-
+  CallArgumentHandles args(argc, argv);
   Local<Value> result;
   has_pending_exception = !ToLocal<Value>(
-      i::Execution::Call(i_isolate, self, recv_obj, argc, args), &result);
+      i::Execution::Call(i_isolate, self, recv_obj, argc, args.data()),
+      &result);
   RETURN_ON_FAILED_EXECUTION(Value);
   RETURN_ESCAPED(result);
 }
@@ -5722,10 +5865,21 @@ int String::Utf8Length(Isolate* v8_isolate) const {
     }
     utf8_length += length;
   } else {
+    base::Vector<const uint16_t> chars = flat.ToUC16Vector();
     int last_character = unibrow::Utf16::kNoPreviousCharacter;
-    for (uint16_t c : flat.ToUC16Vector()) {
+    for (int i = 0; i < length;) {
+      uint16_t c = chars[i];
+      if (c <= unibrow::Utf8::kMaxOneByteChar) {
+        // ASCII characters take one byte each.
+        int ascii_length = i::NonAsciiStart(&chars[i], length - i);
+        utf8_length += ascii_length;
+        i += ascii_length;
+        last_character = chars[i - 1];
+        continue;
+      }
       utf8_length += unibrow::Utf8::Length(c, last_character);
       last_character = c;
+      i++;
     }
   }
   return utf8_length;
@@ -5768,32 +5922,33 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
       up_to = std::min(up_to, read_index + writable_length);
     }
     // Write the characters to the stream.
-    if (sizeof(Char) == 1) {
-      // Simply memcpy if we only have ASCII characters.
-      uint8_t char_mask = 0;
-      for (int i = read_index; i < up_to; i++) char_mask |= read_start[i];
-      if ((char_mask & 0x80) == 0) {
-        int copy_length = up_to - read_index;
-        memcpy(current_write, read_start + read_index, copy_length);
-        current_write += copy_length;
-        read_index = up_to;
+    while (read_index < up_to) {
+      Char character = read_start[read_index];
+      if (character <= unibrow::Utf8::kMaxOneByteChar) {
+        // Runs of ASCII characters are copied as they are.
+        int ascii_length =
+            std::min(up_to - read_index,
+                     i::NonAsciiStart(read_start + read_index,
+                                      up_to - read_index));
+        ascii_length = std::max(ascii_length, 1);
+        i::CopyChars(reinterpret_cast<uint8_t*>(current_write),
+                     read_start + read_index, ascii_length);
+        current_write += ascii_length;
+        read_index += ascii_length;
+        prev_char = read_start[read_index - 1];
       } else {
-        for (; read_index < up_to; read_index++) {
+        if constexpr (sizeof(Char) == 1) {
           current_write += unibrow::Utf8::EncodeOneByte(
-              current_write, static_cast<uint8_t>(read_start[read_index]));
-          DCHECK(write_capacity == -1 ||
-                 (current_write - write_start) <= write_capacity);
+              current_write, static_cast<uint8_t>(character));
+        } else {
+          current_write += unibrow::Utf8::Encode(
+              current_write, character, prev_char, replace_invalid_utf8);
         }
-      }
-    } else {
-      for (; read_index < up_to; read_index++) {
-        uint16_t character = read_start[read_index];
-        current_write += unibrow::Utf8::Encode(current_write, character,
-                                               prev_char, replace_invalid_utf8);
         prev_char = character;
-        DCHECK(write_capacity == -1 ||
-               (current_write - write_start) <= write_capacity);
+        read_index++;
       }
+      DCHECK(write_capacity == -1 ||
+             (current_write - write_start) <= write_capacity);
     }
   }
   if (read_index < read_length) {
@@ -6129,6 +6284,20 @@ v8::String::GetExternalOneByteStringResource() const {
   return nullptr;
 }
 
+const v8::String::ExternalOneByteStringResource*
+v8::String::GetExternalOneByteStringResource(size_t* offset) const {
+  i::DisallowGarbageCollection no_gc;
+  *offset = 0;
+  i::String str = *Utils::OpenHandle(this);
+  if (str.IsThinString()) str = i::ThinString::cast(str)->actual();
+  if (!str.IsSlicedString()) return GetExternalOneByteStringResource();
+  i::SlicedString slice = i::SlicedString::cast(str);
+  i::String parent = slice->parent();
+  if (!i::StringShape(parent).IsExternalOneByte()) return nullptr;
+  *offset = slice->offset();
+  return i::ExternalOneByteString::cast(parent)->resource();
+}
+
 Local<Value> Symbol::Description(Isolate* v8_isolate) const {
   i::Handle<i::Symbol> sym = Utils::OpenHandle(this);
   i::Handle<i::Object> description(sym->description(),
@@ -6165,7 +6334,7 @@ int64_t Integer::Value() const {
 }
 
 int32_t Int32::Value() const {
-  i::Object obj = *Utils::OpenHandle(this);
+  i::Object obj = *Utils::OpenDirectHandle(this);
   if (obj.IsSmi()) {
     return i::Smi::ToInt(obj);
   } else {
@@ -6174,7 +6343,7 @@ int32_t Int32::Value() const {
 }
 
 uint32_t Uint32::Value() const {
-  i::Object obj = *Utils::OpenHandle(this);
+  i::Object obj = *Utils::OpenDirectHandle(this);
   if (obj.IsSmi()) {
     return i::Smi::ToInt(obj);
   } else {
@@ -6183,38 +6352,40 @@ uint32_t Uint32::Value() const {
 }
 
 int v8::Object::InternalFieldCount() const {
-  i::JSReceiver self = *Utils::OpenHandle(this);
+  i::JSReceiver self = *Utils::OpenDirectHandle(this);
   if (!self.IsJSObject()) return 0;
   return i::JSObject::cast(self)->GetEmbedderFieldCount();
 }
 
-static bool InternalFieldOK(i::Handle<i::JSReceiver> obj, int index,
+static bool InternalFieldOK(i::DirectHandle<i::JSReceiver> obj, int index,
                             const char* location) {
   return Utils::ApiCheck(
       obj->IsJSObject() &&
-          (index < i::Handle<i::JSObject>::cast(obj)->GetEmbedderFieldCount()),
+          (index <
+           i::DirectHandle<i::JSObject>::cast(obj)->GetEmbedderFieldCount()),
       location, "Internal field out of bounds");
 }
 
 Local<Value> v8::Object::SlowGetInternalField(int index) {
-  i::Handle<i::JSReceiver> obj = Utils::OpenHandle(this);
+  i::DirectHandle<i::JSReceiver> obj = Utils::OpenDirectHandle(this);
   const char* location = "v8::Object::GetInternalField()";
   if (!InternalFieldOK(obj, index, location)) return Local<Value>();
-  i::Handle<i::Object> value(i::JSObject::cast(*obj)->GetEmbedderField(index),
-                             obj->GetIsolate());
-  return Utils::ToLocal(value);
+  i::Isolate* i_isolate = obj->GetIsolate();
+  i::DirectHandle<i::Object> value(
+      i::JSObject::cast(*obj)->GetEmbedderField(index), i_isolate);
+  return Utils::ToLocal(value, i_isolate);
 }
 
 void v8::Object::SetInternalField(int index, v8::Local<Value> value) {
-  i::Handle<i::JSReceiver> obj = Utils::OpenHandle(this);
+  i::DirectHandle<i::JSReceiver> obj = Utils::OpenDirectHandle(this);
   const char* location = "v8::Object::SetInternalField()";
   if (!InternalFieldOK(obj, index, location)) return;
-  i::Handle<i::Object> val = Utils::OpenHandle(*value);
-  i::Handle<i::JSObject>::cast(obj)->SetEmbedderField(index, *val);
+  i::DirectHandle<i::Object> val = Utils::OpenDirectHandle(*value);
+  i::DirectHandle<i::JSObject>::cast(obj)->SetEmbedderField(index, *val);
 }
 
 void* v8::Object::SlowGetAlignedPointerFromInternalField(int index) {
-  i::Handle<i::JSReceiver> obj = Utils::OpenHandle(this);
+  i::DirectHandle<i::JSReceiver> obj = Utils::OpenDirectHandle(this);
   const char* location = "v8::Object::GetAlignedPointerFromInternalField()";
   if (!InternalFieldOK(obj, index, location)) return nullptr;
   void* result;
@@ -6225,7 +6396,7 @@ void* v8::Object::SlowGetAlignedPointerFromInternalField(int index) {
 }
 
 void v8::Object::SetAlignedPointerInInternalField(int index, void* value) {
-  i::Handle<i::JSReceiver> obj = Utils::OpenHandle(this);
+  i::DirectHandle<i::JSReceiver> obj = Utils::OpenDirectHandle(this);
   const char* location = "v8::Object::SetAlignedPointerInInternalField()";
   if (!InternalFieldOK(obj, index, location)) return;
 
@@ -6240,7 +6411,7 @@ void v8::Object::SetAlignedPointerInInternalField(int index, void* value) {
 
 void v8::Object::SetAlignedPointerInInternalFields(int argc, int indices[],
                                                    void* values[]) {
-  i::Handle<i::JSReceiver> obj = Utils::OpenHandle(this);
+  i::DirectHandle<i::JSReceiver> obj = Utils::OpenDirectHandle(this);
 
   i::DisallowGarbageCollection no_gc;
   const char* location = "v8::Object::SetAlignedPointerInInternalFields()";
@@ -6379,7 +6550,8 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      remembered_set_size_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -7576,7 +7748,7 @@ bool v8::String::StringEquals(Local<String> that) const {
 }
 
 Isolate* v8::Object::GetIsolate() {
-  i::Isolate* i_isolate = Utils::OpenHandle(this)->GetIsolate();
+  i::Isolate* i_isolate = Utils::OpenDirectHandle(this)->GetIsolate();
   return reinterpret_cast<Isolate*>(i_isolate);
 }
 
@@ -8355,6 +8527,9 @@ MaybeLocal<Proxy> Proxy::New(Local<Context> context, Local<Object> local_target,
   RETURN_ESCAPED(result);
 }
 
+WasmModuleCodeStatistics::WasmModuleCodeStatistics()
+    : committed_code_size_(0), generated_code_size_(0), freed_code_size_(0) {}
+
 CompiledWasmModule::CompiledWasmModule(
     std::shared_ptr<internal::wasm::NativeModule> native_module,
     const char* source_url, size_t url_length)
@@ -8377,6 +8552,34 @@ OwnedBuffer CompiledWasmModule::Serialize() {
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+OwnedBuffer CompiledWasmModule::SerializeProfile() {
+#if V8_ENABLE_WEBASSEMBLY
+  TRACE_EVENT0("v8.wasm", "wasm.SerializeProfile");
+  base::OwnedVector<uint8_t> profile = i::wasm::GetProfileDataForEmbedder(
+      native_module_->module(), native_module_->wire_bytes(),
+      native_module_->tiering_budget_array());
+  size_t size = profile.size();
+  return {profile.ReleaseData(), size};
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
+bool CompiledWasmModule::ApplyProfile(const uint8_t* bytes, size_t size) {
+#if V8_ENABLE_WEBASSEMBLY
+  TRACE_EVENT0("v8.wasm", "wasm.ApplyProfile");
+  std::unique_ptr<i::wasm::ProfileInformation> pgo_info =
+      i::wasm::RestoreProfileDataFromEmbedder(native_module_->module(),
+                                              native_module_->wire_bytes(),
+                                              {bytes, size});
+  if (!pgo_info) return false;
+  native_module_->compilation_state()->ApplyPgoInfo(pgo_info.get());
+  return true;
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
 MemorySpan<const uint8_t> CompiledWasmModule::GetWireBytesRef() {
 #if V8_ENABLE_WEBASSEMBLY
   base::Vector<const uint8_t> bytes_vec = native_module_->wire_bytes();
@@ -8386,6 +8589,18 @@ MemorySpan<const uint8_t> CompiledWasmModule::GetWireBytesRef() {
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+WasmModuleCodeStatistics CompiledWasmModule::GetCodeStatistics() const {
+#if V8_ENABLE_WEBASSEMBLY
+  WasmModuleCodeStatistics stats;
+  stats.committed_code_size_ = native_module_->committed_code_space();
+  stats.generated_code_size_ = native_module_->generated_code_size();
+  stats.freed_code_size_ = native_module_->freed_code_size();
+  return stats;
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
 Local<ArrayBuffer> v8::WasmMemoryObject::Buffer() {
 #if V8_ENABLE_WEBASSEMBLY
   i::Handle<i::WasmMemoryObject> obj = Utils::OpenHandle(this);
@@ -8396,6 +8611,26 @@ Local<ArrayBuffer> v8::WasmMemoryObject::Buffer() {
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+bool v8::WasmMemoryObject::Discard(size_t offset, size_t length) {
+#if V8_ENABLE_WEBASSEMBLY
+  i::Handle<i::WasmMemoryObject> obj = Utils::OpenHandle(this);
+  std::shared_ptr<i::BackingStore> backing_store =
+      obj->array_buffer()->GetBackingStore();
+  if (!backing_store || !backing_store->is_wasm_memory() ||
+      backing_store->is_shared()) {
+    return false;
+  }
+  if (!base::IsInBounds<size_t>(offset, length,
+                                backing_store->byte_length())) {
+    return false;
+  }
+  backing_store->DiscardWasmMemory(offset, length);
+  return true;
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
 CompiledWasmModule WasmModuleObject::GetCompiledModule() {
 #if V8_ENABLE_WEBASSEMBLY
   auto obj = i::Handle<i::WasmModuleObject>::cast(Utils::OpenHandle(this));
@@ -9295,6 +9530,7 @@ void Isolate::Initialize(Isolate* v8_isolate,
   i_isolate->set_allow_atomics_wait(params.allow_atomics_wait);
 
   i_isolate->heap()->ConfigureHeap(params.constraints);
+  if (params.numa_node >= 0) i_isolate->heap()->SetNumaNode(params.numa_node);
   if (params.constraints.stack_limit() != nullptr) {
     uintptr_t limit =
         reinterpret_cast<uintptr_t>(params.constraints.stack_limit());
@@ -9542,6 +9778,7 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
   heap_statistics->does_zap_garbage_ = i::heap::ShouldZapGarbage();
+  heap_statistics->remembered_set_size_ = heap->RememberedSetMemoryUsage();
 
 #if V8_ENABLE_WEBASSEMBLY
   heap_statistics->malloced_memory_ +=
@@ -9894,6 +10131,37 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
   return i_isolate->SetRAILMode(rail_mode);
 }
 
+void Isolate::SetTieringPolicy(const TieringPolicy& policy) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::TieringManager::Policy internal_policy;
+  internal_policy.invocation_count_for_feedback_allocation =
+      policy.sparkplug_invocation_count;
+  internal_policy.invocation_count_for_maglev = policy.maglev_invocation_count;
+  internal_policy.invocation_count_for_maglev_osr =
+      policy.maglev_osr_invocation_count;
+  internal_policy.invocation_count_for_turbofan =
+      policy.turbofan_invocation_count;
+  internal_policy.invocation_count_for_osr =
+      policy.turbofan_osr_invocation_count;
+  internal_policy.max_deopt_count = policy.max_deopt_count;
+  i_isolate->tiering_manager()->set_policy(internal_policy);
+}
+
+void Isolate::SetProcessMemoryBudget(size_t budget_in_bytes,
+                                     size_t usage_in_bytes) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->SetProcessMemoryBudget(budget_in_bytes, usage_in_bytes);
+}
+
+void Isolate::SetIncrementalMarkingPauseTarget(double target_in_ms) {
+  Utils::ApiCheck(target_in_ms >= 0,
+                  "v8::Isolate::SetIncrementalMarkingPauseTarget",
+                  "Pause target must not be negative");
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->incremental_marking()->set_pause_target(
+      base::TimeDelta::FromMillisecondsD(target_in_ms));
+}
+
 void Isolate::UpdateLoadStartTime() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->UpdateLoadStartTime();
@@ -9917,6 +10185,13 @@ void Isolate::SetJitCodeEventHandler(JitCodeEventOptions options,
   i_isolate->v8_file_logger()->SetCodeEventHandler(options, event_handler);
 }
 
+void Isolate::SetPerfJitDumpEnabled(bool enabled) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  // Ensure that logging is initialized for our isolate.
+  i_isolate->InitializeLoggingAndCounters();
+  i_isolate->v8_file_logger()->SetPerfJitLogging(enabled);
+}
+
 void Isolate::SetStackLimit(uintptr_t stack_limit) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   CHECK(stack_limit);
@@ -10497,6 +10772,11 @@ EmbedderStateTag CpuProfile::GetSampleEmbedderState(int index) const {
   return profile->sample(index).embedder_state_tag;
 }
 
+uint64_t CpuProfile::GetSampleHardwareEventCount(int index) const {
+  const i::CpuProfile* profile = reinterpret_cast<const i::CpuProfile*>(this);
+  return profile->sample(index).hardware_events;
+}
+
 int64_t CpuProfile::GetStartTime() const {
   const i::CpuProfile* profile = reinterpret_cast<const i::CpuProfile*>(this);
   return profile->start_time().since_origin().InMicroseconds();
@@ -10514,10 +10794,15 @@ static i::CpuProfile* ToInternal(const CpuProfile* profile) {
 
 void CpuProfile::Serialize(OutputStream* stream,
                            CpuProfile::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::CpuProfile::Serialize",
-                  "Unknown serialization format");
+  Utils::ApiCheck(format == kJSON || format == kPprof,
+                  "v8::CpuProfile::Serialize", "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::CpuProfile::Serialize",
                   "Invalid stream chunk size");
+  if (format == kPprof) {
+    i::PprofSerializer serializer(stream);
+    serializer.SerializeCpuProfile(ToInternal(this));
+    return;
+  }
   i::CpuProfileJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -10910,6 +11195,14 @@ AllocationProfile* HeapProfiler::GetAllocationProfile() {
   return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile();
 }
 
+void AllocationProfile::Serialize(Isolate* isolate, OutputStream* stream) {
+  Utils::ApiCheck(stream->GetChunkSize() > 0,
+                  "v8::AllocationProfile::Serialize",
+                  "Invalid stream chunk size");
+  i::PprofSerializer serializer(stream);
+  serializer.SerializeAllocationProfile(isolate, this);
+}
+
 void HeapProfiler::DeleteAllHeapSnapshots() {
   reinterpret_cast<i::HeapProfiler*>(this)->DeleteAllSnapshots();
 }
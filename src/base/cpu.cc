@@ -393,6 +393,10 @@ CPU::CPU()
       has_avx_(false),
       has_avx2_(false),
       has_fma3_(false),
+      has_avx512f_(false),
+      has_avx512dq_(false),
+      has_avx512bw_(false),
+      has_avx512vl_(false),
       has_bmi1_(false),
       has_bmi2_(false),
       has_lzcnt_(false),
@@ -465,6 +469,10 @@ CPU::CPU()
     has_avx_ = (cpu_info[2] & 0x10000000) != 0;
     has_avx2_ = (cpu_info7[1] & 0x00000020) != 0;
     has_fma3_ = (cpu_info[2] & 0x00001000) != 0;
+    has_avx512f_ = (cpu_info7[1] & 0x00010000) != 0;
+    has_avx512dq_ = (cpu_info7[1] & 0x00020000) != 0;
+    has_avx512bw_ = (cpu_info7[1] & 0x40000000) != 0;
+    has_avx512vl_ = (cpu_info7[1] & 0x80000000) != 0;
     // CET shadow stack feature flag. See
     // https://en.wikipedia.org/wiki/CPUID#EAX=7,_ECX=0:_Extended_Features
     has_cetss_ = (cpu_info7[2] & 0x00000080) != 0;
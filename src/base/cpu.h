@@ -96,6 +96,10 @@ class V8_BASE_EXPORT CPU final {
   bool has_avx() const { return has_avx_; }
   bool has_avx2() const { return has_avx2_; }
   bool has_fma3() const { return has_fma3_; }
+  bool has_avx512f() const { return has_avx512f_; }
+  bool has_avx512dq() const { return has_avx512dq_; }
+  bool has_avx512bw() const { return has_avx512bw_; }
+  bool has_avx512vl() const { return has_avx512vl_; }
   bool has_bmi1() const { return has_bmi1_; }
   bool has_bmi2() const { return has_bmi2_; }
   bool has_lzcnt() const { return has_lzcnt_; }
@@ -173,6 +177,10 @@ class V8_BASE_EXPORT CPU final {
   bool has_avx_;
   bool has_avx2_;
   bool has_fma3_;
+  bool has_avx512f_;
+  bool has_avx512dq_;
+  bool has_avx512bw_;
+  bool has_avx512vl_;
   bool has_bmi1_;
   bool has_bmi2_;
   bool has_lzcnt_;
@@ -11,6 +11,7 @@
 #include "src/base/numbers/double.h"
 #include "src/base/numbers/fast-dtoa.h"
 #include "src/base/numbers/fixed-dtoa.h"
+#include "src/base/numbers/ryu-dtoa.h"
 
 namespace v8 {
 namespace base {
@@ -54,11 +55,14 @@ void DoubleToAscii(double v, DtoaMode mode, int requested_digits,
     return;
   }
 
+  // Ryu never needs the bignum fallback for the shortest representation.
+  if (mode == DTOA_SHORTEST) {
+    RyuDtoa(v, buffer, length, point);
+    return;
+  }
+
   bool fast_worked;
   switch (mode) {
-    case DTOA_SHORTEST:
-      fast_worked = FastDtoa(v, FAST_DTOA_SHORTEST, 0, buffer, length, point);
-      break;
     case DTOA_FIXED:
       fast_worked = FastFixedDtoa(v, requested_digits, buffer, length, point);
       break;
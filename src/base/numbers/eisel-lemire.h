@@ -0,0 +1,25 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_NUMBERS_EISEL_LEMIRE_H_
+#define V8_BASE_NUMBERS_EISEL_LEMIRE_H_
+
+#include <stdint.h>
+
+#include "src/base/base-export.h"
+
+namespace v8 {
+namespace base {
+
+// Computes the double nearest to significand * 10^exponent with the
+// Eisel-Lemire algorithm (Daniel Lemire, "Number Parsing at a Gigabyte per
+// Second", Software: Practice and Experience 51(8), 2021), rounding halfway
+// cases to even. Unlike the DiyFp approximation in Strtod, the result is
+// always correct and never needs a bignum comparison.
+V8_BASE_EXPORT double EiselLemire(uint64_t significand, int exponent);
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_NUMBERS_EISEL_LEMIRE_H_
@@ -0,0 +1,36 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_NUMBERS_RYU_DTOA_H_
+#define V8_BASE_NUMBERS_RYU_DTOA_H_
+
+#include "src/base/vector.h"
+
+namespace v8 {
+namespace base {
+
+// RyuDtoa will produce at most kRyuDtoaMaximalLength digits. This does not
+// include the terminating '\0' character.
+const int kRyuDtoaMaximalLength = 17;
+
+// Computes the shortest decimal representation of v with Ulf Adams' Ryu
+// algorithm ("Ryū: Fast Float-to-String Conversion", PLDI 2018).
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// Unlike FastDtoa in FAST_DTOA_SHORTEST mode, RyuDtoa always succeeds and
+// produces the same digits as BignumDtoa in BIGNUM_DTOA_SHORTEST mode: the
+// shortest representation that reads back as v, and among those the one
+// closest to v. Like BignumDtoa, halfway cases are rounded to even. The
+// buffer contains *length digits without trailing zeros, followed by a null
+// terminator, and must be at least kRyuDtoaMaximalLength + 1 characters long.
+V8_BASE_EXPORT void RyuDtoa(double v, Vector<char> buffer, int* length,
+                            int* point);
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_NUMBERS_RYU_DTOA_H_
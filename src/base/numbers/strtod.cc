@@ -9,9 +9,11 @@
 #include <cmath>
 #include <limits>
 
+#include "src/base/memory.h"
 #include "src/base/numbers/bignum.h"
 #include "src/base/numbers/cached-powers.h"
 #include "src/base/numbers/double.h"
+#include "src/base/numbers/eisel-lemire.h"
 
 namespace v8 {
 namespace base {
@@ -104,6 +106,18 @@ static void TrimToMaxSignificantDigits(Vector<const char> buffer, int exponent,
       exponent + (buffer.length() - kMaxSignificantDecimalDigits);
 }
 
+// Converts the eight digits at {chars} to their value, with SWAR arithmetic
+// on the 64-bit word they form: each step combines pairs of adjacent 1-, 2-
+// and 4-digit groups.
+static uint32_t ReadEightDigits(const char* chars) {
+  uint64_t value =
+      ReadLittleEndianValue<uint64_t>(reinterpret_cast<Address>(chars));
+  value = ((value & 0x0F0F'0F0F'0F0F'0F0F) * 2561) >> 8;
+  value = ((value & 0x00FF'00FF'00FF'00FF) * 6553601) >> 16;
+  return static_cast<uint32_t>(
+      ((value & 0x0000'FFFF'0000'FFFF) * 42949672960001) >> 32);
+}
+
 // Reads digits from the buffer and converts them to a uint64.
 // Reads in as many digits as fit into a uint64.
 // When the string starts with "1844674407370955161" no further digit is read.
@@ -113,6 +127,11 @@ static uint64_t ReadUint64(Vector<const char> buffer,
                            int* number_of_read_digits) {
   uint64_t result = 0;
   int i = 0;
+  // Eight more digits can't exceed the limit below while result < 10^11.
+  while (i + 8 <= buffer.length() && result < uint64_t{100'000'000'000}) {
+    result = result * 100'000'000 + ReadEightDigits(buffer.begin() + i);
+    i += 8;
+  }
   while (i < buffer.length() && result <= (kMaxUint64 / 10 - 1)) {
     int digit = buffer[i++] - '0';
     DCHECK(0 <= digit && digit <= 9);
@@ -202,6 +221,24 @@ static bool DoubleStrtod(Vector<const char> trimmed, int exponent,
 
 // Returns 10^exponent as an exact DiyFp.
 // The given exponent must be in the range [1; kDecimalExponentDistance[.
+// Computes the double with the Eisel-Lemire algorithm from the digits that
+// ReadUint64 reads. If there are more digits, the exact value is between
+// the ones for the significand read and the next larger one, and is only
+// known to round correctly if both of them round to the same double.
+static bool EiselLemireStrtod(Vector<const char> buffer, int exponent,
+                              double* result) {
+  int read_digits;
+  uint64_t significand = ReadUint64(buffer, &read_digits);
+  int remaining_decimals = buffer.length() - read_digits;
+  double lower = EiselLemire(significand, exponent + remaining_decimals);
+  if (remaining_decimals != 0 &&
+      EiselLemire(significand + 1, exponent + remaining_decimals) != lower) {
+    return false;
+  }
+  *result = lower;
+  return true;
+}
+
 static DiyFp AdjustmentPowerOfTen(int exponent) {
   DCHECK_LT(0, exponent);
   DCHECK_LT(exponent, PowersOfTenCache::kDecimalExponentDistance);
@@ -408,6 +445,7 @@ double Strtod(Vector<const char> buffer, int exponent) {
 
   double guess;
   if (DoubleStrtod(trimmed, exponent, &guess) ||
+      EiselLemireStrtod(trimmed, exponent, &guess) ||
       DiyFpStrtod(trimmed, exponent, &guess)) {
     return guess;
   }
@@ -204,6 +204,14 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
+// static
+bool OS::SetNumaPreferredNode(void* address, size_t size, int node) {
+  return false;
+}
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(alph): implement for the platform.
@@ -318,6 +318,14 @@ bool OS::DecommitPages(void* address, size_t size) {
          DiscardSystemPages(address, size);
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
+// static
+bool OS::SetNumaPreferredNode(void* address, size_t size, int node) {
+  return false;
+}
+
 // static
 bool OS::CanReserveAddressSpace() { return true; }
 
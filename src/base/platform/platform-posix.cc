@@ -582,6 +582,36 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
+  DCHECK_EQ(0, size % CommitPageSize());
+#if defined(V8_OS_LINUX) && defined(MADV_HUGEPAGE)
+  // Fails with EINVAL if the kernel was built without transparent huge pages.
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool OS::SetNumaPreferredNode(void* address, size_t size, int node) {
+  DCHECK_GE(node, 0);
+#if defined(V8_OS_LINUX) && defined(__NR_mbind)
+  // There is no libc wrapper without libnuma, so call mbind directly.
+  constexpr int kMpolPreferred = 1;
+  unsigned long node_mask = 0;  // NOLINT(runtime/int)
+  constexpr size_t kMaxNodes = sizeof(node_mask) * CHAR_BIT;
+  if (static_cast<size_t>(node) >= kMaxNodes) return false;
+  node_mask = 1ul << node;
+  // The kernel ignores the last bit of |maxnode|.
+  return syscall(__NR_mbind, address, size, kMpolPreferred, &node_mask,
+                 kMaxNodes + 1, 0) == 0;
+#else
+  return false;
+#endif
+}
+
 #if !defined(_AIX)
 // See AIX version for details.
 // static
@@ -1339,6 +1369,72 @@ Stack::StackSlot Stack::GetCurrentStackPosition() {
   return __builtin_frame_address(0);
 }
 
+#if V8_OS_LINUX
+namespace {
+
+constexpr int kMaxNumaNodes = 64;
+
+// Returns the CPUs of |node| as listed in sysfs, e.g. "0-7,16-23". The list
+// is read once per node.
+bool GetNumaNodeCpus(int node, cpu_set_t* cpus) {
+  static LazyMutex mutex = LAZY_MUTEX_INITIALIZER;
+  static bool parsed[kMaxNumaNodes];
+  static cpu_set_t node_cpus[kMaxNumaNodes];
+  if (node < 0 || node >= kMaxNumaNodes) return false;
+
+  MutexGuard guard(mutex.Pointer());
+  if (!parsed[node]) {
+    parsed[node] = true;
+    CPU_ZERO(&node_cpus[node]);
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+             node);
+    if (FILE* file = fopen(path, "r")) {
+      int first;
+      while (fscanf(file, "%d", &first) == 1) {
+        int last = first;
+        int separator = fgetc(file);
+        if (separator == '-') {
+          if (fscanf(file, "%d", &last) != 1) break;
+          separator = fgetc(file);
+        }
+        for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) {
+          CPU_SET(cpu, &node_cpus[node]);
+        }
+        if (separator != ',') break;
+      }
+      fclose(file);
+    }
+  }
+  *cpus = node_cpus[node];
+  return CPU_COUNT(cpus) > 0;
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
+NumaNodeAffinityScope::NumaNodeAffinityScope(int node) {
+#if V8_OS_LINUX
+  static_assert(sizeof(cpu_set_t) <= sizeof(previous_affinity_));
+  cpu_set_t* previous = reinterpret_cast<cpu_set_t*>(previous_affinity_);
+  cpu_set_t cpus;
+  if (node < 0 || !GetNumaNodeCpus(node, &cpus)) return;
+  if (sched_getaffinity(0, sizeof(cpu_set_t), previous) != 0) return;
+  restore_ = sched_setaffinity(0, sizeof(cpu_set_t), &cpus) == 0;
+#else
+  USE(node);
+#endif
+}
+
+NumaNodeAffinityScope::~NumaNodeAffinityScope() {
+#if V8_OS_LINUX
+  if (restore_) {
+    USE(sched_setaffinity(0, sizeof(cpu_set_t),
+                          reinterpret_cast<cpu_set_t*>(previous_affinity_)));
+  }
+#endif
+}
+
 #undef LOG_TAG
 #undef MAP_ANONYMOUS
 #undef MADV_FREE
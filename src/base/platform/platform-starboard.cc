@@ -490,6 +490,16 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
+bool OS::SetNumaPreferredNode(void* address, size_t size, int node) {
+  return false;
+}
+
+NumaNodeAffinityScope::NumaNodeAffinityScope(int node) {}
+
+NumaNodeAffinityScope::~NumaNodeAffinityScope() = default;
+
 // static
 Stack::StackSlot Stack::GetCurrentStackPosition() {
   void* addresses[kStackSize];
@@ -1073,6 +1073,19 @@ bool OS::DecommitPages(void* address, size_t size) {
   return VirtualFree(address, size, MEM_DECOMMIT) != 0;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Large pages on Windows need to be allocated as such upfront.
+  return false;
+}
+
+// static
+bool OS::SetNumaPreferredNode(void* address, size_t size, int node) {
+  // NUMA placement on Windows is selected at allocation time with
+  // VirtualAllocExNuma.
+  return false;
+}
+
 // static
 bool OS::CanReserveAddressSpace() {
   return VirtualAlloc2 != nullptr && MapViewOfFile3 != nullptr &&
@@ -1818,5 +1831,9 @@ Stack::StackSlot Stack::GetCurrentStackPosition() {
 #endif
 }
 
+NumaNodeAffinityScope::NumaNodeAffinityScope(int node) {}
+
+NumaNodeAffinityScope::~NumaNodeAffinityScope() = default;
+
 }  // namespace base
 }  // namespace v8
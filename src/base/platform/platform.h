@@ -346,6 +346,15 @@ class V8_BASE_EXPORT OS {
   // Make part of the process's data memory read-only.
   static void SetDataReadOnly(void* address, size_t size);
 
+  // Advises the OS to back the given range with huge pages once it is
+  // committed, e.g. with transparent huge pages on Linux. The range keeps its
+  // permissions. Returns false if the advice is not supported or was refused.
+  static bool AdviseHugePages(void* address, size_t size);
+
+  // Makes the OS prefer memory of NUMA |node| when committing pages of the
+  // given range. Returns false if NUMA memory policies are not supported.
+  static bool SetNumaPreferredNode(void* address, size_t size, int node);
+
  private:
   // These classes use the private memory management API below.
   friend class AddressSpaceReservation;
@@ -425,6 +434,28 @@ inline void EnsureConsoleOutput() {
 #endif  // (defined(_WIN32) || defined(_WIN64))
 }
 
+// ----------------------------------------------------------------------------
+// NumaNodeAffinityScope
+//
+// Restricts the calling thread to the CPUs of a NUMA node for the lifetime of
+// the scope and restores the previous affinity afterwards. Does nothing for a
+// negative node or where thread affinities are not supported.
+class V8_BASE_EXPORT NumaNodeAffinityScope final {
+ public:
+  explicit NumaNodeAffinityScope(int node);
+  ~NumaNodeAffinityScope();
+
+  NumaNodeAffinityScope(const NumaNodeAffinityScope&) = delete;
+  NumaNodeAffinityScope& operator=(const NumaNodeAffinityScope&) = delete;
+
+#if V8_OS_LINUX
+ private:
+  bool restore_ = false;
+  // Opaque storage for the previous affinity mask.
+  alignas(uint64_t) uint8_t previous_affinity_[128];
+#endif  // V8_OS_LINUX
+};
+
 // ----------------------------------------------------------------------------
 // AddressSpaceReservation
 //
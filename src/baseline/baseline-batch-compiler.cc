@@ -19,6 +19,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/logging/counters.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/utils/locked-queue-inl.h"
@@ -101,6 +102,8 @@ class BaselineBatchCompilerJob {
  public:
   BaselineBatchCompilerJob(Isolate* isolate, Handle<WeakFixedArray> task_queue,
                            int batch_size) {
+    base::ElapsedTimer timer;
+    timer.Start();
     handles_ = isolate->NewPersistentHandles();
     tasks_.reserve(batch_size);
     for (int i = 0; i < batch_size; i++) {
@@ -122,29 +125,56 @@ class BaselineBatchCompilerJob {
       PrintF(scope.file(), "[Concurrent Sparkplug] compiling %zu functions\n",
              tasks_.size());
     }
+    isolate->counters()->sparkplug_concurrent_prepare()->AddTimedSample(
+        timer.Elapsed());
   }
 
+  bool is_empty() const { return tasks_.empty(); }
+
   // Executed in the background thread.
   void Compile(LocalIsolate* local_isolate) {
+    base::ElapsedTimer timer;
+    timer.Start();
     local_isolate->heap()->AttachPersistentHandles(std::move(handles_));
     for (auto& task : tasks_) {
       task.Compile(local_isolate);
     }
     // Get the handle back since we'd need them to install the code later.
     handles_ = local_isolate->heap()->DetachPersistentHandles();
+    compile_time_ = timer.Elapsed();
   }
 
   // Executed in the main thread.
   void Install(Isolate* isolate) {
-    HandleScope local_scope(isolate);
-    for (auto& task : tasks_) {
-      task.Install(isolate);
+    base::ElapsedTimer timer;
+    timer.Start();
+    {
+      HandleScope local_scope(isolate);
+      for (auto& task : tasks_) {
+        task.Install(isolate);
+      }
+    }
+    base::TimeDelta install_time = timer.Elapsed();
+    // The background compile time is what the main thread saved by not
+    // compiling the batch itself.
+    isolate->counters()->sparkplug_concurrent_execute()->AddTimedSample(
+        compile_time_);
+    isolate->counters()->sparkplug_concurrent_install()->AddTimedSample(
+        install_time);
+    if (v8_flags.trace_baseline_concurrent_compilation) {
+      CodeTracer::Scope scope(isolate->GetCodeTracer());
+      PrintF(scope.file(),
+             "[Concurrent Sparkplug] installed %zu functions: %.3f ms off "
+             "thread, %.3f ms on the main thread\n",
+             tasks_.size(), compile_time_.InMillisecondsF(),
+             install_time.InMillisecondsF());
     }
   }
 
  private:
   std::vector<BaselineCompilerTask> tasks_;
   std::unique_ptr<PersistentHandles> handles_;
+  base::TimeDelta compile_time_;
 };
 
 class ConcurrentBaselineCompiler {
@@ -164,14 +194,19 @@ class ConcurrentBaselineCompiler {
       UnparkedScope unparked_scope(&local_isolate);
       LocalHandleScope handle_scope(&local_isolate);
 
+      bool has_code_to_install = false;
       while (!incoming_queue_->IsEmpty() && !delegate->ShouldYield()) {
         std::unique_ptr<BaselineBatchCompilerJob> job;
         if (!incoming_queue_->Dequeue(&job)) break;
         DCHECK_NOT_NULL(job);
         job->Compile(&local_isolate);
         outgoing_queue_->Enqueue(std::move(job));
+        has_code_to_install = true;
+      }
+      // Only interrupt the main thread if there is something to install.
+      if (has_code_to_install) {
+        isolate_->stack_guard()->RequestInstallBaselineCode();
       }
-      isolate_->stack_guard()->RequestInstallBaselineCode();
     }
 
     size_t GetMaxConcurrency(size_t worker_count) const override {
@@ -212,8 +247,12 @@ class ConcurrentBaselineCompiler {
   void CompileBatch(Handle<WeakFixedArray> task_queue, int batch_size) {
     DCHECK(v8_flags.concurrent_sparkplug);
     RCS_SCOPE(isolate_, RuntimeCallCounterId::kCompileBaseline);
-    incoming_queue_.Enqueue(std::make_unique<BaselineBatchCompilerJob>(
-        isolate_, task_queue, batch_size));
+    auto job = std::make_unique<BaselineBatchCompilerJob>(isolate_, task_queue,
+                                                          batch_size);
+    // All functions of the batch may have been collected, flushed or compiled
+    // in the meantime; don't wake up a worker for nothing.
+    if (job->is_empty()) return;
+    incoming_queue_.Enqueue(std::move(job));
     job_handle_->NotifyConcurrencyIncrease();
   }
 
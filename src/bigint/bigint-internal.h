@@ -5,6 +5,7 @@
 #ifndef V8_BIGINT_BIGINT_INTERNAL_H_
 #define V8_BIGINT_BIGINT_INTERNAL_H_
 
+#include <atomic>
 #include <memory>
 
 #include "src/bigint/bigint.h"
@@ -16,6 +17,9 @@ constexpr int kKaratsubaThreshold = 34;
 constexpr int kToomThreshold = 193;
 constexpr int kFftThreshold = 1500;
 constexpr int kFftInnerThreshold = 200;
+// Sum of the input lengths from which the outer FFT runs its transforms and
+// pointwise multiplications on worker threads.
+constexpr int kFftParallelThreshold = 40000;
 
 constexpr int kBurnikelThreshold = 57;
 constexpr int kNewtonInversionThreshold = 50;
@@ -23,6 +27,9 @@ constexpr int kNewtonInversionThreshold = 50;
 
 constexpr int kToStringFastThreshold = 43;
 constexpr int kFromStringLargeThreshold = 300;
+// Input length from which the fast to-string conversion formats independent
+// chunks on worker threads.
+constexpr int kToStringParallelThreshold = 8000;
 
 class ProcessorImpl : public Processor {
  public:
@@ -75,6 +82,13 @@ class ProcessorImpl : public Processor {
 
   bool should_terminate() { return status_ == Status::kInterrupted; }
 
+  // Calls {work(i, processor)} for each i in [0, count), using the
+  // platform's worker threads if it has any. {processor} is this processor
+  // on the calling thread, and a separate one on other threads; all of them
+  // stop picking up new items once this processor has been interrupted.
+  template <typename Work>
+  void RunInParallel(int count, const Work& work);
+
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
   // Doesn't need to be accurate; we just want to make sure to check for
   // interrupt requests every now and then (roughly every 10-100 ms; often
@@ -98,6 +112,62 @@ class ProcessorImpl : public Processor {
   Platform* platform_;
 };
 
+// The processor of the other threads that run a {ParallelWork}. They can't
+// query the embedder's platform, so they follow the calling thread.
+class InterruptFlagPlatform final : public Platform {
+ public:
+  explicit InterruptFlagPlatform(const std::atomic<bool>* interrupted)
+      : interrupted_(interrupted) {}
+
+  bool InterruptRequested() override {
+    return interrupted_->load(std::memory_order_relaxed);
+  }
+
+ private:
+  const std::atomic<bool>* interrupted_;
+};
+
+template <typename Work>
+class ParallelWork final : public Platform::ParallelTask {
+ public:
+  ParallelWork(int count, ProcessorImpl* processor, const Work& work)
+      : count_(count), processor_(processor), work_(work) {}
+
+  void Run(bool is_calling_thread) override {
+    if (is_calling_thread) return RunItems(processor_);
+    ProcessorImpl worker(new InterruptFlagPlatform(&interrupted_));
+    RunItems(&worker);
+  }
+
+  int RemainingWorkItems() const override {
+    return std::max(0, count_ - next_item_.load(std::memory_order_relaxed));
+  }
+
+ private:
+  void RunItems(ProcessorImpl* processor) {
+    while (!interrupted_.load(std::memory_order_relaxed)) {
+      int item = next_item_.fetch_add(1, std::memory_order_relaxed);
+      if (item >= count_) return;
+      work_(item, processor);
+      if (processor == processor_ && processor->should_terminate()) {
+        interrupted_.store(true, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  const int count_;
+  ProcessorImpl* const processor_;
+  const Work& work_;
+  std::atomic<int> next_item_{0};
+  std::atomic<bool> interrupted_{false};
+};
+
+template <typename Work>
+void ProcessorImpl::RunInParallel(int count, const Work& work) {
+  ParallelWork<Work> task(count, this, work);
+  platform_->RunInParallel(&task);
+}
+
 // These constants are primarily needed for Barrett division in div-barrett.cc,
 // and they're also needed by fast to-string conversion in tostring.cc.
 constexpr int DivideBarrettScratchSpace(int n) { return n + 2; }
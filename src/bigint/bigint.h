@@ -191,6 +191,27 @@ class Platform {
   // a Platform subclass that overrides this method. It will be queried
   // every now and then by long-running operations.
   virtual bool InterruptRequested() { return false; }
+
+  // Operations on very large inputs split some of their work into
+  // independent items that can be processed concurrently.
+  class ParallelTask {
+   public:
+    virtual ~ParallelTask() = default;
+
+    // Processes work items until none are left. May be called on several
+    // threads at once; {is_calling_thread} must be true only on the thread
+    // that called {RunInParallel}, which is the only one that may query
+    // {InterruptRequested}.
+    virtual void Run(bool is_calling_thread) = 0;
+    // The number of work items that no call to {Run} has picked up yet.
+    virtual int RemainingWorkItems() const = 0;
+  };
+
+  // If you want long-running operations to use worker threads, implement a
+  // Platform subclass that overrides this method. It must call {task->Run}
+  // on any number of threads, and return once all of these calls have
+  // returned and no work items are left.
+  virtual void RunInParallel(ParallelTask* task) { task->Run(true); }
 };
 
 // These are the operations that this library supports.
@@ -424,6 +424,14 @@ int GetParameters(int N, Parameters* params) {
 ////////////////////////////////////////////////////////////////////////////////
 // Part 3: Fast Fourier Transformation.
 
+// For parallel execution, the transformations and pointwise multiplications
+// are split into this many work items.
+constexpr int kParallelFftWorkItems = 64;
+// The number of levels at the top of the backwards FFT that are processed
+// one at a time in parallel execution; below them the ranges are
+// independent.
+constexpr int kParallelFftDepth = 6;
+
 class FFTContainer {
  public:
   // {n} is the number of chunks, whose length is {K}+1.
@@ -460,10 +468,13 @@ class FFTContainer {
 
   void BackwardFFT(int start, int len, int omega);
   void BackwardFFT_Threadsafe(int start, int len, int omega, digit_t* temp);
+  void BackwardButterfly(int start, int len, int omega, int k, digit_t* temp);
+  void BackwardFFT_Parallel(int omega);
 
   void PointwiseMultiply(const FFTContainer& other);
+  void PointwiseMultiply_Parallel(const FFTContainer& other);
   void DoPointwiseMultiplication(const FFTContainer& other, int start, int end,
-                                 digit_t* temp);
+                                 digit_t* temp, ProcessorImpl* processor);
 
   int length() const { return length_; }
 
@@ -599,13 +610,54 @@ void FFTContainer::BackwardFFT_Threadsafe(int start, int len, int omega,
     BackwardFFT_Threadsafe(start, half, 2 * omega, temp);
     BackwardFFT_Threadsafe(start + half, half, 2 * omega, temp);
   }
-  SumDiff(part_[start], part_[start + half], part_[start], part_[start + half],
+  for (int k = 0; k < half; k++) {
+    BackwardButterfly(start, len, omega, k, temp);
+  }
+}
+
+// Combines the {k}-th parts of both halves of a range of length {len}.
+void FFTContainer::BackwardButterfly(int start, int len, int omega, int k,
+                                     digit_t* temp) {
+  int half = len / 2;
+  if (k == 0) {
+    SumDiff(part_[start], part_[start + half], part_[start],
+            part_[start + half], length_);
+    return;
+  }
+  int w = omega * (len - k);
+  ShiftModFn(temp, part_[start + half + k], w, K_);
+  SumDiff(part_[start + k], part_[start + half + k], part_[start + k], temp,
           length_);
-  for (int k = 1; k < half; k++) {
-    int w = omega * (len - k);
-    ShiftModFn(temp, part_[start + half + k], w, K_);
-    SumDiff(part_[start + k], part_[start + half + k], part_[start + k], temp,
-            length_);
+}
+
+// Same as {BackwardFFT(0, n_, omega)}, on the processor's worker threads.
+// The ranges a few levels below the top are transformed independently;
+// the butterflies of the levels above them are independent within each level.
+void FFTContainer::BackwardFFT_Parallel(int omega) {
+  // As in {BackwardFFT_Threadsafe}, ranges of length 2 were already
+  // transformed by the pointwise multiplication.
+  int depth = 0;
+  while (depth < kParallelFftDepth && (n_ >> depth) / 2 > 2) depth++;
+  const int range_len = n_ >> depth;
+  processor_->RunInParallel(1 << depth, [&](int i, ProcessorImpl*) {
+    ScratchDigits temp(2 * length_);
+    BackwardFFT_Threadsafe(i * range_len, range_len, omega << depth,
+                           temp.digits());
+  });
+  const int half = n_ / 2;
+  for (int level = depth - 1; level >= 0; level--) {
+    const int len = n_ >> level;
+    processor_->RunInParallel(kParallelFftWorkItems, [&](int item,
+                                                         ProcessorImpl*) {
+      ScratchDigits temp(2 * length_);
+      // Each level has {half} butterflies in total.
+      int end = half * (item + 1) / kParallelFftWorkItems;
+      for (int i = half * item / kParallelFftWorkItems; i < end; i++) {
+        int range = i / (len / 2);
+        BackwardButterfly(range * len, len, omega << level, i % (len / 2),
+                          temp.digits());
+      }
+    });
   }
 }
 
@@ -721,8 +773,8 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 
 // Actual implementation of pointwise multiplications.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
-                                             int start, int end,
-                                             digit_t* temp) {
+                                             int start, int end, digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -733,11 +785,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -750,7 +802,53 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
 // Convenient entry point for pointwise multiplications.
 void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
+}
+
+// Same as {PointwiseMultiply}, on the processor's worker threads.
+void FFTContainer::PointwiseMultiply_Parallel(const FFTContainer& other) {
+  DCHECK(n_ == other.n_);
+  // Each work item gets an even number of parts, for the first level of the
+  // backwards FFT.
+  const int pairs = n_ / 2;
+  processor_->RunInParallel(
+      kParallelFftWorkItems, [&](int item, ProcessorImpl* processor) {
+        int start = 2 * (pairs * item / kParallelFftWorkItems);
+        int end = 2 * (pairs * (item + 1) / kParallelFftWorkItems);
+        if (start == end) return;
+        ScratchDigits temp(2 * length_);
+        DoPointwiseMultiplication(other, start, end, temp.digits(), processor);
+      });
+}
+
+// Main FFT function for huge inputs: uses the platform's worker threads for
+// the forward FFTs of both inputs, the pointwise multiplications, and the
+// backwards FFT.
+void MultiplyFFT_Parallel(RWDigits Z, Digits X, Digits Y,
+                          const Parameters& params, int m,
+                          ProcessorImpl* processor) {
+  int omega = params.r;  // really: 2^r
+
+  FFTContainer a(params.n, params.K, processor);
+  if (X == Y) {
+    // Squaring.
+    a.Start(X, params.s, 0, omega);
+    a.PointwiseMultiply_Parallel(a);
+  } else {
+    FFTContainer b(params.n, params.K, processor);
+    processor->RunInParallel(2, [&](int i, ProcessorImpl*) {
+      if (i == 0) {
+        a.Start(X, params.s, 0, omega);
+      } else {
+        b.Start(Y, params.s, 0, omega);
+      }
+    });
+    a.PointwiseMultiply_Parallel(b);
+  }
+  if (processor->should_terminate()) return;
+
+  a.BackwardFFT_Parallel(omega);
+  a.NormalizeAndRecombine(omega, m, Z, params.s);
 }
 
 }  // namespace
@@ -769,6 +867,10 @@ void ProcessorImpl::MultiplyFFT(RWDigits Z, Digits X, Digits Y) {
   int m = GetParameters(X.len() + Y.len(), &params);
   int omega = params.r;  // really: 2^r
 
+  if (X.len() + Y.len() >= kFftParallelThreshold) {
+    return MultiplyFFT_Parallel(Z, X, Y, params, m, this);
+  }
+
   FFTContainer a(params.n, params.K, this);
   a.Start(X, params.s, 0, omega);
   if (X == Y) {
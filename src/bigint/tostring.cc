@@ -4,6 +4,8 @@
 
 #include <cstring>
 #include <limits>
+#include <memory>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/digit-arithmetic.h"
@@ -107,6 +109,7 @@ char* DivideByMagic(RWDigits rest, Digits input, char* output) {
 }
 
 class RecursionLevel;
+struct DeferredChunk;
 
 // The classic algorithm must check for interrupt requests if no faster
 // algorithm is available.
@@ -175,7 +178,7 @@ class ToStringFormatter {
   char* FillWithZeros(RecursionLevel* level, char* prev_cursor, char* out,
                       bool is_last_on_level);
   char* ProcessLevel(RecursionLevel* level, Digits chunk, char* out,
-                     bool is_last_on_level);
+                     bool is_last_on_level, ProcessorImpl* processor);
 
  private:
   // When processing the last (most significant) digit, don't write leading
@@ -212,6 +215,9 @@ class ToStringFormatter {
   char* out_;
   digit_t chunk_divisor_ = 0;
   ProcessorImpl* processor_;
+  // While non-null, {ProcessLevel} collects small chunks here instead of
+  // formatting them, see {Fast}.
+  std::vector<std::unique_ptr<DeferredChunk>>* deferred_chunks_ = nullptr;
 };
 
 #undef MAYBE_INTERRUPT
@@ -418,11 +424,62 @@ Digits RecursionLevel::GetInverse(int dividend_length) {
   return inverse_ + (inverse_.len() - inverse_len);
 }
 
+// Chunks of at most this length are formatted on worker threads when the
+// whole input is at least {kToStringParallelThreshold} digits long.
+constexpr int kParallelChunkLength = kToStringParallelThreshold / 8;
+
+// A chunk whose formatting was deferred by {ProcessLevel}. It owns a copy of
+// its digits, because the scratch space they lived in is gone by the time
+// it is processed.
+struct DeferredChunk {
+  DeferredChunk(RecursionLevel* level, Digits digits, char* out,
+                bool is_last_on_level)
+      : level(level),
+        chunk(digits.len()),
+        out(out),
+        is_last_on_level(is_last_on_level) {
+    for (int i = 0; i < digits.len(); i++) chunk[i] = digits[i];
+  }
+
+  RecursionLevel* level;
+  ScratchDigits chunk;
+  char* out;
+  bool is_last_on_level;
+  char* result = nullptr;
+};
+
 void ToStringFormatter::Fast() {
   std::unique_ptr<RecursionLevel> recursion_levels(RecursionLevel::CreateLevels(
       chunk_divisor_, chunk_chars_, BitLength(digits_), processor_));
   if (processor_->should_terminate()) return;
-  out_ = ProcessLevel(recursion_levels.get(), digits_, out_, true);
+  if (digits_.len() < kToStringParallelThreshold) {
+    out_ = ProcessLevel(recursion_levels.get(), digits_, out_, true,
+                        processor_);
+    return;
+  }
+  // Do the large divisions on this thread, collecting the small chunks they
+  // produce. Each of these has a fixed range of characters to write, so they
+  // can then be formatted independently of each other.
+  std::vector<std::unique_ptr<DeferredChunk>> deferred_chunks;
+  deferred_chunks_ = &deferred_chunks;
+  out_ = ProcessLevel(recursion_levels.get(), digits_, out_, true,
+                      processor_);
+  deferred_chunks_ = nullptr;
+  if (processor_->should_terminate()) return;
+  processor_->RunInParallel(
+      static_cast<int>(deferred_chunks.size()),
+      [this, &deferred_chunks](int i, ProcessorImpl* processor) {
+        DeferredChunk* deferred = deferred_chunks[i].get();
+        deferred->result =
+            ProcessLevel(deferred->level, deferred->chunk, deferred->out,
+                         deferred->is_last_on_level, processor);
+      });
+  if (processor_->should_terminate()) return;
+  // If the most significant chunk was deferred, it determines where the
+  // result starts.
+  for (const std::unique_ptr<DeferredChunk>& deferred : deferred_chunks) {
+    if (deferred->is_last_on_level) out_ = deferred->result;
+  }
 }
 
 // Writes '0' characters right-to-left, starting at {out}-1, until the distance
@@ -444,7 +501,8 @@ char* ToStringFormatter::FillWithZeros(RecursionLevel* level,
 }
 
 char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
-                                      char* out, bool is_last_on_level) {
+                                      char* out, bool is_last_on_level,
+                                      ProcessorImpl* processor) {
   // Step 0: if only one digit is left, bail out to the base case.
   Digits normalized = chunk;
   normalized.Normalize();
@@ -456,11 +514,22 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
     return FillWithZeros(level, right_boundary, out, is_last_on_level);
   }
 
+  // Step 0.5: When collecting chunks for parallel formatting, leave small
+  // enough ones for later. Except for the most significant one, we know
+  // where they will end.
+  if (deferred_chunks_ != nullptr && normalized.len() <= kParallelChunkLength) {
+    deferred_chunks_->push_back(std::make_unique<DeferredChunk>(
+        level, normalized, out, is_last_on_level));
+    if (is_last_on_level) return nullptr;
+    return out - level->char_count_ * 2;
+  }
+
   // Step 1: If the chunk is guaranteed to remain smaller than the divisor
   // even after left-shifting, fall through to the next level immediately.
   if (normalized.len() < level->divisor_.len()) {
     char* right_boundary = out;
-    out = ProcessLevel(level->next_, chunk, out, is_last_on_level);
+    out = ProcessLevel(level->next_, chunk, out, is_last_on_level,
+                       processor);
     return FillWithZeros(level, right_boundary, out, is_last_on_level);
   }
   // Step 2: Prepare the chunk.
@@ -483,7 +552,8 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
       chunk_shifted.Reset();
       // ...and otherwise undo the {chunk = chunk_shifted} assignment above.
       chunk = original_chunk;
-      out = ProcessLevel(level->next_, chunk, out, is_last_on_level);
+      out = ProcessLevel(level->next_, chunk, out, is_last_on_level,
+                         processor);
     } else {
       DCHECK(comparison == 0);
       // If the chunk is equal to the divisor, we know that the right half
@@ -505,22 +575,22 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
   // Step 4: Divide to split {chunk} into {left} and {right}.
   int inverse_len = chunk.len() - level->divisor_.len();
   if (inverse_len == 0) {
-    processor_->DivideSchoolbook(left, right, chunk, level->divisor_);
+    processor->DivideSchoolbook(left, right, chunk, level->divisor_);
   } else if (level->divisor_.len() == 1) {
-    processor_->DivideSingle(left, right.digits(), chunk, level->divisor_[0]);
+    processor->DivideSingle(left, right.digits(), chunk, level->divisor_[0]);
     for (int i = 1; i < right.len(); i++) right[i] = 0;
   } else {
     ScratchDigits scratch(DivideBarrettScratchSpace(chunk.len()));
     // The top level only computes its inverse when {chunk.len()} is
     // available. Other levels have precomputed theirs.
     if (level->is_toplevel_) {
-      level->ComputeInverse(processor_, chunk.len());
-      if (processor_->should_terminate()) return out;
+      level->ComputeInverse(processor, chunk.len());
+      if (processor->should_terminate()) return out;
     }
     Digits inverse = level->GetInverse(chunk.len());
-    processor_->DivideBarrett(left, right, chunk, level->divisor_, inverse,
-                              scratch);
-    if (processor_->should_terminate()) return out;
+    processor->DivideBarrett(left, right, chunk, level->divisor_, inverse,
+                             scratch);
+    if (processor->should_terminate()) return out;
   }
   RightShift(right, right, level->leading_zero_shift_);
 #if DEBUG
@@ -530,16 +600,17 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
 #endif
 
   // Step 5: Recurse.
-  char* end_of_right_part = ProcessLevel(level->next_, right, out, false);
-  if (processor_->should_terminate()) return out;
+  char* end_of_right_part =
+      ProcessLevel(level->next_, right, out, false, processor);
+  if (processor->should_terminate()) return out;
   // The recursive calls are required and hence designed to write exactly as
   // many characters as their level is responsible for.
   DCHECK(end_of_right_part == out - level->char_count_);
   USE(end_of_right_part);
-  // We intentionally don't use {end_of_right_part} here to be prepared for
-  // potential future multi-threaded execution.
+  // We intentionally don't use {end_of_right_part} here, so that the right
+  // part doesn't have to be formatted first (see {Fast}).
   return ProcessLevel(level->next_, left, out - level->char_count_,
-                      is_last_on_level);
+                      is_last_on_level, processor);
 }
 
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
@@ -582,6 +582,29 @@ Object ArrayBufferTransfer(Isolate* isolate, Handle<JSArrayBuffer> array_buffer,
 
   // Case 2: We can reuse the same BackingStore.
   auto from_backing_store = array_buffer->GetBackingStore();
+  if (from_backing_store && from_backing_store->is_resizable_by_js() &&
+      resizable == ResizableFlag::kResizable &&
+      new_byte_length <= new_max_byte_length) {
+    DCHECK_EQ(new_max_byte_length, from_backing_store->max_byte_length());
+    // The new buffer has the same maximum byte length, so it can take over
+    // the reserved memory and only needs to (de)commit pages for the new
+    // length. This covers steps 10-14.
+    if (new_byte_length != array_buffer->GetByteLength() &&
+        from_backing_store->ResizeInPlace(isolate, new_byte_length) !=
+            BackingStore::ResizeOrGrowResult::kSuccess) {
+      THROW_NEW_ERROR_RETURN_FAILURE(
+          isolate,
+          NewRangeError(MessageTemplate::kArrayBufferAllocationFailed));
+    }
+
+    // 15. Perform ! DetachArrayBuffer(arrayBuffer).
+    JSArrayBuffer::Detach(array_buffer).Check();
+
+    // 9. Let newBuffer be ? AllocateArrayBuffer(%ArrayBuffer%, newByteLength,
+    //    newMaxByteLength).
+    // 16. Return newBuffer.
+    return *isolate->factory()->NewJSArrayBuffer(std::move(from_backing_store));
+  }
   if (from_backing_store && !from_backing_store->is_resizable_by_js() &&
       resizable == ResizableFlag::kNotResizable &&
       (new_byte_length == array_buffer->GetByteLength() ||
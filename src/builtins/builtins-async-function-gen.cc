@@ -140,6 +140,12 @@ TF_BUILTIN(AsyncFunctionEnter, AsyncFunctionBuiltinsAssembler) {
       parameters_and_registers);
   StoreObjectFieldNoWriteBarrier(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset, promise);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                       RootIndex::kUndefinedValue);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                       RootIndex::kUndefinedValue);
 
   // While we are executing an async function, we need to have the implicit
   // promise on the stack to get the catch prediction right, even before we
@@ -238,14 +244,39 @@ void AsyncFunctionBuiltinsAssembler::AsyncFunctionAwait(
   auto value = Parameter<Object>(Descriptor::kValue);
   auto context = Parameter<Context>(Descriptor::kContext);
 
-  TNode<SharedFunctionInfo> on_resolve_sfi =
-      AsyncFunctionAwaitResolveSharedFunConstant();
-  TNode<SharedFunctionInfo> on_reject_sfi =
-      AsyncFunctionAwaitRejectSharedFunConstant();
+  // An async function only awaits one value at a time, so all its awaits can
+  // resume it through the same closures.
+  TVARIABLE(Object, var_on_resolve,
+            LoadObjectField(async_function_object,
+                            JSAsyncFunctionObject::kAwaitResolveClosureOffset));
+  TVARIABLE(Object, var_on_reject,
+            LoadObjectField(async_function_object,
+                            JSAsyncFunctionObject::kAwaitRejectClosureOffset));
+  Label if_allocate(this, Label::kDeferred), if_closures(this);
+  Branch(IsUndefined(var_on_resolve.value()), &if_allocate, &if_closures);
+  BIND(&if_allocate);
+  {
+    auto [on_resolve, on_reject] = AllocateAwaitClosures(
+        LoadNativeContext(context), async_function_object,
+        AsyncFunctionAwaitResolveSharedFunConstant(),
+        AsyncFunctionAwaitRejectSharedFunConstant());
+    StoreObjectField(async_function_object,
+                     JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                     on_resolve);
+    StoreObjectField(async_function_object,
+                     JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                     on_reject);
+    var_on_resolve = on_resolve;
+    var_on_reject = on_reject;
+    Goto(&if_closures);
+  }
+  BIND(&if_closures);
+
   TNode<JSPromise> outer_promise = LoadObjectField<JSPromise>(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset);
-  Await(context, async_function_object, value, outer_promise, on_resolve_sfi,
-        on_reject_sfi, is_predicted_as_caught);
+  Await(context, async_function_object, value, outer_promise,
+        CAST(var_on_resolve.value()), CAST(var_on_reject.value()),
+        BooleanConstant(is_predicted_as_caught));
 
   // Return outer promise to avoid adding an load of the outer promise before
   // suspending in BytecodeGenerator.
@@ -29,6 +29,18 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<SharedFunctionInfo> on_reject_sfi,
     TNode<Boolean> is_predicted_as_caught) {
   const TNode<NativeContext> native_context = LoadNativeContext(context);
+  auto [on_resolve, on_reject] = AllocateAwaitClosures(
+      native_context, generator, on_resolve_sfi, on_reject_sfi);
+  return Await(context, generator, value, outer_promise, on_resolve, on_reject,
+               is_predicted_as_caught);
+}
+
+TNode<Object> AsyncBuiltinsAssembler::Await(
+    TNode<Context> context, TNode<JSGeneratorObject> generator,
+    TNode<Object> value, TNode<JSPromise> outer_promise,
+    TNode<JSFunction> on_resolve, TNode<JSFunction> on_reject,
+    TNode<Boolean> is_predicted_as_caught) {
+  const TNode<NativeContext> native_context = LoadNativeContext(context);
 
   // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
   // create wrapper promises. Now if {value} is already a promise with the
@@ -82,6 +94,44 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     value = var_value.value();
   }
 
+  // Deal with PromiseHooks and debug support in the runtime. This
+  // also allocates the throwaway promise, which is only needed in
+  // case of PromiseHooks or debugging.
+  TVARIABLE(Object, var_throwaway, UndefinedConstant());
+  Label if_instrumentation(this, Label::kDeferred),
+      if_instrumentation_done(this);
+  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
+  GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
+             promiseHookFlags),
+         &if_instrumentation);
+#ifdef V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
+  // This call to NewJSPromise is to keep behaviour parity with what happens
+  // in Runtime::kDebugAsyncFunctionSuspended below if native hooks are set.
+  // It creates a throwaway promise that will trigger an init event and get
+  // passed into Builtin::kPerformPromiseThen below.
+  GotoIfNot(IsContextPromiseHookEnabled(promiseHookFlags),
+            &if_instrumentation_done);
+  var_throwaway = NewJSPromise(context, value);
+#endif  // V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
+  Goto(&if_instrumentation_done);
+  BIND(&if_instrumentation);
+  {
+    var_throwaway = CallRuntime(Runtime::kDebugAsyncFunctionSuspended,
+                                native_context, value, outer_promise, on_reject,
+                                generator, is_predicted_as_caught);
+    Goto(&if_instrumentation_done);
+  }
+  BIND(&if_instrumentation_done);
+
+  return CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
+                     on_resolve, on_reject, var_throwaway.value());
+}
+
+std::pair<TNode<JSFunction>, TNode<JSFunction>>
+AsyncBuiltinsAssembler::AllocateAwaitClosures(
+    TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator,
+    TNode<SharedFunctionInfo> on_resolve_sfi,
+    TNode<SharedFunctionInfo> on_reject_sfi) {
   static const int kClosureContextSize =
       FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
   TNode<Context> closure_context =
@@ -116,37 +166,8 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   InitializeNativeClosure(closure_context, native_context, on_reject,
                           on_reject_sfi);
 
-  // Deal with PromiseHooks and debug support in the runtime. This
-  // also allocates the throwaway promise, which is only needed in
-  // case of PromiseHooks or debugging.
-  TVARIABLE(Object, var_throwaway, UndefinedConstant());
-  Label if_instrumentation(this, Label::kDeferred),
-      if_instrumentation_done(this);
-  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
-  GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
-             promiseHookFlags),
-         &if_instrumentation);
-#ifdef V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
-  // This call to NewJSPromise is to keep behaviour parity with what happens
-  // in Runtime::kDebugAsyncFunctionSuspended below if native hooks are set.
-  // It creates a throwaway promise that will trigger an init event and get
-  // passed into Builtin::kPerformPromiseThen below.
-  GotoIfNot(IsContextPromiseHookEnabled(promiseHookFlags),
-            &if_instrumentation_done);
-  var_throwaway = NewJSPromise(context, value);
-#endif  // V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
-  Goto(&if_instrumentation_done);
-  BIND(&if_instrumentation);
-  {
-    var_throwaway = CallRuntime(Runtime::kDebugAsyncFunctionSuspended,
-                                native_context, value, outer_promise, on_reject,
-                                generator, is_predicted_as_caught);
-    Goto(&if_instrumentation_done);
-  }
-  BIND(&if_instrumentation_done);
-
-  return CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
-                     on_resolve, on_reject, var_throwaway.value());
+  return {UncheckedCast<JSFunction>(on_resolve),
+          UncheckedCast<JSFunction>(on_reject)};
 }
 
 void AsyncBuiltinsAssembler::InitializeNativeClosure(
@@ -36,6 +36,21 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
     return Await(context, generator, value, outer_promise, on_resolve_sfi,
                  on_reject_sfi, BooleanConstant(is_predicted_as_caught));
   }
+  // Like above, but with the closures from AllocateAwaitClosures.
+  TNode<Object> Await(TNode<Context> context,
+                      TNode<JSGeneratorObject> generator, TNode<Object> value,
+                      TNode<JSPromise> outer_promise,
+                      TNode<JSFunction> on_resolve,
+                      TNode<JSFunction> on_reject,
+                      TNode<Boolean> is_predicted_as_caught);
+
+  // Allocate the resolve and reject closures that resume {generator}. They
+  // only refer to {generator}, so its awaits can share them as long as they
+  // use the same SharedFunctionInfos.
+  std::pair<TNode<JSFunction>, TNode<JSFunction>> AllocateAwaitClosures(
+      TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator,
+      TNode<SharedFunctionInfo> on_resolve_sfi,
+      TNode<SharedFunctionInfo> on_reject_sfi);
 
   // Return a new built-in function object as defined in
   // Async Iterator Value Unwrap Functions
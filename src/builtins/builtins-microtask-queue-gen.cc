@@ -35,8 +35,22 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
                                            TNode<IntPtrT> index);
 
   void PrepareForContext(TNode<Context> microtask_context, Label* bailout);
+  // Promise reaction jobs leave their native context entered, so that a run
+  // of reaction jobs from the same native context only enters it once.
+  // {var_batched_context} holds that native context, or Smi zero if no
+  // context is left entered.
+  void PrepareForBatchedContext(TNode<NativeContext> native_context,
+                                TNode<Context> current_context,
+                                TNode<IntPtrT> saved_entered_context_count,
+                                TVariable<Object>* var_batched_context,
+                                Label* bailout);
+  void LeaveBatchedContext(TNode<Context> current_context,
+                           TNode<IntPtrT> saved_entered_context_count,
+                           TVariable<Object>* var_batched_context);
   void RunSingleMicrotask(TNode<Context> current_context,
-                          TNode<Microtask> microtask);
+                          TNode<Microtask> microtask,
+                          TNode<IntPtrT> saved_entered_context_count,
+                          TVariable<Object>* var_batched_context);
   void IncrementFinishedMicrotaskCount(TNode<RawPtrT> microtask_queue);
 
   TNode<Context> GetCurrentContext();
@@ -115,13 +129,56 @@ void MicrotaskQueueBuiltinsAssembler::PrepareForContext(
   SetCurrentContext(native_context);
 }
 
+void MicrotaskQueueBuiltinsAssembler::PrepareForBatchedContext(
+    TNode<NativeContext> native_context, TNode<Context> current_context,
+    TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batched_context, Label* bailout) {
+  Label if_enter(this), if_shutdown(this, Label::kDeferred), done(this);
+  GotoIfNot(TaggedEqual(var_batched_context->value(), native_context),
+            &if_enter);
+
+  // The context is still entered from the previous reaction job, but that job
+  // may have shut it down.
+  GotoIf(WordEqual(GetMicrotaskQueue(native_context), IntPtrConstant(0)),
+         &if_shutdown);
+  SetCurrentContext(native_context);
+  Goto(&done);
+
+  BIND(&if_shutdown);
+  LeaveBatchedContext(current_context, saved_entered_context_count,
+                      var_batched_context);
+  Goto(bailout);
+
+  BIND(&if_enter);
+  LeaveBatchedContext(current_context, saved_entered_context_count,
+                      var_batched_context);
+  PrepareForContext(native_context, bailout);
+  *var_batched_context = native_context;
+  Goto(&done);
+
+  BIND(&done);
+}
+
+void MicrotaskQueueBuiltinsAssembler::LeaveBatchedContext(
+    TNode<Context> current_context, TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batched_context) {
+  Label done(this);
+  GotoIf(TaggedEqual(var_batched_context->value(), SmiConstant(0)), &done);
+  RewindEnteredContext(saved_entered_context_count);
+  SetCurrentContext(current_context);
+  *var_batched_context = SmiConstant(0);
+  Goto(&done);
+  BIND(&done);
+}
+
 void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
-    TNode<Context> current_context, TNode<Microtask> microtask) {
+    TNode<Context> current_context, TNode<Microtask> microtask,
+    TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batched_context) {
   CSA_DCHECK(this, TaggedIsNotSmi(microtask));
   CSA_DCHECK(this, Word32BinaryNot(IsExecutionTerminating()));
 
   StoreRoot(RootIndex::kCurrentMicrotask, microtask);
-  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
   TNode<Map> microtask_map = LoadMap(microtask);
   TNode<Uint16T> microtask_type = LoadMapInstanceType(microtask_map);
 
@@ -146,6 +203,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
 
   BIND(&is_callable);
   {
+    LeaveBatchedContext(current_context, saved_entered_context_count,
+                        var_batched_context);
+
     // Enter the context of the {microtask}.
     TNode<Context> microtask_context =
         LoadObjectField<Context>(microtask, CallableTask::kContextOffset);
@@ -165,6 +225,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
 
   BIND(&is_callback);
   {
+    LeaveBatchedContext(current_context, saved_entered_context_count,
+                        var_batched_context);
+
     const TNode<Object> microtask_callback =
         LoadObjectField(microtask, CallbackTask::kCallbackOffset);
     const TNode<Object> microtask_data =
@@ -190,6 +253,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
 
   BIND(&is_promise_resolve_thenable_job);
   {
+    LeaveBatchedContext(current_context, saved_entered_context_count,
+                        var_batched_context);
+
     // Enter the context of the {microtask}.
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseResolveThenableJobTask::kContextOffset);
@@ -226,7 +292,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseReactionJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForBatchedContext(native_context, current_context,
+                             saved_entered_context_count, var_batched_context,
+                             &done);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
@@ -268,8 +336,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     Goto(&preserved_data_reset_done);
     BIND(&preserved_data_reset_done);
 
-    RewindEnteredContext(saved_entered_context_count);
-    SetCurrentContext(current_context);
+    // Leave the context entered for the next reaction job.
     Goto(&done);
   }
 
@@ -279,7 +346,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseReactionJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForBatchedContext(native_context, current_context,
+                             saved_entered_context_count, var_batched_context,
+                             &done);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
@@ -321,8 +390,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     Goto(&preserved_data_reset_done);
     BIND(&preserved_data_reset_done);
 
-    RewindEnteredContext(saved_entered_context_count);
-    SetCurrentContext(current_context);
+    // Leave the context entered for the next reaction job.
     Goto(&done);
   }
 
@@ -336,6 +404,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
                 var_exception.value());
     RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
+    *var_batched_context = SmiConstant(0);
     Goto(&done);
   }
 
@@ -594,7 +663,11 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   auto microtask_queue =
       UncheckedParameter<RawPtrT>(Descriptor::kMicrotaskQueue);
 
-  Label loop(this), done(this);
+  // Every microtask restores the entered contexts to this count.
+  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
+  TVARIABLE(Object, var_batched_context, SmiConstant(0));
+
+  Label loop(this, &var_batched_context), done(this);
   Goto(&loop);
   BIND(&loop);
 
@@ -621,12 +694,16 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   SetMicrotaskQueueSize(microtask_queue, new_size);
   SetMicrotaskQueueStart(microtask_queue, new_start);
 
-  RunSingleMicrotask(current_context, microtask);
+  RunSingleMicrotask(current_context, microtask, saved_entered_context_count,
+                     &var_batched_context);
   IncrementFinishedMicrotaskCount(microtask_queue);
   Goto(&loop);
 
   BIND(&done);
   {
+    LeaveBatchedContext(current_context, saved_entered_context_count,
+                        &var_batched_context);
+
     // Reset the "current microtask" on the isolate.
     StoreRoot(RootIndex::kCurrentMicrotask, UndefinedConstant());
     Return(UndefinedConstant());
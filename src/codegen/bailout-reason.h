@@ -117,6 +117,7 @@ namespace internal {
   V(kOptimizationDisabled, "Optimization disabled")                          \
   V(kHigherTierAvailable, "A higher tier is already available")              \
   V(kDetachedNativeContext, "The native context is detached")                \
+  V(kDeoptimizedTooManyTimes, "Deoptimized too many times")                  \
   V(kNeverOptimize, "Optimization is always disabled")
 
 #define ERROR_MESSAGES_CONSTANTS(C, T) C,
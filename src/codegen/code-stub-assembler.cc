@@ -10765,8 +10765,12 @@ TNode<Object> CodeStubAssembler::GetInterestingProperty(
       TNode<Object> properties =
           LoadObjectField(holder, JSObject::kPropertiesOrHashOffset);
       CSA_DCHECK(this, TaggedIsNotSmi(properties));
-      // TODO(pthier): Support swiss dictionaries.
-      if constexpr (!V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+      if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+        // Swiss dictionaries don't track interesting properties, so we have
+        // to look the property up.
+        CSA_DCHECK(this, IsSwissNameDictionary(CAST(properties)));
+        Goto(&lookup);
+      } else {
         CSA_DCHECK(this, IsNameDictionary(CAST(properties)));
         TNode<Smi> flags =
             GetNameDictionaryFlags<NameDictionary>(CAST(properties));
@@ -10775,8 +10779,8 @@ TNode<Object> CodeStubAssembler::GetInterestingProperty(
                &lookup);
         *var_holder = LoadMapPrototype(holder_map);
         *var_holder_map = LoadMap((*var_holder).value());
+        Goto(&loop);
       }
-      Goto(&loop);
     }
   }
 
@@ -19,6 +19,7 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/codegen/pending-optimization-table.h"
+#include "src/codegen/script-code-cache.h"
 #include "src/codegen/script-details.h"
 #include "src/codegen/unoptimized-compilation-info.h"
 #include "src/common/assert-scope.h"
@@ -26,6 +27,7 @@
 #include "src/common/message-template.h"
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
+#include "src/compiler/js-inlining-profile.h"
 #include "src/compiler/turbofan.h"
 #include "src/debug/debug.h"
 #include "src/debug/liveedit.h"
@@ -1447,6 +1449,9 @@ void FinalizeUnoptimizedCompilation(
     if (need_source_positions) {
       SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate, shared_info);
     }
+    if (V8_UNLIKELY(v8_flags.turbo_inlining_profile_from_file)) {
+      compiler::JSInliningProfile::ApplyTo(shared_info);
+    }
     LogEventListener::CodeTag log_tag;
     if (shared_info->is_toplevel()) {
       log_tag = flags.is_eval() ? LogEventListener::CodeTag::kEval
@@ -2540,6 +2545,13 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   AggregatedHistogramTimerScope timer(isolate->counters()->compile_lazy());
 
+  if (shared_info->bytecode_was_flushed()) {
+    // The flushed bytecode turned out to be needed again; let the heap take
+    // that into account when picking the flushing threshold.
+    shared_info->set_bytecode_was_flushed(false);
+    isolate->heap()->tracer()->NotifyBytecodeRecompiled();
+  }
+
   Handle<Script> script(Script::cast(shared_info->script()), isolate);
 
   // Set up parse info.
@@ -3601,6 +3613,32 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     }
   }
 
+  // Then check the code that other isolates in this process cached for the
+  // same source.
+  const bool use_shared_code_cache =
+      use_compilation_cache &&
+      compile_options == ScriptCompiler::kNoCompileOptions &&
+      natives == NOT_NATIVES_CODE && ScriptCodeCache::IsEnabled();
+  if (use_shared_code_cache && maybe_result.is_null()) {
+    NestedTimedHistogramScope timer(isolate->counters()->compile_deserialize());
+    RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileDeserialize);
+    Handle<SharedFunctionInfo> result;
+    if (ScriptCodeCache::Lookup(isolate, source, script_details.origin_options,
+                                maybe_script)
+            .ToHandle(&result)) {
+      is_compiled_scope = result->is_compiled_scope(isolate);
+      if (is_compiled_scope.is_compiled()) {
+        {
+          DisallowGarbageCollection no_gc;
+          SetScriptFieldsFromDetails(isolate, Script::cast(result->script()),
+                                     script_details, &no_gc);
+        }
+        compilation_cache->PutScript(source, language_mode, result);
+        maybe_result = result;
+      }
+    }
+  }
+
   if (maybe_result.is_null()) {
     // No cache entry found compile the script.
     if (v8_flags.stress_background_compile &&
@@ -3636,6 +3674,10 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (use_shared_code_cache) {
+        ScriptCodeCache::Insert(isolate, source, script_details.origin_options,
+                                result);
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -22,6 +22,7 @@ enum CpuFeature {
   AVX,
   AVX2,
   FMA3,
+  AVX512,  // AVX-512 F, DQ, BW and VL.
   BMI1,
   BMI2,
   LZCNT,
@@ -58,18 +58,8 @@ const char* const
         // Isolate addresses:
         FOR_EACH_ISOLATE_ADDRESS_NAME(ADD_ISOLATE_ADDR)
         // Stub cache:
-        "Load StubCache::primary_->key",
-        "Load StubCache::primary_->value",
-        "Load StubCache::primary_->map",
-        "Load StubCache::secondary_->key",
-        "Load StubCache::secondary_->value",
-        "Load StubCache::secondary_->map",
-        "Store StubCache::primary_->key",
-        "Store StubCache::primary_->value",
-        "Store StubCache::primary_->map",
-        "Store StubCache::secondary_->key",
-        "Store StubCache::secondary_->value",
-        "Store StubCache::secondary_->map",
+        "Load StubCache::tables_",
+        "Store StubCache::tables_",
         // Native code counters:
         STATS_COUNTER_NATIVE_CODE_LIST(ADD_STATS_COUNTER_NAME)
 };
@@ -279,26 +269,9 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
                kIsolateAddressReferenceCount,
            *index);
 
-  StubCache* load_stub_cache = isolate->load_stub_cache();
-
-  // Stub cache tables
-  Add(load_stub_cache->key_reference(StubCache::kPrimary).address(), index);
-  Add(load_stub_cache->value_reference(StubCache::kPrimary).address(), index);
-  Add(load_stub_cache->map_reference(StubCache::kPrimary).address(), index);
-  Add(load_stub_cache->key_reference(StubCache::kSecondary).address(), index);
-  Add(load_stub_cache->value_reference(StubCache::kSecondary).address(), index);
-  Add(load_stub_cache->map_reference(StubCache::kSecondary).address(), index);
-
-  StubCache* store_stub_cache = isolate->store_stub_cache();
-
   // Stub cache tables
-  Add(store_stub_cache->key_reference(StubCache::kPrimary).address(), index);
-  Add(store_stub_cache->value_reference(StubCache::kPrimary).address(), index);
-  Add(store_stub_cache->map_reference(StubCache::kPrimary).address(), index);
-  Add(store_stub_cache->key_reference(StubCache::kSecondary).address(), index);
-  Add(store_stub_cache->value_reference(StubCache::kSecondary).address(),
-      index);
-  Add(store_stub_cache->map_reference(StubCache::kSecondary).address(), index);
+  Add(isolate->load_stub_cache()->tables_reference().address(), index);
+  Add(isolate->store_stub_cache()->tables_reference().address(), index);
 
   CHECK_EQ(kSizeIsolateIndependent + kExternalReferenceCountIsolateDependent +
                kIsolateAddressReferenceCount + kStubCacheReferenceCount,
@@ -513,6 +513,8 @@ IF_WASM(FUNCTION_REFERENCE, wasm_float64_pow, wasm::float64_pow_wrapper)
 IF_WASM(FUNCTION_REFERENCE, wasm_call_trap_callback_for_testing,
         wasm::call_trap_callback_for_testing)
 IF_WASM(FUNCTION_REFERENCE, wasm_array_copy, wasm::array_copy_wrapper)
+IF_WASM(FUNCTION_REFERENCE, wasm_array_copy_from_buffer,
+        wasm::array_copy_from_buffer_wrapper)
 IF_WASM(FUNCTION_REFERENCE, wasm_array_fill, wasm::array_fill_wrapper)
 IF_WASM(FUNCTION_REFERENCE_WITH_TYPE, wasm_string_to_f64,
         wasm::flat_string_to_f64, BUILTIN_FP_POINTER_CALL)
@@ -899,6 +901,8 @@ FUNCTION_REFERENCE(re_case_insensitive_compare_non_unicode,
 FUNCTION_REFERENCE(re_is_character_in_range_array,
                    RegExpMacroAssembler::IsCharacterInRangeArray)
 
+FUNCTION_REFERENCE(re_find_character, RegExpMacroAssembler::FindCharacter)
+
 ExternalReference ExternalReference::re_word_character_map() {
   return ExternalReference(
       NativeRegExpMacroAssembler::word_character_map_address());
@@ -309,6 +309,7 @@ class StatsCounter;
   IF_WASM(V, wasm_memory_copy, "wasm::memory_copy")                            \
   IF_WASM(V, wasm_memory_fill, "wasm::memory_fill")                            \
   IF_WASM(V, wasm_array_copy, "wasm::array_copy")                              \
+  IF_WASM(V, wasm_array_copy_from_buffer, "wasm::array_copy_from_buffer")      \
   IF_WASM(V, wasm_array_fill, "wasm::array_fill")                              \
   IF_WASM(V, wasm_string_to_f64, "wasm_string_to_f64")                         \
   V(address_of_wasm_i8x16_swizzle_mask, "wasm_i8x16_swizzle_mask")             \
@@ -371,6 +372,7 @@ class StatsCounter;
     "RegExpMacroAssembler::CaseInsensitiveCompareNonUnicode()")                \
   V(re_is_character_in_range_array,                                            \
     "RegExpMacroAssembler::IsCharacterInRangeArray()")                         \
+  V(re_find_character, "RegExpMacroAssembler::FindCharacter()")                \
   V(re_check_stack_guard_state,                                                \
     "RegExpMacroAssembler*::CheckStackGuardState()")                           \
   V(re_grow_stack, "NativeRegExpMacroAssembler::GrowStack()")                  \
@@ -0,0 +1,111 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/script-code-cache.h"
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/common/globals.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/handles/handles-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/snapshot/code-serializer.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Shorter scripts compile about as fast as they deserialize.
+constexpr int kMinSourceLength = 1024;
+
+}  // namespace
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ScriptCodeCache, ScriptCodeCache::Get)
+
+size_t ScriptCodeCache::KeyHash::operator()(const Key& key) const {
+  return base::hash_combine(
+      base::hash_range(key.source.begin(), key.source.end()), key.is_one_byte,
+      key.origin_options);
+}
+
+// static
+bool ScriptCodeCache::IsEnabled() {
+  return v8_flags.script_shared_code_cache_size > 0;
+}
+
+// static
+bool ScriptCodeCache::MakeKey(Isolate* isolate, Handle<String> source,
+                              ScriptOriginOptions origin_options, Key* key) {
+  if (source->length() < kMinSourceLength) return false;
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  DCHECK(content.IsFlat());
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    key->source.assign(chars.begin(), chars.end());
+    key->is_one_byte = true;
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(chars.begin());
+    key->source.assign(bytes, bytes + chars.length() * sizeof(base::uc16));
+    key->is_one_byte = false;
+  }
+  key->origin_options = origin_options.Flags();
+  return true;
+}
+
+// static
+MaybeHandle<SharedFunctionInfo> ScriptCodeCache::Lookup(
+    Isolate* isolate, Handle<String> source,
+    ScriptOriginOptions origin_options, MaybeHandle<Script> maybe_script) {
+  DCHECK(IsEnabled());
+  Key key;
+  if (!MakeKey(isolate, source, origin_options, &key)) return {};
+  std::shared_ptr<const std::vector<uint8_t>> data;
+  {
+    ScriptCodeCache* cache = Get();
+    base::MutexGuard guard(&cache->mutex_);
+    auto it = cache->entries_.find(key);
+    if (it == cache->entries_.end()) return {};
+    data = it->second;
+  }
+  AlignedCachedData cached_data(data->data(), static_cast<int>(data->size()));
+  return CodeSerializer::Deserialize(isolate, &cached_data, source,
+                                     origin_options, maybe_script);
+}
+
+// static
+void ScriptCodeCache::Insert(Isolate* isolate, Handle<String> source,
+                             ScriptOriginOptions origin_options,
+                             Handle<SharedFunctionInfo> toplevel_sfi) {
+  DCHECK(IsEnabled());
+  Key key;
+  if (!MakeKey(isolate, source, origin_options, &key)) return;
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      CodeSerializer::Serialize(isolate, toplevel_sfi));
+  if (!cached_data) return;
+
+  const size_t max_size = v8_flags.script_shared_code_cache_size * KB;
+  const size_t size = key.source.size() + cached_data->length;
+  if (size > max_size) return;
+  auto data = std::make_shared<const std::vector<uint8_t>>(
+      cached_data->data, cached_data->data + cached_data->length);
+
+  ScriptCodeCache* cache = Get();
+  base::MutexGuard guard(&cache->mutex_);
+  if (cache->size_ + size > max_size) {
+    // Entries being deserialized stay alive through their shared_ptrs.
+    cache->entries_.clear();
+    cache->size_ = 0;
+  }
+  if (cache->entries_.emplace(std::move(key), std::move(data)).second) {
+    cache->size_ += size;
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
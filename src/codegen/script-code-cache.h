@@ -0,0 +1,77 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_SCRIPT_CODE_CACHE_H_
+#define V8_CODEGEN_SCRIPT_CODE_CACHE_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-message.h"
+#include "src/base/platform/mutex.h"
+#include "src/handles/maybe-handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class Script;
+class SharedFunctionInfo;
+class String;
+
+// A process-wide cache of serialized top-level script code, shared by all
+// isolates.  An isolate that compiles a script stores a code cache for it
+// here, and other isolates that compile the same source with the same origin
+// options deserialize it instead of parsing and compiling the script again.
+// Entries hold the same data as v8::ScriptCompiler::CachedData, so they
+// carry the bytecode of the functions compiled eagerly with the script.
+//
+// The total size of the cached data is bounded by
+// --script-shared-code-cache-size; the cache is cleared when it is full.
+class ScriptCodeCache final {
+ public:
+  static bool IsEnabled();
+
+  // Returns an empty handle if there is no usable entry for `source`.
+  static MaybeHandle<SharedFunctionInfo> Lookup(
+      Isolate* isolate, Handle<String> source,
+      ScriptOriginOptions origin_options, MaybeHandle<Script> maybe_script);
+  static void Insert(Isolate* isolate, Handle<String> source,
+                     ScriptOriginOptions origin_options,
+                     Handle<SharedFunctionInfo> toplevel_sfi);
+
+ private:
+  struct Key {
+    // The raw characters of the source.
+    std::vector<uint8_t> source;
+    bool is_one_byte;
+    int origin_options;
+
+    bool operator==(const Key& other) const {
+      return source == other.source && is_one_byte == other.is_one_byte &&
+             origin_options == other.origin_options;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  // Returns false for sources too short to be worth caching.
+  static bool MakeKey(Isolate* isolate, Handle<String> source,
+                      ScriptOriginOptions origin_options, Key* key);
+
+  base::Mutex mutex_;
+  std::unordered_map<Key, std::shared_ptr<const std::vector<uint8_t>>, KeyHash>
+      entries_;
+  size_t size_ = 0;
+
+  static ScriptCodeCache* Get();
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_SCRIPT_CODE_CACHE_H_
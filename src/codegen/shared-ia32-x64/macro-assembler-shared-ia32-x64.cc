@@ -394,10 +394,17 @@ void SharedMacroAssemblerBase::I8x16SplatPreAvx2(XMMRegister dst, Op src,
                                                  XMMRegister scratch) {
   ASM_CODE_COMMENT(this);
   DCHECK(!CpuFeatures::IsSupported(AVX2));
-  CpuFeatureScope ssse3_scope(this, SSSE3);
   Movd(dst, src);
-  Xorps(scratch, scratch);
-  Pshufb(dst, scratch);
+  if (CpuFeatures::IsSupported(SSSE3)) {
+    CpuFeatureScope ssse3_scope(this, SSSE3);
+    Xorps(scratch, scratch);
+    Pshufb(dst, scratch);
+  } else {
+    // Builtins in the snapshot may only rely on SSE2.
+    Punpcklbw(dst, dst);
+    Pshuflw(dst, dst, uint8_t{0x0});
+    Punpcklqdq(dst, dst);
+  }
 }
 
 void SharedMacroAssemblerBase::I8x16Splat(XMMRegister dst, Register src,
@@ -72,6 +72,13 @@ bool OSHasAVXSupport() {
   return (feature_mask & 0x6) == 0x6;
 }
 
+// Check whether OS saves the opmask and upper ZMM registers, in addition to
+// the state needed for AVX.
+bool OSHasAVX512Support() {
+  uint64_t feature_mask = xgetbv(0);  // XCR_XFEATURE_ENABLED_MASK
+  return (feature_mask & 0xE6) == 0xE6;
+}
+
 #endif  // V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64
 
 }  // namespace
@@ -101,6 +108,10 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
     SetSupported(AVX);
     if (cpu.has_avx2()) SetSupported(AVX2);
     if (cpu.has_fma3()) SetSupported(FMA3);
+    if (cpu.has_avx512f() && cpu.has_avx512dq() && cpu.has_avx512bw() &&
+        cpu.has_avx512vl() && OSHasAVX512Support()) {
+      SetSupported(AVX512);
+    }
   }
 
   // SAHF is not generally available in long mode.
@@ -126,6 +137,7 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
   if (!v8_flags.enable_avx || !IsSupported(SSE4_2)) SetUnsupported(AVX);
   if (!v8_flags.enable_avx2 || !IsSupported(AVX)) SetUnsupported(AVX2);
   if (!v8_flags.enable_fma3 || !IsSupported(AVX)) SetUnsupported(FMA3);
+  if (!v8_flags.enable_avx512 || !IsSupported(AVX2)) SetUnsupported(AVX512);
 
   // Set a static value on whether Simd is supported.
   // This variable is only used for certain archs to query SupportWasmSimd128()
@@ -143,6 +155,7 @@ void CpuFeatures::PrintTarget() {}
 void CpuFeatures::PrintFeatures() {
   printf(
       "SSE3=%d SSSE3=%d SSE4_1=%d SSE4_2=%d SAHF=%d AVX=%d AVX2=%d FMA3=%d "
+      "AVX512=%d "
       "BMI1=%d "
       "BMI2=%d "
       "LZCNT=%d "
@@ -151,7 +164,8 @@ void CpuFeatures::PrintFeatures() {
       CpuFeatures::IsSupported(SSE4_1), CpuFeatures::IsSupported(SSE4_2),
       CpuFeatures::IsSupported(SAHF), CpuFeatures::IsSupported(AVX),
       CpuFeatures::IsSupported(AVX2), CpuFeatures::IsSupported(FMA3),
-      CpuFeatures::IsSupported(BMI1), CpuFeatures::IsSupported(BMI2),
+      CpuFeatures::IsSupported(AVX512), CpuFeatures::IsSupported(BMI1),
+      CpuFeatures::IsSupported(BMI2),
       CpuFeatures::IsSupported(LZCNT), CpuFeatures::IsSupported(POPCNT),
       CpuFeatures::IsSupported(INTEL_ATOM));
 }
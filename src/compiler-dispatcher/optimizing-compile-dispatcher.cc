@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -15,7 +17,8 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
-#include "src/objects/js-function.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
 
@@ -87,13 +90,34 @@ TurbofanCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return nullptr;
-  TurbofanCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  // The queue is short, so a linear scan for the hottest job is cheap enough.
+  int hottest = 0;
+  for (int i = 1; i < input_queue_length_; i++) {
+    if (input_queue_[InputQueueIndex(i)].priority >
+        input_queue_[InputQueueIndex(hottest)].priority) {
+      hottest = i;
+    }
+  }
+  TurbofanCompilationJob* job = input_queue_[InputQueueIndex(hottest)].job;
   DCHECK_NOT_NULL(job);
+  // Close the gap by moving the jobs queued before it one slot back, which
+  // keeps the remaining jobs in queueing order.
+  for (int i = hottest; i > 0; i--) {
+    input_queue_[InputQueueIndex(i)] = input_queue_[InputQueueIndex(i - 1)];
+  }
   input_queue_shift_ = InputQueueIndex(1);
   input_queue_length_--;
   return job;
 }
 
+int OptimizingCompileDispatcher::JobPriority(TurbofanCompilationJob* job) {
+  OptimizedCompilationInfo* info = job->compilation_info();
+  if (info->is_osr()) return kMaxInt;
+  JSFunction function = *info->closure();
+  if (!function.has_feedback_vector()) return 0;
+  return function.feedback_vector().invocation_count(kRelaxedLoad);
+}
+
 void OptimizingCompileDispatcher::CompileNext(TurbofanCompilationJob* job,
                                               LocalIsolate* local_isolate) {
   if (!job) return;
@@ -133,7 +157,7 @@ void OptimizingCompileDispatcher::FlushInputQueue() {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   while (input_queue_length_ > 0) {
     std::unique_ptr<TurbofanCompilationJob> job(
-        input_queue_[InputQueueIndex(0)]);
+        input_queue_[InputQueueIndex(0)].job);
     DCHECK_NOT_NULL(job);
     input_queue_shift_ = InputQueueIndex(1);
     input_queue_length_--;
@@ -220,11 +244,12 @@ bool OptimizingCompileDispatcher::HasJobs() {
 void OptimizingCompileDispatcher::QueueForOptimization(
     TurbofanCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  int priority = JobPriority(job);
   {
     // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    input_queue_[InputQueueIndex(input_queue_length_)] = {job, priority};
     input_queue_length_++;
   }
   job_handle_->NotifyConcurrencyIncrease();
@@ -236,7 +261,15 @@ OptimizingCompileDispatcher::OptimizingCompileDispatcher(Isolate* isolate)
       input_queue_length_(0),
       input_queue_shift_(0),
       recompilation_delay_(v8_flags.concurrent_recompilation_delay) {
-  input_queue_ = NewArray<TurbofanCompilationJob*>(input_queue_capacity_);
+  if (v8_flags.concurrent_recompilation) {
+    // Make sure every worker thread can have a job in flight while more are
+    // waiting, since the concurrency of CompileTask scales with the queue
+    // length.
+    input_queue_capacity_ =
+        std::max(input_queue_capacity_,
+                 2 * V8::GetCurrentPlatform()->NumberOfWorkerThreads());
+  }
+  input_queue_ = NewArray<InputQueueEntry>(input_queue_capacity_);
   if (v8_flags.concurrent_recompilation) {
     job_handle_ = V8::GetCurrentPlatform()->PostJob(
         kTaskPriority, std::make_unique<CompileTask>(isolate, this));
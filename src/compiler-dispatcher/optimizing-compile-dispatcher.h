@@ -71,7 +71,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void FlushInputQueue();
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(TurbofanCompilationJob* job, LocalIsolate* local_isolate);
+  // Removes and returns the hottest queued job, see JobPriority.
   TurbofanCompilationJob* NextInput(LocalIsolate* local_isolate);
+  // Returns the hotness of |job| at the time it is queued. OSR jobs come
+  // first since the function is stuck in a long-running loop, all others are
+  // ordered by the invocation count of their feedback vector.
+  int JobPriority(TurbofanCompilationJob* job);
 
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
@@ -82,8 +87,14 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  TurbofanCompilationJob** input_queue_;
+  struct InputQueueEntry {
+    TurbofanCompilationJob* job;
+    int priority;
+  };
+
+  // Circular queue of incoming recompilation tasks (including OSR). Jobs are
+  // taken out by priority, and in queueing order among equal priorities.
+  InputQueueEntry* input_queue_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
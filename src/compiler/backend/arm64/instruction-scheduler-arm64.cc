@@ -373,8 +373,10 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for arm64 instructions. They have been determined
-  // in an empirical way.
+  // Latencies are taken from the software optimization guides of Neoverse
+  // N1 and V1, which also match Cortex-A76 and later closely. Where the
+  // latency depends on the operands (e.g. for divisions) the worst case is
+  // used. Loads assume an L1 hit.
   switch (instr->arch_opcode()) {
     case kArm64Add:
     case kArm64Add32:
@@ -400,8 +402,9 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Sub32:
     case kArm64Tst:
     case kArm64Tst32:
+      // Shifted and extended register operands take an extra cycle.
       if (instr->addressing_mode() != kMode_None) {
-        return 3;
+        return 2;
       } else {
         return 1;
       }
@@ -429,18 +432,25 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Ror32:
       return 1;
 
-    case kArm64LdrDecompressTaggedSigned:
-    case kArm64LdrDecompressTagged:
     case kArm64Ldr:
-    case kArm64LdrD:
-    case kArm64LdrS:
     case kArm64LdrW:
     case kArm64Ldrb:
     case kArm64Ldrh:
     case kArm64Ldrsb:
+    case kArm64LdrsbW:
     case kArm64Ldrsh:
+    case kArm64LdrshW:
     case kArm64Ldrsw:
-      return 11;
+      return 4;
+
+    case kArm64LdrDecompressTaggedSigned:
+    case kArm64LdrDecompressTagged:
+    case kArm64LdrD:
+    case kArm64LdrS:
+    case kArm64LdrQ:
+      // Loads into FP/SIMD registers, and tagged loads which add the cage
+      // base after loading.
+      return 5;
 
     case kArm64Str:
     case kArm64StrD:
@@ -454,13 +464,17 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Mneg32:
     case kArm64Msub32:
     case kArm64Mul32:
-      return 3;
-
     case kArm64Madd:
     case kArm64Mneg:
     case kArm64Msub:
     case kArm64Mul:
-      return 5;
+    case kArm64Smull:
+    case kArm64Umull:
+      return 2;
+
+    case kArm64Smulh:
+    case kArm64Umulh:
+      return 3;
 
     case kArm64Idiv32:
     case kArm64Udiv32:
@@ -474,23 +488,35 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float32Sub:
     case kArm64Float64Add:
     case kArm64Float64Sub:
-      return 5;
-
     case kArm64Float32Abs:
     case kArm64Float32Cmp:
     case kArm64Float32Neg:
+    case kArm64Float32Max:
+    case kArm64Float32Min:
     case kArm64Float64Abs:
     case kArm64Float64Cmp:
     case kArm64Float64Neg:
+    case kArm64Float64Max:
+    case kArm64Float64Min:
+      return 2;
+
+    case kArm64Float32Mul:
+    case kArm64Float32Fnmul:
+    case kArm64Float64Mul:
+    case kArm64Float64Fnmul:
       return 3;
 
     case kArm64Float32Div:
+      return 10;
+
     case kArm64Float32Sqrt:
-      return 12;
+      return 9;
 
     case kArm64Float64Div:
+      return 15;
+
     case kArm64Float64Sqrt:
-      return 19;
+      return 17;
 
     case kArm64Float32RoundDown:
     case kArm64Float32RoundTiesEven:
@@ -501,22 +527,26 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float64RoundTiesEven:
     case kArm64Float64RoundTruncate:
     case kArm64Float64RoundUp:
-      return 5;
-
     case kArm64Float32ToFloat64:
     case kArm64Float64ToFloat32:
+      return 3;
+
     case kArm64Float64ToInt32:
     case kArm64Float64ToUint32:
     case kArm64Float32ToInt64:
     case kArm64Float64ToInt64:
     case kArm64Float32ToUint64:
     case kArm64Float64ToUint64:
+      // Includes the transfer to a general purpose register.
+      return 4;
+
     case kArm64Int32ToFloat64:
     case kArm64Int64ToFloat32:
     case kArm64Int64ToFloat64:
     case kArm64Uint32ToFloat64:
     case kArm64Uint64ToFloat32:
     case kArm64Uint64ToFloat64:
+      // Includes the transfer from a general purpose register.
       return 5;
 
     default:
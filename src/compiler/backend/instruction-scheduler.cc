@@ -212,6 +212,11 @@ template <typename QueueType>
 void InstructionScheduler::Schedule() {
   QueueType ready_list(this);
 
+  const bool record_stats = v8_flags.turbo_instruction_scheduling_stats;
+  if (V8_UNLIKELY(record_stats)) {
+    estimated_cycles_in_order_ += EstimateInOrderCycles();
+  }
+
   // Compute total latencies so that we can schedule the critical path first.
   ComputeTotalLatencies();
 
@@ -224,11 +229,14 @@ void InstructionScheduler::Schedule() {
 
   // Go through the ready list and schedule the instructions.
   int cycle = 0;
+  int last_result_cycle = 0;
   while (!ready_list.IsEmpty()) {
     ScheduleGraphNode* candidate = ready_list.PopBestCandidate(cycle);
 
     if (candidate != nullptr) {
       sequence()->AddInstruction(candidate->instruction());
+      last_result_cycle =
+          std::max(last_result_cycle, cycle + candidate->latency());
 
       for (ScheduleGraphNode* successor : candidate->successors()) {
         successor->DropUnscheduledPredecessor();
@@ -244,6 +252,10 @@ void InstructionScheduler::Schedule() {
     cycle++;
   }
 
+  if (V8_UNLIKELY(record_stats)) {
+    estimated_cycles_scheduled_ += last_result_cycle;
+  }
+
   // Reset own state.
   graph_.clear();
   operands_map_.clear();
@@ -253,6 +265,27 @@ void InstructionScheduler::Schedule() {
   last_side_effect_instr_ = nullptr;
 }
 
+int InstructionScheduler::EstimateInOrderCycles() {
+  // Nodes are in program order, and all successors of a node come after the
+  // node itself. Reuse the start cycles to track when operands become ready
+  // and reset them afterwards for the actual scheduling.
+  int cycle = 0;
+  int last_result_cycle = 0;
+  for (ScheduleGraphNode* node : graph_) {
+    cycle = std::max(cycle, node->start_cycle());
+    last_result_cycle = std::max(last_result_cycle, cycle + node->latency());
+    for (ScheduleGraphNode* successor : node->successors()) {
+      successor->set_start_cycle(
+          std::max(successor->start_cycle(), cycle + node->latency()));
+    }
+    cycle++;
+  }
+  for (ScheduleGraphNode* node : graph_) {
+    node->set_start_cycle(-1);
+  }
+  return last_result_cycle;
+}
+
 int InstructionScheduler::GetInstructionFlags(const Instruction* instr) const {
   switch (instr->arch_opcode()) {
     case kArchNop:
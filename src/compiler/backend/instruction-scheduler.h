@@ -44,6 +44,17 @@ class InstructionScheduler final : public ZoneObject {
 
   static bool SchedulerSupported();
 
+  // Estimated number of cycles needed to issue all blocks scheduled so far,
+  // in their original order and in the scheduled order respectively. Both
+  // use the latency model of the scheduler and are only tracked with
+  // --turbo-instruction-scheduling-stats.
+  int64_t estimated_cycles_in_order() const {
+    return estimated_cycles_in_order_;
+  }
+  int64_t estimated_cycles_scheduled() const {
+    return estimated_cycles_scheduled_;
+  }
+
  private:
   // A scheduling graph node.
   // Represent an instruction and their dependencies.
@@ -206,6 +217,10 @@ class InstructionScheduler final : public ZoneObject {
 
   void ComputeTotalLatencies();
 
+  // Estimate the cycles needed to issue the current block without
+  // reordering it, stalling each instruction until its operands are ready.
+  int EstimateInOrderCycles();
+
   static int GetInstructionLatency(const Instruction* instr);
 
   Zone* zone() { return zone_; }
@@ -244,6 +259,9 @@ class InstructionScheduler final : public ZoneObject {
   ZoneMap<int32_t, ScheduleGraphNode*> operands_map_;
 
   base::Optional<base::RandomNumberGenerator> random_number_generator_;
+
+  int64_t estimated_cycles_in_order_ = 0;
+  int64_t estimated_cycles_scheduled_ = 0;
 };
 
 }  // namespace compiler
@@ -22,6 +22,7 @@
 #include "src/compiler/turboshaft/operations.h"
 #include "src/compiler/turboshaft/representations.h"
 #include "src/numbers/conversions-inl.h"
+#include "src/utils/ostreams.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/wasm/simd-shuffle.h"
@@ -161,6 +162,14 @@ InstructionSelectorT<Adapter>::SelectInstructions() {
     }
     EndBlock(this->rpo_number(block));
   }
+  if (UseInstructionScheduling() &&
+      V8_UNLIKELY(v8_flags.turbo_instruction_scheduling_stats)) {
+    StdoutStream{} << "[instruction scheduling: "
+                   << scheduler_->estimated_cycles_in_order()
+                   << " cycles in order, "
+                   << scheduler_->estimated_cycles_scheduled()
+                   << " cycles scheduled]" << std::endl;
+  }
 #if DEBUG
   sequence()->ValidateSSA();
 #endif
@@ -0,0 +1,45 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/builtin-effects.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+base::Optional<BuiltinEffects> TryGetBuiltinEffects(Builtin builtin) {
+  switch (builtin) {
+    // The allocation stubs only initialize the object they return (but can
+    // trigger a GC, which is not observable for load elimination).
+    case Builtin::kAllocateInYoungGeneration:
+    case Builtin::kAllocateRegularInYoungGeneration:
+    case Builtin::kAllocateInOldGeneration:
+    case Builtin::kAllocateRegularInOldGeneration:
+      return BuiltinEffects{false, false, true};
+
+    // Predicates that inspect their argument without converting it.
+    case Builtin::kNumberIsFinite:
+    case Builtin::kNumberIsInteger:
+    case Builtin::kNumberIsNaN:
+    case Builtin::kNumberIsSafeInteger:
+      return BuiltinEffects{true, false, false};
+
+    // Builtins that read their receiver or argument and throw a TypeError
+    // (which allocates) if it is incompatible, e.g. a revoked proxy.
+    case Builtin::kArrayIsArray:
+    case Builtin::kMapPrototypeGetSize:
+    case Builtin::kSetPrototypeGetSize:
+    case Builtin::kTypedArrayPrototypeByteLength:
+    case Builtin::kTypedArrayPrototypeByteOffset:
+    case Builtin::kTypedArrayPrototypeLength:
+      return BuiltinEffects{true, false, true};
+
+    default:
+      return base::nullopt;
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,39 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_BUILTIN_EFFECTS_H_
+#define V8_COMPILER_BUILTIN_EFFECTS_H_
+
+#include "src/base/optional.h"
+#include "src/builtins/builtins.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// A summary of what a call to a builtin can do to the heap, used by the load
+// elimination passes of TurboFan and Turboshaft to avoid invalidating all
+// their state at such calls.
+//
+// {writes_heap} refers to objects that existed before the call; a builtin that
+// only initializes objects it allocates itself does not write the heap. A
+// summary is only given for builtins that never call back into JavaScript and
+// never modify their inputs in place (which rules out anything that might
+// flatten a string, for instance).
+struct BuiltinEffects {
+  bool reads_heap;
+  bool writes_heap;
+  bool allocates;
+};
+
+// Returns the effects of calling {builtin}, or nullopt if the builtin has to
+// be treated like an arbitrary call.
+V8_EXPORT_PRIVATE base::Optional<BuiltinEffects> TryGetBuiltinEffects(
+    Builtin builtin);
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_BUILTIN_EFFECTS_H_
@@ -4,8 +4,11 @@
 
 #include "src/compiler/fast-api-calls.h"
 
+#include <algorithm>
+
 #include "src/codegen/cpu-features.h"
 #include "src/compiler/globals.h"
+#include "src/compiler/js-heap-broker.h"
 
 namespace v8 {
 namespace internal {
@@ -83,6 +86,59 @@ OverloadsResolutionResult ResolveOverloads(
   return OverloadsResolutionResult::Invalid();
 }
 
+// Given a FunctionTemplateInfo, checks whether the fast API call can be
+// optimized, applying the initial step of the overload resolution algorithm:
+// Given an overload set function_template_info.c_signatures, and a list of
+// arguments of size argc:
+// 1. Let max_arg be the length of the longest type list of the entries in
+//    function_template_info.c_signatures.
+// 2. Let argc be the size of the arguments list.
+// 3. Initialize arg_count = min(max_arg, argc).
+// 4. Remove from the set all entries whose type list is not of length
+//    arg_count.
+// Returns an array with the indexes of the remaining entries in S, which
+// represents the set of "optimizable" function overloads.
+FastApiCallFunctionVector CanOptimizeFastCall(
+    JSHeapBroker* broker, Zone* zone,
+    FunctionTemplateInfoRef function_template_info, size_t argc) {
+  FastApiCallFunctionVector result(zone);
+
+  static constexpr int kReceiver = 1;
+
+  ZoneVector<Address> functions = function_template_info.c_functions(broker);
+  ZoneVector<const CFunctionInfo*> signatures =
+      function_template_info.c_signatures(broker);
+  const size_t overloads_count = signatures.size();
+
+  // Calculates the length of the longest type list of the entries in
+  // function_template_info.
+  size_t max_arg = 0;
+  for (size_t i = 0; i < overloads_count; i++) {
+    const CFunctionInfo* c_signature = signatures[i];
+    // C arguments should include the receiver at index 0.
+    DCHECK_GE(c_signature->ArgumentCount(), kReceiver);
+    const size_t len = c_signature->ArgumentCount() - kReceiver;
+    if (len > max_arg) max_arg = len;
+  }
+  const size_t arg_count = std::min(max_arg, argc);
+
+  // Only considers entries whose type list length matches arg_count.
+  for (size_t i = 0; i < overloads_count; i++) {
+    const CFunctionInfo* c_signature = signatures[i];
+    const size_t len = c_signature->ArgumentCount() - kReceiver;
+    bool optimize_to_fast_call = (len == arg_count);
+
+    optimize_to_fast_call =
+        optimize_to_fast_call && CanOptimizeFastSignature(c_signature);
+
+    if (optimize_to_fast_call) {
+      result.push_back({functions[i], c_signature});
+    }
+  }
+
+  return result;
+}
+
 bool CanOptimizeFastSignature(const CFunctionInfo* c_signature) {
   USE(c_signature);
 
@@ -45,6 +45,14 @@ OverloadsResolutionResult ResolveOverloads(
 
 bool CanOptimizeFastSignature(const CFunctionInfo* c_signature);
 
+// Given a FunctionTemplateInfo, applies the initial step of the overload
+// resolution algorithm: only keeps the overloads whose number of arguments is
+// min(max_arg, argc), where max_arg is the largest number of arguments of
+// any overload. Returns the overloads among them that can be called fast.
+FastApiCallFunctionVector CanOptimizeFastCall(
+    JSHeapBroker* broker, Zone* zone,
+    FunctionTemplateInfoRef function_template_info, size_t argc);
+
 using GetParameter = std::function<Node*(int, OverloadsResolutionResult&,
                                          GraphAssemblerLabel<0>*)>;
 using ConvertReturnValue = std::function<Node*(const CFunctionInfo*, Node*)>;
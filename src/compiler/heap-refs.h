@@ -1034,6 +1034,7 @@ class ScopeInfoRef : public HeapObjectRef {
   V(bool, is_compiled)                                          \
   V(bool, IsUserJavaScript)                                     \
   V(bool, requires_instance_members_initializer)                \
+  V(bool, inlining_profile_hot)                                 \
   IF_WASM(V, const wasm::WasmModule*, wasm_module)              \
   IF_WASM(V, const wasm::FunctionSig*, wasm_function_signature) \
   IF_WASM(V, int, wasm_function_index)
@@ -222,6 +222,7 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     }
     if (candidate.can_inline_function[i]) {
       can_inline_candidate = true;
+      if (shared.inlining_profile_hot()) candidate.in_inlining_profile = true;
       BytecodeArrayRef bytecode = candidate.bytecode[i].value();
       candidate.total_size += bytecode.length();
       unsigned inlined_bytecode_size = 0;
@@ -248,8 +249,10 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
 
   // Don't consider a {candidate} whose frequency is below the
   // threshold, i.e. a call site that is only hit once every N
-  // invocations of the caller.
-  if (candidate.frequency.IsKnown() &&
+  // invocations of the caller. Functions that a previous run ended up
+  // inlining are exempt, since the feedback of a first optimization may
+  // not yet reflect how hot the call site gets.
+  if (!candidate.in_inlining_profile && candidate.frequency.IsKnown() &&
       candidate.frequency.value() < v8_flags.min_inlining_frequency) {
     return NoChange();
   }
@@ -789,6 +792,11 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
 
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
+  // Candidates from the inlining profile go first, so that they get the
+  // budget before the rest.
+  if (left.in_inlining_profile != right.in_inlining_profile) {
+    return left.in_inlining_profile;
+  }
   if (right.frequency.IsUnknown()) {
     if (left.frequency.IsUnknown()) {
       // If left and right are both unknown then the ordering is indeterminate,
@@ -814,6 +822,7 @@ void JSInliningHeuristic::PrintCandidates() {
   for (const Candidate& candidate : candidates_) {
     os << "- candidate: " << candidate.node->op()->mnemonic() << " node #"
        << candidate.node->id() << " with frequency " << candidate.frequency
+       << (candidate.in_inlining_profile ? " (in inlining profile)" : "")
        << ", " << candidate.num_functions << " target(s):" << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       SharedFunctionInfoRef shared =
@@ -71,6 +71,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
+    // Whether any target was inlined in a previous run, according to
+    // --turbo-inlining-profile-from-file.
+    bool in_inlining_profile = false;
   };
 
   // Comparator for candidates.
@@ -0,0 +1,101 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/js-inlining-profile.h"
+
+#include <fstream>
+#include <set>
+#include <unordered_set>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/optional.h"
+#include "src/base/platform/mutex.h"
+#include "src/codegen/optimized-compilation-info.h"
+#include "src/flags/flags.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+class ProfileData {
+ public:
+  ProfileData() {
+    if (!v8_flags.turbo_inlining_profile_from_file) return;
+    std::ifstream file(v8_flags.turbo_inlining_profile_from_file.value());
+    CHECK_WITH_MSG(file.good(), "Can't read inlining profile file.");
+    uint64_t key;
+    while (file >> std::hex >> key) loaded_.insert(key);
+  }
+
+  bool Contains(uint64_t key) const { return loaded_.count(key) != 0; }
+
+  void Record(uint64_t key) {
+    base::MutexGuard guard(&mutex_);
+    recorded_.insert(key);
+  }
+
+  void Dump(const char* filename) {
+    base::MutexGuard guard(&mutex_);
+    std::ofstream file(filename);
+    CHECK_WITH_MSG(file.good(), "Can't write inlining profile file.");
+    for (uint64_t key : recorded_) file << std::hex << key << "\n";
+  }
+
+ private:
+  // Written once at construction, read-only afterwards.
+  std::unordered_set<uint64_t> loaded_;
+  base::Mutex mutex_;
+  // Ordered, so that dumping the same feedback produces the same file.
+  std::set<uint64_t> recorded_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ProfileData, GetProfileData)
+
+// Returns a key identifying {shared} across runs, or nothing for functions
+// that don't come from a script with source.
+base::Optional<uint64_t> ProfileKey(SharedFunctionInfo shared) {
+  if (!shared.IsUserJavaScript()) return {};
+  Object script = shared.script();
+  if (!script.IsScript()) return {};
+  Object source = Script::cast(script).source();
+  if (!source.IsString()) return {};
+  uint32_t hash = String::cast(source).EnsureHash();
+  return (uint64_t{hash} << 32) | static_cast<uint32_t>(shared.StartPosition());
+}
+
+}  // namespace
+
+// static
+void JSInliningProfile::ApplyTo(Handle<SharedFunctionInfo> shared) {
+  DCHECK(v8_flags.turbo_inlining_profile_from_file);
+  base::Optional<uint64_t> key = ProfileKey(*shared);
+  if (key.has_value() && GetProfileData()->Contains(key.value())) {
+    shared->set_inlining_profile_hot(true);
+  }
+}
+
+// static
+void JSInliningProfile::RecordInlinedFunctions(
+    OptimizedCompilationInfo* info) {
+  DCHECK(v8_flags.turbo_inlining_profile_to_file);
+  for (const auto& inlined : info->inlined_functions()) {
+    base::Optional<uint64_t> key = ProfileKey(*inlined.shared_info);
+    if (key.has_value()) GetProfileData()->Record(key.value());
+  }
+}
+
+// static
+void JSInliningProfile::DumpToFile() {
+  DCHECK(v8_flags.turbo_inlining_profile_to_file);
+  GetProfileData()->Dump(v8_flags.turbo_inlining_profile_to_file.value());
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,46 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_JS_INLINING_PROFILE_H_
+#define V8_COMPILER_JS_INLINING_PROFILE_H_
+
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class OptimizedCompilationInfo;
+class SharedFunctionInfo;
+
+namespace compiler {
+
+// Cross-run feedback for the JSInliningHeuristic. With
+// --turbo-inlining-profile-to-file, the functions that TurboFan inlined are
+// recorded and written to a file when the isolate is torn down. A later run
+// with --turbo-inlining-profile-from-file marks the matching functions as
+// soon as their bytecode is finalized, so that the heuristic can prefer them
+// on the very first optimization instead of rediscovering them.
+//
+// Functions are identified by the hash of their script's source and their
+// start position, since neither script ids nor addresses are stable across
+// runs. A stale or colliding entry only affects inlining priorities, never
+// correctness.
+class JSInliningProfile final : public AllStatic {
+ public:
+  // Marks {shared} as a preferred inlining candidate if the loaded profile
+  // contains it.
+  static void ApplyTo(Handle<SharedFunctionInfo> shared);
+
+  // Records the functions inlined into the code of the finished job {info}.
+  static void RecordInlinedFunctions(OptimizedCompilationInfo* info);
+
+  // Writes all functions recorded so far in this process to the profile file.
+  static void DumpToFile();
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_JS_INLINING_PROFILE_H_
@@ -5,11 +5,14 @@
 #include "src/compiler/load-elimination.h"
 
 #include "src/compiler/access-builder.h"
+#include "src/compiler/builtin-effects.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/js-graph.h"
 #include "src/compiler/js-heap-broker.h"
+#include "src/compiler/node-matchers.h"
 #include "src/compiler/node-properties.h"
 #include "src/heap/factory.h"
+#include "src/objects/code-inl.h"
 #include "src/objects/objects-inl.h"
 
 namespace v8 {
@@ -1252,7 +1255,8 @@ Reduction LoadElimination::ReduceOtherNode(Node* node) {
       // the predecessor.
       if (state == nullptr) return NoChange();
       // Check if this {node} has some uncontrolled side effects.
-      if (!node->op()->HasProperty(Operator::kNoWrite)) {
+      if (!node->op()->HasProperty(Operator::kNoWrite) &&
+          !IsNonWritingBuiltinCall(node)) {
         state = state->KillAll(zone());
       }
       return UpdateState(node, state);
@@ -1266,6 +1270,19 @@ Reduction LoadElimination::ReduceOtherNode(Node* node) {
   return NoChange();
 }
 
+bool LoadElimination::IsNonWritingBuiltinCall(Node* node) const {
+  if (node->opcode() != IrOpcode::kCall) return false;
+  HeapObjectMatcher m(NodeProperties::GetValueInput(node, 0));
+  if (!m.HasResolvedValue()) return false;
+  HeapObjectRef target = m.Ref(broker());
+  if (!target.IsCode()) return false;
+  Handle<Code> code = target.AsCode().object();
+  if (!code->is_builtin()) return false;
+  base::Optional<BuiltinEffects> effects =
+      TryGetBuiltinEffects(code->builtin_id());
+  return effects.has_value() && !effects->writes_heap;
+}
+
 Reduction LoadElimination::UpdateState(Node* node, AbstractState const* state) {
   AbstractState const* original = node_states_.Get(node);
   // Only signal that the {node} has Changed, if the information about {state}
@@ -1320,7 +1337,8 @@ LoadElimination::AbstractState const* LoadElimination::ComputeLoopState(
     queue.pop();
     if (visited.find(current) == visited.end()) {
       visited.insert(current);
-      if (!current->op()->HasProperty(Operator::kNoWrite)) {
+      if (!current->op()->HasProperty(Operator::kNoWrite) &&
+          !IsNonWritingBuiltinCall(current)) {
         switch (current->opcode()) {
           case IrOpcode::kEnsureWritableFastElements: {
             Node* const object = NodeProperties::GetValueInput(current, 0);
@@ -332,6 +332,10 @@ class V8_EXPORT_PRIVATE LoadElimination final
   Reduction ReduceStart(Node* node);
   Reduction ReduceOtherNode(Node* node);
 
+  // Returns true if {node} calls a builtin that is known not to write to any
+  // existing object (see builtin-effects.h).
+  bool IsNonWritingBuiltinCall(Node* node) const;
+
   Reduction UpdateState(Node* node, AbstractState const* state);
 
   AbstractState const* ComputeLoopState(Node* node,
@@ -136,6 +136,13 @@ void TurbofanPipelineStatistics::BeginPhase(const char* name) {
 void TurbofanPipelineStatistics::EndPhase() {
   CompilationStatistics::BasicStats diff;
   Base::EndPhase(&diff);
+  if (record_phases_) {
+    v8::metrics::TurbofanPhase phase;
+    phase.name = phase_name();
+    phase.wall_clock_duration_in_us = diff.delta_.InMicroseconds();
+    phase.peak_zone_size_in_bytes = diff.absolute_max_allocated_bytes_;
+    recorded_phases_.push_back(phase);
+  }
   TRACE_EVENT_END2(kTraceCategory, phase_name(), "kind",
                    CodeKindToString(code_kind()), "stats",
                    TRACE_STR_COPY(diff.AsJSON().c_str()));
@@ -7,7 +7,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "include/v8-metrics.h"
 #include "src/base/export-template.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/compiler/zone-stats.h"
@@ -70,6 +72,10 @@ class PipelineStatisticsBase {
     function_name_.assign(function_name);
   }
 
+  void RecordCounter(const char* name, size_t value) {
+    compilation_stats_->RecordCounter(name, value);
+  }
+
  private:
   Zone* outer_zone_;
   ZoneStats* zone_stats_;
@@ -109,6 +115,18 @@ class TurbofanPipelineStatistics : public PipelineStatisticsBase,
   void EndPhaseKind();
   void BeginPhase(const char* name);
   void EndPhase();
+
+  // Whether to keep the stats of every phase of this compilation, so that they
+  // can be reported to the embedder's metrics recorder.
+  void set_record_phases() { record_phases_ = true; }
+  bool record_phases() const { return record_phases_; }
+  const std::vector<v8::metrics::TurbofanPhase>& recorded_phases() const {
+    return recorded_phases_;
+  }
+
+ private:
+  bool record_phases_ = false;
+  std::vector<v8::metrics::TurbofanPhase> recorded_phases_;
 };
 
 class V8_NODISCARD PhaseScope {
@@ -55,6 +55,7 @@
 #include "src/compiler/js-generic-lowering.h"
 #include "src/compiler/js-heap-broker.h"
 #include "src/compiler/js-inlining-heuristic.h"
+#include "src/compiler/js-inlining-profile.h"
 #include "src/compiler/js-intrinsic-lowering.h"
 #include "src/compiler/js-native-context-specialization.h"
 #include "src/compiler/js-typed-lowering.h"
@@ -107,6 +108,7 @@
 #include "src/heap/local-heap.h"
 #include "src/logging/code-events.h"
 #include "src/logging/counters.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/logging/runtime-call-stats.h"
 #include "src/objects/shared-function-info.h"
@@ -1093,9 +1095,12 @@ TurbofanPipelineStatistics* CreatePipelineStatistics(
   bool tracing_enabled;
   TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACE_DISABLED_BY_DEFAULT("v8.turbofan"),
                                      &tracing_enabled);
-  if (tracing_enabled || v8_flags.turbo_stats || v8_flags.turbo_stats_nvp) {
+  bool report_metrics = isolate->metrics_recorder()->HasEmbedderRecorder();
+  if (tracing_enabled || report_metrics || v8_flags.turbo_stats ||
+      v8_flags.turbo_stats_nvp) {
     pipeline_statistics = new TurbofanPipelineStatistics(
         info, isolate->GetTurboStatistics(), zone_stats);
+    if (report_metrics) pipeline_statistics->set_record_phases();
     pipeline_statistics->BeginPhaseKind("V8.TFInitializing");
   }
 
@@ -1171,6 +1176,11 @@ class PipelineCompilationJob final : public TurbofanCompilationJob {
                         LocalIsolate* local_isolate) final;
   Status FinalizeJobImpl(Isolate* isolate) final;
 
+  Status FinalizeCode(Isolate* isolate);
+  // Reports the per-phase compile time and zone usage of this job to the
+  // embedder's metrics recorder.
+  void ReportMetrics(Isolate* isolate, bool success);
+
   // Registers weak object to optimized code dependencies.
   void RegisterWeakObjectsInOptimizedCode(Isolate* isolate,
                                           Handle<NativeContext> context,
@@ -1317,6 +1327,15 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
   // phases happening during PrepareJob.
   PipelineJobScope scope(&data_, isolate->counters()->runtime_call_stats());
   RCS_SCOPE(isolate, RuntimeCallCounterId::kOptimizeFinalizePipelineJob);
+  Status status = FinalizeCode(isolate);
+  if (pipeline_statistics_ && pipeline_statistics_->record_phases()) {
+    ReportMetrics(isolate, status == SUCCEEDED);
+  }
+  return status;
+}
+
+PipelineCompilationJob::Status PipelineCompilationJob::FinalizeCode(
+    Isolate* isolate) {
   MaybeHandle<Code> maybe_code = pipeline_.FinalizeCode();
   Handle<Code> code;
   if (!maybe_code.ToHandle(&code)) {
@@ -1338,9 +1357,31 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
 
   compilation_info()->SetCode(code);
   RegisterWeakObjectsInOptimizedCode(isolate, context, code);
+  if (V8_UNLIKELY(v8_flags.turbo_inlining_profile_to_file)) {
+    JSInliningProfile::RecordInlinedFunctions(compilation_info());
+  }
   return SUCCEEDED;
 }
 
+void PipelineCompilationJob::ReportMetrics(Isolate* isolate, bool success) {
+  v8::metrics::TurbofanFunctionCompiled event;
+  event.function_name = compilation_info()->GetDebugName().get();
+  event.osr = compilation_info()->is_osr();
+  event.success = success;
+  event.bytecode_size_in_bytes =
+      compilation_info()->bytecode_array()->length();
+  event.wall_clock_duration_in_us = 0;
+  event.phases = pipeline_statistics_->recorded_phases();
+  for (const v8::metrics::TurbofanPhase& phase : event.phases) {
+    event.wall_clock_duration_in_us += phase.wall_clock_duration_in_us;
+    event.peak_zone_size_in_bytes =
+        std::max(event.peak_zone_size_in_bytes, phase.peak_zone_size_in_bytes);
+  }
+  isolate->metrics_recorder()->AddMainThreadEvent(
+      event, isolate->GetOrRegisterRecorderContextId(
+                 handle(compilation_info()->native_context(), isolate)));
+}
+
 void PipelineCompilationJob::RegisterWeakObjectsInOptimizedCode(
     Isolate* isolate, Handle<NativeContext> context, Handle<Code> code) {
   std::vector<Handle<Map>> maps;
@@ -4131,6 +4172,22 @@ bool PipelineImpl::SelectInstructionsTurboshaft(
   return AllocateRegisters(call_descriptor, false);
 }
 
+namespace {
+
+// The linear-scan allocator is superlinear in both the number of live ranges
+// and the number of instructions they span, so either one alone can make it
+// take too long. The default limits are chosen somewhat arbitrarily, by
+// looking at a few bigger WebAssembly programs, and choosing them such that
+// functions that take >100ms in register allocation are switched to mid-tier.
+bool IsHugeForTopTierRegisterAllocation(const InstructionSequence* sequence) {
+  return sequence->VirtualRegisterCount() >
+             v8_flags.turbo_mid_tier_regalloc_virtual_registers_limit ||
+         static_cast<int>(sequence->instructions().size()) >
+             v8_flags.turbo_mid_tier_regalloc_instructions_limit;
+}
+
+}  // namespace
+
 bool PipelineImpl::AllocateRegisters(CallDescriptor* call_descriptor,
                                      bool has_dummy_end_block) {
   PipelineData* data = this->data_;
@@ -4142,11 +4199,6 @@ bool PipelineImpl::AllocateRegisters(CallDescriptor* call_descriptor,
 
   // Allocate registers.
 
-  // This limit is chosen somewhat arbitrarily, by looking at a few bigger
-  // WebAssembly programs, and chosing the limit such that functions that take
-  // >100ms in register allocation are switched to mid-tier.
-  static int kTopTierVirtualRegistersLimit = 16384;
-
   const RegisterConfiguration* config = RegisterConfiguration::Default();
   std::unique_ptr<const RegisterConfiguration> restricted_config;
   // The mid-tier register allocator keeps values in stack slots for too long.
@@ -4156,8 +4208,7 @@ bool PipelineImpl::AllocateRegisters(CallDescriptor* call_descriptor,
       data->info()->code_kind() == CodeKind::WASM_FUNCTION &&
       (v8_flags.turbo_force_mid_tier_regalloc ||
        (v8_flags.turbo_use_mid_tier_regalloc_for_huge_functions &&
-        data->sequence()->VirtualRegisterCount() >
-            kTopTierVirtualRegistersLimit));
+        IsHugeForTopTierRegisterAllocation(data->sequence())));
 
   if (call_descriptor->HasRestrictedAllocatableRegisters()) {
     RegList registers = call_descriptor->AllocatableRegisters();
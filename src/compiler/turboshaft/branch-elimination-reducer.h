@@ -5,6 +5,8 @@
 #ifndef V8_COMPILER_TURBOSHAFT_BRANCH_ELIMINATION_REDUCER_H_
 #define V8_COMPILER_TURBOSHAFT_BRANCH_ELIMINATION_REDUCER_H_
 
+#include <utility>
+
 #include "src/base/bits.h"
 #include "src/base/logging.h"
 #include "src/base/optional.h"
@@ -186,6 +188,13 @@ class BranchEliminationReducer : public Next {
   // destination block ends with a branch whose condition is already known. If
   // that's the case, then we copy the destination block, and the 1st
   // optimization will replace its final Branch by a Goto when reaching it.
+  //
+  // In addition, the signed `index < length` comparisons known to be true are
+  // kept in {known_signed_bounds_}, to remove the bounds checks of loops like
+  // `for (let i = 0; i < a.length; i++) a[i]`: the bounds check on `a[i]` is
+  // an unsigned comparison (ie, `DeoptimizeIfNot(i <u length)`), which is
+  // implied by the loop condition `i < length` if `i` is an induction variable
+  // that can never be negative.
  public:
   TURBOSHAFT_REDUCER_BOILERPLATE()
 
@@ -219,7 +228,7 @@ class BranchEliminationReducer : public Next {
         DCHECK_EQ(new_block, any_of(branch->if_true, branch->if_false));
         bool condition_value = branch->if_true == new_block;
         if (!known_conditions_.Contains(branch->condition())) {
-          known_conditions_.InsertNewKey(branch->condition(), condition_value);
+          InsertKnownCondition(branch->condition(), condition_value);
         }
       }
     }
@@ -358,7 +367,12 @@ class BranchEliminationReducer : public Next {
 
     base::Optional<bool> condition_value = known_conditions_.Get(condition);
     if (!condition_value.has_value()) {
-      known_conditions_.InsertNewKey(condition, negated);
+      if (negated && IsRedundantBoundsCheck(condition)) {
+        // {condition} is known to be true, so we never deoptimize.
+        InsertKnownCondition(condition, true);
+        return OpIndex::Invalid();
+      }
+      InsertKnownCondition(condition, negated);
       goto no_change;
     }
 
@@ -380,7 +394,7 @@ class BranchEliminationReducer : public Next {
 
     base::Optional<bool> condition_value = known_conditions_.Get(condition);
     if (!condition_value.has_value()) {
-      known_conditions_.InsertNewKey(condition, negated);
+      InsertKnownCondition(condition, negated);
       goto no_change;
     }
 
@@ -398,6 +412,119 @@ class BranchEliminationReducer : public Next {
   }
 
  private:
+  // Records the value of {condition} on the current path. {condition} must not
+  // be known already.
+  void InsertKnownCondition(OpIndex condition, bool value) {
+    known_conditions_.InsertNewKey(condition, value);
+    if (!value) return;
+    const ComparisonOp* comparison =
+        Asm().template TryCast<ComparisonOp>(condition);
+    if (comparison &&
+        comparison->kind == ComparisonOp::Kind::kSignedLessThan &&
+        comparison->rep == RegisterRepresentation::Word32()) {
+      std::pair<OpIndex, OpIndex> bound{comparison->left(),
+                                        comparison->right()};
+      if (!known_signed_bounds_.Contains(bound)) {
+        known_signed_bounds_.InsertNewKey(bound, true);
+      }
+    }
+  }
+
+  // Returns true if {condition} is an unsigned `index < length` comparison
+  // that is implied by a known signed `index < length` comparison, because
+  // {index} is a non-negative induction variable. For Word64 comparisons, both
+  // sides can also be extensions of Word32 values: `length` is greater than
+  // `index` and thus non-negative as well, so its sign- and zero-extensions
+  // are the same.
+  bool IsRedundantBoundsCheck(OpIndex condition) {
+    const ComparisonOp* comparison =
+        Asm().template TryCast<ComparisonOp>(condition);
+    if (!comparison ||
+        comparison->kind != ComparisonOp::Kind::kUnsignedLessThan) {
+      return false;
+    }
+    OpIndex index = comparison->left();
+    OpIndex length = comparison->right();
+    if (comparison->rep == RegisterRepresentation::Word64()) {
+      index = SkipWord32ToWord64Extension(index);
+      length = SkipWord32ToWord64Extension(length);
+      if (!index.valid() || !length.valid()) return false;
+    } else if (comparison->rep != RegisterRepresentation::Word32()) {
+      return false;
+    }
+    if (!known_signed_bounds_.Contains({index, length})) return false;
+    return IsNonNegativeInductionVariable(index);
+  }
+
+  OpIndex SkipWord32ToWord64Extension(OpIndex value) {
+    const ChangeOp* change = Asm().template TryCast<ChangeOp>(value);
+    if (!change ||
+        !(change->kind == any_of(ChangeOp::Kind::kSignExtend,
+                                 ChangeOp::Kind::kZeroExtend)) ||
+        change->from != RegisterRepresentation::Word32() ||
+        change->to != RegisterRepresentation::Word64()) {
+      return OpIndex::Invalid();
+    }
+    return change->input();
+  }
+
+  // Returns true if {value} is a Word32 loop phi of the form
+  // `phi(c0, phi + c1)`, with non-negative constants {c0} and {c1}, and where
+  // the addition deoptimizes on overflow. Such a phi can never be negative.
+  // Since the loop is still being emitted, the phi is a PendingLoopPhi in the
+  // output graph, and its backedge input has to be inspected in the input
+  // graph.
+  bool IsNonNegativeInductionVariable(OpIndex value) {
+    const PendingLoopPhiOp* phi =
+        Asm().template TryCast<PendingLoopPhiOp>(value);
+    if (!phi || phi->kind != PendingLoopPhiOp::Kind::kOldGraphIndex ||
+        phi->rep != RegisterRepresentation::Word32()) {
+      return false;
+    }
+    int32_t initial_value;
+    if (!Asm().MatchWord32Constant(phi->first(), &initial_value) ||
+        initial_value < 0) {
+      return false;
+    }
+
+    const Graph& input_graph = Asm().input_graph();
+    OpIndex old_phi = Asm().output_graph().operation_origins()[value];
+    const ProjectionOp* projection =
+        input_graph.Get(phi->old_backedge_index()).TryCast<ProjectionOp>();
+    if (!projection || projection->index != 0) return false;
+    OpIndex old_add = projection->input();
+    const OverflowCheckedBinopOp* add =
+        input_graph.Get(old_add).TryCast<OverflowCheckedBinopOp>();
+    if (!add || add->kind != OverflowCheckedBinopOp::Kind::kSignedAdd ||
+        add->rep != WordRepresentation::Word32()) {
+      return false;
+    }
+    OpIndex step = add->left() == old_phi    ? add->right()
+                   : add->right() == old_phi ? add->left()
+                                             : OpIndex::Invalid();
+    if (!step.valid()) return false;
+    const ConstantOp* step_constant =
+        input_graph.Get(step).TryCast<ConstantOp>();
+    if (!step_constant || step_constant->kind != ConstantOp::Kind::kWord32 ||
+        step_constant->signed_integral() < 0) {
+      return false;
+    }
+
+    // The addition has to deoptimize when it overflows, otherwise the phi
+    // would wrap around to negative values.
+    const Block& add_block = input_graph.Get(input_graph.BlockOf(old_add));
+    for (const Operation& op : input_graph.operations(add_block)) {
+      const DeoptimizeIfOp* deopt = op.TryCast<DeoptimizeIfOp>();
+      if (!deopt || deopt->negated) continue;
+      const ProjectionOp* overflow =
+          input_graph.Get(deopt->condition()).TryCast<ProjectionOp>();
+      if (overflow && overflow->input() == old_add && overflow->index == 1) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   // Resets {known_conditions_} and {dominator_path_} up to the 1st dominator of
   // {block} that they contain.
   void ResetToBlock(Block* block) {
@@ -420,11 +547,13 @@ class BranchEliminationReducer : public Next {
   // Removes the latest entry in {known_conditions_} and {dominator_path_}.
   void ClearCurrentEntries() {
     known_conditions_.DropLastLayer();
+    known_signed_bounds_.DropLastLayer();
     dominator_path_.pop_back();
   }
 
   void StartLayer(Block* block) {
     known_conditions_.StartLayer();
+    known_signed_bounds_.StartLayer();
     dominator_path_.push_back(block);
   }
 
@@ -494,7 +623,7 @@ class BranchEliminationReducer : public Next {
               branch->if_true->index().valid()
                   ? branch->if_true->index() == block->index()
                   : branch->if_false->index() != block->index();
-          known_conditions_.InsertNewKey(branch->condition(), condition_value);
+          InsertKnownCondition(branch->condition(), condition_value);
         }
       }
     }
@@ -506,6 +635,9 @@ class BranchEliminationReducer : public Next {
   ZoneVector<Block*> dominator_path_{Asm().phase_zone()};
   LayeredHashMap<OpIndex, bool> known_conditions_{
       Asm().phase_zone(), Asm().input_graph().DominatorTreeDepth() * 2};
+  // Pairs (index, length) for which `index <s length` is known to be true.
+  LayeredHashMap<std::pair<OpIndex, OpIndex>, bool> known_signed_bounds_{
+      Asm().phase_zone()};
 };
 
 #include "src/compiler/turboshaft/undef-assembler-macros.inc"
@@ -26,7 +26,8 @@ void LateEscapeAnalysisAnalyzer::CollectUsesAndAllocations() {
     if (ShouldSkipOperation(op)) continue;
     OpIndex op_index = graph_.Index(op);
     for (OpIndex input : op.inputs()) {
-      if (graph_.Get(input).Is<AllocateOp>()) {
+      const Operation& input_op = graph_.Get(input);
+      if (input_op.Is<AllocateOp>() || IsTaggedPhi(input_op)) {
         RecordAllocateUse(input, op_index);
       }
     }
@@ -52,15 +53,46 @@ void LateEscapeAnalysisAnalyzer::FindRemovableAllocations() {
   }
 }
 
+// Returns true if {alloc}, or any allocation it is merged with by a Phi, is
+// used by something other than a store writing to it. On return, {group_}
+// holds the allocations and Phis that have been visited.
 bool LateEscapeAnalysisAnalyzer::AllocationIsEscaping(OpIndex alloc) {
-  if (alloc_uses_.find(alloc) == alloc_uses_.end()) return false;
-  for (OpIndex use : alloc_uses_.at(alloc)) {
-    if (EscapesThroughUse(alloc, use)) return true;
+  group_.clear();
+  group_worklist_.clear();
+  AddToGroup(alloc);
+  while (!group_worklist_.empty()) {
+    OpIndex current = group_worklist_.back();
+    group_worklist_.pop_back();
+    if (alloc_uses_.find(current) == alloc_uses_.end()) continue;
+    for (OpIndex use : alloc_uses_.at(current)) {
+      if (EscapesThroughUse(current, use)) return true;
+    }
   }
-  // We haven't found any non-store use
+  // We haven't found any use besides stores and Phis of the group.
   return false;
 }
 
+// Adds {op} to {group_}. Returns false if {op} is neither an allocation nor a
+// Phi merging allocations, in which case it forces the group to be emitted.
+bool LateEscapeAnalysisAnalyzer::AddToGroup(OpIndex op) {
+  if (group_.count(op)) return true;
+  const Operation& operation = graph_.Get(op);
+  if (operation.Is<AllocateOp>()) {
+    group_.insert(op);
+    group_worklist_.push_back(op);
+    return true;
+  }
+  if (!IsTaggedPhi(operation)) return false;
+  group_.insert(op);
+  group_worklist_.push_back(op);
+  // If the Phi could also produce something else than a group member, then
+  // the stores writing to the Phi cannot be removed.
+  for (OpIndex input : operation.inputs()) {
+    if (!AddToGroup(input)) return false;
+  }
+  return true;
+}
+
 // Returns true if {using_op_idx} is an operation that forces {alloc} to be
 // emitted.
 bool LateEscapeAnalysisAnalyzer::EscapesThroughUse(OpIndex alloc,
@@ -76,25 +108,37 @@ bool LateEscapeAnalysisAnalyzer::EscapesThroughUse(OpIndex alloc,
     // {alloc}, but not if it writes **to** {alloc}.
     return store_op->value() == alloc;
   }
+  if (IsTaggedPhi(op)) {
+    // A Phi merging {alloc} only makes it escape if the Phi itself escapes.
+    return !AddToGroup(using_op_idx);
+  }
   return true;
 }
 
 void LateEscapeAnalysisAnalyzer::MarkToRemove(OpIndex alloc) {
   if (ShouldSkipOptimizationStep()) return;
-  graph_.MarkAsUnused(alloc);
-  if (alloc_uses_.find(alloc) == alloc_uses_.end()) {
-    return;
-  }
+  // {alloc} is removed together with the allocations and Phis it is merged
+  // with, which AllocationIsEscaping has collected in {group_}.
+  DCHECK(group_.count(alloc));
+  for (OpIndex member : group_) {
+    graph_.MarkAsUnused(member);
+    if (alloc_uses_.find(member) == alloc_uses_.end()) continue;
 
-  // The uses of {alloc} should also be skipped.
-  for (OpIndex use : alloc_uses_.at(alloc)) {
-    graph_.MarkAsUnused(use);
-    const StoreOp& store = graph_.Get(use).Cast<StoreOp>();
-    if (graph_.Get(store.value()).Is<AllocateOp>()) {
-      // This store was storing the result of an allocation. Because we now
-      // removed this store, we might be able to remove the other allocation
-      // as well.
-      allocs_.push_back(store.value());
+    // The uses of {member} should also be skipped.
+    for (OpIndex use : alloc_uses_.at(member)) {
+      graph_.MarkAsUnused(use);
+      const StoreOp* store = graph_.Get(use).TryCast<StoreOp>();
+      if (store == nullptr) {
+        // A Phi of the group, which is removed as a member.
+        DCHECK(group_.count(use));
+        continue;
+      }
+      if (graph_.Get(store->value()).Is<AllocateOp>()) {
+        // This store was storing the result of an allocation. Because we now
+        // removed this store, we might be able to remove the other allocation
+        // as well.
+        allocs_.push_back(store->value());
+      }
     }
   }
 }
@@ -15,6 +15,12 @@ namespace v8::internal::compiler::turboshaft {
 
 // LateEscapeAnalysis removes allocation that have no uses besides the stores
 // initializing the object.
+//
+// Allocations can also be merged by Phis, typically when a loop carries a
+// freshly allocated object from one iteration to the next. Such a group of
+// allocations and Phis is removed as a whole if each of its Phis only merges
+// members of the group, and if no member has uses besides stores writing to
+// it and the Phis of the group.
 
 class LateEscapeAnalysisAnalyzer {
  public:
@@ -30,13 +36,25 @@ class LateEscapeAnalysisAnalyzer {
   void FindRemovableAllocations();
   bool AllocationIsEscaping(OpIndex alloc);
   bool EscapesThroughUse(OpIndex alloc, OpIndex using_op_idx);
+  bool AddToGroup(OpIndex op);
   void MarkToRemove(OpIndex alloc);
 
+  // Phis that can merge allocations, i.e. tagged Phis.
+  bool IsTaggedPhi(const Operation& op) const {
+    const PhiOp* phi = op.TryCast<PhiOp>();
+    return phi && phi->rep == RegisterRepresentation::Tagged();
+  }
+
   Graph& graph_;
   Zone* phase_zone_;
 
-  // {alloc_uses_} records all the uses of each AllocateOp.
+  // {alloc_uses_} records all the uses of each AllocateOp and tagged PhiOp.
   ZoneUnorderedMap<OpIndex, ZoneVector<OpIndex>> alloc_uses_;
+  // The allocations and Phis connected to the allocation under consideration,
+  // which are either all escaping or all removable, and the members of
+  // {group_} whose uses haven't been checked yet.
+  ZoneUnorderedSet<OpIndex> group_{phase_zone_};
+  ZoneVector<OpIndex> group_worklist_{phase_zone_};
   // {allocs_} is filled with all of the AllocateOp of the graph, and then
   // iterated upon to determine which allocations can be removed and which
   // cannot.
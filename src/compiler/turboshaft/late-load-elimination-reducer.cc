@@ -4,6 +4,7 @@
 
 #include "src/compiler/turboshaft/late-load-elimination-reducer.h"
 
+#include "src/compiler/builtin-effects.h"
 #include "src/compiler/js-heap-broker.h"
 #include "src/objects/code-inl.h"
 
@@ -186,6 +187,16 @@ void LateLoadEliminationAnalyzer::ProcessCall(OpIndex op_idx,
         break;
       }
       default:
+        if (base::Optional<BuiltinEffects> effects =
+                TryGetBuiltinEffects(*builtin_id);
+            effects.has_value() && !effects->writes_heap) {
+          // The builtin doesn't write existing objects. We still conservatively
+          // assume that it could create aliases of its inputs.
+          for (OpIndex input : op.inputs()) {
+            InvalidateIfAlias(input);
+          }
+          return;
+        }
         break;
     }
   }
@@ -0,0 +1,111 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/loop-finder.h"
+
+#include "src/base/iterator.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void LoopFinder::Run() {
+  // Visiting the loop headers in reverse order guarantees that inner loops are
+  // discovered before their enclosing loops.
+  for (const Block* block : base::Reversed(input_graph_->blocks_vector())) {
+    if (block->IsLoop()) {
+      LoopInfo info = VisitLoop(block);
+      loop_header_info_.insert({block, info});
+    }
+  }
+}
+
+size_t LoopFinder::CountOperations(const Block* block) const {
+  size_t count = 0;
+  for (OpIndex index : input_graph_->OperationIndices(*block)) {
+    USE(index);
+    count++;
+  }
+  return count;
+}
+
+const Block* LoopFinder::OutermostDiscoveredLoop(const Block* block) const {
+  const Block* header = loop_headers_[block->index()];
+  if (header == nullptr) return nullptr;
+  while (const Block* outer = outer_loops_[header->index()]) header = outer;
+  return header;
+}
+
+// Walks backwards from the backedge of {header} until {header} is reached,
+// assigning every block found on the way to the loop of {header}. Blocks of
+// already discovered inner loops are not visited again: the walk directly
+// continues with the forward predecessors of the inner loop header.
+LoopFinder::LoopInfo LoopFinder::VisitLoop(const Block* header) {
+  const Block* backedge = header->LastPredecessor();
+  DCHECK_NOT_NULL(backedge);
+  DCHECK_GE(backedge->index().id(), header->index().id());
+
+  LoopInfo info;
+  info.start = header;
+  info.end = backedge;
+  loop_headers_[header->index()] = header;
+  info.block_count = 1;
+  info.op_count = CountOperations(header);
+
+  DCHECK(queue_.empty());
+  queue_.push_back(backedge);
+  while (!queue_.empty()) {
+    const Block* curr = queue_.back();
+    queue_.pop_back();
+    const Block* curr_loop = OutermostDiscoveredLoop(curr);
+    if (curr_loop == header) continue;
+    if (curr_loop == nullptr) {
+      loop_headers_[curr->index()] = header;
+      info.block_count++;
+      info.op_count += CountOperations(curr);
+      for (const Block* pred = curr->LastPredecessor(); pred != nullptr;
+           pred = pred->NeighboringPredecessor()) {
+        queue_.push_back(pred);
+      }
+      continue;
+    }
+    // {curr} belongs to an inner loop, which becomes part of the current loop
+    // as a whole.
+    DCHECK(curr_loop->IsLoop());
+    outer_loops_[curr_loop->index()] = header;
+    const LoopInfo inner_info = GetLoopInfo(curr_loop);
+    info.has_inner_loops = true;
+    info.block_count += inner_info.block_count;
+    info.op_count += inner_info.op_count;
+    // The last predecessor of a loop header is its backedge, which is inside
+    // of the inner loop.
+    const Block* inner_backedge = curr_loop->LastPredecessor();
+    for (const Block* pred = inner_backedge->NeighboringPredecessor();
+         pred != nullptr; pred = pred->NeighboringPredecessor()) {
+      queue_.push_back(pred);
+    }
+  }
+
+  return info;
+}
+
+ZoneVector<const Block*> LoopFinder::GetLoopBody(
+    const Block* loop_header) const {
+  DCHECK(loop_header->IsLoop());
+  ZoneVector<const Block*> body(phase_zone_);
+  body.reserve(GetLoopInfo(loop_header).block_count);
+  // The header dominates all the blocks of the loop, and dominators always
+  // come first in Turboshaft graphs.
+  for (const Block& block : input_graph_->blocks()) {
+    if (block.index() < loop_header->index()) continue;
+    for (const Block* header = GetLoopHeader(&block); header != nullptr;
+         header = GetOuterLoopHeader(header)) {
+      if (header == loop_header) {
+        body.push_back(&block);
+        break;
+      }
+    }
+  }
+  return body;
+}
+
+}  // namespace v8::internal::compiler::turboshaft
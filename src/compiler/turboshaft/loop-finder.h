@@ -0,0 +1,103 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_LOOP_FINDER_H_
+#define V8_COMPILER_TURBOSHAFT_LOOP_FINDER_H_
+
+#include "src/base/logging.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+// LoopFinder computes, for every block of a Turboshaft graph, the innermost
+// loop that contains it, as well as some size information per loop. This is
+// meant as the analysis part of loop transformations (peeling, unrolling),
+// which need to know which blocks form the body of a loop and need a size
+// estimate to decide whether duplicating the body is worth it.
+//
+// Turboshaft graphs are ordered such that a loop header comes before all the
+// blocks of its body, and the backedge is the last predecessor of the header.
+// The loops are thus discovered by visiting the loop headers in reverse order,
+// starting a backwards walk from the backedge of each of them. Since inner
+// loops are visited before their outer loops, an already discovered inner loop
+// can be skipped during the walk by jumping directly to its header.
+class V8_EXPORT_PRIVATE LoopFinder {
+ public:
+  struct LoopInfo {
+    const Block* start = nullptr;
+    // The block that ends with the backedge of the loop.
+    const Block* end = nullptr;
+    bool has_inner_loops = false;
+    // Number of blocks and operations of the loop, including inner loops.
+    size_t block_count = 0;
+    size_t op_count = 0;
+  };
+
+  LoopFinder(Zone* phase_zone, const Graph* input_graph)
+      : phase_zone_(phase_zone),
+        input_graph_(input_graph),
+        loop_headers_(input_graph->block_count(), nullptr, phase_zone),
+        outer_loops_(input_graph->block_count(), nullptr, phase_zone),
+        loop_header_info_(phase_zone),
+        queue_(phase_zone) {
+    Run();
+  }
+
+  const ZoneUnorderedMap<const Block*, LoopInfo>& LoopHeaders() const {
+    return loop_header_info_;
+  }
+
+  // Returns the header of the innermost loop that contains {block}, or nullptr
+  // if {block} is not inside a loop. A loop header is its own innermost loop.
+  const Block* GetLoopHeader(const Block* block) const {
+    return loop_headers_[block->index()];
+  }
+
+  // Returns the header of the loop directly enclosing the loop that starts at
+  // {loop_header}, or nullptr if it is an outermost loop.
+  const Block* GetOuterLoopHeader(const Block* loop_header) const {
+    DCHECK(loop_header->IsLoop());
+    return outer_loops_[loop_header->index()];
+  }
+
+  LoopInfo GetLoopInfo(const Block* loop_header) const {
+    DCHECK(loop_header->IsLoop());
+    auto it = loop_header_info_.find(loop_header);
+    DCHECK(it != loop_header_info_.end());
+    return it->second;
+  }
+
+  // Returns all the blocks of the loop starting at {loop_header}, including
+  // the blocks of inner loops, in graph order.
+  ZoneVector<const Block*> GetLoopBody(const Block* loop_header) const;
+
+ private:
+  void Run();
+  LoopInfo VisitLoop(const Block* header);
+  size_t CountOperations(const Block* block) const;
+  // Returns the outermost loop that contains {block} and that has already been
+  // discovered, or nullptr if there is none.
+  const Block* OutermostDiscoveredLoop(const Block* block) const;
+
+  Zone* phase_zone_;
+  const Graph* input_graph_;
+
+  // Maps each block to the header of the innermost loop containing it.
+  FixedBlockSidetable<const Block*> loop_headers_;
+  // Maps each loop header to the header of its directly enclosing loop.
+  FixedBlockSidetable<const Block*> outer_loops_;
+  ZoneUnorderedMap<const Block*, LoopInfo> loop_header_info_;
+
+  // Worklist for the backwards walk of VisitLoop; kept as a member to reuse
+  // its storage across loops.
+  ZoneVector<const Block*> queue_;
+};
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_LOOP_FINDER_H_
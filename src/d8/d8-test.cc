@@ -504,6 +504,80 @@ class FastCApiObject {
     info.GetReturnValue().Set(Number::New(isolate, sum));
   }
 
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType Add32BitIntNoOptionsFastCallbackPatch(AnyCType receiver,
+                                                        AnyCType arg_i32,
+                                                        AnyCType arg_u32) {
+    AnyCType ret;
+    ret.int32_value = Add32BitIntNoOptionsFastCallback(
+        receiver.object_value, arg_i32.int32_value, arg_u32.uint32_value);
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+
+  static int Add32BitIntNoOptionsFastCallback(v8::Local<v8::Object> receiver,
+                                              int32_t arg_i32,
+                                              uint32_t arg_u32) {
+    // Without options there is no way to fall back to the slow callback, so
+    // the receiver has to be a FastCApiObject.
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_NOT_NULL(self);
+    self->fast_call_count_++;
+
+    return arg_i32 + arg_u32;
+  }
+  static void Add32BitIntNoOptionsSlowCallback(
+      const FunctionCallbackInfo<Value>& info) {
+    DCHECK(i::ValidateCallbackInfo(info));
+    Isolate* isolate = info.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(info.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+
+    double sum = 0;
+    if (info.Length() > 0 && info[0]->IsNumber()) {
+      sum += info[0]->Int32Value(isolate->GetCurrentContext()).FromJust();
+    }
+    if (info.Length() > 1 && info[1]->IsNumber()) {
+      sum += info[1]->Uint32Value(isolate->GetCurrentContext()).FromJust();
+    }
+
+    info.GetReturnValue().Set(Number::New(isolate, sum));
+  }
+
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType Add32BitIntOrFallbackFastCallbackPatch(AnyCType receiver,
+                                                         AnyCType arg_i32,
+                                                         AnyCType arg_u32,
+                                                         AnyCType options) {
+    AnyCType ret;
+    ret.int32_value = Add32BitIntOrFallbackFastCallback(
+        receiver.object_value, arg_i32.int32_value, arg_u32.uint32_value,
+        *options.options_value);
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+
+  static int Add32BitIntOrFallbackFastCallback(
+      v8::Local<v8::Object> receiver, int32_t arg_i32, uint32_t arg_u32,
+      FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(0);
+    self->fast_call_count_++;
+
+    // Sums that don't fit into the int32 return value are computed by the
+    // slow callback.
+    int64_t sum = static_cast<int64_t>(arg_i32) + arg_u32;
+    if (sum > std::numeric_limits<int32_t>::max()) {
+      options.fallback = true;
+      return 0;
+    }
+    return static_cast<int>(sum);
+  }
+
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
   static AnyCType AddAll32BitIntFastCallback_8ArgsPatch(
       AnyCType receiver, AnyCType should_fallback, AnyCType arg1_i32,
@@ -1645,6 +1719,27 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             signature, 1, ConstructorBehavior::kThrow,
             SideEffectType::kHasSideEffect, &add_32bit_int_c_func));
 
+    CFunction add_32bit_int_no_options_c_func = CFunction::Make(
+        FastCApiObject::Add32BitIntNoOptionsFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::Add32BitIntNoOptionsFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_32bit_int_no_options",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::Add32BitIntNoOptionsSlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_32bit_int_no_options_c_func));
+
+    CFunction add_32bit_int_or_fallback_c_func = CFunction::Make(
+        FastCApiObject::Add32BitIntOrFallbackFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::Add32BitIntOrFallbackFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_32bit_int_or_fallback",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::Add32BitIntNoOptionsSlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect,
+            &add_32bit_int_or_fallback_c_func));
+
     CFunction add_all_annotate_c_func = CFunction::Make(
         FastCApiObject::AddAllAnnotateFastCallback<
             v8::CTypeInfo::Flags::kEnforceRangeBit>
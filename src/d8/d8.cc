@@ -8,6 +8,7 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
@@ -99,6 +100,7 @@
 #endif  // V8_INTL_SUPPORT
 
 #ifdef V8_OS_LINUX
+#include <sched.h>     // For CpuPinningScope.
 #include <sys/mman.h>  // For MultiMappedAllocator.
 #endif
 
@@ -756,6 +758,14 @@ class ModuleEmbedderData {
   std::unordered_map<Global<Module>, Global<Value>, ModuleGlobalHash>
       json_module_to_parsed_json_map;
 
+  // JavaScript modules whose compilation was started on a background thread
+  // ahead of their turn in FetchModuleTree, keyed by normalized specifier.
+  struct StreamedModule {
+    Global<String> source_text;
+    std::unique_ptr<ScriptCompiler::StreamedSource> streamed_source;
+  };
+  std::map<std::string, StreamedModule> streamed_modules;
+
   // Origin location used for resolving modules when referrer is null.
   std::string origin;
 };
@@ -1085,6 +1095,59 @@ MaybeLocal<Module> ResolveModuleCallback(Local<Context> context,
   return module_it->second.Get(isolate);
 }
 
+MaybeLocal<String> ReadModuleSource(Isolate* isolate,
+                                    const std::string& file_name,
+                                    bool should_throw) {
+  MaybeLocal<String> source_text =
+      Shell::ReadFile(isolate, file_name.c_str(), false);
+  if (source_text.IsEmpty() && Shell::options.fuzzy_module_file_extensions) {
+    std::string fallback_file_name = file_name + ".js";
+    source_text = Shell::ReadFile(isolate, fallback_file_name.c_str(), false);
+    if (source_text.IsEmpty()) {
+      fallback_file_name = file_name + ".mjs";
+      source_text =
+          Shell::ReadFile(isolate, fallback_file_name.c_str(), should_throw);
+    }
+  }
+  return source_text;
+}
+
+// Starts streaming compilation of all not yet loaded JavaScript modules in
+// |requests| at once, so that they are parsed and compiled in parallel on
+// background threads, and waits for them to finish. FetchModuleTree then
+// only has to finalize them on the main thread.
+void StreamModuleRequests(
+    Isolate* isolate, ModuleEmbedderData* module_data,
+    const std::vector<std::pair<std::string, ModuleType>>& requests) {
+  DCHECK(Shell::options.streaming_compile);
+  bool started_streaming = false;
+  for (const auto& request : requests) {
+    if (request.second != ModuleType::kJavaScript) continue;
+    if (module_data->module_map.count(request) ||
+        module_data->streamed_modules.count(request.first)) {
+      continue;
+    }
+    Local<String> source_text;
+    // Modules that can't be read are reported by FetchModuleTree.
+    if (!ReadModuleSource(isolate, request.first, false)
+             .ToLocal(&source_text)) {
+      continue;
+    }
+    ModuleEmbedderData::StreamedModule& streamed =
+        module_data->streamed_modules[request.first];
+    streamed.source_text.Reset(isolate, source_text);
+    streamed.streamed_source =
+        std::make_unique<ScriptCompiler::StreamedSource>(
+            std::make_unique<DummySourceStream>(source_text),
+            ScriptCompiler::StreamedSource::UTF8);
+    Shell::PostBlockingBackgroundTask(std::make_unique<StreamingCompileTask>(
+        isolate, streamed.streamed_source.get(), v8::ScriptType::kModule));
+    started_streaming = true;
+  }
+  // Pump the loop until all streaming tasks complete.
+  if (started_streaming) Shell::CompleteMessageLoop(isolate);
+}
+
 }  // anonymous namespace
 
 MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
@@ -1093,18 +1156,21 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
                                           ModuleType module_type) {
   DCHECK(IsAbsolutePath(file_name));
   Isolate* isolate = context->GetIsolate();
-  MaybeLocal<String> source_text = ReadFile(isolate, file_name.c_str(), false);
-  if (source_text.IsEmpty() && options.fuzzy_module_file_extensions) {
-    std::string fallback_file_name = file_name + ".js";
-    source_text = ReadFile(isolate, fallback_file_name.c_str(), false);
-    if (source_text.IsEmpty()) {
-      fallback_file_name = file_name + ".mjs";
-      source_text = ReadFile(isolate, fallback_file_name.c_str());
-    }
-  }
-
   std::shared_ptr<ModuleEmbedderData> module_data =
       GetModuleDataFromContext(context);
+
+  MaybeLocal<String> source_text;
+  std::unique_ptr<ScriptCompiler::StreamedSource> streamed_source;
+  auto streamed_it = module_data->streamed_modules.find(file_name);
+  if (streamed_it != module_data->streamed_modules.end() &&
+      module_type == ModuleType::kJavaScript) {
+    source_text = streamed_it->second.source_text.Get(isolate);
+    streamed_source = std::move(streamed_it->second.streamed_source);
+    module_data->streamed_modules.erase(streamed_it);
+  } else {
+    source_text = ReadModuleSource(isolate, file_name, true);
+  }
+
   if (source_text.IsEmpty()) {
     std::string msg = "d8: Error reading  module from " + file_name;
     if (!referrer.IsEmpty()) {
@@ -1125,12 +1191,13 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
 
   Local<Module> module;
   if (module_type == ModuleType::kJavaScript) {
-    ScriptCompiler::Source source(source_text.ToLocalChecked(), origin);
-    if (!CompileString<Module>(isolate, context, source_text.ToLocalChecked(),
-                               origin)
-             .ToLocal(&module)) {
-      return MaybeLocal<Module>();
-    }
+    MaybeLocal<Module> maybe_module =
+        streamed_source
+            ? CompileStreamed<Module>(context, streamed_source.get(),
+                                      source_text.ToLocalChecked(), origin)
+            : CompileString<Module>(isolate, context,
+                                    source_text.ToLocalChecked(), origin);
+    if (!maybe_module.ToLocal(&module)) return MaybeLocal<Module>();
   } else if (module_type == ModuleType::kJSON) {
     Local<Value> parsed_json;
     if (!v8::JSON::Parse(context, source_text.ToLocalChecked())
@@ -1165,6 +1232,7 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
   std::string dir_name = DirName(file_name);
 
   Local<FixedArray> module_requests = module->GetModuleRequests();
+  std::vector<std::pair<std::string, ModuleType>> requests;
   for (int i = 0, length = module_requests->Length(); i < length; ++i) {
     Local<ModuleRequest> module_request =
         module_requests->Get(context, i).As<ModuleRequest>();
@@ -1181,12 +1249,17 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
       return MaybeLocal<Module>();
     }
 
-    if (module_data->module_map.count(
-            std::make_pair(absolute_path, request_module_type))) {
-      continue;
-    }
+    requests.emplace_back(std::move(absolute_path), request_module_type);
+  }
+
+  if (options.streaming_compile) {
+    StreamModuleRequests(isolate, module_data.get(), requests);
+  }
 
-    if (FetchModuleTree(module, context, absolute_path, request_module_type)
+  for (const auto& request : requests) {
+    if (module_data->module_map.count(request)) continue;
+
+    if (FetchModuleTree(module, context, request.first, request.second)
             .IsEmpty()) {
       return MaybeLocal<Module>();
     }
@@ -5034,6 +5107,18 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       // Value is expressed in MB.
       options.max_serializer_memory = atoi(argv[i] + 24) * i::MB;
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench=", 8) == 0) {
+      options.bench_function = argv[i] + 8;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-warmup=", 15) == 0) {
+      options.bench_warmup = atoi(argv[i] + 15);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-iterations=", 19) == 0) {
+      options.bench_iterations = atoi(argv[i] + 19);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-cpu=", 12) == 0) {
+      options.bench_cpu = atoi(argv[i] + 12);
+      argv[i] = nullptr;
 #ifdef V8_FUZZILLI
     } else if (strcmp(argv[i], "--fuzzilli-enable-builtins-coverage") == 0) {
       options.fuzzilli_enable_builtins_coverage = true;
@@ -5247,11 +5332,148 @@ bool Shell::RunMainIsolate(v8::Isolate* isolate, bool keep_context_alive) {
     PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
     if (!options.isolate_sources[0].Execute(isolate)) success = false;
     if (!CompleteMessageLoop(isolate)) success = false;
+    if (success && options.bench_function) {
+      success = RunBenchmark(isolate, context);
+    }
   }
   WriteLcovData(isolate, options.lcov_file);
   return success;
 }
 
+namespace {
+
+// Pins the calling thread to a single CPU for the lifetime of the scope, to
+// keep benchmark runs from migrating between cores. Only supported on Linux.
+class CpuPinningScope {
+ public:
+  explicit CpuPinningScope(int cpu) {
+    if (cpu < 0) return;
+#if V8_OS_LINUX
+    if (cpu < CPU_SETSIZE &&
+        sched_getaffinity(0, sizeof(cpu_set_t), &previous_) == 0) {
+      cpu_set_t cpus;
+      CPU_ZERO(&cpus);
+      CPU_SET(cpu, &cpus);
+      restore_ = sched_setaffinity(0, sizeof(cpu_set_t), &cpus) == 0;
+      if (restore_) return;
+    }
+#endif  // V8_OS_LINUX
+    fprintf(stderr, "Warning: Could not pin the benchmark to CPU %d.\n", cpu);
+  }
+  ~CpuPinningScope() {
+#if V8_OS_LINUX
+    if (restore_) USE(sched_setaffinity(0, sizeof(cpu_set_t), &previous_));
+#endif  // V8_OS_LINUX
+  }
+
+ private:
+#if V8_OS_LINUX
+  bool restore_ = false;
+  cpu_set_t previous_;
+#endif  // V8_OS_LINUX
+};
+
+// Two-sided 95% quantiles of Student's t-distribution, indexed by the degrees
+// of freedom. Larger samples use the normal approximation.
+constexpr double kStudentT95[] = {
+    0,     12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262,
+    2.228, 2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093,
+    2.086, 2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045,
+    2.042};
+
+void PrintBenchmarkStatistics(const char* label, std::vector<double> samples) {
+  DCHECK(!samples.empty());
+  std::sort(samples.begin(), samples.end());
+  const size_t n = samples.size();
+  double sum = 0;
+  for (double sample : samples) sum += sample;
+  const double mean = sum / n;
+  double squares = 0;
+  for (double sample : samples) squares += (sample - mean) * (sample - mean);
+  double confidence = 0;
+  if (n > 1) {
+    const double stddev = std::sqrt(squares / (n - 1));
+    const double t =
+        n - 1 < arraysize(kStudentT95) ? kStudentT95[n - 1] : 1.960;
+    confidence = t * stddev / std::sqrt(static_cast<double>(n));
+  }
+  const double median = n % 2 == 1
+                            ? samples[n / 2]
+                            : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+  // Nearest-rank percentile.
+  const size_t p99_rank = (99 * n + 99) / 100;
+  const double p99 = samples[p99_rank - 1];
+  printf("  %-8s mean %10.3f ms +- %.3f ms (95%% CI), median %10.3f ms, "
+         "p99 %10.3f ms, min %10.3f ms, max %10.3f ms\n",
+         label, mean, confidence, median, p99, samples.front(),
+         samples.back());
+}
+
+}  // namespace
+
+int64_t Shell::CompileTimeInMicroseconds() {
+  // Lazy compilation is recorded separately from top-level and eval
+  // compilation, so these don't overlap.
+  static constexpr const char* kCompileHistograms[] = {
+      "V8.CompileMicroSeconds", "V8.CompileEvalMicroSeconds",
+      "V8.CompileLazyMicroSeconds"};
+  base::SharedMutexGuard<base::kShared> mutex_guard(&counter_mutex_);
+  int64_t total = 0;
+  for (const char* name : kCompileHistograms) {
+    auto map_entry = counter_map_->find(name);
+    if (map_entry != counter_map_->end()) {
+      total += map_entry->second->sample_total();
+    }
+  }
+  return total;
+}
+
+bool Shell::RunBenchmark(Isolate* isolate, Local<Context> context) {
+  HandleScope handle_scope(isolate);
+  i::Heap* heap = reinterpret_cast<i::Isolate*>(isolate)->heap();
+  Local<String> name =
+      String::NewFromUtf8(isolate, options.bench_function).ToLocalChecked();
+  Local<Value> value;
+  if (!context->Global()->Get(context, name).ToLocal(&value) ||
+      !value->IsFunction()) {
+    fprintf(stderr, "Benchmark function %s not found.\n",
+            options.bench_function.get());
+    return false;
+  }
+  Local<Function> function = value.As<Function>();
+  const int warmup = std::max(options.bench_warmup.get(), 0);
+  const int iterations = std::max(options.bench_iterations.get(), 1);
+
+  CpuPinningScope pinning_scope(options.bench_cpu);
+  std::vector<double> times, gc_times, compile_times;
+  for (int i = -warmup; i < iterations; ++i) {
+    HandleScope iteration_scope(isolate);
+    TryCatch try_catch(isolate);
+    const base::TimeDelta gc_time_before = heap->total_gc_time();
+    const int64_t compile_time_before = CompileTimeInMicroseconds();
+    const base::TimeTicks start = base::TimeTicks::Now();
+    if (function->Call(context, context->Global(), 0, nullptr).IsEmpty()) {
+      ReportException(isolate, &try_catch);
+      return false;
+    }
+    const base::TimeDelta time = base::TimeTicks::Now() - start;
+    if (i < 0) continue;
+    times.push_back(time.InMillisecondsF());
+    gc_times.push_back(
+        (heap->total_gc_time() - gc_time_before).InMillisecondsF());
+    compile_times.push_back(
+        (CompileTimeInMicroseconds() - compile_time_before) /
+        static_cast<double>(base::Time::kMicrosecondsPerMillisecond));
+  }
+
+  printf("Benchmark %s: %d iterations after %d warmup iterations\n",
+         options.bench_function.get(), iterations, warmup);
+  PrintBenchmarkStatistics("time", std::move(times));
+  PrintBenchmarkStatistics("gc", std::move(gc_times));
+  PrintBenchmarkStatistics("compile", std::move(compile_times));
+  return true;
+}
+
 void Shell::CollectGarbage(Isolate* isolate) {
   if (options.send_idle_notification) {
     isolate->ContextDisposedNotification();
@@ -5874,7 +6096,7 @@ int Shell::Main(int argc, char* argv[]) {
 
   Shell::counter_map_ = new CounterMap();
   if (options.dump_counters || options.dump_counters_nvp ||
-      i::TracingFlags::is_gc_stats_enabled()) {
+      options.bench_function || i::TracingFlags::is_gc_stats_enabled()) {
     create_params.counter_lookup_callback = LookupCounter;
     create_params.create_histogram_callback = CreateHistogram;
     create_params.add_histogram_sample_callback = AddHistogramSample;
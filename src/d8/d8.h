@@ -481,6 +481,11 @@ class ShellOptions {
       "noop-on-failed-access-check", false};
   DisallowReassignment<size_t> max_serializer_memory = {"max-serializer-memory",
                                                         1 * i::MB};
+  // Global function that --bench calls repeatedly once the scripts ran.
+  DisallowReassignment<const char*> bench_function = {"bench", nullptr};
+  DisallowReassignment<int> bench_warmup = {"bench-warmup", 10};
+  DisallowReassignment<int> bench_iterations = {"bench-iterations", 30};
+  DisallowReassignment<int> bench_cpu = {"bench-cpu", -1};
 };
 
 class Shell : public i::AllStatic {
@@ -762,6 +767,9 @@ class Shell : public i::AllStatic {
   static Local<String> Stringify(Isolate* isolate, Local<Value> value);
   static void RunShell(Isolate* isolate);
   static bool RunMainIsolate(Isolate* isolate, bool keep_context_alive);
+  static bool RunBenchmark(Isolate* isolate, Local<Context> context);
+  // Main thread compile time recorded by the compile histograms so far.
+  static int64_t CompileTimeInMicroseconds();
   static bool SetOptions(int argc, char* argv[]);
 
   static void NodeTypeCallback(const v8::FunctionCallbackInfo<v8::Value>& info);
@@ -14,12 +14,24 @@ namespace internal {
 
 template <typename Char>
 bool DateParser::Parse(Isolate* isolate, base::Vector<Char> str, double* out) {
-  InputReader<Char> in(str);
-  DateStringTokenizer<Char> scanner(&in);
   TimeZoneComposer tz;
   TimeComposer time;
   DayComposer day;
 
+  // Most date strings are the output of toISOString or toUTCString, which
+  // can be parsed without going through the tokenizer.
+  bool legacy_format;
+  if (ParseFixedFormatDateTime(str, &day, &time, &tz, &legacy_format)) {
+    bool success = day.Write(out) && time.Write(out) && tz.Write(out);
+    if (legacy_format && success) {
+      isolate->CountUsage(v8::Isolate::kLegacyDateParser);
+    }
+    return success;
+  }
+
+  InputReader<Char> in(str);
+  DateStringTokenizer<Char> scanner(&in);
+
   // Specification:
   // Accept ES5 ISO 8601 date-time-strings or legacy dates compatible
   // with Safari.
@@ -178,6 +190,106 @@ bool DateParser::Parse(Isolate* isolate, base::Vector<Char> str, double* out) {
   return success;
 }
 
+template <typename Char>
+bool DateParser::ReadFixedDigits(const Char* str, int length, int* value) {
+  int n = 0;
+  for (int i = 0; i < length; i++) {
+    if (!IsDecimalDigit(str[i])) return false;
+    n = n * 10 + (str[i] - '0');
+  }
+  *value = n;
+  return true;
+}
+
+template <typename Char>
+bool DateParser::ParseFixedFormatDateTime(base::Vector<Char> str,
+                                          DayComposer* day, TimeComposer* time,
+                                          TimeZoneComposer* tz, bool* legacy) {
+  DCHECK(day->IsEmpty());
+  DCHECK(time->IsEmpty());
+  DCHECK(tz->IsEmpty());
+  const Char* s = str.begin();
+  int length = str.length();
+  int year, month, date, hour, minute, second;
+
+  // yyyy-MM-ddTHH:mm:ss[.sss][Z]
+  if (length >= 19 && s[4] == '-' && s[7] == '-' && s[10] == 'T' &&
+      s[13] == ':' && s[16] == ':') {
+    int millisecond = 0;
+    bool has_millisecond = length >= 23 && s[19] == '.';
+    int end = has_millisecond ? 23 : 19;
+    bool is_utc = length == end + 1 && s[end] == 'Z';
+    if (length != end && !is_utc) return false;
+    if (!ReadFixedDigits(s, 4, &year) || !ReadFixedDigits(s + 5, 2, &month) ||
+        !ReadFixedDigits(s + 8, 2, &date) ||
+        !ReadFixedDigits(s + 11, 2, &hour) ||
+        !ReadFixedDigits(s + 14, 2, &minute) ||
+        !ReadFixedDigits(s + 17, 2, &second) ||
+        (has_millisecond && !ReadFixedDigits(s + 20, 3, &millisecond))) {
+      return false;
+    }
+    // Leave out-of-range values, including the 24th hour, to the general
+    // parser.
+    if (!DayComposer::IsMonth(month) || !DayComposer::IsDay(date) ||
+        !TimeComposer::IsHour(hour) || !TimeComposer::IsMinute(minute) ||
+        !TimeComposer::IsSecond(second)) {
+      return false;
+    }
+    day->Add(year);
+    day->Add(month);
+    day->Add(date);
+    time->Add(hour);
+    time->Add(minute);
+    time->Add(second);
+    if (has_millisecond) time->Add(millisecond);
+    if (is_utc) tz->Set(0);
+    day->set_iso_date();
+    *legacy = false;
+    return true;
+  }
+
+  // Www, dd Mmm yyyy HH:mm:ss GMT
+  static const char kWeekdays[] = "SunMonTueWedThuFriSat";
+  static const char kMonths[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  if (length != 29 || s[3] != ',' || s[4] != ' ' || s[7] != ' ' ||
+      s[11] != ' ' || s[16] != ' ' || s[19] != ':' || s[22] != ':' ||
+      s[25] != ' ' || s[26] != 'G' || s[27] != 'M' || s[28] != 'T') {
+    return false;
+  }
+  auto find_name = [](const Char* name, const char* names, int count) {
+    for (int i = 0; i < count; i++) {
+      const char* candidate = names + 3 * i;
+      if (name[0] == candidate[0] && name[1] == candidate[1] &&
+          name[2] == candidate[2]) {
+        return i;
+      }
+    }
+    return -1;
+  };
+  if (find_name(s, kWeekdays, 7) < 0) return false;
+  month = find_name(s + 8, kMonths, 12) + 1;
+  if (month == 0) return false;
+  if (!ReadFixedDigits(s + 5, 2, &date) || !ReadFixedDigits(s + 12, 4, &year) ||
+      !ReadFixedDigits(s + 17, 2, &hour) ||
+      !ReadFixedDigits(s + 20, 2, &minute) ||
+      !ReadFixedDigits(s + 23, 2, &second)) {
+    return false;
+  }
+  if (!DayComposer::IsDay(date) || !TimeComposer::IsHour(hour) ||
+      !TimeComposer::IsMinute(minute) || !TimeComposer::IsSecond(second)) {
+    return false;
+  }
+  day->Add(date);
+  day->SetNamedMonth(month);
+  day->Add(year);
+  time->Add(hour);
+  time->Add(minute);
+  time->AddFinal(second);
+  tz->Set(0);
+  *legacy = true;
+  return true;
+}
+
 template <typename CharType>
 DateParser::DateToken DateParser::DateStringTokenizer<CharType>::Scan() {
   int pre_pos = in_->position();
@@ -360,6 +360,23 @@ class DateParser : public AllStatic {
   static DateParser::DateToken ParseES5DateTime(
       DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
       TimeZoneComposer* tz);
+
+  // Tries to parse the fixed-width formats produced by Date.prototype.
+  // toISOString ("yyyy-MM-ddTHH:mm:ss.sssZ", optionally without the
+  // milliseconds or the "Z") and Date.prototype.toUTCString
+  // ("Www, dd Mmm yyyy HH:mm:ss GMT") in a single pass, without
+  // tokenizing. If successful, the composers are set up exactly as the
+  // general parser would have left them, and 'legacy' tells whether the
+  // input was a legacy date. Returns false for any other input.
+  template <typename Char>
+  static bool ParseFixedFormatDateTime(base::Vector<Char> str,
+                                       DayComposer* day, TimeComposer* time,
+                                       TimeZoneComposer* tz, bool* legacy);
+
+  // Reads 'length' ASCII digits starting at 'str' into 'value'. Returns
+  // false if any of them is not a digit.
+  template <typename Char>
+  static inline bool ReadFixedDigits(const Char* str, int length, int* value);
 };
 
 }  // namespace internal
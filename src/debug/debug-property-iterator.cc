@@ -6,7 +6,9 @@
 
 #include "src/api/api-inl.h"
 #include "src/base/flags.h"
+#include "src/objects/elements.h"
 #include "src/objects/js-array-buffer-inl.h"
+#include "src/objects/js-objects-inl.h"
 #include "src/objects/keys.h"
 #include "src/objects/property-descriptor.h"
 #include "src/objects/property-details.h"
@@ -14,6 +16,18 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+// Collecting the keys of large arrays converts all their indices to strings,
+// although the inspector only needs the first few of them for a preview. Fast
+// elements are iterated in place instead.
+bool CanIterateElementsLazily(Handle<JSReceiver> receiver) {
+  if (!receiver->IsJSObject()) return false;
+  Map map = receiver->map();
+  return IsFastElementsKind(map->elements_kind()) &&
+         !map->has_indexed_interceptor() && !map->is_access_check_needed();
+}
+}  // namespace
+
 std::unique_ptr<DebugPropertyIterator> DebugPropertyIterator::Create(
     Isolate* isolate, Handle<JSReceiver> receiver, bool skip_indices) {
   // Can't use std::make_unique as Ctor is private.
@@ -48,6 +62,7 @@ bool DebugPropertyIterator::Done() const { return is_done_; }
 void DebugPropertyIterator::AdvanceToPrototype() {
   stage_ = kExoticIndices;
   is_own_ = false;
+  elements_iterated_lazily_ = false;
   if (!prototype_iterator_.HasAccess()) is_done_ = true;
   prototype_iterator_.AdvanceIgnoringProxies();
   if (prototype_iterator_.IsAtEnd()) is_done_ = true;
@@ -56,6 +71,9 @@ void DebugPropertyIterator::AdvanceToPrototype() {
 bool DebugPropertyIterator::AdvanceInternal() {
   ++current_key_index_;
   calculated_native_accessor_flags_ = false;
+  if (stage_ == kExoticIndices && elements_iterated_lazily_) {
+    SkipMissingElements();
+  }
   while (should_move_to_next_stage()) {
     switch (stage_) {
       case kExoticIndices:
@@ -186,10 +204,16 @@ bool DebugPropertyIterator::FillKeysForCurrentPrototypeAndStage() {
   Handle<JSReceiver> receiver =
       PrototypeIterator::GetCurrent<JSReceiver>(prototype_iterator_);
   if (stage_ == kExoticIndices) {
-    if (skip_indices_ || !receiver->IsJSTypedArray()) return true;
-    Handle<JSTypedArray> typed_array = Handle<JSTypedArray>::cast(receiver);
-    current_keys_length_ =
-        typed_array->WasDetached() ? 0 : typed_array->GetLength();
+    if (skip_indices_) return true;
+    if (receiver->IsJSTypedArray()) {
+      Handle<JSTypedArray> typed_array = Handle<JSTypedArray>::cast(receiver);
+      current_keys_length_ =
+          typed_array->WasDetached() ? 0 : typed_array->GetLength();
+    } else if (CanIterateElementsLazily(receiver)) {
+      elements_iterated_lazily_ = true;
+      current_keys_length_ = JSObject::cast(*receiver)->elements()->length();
+      SkipMissingElements();
+    }
     return true;
   }
   PropertyFilter filter =
@@ -197,7 +221,8 @@ bool DebugPropertyIterator::FillKeysForCurrentPrototypeAndStage() {
   if (KeyAccumulator::GetKeys(isolate_, receiver, KeyCollectionMode::kOwnOnly,
                               filter, GetKeysConversion::kConvertToString,
                               false,
-                              skip_indices_ || receiver->IsJSTypedArray())
+                              skip_indices_ || receiver->IsJSTypedArray() ||
+                                  elements_iterated_lazily_)
           .ToHandle(&current_keys_)) {
     current_keys_length_ = current_keys_->length();
     return true;
@@ -205,6 +230,23 @@ bool DebugPropertyIterator::FillKeysForCurrentPrototypeAndStage() {
   return false;
 }
 
+void DebugPropertyIterator::SkipMissingElements() {
+  DCHECK(elements_iterated_lazily_);
+  // Getters that ran during the iteration may have changed the elements, so
+  // the elements accessor is looked up again, and holes and indices past the
+  // end are skipped.
+  JSObject object =
+      *PrototypeIterator::GetCurrent<JSObject>(prototype_iterator_);
+  ElementsAccessor* accessor = object->GetElementsAccessor();
+  FixedArrayBase elements = object->elements();
+  while (current_key_index_ < current_keys_length_ &&
+         !accessor->HasElement(object,
+                               static_cast<uint32_t>(current_key_index_),
+                               elements)) {
+    ++current_key_index_;
+  }
+}
+
 bool DebugPropertyIterator::should_move_to_next_stage() const {
   return !is_done_ && current_key_index_ >= current_keys_length_;
 }
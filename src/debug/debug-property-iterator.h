@@ -52,6 +52,7 @@ class DebugPropertyIterator final : public debug::PropertyIterator {
   Handle<Name> raw_name() const;
   void AdvanceToPrototype();
   V8_WARN_UNUSED_RESULT bool AdvanceInternal();
+  void SkipMissingElements();
 
   Isolate* isolate_;
   PrototypeIterator prototype_iterator_;
@@ -65,6 +66,9 @@ class DebugPropertyIterator final : public debug::PropertyIterator {
   size_t current_key_index_;
   Handle<FixedArray> current_keys_;
   size_t current_keys_length_;
+  // Whether the fast elements of the current prototype are iterated as
+  // indices of the kExoticIndices stage, instead of being collected as keys.
+  bool elements_iterated_lazily_ = false;
 
   bool calculated_native_accessor_flags_ = false;
   int native_accessor_flags_ = 0;
@@ -1550,14 +1550,12 @@ class DiscardBaselineCodeVisitor : public ThreadVisitor {
  public:
   explicit DiscardBaselineCodeVisitor(SharedFunctionInfo shared)
       : shared_(shared) {}
-  DiscardBaselineCodeVisitor() : shared_(SharedFunctionInfo()) {}
 
   void VisitThread(Isolate* isolate, ThreadLocalTop* top) override {
     DisallowGarbageCollection diallow_gc;
-    bool deopt_all = shared_ == SharedFunctionInfo();
     for (JavaScriptStackFrameIterator it(isolate, top); !it.done();
          it.Advance()) {
-      if (!deopt_all && it.frame()->function()->shared() != shared_) continue;
+      if (it.frame()->function()->shared() != shared_) continue;
       if (it.frame()->type() == StackFrame::BASELINE) {
         BaselineFrame* frame = BaselineFrame::cast(it.frame());
         int bytecode_offset = frame->GetBytecodeOffset();
@@ -1623,29 +1621,6 @@ void Debug::DiscardBaselineCode(SharedFunctionInfo shared) {
   }
 }
 
-void Debug::DiscardAllBaselineCode() {
-  RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
-  DiscardBaselineCodeVisitor visitor;
-  visitor.VisitThread(isolate_, isolate_->thread_local_top());
-  HeapObjectIterator iterator(isolate_->heap());
-  auto trampoline = BUILTIN_CODE(isolate_, InterpreterEntryTrampoline);
-  isolate_->thread_manager()->IterateArchivedThreads(&visitor);
-  for (HeapObject obj = iterator.Next(); !obj.is_null();
-       obj = iterator.Next()) {
-    if (obj.IsJSFunction()) {
-      JSFunction fun = JSFunction::cast(obj);
-      if (fun->ActiveTierIsBaseline()) {
-        fun->set_code(*trampoline);
-      }
-    } else if (obj.IsSharedFunctionInfo()) {
-      SharedFunctionInfo shared = SharedFunctionInfo::cast(obj);
-      if (shared->HasBaselineCode()) {
-        shared->FlushBaselineCode();
-      }
-    }
-  }
-}
-
 void Debug::DeoptimizeFunction(Handle<SharedFunctionInfo> shared) {
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
 
@@ -1670,9 +1645,11 @@ void Debug::PrepareFunctionForDebugExecution(
   // Have to discard baseline code before installing debug bytecode, since the
   // bytecode array field on the baseline code object is immutable.
   if (debug_info->CanBreakAtEntry()) {
-    // Deopt everything in case the function is inlined anywhere.
+    // Deopt everything in case the function is inlined anywhere. Baseline code
+    // never inlines and calls through the callee's code, which is redirected
+    // to the debug break trampoline below, so other functions keep theirs.
     Deoptimizer::DeoptimizeAll(isolate_);
-    DiscardAllBaselineCode();
+    if (shared->HasBaselineCode()) DiscardBaselineCode(*shared);
   } else {
     DeoptimizeFunction(shared);
   }
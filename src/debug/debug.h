@@ -344,7 +344,6 @@ class V8_EXPORT_PRIVATE Debug {
   void ClearBreakOnNextFunctionCall();
 
   void DiscardBaselineCode(SharedFunctionInfo shared);
-  void DiscardAllBaselineCode();
 
   void DeoptimizeFunction(Handle<SharedFunctionInfo> shared);
   void PrepareFunctionForDebugExecution(Handle<SharedFunctionInfo> shared);
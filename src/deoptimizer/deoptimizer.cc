@@ -24,6 +24,7 @@
 #include "src/objects/js-function-inl.h"
 #include "src/objects/oddball.h"
 #include "src/snapshot/embedded/embedded-data.h"
+#include "src/tracing/trace-event.h"
 #include "src/utils/utils.h"
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -743,6 +744,9 @@ void Deoptimizer::DoComputeOutputFrames() {
 #if V8_TARGET_ARCH_STORES_RETURN_ADDRESS_ON_STACK
   DCHECK_EQ(0, isolate()->isolate_data()->stack_is_iterable());
 #endif
+  TRACE_EVENT1(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.DeoptimizeComputeOutputFrames", "kind",
+               ToString(deopt_kind_));
   base::ElapsedTimer timer;
 
   // Determine basic deoptimization information.  The optimized frame is
@@ -636,6 +636,24 @@ Object TranslatedValue::GetRawValue() const {
   return ReadOnlyRoots(isolate()).arguments_marker();
 }
 
+bool TranslatedValue::IsUnmaterializedSmi() const {
+  if (materialization_state() != kUninitialized) return false;
+  switch (kind()) {
+    case kTagged:
+      // Don't go through GetRawValue(), which may trim sliced strings.
+      return raw_literal().IsSmi();
+    case kInt32:
+    case kInt64:
+    case kUInt32:
+    case kFloat:
+    case kDouble:
+    case kHoleyDouble:
+      return GetRawValue().IsSmi();
+    default:
+      return false;
+  }
+}
+
 void TranslatedValue::set_initialized_storage(Handle<HeapObject> storage) {
   DCHECK_EQ(kUninitialized, materialization_state());
   storage_ = storage;
@@ -1982,7 +2000,7 @@ void TranslatedState::EnsureCapturedObjectAllocatedAt(
 
       // Make sure all the remaining children (after the map) are allocated.
       return EnsureChildrenAllocated(slot->GetChildrenCount() - 1, frame,
-                                     &value_index, worklist);
+                                     &value_index, worklist, slot);
     }
 
     case SLOPPY_ARGUMENTS_ELEMENTS_TYPE: {
@@ -1995,7 +2013,7 @@ void TranslatedState::EnsureCapturedObjectAllocatedAt(
 
       // Make sure all the remaining children (after the map) are allocated.
       return EnsureChildrenAllocated(slot->GetChildrenCount() - 1, frame,
-                                     &value_index, worklist);
+                                     &value_index, worklist, slot);
     }
 
     case PROPERTY_ARRAY_TYPE: {
@@ -2009,7 +2027,7 @@ void TranslatedState::EnsureCapturedObjectAllocatedAt(
 
       // Make sure all the remaining children (after the map) are allocated.
       return EnsureChildrenAllocated(slot->GetChildrenCount() - 1, frame,
-                                     &value_index, worklist);
+                                     &value_index, worklist, slot);
     }
 
     default:
@@ -2023,7 +2041,7 @@ void TranslatedState::EnsureCapturedObjectAllocatedAt(
         // mutable heap numbers at the right places.
         EnsurePropertiesAllocatedAndMarked(properties_slot, map);
         EnsureChildrenAllocated(properties_slot->GetChildrenCount(), frame,
-                                &value_index, worklist);
+                                &value_index, worklist, properties_slot);
       } else {
         CHECK_EQ(properties_slot->kind(), TranslatedValue::kTagged);
       }
@@ -2050,7 +2068,7 @@ void TranslatedState::EnsureCapturedObjectAllocatedAt(
       // Make sure all the remaining children (after the map, properties store,
       // and possibly elements store) are allocated.
       return EnsureChildrenAllocated(remaining_children_count, frame,
-                                     &value_index, worklist);
+                                     &value_index, worklist, slot);
   }
   UNREACHABLE();
 }
@@ -2072,7 +2090,13 @@ void TranslatedValue::ReplaceElementsArrayWithCopy() {
 
 void TranslatedState::EnsureChildrenAllocated(int count, TranslatedFrame* frame,
                                               int* value_index,
-                                              std::stack<int>* worklist) {
+                                              std::stack<int>* worklist,
+                                              TranslatedValue* parent) {
+  Handle<HeapObject> parent_storage = parent->storage();
+  const bool has_markers = parent_storage->IsByteArray();
+  const int first_field_index = parent->GetChildrenCount() - count;
+  DCHECK_GE(first_field_index, 0);
+
   // Ensure all children are allocated.
   for (int i = 0; i < count; i++) {
     // If the field is an object that has not been allocated yet, queue it
@@ -2088,8 +2112,18 @@ void TranslatedState::EnsureChildrenAllocated(int count, TranslatedFrame* frame,
       }
     } else {
       // Make sure the simple values (heap numbers, etc.) are properly
-      // initialized.
-      child_slot->GetValue();
+      // initialized. Smi values stored in tagged fields are written as Smis
+      // when the parent is initialized, so don't allocate a box for them.
+      // Only the map, length or properties live in the first two fields,
+      // which never hold markers.
+      int field_index = first_field_index + i;
+      bool needs_heap_object =
+          has_markers && field_index > 1 &&
+          parent_storage->ReadField<uint8_t>(field_index * kTaggedSize) ==
+              kStoreHeapObject;
+      if (needs_heap_object || !child_slot->IsUnmaterializedSmi()) {
+        child_slot->GetValue();
+      }
     }
     SkipSlots(1, frame, value_index);
   }
@@ -2164,6 +2198,15 @@ void TranslatedState::EnsureJSObjectAllocated(TranslatedValue* slot,
   slot->set_storage(object_storage);
 }
 
+Handle<Object> TranslatedState::GetTaggedFieldValue(TranslatedValue* slot) {
+  // Smis were left unmaterialized by EnsureChildrenAllocated; reading them
+  // doesn't allocate.
+  if (slot->IsUnmaterializedSmi()) {
+    return handle(slot->GetRawValue(), isolate());
+  }
+  return slot->GetValue();
+}
+
 TranslatedValue* TranslatedState::GetResolvedSlot(TranslatedFrame* frame,
                                                   int value_index) {
   TranslatedValue* slot = frame->ValueAt(value_index);
@@ -2240,7 +2283,7 @@ void TranslatedState::InitializeJSObjectAt(
       WRITE_BARRIER(*object_storage, offset, *field_value);
     } else {
       CHECK_EQ(kStoreTagged, marker);
-      Handle<Object> field_value = slot->GetValue();
+      Handle<Object> field_value = GetTaggedFieldValue(slot);
       DCHECK_IMPLIES(field_value->IsHeapNumber(),
                      !IsSmiDouble(field_value->Number()));
       WRITE_FIELD(*object_storage, offset, *field_value);
@@ -2291,7 +2334,7 @@ void TranslatedState::InitializeObjectWithTaggedFieldsAt(
       field_value = slot->storage();
     } else {
       CHECK(marker == kStoreTagged || i == 1);
-      field_value = slot->GetValue();
+      field_value = GetTaggedFieldValue(slot);
       DCHECK_IMPLIES(field_value->IsHeapNumber(),
                      !IsSmiDouble(field_value->Number()));
     }
@@ -104,6 +104,9 @@ class TranslatedValue {
   }
   void Handlify();
   int GetChildrenCount() const;
+  // Whether this not yet materialized value can be represented as a Smi, in
+  // which case it doesn't need a heap number when stored in a tagged field.
+  bool IsUnmaterializedSmi() const;
 
   static TranslatedValue NewDeferredObject(TranslatedState* container,
                                            int length, int object_index);
@@ -441,8 +444,11 @@ class TranslatedState {
   void EnsureJSObjectAllocated(TranslatedValue* slot, Handle<Map> map);
   void EnsurePropertiesAllocatedAndMarked(TranslatedValue* properties_slot,
                                           Handle<Map> map);
+  // Allocates the |count| last children of |parent|, whose storage holds the
+  // field markers set up by EnsureJSObjectAllocated and friends.
   void EnsureChildrenAllocated(int count, TranslatedFrame* frame,
-                               int* value_index, std::stack<int>* worklist);
+                               int* value_index, std::stack<int>* worklist,
+                               TranslatedValue* parent);
   void EnsureCapturedObjectAllocatedAt(int object_index,
                                        std::stack<int>* worklist);
   Handle<HeapObject> InitializeObjectAt(TranslatedValue* slot);
@@ -462,6 +468,7 @@ class TranslatedState {
   TranslatedValue* ResolveCapturedObject(TranslatedValue* slot);
   TranslatedValue* GetValueByObjectIndex(int object_index);
   Handle<Object> GetValueAndAdvance(TranslatedFrame* frame, int* value_index);
+  Handle<Object> GetTaggedFieldValue(TranslatedValue* slot);
   TranslatedValue* GetResolvedSlot(TranslatedFrame* frame, int value_index);
   TranslatedValue* GetResolvedSlotAndAdvance(TranslatedFrame* frame,
                                              int* value_index);
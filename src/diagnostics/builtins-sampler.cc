@@ -0,0 +1,189 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/diagnostics/builtins-sampler.h"
+
+#include <algorithm>
+#include <ostream>
+
+#include "include/v8-unwinder.h"
+#include "src/base/memory.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+#include "src/execution/frame-constants.h"
+#include "src/execution/isolate.h"
+#include "src/execution/pointer-authentication.h"
+#include "src/snapshot/embedded/embedded-data.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Same as the maximum normalized count of tools/builtins-pgo/get_hints.py.
+constexpr uint64_t kMaxNormalizedCount = 10000;
+// Bounds the walk through frames of recursive builtins.
+constexpr int kMaxFramesToWalk = 16;
+
+bool CanBeReordered(Builtin builtin) {
+  Builtins::Kind kind = Builtins::KindOf(builtin);
+  return kind != Builtins::ASM && kind != Builtins::CPP;
+}
+
+}  // namespace
+
+class BuiltinsSampler::SamplingThread final : public base::Thread {
+ public:
+  static const int kSamplingThreadStackSize = 64 * KB;
+
+  SamplingThread(BuiltinsSampler* sampler, int interval_microseconds)
+      : base::Thread(base::Thread::Options("v8:BuiltinsSampler",
+                                           kSamplingThreadStackSize)),
+        sampler_(sampler),
+        interval_microseconds_(interval_microseconds) {}
+
+  void Run() override {
+    while (sampler_->IsActive()) {
+      sampler_->DoSample();
+      base::OS::Sleep(
+          base::TimeDelta::FromMicroseconds(interval_microseconds_));
+    }
+  }
+
+ private:
+  BuiltinsSampler* const sampler_;
+  const int interval_microseconds_;
+};
+
+BuiltinsSampler::BuiltinsSampler(Isolate* isolate, int interval_microseconds)
+    : sampler::Sampler(reinterpret_cast<v8::Isolate*>(isolate)),
+      isolate_(isolate),
+      interval_microseconds_(interval_microseconds),
+      call_edges_(new CallEdge[kCallEdgeTableSize]) {
+  DCHECK_GT(interval_microseconds, 0);
+}
+
+BuiltinsSampler::~BuiltinsSampler() {
+  if (IsActive()) StopSampling();
+}
+
+void BuiltinsSampler::StartSampling() {
+  DCHECK(!IsActive());
+  Start();
+  sampling_thread_ =
+      std::make_unique<SamplingThread>(this, interval_microseconds_);
+  CHECK(sampling_thread_->StartSynchronously());
+}
+
+void BuiltinsSampler::StopSampling() {
+  DCHECK(IsActive());
+  Stop();
+  sampling_thread_->Join();
+  sampling_thread_.reset();
+}
+
+BuiltinsSampler::CallEdge* BuiltinsSampler::FindCallEdge(uint32_t key,
+                                                         bool insert) const {
+  uint32_t index = (key * 2654435761u) % kCallEdgeTableSize;
+  for (int i = 0; i < kCallEdgeTableSize; ++i) {
+    CallEdge* edge = &call_edges_[index];
+    uint32_t current = edge->key.load(std::memory_order_relaxed);
+    if (current == key) return edge;
+    if (current == 0) {
+      if (!insert) return nullptr;
+      if (edge->key.compare_exchange_strong(current, key,
+                                            std::memory_order_relaxed) ||
+          current == key) {
+        return edge;
+      }
+    }
+    index = (index + 1) % kCallEdgeTableSize;
+  }
+  return nullptr;
+}
+
+void BuiltinsSampler::SampleStack(const v8::RegisterState& state) {
+#if !defined(USE_SIMULATOR)
+  // The lookups are binary searches over the embedded blob's builtin table,
+  // which neither allocate nor take locks.
+  Builtin callee = OffHeapInstructionStream::TryLookupCode(
+      isolate_, reinterpret_cast<Address>(state.pc));
+  if (!Builtins::IsBuiltinId(callee)) return;
+  builtin_samples_[Builtins::ToInt(callee)].fetch_add(
+      1, std::memory_order_relaxed);
+
+  // Only frames between the sampled sp and the entry into JS are read.
+  Address sp = reinterpret_cast<Address>(state.sp);
+  Address fp = reinterpret_cast<Address>(state.fp);
+  Address js_entry_sp = isolate_->js_entry_sp();
+  for (int i = 0; i < kMaxFramesToWalk; ++i) {
+    if (fp < sp || fp + CommonFrameConstants::kCallerSPOffset > js_entry_sp ||
+        !IsAligned(fp, kSystemPointerSize)) {
+      return;
+    }
+    Address return_address = PointerAuthentication::StripPAC(
+        base::Memory<Address>(fp + CommonFrameConstants::kCallerPCOffset));
+    Builtin caller =
+        OffHeapInstructionStream::TryLookupCode(isolate_, return_address);
+    if (!Builtins::IsBuiltinId(caller)) return;
+    if (caller != callee) {
+      CallEdge* edge = FindCallEdge(CallEdgeKey(caller, callee), true);
+      if (edge) edge->count.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    sp = fp;
+    fp = base::Memory<Address>(fp + CommonFrameConstants::kCallerFPOffset);
+  }
+#endif  // !defined(USE_SIMULATOR)
+}
+
+uint32_t BuiltinsSampler::CallSamples(Builtin caller, Builtin callee) const {
+  CallEdge* edge = FindCallEdge(CallEdgeKey(caller, callee), false);
+  return edge ? edge->count.load(std::memory_order_relaxed) : 0;
+}
+
+void BuiltinsSampler::Log(std::ostream& os) const {
+  uint32_t max_samples = 0;
+  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+       ++builtin) {
+    if (!CanBeReordered(builtin)) continue;
+    max_samples = std::max(max_samples, BuiltinSamples(builtin));
+  }
+  if (max_samples == 0) return;
+  auto normalize = [=](uint32_t samples) {
+    return samples * kMaxNormalizedCount / max_samples;
+  };
+
+  // mksnapshot needs the builtin counts before the calls.
+  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+       ++builtin) {
+    if (!CanBeReordered(builtin)) continue;
+    uint32_t samples = BuiltinSamples(builtin);
+    if (samples == 0) continue;
+    os << "builtin_count," << Builtins::name(builtin) << ','
+       << normalize(samples) << '\n';
+  }
+  for (int i = 0; i < kCallEdgeTableSize; ++i) {
+    uint32_t key = call_edges_[i].key.load(std::memory_order_relaxed);
+    uint32_t samples = call_edges_[i].count.load(std::memory_order_relaxed);
+    if (key == 0 || samples == 0) continue;
+    Builtin caller = Builtins::FromInt((key - 1) >> 16);
+    Builtin callee = Builtins::FromInt((key - 1) & 0xFFFF);
+    if (!CanBeReordered(caller) || !CanBeReordered(callee)) continue;
+    os << "call_count," << Builtins::name(caller) << ','
+       << Builtins::name(callee) << ',' << normalize(samples) << '\n';
+  }
+}
+
+void BuiltinsSampler::ResetCounts() {
+  for (std::atomic<uint32_t>& samples : builtin_samples_) {
+    samples.store(0, std::memory_order_relaxed);
+  }
+  for (int i = 0; i < kCallEdgeTableSize; ++i) {
+    call_edges_[i].count.store(0, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
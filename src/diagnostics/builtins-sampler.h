@@ -0,0 +1,93 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DIAGNOSTICS_BUILTINS_SAMPLER_H_
+#define V8_DIAGNOSTICS_BUILTINS_SAMPLER_H_
+
+#include <atomic>
+#include <iosfwd>
+#include <memory>
+
+#include "src/builtins/builtins.h"
+#include "src/libsampler/sampler.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+
+// Periodically interrupts the isolate's thread and attributes each sample to
+// the embedded builtin it was executing, and to the builtin that called it.
+// Unlike the basic block counters of v8_enable_builtins_profiling, this needs
+// no instrumented build, so profiles can be collected from release binaries
+// running realistic workloads (see --builtins-sampling-profile-output).
+//
+// Callers are found by following the frame pointer chain, as long as the
+// return addresses point into builtins. When a sample hits a builtin before
+// it set up its frame, the call is attributed to its caller's caller.
+//
+// Samples are only taken on platforms where libsampler can interrupt the
+// thread, and not on simulator builds.
+class BuiltinsSampler final : public sampler::Sampler {
+ public:
+  BuiltinsSampler(Isolate* isolate, int interval_microseconds);
+  ~BuiltinsSampler() override;
+  BuiltinsSampler(const BuiltinsSampler&) = delete;
+  BuiltinsSampler& operator=(const BuiltinsSampler&) = delete;
+
+  // Must be called on the isolate's thread, which is the one being sampled.
+  void StartSampling();
+  void StopSampling();
+
+  // Called from the signal handler; only does address lookups and reads the
+  // stack between the sampled sp and the isolate's JS entry sp.
+  void SampleStack(const v8::RegisterState& state) override;
+
+  // Writes the samples in the profile format that mksnapshot reads with
+  // --turbo-profiling-input --reorder-builtins: a "builtin_count" line per
+  // sampled builtin, followed by a "call_count" line per sampled call
+  // between two builtins. Counts are normalized to 0..10000 like those
+  // written by tools/builtins-pgo/get_hints.py. Builtins that can't be
+  // reordered (ASM and CPP) are left out.
+  void Log(std::ostream& os) const;
+  void ResetCounts();
+
+  uint32_t BuiltinSamples(Builtin builtin) const {
+    return builtin_samples_[Builtins::ToInt(builtin)].load(
+        std::memory_order_relaxed);
+  }
+  uint32_t CallSamples(Builtin caller, Builtin callee) const;
+
+ private:
+  class SamplingThread;
+
+  // An open addressing hash table of call edges. Keys are
+  // (caller << 16 | callee) + 1, 0 marks free entries.
+  struct CallEdge {
+    std::atomic<uint32_t> key{0};
+    std::atomic<uint32_t> count{0};
+  };
+  static constexpr int kCallEdgeTableSize = 16 * 1024;
+  static_assert(Builtins::kBuiltinCount < (1 << 16));
+
+  static uint32_t CallEdgeKey(Builtin caller, Builtin callee) {
+    return (static_cast<uint32_t>(Builtins::ToInt(caller)) << 16 |
+            static_cast<uint32_t>(Builtins::ToInt(callee))) +
+           1;
+  }
+  // Returns nullptr if the edge is not in the table, or, with |insert|, if
+  // the table is full.
+  CallEdge* FindCallEdge(uint32_t key, bool insert) const;
+
+  Isolate* const isolate_;
+  const int interval_microseconds_;
+  std::unique_ptr<SamplingThread> sampling_thread_;
+  std::atomic<uint32_t> builtin_samples_[Builtins::kBuiltinCount] = {};
+  std::unique_ptr<CallEdge[]> call_edges_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DIAGNOSTICS_BUILTINS_SAMPLER_H_
@@ -48,6 +48,11 @@ void CompilationStatistics::RecordTotalStats(const BasicStats& stats) {
   total_stats_.count_++;
 }
 
+void CompilationStatistics::RecordCounter(const char* name, size_t value) {
+  base::MutexGuard guard(&record_mutex_);
+  counter_map_[name] += value;
+}
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -194,6 +199,19 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
     os << std::endl;
     os << "\"" << ps.compiler << "_totals_count\"=" << s.total_stats_.count_;
   }
+
+  if (!s.counter_map_.empty()) {
+    if (!ps.machine_output) WriteFullLine(os);
+    for (const auto& [name, value] : s.counter_map_) {
+      if (ps.machine_output) {
+        os << std::endl
+           << "\"" << ps.compiler << "_" << name << "\"=" << value;
+      } else {
+        os << std::setw(34) << name << " " << std::setw(10) << value
+           << std::endl;
+      }
+    }
+  }
   return os;
 }
 
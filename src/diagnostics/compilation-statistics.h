@@ -53,6 +53,10 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(const BasicStats& stats);
 
+  // Adds |value| to the counter |name|, e.g. the number of spills done by a
+  // register allocator. Counters are printed after the totals.
+  void RecordCounter(const char* name, size_t value);
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -80,10 +84,12 @@ class CompilationStatistics final : public Malloced {
   using PhaseKindStats = OrderedStats;
   using PhaseKindMap = std::map<std::string, PhaseKindStats>;
   using PhaseMap = std::map<std::string, PhaseStats>;
+  using CounterMap = std::map<std::string, size_t>;
 
   TotalStats total_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
+  CounterMap counter_map_;
   base::Mutex record_mutex_;
 };
 
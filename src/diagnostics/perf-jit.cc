@@ -36,8 +36,14 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <deque>
 #include <memory>
+#include <sstream>
+#include <vector>
 
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/base/platform/wrappers.h"
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
@@ -96,6 +102,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -130,6 +146,70 @@ uint64_t LinuxPerfJitLogger::reference_count_ = 0;
 void* LinuxPerfJitLogger::marker_address_ = nullptr;
 uint64_t LinuxPerfJitLogger::code_index_ = 0;
 FILE* LinuxPerfJitLogger::perf_output_handle_ = nullptr;
+LinuxPerfJitLogger::Writer* LinuxPerfJitLogger::writer_ = nullptr;
+
+// Writes the jitdump file on a background thread. The threads that log code
+// only copy the records into a buffer, which is handed over to the writer
+// once it is full, so they don't wait for the file system.
+class LinuxPerfJitLogger::Writer final : public base::Thread {
+ public:
+  explicit Writer(FILE* file)
+      : base::Thread(base::Thread::Options("v8:PerfJitWriter")), file_(file) {
+    current_.reserve(kLogBufferSize);
+  }
+
+  // Called with the file mutex held.
+  void Write(const char* bytes, int size) {
+    current_.insert(current_.end(), bytes, bytes + size);
+    if (current_.size() >= static_cast<size_t>(kLogBufferSize)) Flush();
+  }
+
+  // Writes all buffered records and waits for the thread to finish.
+  void StopAndJoin() {
+    Flush();
+    {
+      base::MutexGuard guard(&mutex_);
+      stopping_ = true;
+      cv_.NotifyOne();
+    }
+    Join();
+  }
+
+  void Run() override {
+    mutex_.Lock();
+    while (true) {
+      while (pending_.empty() && !stopping_) cv_.Wait(&mutex_);
+      if (pending_.empty()) break;
+      std::vector<char> buffer = std::move(pending_.front());
+      pending_.pop_front();
+      mutex_.Unlock();
+      size_t rv = fwrite(buffer.data(), 1, buffer.size(), file_);
+      DCHECK_EQ(buffer.size(), rv);
+      USE(rv);
+      mutex_.Lock();
+    }
+    mutex_.Unlock();
+    fflush(file_);
+  }
+
+ private:
+  void Flush() {
+    if (current_.empty()) return;
+    base::MutexGuard guard(&mutex_);
+    pending_.push_back(std::move(current_));
+    current_ = std::vector<char>();
+    current_.reserve(kLogBufferSize);
+    cv_.NotifyOne();
+  }
+
+  FILE* const file_;
+  // Only accessed with the file mutex held.
+  std::vector<char> current_;
+  base::Mutex mutex_;
+  base::ConditionVariable cv_;
+  std::deque<std::vector<char>> pending_;
+  bool stopping_ = false;
+};
 
 void LinuxPerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -155,11 +235,20 @@ void LinuxPerfJitLogger::OpenJitDumpFile() {
   perf_output_handle_ = fdopen(fd, "w+");
   if (perf_output_handle_ == nullptr) return;
 
-  setvbuf(perf_output_handle_, nullptr, _IOFBF, kLogBufferSize);
+  writer_ = new Writer(perf_output_handle_);
+  if (!writer_->Start()) {
+    delete writer_;
+    writer_ = nullptr;
+    base::Fclose(perf_output_handle_);
+    perf_output_handle_ = nullptr;
+  }
 }
 
 void LinuxPerfJitLogger::CloseJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
+  writer_->StopAndJoin();
+  delete writer_;
+  writer_ = nullptr;
   base::Fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
 }
@@ -239,13 +328,15 @@ void LinuxPerfJitLogger::LogRecordedBuffer(
 
   // Debug info has to be emitted first.
   Handle<SharedFunctionInfo> sfi;
-  if (v8_flags.perf_prof && maybe_sfi.ToHandle(&sfi)) {
+  if (maybe_sfi.ToHandle(&sfi)) {
     // TODO(herhut): This currently breaks for js2wasm/wasm2js functions.
     CodeKind kind = code->kind();
+    // Scripts compiled before the logger was enabled at runtime may lack
+    // line ends, and they can't be computed without allocating.
     if (kind != CodeKind::JS_TO_WASM_FUNCTION &&
-        kind != CodeKind::WASM_TO_JS_FUNCTION) {
-      DCHECK_IMPLIES(sfi->script().IsScript(),
-                     Script::cast(sfi->script())->has_line_ends());
+        kind != CodeKind::WASM_TO_JS_FUNCTION &&
+        (!sfi->script().IsScript() ||
+         Script::cast(sfi->script())->has_line_ends())) {
       LogWriteDebugInfo(code, sfi);
     }
   }
@@ -297,6 +388,29 @@ void LinuxPerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
 }
 
+void LinuxPerfJitLogger::CodeMoveEvent(InstructionStream from,
+                                       InstructionStream to) {
+  base::LockGuard<base::RecursiveMutex> guard_file(GetFileMutex().Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeLoad::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ = static_cast<uint32_t>(process_id_);
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = to->instruction_start();
+  code_move.old_code_address_ = from->instruction_start();
+  code_move.new_code_address_ = to->instruction_start();
+  code_move.code_size_ = to->code(kAcquireLoad)->instruction_size();
+  code_move.code_id_ = code_index_;
+
+  code_index_++;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
 namespace {
 
 constexpr char kUnknownScriptNameString[] = "<unknown>";
@@ -517,8 +631,10 @@ void LinuxPerfJitLogger::LogWriteUnwindingInfo(Code code) {
     LogWriteBytes(reinterpret_cast<const char*>(code->unwinding_info_start()),
                   code->unwinding_info_size());
   } else {
-    OFStream perf_output_stream(perf_output_handle_);
-    EhFrameWriter::WriteEmptyEhFrame(perf_output_stream);
+    std::ostringstream empty_eh_frame;
+    EhFrameWriter::WriteEmptyEhFrame(empty_eh_frame);
+    std::string bytes = empty_eh_frame.str();
+    LogWriteBytes(bytes.data(), static_cast<int>(bytes.size()));
   }
 
   char padding_bytes[] = "\0\0\0\0\0\0\0\0";
@@ -527,9 +643,7 @@ void LinuxPerfJitLogger::LogWriteUnwindingInfo(Code code) {
 }
 
 void LinuxPerfJitLogger::LogWriteBytes(const char* bytes, int size) {
-  size_t rv = fwrite(bytes, 1, size, perf_output_handle_);
-  DCHECK(static_cast<size_t>(size) == rv);
-  USE(rv);
+  writer_->Write(bytes, size);
 }
 
 void LinuxPerfJitLogger::LogWriteHeader() {
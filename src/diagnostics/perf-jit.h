@@ -44,14 +44,16 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   explicit LinuxPerfJitLogger(Isolate* isolate);
   ~LinuxPerfJitLogger() override;
 
-  void CodeMoveEvent(InstructionStream from, InstructionStream to) override {
-    UNREACHABLE();  // Unsupported.
-  }
+  // Code moves are only seen if the logger was enabled at runtime, because
+  // --perf-prof disables code compaction.
+  void CodeMoveEvent(InstructionStream from, InstructionStream to) override;
   void BytecodeMoveEvent(BytecodeArray from, BytecodeArray to) override {}
   void CodeDisableOptEvent(Handle<AbstractCode> code,
                            Handle<SharedFunctionInfo> shared) override {}
 
  private:
+  class Writer;
+
   void OpenJitDumpFile();
   void CloseJitDumpFile();
   void* OpenMarkerFile(int fd);
@@ -70,8 +72,7 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   static const char kFilenameFormatString[];
   static const int kFilenameBufferPadding;
 
-  // File buffer size of the low-level log. We don't use the default to
-  // minimize the associated overhead.
+  // Size of the buffers that are handed over to the writer thread.
   static const int kLogBufferSize = 2 * MB;
 
   void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
@@ -131,6 +132,7 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   // Per-process singleton file. We assume that there is one main isolate;
   // to determine when it goes away, we keep reference count.
   static FILE* perf_output_handle_;
+  static Writer* writer_;
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
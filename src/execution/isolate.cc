@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <fstream>
@@ -39,12 +40,14 @@
 #include "src/common/ptr-compr-inl.h"
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
+#include "src/compiler/js-inlining-profile.h"
 #include "src/date/date.h"
 #include "src/debug/debug-frames.h"
 #include "src/debug/debug.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/diagnostics/basic-block-profiler.h"
+#include "src/diagnostics/builtins-sampler.h"
 #include "src/diagnostics/compilation-statistics.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/frames.h"
@@ -65,6 +68,7 @@
 #include "src/heap/parked-scope.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/safepoint.h"
+#include "src/ic/ic-stats.h"
 #include "src/ic/stub-cache.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/setup-isolate.h"
@@ -132,7 +136,7 @@
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module.h"
-#include "src/wasm/wasm-objects.h"
+#include "src/wasm/wasm-objects-inl.h"
 #endif  // V8_ENABLE_WEBASSEMBLY
 
 #if defined(V8_OS_WIN) && defined(V8_ENABLE_ETW_STACK_WALKING)
@@ -3164,6 +3168,30 @@ void Isolate::AddSharedWasmMemory(Handle<WasmMemoryObject> memory_object) {
   heap()->set_shared_wasm_memories(*shared_wasm_memories);
 }
 
+void Isolate::AddDiscardableWasmMemory(Handle<WasmMemoryObject> memory_object) {
+  Handle<WeakArrayList> memories = factory()->discardable_wasm_memories();
+  memories = WeakArrayList::Append(this, memories,
+                                   MaybeObjectHandle::Weak(memory_object));
+  heap()->set_discardable_wasm_memories(*memories);
+}
+
+size_t Isolate::DiscardZeroedWasmMemoryPages() {
+  DisallowGarbageCollection no_gc;
+  WeakArrayList memories = heap()->discardable_wasm_memories();
+  size_t discarded = 0;
+  for (int i = 0, e = memories->length(); i < e; ++i) {
+    HeapObject obj;
+    if (!memories->Get(i).GetHeapObject(&obj)) continue;
+    JSArrayBuffer buffer = WasmMemoryObject::cast(obj)->array_buffer();
+    std::shared_ptr<BackingStore> backing_store = buffer->GetBackingStore();
+    // Wasm memory always has a BackingStore.
+    CHECK_NOT_NULL(backing_store);
+    DCHECK(!backing_store->is_shared());
+    discarded += backing_store->DiscardZeroedWasmMemoryTail();
+  }
+  return discarded;
+}
+
 void Isolate::SyncStackLimit() {
   // Synchronize the stack limit with the active continuation for
   // stack-switching. This can be done before or after changing the stack
@@ -3619,6 +3647,15 @@ void Isolate::Deinit() {
   DisallowGarbageCollection no_gc;
 
   tracing_cpu_profiler_.reset();
+  if (builtins_sampler_ && builtins_sampler_->IsActive()) {
+    builtins_sampler_->StopSampling();
+  }
+#ifdef V8_RUNTIME_CALL_STATS
+  if (rcs_sampler_ && rcs_sampler_->IsActive()) {
+    rcs_sampler_->StopSampling();
+    ReportRuntimeCallStatsSamples();
+  }
+#endif  // V8_RUNTIME_CALL_STATS
   if (v8_flags.stress_sampling_allocation_profiler > 0) {
     heap_profiler()->StopSamplingHeapProfiler();
   }
@@ -3642,6 +3679,10 @@ void Isolate::Deinit() {
     optimizing_compile_dispatcher_ = nullptr;
   }
 
+  if (V8_UNLIKELY(v8_flags.turbo_inlining_profile_to_file)) {
+    compiler::JSInliningProfile::DumpToFile();
+  }
+
   if (v8_flags.print_deopt_stress) {
     PrintF(stdout, "=== Stress deopt counter: %u\n", stress_deopt_count_);
   }
@@ -3721,6 +3762,12 @@ void Isolate::Deinit() {
 
   heap_.TearDown();
 
+  // Backing stores that outlive the isolate free their memory directly.
+  if (array_buffer_pool_) {
+    array_buffer_pool_->TearDown(array_buffer_allocator());
+    array_buffer_pool_.reset();
+  }
+
   delete inner_pointer_to_code_cache_;
   inner_pointer_to_code_cache_ = nullptr;
 
@@ -4224,7 +4271,31 @@ class BigIntPlatform : public bigint::Platform {
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  void RunInParallel(ParallelTask* task) override {
+    if (v8_flags.single_threaded) return task->Run(true);
+    // The joining thread is the one that called into the bigint library.
+    std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->CreateJob(
+        TaskPriority::kUserBlocking, std::make_unique<ParallelJob>(task));
+    job_handle->Join();
+  }
+
  private:
+  class ParallelJob final : public JobTask {
+   public:
+    explicit ParallelJob(ParallelTask* task) : task_(task) {}
+
+    void Run(JobDelegate* delegate) override {
+      task_->Run(delegate->IsJoiningThread());
+    }
+
+    size_t GetMaxConcurrency(size_t worker_count) const override {
+      return worker_count + task_->RemainingWorkItems();
+    }
+
+   private:
+    ParallelTask* const task_;
+  };
+
   Isolate* isolate_;
 };
 }  // namespace
@@ -4457,6 +4528,10 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     heap_.SetIsMarkingFlag(true);
   }
 
+  if (v8_flags.array_buffer_pool) {
+    array_buffer_pool_ = std::make_shared<ArrayBufferPool>();
+  }
+
   // Set up the object heap.
   DCHECK(!heap_.HasBeenSetUp());
   heap_.SetUp(main_thread_local_heap());
@@ -4725,6 +4800,24 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   }
 #endif  // defined(V8_OS_WIN) && defined(V8_ENABLE_ETW_STACK_WALKING)
 
+  if (v8_flags.builtins_sampling_profile_output) {
+    builtins_sampler_ = std::make_unique<BuiltinsSampler>(
+        this, v8_flags.builtins_sampling_interval);
+    builtins_sampler_->StartSampling();
+  }
+
+  if (v8_flags.ic_site_stats) {
+    ic_site_stats_ = std::make_unique<ICSiteStats>();
+  }
+
+#ifdef V8_RUNTIME_CALL_STATS
+  if (v8_flags.rcs_sampling) {
+    rcs_sampler_ = std::make_unique<RuntimeCallStatsSampler>(
+        counters()->runtime_call_stats(), v8_flags.rcs_sampling_interval);
+    rcs_sampler_->StartSampling();
+  }
+#endif  // V8_RUNTIME_CALL_STATS
+
   initialized_ = true;
 
   return true;
@@ -4850,6 +4943,12 @@ void Isolate::DumpAndResetStats() {
   }
 #endif  // V8_ENABLE_MAGLEV
 
+  if (ic_site_stats_ != nullptr) {
+    StdoutStream os;
+    ic_site_stats_->Print(os, v8_flags.ic_site_stats_top);
+    ic_site_stats_->Reset();
+  }
+
 #if V8_ENABLE_WEBASSEMBLY
   // TODO(7424): There is no public API for the {WasmEngine} yet. So for now we
   // just dump and reset the engines statistics together with the Isolate.
@@ -4865,6 +4964,9 @@ void Isolate::DumpAndResetStats() {
     counters()->runtime_call_stats()->Print();
     counters()->runtime_call_stats()->Reset();
   }
+  if (rcs_sampler_ && rcs_sampler_->IsActive()) {
+    ReportRuntimeCallStatsSamples();
+  }
 #endif  // V8_RUNTIME_CALL_STATS
   if (BasicBlockProfiler::Get()->HasData(this)) {
     if (v8_flags.turbo_profiling_output) {
@@ -4885,7 +4987,30 @@ void Isolate::DumpAndResetStats() {
     // v8_enable_builtins_profiling=true
     CHECK_NULL(v8_flags.turbo_profiling_output);
   }
+  if (builtins_sampler_) {
+    FILE* f = std::fopen(v8_flags.builtins_sampling_profile_output, "w");
+    if (f == nullptr) {
+      FATAL("Unable to open file \"%s\" for writing.\n",
+            v8_flags.builtins_sampling_profile_output.value());
+    }
+    {
+      OFStream pgo_stream(f);
+      builtins_sampler_->Log(pgo_stream);
+    }
+    std::fclose(f);
+    builtins_sampler_->ResetCounts();
+  }
+}
+
+#ifdef V8_RUNTIME_CALL_STATS
+void Isolate::ReportRuntimeCallStatsSamples() {
+  v8::metrics::RuntimeCallStatsSampled event;
+  rcs_sampler_->TakeSamples(&event);
+  if (event.total_sample_count == 0) return;
+  metrics_recorder()->AddMainThreadEvent(
+      event, v8::metrics::Recorder::ContextId::Empty());
 }
+#endif  // V8_RUNTIME_CALL_STATS
 
 void Isolate::AbortConcurrentOptimization(BlockingBehavior behavior) {
   if (concurrent_recompilation_enabled()) {
@@ -5998,21 +6123,37 @@ void Isolate::ResetDefaultLocale() {
 
 icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
                                              Handle<Object> locales) {
-  const ICUObjectCacheEntry& entry =
+  ICUObjectCacheEntry* entries =
       icu_object_cache_[static_cast<int>(cache_type)];
-  return StringEqualsLocales(this, entry.locales, locales) ? entry.obj.get()
-                                                           : nullptr;
+  for (int i = 0; i < kICUObjectCacheSize; i++) {
+    if (!entries[i].obj) break;
+    if (StringEqualsLocales(this, entries[i].locales, locales)) {
+      counters()->icu_object_cache_hits()->Increment();
+      // Move the entry to the front to keep the entries in LRU order.
+      std::rotate(entries, entries + i, entries + i + 1);
+      return entries[0].obj.get();
+    }
+  }
+  counters()->icu_object_cache_misses()->Increment();
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
                                       Handle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[static_cast<int>(cache_type)] = {
-      GetStringFromLocales(this, locales), std::move(obj)};
+  ICUObjectCacheEntry* entries =
+      icu_object_cache_[static_cast<int>(cache_type)];
+  // Evict the least recently used entry.
+  std::move_backward(entries, entries + kICUObjectCacheSize - 1,
+                     entries + kICUObjectCacheSize);
+  entries[0] = {GetStringFromLocales(this, locales), std::move(obj)};
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
-  icu_object_cache_[static_cast<int>(cache_type)] = ICUObjectCacheEntry{};
+  for (ICUObjectCacheEntry& entry :
+       icu_object_cache_[static_cast<int>(cache_type)]) {
+    entry = ICUObjectCacheEntry{};
+  }
 }
 
 void Isolate::clear_cached_icu_objects() {
@@ -6341,6 +6482,36 @@ Object Isolate::LocalsBlockListCacheGet(Handle<ScopeInfo> scope_info) {
   return maybe_value;
 }
 
+void Isolate::SharedConstantPoolCacheSet(Handle<String> key,
+                                         Handle<FixedArray> constant_pool) {
+  DCHECK(key->IsInternalizedString());
+  Handle<EphemeronHashTable> cache;
+  if (heap()->shared_constant_pool_cache().IsEphemeronHashTable()) {
+    cache = handle(
+        EphemeronHashTable::cast(heap()->shared_constant_pool_cache()), this);
+  } else {
+    CHECK(heap()->shared_constant_pool_cache().IsUndefined());
+    constexpr int kInitialCapacity = 64;
+    cache = EphemeronHashTable::New(this, kInitialCapacity);
+  }
+  cache = EphemeronHashTable::Put(cache, key, constant_pool);
+  heap()->set_shared_constant_pool_cache(*cache);
+}
+
+Object Isolate::SharedConstantPoolCacheGet(Handle<String> key) {
+  DisallowGarbageCollection no_gc;
+
+  if (!heap()->shared_constant_pool_cache().IsEphemeronHashTable()) {
+    return ReadOnlyRoots(this).the_hole_value();
+  }
+
+  Object maybe_value =
+      EphemeronHashTable::cast(heap()->shared_constant_pool_cache())
+          ->Lookup(key);
+  CHECK(maybe_value.IsFixedArray() || maybe_value.IsTheHole());
+  return maybe_value;
+}
+
 void DefaultWasmAsyncResolvePromiseCallback(
     v8::Isolate* isolate, v8::Local<v8::Context> context,
     v8::Local<v8::Promise::Resolver> resolver, v8::Local<v8::Value> result,
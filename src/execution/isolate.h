@@ -104,9 +104,11 @@ class MaglevConcurrentDispatcher;
 }  // namespace maglev
 
 class AddressToIndexHashMap;
+class ArrayBufferPool;
 class AstStringConstants;
 class Bootstrapper;
 class BuiltinsConstantsTableBuilder;
+class BuiltinsSampler;
 class CancelableTaskManager;
 class Logger;
 class CodeTracer;
@@ -124,6 +126,7 @@ class GlobalSafepoint;
 class HandleScopeImplementer;
 class HeapObjectToIndexHashMap;
 class HeapProfiler;
+class ICSiteStats;
 class InnerPointerToCodeCache;
 class LazyCompileDispatcher;
 class LocalIsolate;
@@ -137,6 +140,7 @@ class PersistentHandlesList;
 class ReadOnlyArtifacts;
 class RegExpStack;
 class RootVisitor;
+class RuntimeCallStatsSampler;
 class SetupIsolateDelegate;
 class Simulator;
 class SnapshotData;
@@ -1244,6 +1248,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   StubCache* load_stub_cache() const { return load_stub_cache_; }
   StubCache* store_stub_cache() const { return store_stub_cache_; }
+  // Only set with --ic-site-stats.
+  ICSiteStats* ic_site_stats() const { return ic_site_stats_.get(); }
   Deoptimizer* GetAndClearCurrentDeoptimizer() {
     Deoptimizer* result = current_deoptimizer_;
     CHECK_NOT_NULL(result);
@@ -1802,6 +1808,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return array_buffer_allocator_shared_;
   }
 
+  // The pool of freed array buffer memory, or nullptr without
+  // --array-buffer-pool.
+  const std::shared_ptr<ArrayBufferPool>& array_buffer_pool() const {
+    return array_buffer_pool_;
+  }
+
   FutexWaitListNode* futex_wait_list_node() { return &futex_wait_list_node_; }
 
   CancelableTaskManager* cancelable_task_manager() {
@@ -1925,6 +1937,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
 #if V8_ENABLE_WEBASSEMBLY
   void AddSharedWasmMemory(Handle<WasmMemoryObject> memory_object);
+
+  // Non-shared memories registered here get their trailing zero pages
+  // returned to the OS by {DiscardZeroedWasmMemoryPages}, which is called on
+  // memory-reducing GCs.
+  void AddDiscardableWasmMemory(Handle<WasmMemoryObject> memory_object);
+  size_t DiscardZeroedWasmMemoryPages();
 #endif  // V8_ENABLE_WEBASSEMBLY
 
   const v8::Context::BackupIncumbentScope* top_backup_incumbent_scope() const {
@@ -2065,6 +2083,14 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // Returns either `TheHole` or `StringSet`.
   Object LocalsBlockListCacheGet(Handle<ScopeInfo> scope_info);
 
+  // Access to the "shared constant pool cache", which lets bytecode arrays
+  // with identical small constant pools share a single FixedArray. Pools are
+  // keyed by their first entry, which is always an internalized string.
+  void SharedConstantPoolCacheSet(Handle<String> key,
+                                  Handle<FixedArray> constant_pool);
+  // Returns either `TheHole` or `FixedArray`.
+  Object SharedConstantPoolCacheGet(Handle<String> key);
+
   void VerifyStaticRoots();
 
   bool allow_compile_hints_magic() const { return allow_compile_hints_magic_; }
@@ -2192,6 +2218,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   void AddCrashKeysForIsolateAndHeapPointers();
 
+#ifdef V8_RUNTIME_CALL_STATS
+  // Reports the samples of --rcs-sampling to the metrics recorder.
+  void ReportRuntimeCallStatsSamples();
+#endif  // V8_RUNTIME_CALL_STATS
+
   // Returns the Exception sentinel.
   Object ThrowInternal(Object exception, MessageLocation* location);
 
@@ -2296,8 +2327,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_INTL_SUPPORT
   std::string default_locale_;
 
-  // The cache stores the most recently accessed {locales,obj} pair for each
-  // cache type.
+  // The cache stores the kICUObjectCacheSize most recently accessed
+  // {locales,obj} pairs for each cache type, most recently used first.
+  static constexpr int kICUObjectCacheSize = 4;
   struct ICUObjectCacheEntry {
     std::string locales;
     std::shared_ptr<icu::UMemory> obj;
@@ -2307,7 +2339,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
         : locales(locales), obj(std::move(obj)) {}
   };
 
-  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount];
+  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount]
+                                       [kICUObjectCacheSize];
 #endif  // V8_INTL_SUPPORT
 
   // Whether the isolate has been created for snapshotting.
@@ -2467,6 +2500,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   v8::ArrayBuffer::Allocator* array_buffer_allocator_ = nullptr;
   std::shared_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_shared_;
+  std::shared_ptr<ArrayBufferPool> array_buffer_pool_;
 
   FutexWaitListNode futex_wait_list_node_;
 
@@ -2497,6 +2531,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   size_t elements_deletion_counter_ = 0;
 
   std::unique_ptr<TracingCpuProfilerImpl> tracing_cpu_profiler_;
+  std::unique_ptr<BuiltinsSampler> builtins_sampler_;
+  std::unique_ptr<ICSiteStats> ic_site_stats_;
+#ifdef V8_RUNTIME_CALL_STATS
+  std::unique_ptr<RuntimeCallStatsSampler> rcs_sampler_;
+#endif  // V8_RUNTIME_CALL_STATS
 
   EmbeddedFileWriterInterface* embedded_file_writer_ = nullptr;
 
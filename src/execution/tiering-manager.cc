@@ -12,6 +12,7 @@
 #include "src/codegen/compiler.h"
 #include "src/codegen/pending-optimization-table.h"
 #include "src/common/globals.h"
+#include "src/deoptimizer/deoptimize-reason.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
@@ -19,6 +20,7 @@
 #include "src/handles/global-handles.h"
 #include "src/init/bootstrapper.h"
 #include "src/interpreter/interpreter.h"
+#include "src/logging/counters.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/code.h"
 #include "src/tracing/trace-event.h"
@@ -134,9 +136,41 @@ void TraceManualRecompile(JSFunction function, CodeKind code_kind,
   }
 }
 
+#define POLICY_OR_FLAG(name)                                 \
+  int TieringManager::name() const {                         \
+    return policy_.name != 0 ? policy_.name : v8_flags.name; \
+  }
+POLICY_OR_FLAG(invocation_count_for_feedback_allocation)
+POLICY_OR_FLAG(invocation_count_for_maglev)
+POLICY_OR_FLAG(invocation_count_for_maglev_osr)
+POLICY_OR_FLAG(invocation_count_for_turbofan)
+POLICY_OR_FLAG(invocation_count_for_osr)
+POLICY_OR_FLAG(max_deopt_count)
+#undef POLICY_OR_FLAG
+
+int TieringManager::invocation_count_for_maglev_with_hint() const {
+  // The hinted threshold never exceeds the regular one, even if the policy
+  // lowers the latter.
+  return std::min(v8_flags.invocation_count_for_maglev_with_hint,
+                  invocation_count_for_maglev());
+}
+
 void TieringManager::Optimize(JSFunction function, OptimizationDecision d) {
   DCHECK(d.should_optimize());
   TraceRecompile(isolate_, function, d);
+  if (function->has_feedback_vector()) {
+    // Record how hot functions get before they tier up, to allow tuning the
+    // tiering policy.
+    int invocations =
+        function->feedback_vector()->invocation_count(kRelaxedLoad);
+    if (d.code_kind == CodeKind::MAGLEV) {
+      isolate_->counters()->tiering_invocations_to_maglev()->AddSample(
+          invocations);
+    } else {
+      isolate_->counters()->tiering_invocations_to_turbofan()->AddSample(
+          invocations);
+    }
+  }
   function->MarkForOptimization(isolate_, d.code_kind, d.concurrency_mode);
 }
 
@@ -170,25 +204,47 @@ bool TiersUpToMaglev(base::Optional<CodeKind> code_kind) {
   return code_kind.has_value() && TiersUpToMaglev(code_kind.value());
 }
 
-int InterruptBudgetFor(base::Optional<CodeKind> code_kind,
-                       TieringState tiering_state, int bytecode_length) {
+int InterruptBudgetFor(const TieringManager* tiering_manager,
+                       base::Optional<CodeKind> code_kind,
+                       TieringState tiering_state, int bytecode_length,
+                       bool maglev_compiled) {
   if (IsRequestTurbofan(tiering_state) ||
       (code_kind.has_value() && code_kind.value() == CodeKind::TURBOFAN)) {
-    return v8_flags.invocation_count_for_osr * bytecode_length;
+    return tiering_manager->invocation_count_for_osr() * bytecode_length;
   }
   // TODO(olivf) In case we are currently executing below Maglev and have
   // CodeKind::MAGLEV waiting we should also OSR. But currently we cannot know
   // if this helper is called from Maglev code or below.
   if (maglev::IsMaglevOsrEnabled() && IsRequestMaglev(tiering_state)) {
-    return v8_flags.invocation_count_for_maglev_osr * bytecode_length;
+    return tiering_manager->invocation_count_for_maglev_osr() *
+           bytecode_length;
+  }
+  if (TiersUpToMaglev(code_kind) && tiering_state == TieringState::kNone) {
+    // Functions which made it to Maglev before (possibly in the process which
+    // produced the code cache) are likely hot again; get there sooner.
+    return maglev_compiled
+               ? tiering_manager->invocation_count_for_maglev_with_hint() *
+                     bytecode_length
+               : tiering_manager->invocation_count_for_maglev() *
+                     bytecode_length;
   }
-  return TiersUpToMaglev(code_kind) && tiering_state == TieringState::kNone
-             ? v8_flags.invocation_count_for_maglev * bytecode_length
-             : v8_flags.invocation_count_for_turbofan * bytecode_length;
+  return tiering_manager->invocation_count_for_turbofan() * bytecode_length;
 }
 
 }  // namespace
 
+// static
+int TieringManager::FeedbackAllocationDelayFactor(int bytecode_length) {
+  const int large_function_size =
+      v8_flags.feedback_allocation_large_function_size;
+  if (large_function_size <= 0 || bytecode_length <= large_function_size) {
+    return 1;
+  }
+  const int max_factor =
+      std::max(v8_flags.max_feedback_allocation_delay_factor.value(), 1);
+  return std::min(bytecode_length / large_function_size + 1, max_factor);
+}
+
 // static
 int TieringManager::InterruptBudgetFor(
     Isolate* isolate, JSFunction function,
@@ -197,8 +253,11 @@ int TieringManager::InterruptBudgetFor(
   const int bytecode_length =
       function->shared()->GetBytecodeArray(isolate)->length();
 
+  const TieringManager* tiering_manager = isolate->tiering_manager();
   if (FirstTimeTierUpToSparkplug(isolate, function)) {
-    return bytecode_length * v8_flags.invocation_count_for_feedback_allocation;
+    return bytecode_length *
+           tiering_manager->invocation_count_for_feedback_allocation() *
+           FeedbackAllocationDelayFactor(bytecode_length);
   }
 
   DCHECK(function->has_feedback_vector());
@@ -209,8 +268,10 @@ int TieringManager::InterruptBudgetFor(
     return INT_MAX / 2;
   }
   return ::i::InterruptBudgetFor(
+      tiering_manager,
       override_active_tier ? override_active_tier : function->GetActiveTier(),
-      function->tiering_state(), bytecode_length);
+      function->tiering_state(), bytecode_length,
+      function->shared()->maglev_compiled());
 }
 
 namespace {
@@ -235,6 +296,18 @@ void TrySetOsrUrgency(Isolate* isolate, JSFunction function, int osr_urgency) {
   fv->set_osr_urgency(osr_urgency);
 }
 
+// Returns true if a frame running |code_kind| code of |function| is below
+// Maglev while Maglev code for the function is ready or being compiled. Such a
+// frame is stuck in a long-running loop and should OSR into Maglev soon.
+bool IsWaitingForMaglevOsr(JSFunction function, CodeKind code_kind) {
+  if (!maglev::IsMaglevOsrEnabled()) return false;
+  if (!CodeKindIsUnoptimizedJSFunction(code_kind)) return false;
+  if (function->HasAvailableCodeKind(CodeKind::MAGLEV)) return true;
+  FeedbackVector vector = function->feedback_vector();
+  return IsInProgress(vector->tiering_state()) ||
+         IsInProgress(vector->osr_tiering_state());
+}
+
 void TryIncrementOsrUrgency(Isolate* isolate, JSFunction function) {
   int old_urgency = function->feedback_vector()->osr_urgency();
   int new_urgency = std::min(old_urgency + 1, FeedbackVector::kMaxOsrUrgency);
@@ -336,6 +409,10 @@ OptimizationDecision TieringManager::ShouldOptimize(
     return OptimizationDecision::DoNotOptimize();
   }
 
+  if (IsPinnedToMaglev(feedback_vector)) {
+    return OptimizationDecision::DoNotOptimize();
+  }
+
   if (!v8_flags.turbofan || !shared->PassesFilter(v8_flags.turbo_filter)) {
     return OptimizationDecision::DoNotOptimize();
   }
@@ -373,6 +450,53 @@ void TieringManager::NotifyICChanged(FeedbackVector vector) {
   }
 }
 
+bool TieringManager::IsPinnedToMaglev(FeedbackVector feedback_vector) const {
+  // The deopt count saturates, so larger limits behave like the maximum.
+  int limit = std::min(max_deopt_count(), kMaxUInt8);
+  return limit > 0 && feedback_vector->deopt_count() >= limit;
+}
+
+void TieringManager::OnDeoptimization(Handle<JSFunction> function,
+                                      CodeKind code_kind,
+                                      DeoptimizeReason reason) {
+  static_assert(kDeoptimizeReasonCount <= 128);
+  isolate_->counters()->deopt_reason()->AddSample(static_cast<int>(reason));
+  if (!function->has_feedback_vector()) return;
+
+  FeedbackVector vector = function->feedback_vector();
+  int count = vector->deopt_count();
+  if (count < kMaxUInt8) vector->set_deopt_count(++count);
+
+  int limit = std::min(max_deopt_count(), kMaxUInt8);
+  SharedFunctionInfo shared = function->shared();
+  if (limit == 0 || shared->optimization_disabled()) return;
+
+  // Once a function deopts |limit| times, it no longer tiers up to TurboFan
+  // but keeps running Maglev code, which deopts on fewer assumptions. If it
+  // keeps deopting, or if there is no Maglev to fall back to, it stays
+  // unoptimized.
+  const bool disable = count >= std::min(2 * limit, kMaxUInt8) ||
+                       (count >= limit && !maglev::IsMaglevEnabled());
+  if (!disable && count != limit) return;
+  const char* decision = disable ? "disable-optimization" : "pin-to-maglev";
+
+  TRACE_EVENT_INSTANT2(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                       "V8.TieringDeoptLoop", TRACE_EVENT_SCOPE_THREAD,
+                       "decision", decision, "reason",
+                       DeoptimizeReasonToString(reason));
+  if (v8_flags.trace_opt || v8_flags.trace_deopt) {
+    CodeTracer::Scope scope(isolate_->GetCodeTracer());
+    PrintF(scope.file(), "[%s ", decision);
+    function->ShortPrint(scope.file());
+    PrintF(scope.file(), " after %d deopts, last from %s: %s]\n", count,
+           CodeKindToString(code_kind), DeoptimizeReasonToString(reason));
+  }
+  if (disable) {
+    shared->DisableOptimization(isolate_,
+                                BailoutReason::kDeoptimizedTooManyTimes);
+  }
+}
+
 TieringManager::OnInterruptTickScope::OnInterruptTickScope() {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.MarkCandidatesForOptimization");
@@ -463,6 +587,17 @@ void TieringManager::OnInterruptTick(Handle<JSFunction> function,
   // Make sure to set the interrupt budget after maybe starting an optimization,
   // so that the interrupt budget size takes into account tiering state.
   DCHECK(had_feedback_vector);
+  if (IsWaitingForMaglevOsr(function_obj, code_kind)) {
+    // The regular budget would be sized for the next tier-up past Maglev, and a
+    // loop running below Maglev would wait that long before bumping its OSR
+    // urgency. Tick at the Maglev OSR rate instead, so the frame enters Maglev
+    // code as soon as it's available.
+    int bytecode_length =
+        function_obj->shared()->GetBytecodeArray(isolate_)->length();
+    function_obj->raw_feedback_cell()->set_interrupt_budget(
+        invocation_count_for_maglev_osr() * bytecode_length);
+    return;
+  }
   function->SetInterruptBudget(isolate_);
 }
 
@@ -19,6 +19,7 @@ class Isolate;
 class JSFunction;
 class OptimizationDecision;
 enum class CodeKind : uint8_t;
+enum class DeoptimizeReason : uint8_t;
 enum class OptimizationReason : uint8_t;
 
 void TraceManualRecompile(JSFunction function, CodeKind code_kind,
@@ -26,15 +27,50 @@ void TraceManualRecompile(JSFunction function, CodeKind code_kind,
 
 class TieringManager {
  public:
+  // Per-isolate overrides of the --invocation-count-for-* and
+  // --max-deopt-count flags, see
+  // v8::Isolate::SetTieringPolicy. Zero means that the flag value is used.
+  struct Policy {
+    int invocation_count_for_feedback_allocation = 0;
+    int invocation_count_for_maglev = 0;
+    int invocation_count_for_maglev_osr = 0;
+    int invocation_count_for_turbofan = 0;
+    int invocation_count_for_osr = 0;
+    int max_deopt_count = 0;
+  };
+
   explicit TieringManager(Isolate* isolate) : isolate_(isolate) {}
 
+  void set_policy(const Policy& policy) { policy_ = policy; }
+
+  int invocation_count_for_feedback_allocation() const;
+  int invocation_count_for_maglev() const;
+  int invocation_count_for_maglev_with_hint() const;
+  int invocation_count_for_maglev_osr() const;
+  int invocation_count_for_turbofan() const;
+  int invocation_count_for_osr() const;
+  int max_deopt_count() const;
+
   void OnInterruptTick(Handle<JSFunction> function, CodeKind code_kind);
 
   void NotifyICChanged(FeedbackVector vector);
 
+  // Called for eager deopts that invalidate |code_kind| code of |function|.
+  // Functions that keep deoptimizing are first pinned to Maglev and
+  // eventually excluded from optimization, to break deopt loops.
+  void OnDeoptimization(Handle<JSFunction> function, CodeKind code_kind,
+                        DeoptimizeReason reason);
+
   // After this request, the next JumpLoop will perform OSR.
   void RequestOsrAtNextOpportunity(JSFunction function);
 
+  // Large functions that run only a few times would pay for a large feedback
+  // vector without ever tiering up, so they need this many times the usual
+  // invocation count before feedback vector allocation. The factor grows
+  // linearly with the bytecode size past
+  // --feedback-allocation-large-function-size.
+  static int FeedbackAllocationDelayFactor(int bytecode_length);
+
   // For use when a JSFunction is available.
   static int InterruptBudgetFor(
       Isolate* isolate, JSFunction function,
@@ -55,6 +91,8 @@ class TieringManager {
                                       CodeKind code_kind);
   void Optimize(JSFunction function, OptimizationDecision decision);
   void Baseline(JSFunction function, OptimizationReason reason);
+  // True if |feedback_vector| saw enough deopts to no longer go to TurboFan.
+  bool IsPinnedToMaglev(FeedbackVector feedback_vector) const;
 
   class V8_NODISCARD OnInterruptTickScope final {
    public:
@@ -65,6 +103,7 @@ class TieringManager {
   };
 
   Isolate* const isolate_;
+  Policy policy_;
 };
 
 }  // namespace internal
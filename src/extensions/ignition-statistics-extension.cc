@@ -8,6 +8,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/interpreter/interpreter.h"
 
@@ -17,15 +18,29 @@ namespace internal {
 v8::Local<v8::FunctionTemplate>
 IgnitionStatisticsExtension::GetNativeFunctionTemplate(
     v8::Isolate* isolate, v8::Local<v8::String> name) {
-  DCHECK_EQ(strcmp(*v8::String::Utf8Value(isolate, name),
-                   "getIgnitionDispatchCounters"),
-            0);
+  v8::String::Utf8Value utf8_name(isolate, name);
+  if (strcmp(*utf8_name, "startIgnitionSampling") == 0) {
+    return v8::FunctionTemplate::New(
+        isolate, IgnitionStatisticsExtension::StartIgnitionSampling);
+  }
+  if (strcmp(*utf8_name, "stopIgnitionSampling") == 0) {
+    return v8::FunctionTemplate::New(
+        isolate, IgnitionStatisticsExtension::StopIgnitionSampling);
+  }
+  if (strcmp(*utf8_name, "getIgnitionSamples") == 0) {
+    return v8::FunctionTemplate::New(
+        isolate, IgnitionStatisticsExtension::GetIgnitionSamples);
+  }
+  DCHECK_EQ(strcmp(*utf8_name, "getIgnitionDispatchCounters"), 0);
   return v8::FunctionTemplate::New(
       isolate, IgnitionStatisticsExtension::GetIgnitionDispatchCounters);
 }
 
 const char* const IgnitionStatisticsExtension::kSource =
-    "native function getIgnitionDispatchCounters();";
+    "native function getIgnitionDispatchCounters();"
+    "native function startIgnitionSampling();"
+    "native function stopIgnitionSampling();"
+    "native function getIgnitionSamples();";
 
 void IgnitionStatisticsExtension::GetIgnitionDispatchCounters(
     const v8::FunctionCallbackInfo<v8::Value>& info) {
@@ -36,5 +51,39 @@ void IgnitionStatisticsExtension::GetIgnitionDispatchCounters(
                          ->GetDispatchCountersObject()));
 }
 
+void IgnitionStatisticsExtension::StartIgnitionSampling(
+    const v8::FunctionCallbackInfo<v8::Value>& info) {
+  DCHECK(ValidateCallbackInfo(info));
+  int interval_microseconds = v8_flags.ignition_sampling_interval;
+  if (info.Length() > 0 && info[0]->IsInt32()) {
+    interval_microseconds = info[0].As<v8::Int32>()->Value();
+  }
+  if (interval_microseconds <= 0) {
+    info.GetIsolate()->ThrowError(
+        "startIgnitionSampling() requires a positive interval.");
+    return;
+  }
+  reinterpret_cast<Isolate*>(info.GetIsolate())
+      ->interpreter()
+      ->StartBytecodeSampling(interval_microseconds);
+}
+
+void IgnitionStatisticsExtension::StopIgnitionSampling(
+    const v8::FunctionCallbackInfo<v8::Value>& info) {
+  DCHECK(ValidateCallbackInfo(info));
+  reinterpret_cast<Isolate*>(info.GetIsolate())
+      ->interpreter()
+      ->StopBytecodeSampling();
+}
+
+void IgnitionStatisticsExtension::GetIgnitionSamples(
+    const v8::FunctionCallbackInfo<v8::Value>& info) {
+  DCHECK(ValidateCallbackInfo(info));
+  info.GetReturnValue().Set(
+      Utils::ToLocal(reinterpret_cast<Isolate*>(info.GetIsolate())
+                         ->interpreter()
+                         ->GetBytecodeSamplesObject()));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -25,6 +25,15 @@ class IgnitionStatisticsExtension : public v8::Extension {
   static void GetIgnitionDispatchCounters(
       const v8::FunctionCallbackInfo<v8::Value>& info);
 
+  // Sampling bytecode handler profiler, see interpreter::BytecodeSampler.
+  // Unlike the dispatch counters, this works without a special build.
+  static void StartIgnitionSampling(
+      const v8::FunctionCallbackInfo<v8::Value>& info);
+  static void StopIgnitionSampling(
+      const v8::FunctionCallbackInfo<v8::Value>& info);
+  static void GetIgnitionSamples(
+      const v8::FunctionCallbackInfo<v8::Value>& info);
+
  private:
   static const char* const kSource;
 };
@@ -527,6 +527,9 @@ DEFINE_BOOL(maglev_inlining, true,
             "enable inlining in the maglev optimizing compiler")
 DEFINE_BOOL(maglev_loop_peeling, false,
             "enable loop peeling in the maglev optimizing compiler")
+DEFINE_BOOL(maglev_licm, false,
+            "enable loop invariant code motion in the maglev optimizing "
+            "compiler")
 DEFINE_BOOL(maglev_deopt_data_on_background, true,
             "Generate deopt data on background thread")
 DEFINE_BOOL(maglev_build_code_on_background, true,
@@ -537,6 +540,7 @@ DEFINE_BOOL(maglev_destroy_on_background, true,
             "Destroy compilation jobs on background thread")
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_inlining)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_loop_peeling)
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_licm)
 
 DEFINE_UINT(
     concurrent_maglev_max_threads, 1,
@@ -545,7 +549,11 @@ DEFINE_BOOL(concurrent_maglev_high_priority_threads, false,
             "use high priority compiler threads for concurrent Maglev")
 
 DEFINE_INT(max_maglev_inline_depth, 1,
-           "max depth of functions that Maglev will inline")
+           "max depth of functions that Maglev will inline excl. small "
+           "functions")
+DEFINE_INT(max_maglev_hard_inline_depth, 10,
+           "max depth of functions that Maglev will inline incl. small "
+           "functions")
 DEFINE_INT(max_maglev_inlined_bytecode_size, 460,
            "maximum size of bytecode for a single inlining")
 DEFINE_INT(max_maglev_inlined_bytecode_size_cumulative, 920,
@@ -554,6 +562,9 @@ DEFINE_INT(max_maglev_inlined_bytecode_size_small, 27,
            "maximum size of bytecode considered for small function inlining")
 DEFINE_FLOAT(min_maglev_inlining_frequency, 0.10,
              "minimum frequency for inlining")
+DEFINE_BOOL(maglev_inline_unboxed_calls, true,
+            "inline small functions called with unboxed float64 arguments "
+            "regardless of call frequency, to avoid boxing them")
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, max_maglev_inline_depth, 1)
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, max_maglev_inlined_bytecode_size, 100)
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan,
@@ -561,8 +572,13 @@ DEFINE_WEAK_VALUE_IMPLICATION(turbofan,
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, min_maglev_inlining_frequency, 0.95)
 DEFINE_BOOL(maglev_reuse_stack_slots, true,
             "reuse stack slots in the maglev optimizing compiler")
+DEFINE_BOOL(maglev_split_live_ranges_at_loops, true,
+            "spill values that are live across but unused in a loop on loop "
+            "entry in the maglev register allocator")
 DEFINE_BOOL(maglev_untagged_phis, true,
             "enable phi untagging in the maglev optimizing compiler")
+DEFINE_BOOL(maglev_fast_api_calls, true,
+            "call the C functions of fast API callbacks directly from maglev")
 
 DEFINE_BOOL(
     optimize_on_next_call_optimizes_to_maglev, false,
@@ -718,6 +734,11 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(runtime_pretenuring, true,
+            "pretenure large JSON.parse and ValueDeserializer results based on "
+            "whether earlier results survived")
+DEFINE_INT(runtime_pretenuring_min_input_kb, 64,
+           "minimum input size (in KB) for runtime pretenuring feedback")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation "
@@ -728,6 +749,9 @@ DEFINE_INT(minor_ms_page_promotion_threshold, 50,
 DEFINE_INT(minor_ms_page_promotion_max_lab_threshold, 30,
            "max percentage of labs out of a page to still be considered for "
            "page promotion")
+DEFINE_BOOL(minor_ms_adaptive_page_promotion, false,
+            "lower the MinorMS page promotion threshold by up to half when "
+            "most of the young generation survived the previous cycle")
 DEFINE_BOOL(minor_ms_shortcut_strings, false,
             "short cut strings during marking")
 DEFINE_UINT(minor_ms_max_page_age, 4,
@@ -766,10 +790,24 @@ DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
 // Tiering: Sparkplug / feedback vector allocation.
 DEFINE_INT(invocation_count_for_feedback_allocation, 8,
            "invocation count required for allocating feedback vectors")
+DEFINE_INT(feedback_allocation_large_function_size, 2048,
+           "bytecode size above which allocating feedback vectors requires "
+           "proportionally more invocations (0 to disable)")
+DEFINE_INT(max_feedback_allocation_delay_factor, 4,
+           "maximum factor by which the invocation count required for "
+           "allocating feedback vectors grows for large functions")
+DEFINE_BOOL(allocate_feedback_vector_with_hint, false,
+            "allocate feedback vectors on instantiation for functions that "
+            "have had one before, e.g. in the process that produced their "
+            "code cache entry")
 
 // Tiering: Maglev.
 DEFINE_INT(invocation_count_for_maglev, 400,
            "invocation count required for optimizing with Maglev")
+DEFINE_INT(invocation_count_for_maglev_with_hint, 50,
+           "invocation count required for optimizing with Maglev when the "
+           "function has been Maglev-compiled before, e.g. in the process that "
+           "produced its code cache entry")
 DEFINE_INT(invocation_count_for_maglev_osr, 100,
            "invocation count required for maglev OSR")
 DEFINE_BOOL(osr_from_maglev, false,
@@ -788,6 +826,10 @@ DEFINE_INT(minimum_invocations_after_ic_update, 500,
            "How long to minimally wait after IC update before tier up")
 DEFINE_INT(minimum_invocations_before_optimization, 2,
            "Minimum number of invocations we need before non-OSR optimization")
+DEFINE_INT(max_deopt_count, 40,
+           "number of eager deopts after which a function is no longer "
+           "optimized with TurboFan, and after twice as many not optimized at "
+           "all (0 for no limit)")
 
 // Tiering: JIT fuzzing.
 //
@@ -823,6 +865,8 @@ DEFINE_BOOL(ignition_filter_expression_positions, true,
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
             "share feedback slots when loading the same named property from "
             "the same object")
+DEFINE_BOOL(ignition_share_constant_pools, true,
+            "share identical small constant pools between bytecode arrays")
 DEFINE_BOOL(ignition_elide_redundant_tdz_checks, true,
             "elide TDZ checks dominated by other TDZ checks")
 DEFINE_BOOL(print_bytecode, false,
@@ -936,6 +980,10 @@ DEFINE_SIZE_T(
     "max size of the shared heap (in Mbytes); "
     "other heap size flags (e.g. max_shared_heap_size) take precedence")
 
+DEFINE_INT(shared_space_max_lab_size, 256,
+           "max size of linear allocation buffers in the shared space (in "
+           "KBytes); buffers of each client grow towards it on every refill")
+
 DEFINE_BOOL(write_code_using_rwx, true,
             "flip permissions to rwx to write page instead of rw")
 DEFINE_NEG_IMPLICATION(jitless, write_code_using_rwx)
@@ -1094,6 +1142,12 @@ DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size_absolute,
 DEFINE_VALUE_IMPLICATION(stress_inline, min_inlining_frequency, 0.)
 DEFINE_IMPLICATION(stress_inline, polymorphic_inlining)
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
+DEFINE_STRING(turbo_inlining_profile_to_file, nullptr,
+              "record the functions inlined by TurboFan and write them to the "
+              "given file on isolate teardown")
+DEFINE_STRING(turbo_inlining_profile_from_file, nullptr,
+              "prefer inlining the functions recorded in the given file by "
+              "--turbo-inlining-profile-to-file")
 DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
@@ -1131,6 +1185,12 @@ DEFINE_STRING(
     turbo_profiling_output, nullptr,
     "emit data about basic block usage in builtins to this file "
     "(requires that V8 was built with v8_enable_builtins_profiling=true)")
+DEFINE_STRING(builtins_sampling_profile_output, nullptr,
+              "sample which builtins the main thread runs and which builtins "
+              "call them, and emit a profile for mksnapshot "
+              "--reorder-builtins to this file (works in any build)")
+DEFINE_INT(builtins_sampling_interval, 100,
+           "interval for --builtins-sampling-profile-output (in microseconds)")
 DEFINE_BOOL(reorder_builtins, false,
             "enable builtin reordering when run mksnapshot.")
 
@@ -1159,6 +1219,11 @@ DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
                    turbo_instruction_scheduling)
+DEFINE_BOOL(turbo_instruction_scheduling_stats, false,
+            "print the estimated cycles of each function before and after "
+            "instruction scheduling")
+DEFINE_IMPLICATION(turbo_instruction_scheduling_stats,
+                   turbo_instruction_scheduling)
 DEFINE_BOOL(turbo_store_elimination, true,
             "enable store-store elimination in TurboFan")
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
@@ -1191,6 +1256,12 @@ DEFINE_BOOL_READONLY(turbo_compress_translation_arrays, false,
 DEFINE_BOOL(turbo_inline_js_wasm_calls, true, "inline JS->Wasm calls")
 DEFINE_BOOL(turbo_use_mid_tier_regalloc_for_huge_functions, true,
             "fall back to the mid-tier register allocator for huge functions")
+DEFINE_INT(turbo_mid_tier_regalloc_virtual_registers_limit, 16384,
+           "number of virtual registers above which a function is considered "
+           "huge for register allocation")
+DEFINE_INT(turbo_mid_tier_regalloc_instructions_limit, 65536,
+           "number of instructions above which a function is considered huge "
+           "for register allocation")
 DEFINE_BOOL(turbo_force_mid_tier_regalloc, false,
             "always use the mid-tier register allocator (for testing)")
 
@@ -1268,6 +1339,13 @@ DEFINE_DEBUG_BOOL(trace_wasm_native_heap, false,
                   "trace wasm native heap events")
 DEFINE_DEBUG_BOOL(trace_wasm_serialization, false,
                   "trace serialization/deserialization")
+DEFINE_BOOL(wasm_concurrent_serialization, true,
+            "copy and relocate code on background threads when serializing "
+            "wasm modules")
+DEFINE_NEG_IMPLICATION(single_threaded, wasm_concurrent_serialization)
+DEFINE_BOOL(wasm_lazy_deserialization, false,
+            "defer copying and relocating deserialized wasm code to the first "
+            "call of each function")
 DEFINE_BOOL(wasm_async_compilation, true,
             "enable actual asynchronous compilation for WebAssembly.compile")
 DEFINE_NEG_IMPLICATION(single_threaded, wasm_async_compilation)
@@ -1342,6 +1420,12 @@ DEFINE_BOOL(
 DEFINE_BOOL(
     experimental_wasm_pgo_from_file, false,
     "experimental: read and use Wasm PGO data from a local file (for testing)")
+DEFINE_BOOL(wasm_precompile_import_wrappers, false,
+            "compile Wasm-to-JS wrappers for common signatures in the "
+            "background when the first Wasm module is created")
+DEFINE_BOOL(experimental_wasm_code_cache_files, false,
+            "experimental: share Wasm code between processes via read-only "
+            "mapped cache files in the current directory (for testing)")
 
 DEFINE_BOOL(validate_asm, true, "validate asm.js modules before compiling")
 // asm.js validation is disabled since it triggers wasm code generation.
@@ -1401,6 +1485,9 @@ DEFINE_BOOL(
     "enforce explicit bounds check even if the trap handler is available")
 // "no bounds checks" implies "no enforced bounds checks".
 DEFINE_NEG_NEG_IMPLICATION(wasm_bounds_checks, wasm_enforce_bounds_checks)
+DEFINE_BOOL(wasm_discard_zeroed_memory_pages, false,
+            "return trailing all-zero pages of non-shared Wasm memories to the "
+            "OS on memory-reducing GCs")
 DEFINE_BOOL(wasm_math_intrinsics, true,
             "intrinsify some Math imports into wasm")
 
@@ -1502,6 +1589,12 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_BOOL(adaptive_semi_space_sizing, false,
+            "size the semi-spaces from the allocation throughput, the "
+            "survival ratio and the scavenge pause target")
+DEFINE_FLOAT(scavenge_pause_target_ms, 2.0,
+             "pause time target for scavenges (in ms) used by "
+             "--adaptive-semi-space-sizing")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -1576,6 +1669,9 @@ DEFINE_BOOL(trace_fragmentation_verbose, false,
 DEFINE_BOOL(minor_ms_trace_fragmentation, false,
             "trace fragmentation after marking")
 DEFINE_BOOL(trace_evacuation, false, "report evacuation statistics")
+DEFINE_BOOL(trace_code_working_set, false,
+            "report the number of code pages holding optimized code on full "
+            "GCs")
 DEFINE_BOOL(trace_mutator_utilization, false,
             "print mutator utilization, allocation speed, gc speed")
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
@@ -1584,6 +1680,9 @@ DEFINE_BOOL(incremental_marking_bailout_when_ahead_of_schedule, true,
 DEFINE_BOOL(incremental_marking_task, true, "use tasks for incremental marking")
 DEFINE_INT(incremental_marking_task_delay_ms, 0,
            "incremental marking task delay. 0 means not using delayed tasks.")
+DEFINE_FLOAT(incremental_marking_pause_target_ms, 0,
+             "target for the longest main-thread pause of a single incremental "
+             "marking step (in ms). 0 means no target.")
 DEFINE_INT(incremental_marking_soft_trigger, 0,
            "threshold for starting incremental marking via a task in percent "
            "of available space: limit - size")
@@ -1598,6 +1697,9 @@ DEFINE_UINT(minor_gc_task_trigger, 80,
 DEFINE_BOOL(scavenge_separate_stack_scanning, false,
             "use a separate phase for stack scanning in scavenge")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
+DEFINE_INT(scavenger_max_tasks, 0,
+           "maximum number of parallel scavenge tasks (0 means that the "
+           "number of tasks only depends on the cores and new space size)")
 DEFINE_EXPERIMENTAL_FEATURE(
     cppgc_young_generation,
     "run young generation garbage collections in Oilpan")
@@ -1619,6 +1721,8 @@ DEFINE_INT(
     "max worker number of concurrent marking, 0 for NumberOfWorkerThreads")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_BOOL(array_buffer_pool, false,
+            "reuse the memory of small freed array buffers for new ones")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
@@ -1652,6 +1756,9 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_SIZE_T(
     zone_stats_tolerance, 1 * MB,
     "report a tick only when allocated zone memory changes by this amount")
+DEFINE_SIZE_T(zone_segment_pool_size, 8 * MB,
+              "max size of the zone segments kept for reuse after their zone "
+              "is destroyed")
 DEFINE_BOOL(trace_zone_type_stats, false, "trace per-type zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
@@ -1697,9 +1804,19 @@ DEFINE_BOOL(memory_reducer_single_gc, false,
 DEFINE_WEAK_IMPLICATION(future, memory_reducer_single_gc)
 DEFINE_INT(memory_reducer_gc_count, 3,
            "Maximum number of memory reducer GCs scheduled")
+DEFINE_INT(memory_budget_pressure_percent, 80,
+           "share of the embedder provided process memory budget above which "
+           "the heap optimizes for memory")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(heap_huge_pages, false,
+            "advise the OS to back the pointer compression cage and the code "
+            "range with (transparent) huge pages and group heap pages into "
+            "them")
+DEFINE_INT(numa_node, -1,
+           "NUMA node to prefer for heap pages and GC worker threads, unless "
+           "the embedder configures one (-1 for none)")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -1712,6 +1829,12 @@ DEFINE_BOOL(compact_with_stack, true,
 DEFINE_BOOL(
     compact_code_space_with_stack, true,
     "Perform code space compaction when finalizing a full GC with stack")
+DEFINE_BOOL(code_space_hotness_layout, false,
+            "When compacting code space, move optimized code to other pages "
+            "than the remaining code")
+DEFINE_INT(compact_code_space_fragmentation_percent, 50,
+           "Compact the code space with the memory reducing heuristics once "
+           "at least this percentage of it is free (0 disables)")
 DEFINE_BOOL(shortcut_strings_with_stack, true,
             "Shortcut Strings during GC with stack")
 DEFINE_BOOL(stress_compaction, false,
@@ -1725,6 +1848,9 @@ DEFINE_BOOL(flush_baseline_code, false,
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_INT(bytecode_old_age, 6, "number of gcs before we flush code")
+DEFINE_BOOL(flush_code_adaptive_age, false,
+            "adapt the number of gcs before we flush code to memory pressure "
+            "and to how often flushed functions are recompiled")
 DEFINE_BOOL(flush_code_based_on_time, false,
             "Use time-base code flushing instead of age.")
 DEFINE_BOOL(flush_code_based_on_tab_visibility, false,
@@ -1827,6 +1953,9 @@ DEFINE_BOOL(enable_sahf, true,
 DEFINE_BOOL(enable_avx, true, "enable use of AVX instructions if available")
 DEFINE_BOOL(enable_avx2, true, "enable use of AVX2 instructions if available")
 DEFINE_BOOL(enable_fma3, true, "enable use of FMA3 instructions if available")
+DEFINE_BOOL(enable_avx512, true,
+            "enable use of AVX-512 (F, DQ, BW, VL) instructions if available "
+            "(X64 only)")
 DEFINE_BOOL(enable_bmi1, true, "enable use of BMI1 instructions if available")
 DEFINE_BOOL(enable_bmi2, true, "enable use of BMI2 instructions if available")
 DEFINE_BOOL(enable_lzcnt, true, "enable use of LZCNT instruction if available")
@@ -1900,7 +2029,9 @@ DEFINE_BOOL(expose_statistics, false, "expose statistics extension")
 DEFINE_BOOL(expose_trigger_failure, false, "expose trigger-failure extension")
 DEFINE_BOOL(expose_ignition_statistics, false,
             "expose ignition-statistics extension (requires building with "
-            "v8_enable_ignition_dispatch_counting)")
+            "v8_enable_ignition_dispatch_counting for the dispatch counters)")
+DEFINE_INT(ignition_sampling_interval, 100,
+           "default interval for startIgnitionSampling() (in microseconds)")
 DEFINE_INT(stack_trace_limit, 10, "number of stack frames to capture")
 DEFINE_BOOL(builtins_in_stack_traces, false,
             "show built-in functions in stack traces")
@@ -1986,6 +2117,9 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_UINT(script_shared_code_cache_size, 0,
+            "size in KB of the process-wide cache of serialized script code "
+            "that isolates share (0 disables the cache)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -2007,6 +2141,9 @@ DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
+DEFINE_STRING(cpu_profiler_hardware_event, nullptr,
+              "hardware event to count between CPU profiler samples (cycles, "
+              "instructions, cache-misses or branch-misses; Linux only)")
 
 // debugger
 DEFINE_BOOL(
@@ -2072,6 +2209,20 @@ DEFINE_IMPLICATION(log_ic, log_code)
 DEFINE_GENERIC_IMPLICATION(
     log_ic, TracingFlags::ic_stats.store(
                 v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_BOOL(ic_site_stats, false,
+            "aggregate inline cache state transitions per feedback site")
+DEFINE_INT(ic_site_stats_top, 20,
+           "number of megamorphic sites printed with --ic-site-stats")
+
+// stub-cache.cc
+DEFINE_INT(stub_cache_primary_table_bits, 11,
+           "log2 of the initial number of entries in the primary table of "
+           "the megamorphic stub caches")
+DEFINE_INT(stub_cache_max_primary_table_bits, 14,
+           "log2 of the number of entries up to which the primary table of "
+           "the megamorphic stub caches grows when they miss often")
+DEFINE_BOOL(trace_stub_cache_growth, false,
+            "trace growing the megamorphic stub caches")
 DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
@@ -2210,6 +2361,16 @@ DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
 DEFINE_IMPLICATION(rcs_cpu_time, rcs)
 
+DEFINE_BOOL(rcs_sampling, false,
+            "periodically sample the current runtime call counter instead of "
+            "timing runtime calls, and report the samples via v8::metrics")
+DEFINE_GENERIC_IMPLICATION(
+    rcs_sampling,
+    TracingFlags::runtime_stats.fetch_or(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING))
+DEFINE_INT(rcs_sampling_interval, 1000,
+           "interval between two runtime call samples in microseconds")
+
 // snapshot-common.cc
 DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "Verify snapshot checksums when deserializing snapshots. Enable "
@@ -2236,6 +2397,12 @@ DEFINE_INT(regexp_tier_up_ticks, 1,
            "tiering-up to the compiler")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
+DEFINE_UINT(regexp_shared_bytecode_cache_size, 0,
+            "size in KB of the process-wide cache of regexp bytecode that "
+            "isolates share (0 disables the cache)")
+DEFINE_BOOL(regexp_simd_skip, true,
+            "use a vectorized search to skip to candidate match positions in "
+            "native regexp code")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
@@ -2253,6 +2420,9 @@ DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+DEFINE_UINT(experimental_regexp_engine_dfa_budget, 256,
+            "memory budget in KB of each lazily built DFA of the experimental "
+            "regexp engine (0 disables the DFA)")
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
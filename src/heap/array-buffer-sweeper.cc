@@ -4,8 +4,10 @@
 
 #include "src/heap/array-buffer-sweeper.h"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
+#include <new>
 
 #include "src/base/logging.h"
 #include "src/heap/gc-tracer-inl.h"
@@ -20,84 +22,97 @@
 namespace v8 {
 namespace internal {
 
-void ArrayBufferList::Append(ArrayBufferExtension* extension) {
-  if (head_ == nullptr) {
-    DCHECK_NULL(tail_);
-    head_ = tail_ = extension;
-  } else {
-    tail_->set_next(extension);
-    tail_ = extension;
-  }
-
-  const size_t accounting_length = extension->accounting_length();
-  DCHECK_GE(bytes_ + accounting_length, bytes_);
-  bytes_ += accounting_length;
-  extension->set_next(nullptr);
+ArrayBufferExtensionSlab::~ArrayBufferExtensionSlab() {
+  ForEachSlot(used_,
+              [this](int index) { slot(index)->~ArrayBufferExtension(); });
 }
 
-void ArrayBufferList::Append(ArrayBufferList* list) {
-  if (head_ == nullptr) {
-    DCHECK_NULL(tail_);
-    head_ = list->head_;
-    tail_ = list->tail_;
-  } else if (list->head_) {
-    DCHECK_NOT_NULL(list->tail_);
-    tail_->set_next(list->head_);
-    tail_ = list->tail_;
-  } else {
-    DCHECK_NULL(list->tail_);
-  }
+ArrayBufferExtension* ArrayBufferExtensionSlab::Allocate(bool young) {
+  DCHECK(!IsFull());
+  const int index = base::bits::CountTrailingZeros(~used_);
+  const Bitmap bit = Bitmap{1} << index;
+  used_ |= bit;
+  if (young) young_ |= bit;
+  return new (slot(index)) ArrayBufferExtension();
+}
 
-  bytes_ += list->ApproximateBytes();
-  *list = ArrayBufferList();
+void ArrayBufferExtensionSlab::Free(int index) {
+  const Bitmap bit = Bitmap{1} << index;
+  DCHECK_NE(used_ & bit, 0);
+  slot(index)->~ArrayBufferExtension();
+  used_ &= ~bit;
+  young_ &= ~bit;
 }
 
-bool ArrayBufferList::ContainsSlow(ArrayBufferExtension* extension) const {
-  for (ArrayBufferExtension* current = head_; current;
-       current = current->next()) {
-    if (current == extension) return true;
-  }
-  return false;
+bool ArrayBufferExtensionSlab::Contains(const ArrayBufferExtension* extension,
+                                        bool young) const {
+  const Address start = reinterpret_cast<Address>(slots_);
+  const Address address = reinterpret_cast<Address>(extension);
+  if (address < start || address >= start + sizeof(slots_)) return false;
+  DCHECK_EQ((address - start) % sizeof(ArrayBufferExtension), 0);
+  const Bitmap bit = Bitmap{1}
+                     << ((address - start) / sizeof(ArrayBufferExtension));
+  return (used_ & bit) != 0 && ((young_ & bit) != 0) == young;
 }
 
-size_t ArrayBufferList::BytesSlow() const {
-  ArrayBufferExtension* current = head_;
+size_t ArrayBufferExtensionSlab::Bytes(bool young) const {
   size_t sum = 0;
-  while (current) {
-    sum += current->accounting_length();
-    current = current->next();
-  }
-  DCHECK_GE(sum, ApproximateBytes());
+  ForEachSlot(young ? young_ : used_ & ~young_, [this, &sum](int index) {
+    sum += slot(index)->accounting_length();
+  });
   return sum;
 }
 
-bool ArrayBufferList::IsEmpty() const {
-  DCHECK_IMPLIES(head_, tail_);
-  DCHECK_IMPLIES(!head_, bytes_ == 0);
-  return head_ == nullptr;
+void ArrayBufferExtensionSlab::SweepYoung(bool promote_all,
+                                          SweepResult* result) {
+  ForEachSlot(young_, [this, promote_all, result](int index) {
+    ArrayBufferExtension* extension = slot(index);
+    const size_t bytes = extension->accounting_length();
+    if (!extension->IsYoungMarked()) {
+      Free(index);
+      result->freed_bytes += bytes;
+    } else if (promote_all || extension->IsYoungPromoted()) {
+      extension->YoungUnmark();
+      young_ &= ~(Bitmap{1} << index);
+      result->old_bytes += bytes;
+    } else {
+      extension->YoungUnmark();
+      result->young_bytes += bytes;
+    }
+  });
+}
+
+void ArrayBufferExtensionSlab::SweepFull(SweepResult* result) {
+  ForEachSlot(used_, [this, result](int index) {
+    ArrayBufferExtension* extension = slot(index);
+    const size_t bytes = extension->accounting_length();
+    if (!extension->IsMarked()) {
+      Free(index);
+      result->freed_bytes += bytes;
+    } else {
+      extension->Unmark();
+      result->old_bytes += bytes;
+    }
+  });
+  young_ = 0;
 }
 
 struct ArrayBufferSweeper::SweepingJob final {
-  SweepingJob(ArrayBufferList young, ArrayBufferList old, SweepingType type,
+  SweepingJob(SlabList slabs, SweepingType type,
               TreatAllYoungAsPromoted treat_all_young_as_promoted)
       : state_(SweepingState::kInProgress),
-        young_(std::move(young)),
-        old_(std::move(old)),
+        slabs_(std::move(slabs)),
         type_(type),
         treat_all_young_as_promoted_(treat_all_young_as_promoted) {}
 
   void Sweep();
-  void SweepYoung();
-  void SweepFull();
-  ArrayBufferList SweepListFull(ArrayBufferList* list);
 
  private:
   CancelableTaskManager::Id id_ = CancelableTaskManager::kInvalidTaskId;
   std::atomic<SweepingState> state_;
-  ArrayBufferList young_;
-  ArrayBufferList old_;
+  SlabList slabs_;
   const SweepingType type_;
-  size_t freed_bytes_{0};
+  ArrayBufferExtensionSlab::SweepResult result_;
   TreatAllYoungAsPromoted treat_all_young_as_promoted_;
 
   friend class ArrayBufferSweeper;
@@ -108,8 +123,7 @@ ArrayBufferSweeper::ArrayBufferSweeper(Heap* heap)
 
 ArrayBufferSweeper::~ArrayBufferSweeper() {
   EnsureFinished();
-  ReleaseAll(&old_);
-  ReleaseAll(&young_);
+  slabs_.clear();
 }
 
 void ArrayBufferSweeper::EnsureFinished() {
@@ -156,8 +170,12 @@ void ArrayBufferSweeper::RequestSweep(
     SweepingType type, TreatAllYoungAsPromoted treat_all_young_as_promoted) {
   DCHECK(!sweeping_in_progress());
 
-  if (young_.IsEmpty() && (old_.IsEmpty() || type == SweepingType::kYoung))
+  if (slabs_.empty()) return;
+  if (type == SweepingType::kYoung &&
+      std::none_of(slabs_.begin(), slabs_.end(),
+                   [](const auto& slab) { return slab->HasYoung(); })) {
     return;
+  }
 
   GCTracer::Scope::ScopeId scope_id =
       type == SweepingType::kYoung
@@ -210,40 +228,58 @@ void ArrayBufferSweeper::Prepare(
   DCHECK(!sweeping_in_progress());
   DCHECK_IMPLIES(type == SweepingType::kFull,
                  treat_all_young_as_promoted == TreatAllYoungAsPromoted::kYes);
+  SlabList job_slabs;
   switch (type) {
     case SweepingType::kYoung: {
-      job_ = std::make_unique<SweepingJob>(std::move(young_), ArrayBufferList(),
-                                           type, treat_all_young_as_promoted);
-      young_ = ArrayBufferList();
+      // Only slabs containing young extensions need to be swept. The other
+      // slabs stay with the main thread and keep serving allocations.
+      SlabList remaining;
+      for (auto& slab : slabs_) {
+        (slab->HasYoung() ? job_slabs : remaining).push_back(std::move(slab));
+      }
+      slabs_ = std::move(remaining);
+      young_bytes_ = 0;
     } break;
     case SweepingType::kFull: {
-      job_ = std::make_unique<SweepingJob>(std::move(young_), std::move(old_),
-                                           type, treat_all_young_as_promoted);
-      young_ = ArrayBufferList();
-      old_ = ArrayBufferList();
+      job_slabs = std::move(slabs_);
+      slabs_.clear();
+      young_bytes_ = 0;
+      old_bytes_ = 0;
     } break;
   }
+  first_free_slab_ = 0;
+  job_ = std::make_unique<SweepingJob>(std::move(job_slabs), type,
+                                       treat_all_young_as_promoted);
   DCHECK(sweeping_in_progress());
 }
 
 void ArrayBufferSweeper::Finalize() {
   DCHECK(sweeping_in_progress());
   CHECK_EQ(job_->state_, SweepingState::kDone);
-  young_.Append(&job_->young_);
-  old_.Append(&job_->old_);
-  DecrementExternalMemoryCounters(job_->freed_bytes_);
+  for (auto& slab : job_->slabs_) {
+    // Empty slabs are released eagerly instead of being kept for reuse.
+    if (!slab->IsEmpty()) slabs_.push_back(std::move(slab));
+  }
+  first_free_slab_ = 0;
+  young_bytes_ += job_->result_.young_bytes;
+  old_bytes_ += job_->result_.old_bytes;
+  DecrementExternalMemoryCounters(job_->result_.freed_bytes);
   job_.reset();
   DCHECK(!sweeping_in_progress());
 }
 
-void ArrayBufferSweeper::ReleaseAll(ArrayBufferList* list) {
-  ArrayBufferExtension* current = list->head_;
-  while (current) {
-    ArrayBufferExtension* next = current->next();
-    delete current;
-    current = next;
+ArrayBufferExtension* ArrayBufferSweeper::Allocate(JSArrayBuffer object) {
+  // Finishing sweeping first hands swept slabs back for reuse.
+  FinishIfDone();
+
+  while (first_free_slab_ < slabs_.size() &&
+         slabs_[first_free_slab_]->IsFull()) {
+    first_free_slab_++;
   }
-  *list = ArrayBufferList();
+  if (first_free_slab_ == slabs_.size()) {
+    slabs_.push_back(std::make_unique<ArrayBufferExtensionSlab>());
+  }
+  return slabs_[first_free_slab_]->Allocate(Heap::InYoungGeneration(object));
 }
 
 void ArrayBufferSweeper::Append(JSArrayBuffer object,
@@ -253,9 +289,11 @@ void ArrayBufferSweeper::Append(JSArrayBuffer object,
   FinishIfDone();
 
   if (Heap::InYoungGeneration(object)) {
-    young_.Append(extension);
+    DCHECK(ContainsYoungSlow(extension));
+    young_bytes_ += bytes;
   } else {
-    old_.Append(extension);
+    DCHECK(ContainsOldSlow(extension));
+    old_bytes_ += bytes;
   }
 
   IncrementExternalMemoryCounters(bytes);
@@ -269,25 +307,60 @@ void ArrayBufferSweeper::Detach(JSArrayBuffer object,
 
   size_t bytes = extension->ClearAccountingLength();
 
-  // We cannot free the extension eagerly here, since extensions are tracked in
-  // a singly linked list. The next GC will remove it automatically.
+  // We cannot free the extension eagerly here, since it may be owned by a
+  // concurrent sweeping job. The next GC will remove it automatically.
 
   if (!sweeping_in_progress()) {
     // If concurrent sweeping isn't running at the moment, we can also adjust
-    // the respective bytes in the corresponding ArrayBufferLists as they are
-    // only approximate.
+    // the respective bytes as they are only approximate.
     if (Heap::InYoungGeneration(object)) {
-      DCHECK_GE(young_.bytes_, bytes);
-      young_.bytes_ -= bytes;
+      DCHECK_GE(young_bytes_, bytes);
+      young_bytes_ -= bytes;
     } else {
-      DCHECK_GE(old_.bytes_, bytes);
-      old_.bytes_ -= bytes;
+      DCHECK_GE(old_bytes_, bytes);
+      old_bytes_ -= bytes;
     }
   }
 
   DecrementExternalMemoryCounters(bytes);
 }
 
+bool ArrayBufferSweeper::ContainsSlow(ArrayBufferExtension* extension,
+                                      bool young) const {
+  return std::any_of(slabs_.begin(), slabs_.end(),
+                     [extension, young](const auto& slab) {
+                       return slab->Contains(extension, young);
+                     });
+}
+
+bool ArrayBufferSweeper::ContainsYoungSlow(
+    ArrayBufferExtension* extension) const {
+  return ContainsSlow(extension, true);
+}
+
+bool ArrayBufferSweeper::ContainsOldSlow(
+    ArrayBufferExtension* extension) const {
+  return ContainsSlow(extension, false);
+}
+
+size_t ArrayBufferSweeper::BytesSlow(bool young) const {
+  size_t sum = 0;
+  for (const auto& slab : slabs_) sum += slab->Bytes(young);
+  return sum;
+}
+
+size_t ArrayBufferSweeper::YoungBytesSlow() const {
+  size_t sum = BytesSlow(true);
+  DCHECK_GE(sum, YoungBytes());
+  return sum;
+}
+
+size_t ArrayBufferSweeper::OldBytesSlow() const {
+  size_t sum = BytesSlow(false);
+  DCHECK_GE(sum, OldBytes());
+  return sum;
+}
+
 void ArrayBufferSweeper::IncrementExternalMemoryCounters(size_t bytes) {
   if (bytes == 0) return;
   heap_->IncrementExternalBackingStoreBytes(
@@ -307,79 +380,21 @@ void ArrayBufferSweeper::DecrementExternalMemoryCounters(size_t bytes) {
 
 void ArrayBufferSweeper::SweepingJob::Sweep() {
   CHECK_EQ(state_, SweepingState::kInProgress);
-  switch (type_) {
-    case SweepingType::kYoung:
-      SweepYoung();
-      break;
-    case SweepingType::kFull:
-      SweepFull();
-      break;
-  }
-  state_ = SweepingState::kDone;
-}
-
-void ArrayBufferSweeper::SweepingJob::SweepFull() {
-  DCHECK_EQ(SweepingType::kFull, type_);
-  ArrayBufferList promoted = SweepListFull(&young_);
-  ArrayBufferList survived = SweepListFull(&old_);
-
-  old_ = std::move(promoted);
-  old_.Append(&survived);
-}
-
-ArrayBufferList ArrayBufferSweeper::SweepingJob::SweepListFull(
-    ArrayBufferList* list) {
-  ArrayBufferExtension* current = list->head_;
-  ArrayBufferList survivor_list;
-
-  while (current) {
-    ArrayBufferExtension* next = current->next();
-
-    if (!current->IsMarked()) {
-      const size_t bytes = current->accounting_length();
-      delete current;
-      if (bytes) freed_bytes_ += bytes;
-    } else {
-      current->Unmark();
-      survivor_list.Append(current);
-    }
-
-    current = next;
-  }
-
-  *list = ArrayBufferList();
-  return survivor_list;
-}
-
-void ArrayBufferSweeper::SweepingJob::SweepYoung() {
-  DCHECK_EQ(SweepingType::kYoung, type_);
-  ArrayBufferExtension* current = young_.head_;
-
-  ArrayBufferList new_young;
-  ArrayBufferList new_old;
-
-  while (current) {
-    ArrayBufferExtension* next = current->next();
-
-    if (!current->IsYoungMarked()) {
-      size_t bytes = current->accounting_length();
-      delete current;
-      if (bytes) freed_bytes_ += bytes;
-    } else if ((treat_all_young_as_promoted_ ==
-                TreatAllYoungAsPromoted::kYes) ||
-               current->IsYoungPromoted()) {
-      current->YoungUnmark();
-      new_old.Append(current);
-    } else {
-      current->YoungUnmark();
-      new_young.Append(current);
+  const bool promote_all =
+      treat_all_young_as_promoted_ == TreatAllYoungAsPromoted::kYes;
+  // Slabs are walked linearly; within a slab only the slots selected by the
+  // bitmaps are visited.
+  for (auto& slab : slabs_) {
+    switch (type_) {
+      case SweepingType::kYoung:
+        slab->SweepYoung(promote_all, &result_);
+        break;
+      case SweepingType::kFull:
+        slab->SweepFull(&result_);
+        break;
     }
-
-    current = next;
   }
-
-  old_ = new_old;
-  young_ = new_young;
+  state_ = SweepingState::kDone;
 }
 
 uint64_t ArrayBufferSweeper::GetTraceIdForFlowEvent(
@@ -6,12 +6,15 @@
 #define V8_HEAP_ARRAY_BUFFER_SWEEPER_H_
 
 #include <memory>
+#include <vector>
 
+#include "src/base/bits.h"
 #include "src/base/logging.h"
 #include "src/base/platform/mutex.h"
 #include "src/heap/sweeper.h"
 #include "src/objects/js-array-buffer.h"
 #include "src/tasks/cancelable-task.h"
+#include "src/utils/allocation.h"
 
 namespace v8 {
 namespace internal {
@@ -19,27 +22,73 @@ namespace internal {
 class ArrayBufferExtension;
 class Heap;
 
-// Singly linked-list of ArrayBufferExtensions that stores head and tail of the
-// list to allow for concatenation of lists.
-struct ArrayBufferList final {
-  bool IsEmpty() const;
-  size_t ApproximateBytes() const { return bytes_; }
-  size_t BytesSlow() const;
+// ArrayBufferExtensions are allocated in slabs of kSlots extensions. Bitmaps
+// record which slots are in use and which of them belong to the young
+// generation, so that sweeping walks the slabs linearly and dead extensions
+// are freed without going through malloc.
+class ArrayBufferExtensionSlab final : public Malloced {
+ public:
+  static constexpr int kSlots = 64;
+
+  // Bytes of the extensions visited by sweeping, by their generation after
+  // sweeping.
+  struct SweepResult {
+    size_t young_bytes = 0;
+    size_t old_bytes = 0;
+    size_t freed_bytes = 0;
+  };
+
+  ArrayBufferExtensionSlab() = default;
+  ~ArrayBufferExtensionSlab();
+  ArrayBufferExtensionSlab(const ArrayBufferExtensionSlab&) = delete;
+  ArrayBufferExtensionSlab& operator=(const ArrayBufferExtensionSlab&) = delete;
+
+  bool IsFull() const { return used_ == kAllSlots; }
+  bool IsEmpty() const { return used_ == 0; }
+  bool HasYoung() const { return young_ != 0; }
+
+  // Allocates an extension in a free slot of a slab that is not full.
+  ArrayBufferExtension* Allocate(bool young);
 
-  void Append(ArrayBufferExtension* extension);
-  void Append(ArrayBufferList* list);
+  bool Contains(const ArrayBufferExtension* extension, bool young) const;
+  size_t Bytes(bool young) const;
 
-  V8_EXPORT_PRIVATE bool ContainsSlow(ArrayBufferExtension* extension) const;
+  // Frees unmarked extensions. Surviving young extensions are kept young
+  // unless they were promoted or |promote_all| is set.
+  void SweepYoung(bool promote_all, SweepResult* result);
+  // Frees unmarked extensions. Survivors are old afterwards.
+  void SweepFull(SweepResult* result);
 
  private:
-  ArrayBufferExtension* head_ = nullptr;
-  ArrayBufferExtension* tail_ = nullptr;
-  // Bytes are approximate as they may be subtracted eagerly, while the
-  // `ArrayBufferExtension` is still in the list. The extension will only be
-  // dropped on next sweep.
-  size_t bytes_ = 0;
-
-  friend class ArrayBufferSweeper;
+  using Bitmap = uint64_t;
+  static constexpr Bitmap kAllSlots = ~Bitmap{0};
+  static_assert(kSlots == sizeof(Bitmap) * kBitsPerByte);
+
+  ArrayBufferExtension* slot(int index) {
+    return reinterpret_cast<ArrayBufferExtension*>(
+        &slots_[index * sizeof(ArrayBufferExtension)]);
+  }
+  const ArrayBufferExtension* slot(int index) const {
+    return reinterpret_cast<const ArrayBufferExtension*>(
+        &slots_[index * sizeof(ArrayBufferExtension)]);
+  }
+
+  void Free(int index);
+
+  template <typename Callback>
+  static void ForEachSlot(Bitmap slots, Callback callback) {
+    while (slots != 0) {
+      const int index = base::bits::CountTrailingZeros(slots);
+      slots &= slots - 1;
+      callback(index);
+    }
+  }
+
+  Bitmap used_ = 0;
+  // Subset of used_.
+  Bitmap young_ = 0;
+  alignas(ArrayBufferExtension) uint8_t
+      slots_[kSlots * sizeof(ArrayBufferExtension)];
 };
 
 // The ArrayBufferSweeper iterates and deletes ArrayBufferExtensions
@@ -56,19 +105,30 @@ class ArrayBufferSweeper final {
                     TreatAllYoungAsPromoted treat_all_young_as_promoted);
   void EnsureFinished();
 
-  // Track the given ArrayBufferExtension for the given JSArrayBuffer.
+  // Allocates an ArrayBufferExtension for the given JSArrayBuffer.
+  ArrayBufferExtension* Allocate(JSArrayBuffer object);
+
+  // Accounts the given ArrayBufferExtension for the given JSArrayBuffer.
   void Append(JSArrayBuffer object, ArrayBufferExtension* extension);
 
   // Detaches an ArrayBufferExtension from a JSArrayBuffer.
   void Detach(JSArrayBuffer object, ArrayBufferExtension* extension);
 
-  const ArrayBufferList& young() const { return young_; }
-  const ArrayBufferList& old() const { return old_; }
-
-  // Bytes accounted in the young generation. Rebuilt during sweeping.
-  size_t YoungBytes() const { return young().ApproximateBytes(); }
+  // Bytes accounted in the young generation. Rebuilt during sweeping. Bytes
+  // are approximate as they may be subtracted eagerly, while the
+  // `ArrayBufferExtension` is still allocated. The extension will only be
+  // freed on next sweep.
+  size_t YoungBytes() const { return young_bytes_; }
   // Bytes accounted in the old generation. Rebuilt during sweeping.
-  size_t OldBytes() const { return old().ApproximateBytes(); }
+  size_t OldBytes() const { return old_bytes_; }
+
+  // Whether the extension is tracked in the respective generation. Extensions
+  // that are being swept concurrently are not considered.
+  V8_EXPORT_PRIVATE bool ContainsYoungSlow(
+      ArrayBufferExtension* extension) const;
+  V8_EXPORT_PRIVATE bool ContainsOldSlow(ArrayBufferExtension* extension) const;
+  size_t YoungBytesSlow() const;
+  size_t OldBytesSlow() const;
 
   bool sweeping_in_progress() const { return job_.get(); }
 
@@ -76,6 +136,7 @@ class ArrayBufferSweeper final {
 
  private:
   struct SweepingJob;
+  using SlabList = std::vector<std::unique_ptr<ArrayBufferExtensionSlab>>;
 
   enum class SweepingState { kInProgress, kDone };
 
@@ -91,16 +152,22 @@ class ArrayBufferSweeper final {
                TreatAllYoungAsPromoted treat_all_young_as_promoted);
   void Finalize();
 
-  void ReleaseAll(ArrayBufferList* extension);
-
   void DoSweep();
 
+  bool ContainsSlow(ArrayBufferExtension* extension, bool young) const;
+  size_t BytesSlow(bool young) const;
+
   Heap* const heap_;
   std::unique_ptr<SweepingJob> job_;
   base::Mutex sweeping_mutex_;
   base::ConditionVariable job_finished_;
-  ArrayBufferList young_;
-  ArrayBufferList old_;
+  // Slabs owned by the main thread. Slabs that are swept concurrently are
+  // owned by the job and handed back when it is finalized.
+  SlabList slabs_;
+  // Slabs before this index are full.
+  size_t first_free_slab_ = 0;
+  size_t young_bytes_ = 0;
+  size_t old_bytes_ = 0;
   Sweeper::LocalSweeper local_sweeper_;
 };
 
@@ -126,6 +126,7 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   params.page_size = kPageSize;
   params.jit =
       v8_flags.jitless ? JitPermission::kNoJit : JitPermission::kMapAsJittable;
+  params.use_huge_pages = v8_flags.heap_huge_pages;
 
   const size_t allocate_page_size = page_allocator->AllocatePageSize();
   // TODO(v8:11880): Use base_alignment here once ChromeOS issue is fixed.
@@ -4,6 +4,8 @@
 
 #include "src/heap/concurrent-allocator.h"
 
+#include <algorithm>
+
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/handles/persistent-handles.h"
@@ -79,12 +81,30 @@ void StressConcurrentAllocatorTask::Schedule(Isolate* isolate) {
                                                       kDelayInSeconds);
 }
 
+namespace {
+
+size_t MaxLabSizeLimit(PagedSpace* space,
+                       ConcurrentAllocator::Context context) {
+  if (space->identity() != SHARED_SPACE ||
+      context == ConcurrentAllocator::Context::kGC) {
+    return ConcurrentAllocator::kMaxLabSize;
+  }
+  const size_t limit =
+      std::min(static_cast<size_t>(v8_flags.shared_space_max_lab_size) * KB,
+               static_cast<size_t>(space->AreaSize()));
+  return std::max(limit, static_cast<size_t>(ConcurrentAllocator::kMaxLabSize));
+}
+
+}  // namespace
+
 ConcurrentAllocator::ConcurrentAllocator(LocalHeap* local_heap,
                                          PagedSpace* space, Context context)
     : local_heap_(local_heap),
       space_(space),
       owning_heap_(space_->heap()),
-      context_(context) {
+      context_(context),
+      max_lab_size_(kMaxLabSize),
+      max_lab_size_limit_(MaxLabSizeLimit(space, context)) {
   DCHECK_IMPLIES(!local_heap_, context_ == Context::kGC);
 }
 
@@ -162,8 +182,9 @@ AllocationResult ConcurrentAllocator::AllocateInLabSlow(
 }
 
 bool ConcurrentAllocator::AllocateLab(AllocationOrigin origin) {
-  auto result = AllocateFromSpaceFreeList(kMinLabSize, kMaxLabSize, origin);
+  auto result = AllocateFromSpaceFreeList(kMinLabSize, max_lab_size_, origin);
   if (!result) return false;
+  GrowMaxLabSize();
 
   owning_heap()->StartIncrementalMarkingIfAllocationLimitIsReachedBackground();
 
@@ -295,6 +316,10 @@ AllocationResult ConcurrentAllocator::AllocateOutsideLab(
   return AllocationResult::FromObject(object);
 }
 
+void ConcurrentAllocator::GrowMaxLabSize() {
+  max_lab_size_ = std::min(2 * max_lab_size_, max_lab_size_limit_);
+}
+
 bool ConcurrentAllocator::IsBlackAllocationEnabled() const {
   return context_ == Context::kNotGC &&
          owning_heap()->incremental_marking()->black_allocation();
@@ -33,6 +33,11 @@ class StressConcurrentAllocatorTask : public CancelableTask {
 
 // Concurrent allocator for allocation from background threads/tasks.
 // Allocations are served from a TLAB if possible.
+//
+// In the shared space all client isolates contend on the space's free list
+// and mutex. There the LAB size doubles on every refill up to
+// --shared-space-max-lab-size, such that allocation heavy clients end up
+// refilling from pages of their own.
 class ConcurrentAllocator {
  public:
   enum class Context {
@@ -85,6 +90,9 @@ class ConcurrentAllocator {
 
   bool IsBlackAllocationEnabled() const;
 
+  // Grows the size of the next LAB if the refill policy of the space allows it.
+  void GrowMaxLabSize();
+
   // Checks whether the LAB is currently in use.
   V8_INLINE bool IsLabValid() { return lab_.top() != kNullAddress; }
 
@@ -103,6 +111,10 @@ class ConcurrentAllocator {
   Heap* const owning_heap_;
   LinearAllocationArea lab_;
   const Context context_;
+  // The maximum size of the next LAB.
+  size_t max_lab_size_;
+  // The upper bound of max_lab_size_.
+  const size_t max_lab_size_limit_;
 };
 
 }  // namespace internal
@@ -10,6 +10,7 @@
 
 #include "include/v8config.h"
 #include "src/base/logging.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -248,6 +249,8 @@ class ConcurrentMarking::JobTaskMajor : public v8::JobTask {
                                     mark_compact_epoch_,
                                     should_keep_ages_unchanged_);
     } else {
+      base::NumaNodeAffinityScope numa_scope(
+          concurrent_marking_->heap_->numa_node());
       TRACE_GC_EPOCH(concurrent_marking_->heap_->tracer(),
                      GCTracer::Scope::MC_BACKGROUND_MARKING,
                      ThreadKind::kBackground);
@@ -283,6 +286,8 @@ class ConcurrentMarking::JobTaskMinor : public v8::JobTask {
       // TRACE_GC is not needed here because the caller opens the right scope.
       concurrent_marking_->RunMinor(delegate);
     } else {
+      base::NumaNodeAffinityScope numa_scope(
+          concurrent_marking_->heap_->numa_node());
       TRACE_GC_EPOCH(concurrent_marking_->heap_->tracer(),
                      GCTracer::Scope::MINOR_MS_BACKGROUND_MARKING,
                      ThreadKind::kBackground);
@@ -420,6 +425,9 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
       marked_bytes += current_marked_bytes;
       base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes,
                                                 marked_bytes);
+      // Let idle tasks steal from this task's local segments, e.g. the
+      // remaining chunks of a large array, when the global pool ran dry.
+      local_marking_worklists.ShareWork();
       if (delegate->ShouldYield()) {
         TRACE_GC_NOTE("ConcurrentMarking::RunMajor Preempted");
         break;
@@ -526,6 +534,7 @@ void ConcurrentMarking::RunMinor(JobDelegate* delegate) {
         marked_bytes += current_marked_bytes;
         base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes,
                                                   marked_bytes);
+        local_marking_worklists.ShareWork();
         if (delegate->ShouldYield()) {
           TRACE_GC_NOTE("ConcurrentMarking::RunMinor Preempted");
           break;
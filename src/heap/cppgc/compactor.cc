@@ -4,6 +4,7 @@
 
 #include "src/heap/cppgc/compactor.h"
 
+#include <algorithm>
 #include <map>
 #include <numeric>
 #include <unordered_map>
@@ -28,6 +29,11 @@ namespace {
 // should be considered.
 static constexpr size_t kFreeListSizeThreshold = 512 * kKB;
 
+// Default upper bound on live bytes evacuated in a single atomic pause.
+// Compaction is atomic, so its pause time is proportional to the bytes
+// moved. Spaces that do not fit are compacted in later garbage collections.
+static constexpr size_t kDefaultCompactionBudget = 4 * kMB;
+
 // The real worker behind heap compaction, recording references to movable
 // objects ("slots".) When the objects end up being compacted and moved,
 // relocate() will adjust the slots to point to the new location of the
@@ -82,6 +88,10 @@ class MovableReferences final {
 #endif  // DEBUG
 };
 
+bool IsCompacted(const BaseSpace& space) {
+  return space.is_compactable() && NormalPageSpace::From(space).is_compacted();
+}
+
 void MovableReferences::AddOrFilter(MovableReference* slot) {
   const BasePage* slot_page = BasePage::FromInnerAddress(&heap_, slot);
   CHECK_NOT_NULL(slot_page);
@@ -106,7 +116,8 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   // The following cases are not compacted and do not require recording:
   // - Compactable object on large pages.
   // - Compactable object on non-compactable spaces.
-  if (value_page->is_large() || !value_page->space().is_compactable()) return;
+  // - Compactable object on spaces not compacted in this cycle.
+  if (value_page->is_large() || !IsCompacted(value_page->space())) return;
 
   // Slots must reside in and values must point to live objects at this
   // point. |value| usually points to a separate object but can also point
@@ -127,7 +138,7 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   movable_references_.emplace(value, slot);
 
   // Check whether the slot itself resides on a page that is compacted.
-  if (V8_LIKELY(!slot_page->space().is_compactable())) return;
+  if (V8_LIKELY(!IsCompacted(slot_page->space()))) return;
 
   CHECK_EQ(interior_movable_references_.end(),
            interior_movable_references_.find(slot));
@@ -455,7 +466,8 @@ size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
 
 }  // namespace
 
-Compactor::Compactor(RawHeap& heap) : heap_(heap) {
+Compactor::Compactor(RawHeap& heap)
+    : heap_(heap), compaction_budget_(kDefaultCompactionBudget) {
   for (auto& space : heap_) {
     if (!space->is_compactable()) continue;
     DCHECK_EQ(&heap, space->raw_heap());
@@ -483,6 +495,33 @@ bool Compactor::ShouldCompact(GCConfig::MarkingType marking_type,
   return free_list_size > kFreeListSizeThreshold;
 }
 
+std::vector<NormalPageSpace*> Compactor::SelectSpacesToCompact() const {
+  std::vector<NormalPageSpace*> candidates;
+  for (NormalPageSpace* space : compactable_spaces_) {
+    if (space->size()) candidates.push_back(space);
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const NormalPageSpace* a, const NormalPageSpace* b) {
+                     return a->free_list().Size() > b->free_list().Size();
+                   });
+  std::vector<NormalPageSpace*> selected;
+  size_t live_bytes = 0;
+  for (NormalPageSpace* space : candidates) {
+    // Free list sizes are from the previous cycle, so this is only an
+    // estimate of the bytes that need to be moved.
+    const size_t capacity = space->size() * NormalPage::PayloadSize();
+    const size_t space_live_bytes =
+        capacity - std::min(capacity, space->free_list().Size());
+    if (!selected.empty() &&
+        live_bytes + space_live_bytes > compaction_budget_) {
+      continue;
+    }
+    live_bytes += space_live_bytes;
+    selected.push_back(space);
+  }
+  return selected;
+}
+
 void Compactor::InitializeIfShouldCompact(GCConfig::MarkingType marking_type,
                                           StackState stack_state) {
   DCHECK(!is_enabled_);
@@ -513,6 +552,14 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   StatsCollector::EnabledScope stats_scope(heap_.heap()->stats_collector(),
                                            StatsCollector::kAtomicCompact);
 
+  // Spaces must be selected before slots are filtered as only references to
+  // objects on selected spaces are recorded.
+  const std::vector<NormalPageSpace*> spaces_to_compact =
+      SelectSpacesToCompact();
+  for (NormalPageSpace* space : spaces_to_compact) {
+    space->set_is_compacted(true);
+  }
+
   MovableReferences movable_references(*heap_.heap());
 
   CompactionWorklists::MovableReferencesWorklist::Local local(
@@ -525,7 +572,7 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
 
   const bool young_gen_enabled = heap_.heap()->generational_gc_supported();
 
-  for (NormalPageSpace* space : compactable_spaces_) {
+  for (NormalPageSpace* space : spaces_to_compact) {
     CompactSpace(
         space, movable_references,
         young_gen_enabled ? StickyBits::kEnabled : StickyBits::kDisabled);
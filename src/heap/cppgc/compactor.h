@@ -36,9 +36,15 @@ class V8_EXPORT_PRIVATE Compactor final {
 
   void EnableForNextGCForTesting();
   bool IsEnabledForTesting() const { return is_enabled_; }
+  void SetCompactionBudgetForTesting(size_t budget) {
+    compaction_budget_ = budget;
+  }
 
  private:
   bool ShouldCompact(GCConfig::MarkingType, StackState) const;
+  // Picks the most fragmented compactable spaces whose live bytes fit into
+  // |compaction_budget_|. At least one space is always picked.
+  std::vector<NormalPageSpace*> SelectSpacesToCompact() const;
 
   RawHeap& heap_;
   // Compactor does not own the compactable spaces. The heap owns all spaces.
@@ -46,6 +52,10 @@ class V8_EXPORT_PRIVATE Compactor final {
 
   std::unique_ptr<CompactionWorklists> compaction_worklists_;
 
+  // Upper bound on the bytes evacuated in a single atomic pause. Spaces that
+  // do not fit are regularly swept and considered again in later cycles.
+  size_t compaction_budget_;
+
   bool is_enabled_ = false;
   bool is_cancelled_ = false;
   bool enable_for_next_gc_for_testing_ = false;
@@ -56,7 +56,7 @@ FreeList::FreeList() { Clear(); }
 FreeList::FreeList(FreeList&& other) V8_NOEXCEPT
     : free_list_heads_(std::move(other.free_list_heads_)),
       free_list_tails_(std::move(other.free_list_tails_)),
-      biggest_free_list_index_(std::move(other.biggest_free_list_index_)) {
+      non_empty_buckets_(other.non_empty_buckets_) {
   other.Clear();
 }
 
@@ -92,7 +92,7 @@ std::pair<Address, Address> FreeList::AddReturningUnusedBounds(Block block) {
   Entry& entry = Entry::CreateAt(block.address, size);
   const size_t index = BucketIndexForSize(static_cast<uint32_t>(size));
   entry.Link(&free_list_heads_[index]);
-  biggest_free_list_index_ = std::max(biggest_free_list_index_, index);
+  non_empty_buckets_ |= uint32_t{1} << index;
   if (!entry.Next()) {
     free_list_tails_[index] = &entry;
   }
@@ -120,9 +120,8 @@ void FreeList::Append(FreeList&& other) {
     }
   }
 
-  biggest_free_list_index_ =
-      std::max(biggest_free_list_index_, other.biggest_free_list_index_);
-  other.biggest_free_list_index_ = 0;
+  non_empty_buckets_ |= other.non_empty_buckets_;
+  other.non_empty_buckets_ = 0;
 #if DEBUG
   DCHECK_EQ(expected_size, Size());
 #endif
@@ -135,36 +134,36 @@ FreeList::Block FreeList::Allocate(size_t allocation_size) {
   // off as a large a free block as possible in one go; a block that will
   // service this block and let following allocations be serviced quickly
   // by bump allocation.
-  // bucket_size represents minimal size of entries in a bucket.
-  size_t bucket_size = static_cast<size_t>(1) << biggest_free_list_index_;
-  size_t index = biggest_free_list_index_;
-  for (; index > 0; --index, bucket_size >>= 1) {
-    DCHECK(IsConsistent(index));
-    Entry* entry = free_list_heads_[index];
-    if (allocation_size > bucket_size) {
-      // Final bucket candidate; check initial entry if it is able
-      // to service this allocation. Do not perform a linear scan,
-      // as it is considered too costly.
-      if (!entry || entry->AllocatedSize() < allocation_size) break;
-    }
-    if (entry) {
-      if (!entry->Next()) {
-        DCHECK_EQ(entry, free_list_tails_[index]);
-        free_list_tails_[index] = nullptr;
-      }
-      entry->Unlink(&free_list_heads_[index]);
-      biggest_free_list_index_ = index;
-      return {entry, entry->AllocatedSize()};
-    }
+  if (!non_empty_buckets_) return {nullptr, 0u};
+  const size_t index =
+      31 - v8::base::bits::CountLeadingZeros32(non_empty_buckets_);
+  DCHECK(IsConsistent(index));
+  // Entries in all buckets above the one for |allocation_size| are
+  // guaranteed to fit. For the bucket that may only potentially fit, check
+  // the initial entry. Do not perform a linear scan, as it is considered too
+  // costly.
+  const size_t allocation_index =
+      BucketIndexForSize(static_cast<uint32_t>(allocation_size));
+  Entry* entry = free_list_heads_[index];
+  DCHECK_NOT_NULL(entry);
+  if (index < allocation_index ||
+      (index == allocation_index &&
+       entry->AllocatedSize() < allocation_size)) {
+    return {nullptr, 0u};
+  }
+  if (!entry->Next()) {
+    DCHECK_EQ(entry, free_list_tails_[index]);
+    free_list_tails_[index] = nullptr;
+    non_empty_buckets_ &= ~(uint32_t{1} << index);
   }
-  biggest_free_list_index_ = index;
-  return {nullptr, 0u};
+  entry->Unlink(&free_list_heads_[index]);
+  return {entry, entry->AllocatedSize()};
 }
 
 void FreeList::Clear() {
   std::fill(free_list_heads_.begin(), free_list_heads_.end(), nullptr);
   std::fill(free_list_tails_.begin(), free_list_tails_.end(), nullptr);
-  biggest_free_list_index_ = 0;
+  non_empty_buckets_ = 0;
 }
 
 size_t FreeList::Size() const {
@@ -179,8 +178,10 @@ size_t FreeList::Size() const {
 }
 
 bool FreeList::IsEmpty() const {
-  return std::all_of(free_list_heads_.cbegin(), free_list_heads_.cend(),
-                     [](const auto* entry) { return !entry; });
+  DCHECK_EQ(non_empty_buckets_ == 0,
+            std::all_of(free_list_heads_.cbegin(), free_list_heads_.cend(),
+                        [](const auto* entry) { return !entry; }));
+  return non_empty_buckets_ == 0;
 }
 
 bool FreeList::ContainsForTesting(Block block) const {
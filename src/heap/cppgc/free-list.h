@@ -6,6 +6,7 @@
 #define V8_HEAP_CPPGC_FREE_LIST_H_
 
 #include <array>
+#include <climits>
 
 #include "include/cppgc/heap-statistics.h"
 #include "src/base/macros.h"
@@ -69,7 +70,10 @@ class V8_EXPORT_PRIVATE FreeList {
   // All |Entry|s in the nth list have size >= 2^n.
   std::array<Entry*, kPageSizeLog2> free_list_heads_;
   std::array<Entry*, kPageSizeLog2> free_list_tails_;
-  size_t biggest_free_list_index_ = 0;
+  // Bit n is set iff the nth list is non-empty. Allows finding the biggest
+  // non-empty list without walking empty ones on refill.
+  uint32_t non_empty_buckets_ = 0;
+  static_assert(kPageSizeLog2 <= sizeof(non_empty_buckets_) * CHAR_BIT);
 };
 
 // static
@@ -4,6 +4,7 @@
 
 #include "src/heap/cppgc/heap-growing.h"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 
@@ -25,6 +26,8 @@ constexpr double kMaximumLimitRatioForIncrementalGC = 0.9;
 // Minimum ratio between limit for incremental GC and limit for atomic GC
 // (to guarantee that limit is not too close to current allocated size).
 constexpr double kMinimumLimitRatioForIncrementalGC = 0.5;
+// Weight of the most recent cycle when smoothing the marking speed.
+constexpr double kMarkingSpeedSmoothingFactor = 0.5;
 }  // namespace
 
 class HeapGrowing::HeapGrowingImpl final
@@ -48,7 +51,13 @@ class HeapGrowing::HeapGrowingImpl final
 
   void DisableForTesting();
 
+  double marking_speed_in_bytes_per_ms() const {
+    return marking_speed_in_bytes_per_ms_;
+  }
+
  private:
+  void UpdateMarkingSpeed();
+  v8::base::TimeDelta EstimatedMarkingTime(size_t object_size) const;
   void ConfigureLimit(size_t allocated_object_size);
 
   GarbageCollector* collector_;
@@ -57,6 +66,8 @@ class HeapGrowing::HeapGrowingImpl final
   size_t initial_heap_size_ = 1 * kMB;
   size_t limit_for_atomic_gc_ = 0;       // See ConfigureLimit().
   size_t limit_for_incremental_gc_ = 0;  // See ConfigureLimit().
+  // Marking speed of recent cycles. 0 if no cycle has been observed yet.
+  double marking_speed_in_bytes_per_ms_ = 0;
 
   SingleThreadedHandle gc_task_handle_;
 
@@ -105,17 +116,42 @@ void HeapGrowing::HeapGrowingImpl::AllocatedObjectSizeIncreased(size_t) {
 
 void HeapGrowing::HeapGrowingImpl::ResetAllocatedObjectSize(
     size_t allocated_object_size) {
+  UpdateMarkingSpeed();
   ConfigureLimit(allocated_object_size);
 }
 
+void HeapGrowing::HeapGrowingImpl::UpdateMarkingSpeed() {
+  const double marking_time_ms =
+      stats_collector_->marking_time().InMillisecondsF();
+  const size_t marked_bytes = stats_collector_->marked_bytes_on_current_cycle();
+  if (marking_time_ms <= 0 || marked_bytes == 0) return;
+  const double speed = marked_bytes / marking_time_ms;
+  marking_speed_in_bytes_per_ms_ =
+      marking_speed_in_bytes_per_ms_ == 0
+          ? speed
+          : kMarkingSpeedSmoothingFactor * speed +
+                (1 - kMarkingSpeedSmoothingFactor) *
+                    marking_speed_in_bytes_per_ms_;
+}
+
+v8::base::TimeDelta HeapGrowing::HeapGrowingImpl::EstimatedMarkingTime(
+    size_t object_size) const {
+  if (marking_speed_in_bytes_per_ms_ == 0) {
+    return heap::base::IncrementalMarkingSchedule::kEstimatedMarkingTime;
+  }
+  return v8::base::TimeDelta::FromMillisecondsD(
+      object_size / marking_speed_in_bytes_per_ms_);
+}
+
 void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
     size_t allocated_object_size) {
   const size_t size = std::max(allocated_object_size, initial_heap_size_);
   limit_for_atomic_gc_ = std::max(static_cast<size_t>(size * kGrowingFactor),
                                   size + kMinLimitIncrease);
-  // Estimate when to start incremental GC based on current allocation speed.
-  // Ideally we start incremental GC such that it is ready to finalize no
-  // later than when we reach |limit_for_atomic_gc_|. However, we need to cap
+  // Estimate when to start incremental GC based on current allocation speed
+  // and the marking speed observed in previous cycles. Ideally we start
+  // incremental GC such that it is ready to finalize no later than when we
+  // reach |limit_for_atomic_gc_|. However, we need to cap
   // |limit_for_incremental_gc_| within a range to prevent:
   // 1) |limit_for_incremental_gc_| being too close to |limit_for_atomic_gc_|
   //    such that incremental gc gets nothing done before reaching
@@ -124,11 +160,12 @@ void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
   //    essentially always running and write barriers are always active (in
   //    case allocation rate is very high).
   size_t estimated_bytes_allocated_during_incremental_gc =
-      std::ceil(heap::base::IncrementalMarkingSchedule::kEstimatedMarkingTime
-                    .InMillisecondsF() *
+      std::ceil(EstimatedMarkingTime(size).InMillisecondsF() *
                 stats_collector_->GetRecentAllocationSpeedInBytesPerMs());
   size_t limit_incremental_gc_based_on_allocation_rate =
-      limit_for_atomic_gc_ - estimated_bytes_allocated_during_incremental_gc;
+      limit_for_atomic_gc_ -
+      std::min(limit_for_atomic_gc_,
+               estimated_bytes_allocated_during_incremental_gc);
   size_t maximum_limit_incremental_gc =
       size + (limit_for_atomic_gc_ - size) * kMaximumLimitRatioForIncrementalGC;
   size_t minimum_limit_incremental_gc =
@@ -160,6 +197,9 @@ size_t HeapGrowing::limit_for_atomic_gc() const {
 size_t HeapGrowing::limit_for_incremental_gc() const {
   return impl_->limit_for_incremental_gc();
 }
+double HeapGrowing::marking_speed_in_bytes_per_ms() const {
+  return impl_->marking_speed_in_bytes_per_ms();
+}
 
 void HeapGrowing::DisableForTesting() { impl_->DisableForTesting(); }
 
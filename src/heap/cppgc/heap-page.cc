@@ -53,7 +53,7 @@ const BasePage* BasePage::FromInnerAddress(const HeapBase* heap,
 }
 
 // static
-void BasePage::Destroy(BasePage* page) {
+void BasePage::Destroy(BasePage* page, FreedMemoryNotification notification) {
   if (page->discarded_memory()) {
     page->space()
         .raw_heap()
@@ -62,9 +62,9 @@ void BasePage::Destroy(BasePage* page) {
         ->DecrementDiscardedMemory(page->discarded_memory());
   }
   if (page->is_large()) {
-    LargePage::Destroy(LargePage::From(page));
+    LargePage::Destroy(LargePage::From(page), notification);
   } else {
-    NormalPage::Destroy(NormalPage::From(page));
+    NormalPage::Destroy(NormalPage::From(page), notification);
   }
 }
 
@@ -191,13 +191,23 @@ NormalPage* NormalPage::TryCreate(PageBackend& page_backend,
 }
 
 // static
-void NormalPage::Destroy(NormalPage* page) {
+void NormalPage::Destroy(NormalPage* page,
+                         FreedMemoryNotification notification) {
   DCHECK(page);
   const BaseSpace& space = page->space();
-  DCHECK_EQ(space.end(), std::find(space.begin(), space.end(), page));
+#if DEBUG
+  {
+    // Pages may be destroyed concurrently to the mutator adding swept pages
+    // back to the space.
+    v8::base::LockGuard<v8::base::Mutex> guard(&space.pages_mutex());
+    DCHECK_EQ(space.end(), std::find(space.begin(), space.end(), page));
+  }
+#endif  // DEBUG
   page->~NormalPage();
   PageBackend* backend = page->heap().page_backend();
-  page->heap().stats_collector()->NotifyFreedMemory(kPageSize);
+  if (notification == FreedMemoryNotification::kImmediate) {
+    page->heap().stats_collector()->NotifyFreedMemory(kPageSize);
+  }
   backend->FreeNormalPageMemory(space.index(), reinterpret_cast<Address>(page));
 }
 
@@ -278,7 +288,8 @@ LargePage* LargePage::TryCreate(PageBackend& page_backend,
 }
 
 // static
-void LargePage::Destroy(LargePage* page) {
+void LargePage::Destroy(LargePage* page,
+                        FreedMemoryNotification notification) {
   DCHECK(page);
   HeapBase& heap = page->heap();
   const size_t payload_size = page->PayloadSize();
@@ -294,7 +305,9 @@ void LargePage::Destroy(LargePage* page) {
 #endif  // DEBUG
   page->~LargePage();
   PageBackend* backend = heap.page_backend();
-  heap.stats_collector()->NotifyFreedMemory(AllocationSize(payload_size));
+  if (notification == FreedMemoryNotification::kImmediate) {
+    heap.stats_collector()->NotifyFreedMemory(AllocationSize(payload_size));
+  }
   backend->FreeLargePageMemory(reinterpret_cast<Address>(page));
 }
 
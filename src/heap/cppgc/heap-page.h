@@ -31,7 +31,14 @@ class V8_EXPORT_PRIVATE BasePage : public BasePageHandle {
   static BasePage* FromInnerAddress(const HeapBase*, void*);
   static const BasePage* FromInnerAddress(const HeapBase*, const void*);
 
-  static void Destroy(BasePage*);
+  // Controls whether freeing a page notifies the StatsCollector right away.
+  // Notifications are not thread-safe and must be deferred to the mutator
+  // thread when pages are freed concurrently.
+  enum class FreedMemoryNotification { kImmediate, kDeferred };
+
+  static void Destroy(
+      BasePage*,
+      FreedMemoryNotification = FreedMemoryNotification::kImmediate);
 
   BasePage(const BasePage&) = delete;
   BasePage& operator=(const BasePage&) = delete;
@@ -174,7 +181,9 @@ class V8_EXPORT_PRIVATE NormalPage final : public BasePage {
   static NormalPage* TryCreate(PageBackend&, NormalPageSpace&);
   // Destroys and frees the page. The page must be detached from the
   // corresponding space (i.e. be swept when called).
-  static void Destroy(NormalPage*);
+  static void Destroy(
+      NormalPage*,
+      FreedMemoryNotification = FreedMemoryNotification::kImmediate);
 
   static NormalPage* From(BasePage* page) {
     DCHECK(!page->is_large());
@@ -244,7 +253,9 @@ class V8_EXPORT_PRIVATE LargePage final : public BasePage {
   static LargePage* TryCreate(PageBackend&, LargePageSpace&, size_t);
   // Destroys and frees the page. The page must be detached from the
   // corresponding space (i.e. be swept when called).
-  static void Destroy(LargePage*);
+  static void Destroy(
+      LargePage*,
+      FreedMemoryNotification = FreedMemoryNotification::kImmediate);
 
   static LargePage* From(BasePage* page) {
     DCHECK(page->is_large());
@@ -108,9 +108,18 @@ class V8_EXPORT_PRIVATE NormalPageSpace final : public BaseSpace {
   FreeList& free_list() { return free_list_; }
   const FreeList& free_list() const { return free_list_; }
 
+  // Set by the Compactor for spaces that were compacted in the current atomic
+  // pause. Such spaces are skipped, and the bit is reset, by the Sweeper.
+  bool is_compacted() const { return is_compacted_; }
+  void set_is_compacted(bool value) {
+    DCHECK(is_compactable());
+    is_compacted_ = value;
+  }
+
  private:
   LinearAllocationBuffer current_lab_;
   FreeList free_list_;
+  bool is_compacted_ = false;
 };
 
 class V8_EXPORT_PRIVATE LargePageSpace final : public BaseSpace {
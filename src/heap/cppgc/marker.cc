@@ -490,7 +490,7 @@ void MarkerBase::VisitRoots(StackState stack_state) {
     StatsCollector::EnabledScope stats_scope(
         heap().stats_collector(), StatsCollector::kMarkVisitRememberedSets);
     heap().remembered_set().Visit(visitor(), conservative_visitor(),
-                                  mutator_marking_state_);
+                                  mutator_marking_state_, marking_worklists_);
   }
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 }
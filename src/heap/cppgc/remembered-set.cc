@@ -7,8 +7,11 @@
 #include "src/heap/cppgc/remembered-set.h"
 
 #include <algorithm>
+#include <atomic>
+#include <vector>
 
 #include "include/cppgc/member.h"
+#include "include/cppgc/platform.h"
 #include "include/cppgc/visitor.h"
 #include "src/heap/base/basic-slot-set.h"
 #include "src/heap/cppgc/heap-base.h"
@@ -80,7 +83,7 @@ void InvalidateUncompressedRememberedSlots(
 // Visit remembered set that was recorded in the generational barrier.
 template <SlotType slot_type>
 void VisitSlot(const HeapBase& heap, const BasePage& page, Address slot,
-               MutatorMarkingState& marking_state,
+               MarkingStateBase& marking_state,
                const std::set<void*>& slots_for_verification) {
 #if defined(DEBUG)
   DCHECK_EQ(BasePage::FromInnerAddress(&heap, slot), &page);
@@ -108,78 +111,141 @@ void VisitSlot(const HeapBase& heap, const BasePage& page, Address slot,
   // Slot could be updated to nullptr or kSentinelPointer by the mutator.
   if (value == kSentinelPointer || value == nullptr) return;
 
-#if defined(DEBUG)
-  // Check that the slot can not point to a freed object.
   HeapObjectHeader& header =
       BasePage::FromPayload(value)->ObjectHeaderFromInnerAddress(value);
+  // Check that the slot can not point to a freed object.
   DCHECK(!header.IsFree());
-#endif  // defined(DEBUG)
 
-  marking_state.DynamicallyMarkAddress(static_cast<Address>(value));
+  marking_state.MarkAndPush(header);
 }
 
-class CompressedSlotVisitor : HeapVisitor<CompressedSlotVisitor> {
-  friend class HeapVisitor<CompressedSlotVisitor>;
+size_t VisitCompressedSlotsOnPage(
+    const HeapBase& heap, BasePage& page, MarkingStateBase& marking_state,
+    const std::set<void*>& slots_for_verification) {
+  SlotSet* slot_set = page.slot_set();
+  DCHECK_NOT_NULL(slot_set);
+
+  const uintptr_t page_start = reinterpret_cast<uintptr_t>(&page);
+  const size_t buckets_size = SlotSet::BucketsForSize(page.AllocatedSize());
+
+  size_t slots_visited = 0;
+  slot_set->Iterate(
+      page_start, 0, buckets_size,
+      [&](SlotSet::Address slot) {
+        VisitSlot<SlotType::kCompressed>(heap, page,
+                                         reinterpret_cast<Address>(slot),
+                                         marking_state, slots_for_verification);
+        ++slots_visited;
+        return heap::base::KEEP_SLOT;
+      },
+      SlotSet::EmptyBucketMode::FREE_EMPTY_BUCKETS);
+  return slots_visited;
+}
 
- public:
-  CompressedSlotVisitor(HeapBase& heap, MutatorMarkingState& marking_state,
-                        const std::set<void*>& slots_for_verification)
-      : heap_(heap),
-        marking_state_(marking_state),
-        remembered_slots_for_verification_(slots_for_verification) {}
+class PagesWithSlotSetsCollector : HeapVisitor<PagesWithSlotSetsCollector> {
+  friend class HeapVisitor<PagesWithSlotSetsCollector>;
 
-  size_t Run() {
-    Traverse(heap_.raw_heap());
-    return objects_visited_;
+ public:
+  std::vector<BasePage*> Run(RawHeap& raw_heap) {
+    Traverse(raw_heap);
+    return std::move(pages_);
   }
 
  private:
-  heap::base::SlotCallbackResult VisitCompressedSlot(Address slot) {
-    DCHECK(current_page_);
-    VisitSlot<SlotType::kCompressed>(heap_, *current_page_, slot,
-                                     marking_state_,
-                                     remembered_slots_for_verification_);
-    ++objects_visited_;
-    return heap::base::KEEP_SLOT;
+  bool VisitNormalPage(NormalPage& page) {
+    if (page.slot_set()) pages_.push_back(&page);
+    return true;
   }
 
-  void VisitSlotSet(SlotSet* slot_set) {
-    DCHECK(current_page_);
-
-    if (!slot_set) return;
+  bool VisitLargePage(LargePage& page) {
+    if (page.slot_set()) pages_.push_back(&page);
+    return true;
+  }
 
-    const uintptr_t page_start = reinterpret_cast<uintptr_t>(current_page_);
-    const size_t buckets_size =
-        SlotSet::BucketsForSize(current_page_->AllocatedSize());
+  std::vector<BasePage*> pages_;
+};
 
-    slot_set->Iterate(
-        page_start, 0, buckets_size,
-        [this](SlotSet::Address slot) {
-          return VisitCompressedSlot(reinterpret_cast<Address>(slot));
-        },
-        SlotSet::EmptyBucketMode::FREE_EMPTY_BUCKETS);
+// Visits the slot sets of disjoint pages in parallel. Slots only reference
+// young objects which are marked atomically, so workers do not need to
+// synchronize beyond page assignment.
+class CompressedSlotsVisitingJob final : public cppgc::JobTask {
+ public:
+  CompressedSlotsVisitingJob(HeapBase& heap,
+                             MarkingWorklists& marking_worklists,
+                             const std::vector<BasePage*>& pages,
+                             const std::set<void*>& slots_for_verification)
+      : heap_(heap),
+        marking_worklists_(marking_worklists),
+        pages_(pages),
+        slots_for_verification_(slots_for_verification) {}
+
+  void Run(JobDelegate* delegate) final {
+    MarkingStateBase marking_state(heap_, marking_worklists_);
+    size_t slots_visited = 0;
+    for (size_t index = next_page_.fetch_add(1, std::memory_order_relaxed);
+         index < pages_.size();
+         index = next_page_.fetch_add(1, std::memory_order_relaxed)) {
+      slots_visited += VisitCompressedSlotsOnPage(
+          heap_, *pages_[index], marking_state, slots_for_verification_);
+      if (delegate->ShouldYield()) break;
+    }
+    marking_state.Publish();
+    slots_visited_.fetch_add(slots_visited, std::memory_order_relaxed);
   }
 
-  bool VisitNormalPage(NormalPage& page) {
-    current_page_ = &page;
-    VisitSlotSet(page.slot_set());
-    return true;
+  size_t GetMaxConcurrency(size_t worker_count) const final {
+    const size_t next_page = next_page_.load(std::memory_order_relaxed);
+    const size_t remaining_pages =
+        next_page < pages_.size() ? pages_.size() - next_page : 0;
+    return std::min(kMaxParallelism, remaining_pages + worker_count);
   }
 
-  bool VisitLargePage(LargePage& page) {
-    current_page_ = &page;
-    VisitSlotSet(page.slot_set());
-    return true;
+  size_t slots_visited() const {
+    return slots_visited_.load(std::memory_order_relaxed);
   }
 
-  HeapBase& heap_;
-  MutatorMarkingState& marking_state_;
-  BasePage* current_page_ = nullptr;
+ private:
+  static constexpr size_t kMaxParallelism = 4;
 
-  const std::set<void*>& remembered_slots_for_verification_;
-  size_t objects_visited_ = 0u;
+  HeapBase& heap_;
+  MarkingWorklists& marking_worklists_;
+  const std::vector<BasePage*>& pages_;
+  const std::set<void*>& slots_for_verification_;
+  std::atomic<size_t> next_page_{0};
+  std::atomic<size_t> slots_visited_{0};
 };
 
+// Below this number of pages with remembered slots, posting a job costs more
+// than visiting the slots on the main thread.
+constexpr size_t kMinPagesForParallelSlotVisiting = 8;
+
+size_t VisitCompressedSlots(HeapBase& heap,
+                            MutatorMarkingState& mutator_marking_state,
+                            MarkingWorklists& marking_worklists,
+                            const std::set<void*>& slots_for_verification) {
+  const std::vector<BasePage*> pages =
+      PagesWithSlotSetsCollector().Run(heap.raw_heap());
+  if (pages.size() >= kMinPagesForParallelSlotVisiting &&
+      heap.marking_support() ==
+          cppgc::Heap::MarkingType::kIncrementalAndConcurrent) {
+    auto job = std::make_unique<CompressedSlotsVisitingJob>(
+        heap, marking_worklists, pages, slots_for_verification);
+    CompressedSlotsVisitingJob* job_ptr = job.get();
+    std::unique_ptr<cppgc::JobHandle> handle = heap.platform()->PostJob(
+        cppgc::TaskPriority::kUserBlocking, std::move(job));
+    if (handle) {
+      handle->Join();
+      return job_ptr->slots_visited();
+    }
+  }
+  size_t slots_visited = 0;
+  for (BasePage* page : pages) {
+    slots_visited += VisitCompressedSlotsOnPage(
+        heap, *page, mutator_marking_state, slots_for_verification);
+  }
+  return slots_visited;
+}
+
 class SlotRemover : HeapVisitor<SlotRemover> {
   friend class HeapVisitor<SlotRemover>;
 
@@ -205,14 +271,12 @@ class SlotRemover : HeapVisitor<SlotRemover> {
 // Visit remembered set that was recorded in the generational barrier.
 void VisitRememberedSlots(
     HeapBase& heap, MutatorMarkingState& mutator_marking_state,
+    MarkingWorklists& marking_worklists,
     const std::set<void*>& remembered_uncompressed_slots,
     const std::set<void*>& remembered_slots_for_verification) {
-  size_t objects_visited = 0;
-  {
-    CompressedSlotVisitor slot_visitor(heap, mutator_marking_state,
-                                       remembered_slots_for_verification);
-    objects_visited += slot_visitor.Run();
-  }
+  size_t objects_visited =
+      VisitCompressedSlots(heap, mutator_marking_state, marking_worklists,
+                           remembered_slots_for_verification);
   for (void* uncompressed_slot : remembered_uncompressed_slots) {
     auto* page = BasePage::FromInnerAddress(&heap, uncompressed_slot);
     DCHECK(page);
@@ -333,9 +397,10 @@ void OldToNewRememberedSet::InvalidateRememberedSourceObject(
 
 void OldToNewRememberedSet::Visit(
     Visitor& visitor, ConservativeTracingVisitor& conservative_visitor,
-    MutatorMarkingState& marking_state) {
+    MutatorMarkingState& marking_state, MarkingWorklists& marking_worklists) {
   DCHECK(heap_.generational_gc_supported());
-  VisitRememberedSlots(heap_, marking_state, remembered_uncompressed_slots_,
+  VisitRememberedSlots(heap_, marking_state, marking_worklists,
+                       remembered_uncompressed_slots_,
                        remembered_slots_for_verification_);
   VisitRememberedSourceObjects(remembered_source_objects_, visitor);
   RevisitInConstructionObjects(remembered_in_construction_objects_.previous,
@@ -48,7 +48,10 @@ class V8_EXPORT_PRIVATE OldToNewRememberedSet final {
   void InvalidateRememberedSlotsInRange(void* begin, void* end);
   void InvalidateRememberedSourceObject(HeapObjectHeader& source_hoh);
 
-  void Visit(Visitor&, ConservativeTracingVisitor&, MutatorMarkingState&);
+  // Compressed slots on many pages are visited in parallel when the heap
+  // supports concurrent marking.
+  void Visit(Visitor&, ConservativeTracingVisitor&, MutatorMarkingState&,
+             MarkingWorklists&);
 
   void ExecuteCustomCallbacks(LivenessBroker);
   void ReleaseCustomCallbacks();
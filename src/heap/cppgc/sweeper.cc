@@ -233,6 +233,14 @@ struct SpaceState {
 
 using SpaceStates = std::vector<SpaceState>;
 
+bool HasUnfinalizedObjects(const SpaceState::SweptPageState& page_state) {
+#if defined(CPPGC_CAGED_HEAP)
+  return page_state.unfinalized_objects_head != nullptr;
+#else   // !defined(CPPGC_CAGED_HEAP)
+  return !page_state.unfinalized_objects.empty();
+#endif  // !defined(CPPGC_CAGED_HEAP)
+}
+
 void StickyUnmark(HeapObjectHeader* header, StickyBits sticky_bits) {
 #if defined(CPPGC_YOUNG_GENERATION)
   // Young generation in Oilpan uses sticky mark bits.
@@ -652,10 +660,12 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
 
  public:
   ConcurrentSweepTask(HeapBase& heap, SpaceStates* states, Platform* platform,
-                      FreeMemoryHandling free_memory_handling)
+                      FreeMemoryHandling free_memory_handling,
+                      std::atomic<size_t>* freed_memory_to_report)
       : heap_(heap),
         states_(states),
         platform_(platform),
+        freed_memory_to_report_(freed_memory_to_report),
         free_memory_handling_(free_memory_handling),
         sticky_bits_(heap.generational_gc_supported() ? StickyBits::kEnabled
                                                       : StickyBits::kDisabled) {
@@ -690,6 +700,11 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
                   &page, *platform_->GetPageAllocator(), sticky_bits_)
             : SweepNormalPage<DeferredFinalizationBuilder<RegularFreeHandler>>(
                   &page, *platform_->GetPageAllocator(), sticky_bits_);
+    if (sweep_result.is_empty && !HasUnfinalizedObjects(sweep_result)) {
+      // Nothing is left for the mutator thread to do for this page.
+      DestroyPage(&page, kPageSize);
+      return true;
+    }
     const size_t space_index = page.space().index();
     DCHECK_GT(states_->size(), space_index);
     SpaceState& space_state = (*states_)[space_index];
@@ -704,6 +719,10 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
       page.space().AddPage(&page);
       return true;
     }
+    if (!header->IsFinalizable()) {
+      DestroyPage(&page, LargePage::AllocationSize(page.PayloadSize()));
+      return true;
+    }
 #if defined(CPPGC_CAGED_HEAP)
     HeapObjectHeader* const unfinalized_objects =
         header->IsFinalizable() ? page.ObjectHeader() : nullptr;
@@ -716,16 +735,24 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
     const size_t space_index = page.space().index();
     DCHECK_GT(states_->size(), space_index);
     SpaceState& state = (*states_)[space_index];
-    // Avoid directly destroying large pages here as counter updates and
-    // backend access in BasePage::Destroy() are not concurrency safe.
+    // Finalizers must run on the mutator thread.
     state.swept_unfinalized_pages.Push(
         {&page, std::move(unfinalized_objects), {}, {}, true});
     return true;
   }
 
+  // Empty pages without finalizers are returned to the page backend right
+  // away. The page backend is thread-safe but counter updates are not, so
+  // the freed memory is reported later on by the mutator thread.
+  void DestroyPage(BasePage* page, size_t size) {
+    BasePage::Destroy(page, BasePage::FreedMemoryNotification::kDeferred);
+    freed_memory_to_report_->fetch_add(size, std::memory_order_relaxed);
+  }
+
   HeapBase& heap_;
   SpaceStates* states_;
   Platform* platform_;
+  std::atomic<size_t>* const freed_memory_to_report_;
   std::atomic_bool is_completed_{false};
   const FreeMemoryHandling free_memory_handling_;
   const StickyBits sticky_bits_;
@@ -757,8 +784,12 @@ class PrepareForSweepVisitor final
  protected:
   bool VisitNormalPageSpace(NormalPageSpace& space) {
     if ((compactable_space_handling_ == CompactableSpaceHandling::kIgnore) &&
-        space.is_compactable())
+        space.is_compacted()) {
+      // Compaction already rebuilt the free list of this space. Compactable
+      // spaces that did not fit the compaction budget are swept below.
+      space.set_is_compacted(false);
       return true;
+    }
     DCHECK(!space.linear_allocation_buffer().size());
     space.free_list().Clear();
 #ifdef V8_USE_ADDRESS_SANITIZER
@@ -1003,6 +1034,7 @@ class Sweeper::SweeperImpl final {
     if (!is_in_progress_) return true;
 
     MutatorThreadSweepingScope sweeping_in_progress(*this);
+    ReportFreedMemory();
 
     bool sweep_complete;
     {
@@ -1124,7 +1156,15 @@ class Sweeper::SweeperImpl final {
         platform_->PostJob(cppgc::TaskPriority::kUserVisible,
                            std::make_unique<ConcurrentSweepTask>(
                                *heap_.heap(), &space_states_, platform_,
-                               config_.free_memory_handling));
+                               config_.free_memory_handling,
+                               &freed_memory_to_report_));
+  }
+
+  // Reports memory of pages that were freed by the concurrent sweeper.
+  void ReportFreedMemory() {
+    const size_t freed_memory =
+        freed_memory_to_report_.exchange(0, std::memory_order_relaxed);
+    if (freed_memory) stats_collector_->NotifyFreedMemory(freed_memory);
   }
 
   void CancelSweepers() {
@@ -1135,6 +1175,7 @@ class Sweeper::SweeperImpl final {
 
   void SynchronizeAndFinalizeConcurrentSweeping() {
     CancelSweepers();
+    ReportFreedMemory();
 
     SweepFinalizer finalizer(platform_, config_.free_memory_handling,
                              SweepFinalizer::EmptyPageHandling::kDestroy);
@@ -1148,6 +1189,9 @@ class Sweeper::SweeperImpl final {
   SweepingConfig config_;
   IncrementalSweepTask::Handle incremental_sweeper_handle_;
   std::unique_ptr<cppgc::JobHandle> concurrent_sweeper_handle_;
+  // Memory freed by the concurrent sweeper that was not yet reported to the
+  // StatsCollector.
+  std::atomic<size_t> freed_memory_to_report_{0};
   std::vector<Sweeper::SweepingOnMutatorThreadObserver*>
       mutator_thread_sweeping_observers_;
   // Indicates whether the sweeping phase is in progress.
@@ -34,6 +34,13 @@ AllocationResult EvacuationAllocator::Allocate(AllocationSpace space,
   }
 }
 
+AllocationResult EvacuationAllocator::AllocateHotCode(
+    int object_size, AllocationAlignment alignment) {
+  object_size = ALIGN_TO_ALLOCATION_ALIGNMENT(object_size);
+  return hot_code_space_.AllocateRaw(object_size, alignment,
+                                     AllocationOrigin::kGC);
+}
+
 void EvacuationAllocator::FreeLast(AllocationSpace space, HeapObject object,
                                    int object_size) {
   object_size = ALIGN_TO_ALLOCATION_ALIGNMENT(object_size);
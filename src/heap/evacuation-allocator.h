@@ -26,6 +26,8 @@ class EvacuationAllocator {
       : heap_(heap),
         new_space_(heap->new_space()),
         compaction_spaces_(heap, compaction_space_kind),
+        hot_code_space_(heap, CODE_SPACE, Executability::EXECUTABLE,
+                        compaction_space_kind),
         new_space_lab_(LocalAllocationBuffer::InvalidBuffer()),
         lab_allocation_will_fail_(false) {}
 
@@ -35,6 +37,7 @@ class EvacuationAllocator {
     heap_->old_space()->MergeCompactionSpace(compaction_spaces_.Get(OLD_SPACE));
     heap_->code_space()->MergeCompactionSpace(
         compaction_spaces_.Get(CODE_SPACE));
+    heap_->code_space()->MergeCompactionSpace(&hot_code_space_);
     if (heap_->shared_space()) {
       heap_->shared_space()->MergeCompactionSpace(
           compaction_spaces_.Get(SHARED_SPACE));
@@ -51,6 +54,10 @@ class EvacuationAllocator {
                                    AllocationAlignment alignment);
   inline void FreeLast(AllocationSpace space, HeapObject object,
                        int object_size);
+  // Allocates in code space, on pages that are only used for hot code by
+  // this allocator, see --code-space-hotness-layout.
+  inline AllocationResult AllocateHotCode(int object_size,
+                                          AllocationAlignment alignment);
 
  private:
   inline AllocationResult AllocateInNewSpace(int object_size,
@@ -66,6 +73,7 @@ class EvacuationAllocator {
   Heap* const heap_;
   NewSpace* const new_space_;
   CompactionSpaceCollection compaction_spaces_;
+  CompactionSpace hot_code_space_;
   LocalAllocationBuffer new_space_lab_;
   bool lab_allocation_will_fail_;
 };
@@ -522,7 +522,7 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
       HeapObjectReference::ClearedValue(isolate()));
   vector->set_length(length);
   vector->set_invocation_count(0);
-  vector->set_placeholder0(0);
+  vector->set_deopt_count(0);
   vector->reset_osr_state();
   vector->reset_flags();
   vector->set_log_next_execution(v8_flags.log_function_events);
@@ -1182,7 +1182,9 @@ MaybeHandle<String> Factory::NewExternalStringFromOneByte(
   DisallowGarbageCollection no_gc;
   external_string->InitExternalPointerFields(isolate());
   external_string->set_length(static_cast<int>(length));
-  external_string->set_raw_hash_field(String::kEmptyHashField);
+  external_string->set_raw_hash_field(
+      ExternalString::GetRawHashCachedInResource(resource,
+                                                 HashSeed(isolate())));
   external_string->SetResource(isolate(), resource);
 
   isolate()->heap()->RegisterExternalString(external_string);
@@ -1206,7 +1208,8 @@ MaybeHandle<String> Factory::NewExternalStringFromTwoByte(
   DisallowGarbageCollection no_gc;
   string->InitExternalPointerFields(isolate());
   string->set_length(static_cast<int>(length));
-  string->set_raw_hash_field(String::kEmptyHashField);
+  string->set_raw_hash_field(ExternalString::GetRawHashCachedInResource(
+      resource, HashSeed(isolate())));
   string->SetResource(isolate(), resource);
 
   isolate()->heap()->RegisterExternalString(string);
@@ -5,6 +5,7 @@
 #include "src/heap/gc-tracer.h"
 
 #include <cstdarg>
+#include <sstream>
 
 #include "include/v8-metrics.h"
 #include "src/base/atomic-utils.h"
@@ -399,6 +400,14 @@ void GCTracer::StopObservablePause(GarbageCollector collector) {
     heap_->PrintShortHeapStatistics();
   }
 
+  TRACE_EVENT_COUNTER(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                      "V8.GC_HeapSizeOfObjects", heap_->SizeOfObjects());
+  TRACE_EVENT_COUNTER(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                      "V8.GC_HeapCommittedMemory", heap_->CommittedMemory());
+  TRACE_EVENT_COUNTER(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                      "V8.GC_OldGenerationSizeOfObjects",
+                      heap_->OldGenerationSizeOfObjects());
+
   if (V8_UNLIKELY(TracingFlags::gc.load(std::memory_order_relaxed) &
                   v8::tracing::TracingCategoryObserver::ENABLED_BY_TRACING)) {
     TRACE_GC_NOTE("V8.GC_HEAP_DUMP_STATISTICS");
@@ -635,12 +644,73 @@ void GCTracer::NotifyMarkingStart() {
     PrintIsolate(heap_->isolate(), "code flushing time: %d second(s)\n",
                  code_flushing_increase_s_);
   }
+
+  UpdateBytecodeOldAge();
 }
 
 uint16_t GCTracer::CodeFlushingIncrease() const {
   return code_flushing_increase_s_;
 }
 
+void GCTracer::UpdateBytecodeOldAge() {
+  const int base_age = std::max(v8_flags.bytecode_old_age.value(), 1);
+  if (!v8_flags.flush_code_adaptive_age) {
+    bytecode_old_age_ = static_cast<uint16_t>(base_age);
+    return;
+  }
+
+  // Flushing is considered premature if more than a quarter of the functions
+  // flushed by the previous GC have been recompiled since, and too lazy if
+  // hardly any were. The age is then moved by one step per GC, within
+  // [base / 2, base * 2].
+  constexpr int kPrematureRecompileRatio = 4;
+  constexpr int kLazyRecompileRatio = 16;
+  const int min_age = std::max(base_age / 2, 1);
+  const int max_age = std::min(base_age * 2, int{UINT16_MAX});
+  int age = bytecode_old_age_;
+  const int flushed = bytecode_flushed_in_last_gc_;
+  const int recompiled = bytecode_recompiled_since_flush_;
+  if (heap_->ShouldOptimizeForMemoryUsage()) {
+    // Under memory pressure, the memory is worth more than the recompiles.
+    age = min_age;
+  } else if (recompiled * kPrematureRecompileRatio > flushed) {
+    age = std::min(age + 1, max_age);
+  } else if (recompiled * kLazyRecompileRatio < flushed) {
+    age = std::max(age - 1, min_age);
+  }
+  bytecode_old_age_ = static_cast<uint16_t>(age);
+  bytecode_recompiled_since_flush_ = 0;
+
+  if (V8_UNLIKELY(v8_flags.trace_flush_code)) {
+    PrintIsolate(heap_->isolate(),
+                 "bytecode old age: %d (%d flushed, %d recompiled)\n",
+                 bytecode_old_age_, flushed, recompiled);
+  }
+}
+
+void GCTracer::NotifyBytecodeFlushed(int flushed) {
+  bytecode_flushed_in_last_gc_ = flushed;
+  if (V8_LIKELY(!v8_flags.trace_flush_code)) return;
+
+  std::ostringstream histogram;
+  for (int i = 0; i < kBytecodeAgeHistogramBuckets; i++) {
+    int count =
+        bytecode_age_histogram_[i].exchange(0, std::memory_order_relaxed);
+    if (count == 0) continue;
+    histogram << " " << i
+              << (i == kBytecodeAgeHistogramBuckets - 1 ? "+" : "") << ":"
+              << count;
+  }
+  PrintIsolate(heap_->isolate(), "bytecode age histogram:%s\n",
+               histogram.str().c_str());
+}
+
+void GCTracer::RecordBytecodeAge(uint16_t age) {
+  DCHECK(v8_flags.trace_flush_code);
+  int bucket = std::min<int>(age, kBytecodeAgeHistogramBuckets - 1);
+  bytecode_age_histogram_[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
 void GCTracer::AddAllocation(base::TimeTicks current) {
   allocation_time_ = current;
   if (allocation_duration_since_gc_ > 0) {
@@ -787,6 +857,9 @@ void GCTracer::PrintNVP() const {
           "scavenge.parallel=%.2f "
           "scavenge.update_refs=%.2f "
           "scavenge.sweep_array_buffers=%.2f "
+          "scavenge.task_runs=%d "
+          "scavenge.task_max=%.2f "
+          "scavenge.task_avg=%.2f "
           "background.scavenge.parallel=%.2f "
           "background.unmapper=%.2f "
           "unmapper=%.2f "
@@ -829,6 +902,12 @@ void GCTracer::PrintNVP() const {
           current_scope(Scope::SCAVENGER_SCAVENGE_PARALLEL),
           current_scope(Scope::SCAVENGER_SCAVENGE_UPDATE_REFS),
           current_scope(Scope::SCAVENGER_SWEEP_ARRAY_BUFFERS),
+          current_.scavenge_task_runs,
+          current_.scavenge_task_max_duration.InMillisecondsF(),
+          current_.scavenge_task_runs > 0
+              ? current_.scavenge_task_total_duration.InMillisecondsF() /
+                    current_.scavenge_task_runs
+              : 0.0,
           current_scope(Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL),
           current_scope(Scope::BACKGROUND_UNMAPPER),
           current_scope(Scope::UNMAPPER),
@@ -1159,6 +1238,14 @@ base::Optional<base::TimeDelta> GCTracer::AverageTimeToIncrementalMarkingTask()
   return average_time_to_incremental_marking_task_;
 }
 
+void GCTracer::AddScavengeTaskSample(base::TimeDelta duration) {
+  base::MutexGuard guard(&background_scopes_mutex_);
+  current_.scavenge_task_runs++;
+  current_.scavenge_task_max_duration =
+      std::max(current_.scavenge_task_max_duration, duration);
+  current_.scavenge_task_total_duration += duration;
+}
+
 void GCTracer::RecordEmbedderSpeed(size_t bytes, double duration) {
   if (duration == 0 || bytes == 0) return;
   double current_speed = bytes / duration;
@@ -1650,9 +1737,21 @@ void GCTracer::ReportFullCycleToRecorder() {
   event.main_thread_incremental.sweep_wall_clock_duration_in_us =
       incremental_sweeping.InMicroseconds();
 
+  // Sizes:
+  event.objects.bytes_before = current_.start_object_size;
+  event.objects.bytes_after = current_.end_object_size;
+  event.objects.bytes_freed =
+      current_.start_object_size > current_.end_object_size
+          ? current_.start_object_size - current_.end_object_size
+          : 0U;
+  event.memory.bytes_before = current_.start_memory_size;
+  event.memory.bytes_after = current_.end_memory_size;
+  event.memory.bytes_freed =
+      current_.start_memory_size > current_.end_memory_size
+          ? current_.start_memory_size - current_.end_memory_size
+          : 0U;
+
   // TODO(chromium:1154636): Populate the following:
-  // - event.objects
-  // - event.memory
   // - event.collection_rate_in_percent
   // - event.efficiency_in_bytes_per_us
   // - event.main_thread_efficiency_in_bytes_per_us
@@ -1705,6 +1804,25 @@ void GCTracer::ReportIncrementalSweepingStepToRecorder(double v8_duration) {
   }
 }
 
+void GCTracer::AddIncrementalMarkingPauseTargetViolation(
+    base::TimeDelta duration, base::TimeDelta target) {
+  if (v8_flags.trace_incremental_marking) {
+    heap_->isolate()->PrintWithTimestamp(
+        "[IncrementalMarking] Step took %.2fms, exceeding the pause target of "
+        "%.2fms\n",
+        duration.InMillisecondsF(), target.InMillisecondsF());
+  }
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      heap_->isolate()->metrics_recorder();
+  DCHECK_NOT_NULL(recorder);
+  if (!recorder->HasEmbedderRecorder()) return;
+  v8::metrics::
+      GarbageCollectionFullMainThreadIncrementalMarkPauseTargetViolation event;
+  event.wall_clock_duration_in_us = duration.InMicroseconds();
+  event.target_in_us = target.InMicroseconds();
+  recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
+}
+
 void GCTracer::ReportYoungCycleToRecorder() {
   DCHECK(Event::IsYoungGenerationEvent(current_.type));
   DCHECK_EQ(Event::State::NOT_RUNNING, current_.state);
@@ -1764,6 +1882,13 @@ void GCTracer::ReportYoungCycleToRecorder() {
       current_.scopes[Scope::MINOR_MARK_SWEEPER];
   event.main_thread_wall_clock_duration_in_us =
       main_thread_wall_clock_duration.InMicroseconds();
+  // Sizes:
+  DCHECK_LE(current_.survived_young_object_size, current_.young_object_size);
+  event.objects.bytes_before = current_.young_object_size;
+  event.objects.bytes_after = current_.survived_young_object_size;
+  event.objects.bytes_freed =
+      current_.young_object_size - current_.survived_young_object_size;
+  event.promoted_bytes = heap_->promoted_objects_size();
   // Collection Rate:
   if (current_.young_object_size == 0) {
     event.collection_rate_in_percent = 0;
@@ -5,12 +5,16 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include <algorithm>
+#include <atomic>
+
 #include "include/v8-metrics.h"
 #include "src/base/compiler-specific.h"
 #include "src/base/macros.h"
 #include "src/base/optional.h"
 #include "src/base/ring-buffer.h"
 #include "src/common/globals.h"
+#include "src/flags/flags.h"
 #include "src/heap/base/bytes.h"
 #include "src/init/heap-symbols.h"
 #include "src/logging/counters.h"
@@ -219,6 +223,12 @@ class V8_EXPORT_PRIVATE GCTracer {
 
     // Holds details for incremental marking scopes.
     IncrementalInfos incremental_scopes[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
+
+    // Number of runs of parallel scavenge tasks, and their longest and total
+    // duration, for SCAVENGER. Protected by background_scopes_mutex_.
+    int scavenge_task_runs = 0;
+    base::TimeDelta scavenge_task_max_duration;
+    base::TimeDelta scavenge_task_total_duration;
   };
 
   class RecordGCPhasesInfo final {
@@ -318,6 +328,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Log an incremental marking step.
   void AddIncrementalMarkingStep(double duration, size_t bytes);
 
+  // Log an incremental marking step that exceeded the pause target.
+  void AddIncrementalMarkingPauseTargetViolation(base::TimeDelta duration,
+                                                 base::TimeDelta target);
+
   // Log an incremental marking step.
   void AddIncrementalSweepingStep(double duration);
 
@@ -409,6 +423,24 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Returns the current cycle's code flushing increase in seconds.
   uint16_t CodeFlushingIncrease() const;
 
+  // Returns the current cycle's number of full GCs after which unused
+  // bytecode is flushed. This is --bytecode-old-age unless
+  // --flush-code-adaptive-age is set, in which case it is lowered under
+  // memory pressure and raised when flushed functions keep getting
+  // recompiled.
+  uint16_t BytecodeOldAge() const { return bytecode_old_age_; }
+
+  // Invoked when a function whose bytecode was flushed is compiled again.
+  void NotifyBytecodeRecompiled() { bytecode_recompiled_since_flush_++; }
+
+  // Invoked at the end of marking with the number of functions whose bytecode
+  // was flushed in this cycle.
+  void NotifyBytecodeFlushed(int flushed);
+
+  // Records the age of a flushable bytecode array seen during marking, for the
+  // age histogram printed by --trace-flush-code. Can be called concurrently.
+  void RecordBytecodeAge(uint16_t age);
+
   // Returns average mutator utilization with respect to mark-compact
   // garbage collections. This ignores scavenger.
   double AverageMarkCompactMutatorUtilization() const;
@@ -416,6 +448,10 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   V8_INLINE void AddScopeSample(Scope::ScopeId id, base::TimeDelta duration);
 
+  // Records how long a parallel scavenge task ran. May be called from
+  // background threads.
+  void AddScavengeTaskSample(base::TimeDelta duration);
+
   void RecordGCPhasesHistograms(RecordGCPhasesInfo::Mode mode);
 
   void RecordEmbedderSpeed(size_t bytes, double duration);
@@ -515,6 +551,15 @@ class V8_EXPORT_PRIVATE GCTracer {
   base::Optional<base::TimeTicks> last_marking_start_time_;
   uint16_t code_flushing_increase_s_ = 0;
 
+  void UpdateBytecodeOldAge();
+
+  uint16_t bytecode_old_age_ =
+      static_cast<uint16_t>(std::max(v8_flags.bytecode_old_age.value(), 1));
+  int bytecode_flushed_in_last_gc_ = 0;
+  int bytecode_recompiled_since_flush_ = 0;
+  static constexpr int kBytecodeAgeHistogramBuckets = 16;
+  std::atomic<int> bytecode_age_histogram_[kBytecodeAgeHistogramBuckets] = {};
+
   // Incremental scopes carry more information than just the duration. The infos
   // here are merged back upon starting/stopping the GC tracer.
   IncrementalInfos incremental_scopes_[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
@@ -593,6 +638,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, MutatorUtilization);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
+  FRIEND_TEST(GCTracerTest, ScavengeTaskSamples);
 };
 
 const char* ToString(GCTracer::Event::Type type, bool short_name);
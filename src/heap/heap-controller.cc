@@ -165,6 +165,47 @@ size_t MemoryController<Trait>::CalculateAllocationLimit(
   return result;
 }
 
+// static
+size_t NewSpaceController::TargetCapacity(
+    Heap* heap, size_t current_capacity, size_t min_capacity,
+    size_t max_capacity, double allocation_throughput, double survival_ratio,
+    double scavenge_speed, double pause_target_in_ms) {
+  DCHECK_LE(min_capacity, current_capacity);
+  DCHECK_LE(current_capacity, max_capacity);
+  if (allocation_throughput == 0 || scavenge_speed == 0) {
+    return current_capacity;
+  }
+
+  const double survival_fraction =
+      std::min(std::max(survival_ratio, kMinSurvivalRatio), 100.0) / 100;
+  const double pause_capacity =
+      pause_target_in_ms * scavenge_speed / survival_fraction;
+  const double throughput_capacity =
+      allocation_throughput * kTargetScavengeIntervalInMs;
+  double target = std::min(pause_capacity, throughput_capacity);
+
+  const double growing_factor =
+      std::max(v8_flags.semi_space_growth_factor.value(), 2);
+  target = std::min(target, current_capacity * growing_factor);
+  target = std::max(target, static_cast<double>(current_capacity) /
+                                kMaxShrinkingFactor);
+  target = std::min(target, static_cast<double>(max_capacity));
+  target = std::max(target, static_cast<double>(min_capacity));
+
+  size_t result = RoundDown(static_cast<size_t>(target), Page::kPageSize);
+  result = std::max(result, min_capacity);
+  if (v8_flags.trace_gc_verbose) {
+    Isolate::FromHeap(heap)->PrintWithTimestamp(
+        "[NewSpaceController] capacity %zu KB -> %zu KB based on "
+        "throughput=%.f, survival=%.1f%%, speed=%.f (pause bound %.f KB, "
+        "throughput bound %.f KB)\n",
+        current_capacity / KB, result / KB, allocation_throughput,
+        survival_ratio, scavenge_speed, pause_capacity / KB,
+        throughput_capacity / KB);
+  }
+  return result;
+}
+
 template class V8_EXPORT_PRIVATE MemoryController<V8HeapTrait>;
 template class V8_EXPORT_PRIVATE MemoryController<GlobalMemoryTrait>;
 
@@ -56,6 +56,35 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
+// Sizes the semi-spaces from the allocation throughput of the mutator, the
+// survival ratio of the young generation and the speed of the scavenger.
+//
+// A scavenge costs time proportional to the surviving bytes, so the largest
+// capacity that still meets the pause target is
+//   pause_target * scavenge_speed / survival_ratio.
+// Beyond that, a larger young generation only pays off while the mutator
+// actually fills it: the capacity is not grown past what is allocated in
+// kTargetScavengeIntervalInMs. Each step is bounded by the growing and
+// shrinking factor to keep the controller from oscillating.
+class V8_EXPORT_PRIVATE NewSpaceController : public AllStatic {
+ public:
+  static constexpr double kTargetScavengeIntervalInMs = 100;
+  // Survival ratios below this (in percent) are rounded up, as the pause
+  // bound would otherwise become meaningless.
+  static constexpr double kMinSurvivalRatio = 1.0;
+  static constexpr size_t kMaxShrinkingFactor = 2;
+
+  // Returns the page-aligned capacity of a semi-space for the next cycle, in
+  // [min_capacity, max_capacity]. Without throughput or speed samples the
+  // current capacity is kept. The allocation throughput and the scavenge
+  // speed are in bytes per ms, the survival ratio is in percent.
+  static size_t TargetCapacity(Heap* heap, size_t current_capacity,
+                               size_t min_capacity, size_t max_capacity,
+                               double allocation_throughput,
+                               double survival_ratio, double scavenge_speed,
+                               double pause_target_in_ms);
+};
+
 }  // namespace internal
 }  // namespace v8
 
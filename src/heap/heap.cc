@@ -105,6 +105,7 @@
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/hash-table.h"
 #include "src/objects/instance-type.h"
+#include "src/objects/keys.h"
 #include "src/objects/maybe-object.h"
 #include "src/objects/objects.h"
 #include "src/objects/shared-function-info.h"
@@ -455,6 +456,21 @@ size_t Heap::CommittedPhysicalMemory() {
   return total;
 }
 
+size_t Heap::RememberedSetMemoryUsage() {
+  if (!HasBeenSetUp()) return 0;
+
+  if (gc_state() == NOT_IN_GC && !sweeping_in_progress()) {
+    size_t total = 0;
+    MemoryChunkIterator chunk_iterator(this);
+    while (chunk_iterator.HasNext()) {
+      total += chunk_iterator.Next()->SlotSetMemoryUsage();
+    }
+    remembered_set_memory_usage_ = total;
+  }
+
+  return remembered_set_memory_usage_;
+}
+
 size_t Heap::CommittedMemoryExecutable() {
   if (!HasBeenSetUp()) return 0;
 
@@ -694,6 +710,10 @@ void Heap::PrintShortHeapStatistics() {
                "Unmapper buffering %zu chunks of committed: %6zu KB\n",
                memory_allocator()->unmapper()->NumberOfCommittedChunks(),
                CommittedMemoryOfUnmapper() / KB);
+  if (v8_flags.heap_huge_pages) {
+    PrintIsolate(isolate_, "Huge page coverage: %.1f%% of regular pages\n",
+                 memory_allocator()->HugePageCoverage());
+  }
   PrintIsolate(isolate_, "External memory reported: %6" PRId64 " KB\n",
                external_memory_.total() / KB);
   PrintIsolate(isolate_, "Backing store memory: %6" PRIu64 " KB\n",
@@ -2584,6 +2604,10 @@ void Heap::RecomputeLimits(GarbageCollector collector) {
             this, GlobalSizeOfObjects(), min_global_memory_size_,
             max_global_memory_size_, new_space_capacity, global_growing_factor,
             mode);
+    new_old_generation_allocation_limit = LimitToProcessMemoryHeadroom(
+        old_gen_size, new_old_generation_allocation_limit);
+    new_global_allocation_limit = LimitToProcessMemoryHeadroom(
+        GlobalSizeOfObjects(), new_global_allocation_limit);
     SetOldGenerationAndGlobalAllocationLimit(
         new_old_generation_allocation_limit, new_global_allocation_limit);
     CheckIneffectiveMarkCompact(
@@ -2620,6 +2644,29 @@ void Heap::RecomputeLimits(GarbageCollector collector) {
   }
 }
 
+size_t Heap::LimitToProcessMemoryHeadroom(size_t current_size, size_t limit) {
+  if (!HasProcessMemoryBudget()) return limit;
+  // The reported usage already includes the current heap, so the heap may
+  // only grow by what is left of the budget. It still grows by the minimum
+  // step to avoid back-to-back GCs when the process is over budget. The limit
+  // is never raised.
+  const size_t headroom = process_memory_budget_ > process_memory_usage_
+                              ? process_memory_budget_ - process_memory_usage_
+                              : 0;
+  const size_t min_growing_step =
+      MemoryController<V8HeapTrait>::MinimumAllocationLimitGrowingStep(
+          CurrentHeapGrowingMode());
+  const size_t result = std::min(
+      limit, current_size + std::max(headroom, min_growing_step));
+  if (v8_flags.trace_gc_verbose && result < limit) {
+    isolate()->PrintWithTimestamp(
+        "Limited allocation limit to process memory budget: %zu KB -> %zu KB "
+        "(headroom: %zu KB)\n",
+        limit / KB, result / KB, headroom / KB);
+  }
+  return result;
+}
+
 void Heap::CallGCPrologueCallbacks(GCType gc_type, GCCallbackFlags flags,
                                    GCTracer::Scope::ScopeId scope_id) {
   if (gc_prologue_callbacks_.IsEmpty()) return;
@@ -2706,6 +2753,7 @@ void Heap::MarkCompactPrologue() {
   isolate_->descriptor_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  ObjectKeysCache::Clear(object_keys_cache());
 
   FlushNumberStringCache();
 }
@@ -3825,7 +3873,8 @@ bool Heap::HasHighFragmentation() {
 bool Heap::ShouldOptimizeForMemoryUsage() {
   const size_t kOldGenerationSlack = max_old_generation_size() / 8;
   return v8_flags.optimize_for_size || isolate()->IsIsolateInBackground() ||
-         HighMemoryPressure() || !CanExpandOldGeneration(kOldGenerationSlack);
+         HighMemoryPressure() || IsApproachingProcessMemoryBudget() ||
+         !CanExpandOldGeneration(kOldGenerationSlack);
 }
 
 class ActivateMemoryReducerTask : public CancelableTask {
@@ -3872,6 +3921,10 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
                                   : ResizeNewSpaceMode::kShrink;
   }
 
+  if (v8_flags.adaptive_semi_space_sizing && !v8_flags.predictable) {
+    return ShouldResizeNewSpaceAdaptively();
+  }
+
   static const size_t kLowAllocationThroughput = 1000;
   const double allocation_throughput =
       tracer_->CurrentAllocationThroughputInBytesPerMillisecond();
@@ -3889,7 +3942,36 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
   return should_grow ? ResizeNewSpaceMode::kGrow : ResizeNewSpaceMode::kShrink;
 }
 
+Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpaceAdaptively() {
+  DCHECK(!v8_flags.minor_ms);
+  // The survival ratio needs at least one young generation GC to be
+  // meaningful.
+  if (!tracer_->SurvivalEventsRecorded()) return ResizeNewSpaceMode::kNone;
+  const size_t current_capacity = new_space_->TotalCapacity();
+  new_space_target_capacity_ = NewSpaceController::TargetCapacity(
+      this, current_capacity,
+      SemiSpaceNewSpace::From(new_space_)->InitialTotalCapacity(),
+      new_space_->MaximumCapacity(),
+      tracer_->CurrentAllocationThroughputInBytesPerMillisecond(),
+      tracer_->AverageSurvivalRatio(),
+      tracer_->ScavengeSpeedInBytesPerMillisecond(kForSurvivedObjects),
+      v8_flags.scavenge_pause_target_ms);
+  if (new_space_target_capacity_ > current_capacity) {
+    return ResizeNewSpaceMode::kGrow;
+  }
+  if (new_space_target_capacity_ < current_capacity) {
+    return ResizeNewSpaceMode::kShrink;
+  }
+  return ResizeNewSpaceMode::kNone;
+}
+
 void Heap::ExpandNewSpaceSize() {
+  if (v8_flags.adaptive_semi_space_sizing && new_space_target_capacity_ > 0) {
+    SemiSpaceNewSpace::From(new_space_)->GrowTo(new_space_target_capacity_);
+    new_space_target_capacity_ = 0;
+    new_lo_space()->SetCapacity(new_space()->TotalCapacity());
+    return;
+  }
   // Grow the size of new space if there is room to grow, and enough data
   // has survived scavenge since the last expansion.
   new_space_->Grow();
@@ -3899,7 +3981,13 @@ void Heap::ExpandNewSpaceSize() {
 void Heap::ReduceNewSpaceSize() {
   // MinorMS shrinks new space as part of sweeping.
   if (!v8_flags.minor_ms) {
-    SemiSpaceNewSpace::From(new_space())->Shrink();
+    if (new_space_target_capacity_ > 0) {
+      SemiSpaceNewSpace::From(new_space())->ShrinkTo(
+          new_space_target_capacity_);
+      new_space_target_capacity_ = 0;
+    } else {
+      SemiSpaceNewSpace::From(new_space())->Shrink();
+    }
   } else {
     paged_new_space()->FinishShrinking();
   }
@@ -4138,6 +4226,7 @@ void Heap::CheckMemoryPressure() {
   if (HighMemoryPressure()) {
     // The optimizing compiler may be unnecessarily holding on to memory.
     isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
+    isolate()->allocator()->ReleasePooledSegments();
   }
   // Reset the memory pressure level to avoid recursive GCs triggered by
   // CheckMemoryPressure from AdjustAmountOfExternalMemory called by
@@ -4213,9 +4302,41 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
   }
 }
 
+void Heap::SetProcessMemoryBudget(size_t budget, size_t usage) {
+  const bool was_approaching_budget = IsApproachingProcessMemoryBudget();
+  process_memory_budget_ = budget;
+  process_memory_usage_ = usage;
+  if (!IsApproachingProcessMemoryBudget()) return;
+  if (old_generation_allocation_limit_configured_) {
+    // Tighten the current limits right away to not overshoot the budget
+    // before the next GC.
+    SetOldGenerationAndGlobalAllocationLimit(
+        LimitToProcessMemoryHeadroom(OldGenerationSizeOfObjects(),
+                                     old_generation_allocation_limit()),
+        LimitToProcessMemoryHeadroom(GlobalSizeOfObjects(),
+                                     global_allocation_limit_));
+  }
+  // Only crossing the threshold starts the memory reducer, as it otherwise
+  // restarts on every update while the process stays close to the budget.
+  if (!was_approaching_budget && memory_reducer() != nullptr) {
+    memory_reducer()->NotifyPossibleGarbage();
+  }
+}
+
+bool Heap::IsApproachingProcessMemoryBudget() const {
+  if (!HasProcessMemoryBudget()) return false;
+  return process_memory_usage_ >=
+         process_memory_budget_ / 100 * v8_flags.memory_budget_pressure_percent;
+}
+
 void Heap::EagerlyFreeExternalMemory() {
   CompleteArrayBufferSweeping(this);
   memory_allocator()->unmapper()->EnsureUnmappingCompleted();
+#if V8_ENABLE_WEBASSEMBLY
+  if (v8_flags.wasm_discard_zeroed_memory_pages) {
+    isolate()->DiscardZeroedWasmMemoryPages();
+  }
+#endif  // V8_ENABLE_WEBASSEMBLY
 }
 
 void Heap::AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
@@ -4242,6 +4363,11 @@ void Heap::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
   UNREACHABLE();
 }
 
+ArrayBufferExtension* Heap::AllocateArrayBufferExtension(
+    Tagged<JSArrayBuffer> object) {
+  return array_buffer_sweeper_->Allocate(object);
+}
+
 void Heap::AppendArrayBufferExtension(Tagged<JSArrayBuffer> object,
                                       ArrayBufferExtension* extension) {
   // ArrayBufferSweeper is managing all counters and updating Heap counters.
@@ -4878,6 +5004,8 @@ size_t Heap::OldGenerationToSemiSpaceRatioLowMemory() {
 }
 
 void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints) {
+  numa_node_ = v8_flags.numa_node;
+
   // Initialize max_semi_space_size_.
   {
     max_semi_space_size_ = DefaultMaxSemiSpaceSize();
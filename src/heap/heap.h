@@ -593,6 +593,13 @@ class Heap final {
       v8::MemoryPressureLevel level, bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  // Implements v8::Isolate::SetProcessMemoryBudget.
+  V8_EXPORT_PRIVATE void SetProcessMemoryBudget(size_t budget, size_t usage);
+  bool HasProcessMemoryBudget() const { return process_memory_budget_ > 0; }
+  // Whether the memory usage of the process reached
+  // --memory-budget-pressure-percent of the budget set by the embedder.
+  bool IsApproachingProcessMemoryBudget() const;
+
   V8_EXPORT_PRIVATE void AddNearHeapLimitCallback(v8::NearHeapLimitCallback,
                                                   void* data);
   V8_EXPORT_PRIVATE void RemoveNearHeapLimitCallback(
@@ -600,6 +607,8 @@ class Heap final {
   V8_EXPORT_PRIVATE void AutomaticallyRestoreInitialHeapLimit(
       double threshold_percent);
 
+  ArrayBufferExtension* AllocateArrayBufferExtension(
+      Tagged<JSArrayBuffer> object);
   void AppendArrayBufferExtension(Tagged<JSArrayBuffer> object,
                                   ArrayBufferExtension* extension);
   void DetachArrayBufferExtension(Tagged<JSArrayBuffer> object,
@@ -703,6 +712,11 @@ class Heap final {
   void ConfigureHeap(const v8::ResourceConstraints& constraints);
   void ConfigureHeapDefault();
 
+  // Sets the NUMA node preferred for committing pages of this heap and for
+  // running its GC worker threads. A negative node disables NUMA placement.
+  void SetNumaNode(int node) { numa_node_ = node; }
+  int numa_node() const { return numa_node_; }
+
   // Prepares the heap, setting up for deserialization.
   void SetUp(LocalHeap* main_thread_local_heap);
 
@@ -1260,6 +1274,11 @@ class Heap final {
   // Returns the amount of physical memory currently committed for the heap.
   size_t CommittedPhysicalMemory();
 
+  // Returns the amount of memory used by remembered sets. Sweeper threads may
+  // release slot sets, so the value is only recomputed while no sweeping is in
+  // progress; otherwise the last computed value is returned.
+  V8_EXPORT_PRIVATE size_t RememberedSetMemoryUsage();
+
   // Returns the maximum amount of memory ever committed for the heap.
   size_t MaximumCommittedMemory() { return maximum_committed_; }
 
@@ -1295,6 +1314,12 @@ class Heap final {
     return new_space_surviving_object_size_;
   }
 
+  // Percentage of the young generation that survived the last GC, either by
+  // staying in the young generation or by being promoted.
+  double young_generation_survival_rate() const {
+    return promotion_ratio_ + new_space_surviving_rate_;
+  }
+
   inline size_t SurvivedYoungObjectSize() {
     return promoted_objects_size_ + new_space_surviving_object_size_;
   }
@@ -1764,6 +1789,7 @@ class Heap final {
 
   enum class ResizeNewSpaceMode { kShrink, kGrow, kNone };
   ResizeNewSpaceMode ShouldResizeNewSpace();
+  ResizeNewSpaceMode ShouldResizeNewSpaceAdaptively();
   void ExpandNewSpaceSize();
   void ReduceNewSpaceSize();
 
@@ -1853,6 +1879,7 @@ class Heap final {
   }
 
   void UpdateTotalGCTime(base::TimeDelta duration);
+  base::TimeDelta total_gc_time() const { return total_gc_time_ms_; }
 
   bool IsIneffectiveMarkCompact(size_t old_generation_size,
                                 double mutator_utilization);
@@ -1929,6 +1956,10 @@ class Heap final {
 
   void RecomputeLimits(GarbageCollector collector);
 
+  // Caps an allocation limit for a heap of |current_size| at the headroom
+  // left in the process memory budget.
+  size_t LimitToProcessMemoryHeadroom(size_t current_size, size_t limit);
+
   // ===========================================================================
   // GC Tasks. =================================================================
   // ===========================================================================
@@ -2071,6 +2102,9 @@ class Heap final {
   // temporarily on 32-bit.
   std::atomic<uint64_t> backing_store_bytes_{0};
 
+  // Last value computed by RememberedSetMemoryUsage().
+  size_t remembered_set_memory_usage_ = 0;
+
   // For keeping track of how much data has survived
   // scavenge since last new space expansion.
   size_t survived_since_last_expansion_ = 0;
@@ -2083,6 +2117,11 @@ class Heap final {
   // and reset by a mark-compact garbage collection.
   std::atomic<v8::MemoryPressureLevel> memory_pressure_level_;
 
+  // Memory budget of the process and its last reported usage, as set by
+  // SetProcessMemoryBudget. A budget of 0 means there is none.
+  size_t process_memory_budget_ = 0;
+  size_t process_memory_usage_ = 0;
+
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
@@ -2303,6 +2342,8 @@ class Heap final {
 
   int max_regular_code_object_size_ = 0;
 
+  int numa_node_ = -1;
+
   bool inline_allocation_enabled_ = true;
 
   int pause_allocation_observers_depth_ = 0;
@@ -2334,6 +2375,9 @@ class Heap final {
 
   // This field is used only when not running with MinorMS.
   ResizeNewSpaceMode resize_new_space_mode_ = ResizeNewSpaceMode::kNone;
+  // Capacity chosen by the NewSpaceController when
+  // --adaptive-semi-space-sizing is enabled.
+  size_t new_space_target_capacity_ = 0;
 
   std::unique_ptr<MemoryBalancer> mb_;
 
@@ -111,7 +111,9 @@ IncrementalMarking::IncrementalMarking(Heap* heap, WeakObjects* weak_objects)
                                kMajorGCYoungGenerationAllocationObserverStep),
       old_generation_observer_(this,
                                kMajorGCOldGenerationAllocationObserverStep),
-      minor_gc_observer_(this) {}
+      minor_gc_observer_(this),
+      pause_target_(v8::base::TimeDelta::FromMillisecondsD(
+          v8_flags.incremental_marking_pause_target_ms)) {}
 
 void IncrementalMarking::MarkBlackBackground(HeapObject obj, int object_size) {
   CHECK(marking_state()->TryMark(obj));
@@ -858,6 +860,9 @@ void IncrementalMarking::Step(v8::base::TimeDelta max_duration,
       TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT);
   DCHECK(IsMajorMarking());
   const auto start = v8::base::TimeTicks::Now();
+  if (!pause_target_.IsZero()) {
+    max_duration = std::min(max_duration, pause_target_);
+  }
 
   base::Optional<SafepointScope> safepoint_scope;
   // Conceptually an incremental marking step (even though it always runs on the
@@ -891,6 +896,10 @@ void IncrementalMarking::Step(v8::base::TimeDelta max_duration,
     heap()->PublishPendingAllocations();
   }
 
+  // Merging and publishing above is accounted against the V8 slice, so that a
+  // pause target also covers the step overhead.
+  const auto overhead = v8::base::TimeTicks::Now() - start;
+
   // Perform a single V8 and a single embedder step. In case both have been
   // observed as empty back to back, we can finalize.
   //
@@ -899,7 +908,9 @@ void IncrementalMarking::Step(v8::base::TimeDelta max_duration,
   // processed on their own. For small graphs, helping is not necessary.
   std::tie(v8_bytes_processed, std::ignore) =
       major_collector_->ProcessMarkingWorklist(
-          max_duration, max_bytes_to_process,
+          overhead < max_duration ? max_duration - overhead
+                                  : v8::base::TimeDelta(),
+          max_bytes_to_process,
           MarkCompactCollector::MarkingWorklistProcessingMode::kDefault);
   main_thread_marked_bytes_ += v8_bytes_processed;
   schedule_->UpdateMutatorThreadMarkedBytes(main_thread_marked_bytes_);
@@ -922,6 +933,14 @@ void IncrementalMarking::Step(v8::base::TimeDelta max_duration,
   heap_->tracer()->AddIncrementalMarkingStep(v8_time.InMillisecondsF(),
                                              v8_bytes_processed);
 
+  if (!pause_target_.IsZero()) {
+    const auto step_time = v8::base::TimeTicks::Now() - start;
+    if (step_time > pause_target_) {
+      heap_->tracer()->AddIncrementalMarkingPauseTargetViolation(
+          step_time, pause_target_);
+    }
+  }
+
   if (V8_UNLIKELY(v8_flags.trace_incremental_marking)) {
     isolate()->PrintWithTimestamp(
         "[IncrementalMarking] Step: origin: %s, V8: %zuKB (%zuKB) in %.1f, "
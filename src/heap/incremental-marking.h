@@ -142,6 +142,12 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
 
   uint64_t current_trace_id() const { return current_trace_id_.value(); }
 
+  // Steps are capped to |pause_target| unless it is zero.
+  void set_pause_target(v8::base::TimeDelta pause_target) {
+    pause_target_ = pause_target;
+  }
+  v8::base::TimeDelta pause_target() const { return pause_target_; }
+
  private:
   class IncrementalMarkingRootMarkingVisitor;
 
@@ -229,6 +235,7 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
       background_live_bytes_;
   std::unique_ptr<::heap::base::IncrementalMarkingSchedule> schedule_;
   base::Optional<uint64_t> current_trace_id_;
+  v8::base::TimeDelta pause_target_;
 
   friend class IncrementalMarkingJob;
 };
@@ -393,6 +393,7 @@ void MarkCompactCollector::CollectGarbage() {
   ClearNonLiveReferences();
   VerifyMarking();
   heap_->memory_measurement()->FinishProcessing(native_context_stats_);
+  if (V8_UNLIKELY(v8_flags.trace_code_working_set)) ReportCodeWorkingSet();
 
   Sweep();
   Evacuate();
@@ -441,8 +442,8 @@ void MarkCompactCollector::VerifyMarkbitsAreClean() {
 #endif  // VERIFY_HEAP
 
 void MarkCompactCollector::ComputeEvacuationHeuristics(
-    size_t area_size, int* target_fragmentation_percent,
-    size_t* max_evacuated_bytes) {
+    size_t area_size, bool reduce_fragmentation,
+    int* target_fragmentation_percent, size_t* max_evacuated_bytes) {
   // For memory reducing and optimize for memory mode we directly define both
   // constants.
   const int kTargetFragmentationPercentForReduceMemory = 20;
@@ -459,7 +460,7 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   // exist enough compaction speed samples.
   const float kTargetMsPerArea = .5;
 
-  if (heap_->ShouldReduceMemory()) {
+  if (heap_->ShouldReduceMemory() || reduce_fragmentation) {
     *target_fragmentation_percent = kTargetFragmentationPercentForReduceMemory;
     *max_evacuated_bytes = kMaxEvacuatedBytesForReduceMemory;
   } else if (heap_->ShouldOptimizeForMemoryUsage()) {
@@ -488,6 +489,62 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   }
 }
 
+bool MarkCompactCollector::IsFragmentedCodeSpace(PagedSpace* space) const {
+  // Code pages cannot be reused for other objects, so a code space fragmented
+  // by deoptimized and flushed code only shrinks by compaction. The regular
+  // heuristics only pick nearly empty pages, which long-running processes
+  // rarely have in code space.
+  if (space->identity() != CODE_SPACE ||
+      v8_flags.compact_code_space_fragmentation_percent <= 0) {
+    return false;
+  }
+  const size_t number_of_pages = space->CountTotalPages();
+  if (number_of_pages < 2) return false;
+  const size_t capacity = number_of_pages * space->AreaSize();
+  const size_t free_bytes = capacity - std::min(capacity, space->Size());
+  return free_bytes * 100 >=
+         capacity * static_cast<size_t>(
+                        v8_flags.compact_code_space_fragmentation_percent);
+}
+
+namespace {
+
+// Optimized code only exists for functions that used up their interrupt
+// budget, i.e. that were called or looped often, so the code kind is a cheap
+// hotness signal that needs no extra counters.
+bool IsHotInstructionStream(InstructionStream istream) {
+  Code code;
+  return istream->TryGetCodeUnchecked(&code, kAcquireLoad) &&
+         CodeKindIsOptimizedJSFunction(code->kind()) &&
+         !code->marked_for_deoptimization();
+}
+
+}  // namespace
+
+void MarkCompactCollector::ReportCodeWorkingSet() {
+  PagedSpace* space = heap_->code_space();
+  size_t hot_bytes = 0;
+  size_t hot_pages = 0;
+  for (Page* page : *space) {
+    bool has_hot_code = false;
+    for (auto [object, size] : LiveObjectRange(page)) {
+      if (!object.IsInstructionStream() ||
+          !IsHotInstructionStream(InstructionStream::cast(object))) {
+        continue;
+      }
+      hot_bytes += size;
+      has_hot_code = true;
+    }
+    if (has_hot_code) hot_pages++;
+  }
+  const size_t area_size = space->AreaSize();
+  PrintIsolate(heap_->isolate(),
+               "code working set: %zu KB of optimized code on %zu of %zu code "
+               "pages (%zu if contiguous)\n",
+               hot_bytes / KB, hot_pages, space->CountTotalPages(),
+               (hot_bytes + area_size - 1) / area_size);
+}
+
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   DCHECK(space->identity() == OLD_SPACE || space->identity() == CODE_SPACE ||
          space->identity() == SHARED_SPACE);
@@ -499,6 +556,7 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
       !(v8_flags.manual_evacuation_candidates_selection ||
         v8_flags.stress_compaction_random || v8_flags.stress_compaction ||
         v8_flags.compact_on_every_full_gc);
+  const bool reduce_fragmentation = IsFragmentedCodeSpace(space);
   // Those variables will only be initialized if |in_standard_path|, and are not
   // used otherwise.
   size_t max_evacuated_bytes;
@@ -511,7 +569,8 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     //   between live bytes and capacity of this page (= area).
     // * Evacuation quota: A global quota determining how much bytes should be
     //   compacted.
-    ComputeEvacuationHeuristics(area_size, &target_fragmentation_percent,
+    ComputeEvacuationHeuristics(area_size, reduce_fragmentation,
+                                &target_fragmentation_percent,
                                 &max_evacuated_bytes);
     free_bytes_threshold = target_fragmentation_percent * (area_size / 100);
   }
@@ -642,10 +701,10 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
 
   if (v8_flags.trace_fragmentation) {
     PrintIsolate(heap_->isolate(),
-                 "compaction-selection: space=%s reduce_memory=%d pages=%d "
-                 "total_live_bytes=%zu\n",
-                 ToString(space->identity()), reduce_memory, candidate_count,
-                 total_live_bytes / KB);
+                 "compaction-selection: space=%s reduce_memory=%d "
+                 "reduce_fragmentation=%d pages=%d total_live_bytes=%zu\n",
+                 ToString(space->identity()), reduce_memory,
+                 reduce_fragmentation, candidate_count, total_live_bytes / KB);
   }
 }
 
@@ -1500,6 +1559,10 @@ class EvacuateVisitorBase : public HeapObjectVisitor {
         allocation = shared_old_allocator_->AllocateRaw(size, alignment,
                                                         AllocationOrigin::kGC);
       }
+    } else if (target_space == CODE_SPACE &&
+               v8_flags.code_space_hotness_layout &&
+               IsHotInstructionStream(InstructionStream::cast(object))) {
+      allocation = local_allocator_->AllocateHotCode(size, alignment);
     } else {
       allocation = local_allocator_->Allocate(target_space, size,
                                               AllocationOrigin::kGC, alignment);
@@ -2011,7 +2074,7 @@ void MarkCompactCollector::MarkTransitiveClosureLinear() {
            GCTracer::Scope::MC_MARK_WEAK_CLOSURE_EPHEMERON_LINEAR);
   // This phase doesn't support parallel marking.
   DCHECK(heap_->concurrent_marking()->IsStopped());
-  std::unordered_multimap<HeapObject, HeapObject, Object::Hasher> key_to_values;
+  EphemeronMarking::KeyToValues key_to_values;
   Ephemeron ephemeron;
 
   DCHECK(
@@ -2026,6 +2089,13 @@ void MarkCompactCollector::MarkTransitiveClosureLinear() {
   }
 
   ephemeron_marking_.newly_discovered_limit = key_to_values.size();
+  // Only record newly discovered objects that are ephemeron keys. Large object
+  // graphs would otherwise overflow newly_discovered on every iteration and
+  // force a scan of all ephemerons, making this phase quadratic again. Keys
+  // of ephemerons discovered while draining the worklist below are inserted
+  // only afterwards; if such a key was marked in the meantime, processing the
+  // discovered ephemeron marks its value directly.
+  ephemeron_marking_.key_to_values = &key_to_values;
   bool work_to_do = true;
 
   while (work_to_do) {
@@ -2089,6 +2159,7 @@ void MarkCompactCollector::MarkTransitiveClosureLinear() {
 
   ResetNewlyDiscovered();
   ephemeron_marking_.newly_discovered.shrink_to_fit();
+  ephemeron_marking_.key_to_values = nullptr;
 
   CHECK(local_marking_worklists_->IsEmpty());
 
@@ -2466,6 +2537,7 @@ class ParallelClearingJob final : public v8::JobTask {
     std::unique_ptr<ClearingItem> item;
     {
       base::MutexGuard guard(&items_mutex_);
+      if (items_.empty()) return;
       item = std::move(items_.back());
       items_.pop_back();
     }
@@ -2491,30 +2563,99 @@ class ParallelClearingJob final : public v8::JobTask {
   std::vector<std::unique_ptr<ClearingItem>> items_;
 };
 
+// Prunes a range of the string table, removing all strings only pointed to by
+// the string table. Large tables are split into several items that are
+// processed in parallel. As the items of one table may run concurrently, their
+// time is summed up in |elapsed| and added to the tracer by the main thread.
 class ClearStringTableJobItem final : public ParallelClearingJob::ClearingItem {
  public:
-  explicit ClearStringTableJobItem(Isolate* isolate)
+  // Number of entries pruned by one item.
+  static constexpr int kChunkSize = 64 * KB;
+
+  ClearStringTableJobItem(Isolate* isolate, int start, int end,
+                          std::atomic<int64_t>* elapsed)
       : isolate_(isolate),
+        start_(start),
+        end_(end),
+        elapsed_(elapsed),
         trace_id_(reinterpret_cast<uint64_t>(this) ^
                   isolate->heap()->tracer()->CurrentEpoch(
                       GCTracer::Scope::MC_CLEAR_STRING_TABLE)) {}
 
   void Run(JobDelegate* delegate) final {
-    if (isolate_->OwnsStringTables()) {
-      TRACE_GC1_WITH_FLOW(isolate_->heap()->tracer(),
-                          GCTracer::Scope::MC_CLEAR_STRING_TABLE,
-                          delegate->IsJoiningThread() ? ThreadKind::kMain
-                                                      : ThreadKind::kBackground,
-                          trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
-      // Prune the string table removing all strings only pointed to by the
-      // string table.  Cannot use string_table() here because the string
-      // table is marked.
-      StringTable* string_table = isolate_->string_table();
-      InternalizedStringTableCleaner internalized_visitor(isolate_->heap());
-      string_table->DropOldData();
-      string_table->IterateElements(&internalized_visitor);
-      string_table->NotifyElementsRemoved(
-          internalized_visitor.PointersRemoved());
+    TRACE_EVENT_WITH_FLOW0(
+        TRACE_GC_CATEGORIES,
+        GCTracer::Scope::Name(GCTracer::Scope::MC_CLEAR_STRING_TABLE),
+        trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
+    const base::TimeTicks start_time = base::TimeTicks::Now();
+    // Cannot use string_table() here because the string table is marked.
+    StringTable* string_table = isolate_->string_table();
+    if (start_ == 0) string_table->DropOldData();
+    InternalizedStringTableCleaner internalized_visitor(isolate_->heap());
+    string_table->IterateElements(&internalized_visitor, start_, end_);
+    string_table->NotifyElementsRemoved(internalized_visitor.PointersRemoved());
+    elapsed_->fetch_add((base::TimeTicks::Now() - start_time).InMicroseconds(),
+                        std::memory_order_relaxed);
+  }
+
+  uint64_t trace_id() const { return trace_id_; }
+
+ private:
+  Isolate* const isolate_;
+  const int start_;
+  const int end_;
+  std::atomic<int64_t>* const elapsed_;
+  const uint64_t trace_id_;
+};
+
+// Frees the records of the string forwarding table that were retired by
+// FullStringForwardingTableCleaner::TransitionStrings().
+class FreeStringForwardingTableJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit FreeStringForwardingTableJobItem(Isolate* isolate)
+      : isolate_(isolate),
+        trace_id_(reinterpret_cast<uint64_t>(this) ^
+                  isolate->heap()->tracer()->CurrentEpoch(
+                      GCTracer::Scope::MC_CLEAR_STRING_FORWARDING_TABLE)) {}
+
+  void Run(JobDelegate* delegate) final {
+    TRACE_GC1_WITH_FLOW(isolate_->heap()->tracer(),
+                        GCTracer::Scope::MC_CLEAR_STRING_FORWARDING_TABLE,
+                        delegate->IsJoiningThread() ? ThreadKind::kMain
+                                                    : ThreadKind::kBackground,
+                        trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
+    isolate_->string_forwarding_table()->FreeRetiredBlocks();
+  }
+
+  uint64_t trace_id() const { return trace_id_; }
+
+ private:
+  Isolate* const isolate_;
+  const uint64_t trace_id_;
+};
+
+#ifdef V8_ENABLE_SANDBOX
+class SweepExternalPointerTableJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit SweepExternalPointerTableJobItem(Isolate* isolate)
+      : isolate_(isolate),
+        trace_id_(reinterpret_cast<uint64_t>(this) ^
+                  isolate->heap()->tracer()->CurrentEpoch(
+                      GCTracer::Scope::MC_SWEEP_EXTERNAL_POINTER_TABLE)) {}
+
+  void Run(JobDelegate* delegate) final {
+    TRACE_GC1_WITH_FLOW(isolate_->heap()->tracer(),
+                        GCTracer::Scope::MC_SWEEP_EXTERNAL_POINTER_TABLE,
+                        delegate->IsJoiningThread() ? ThreadKind::kMain
+                                                    : ThreadKind::kBackground,
+                        trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
+    isolate_->external_pointer_table().SweepAndCompact(
+        isolate_->heap()->external_pointer_space(), isolate_->counters());
+    if (isolate_->owns_shareable_data()) {
+      isolate_->shared_external_pointer_table().SweepAndCompact(
+          isolate_->shared_external_pointer_space(), isolate_->counters());
     }
   }
 
@@ -2524,6 +2665,7 @@ class ClearStringTableJobItem final : public ParallelClearingJob::ClearingItem {
   Isolate* const isolate_;
   const uint64_t trace_id_;
 };
+#endif  // V8_ENABLE_SANDBOX
 
 class FullStringForwardingTableCleaner final
     : public StringForwardingTableCleanerBase {
@@ -2544,7 +2686,8 @@ class FullStringForwardingTableCleaner final
         [&](StringForwardingTable::Record* record) {
           TransitionStrings(record);
         });
-    forwarding_table->Reset();
+    // Freeing the old records is left to FreeStringForwardingTableJobItem.
+    forwarding_table->ResetAndRetireBlocks();
   }
 
   // When performing GC with a stack, we conservatively assume that
@@ -2682,12 +2825,28 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   }
 
   auto clearing_job = std::make_unique<ParallelClearingJob>(this);
-  auto clear_string_table_job_item =
-      std::make_unique<ClearStringTableJobItem>(isolate);
-  const uint64_t trace_id = clear_string_table_job_item->trace_id();
-  clearing_job->Add(std::move(clear_string_table_job_item));
-  TRACE_GC_NOTE_WITH_FLOW("ClearStringTableJob started", trace_id,
-                          TRACE_EVENT_FLAG_FLOW_OUT);
+  std::atomic<int64_t> clear_string_table_elapsed{0};
+  if (isolate->OwnsStringTables()) {
+    auto free_forwarding_table_job_item =
+        std::make_unique<FreeStringForwardingTableJobItem>(isolate);
+    TRACE_GC_NOTE_WITH_FLOW("FreeStringForwardingTableJob started",
+                            free_forwarding_table_job_item->trace_id(),
+                            TRACE_EVENT_FLAG_FLOW_OUT);
+    clearing_job->Add(std::move(free_forwarding_table_job_item));
+    const int capacity = isolate->string_table()->Capacity();
+    for (int start = 0; start < capacity;
+         start += ClearStringTableJobItem::kChunkSize) {
+      auto clear_string_table_job_item =
+          std::make_unique<ClearStringTableJobItem>(
+              isolate, start,
+              std::min(start + ClearStringTableJobItem::kChunkSize, capacity),
+              &clear_string_table_elapsed);
+      TRACE_GC_NOTE_WITH_FLOW("ClearStringTableJob started",
+                              clear_string_table_job_item->trace_id(),
+                              TRACE_EVENT_FLAG_FLOW_OUT);
+      clearing_job->Add(std::move(clear_string_table_job_item));
+    }
+  }
   auto clearing_job_handle = V8::GetCurrentPlatform()->CreateJob(
       TaskPriority::kUserBlocking, std::move(clearing_job));
   if (v8_flags.parallel_weak_ref_clearing && UseBackgroundThreadsInCycle()) {
@@ -2720,6 +2879,31 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     }
   }
 
+#ifdef V8_ENABLE_SANDBOX
+  // External pointer table sweeping needs to happen before evacuating live
+  // objects as it may perform table compaction, which requires objects to
+  // still be at the same location as during marking. It also needs to happen
+  // after phantom handles and external strings were processed, as those read
+  // the external pointers of dead objects. None of the clearing below touches
+  // the table, so sweep it concurrently.
+  auto sweep_external_pointer_table_job =
+      std::make_unique<ParallelClearingJob>(this);
+  auto sweep_external_pointer_table_job_item =
+      std::make_unique<SweepExternalPointerTableJobItem>(isolate);
+  TRACE_GC_NOTE_WITH_FLOW("SweepExternalPointerTableJob started",
+                          sweep_external_pointer_table_job_item->trace_id(),
+                          TRACE_EVENT_FLAG_FLOW_OUT);
+  sweep_external_pointer_table_job->Add(
+      std::move(sweep_external_pointer_table_job_item));
+  auto sweep_external_pointer_table_job_handle =
+      V8::GetCurrentPlatform()->CreateJob(
+          TaskPriority::kUserBlocking,
+          std::move(sweep_external_pointer_table_job));
+  if (v8_flags.parallel_weak_ref_clearing && UseBackgroundThreadsInCycle()) {
+    sweep_external_pointer_table_job_handle->NotifyConcurrencyIncrease();
+  }
+#endif  // V8_ENABLE_SANDBOX
+
   {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_FLUSHABLE_BYTECODE);
     // `ProcessFlushedBaselineCandidates()` must be called after
@@ -2762,18 +2946,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   MarkDependentCodeForDeoptimization();
 
 #ifdef V8_ENABLE_SANDBOX
-  {
-    TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_SWEEP_EXTERNAL_POINTER_TABLE);
-    // External pointer table sweeping needs to happen before evacuating live
-    // objects as it may perform table compaction, which requires objects to
-    // still be at the same location as during marking.
-    isolate->external_pointer_table().SweepAndCompact(
-        isolate->heap()->external_pointer_space(), isolate->counters());
-    if (isolate->owns_shareable_data()) {
-      isolate->shared_external_pointer_table().SweepAndCompact(
-          isolate->shared_external_pointer_space(), isolate->counters());
-    }
-  }
+  sweep_external_pointer_table_job_handle->Join();
 #endif  // V8_ENABLE_SANDBOX
 
 #ifdef V8_CODE_POINTER_SANDBOXING
@@ -2788,6 +2961,10 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_JOIN_JOB);
     clearing_job_handle->Join();
   }
+  heap_->tracer()->AddScopeSample(
+      GCTracer::Scope::MC_CLEAR_STRING_TABLE,
+      base::TimeDelta::FromMicroseconds(
+          clear_string_table_elapsed.load(std::memory_order_relaxed)));
 
   DCHECK(weak_objects_.transition_arrays.IsEmpty());
   DCHECK(weak_objects_.weak_references.IsEmpty());
@@ -2917,6 +3094,7 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   // Use the raw function data setter to avoid validity checks, since we're
   // performing the unusual task of decompiling.
   shared_info->set_function_data(uncompiled_data, kReleaseStore);
+  shared_info->set_bytecode_was_flushed(true);
   DCHECK(!shared_info->is_compiled());
 }
 
@@ -2947,6 +3125,7 @@ void MarkCompactCollector::ProcessOldCodeCandidates() {
     PrintIsolate(heap_->isolate(), "%d flushed SharedFunctionInfo(s)\n",
                  number_of_flushed_sfis);
   }
+  heap_->tracer()->NotifyBytecodeFlushed(number_of_flushed_sfis);
 }
 
 bool MarkCompactCollector::ProcessOldBytecodeSFI(
@@ -3146,6 +3325,16 @@ bool MarkCompactCollector::CompactTransitionArray(Map map,
   DCHECK(!map->is_prototype_map());
   int num_transitions = transitions->number_of_entries();
   if (!TransitionArrayNeedsCompaction(transitions, num_transitions)) {
+    // All targets are alive, but the slack reserved for future insertions is
+    // still worth returning when the heap is supposed to shrink.
+    if (heap_->ShouldReduceMemory() &&
+        !heap_->isolate()->has_active_deserializer()) {
+      int trim = transitions->Capacity() - num_transitions;
+      if (trim > 0) {
+        heap_->RightTrimWeakFixedArray(transitions,
+                                       trim * TransitionArray::kEntrySize);
+      }
+    }
     return false;
   }
   bool descriptors_owner_died = false;
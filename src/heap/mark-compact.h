@@ -140,6 +140,11 @@ class MarkCompactCollector final {
 
   void AddNewlyDiscovered(HeapObject object) {
     if (ephemeron_marking_.newly_discovered_overflowed) return;
+    if (ephemeron_marking_.key_to_values &&
+        ephemeron_marking_.key_to_values->find(object) ==
+            ephemeron_marking_.key_to_values->end()) {
+      return;
+    }
 
     if (ephemeron_marking_.newly_discovered.size() <
         ephemeron_marking_.newly_discovered_limit) {
@@ -164,9 +169,16 @@ class MarkCompactCollector final {
  private:
   using ResizeNewSpaceMode = Heap::ResizeNewSpaceMode;
 
-  void ComputeEvacuationHeuristics(size_t area_size,
+  void ComputeEvacuationHeuristics(size_t area_size, bool reduce_fragmentation,
                                    int* target_fragmentation_percent,
                                    size_t* max_evacuated_bytes);
+  // Returns true if enough of |space| is free to compact it with the memory
+  // reducing heuristics, see --compact-code-space-fragmentation-percent.
+  bool IsFragmentedCodeSpace(PagedSpace* space) const;
+
+  // Prints how many code pages live optimized code is spread over, see
+  // --trace-code-working-set.
+  void ReportCodeWorkingSet();
 
   void RecordObjectStats();
 
@@ -221,6 +221,9 @@ int MarkingVisitorBase<ConcreteVisitor>::VisitSharedFunctionInfo(
   // We found a BytecodeArray that can be flushed. Increment the age of the SFI.
   if (can_flush_bytecode && !should_keep_ages_unchanged_) {
     MakeOlder(shared_info);
+    if (V8_UNLIKELY(v8_flags.trace_flush_code)) {
+      heap_->tracer()->RecordBytecodeAge(shared_info->age());
+    }
   }
 
   if (!can_flush_bytecode || !ShouldFlushCode(shared_info)) {
@@ -290,7 +293,7 @@ bool MarkingVisitorBase<ConcreteVisitor>::IsOld(SharedFunctionInfo sfi) const {
     return isolate_in_background_ ||
            V8_UNLIKELY(sfi->age() == SharedFunctionInfo::kMaxAge);
   } else {
-    return sfi->age() >= v8_flags.bytecode_old_age;
+    return sfi->age() >= bytecode_old_age_;
   }
 }
 
@@ -318,10 +321,12 @@ void MarkingVisitorBase<ConcreteVisitor>::MakeOlder(
     // No need to increment age.
   } else {
     uint16_t age = sfi->age();
-    if (age < v8_flags.bytecode_old_age) {
+    if (age < bytecode_old_age_) {
       sfi->CompareExchangeAge(age, age + 1);
     }
-    DCHECK_LE(sfi->age(), v8_flags.bytecode_old_age);
+    // The adaptive age may have been lowered since older functions were aged.
+    DCHECK_IMPLIES(!v8_flags.flush_code_adaptive_age,
+                   sfi->age() <= bytecode_old_age_);
   }
 }
 
@@ -373,15 +378,17 @@ int MarkingVisitorBase<ConcreteVisitor>::VisitFixedArrayWithProgressBar(
   }
   int end = std::min(size, start + kProgressBarScanningChunk);
   if (start < end) {
-    VisitPointers(object, object->RawField(start), object->RawField(end));
+    // Claim the chunk and push the rest of the object back onto the marking
+    // worklist before scanning, so that other marking tasks can steal the
+    // following chunks while this one is being visited. The object can be
+    // pushed back only after the progress bar was updated.
     bool success = progress_bar.TrySetNewValue(current_progress_bar, end);
     CHECK(success);
     if (end < size) {
-      // The object can be pushed back onto the marking worklist only after
-      // progress bar was updated.
       DCHECK(ShouldMarkObject(object));
       local_marking_worklists_->Push(object);
     }
+    VisitPointers(object, object->RawField(start), object->RawField(end));
   }
   return end - start;
 }
@@ -5,9 +5,12 @@
 #ifndef V8_HEAP_MARKING_VISITOR_H_
 #define V8_HEAP_MARKING_VISITOR_H_
 
+#include <unordered_map>
+
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/heap/ephemeron-remembered-set.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/marking-state.h"
 #include "src/heap/marking-worklist.h"
 #include "src/heap/objects-visiting.h"
@@ -20,9 +23,15 @@ namespace v8 {
 namespace internal {
 
 struct EphemeronMarking {
+  using KeyToValues =
+      std::unordered_multimap<HeapObject, HeapObject, Object::Hasher>;
+
   std::vector<HeapObject> newly_discovered;
   bool newly_discovered_overflowed;
   size_t newly_discovered_limit;
+  // Ephemerons whose value is not marked yet, indexed by key. When set, only
+  // objects that are keys in this map are recorded in newly_discovered.
+  const KeyToValues* key_to_values = nullptr;
 };
 
 // The base class for all marking visitors (main and concurrent marking) but
@@ -64,6 +73,7 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
         should_keep_ages_unchanged_(should_keep_ages_unchanged),
         should_mark_shared_heap_(heap->isolate()->is_shared_space_isolate()),
         code_flushing_increase_(code_flushing_increase),
+        bytecode_old_age_(heap->tracer()->BytecodeOldAge()),
         isolate_in_background_(heap->isolate()->IsIsolateInBackground())
 #ifdef V8_ENABLE_SANDBOX
         ,
@@ -210,6 +220,7 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
   const bool should_keep_ages_unchanged_;
   const bool should_mark_shared_heap_;
   const uint16_t code_flushing_increase_;
+  const uint16_t bytecode_old_age_;
   const bool isolate_in_background_;
 #ifdef V8_ENABLE_SANDBOX
   ExternalPointerTable* const external_pointer_table_;
@@ -7,6 +7,7 @@
 #include <cinttypes>
 
 #include "src/base/address-region.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -141,7 +142,10 @@ void MemoryAllocator::Unmapper::CancelAndWaitForPendingTasks() {
 }
 
 void MemoryAllocator::Unmapper::PrepareForGC() {
-  // Free non-regular chunks because they cannot be re-used.
+  // Free non-regular chunks because they cannot be re-used. An active job
+  // releases them before any regular chunk, so leave them to it instead of
+  // unmapping possibly many large pages on the main thread.
+  if (job_handle_ && job_handle_->IsValid() && job_handle_->IsActive()) return;
   PerformFreeMemoryOnQueuedNonRegularChunks();
 }
 
@@ -168,6 +172,9 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks(
         "Unmapper::PerformFreeMemoryOnQueuedChunks: %d queued chunks\n",
         NumberOfChunks());
   }
+  // Large and executable chunks cannot be re-used, release them first.
+  PerformFreeMemoryOnQueuedNonRegularChunks(delegate);
+  if (delegate && delegate->ShouldYield()) return;
   // Regular chunks.
   while ((chunk = GetMemoryChunkSafe(ChunkQueueType::kRegular)) != nullptr) {
     bool pooled = chunk->IsFlagSet(MemoryChunk::POOLED);
@@ -184,7 +191,7 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks(
       if (delegate && delegate->ShouldYield()) return;
     }
   }
-  PerformFreeMemoryOnQueuedNonRegularChunks();
+  PerformFreeMemoryOnQueuedNonRegularChunks(delegate);
 }
 
 void MemoryAllocator::Unmapper::TearDown() {
@@ -364,7 +371,14 @@ MemoryAllocator::AllocateUninitializedChunkAt(BaseSpace* space,
 #ifndef V8_COMPRESS_POINTERS
   // When pointer compression is enabled, spaces are expected to be at a
   // predictable address (see mkgrokdump) so we don't supply a hint and rely on
-  // the deterministic behaviour of the BoundedPageAllocator.
+  // the deterministic behaviour of the BoundedPageAllocator. Its best-fit
+  // allocation also keeps regular pages packed for huge pages.
+  const bool group_in_huge_pages = v8_flags.heap_huge_pages &&
+                                   executable == NOT_EXECUTABLE &&
+                                   page_size == PageSize::kRegular;
+  if (hint == kNullAddress && group_in_huge_pages) {
+    hint = next_page_hint_.load(std::memory_order_relaxed);
+  }
   if (hint == kNullAddress) {
     hint = reinterpret_cast<Address>(AlignedAddress(
         isolate_->heap()->GetRandomMmapAddr(), MemoryChunk::kAlignment));
@@ -381,6 +395,23 @@ MemoryAllocator::AllocateUninitializedChunkAt(BaseSpace* space,
       executable, reinterpret_cast<void*>(hint), &reservation);
   if (base == kNullAddress) return {};
 
+  if (const int numa_node = isolate_->heap()->numa_node(); numa_node >= 0) {
+    // Committed pages are only faulted in later, so the policy still applies
+    // to the whole chunk.
+    USE(base::OS::SetNumaPreferredNode(reinterpret_cast<void*>(base),
+                                       chunk_size, numa_node));
+  }
+
+#ifndef V8_COMPRESS_POINTERS
+  if (group_in_huge_pages) {
+    // Outside of a cage every page is a mapping of its own. The OS merges
+    // adjacent mappings with the same advice, so that consecutive pages can
+    // share a huge page.
+    USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(base), chunk_size));
+    next_page_hint_.store(base + chunk_size, std::memory_order_relaxed);
+  }
+#endif  // !V8_COMPRESS_POINTERS
+
   size_ += reservation.size();
 
   // Update executable memory size.
@@ -833,6 +864,10 @@ const BasicMemoryChunk* MemoryAllocator::LookupChunkContainingAddress(
 #endif  // V8_ENABLE_CONSERVATIVE_STACK_SCANNING || DEBUG
 
 void MemoryAllocator::RecordNormalPageCreated(const Page& page) {
+  if (v8_flags.heap_huge_pages) {
+    base::MutexGuard guard(&huge_page_frames_mutex_);
+    huge_page_frames_[RoundDown(page.address(), kHugePageSize)]++;
+  }
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
   base::MutexGuard guard(&pages_mutex_);
   auto result = normal_pages_.insert(&page);
@@ -842,6 +877,12 @@ void MemoryAllocator::RecordNormalPageCreated(const Page& page) {
 }
 
 void MemoryAllocator::RecordNormalPageDestroyed(const Page& page) {
+  if (v8_flags.heap_huge_pages) {
+    base::MutexGuard guard(&huge_page_frames_mutex_);
+    auto it = huge_page_frames_.find(RoundDown(page.address(), kHugePageSize));
+    DCHECK_NE(it, huge_page_frames_.end());
+    if (--it->second == 0) huge_page_frames_.erase(it);
+  }
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
   base::MutexGuard guard(&pages_mutex_);
   auto size = normal_pages_.erase(&page);
@@ -868,5 +909,19 @@ void MemoryAllocator::RecordLargePageDestroyed(const LargePage& page) {
 #endif  // V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 }
 
+double MemoryAllocator::HugePageCoverage() {
+  static constexpr int kPagesPerHugePage = static_cast<int>(
+      std::max(size_t{1}, kHugePageSize / MemoryChunk::kPageSize));
+  base::MutexGuard guard(&huge_page_frames_mutex_);
+  size_t pages = 0;
+  size_t covered_pages = 0;
+  for (const auto& [frame, frame_pages] : huge_page_frames_) {
+    pages += frame_pages;
+    if (frame_pages == kPagesPerHugePage) covered_pages += frame_pages;
+  }
+  if (pages == 0) return 0.0;
+  return 100.0 * static_cast<double>(covered_pages) / pages;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -8,6 +8,7 @@
 #include <atomic>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -215,6 +216,15 @@ class MemoryAllocator {
   // Returns allocated executable spaces in bytes.
   size_t SizeExecutable() const { return size_executable_; }
 
+  // Size of the huge pages that regular pages are grouped into with
+  // --heap-huge-pages.
+  static constexpr size_t kHugePageSize = size_t{2} * MB;
+
+  // Returns the percentage of regular pages that are located in completely
+  // populated huge page frames, i.e. the share of regular pages that the OS
+  // is able to back with huge pages. Only tracked with --heap-huge-pages.
+  V8_EXPORT_PRIVATE double HugePageCoverage();
+
   // Returns the maximum available bytes of heaps.
   size_t Available() const {
     const size_t size = Size();
@@ -492,6 +502,16 @@ class MemoryAllocator {
   mutable base::Mutex pages_mutex_;
 #endif  // V8_ENABLE_CONSERVATIVE_STACK_SCANNING || DEBUG
 
+  // Number of regular pages per huge page frame with --heap-huge-pages.
+  std::unordered_map<Address, int> huge_page_frames_;
+  base::Mutex huge_page_frames_mutex_;
+
+#ifndef V8_COMPRESS_POINTERS
+  // Without a cage regular pages are placed right after the last one so that
+  // they end up grouped in huge page frames with --heap-huge-pages.
+  std::atomic<Address> next_page_hint_{kNullAddress};
+#endif  // !V8_COMPRESS_POINTERS
+
   V8_EXPORT_PRIVATE static size_t commit_page_size_;
   V8_EXPORT_PRIVATE static size_t commit_page_size_bits_;
 
@@ -142,6 +142,15 @@ size_t MemoryChunk::CommittedPhysicalMemory() const {
   return active_system_pages_->Size(MemoryAllocator::GetCommitPageSizeBits());
 }
 
+size_t MemoryChunk::SlotSetMemoryUsage() {
+  size_t usage = 0;
+  for (int type = 0; type < NUMBER_OF_REMEMBERED_SET_TYPES; type++) {
+    SlotSet* slot_set = base::AsAtomicPointer::Acquire_Load(&slot_set_[type]);
+    if (slot_set != nullptr) usage += slot_set->MemoryUsage(buckets());
+  }
+  return usage;
+}
+
 void MemoryChunk::SetOldGenerationPageFlags(MarkingMode marking_mode) {
   if (marking_mode == MarkingMode::kMajorMarking) {
     SetFlag(MemoryChunk::POINTERS_TO_HERE_ARE_INTERESTING);
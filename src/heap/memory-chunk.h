@@ -130,6 +130,10 @@ class MemoryChunk : public BasicMemoryChunk {
   }
   bool ContainsAnySlots() const;
 
+  // Returns the memory used by the untyped slot sets of this chunk. Not safe
+  // to be called concurrently with releasing slot sets or buckets.
+  size_t SlotSetMemoryUsage();
+
   V8_EXPORT_PRIVATE SlotSet* AllocateSlotSet(RememberedSetType type);
   // Not safe to be called concurrently.
   void ReleaseSlotSet(RememberedSetType type);
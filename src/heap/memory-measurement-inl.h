@@ -50,7 +50,11 @@ V8_INLINE bool NativeContextStats::HasExternalBytes(Map map) {
 V8_INLINE void NativeContextStats::IncrementSize(Address context, Map map,
                                                  HeapObject object,
                                                  size_t size) {
-  size_by_context_[context] += size;
+  if (context != pending_context_) {
+    FlushPendingSize();
+    pending_context_ = context;
+  }
+  pending_size_ += size;
   if (HasExternalBytes(map)) {
     IncrementExternalSize(context, map, object);
   }
@@ -387,12 +387,24 @@ bool NativeContextInferrer::InferForJSObject(Isolate* isolate, Map map,
   return false;
 }
 
-void NativeContextStats::Clear() { size_by_context_.clear(); }
+void NativeContextStats::Clear() {
+  size_by_context_.clear();
+  pending_size_ = 0;
+}
 
 void NativeContextStats::Merge(const NativeContextStats& other) {
   for (const auto& it : other.size_by_context_) {
     size_by_context_[it.first] += it.second;
   }
+  if (other.pending_size_ > 0) {
+    size_by_context_[other.pending_context_] += other.pending_size_;
+  }
+}
+
+void NativeContextStats::FlushPendingSize() {
+  if (pending_size_ == 0) return;
+  size_by_context_[pending_context_] += pending_size_;
+  pending_size_ = 0;
 }
 
 void NativeContextStats::IncrementExternalSize(Address context, Map map,
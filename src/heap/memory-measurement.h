@@ -90,9 +90,10 @@ class V8_EXPORT_PRIVATE NativeContextStats {
                                size_t size);
 
   size_t Get(Address context) const {
+    const size_t pending = context == pending_context_ ? pending_size_ : 0;
     const auto it = size_by_context_.find(context);
-    if (it == size_by_context_.end()) return 0;
-    return it->second;
+    if (it == size_by_context_.end()) return pending;
+    return it->second + pending;
   }
   void Clear();
   void Merge(const NativeContextStats& other);
@@ -100,7 +101,14 @@ class V8_EXPORT_PRIVATE NativeContextStats {
  private:
   V8_INLINE bool HasExternalBytes(Map map);
   void IncrementExternalSize(Address context, Map map, HeapObject object);
+  void FlushPendingSize();
+
   std::unordered_map<Address, size_t> size_by_context_;
+  // Marking visits the objects of a context in long runs, so the sizes of the
+  // current run are summed up here and only added to |size_by_context_| when
+  // the context changes.
+  Address pending_context_ = kNullAddress;
+  size_t pending_size_ = 0;
 };
 
 }  // namespace internal
@@ -52,15 +52,19 @@ void MemoryReducer::TimerTask::RunInternal() {
   }
   // The memory reducer will start incremental marking if
   // 1) mutator is likely idle: js call rate is low and allocation rate is low.
+  //    This does not apply if there is a process memory budget.
   // 2) mutator is in background: optimize for memory flag is set.
   const Event event{
       kTimer,
       time_ms,
       heap->CommittedOldGenerationMemory(),
       false,
-      low_allocation_rate || optimize_for_memory,
+      (low_allocation_rate && !heap->HasProcessMemoryBudget()) ||
+          optimize_for_memory,
       heap->incremental_marking()->IsStopped() &&
           (heap->incremental_marking()->CanBeStarted() || optimize_for_memory),
+      heap->HasProcessMemoryBudget(),
+      heap->IsApproachingProcessMemoryBudget(),
   };
   memory_reducer_->NotifyTimer(event);
 }
@@ -105,7 +109,9 @@ void MemoryReducer::NotifyMarkCompact(size_t committed_memory_before) {
       (committed_memory_before > committed_memory + MB) ||
           heap()->HasHighFragmentation(),
       false,
-      false};
+      false,
+      heap()->HasProcessMemoryBudget(),
+      heap()->IsApproachingProcessMemoryBudget()};
   const State old_state = state_;
   state_ = Step(state_, event);
   if (old_state.id() != kWait && state_.id() == kWait) {
@@ -125,7 +131,9 @@ void MemoryReducer::NotifyPossibleGarbage() {
                                    0,
                                    false,
                                    false,
-                                   false};
+                                   false,
+                                   heap()->HasProcessMemoryBudget(),
+                                   heap()->IsApproachingProcessMemoryBudget()};
   const Id old_action = state_.id();
   state_ = Step(state_, event);
   if (old_action != kWait && state_.id() == kWait) {
@@ -135,7 +143,7 @@ void MemoryReducer::NotifyPossibleGarbage() {
 }
 
 bool MemoryReducer::WatchdogGC(const State& state, const Event& event) {
-  return state.last_gc_time_ms() != 0 &&
+  return !event.has_memory_budget && state.last_gc_time_ms() != 0 &&
          event.time_ms > state.last_gc_time_ms() + kWatchdogDelayMs;
 }
 
@@ -152,11 +160,13 @@ MemoryReducer::State MemoryReducer::Step(const State& state,
       if (event.type == kTimer) {
         return state;
       } else if (event.type == kMarkCompact) {
-        if (event.committed_memory <
-            std::max(
-                static_cast<size_t>(state.committed_memory_at_last_run() *
-                                    kCommittedMemoryFactor),
-                state.committed_memory_at_last_run() + kCommittedMemoryDelta)) {
+        if (event.has_memory_budget ||
+            event.committed_memory <
+                std::max(static_cast<size_t>(
+                             state.committed_memory_at_last_run() *
+                             kCommittedMemoryFactor),
+                         state.committed_memory_at_last_run() +
+                             kCommittedMemoryDelta)) {
           return state;
         } else {
           return State::CreateWait(0, event.time_ms + kLongDelayMs,
@@ -174,7 +184,8 @@ MemoryReducer::State MemoryReducer::Step(const State& state,
         case kPossibleGarbage:
           return state;
         case kTimer:
-          if (state.started_gcs() >= MaxNumberOfGCs()) {
+          if (state.started_gcs() >= MaxNumberOfGCs() ||
+              (event.has_memory_budget && !event.approaching_memory_budget)) {
             return State::CreateDone(state.last_gc_time_ms(),
                                      event.committed_memory);
           } else if (event.can_start_incremental_gc &&
@@ -191,8 +202,11 @@ MemoryReducer::State MemoryReducer::Step(const State& state,
                                      state.last_gc_time_ms());
           }
         case kMarkCompact:
-          return State::CreateWait(state.started_gcs(),
-                                   event.time_ms + kLongDelayMs, event.time_ms);
+          return State::CreateWait(
+              state.started_gcs(),
+              event.time_ms + (event.approaching_memory_budget ? kShortDelayMs
+                                                               : kLongDelayMs),
+              event.time_ms);
       }
     case kRun:
       CHECK_LE(state.started_gcs(), MaxNumberOfGCs());
@@ -84,6 +84,15 @@ class Heap;
 // now_ms is the current time,
 // t' is t if the current event is not a GC event and is now_ms otherwise,
 // long_delay_ms, short_delay_ms, and watchdog_delay_ms are constants.
+//
+// If the embedder provided a process memory budget, memory is only reduced
+// when the process approaches the budget:
+// - DONE t stays DONE t on mark-compact GC initiated by the mutator. Instead,
+//   the heap signals possible garbage when the usage crosses the threshold.
+// - WAIT n x t -> DONE t happens in the timer callback unless the budget is
+//   approached. The watchdog and the allocation rate do not apply.
+// - While the budget is approached, short_delay_ms instead of long_delay_ms
+//   is used after a mark-compact GC initiated by the mutator.
 class V8_EXPORT_PRIVATE MemoryReducer {
  public:
   enum Id { kUninit, kDone, kWait, kRun };
@@ -152,6 +161,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
     bool next_gc_likely_to_collect_more;
     bool should_start_incremental_gc;
     bool can_start_incremental_gc;
+    // See Heap::SetProcessMemoryBudget.
+    bool has_memory_budget = false;
+    bool approaching_memory_budget = false;
   };
 
   explicit MemoryReducer(Heap* heap);
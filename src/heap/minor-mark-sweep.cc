@@ -957,17 +957,28 @@ namespace {
 
 // NewSpacePages with more live bytes than this threshold qualify for fast
 // evacuation.
-intptr_t NewSpacePageEvacuationThreshold() {
-  return v8_flags.minor_ms_page_promotion_threshold *
-         MemoryChunkLayout::AllocatableMemoryInDataPage() / 100;
+intptr_t NewSpacePageEvacuationThreshold(Heap* heap) {
+  double threshold_percent = v8_flags.minor_ms_page_promotion_threshold;
+  if (v8_flags.minor_ms_adaptive_page_promotion) {
+    // With high survival rates, objects on pages that are swept in place would
+    // likely be promoted by one of the next cycles anyway. Promote such pages
+    // right away instead of sweeping them over and over.
+    const double survival_rate =
+        std::clamp(heap->young_generation_survival_rate(), 0.0, 100.0);
+    threshold_percent *= 1.0 - survival_rate / 200.0;
+  }
+  return static_cast<intptr_t>(
+      threshold_percent * MemoryChunkLayout::AllocatableMemoryInDataPage() /
+      100);
 }
 
 bool ShouldMovePage(Page* p, intptr_t live_bytes, intptr_t wasted_bytes) {
   DCHECK(v8_flags.page_promotion);
   Heap* heap = p->heap();
   DCHECK(!p->NeverEvacuate());
+  const intptr_t promotion_threshold = NewSpacePageEvacuationThreshold(heap);
   const bool should_move_page =
-      ((live_bytes + wasted_bytes) > NewSpacePageEvacuationThreshold() ||
+      ((live_bytes + wasted_bytes) > promotion_threshold ||
        (p->AllocatedLabSize() == 0)) &&
       (heap->new_space()->IsPromotionCandidate(p)) &&
       heap->CanExpandOldGeneration(live_bytes);
@@ -977,8 +988,8 @@ bool ShouldMovePage(Page* p, intptr_t live_bytes, intptr_t wasted_bytes) {
         "[Page Promotion] %p: collector=mmc, should move: %d"
         ", live bytes = %zu, wasted bytes = %zu, promotion threshold = %zu"
         ", allocated labs size = %zu\n",
-        p, should_move_page, live_bytes, wasted_bytes,
-        NewSpacePageEvacuationThreshold(), p->AllocatedLabSize());
+        p, should_move_page, live_bytes, wasted_bytes, promotion_threshold,
+        p->AllocatedLabSize());
   }
   if (!should_move_page &&
       (p->AgeInNewSpace() == v8_flags.minor_ms_max_page_age)) {
@@ -503,12 +503,17 @@ SemiSpaceNewSpace::~SemiSpaceNewSpace() {
 }
 
 void SemiSpaceNewSpace::Grow() {
-  heap()->safepoint()->AssertActive();
   // Double the semispace size but only up to maximum capacity.
   DCHECK(TotalCapacity() < MaximumCapacity());
-  size_t new_capacity = std::min(
-      MaximumCapacity(),
-      static_cast<size_t>(v8_flags.semi_space_growth_factor) * TotalCapacity());
+  GrowTo(std::min(MaximumCapacity(),
+                  static_cast<size_t>(v8_flags.semi_space_growth_factor) *
+                      TotalCapacity()));
+}
+
+void SemiSpaceNewSpace::GrowTo(size_t new_capacity) {
+  heap()->safepoint()->AssertActive();
+  DCHECK_GT(new_capacity, TotalCapacity());
+  DCHECK_LE(new_capacity, MaximumCapacity());
   if (to_space_.GrowTo(new_capacity)) {
     // Only grow from space if we managed to grow to-space.
     if (!from_space_.GrowTo(new_capacity)) {
@@ -520,8 +525,10 @@ void SemiSpaceNewSpace::Grow() {
   DCHECK_SEMISPACE_ALLOCATION_INFO(allocation_info_, to_space_);
 }
 
-void SemiSpaceNewSpace::Shrink() {
-  size_t new_capacity = std::max(InitialTotalCapacity(), 2 * Size());
+void SemiSpaceNewSpace::Shrink() { ShrinkTo(InitialTotalCapacity()); }
+
+void SemiSpaceNewSpace::ShrinkTo(size_t new_capacity) {
+  new_capacity = std::max({new_capacity, InitialTotalCapacity(), 2 * Size()});
   size_t rounded_new_capacity = ::RoundUp(new_capacity, Page::kPageSize);
   if (rounded_new_capacity < TotalCapacity()) {
     to_space_.ShrinkTo(rounded_new_capacity);
@@ -741,7 +748,7 @@ void SemiSpaceNewSpace::VerifyObjects(Isolate* isolate,
   }
 
   if (!v8_flags.concurrent_array_buffer_sweeping) {
-    size_t bytes = heap()->array_buffer_sweeper()->young().BytesSlow();
+    size_t bytes = heap()->array_buffer_sweeper()->YoungBytesSlow();
     CHECK_EQ(bytes,
              ExternalBackingStoreBytes(ExternalBackingStoreType::kArrayBuffer));
   }
@@ -326,9 +326,17 @@ class V8_EXPORT_PRIVATE SemiSpaceNewSpace final : public NewSpace {
   // their maximum capacity.
   void Grow() final;
 
+  // Grow the capacity of the semispaces to |new_capacity|, which must be
+  // page-aligned and larger than the current capacity.
+  void GrowTo(size_t new_capacity);
+
   // Shrink the capacity of the semispaces.
   void Shrink();
 
+  // Shrink the capacity of the semispaces towards |new_capacity|, but not
+  // below the initial capacity or twice the allocated size.
+  void ShrinkTo(size_t new_capacity);
+
   // Return the allocated bytes in the active semispace.
   size_t Size() const final {
     DCHECK_GE(top(), to_space_.page_low());
@@ -25,6 +25,7 @@
 #include "src/objects/prototype-info.h"
 #include "src/objects/slots.h"
 #include "src/objects/templates.h"
+#include "src/objects/transitions-inl.h"
 #include "src/objects/visitors.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/ostreams.h"
@@ -790,6 +791,11 @@ void ObjectStatsCollectorImpl::CollectStatistics(
       size_t over_allocated = ObjectStats::kNoOverAllocation;
       if (InstanceTypeChecker::IsJSObject(instance_type)) {
         over_allocated = map->instance_size() - map->UsedInstanceSize();
+      } else if (InstanceTypeChecker::IsTransitionArray(instance_type)) {
+        TransitionArray transitions = TransitionArray::cast(obj);
+        over_allocated = (transitions->Capacity() -
+                          transitions->number_of_transitions()) *
+                         TransitionArray::kEntrySize * kTaggedSize;
       }
       RecordObjectStats(obj, instance_type, obj->Size(cage_base()),
                         over_allocated);
@@ -821,6 +827,8 @@ void ObjectStatsCollectorImpl::CollectGlobalStatistics() {
                                  ObjectStats::STRING_SPLIT_CACHE_TYPE);
   RecordSimpleVirtualObjectStats(HeapObject(), heap_->regexp_multiple_cache(),
                                  ObjectStats::REGEXP_MULTIPLE_CACHE_TYPE);
+  RecordSimpleVirtualObjectStats(HeapObject(), heap_->object_keys_cache(),
+                                 ObjectStats::OBJECT_KEYS_CACHE_TYPE);
 
   // WeakArrayList.
   RecordSimpleVirtualObjectStats(HeapObject(),
@@ -909,6 +917,27 @@ void ObjectStatsCollectorImpl::RecordVirtualMapDetails(Map map) {
                                    ObjectStats::ENUM_INDICES_CACHE_TYPE);
   }
 
+  HeapObject raw_transitions;
+  if (map->raw_transitions(kAcquireLoad)
+          .GetHeapObjectIfStrong(&raw_transitions) &&
+      raw_transitions.IsTransitionArray(cage_base())) {
+    TransitionArray transitions = TransitionArray::cast(raw_transitions);
+    if (transitions->HasPrototypeTransitions()) {
+      // Prototype transitions are kept in a plain WeakFixedArray with
+      // an over-allocated tail for future entries.
+      WeakFixedArray cache = transitions->GetPrototypeTransitions();
+      if (cache->length() > 0) {
+        size_t over_allocated =
+            (cache->length() - TransitionArray::kProtoTransitionHeaderSize -
+             TransitionArray::NumberOfPrototypeTransitions(cache)) *
+            kTaggedSize;
+        RecordVirtualObjectStats(transitions, cache,
+                                 ObjectStats::PROTOTYPE_TRANSITIONS_TYPE,
+                                 cache->Size(), over_allocated);
+      }
+    }
+  }
+
   if (map->is_prototype_map()) {
     PrototypeInfo prototype_info;
     if (map->TryGetPrototypeInfo(&prototype_info)) {
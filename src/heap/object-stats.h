@@ -57,6 +57,7 @@
   V(NUMBER_STRING_CACHE_TYPE)                    \
   V(OBJECT_DICTIONARY_ELEMENTS_TYPE)             \
   V(OBJECT_ELEMENTS_TYPE)                        \
+  V(OBJECT_KEYS_CACHE_TYPE)                      \
   V(OBJECT_PROPERTY_ARRAY_TYPE)                  \
   V(OBJECT_PROPERTY_DICTIONARY_TYPE)             \
   V(OBJECT_TO_CODE_TYPE)                         \
@@ -65,6 +66,7 @@
   V(PROTOTYPE_DESCRIPTOR_ARRAY_TYPE)             \
   V(PROTOTYPE_PROPERTY_ARRAY_TYPE)               \
   V(PROTOTYPE_PROPERTY_DICTIONARY_TYPE)          \
+  V(PROTOTYPE_TRANSITIONS_TYPE)                  \
   V(PROTOTYPE_USERS_TYPE)                        \
   V(REGEXP_MULTIPLE_CACHE_TYPE)                  \
   V(RELOC_INFO_TYPE)                             \
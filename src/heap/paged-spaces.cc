@@ -735,12 +735,12 @@ void PagedSpaceBase::Verify(Isolate* isolate,
 
   if (!v8_flags.concurrent_array_buffer_sweeping) {
     if (identity() == OLD_SPACE) {
-      size_t bytes = heap()->array_buffer_sweeper()->old().BytesSlow();
+      size_t bytes = heap()->array_buffer_sweeper()->OldBytesSlow();
       CHECK_EQ(bytes, ExternalBackingStoreBytes(
                           ExternalBackingStoreType::kArrayBuffer));
     } else if (identity() == NEW_SPACE) {
       DCHECK(v8_flags.minor_ms);
-      size_t bytes = heap()->array_buffer_sweeper()->young().BytesSlow();
+      size_t bytes = heap()->array_buffer_sweeper()->YoungBytesSlow();
       CHECK_EQ(bytes, ExternalBackingStoreBytes(
                           ExternalBackingStoreType::kArrayBuffer));
     }
@@ -175,6 +175,8 @@ void PretenuringHandler::ProcessPretenuringFeedback(
 
   DCHECK(heap_->tracer()->IsInAtomicPause());
 
+  DigestRuntimeAllocationFeedback();
+
   if (!v8_flags.allocation_site_pretenuring) return;
 
   const size_t min_new_space_capacity_for_pretenuring =
@@ -284,7 +286,107 @@ void PretenuringHandler::PretenureAllocationSiteOnNextCollection(
   allocation_sites_to_pretenure_->Push(site);
 }
 
-void PretenuringHandler::reset() { allocation_sites_to_pretenure_.reset(); }
+void PretenuringHandler::reset() {
+  allocation_sites_to_pretenure_.reset();
+  ResetRuntimeAllocationFeedback();
+}
+
+namespace {
+
+// Survival score at which results are pretenured, and its bounds.
+static constexpr int kRuntimePretenureScore = 2;
+static constexpr int kMaxRuntimeSurvivalScore = 4;
+// Every n-th pretenured result is allocated young again to detect phase
+// changes of the application.
+static constexpr int kRuntimeResampleInterval = 16;
+
+}  // namespace
+
+PretenuringHandler::RuntimeAllocationFeedback&
+PretenuringHandler::GetRuntimeAllocationFeedback(RuntimeAllocator allocator,
+                                                 size_t input_size) {
+  const size_t min_input_size =
+      static_cast<size_t>(v8_flags.runtime_pretenuring_min_input_kb) * KB;
+  DCHECK_GE(input_size, min_input_size);
+  // Size classes grow by a factor of 16: [min, 16 * min), [16 * min,
+  // 256 * min), and everything larger.
+  int size_class = 0;
+  for (size_t limit = min_input_size * 16;
+       input_size >= limit && size_class < kNumberOfRuntimeSizeClasses - 1;
+       limit *= 16) {
+    size_class++;
+  }
+  return runtime_allocation_feedback_[static_cast<int>(allocator) *
+                                          kNumberOfRuntimeSizeClasses +
+                                      size_class];
+}
+
+AllocationType PretenuringHandler::GetRuntimeAllocationType(
+    RuntimeAllocator allocator, size_t input_size) {
+  if (!v8_flags.runtime_pretenuring ||
+      input_size <
+          static_cast<size_t>(v8_flags.runtime_pretenuring_min_input_kb) * KB) {
+    return AllocationType::kYoung;
+  }
+  RuntimeAllocationFeedback& feedback =
+      GetRuntimeAllocationFeedback(allocator, input_size);
+  if (feedback.survival_score < kRuntimePretenureScore) {
+    return AllocationType::kYoung;
+  }
+  if (++feedback.pretenured_results % kRuntimeResampleInterval == 0) {
+    return AllocationType::kYoung;
+  }
+  return AllocationType::kOld;
+}
+
+void PretenuringHandler::SampleRuntimeAllocation(RuntimeAllocator allocator,
+                                                 size_t input_size,
+                                                 Handle<Object> result) {
+  if (!v8_flags.runtime_pretenuring ||
+      input_size <
+          static_cast<size_t>(v8_flags.runtime_pretenuring_min_input_kb) * KB ||
+      !result->IsHeapObject() || !Heap::InYoungGeneration(*result)) {
+    return;
+  }
+  RuntimeAllocationFeedback& feedback =
+      GetRuntimeAllocationFeedback(allocator, input_size);
+  // Only the latest result is sampled.
+  if (feedback.is_sampling) return;
+  feedback.sample =
+      heap_->isolate()->global_handles()->Create(*result).location();
+  GlobalHandles::MakeWeak(&feedback.sample);
+  feedback.is_sampling = true;
+}
+
+void PretenuringHandler::DigestRuntimeAllocationFeedback() {
+  for (RuntimeAllocationFeedback& feedback : runtime_allocation_feedback_) {
+    if (!feedback.is_sampling) continue;
+    if (feedback.sample != nullptr) {
+      feedback.survival_score =
+          std::min(feedback.survival_score + 1, kMaxRuntimeSurvivalScore);
+      GlobalHandles::Destroy(feedback.sample);
+      feedback.sample = nullptr;
+    } else {
+      // A result that dies in its first GC disables pretenuring right away, as
+      // pretenuring short-living results is expensive.
+      feedback.survival_score = std::min(feedback.survival_score - 1, 0);
+    }
+    feedback.is_sampling = false;
+    if (v8_flags.trace_pretenuring_statistics) {
+      PrintIsolate(heap_->isolate(),
+                   "pretenuring: runtime allocation feedback %td score=%d\n",
+                   &feedback - runtime_allocation_feedback_.data(),
+                   feedback.survival_score);
+    }
+  }
+}
+
+void PretenuringHandler::ResetRuntimeAllocationFeedback() {
+  for (RuntimeAllocationFeedback& feedback : runtime_allocation_feedback_) {
+    GlobalHandles::Destroy(feedback.sample);
+    feedback = RuntimeAllocationFeedback();
+  }
+}
 
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_PRETENURING_HANDLER_H_
 #define V8_HEAP_PRETENURING_HANDLER_H_
 
+#include <array>
 #include <memory>
 
 #include "src/objects/allocation-site.h"
@@ -75,7 +76,48 @@ class PretenuringHandler final {
 
   V8_EXPORT_PRIVATE static int GetMinMementoCountForTesting();
 
+  // ===========================================================================
+  // Runtime allocator feedback. ===============================================
+  // ===========================================================================
+
+  // Runtime functions that build large object graphs without going through
+  // AllocationSites.
+  enum class RuntimeAllocator { kJsonParse, kValueDeserializer };
+  static constexpr int kNumberOfRuntimeAllocators = 2;
+
+  // Returns where a result built by |allocator| from |input_size| bytes of
+  // input should be allocated. Feedback is kept per allocator and per size
+  // class; inputs below --runtime-pretenuring-min-input-kb are always young.
+  V8_EXPORT_PRIVATE AllocationType GetRuntimeAllocationType(
+      RuntimeAllocator allocator, size_t input_size);
+
+  // Observes whether |result|, which |allocator| allocated in the young
+  // generation from |input_size| bytes of input, survives the next GC.
+  V8_EXPORT_PRIVATE void SampleRuntimeAllocation(RuntimeAllocator allocator,
+                                                 size_t input_size,
+                                                 Handle<Object> result);
+
  private:
+  static constexpr int kNumberOfRuntimeSizeClasses = 3;
+
+  struct RuntimeAllocationFeedback {
+    // Phantom weak handle to the sampled result. The GC resets it to null if
+    // the result dies.
+    Address* sample = nullptr;
+    bool is_sampling = false;
+    // Saturating count of sampled results that survived (positive) or died
+    // (negative) in their first GC.
+    int survival_score = 0;
+    // Counts pretenured results so that the decision is re-validated once in
+    // a while by sampling a young result.
+    int pretenured_results = 0;
+  };
+
+  RuntimeAllocationFeedback& GetRuntimeAllocationFeedback(
+      RuntimeAllocator allocator, size_t input_size);
+  void DigestRuntimeAllocationFeedback();
+  void ResetRuntimeAllocationFeedback();
+
   Heap* const heap_;
 
   // The feedback storage is used to store allocation sites (keys) and how often
@@ -87,6 +129,10 @@ class PretenuringHandler final {
 
   std::unique_ptr<GlobalHandleVector<AllocationSite>>
       allocation_sites_to_pretenure_;
+
+  std::array<RuntimeAllocationFeedback,
+             kNumberOfRuntimeAllocators * kNumberOfRuntimeSizeClasses>
+      runtime_allocation_feedback_;
 };
 
 }  // namespace internal
@@ -4,6 +4,7 @@
 
 #include "src/heap/scavenger.h"
 
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/handles/global-handles.h"
 #include "src/heap/array-buffer-sweeper.h"
@@ -202,6 +203,7 @@ void ScavengerCollector::JobTask::Run(JobDelegate* delegate) {
                        TRACE_EVENT_FLAG_FLOW_IN);
     ProcessItems(delegate, scavenger);
   } else {
+    base::NumaNodeAffinityScope numa_scope(outer_->heap_->numa_node());
     TRACE_GC_EPOCH_WITH_FLOW(
         outer_->heap_->tracer(),
         GCTracer::Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL,
@@ -231,6 +233,8 @@ void ScavengerCollector::JobTask::ProcessItems(JobDelegate* delegate,
     ConcurrentScavengePages(scavenger);
     scavenger->Process(delegate);
   }
+  outer_->heap_->tracer()->AddScavengeTaskSample(
+      base::TimeDelta::FromMillisecondsD(scavenging_time));
   if (v8_flags.trace_parallel_scavenge) {
     PrintIsolate(outer_->heap_->isolate(),
                  "scavenge[%p]: time=%.2f copied=%zu promoted=%zu\n",
@@ -580,8 +584,12 @@ int ScavengerCollector::NumberOfScavengeTasks() {
           MB +
       1;
   static int num_cores = V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
-  int tasks = std::max(
-      1, std::min({num_scavenge_tasks, kMaxScavengerTasks, num_cores}));
+  int max_tasks = kMaxScavengerTasks;
+  if (v8_flags.scavenger_max_tasks > 0) {
+    max_tasks = std::min(max_tasks, v8_flags.scavenger_max_tasks.value());
+  }
+  int tasks =
+      std::max(1, std::min({num_scavenge_tasks, max_tasks, num_cores}));
   if (!heap_->CanPromoteYoungAndExpandOldGeneration(
           static_cast<size_t>(tasks * Page::kPageSize))) {
     // Optimize for memory usage near the heap limit.
@@ -240,7 +240,9 @@ class RootScavengeVisitor final : public RootVisitor {
 
 class ScavengerCollector {
  public:
-  static const int kMaxScavengerTasks = 8;
+  // Upper bound on the number of tasks, which each need their own local
+  // allocation buffers and worklist segments.
+  static const int kMaxScavengerTasks = 64;
   static const int kMainThreadId = 0;
 
   explicit ScavengerCollector(Heap* heap);
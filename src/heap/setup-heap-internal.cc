@@ -30,6 +30,7 @@
 #include "src/objects/js-generator.h"
 #include "src/objects/js-shared-array.h"
 #include "src/objects/js-weak-refs.h"
+#include "src/objects/keys.h"
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/lookup-cache.h"
 #include "src/objects/map.h"
@@ -1387,6 +1388,8 @@ void Heap::CreateInitialMutableObjects() {
       RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
+  set_object_keys_cache(
+      *factory->NewFixedArray(ObjectKeysCache::kSize, AllocationType::kOld));
 
   // Allocate FeedbackCell for builtins.
   Handle<FeedbackCell> many_closures_cell =
@@ -1400,11 +1403,13 @@ void Heap::CreateInitialMutableObjects() {
   set_functions_marked_for_manual_optimization(roots.undefined_value());
   set_shared_wasm_memories(roots.empty_weak_array_list());
   set_locals_block_list_cache(roots.undefined_value());
+  set_shared_constant_pool_cache(roots.undefined_value());
 #ifdef V8_ENABLE_WEBASSEMBLY
   set_active_continuation(roots.undefined_value());
   set_active_suspender(roots.undefined_value());
   set_js_to_wasm_wrappers(roots.empty_weak_array_list());
   set_wasm_canonical_rtts(roots.empty_weak_array_list());
+  set_discardable_wasm_memories(roots.empty_weak_array_list());
 #endif  // V8_ENABLE_WEBASSEMBLY
 
   set_script_list(roots.empty_weak_array_list());
@@ -134,6 +134,17 @@ class SlotSet final : public ::heap::base::BasicSlotSet<kTaggedSize> {
     return static_cast<SlotSet*>(BasicSlotSet::Allocate(buckets));
   }
 
+  // Returns the memory used by the bucket array and all allocated buckets.
+  // Buckets may be allocated concurrently but must not be released during the
+  // call.
+  size_t MemoryUsage(size_t buckets) {
+    size_t usage = kInitialBucketsSize + buckets * sizeof(Bucket*);
+    for (size_t bucket_index = 0; bucket_index < buckets; bucket_index++) {
+      if (LoadBucket(bucket_index) != nullptr) usage += sizeof(Bucket);
+    }
+    return usage;
+  }
+
   template <v8::internal::AccessMode access_mode>
   static constexpr BasicSlotSet::AccessMode ConvertAccessMode() {
     switch (access_mode) {
@@ -12,6 +12,7 @@
 #include "src/base/atomic-utils.h"
 #include "src/base/logging.h"
 #include "src/base/optional.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/flags/flags.h"
@@ -148,6 +149,8 @@ class Sweeper::MajorSweeperJob final : public JobTask {
     const int offset = delegate->GetTaskId();
     DCHECK_LT(offset, concurrent_sweepers.size());
     ConcurrentMajorSweeper& concurrent_sweeper = concurrent_sweepers[offset];
+    base::NumaNodeAffinityScope numa_scope(
+        is_joining_thread ? -1 : sweeper_->heap_->numa_node());
     TRACE_GC_EPOCH_WITH_FLOW(
         tracer_, sweeper_->GetTracingScope(OLD_SPACE, is_joining_thread),
         is_joining_thread ? ThreadKind::kMain : ThreadKind::kBackground,
@@ -209,6 +212,8 @@ class Sweeper::MinorSweeperJob final : public JobTask {
     const int offset = delegate->GetTaskId();
     DCHECK_LT(offset, concurrent_sweepers.size());
     ConcurrentMinorSweeper& concurrent_sweeper = concurrent_sweepers[offset];
+    base::NumaNodeAffinityScope numa_scope(
+        is_joining_thread ? -1 : sweeper_->heap_->numa_node());
     TRACE_GC_EPOCH_WITH_FLOW(
         tracer_, sweeper_->GetTracingScope(NEW_SPACE, is_joining_thread),
         is_joining_thread ? ThreadKind::kMain : ThreadKind::kBackground,
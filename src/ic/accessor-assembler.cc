@@ -2865,7 +2865,14 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
+TNode<ExternalReference> AccessorAssembler::StubCacheTables(
+    StubCache* stub_cache) {
+  return ExternalConstant(
+      ExternalReference::Create(stub_cache->tables_reference()));
+}
+
+TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                         TNode<Name> name,
                                                          TNode<Map> map) {
   // Compute the hash of the name (use entire hash field).
   TNode<Uint32T> raw_hash_field = LoadNameRawHash(name);
@@ -2880,18 +2887,18 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
   TNode<IntPtrT> map_word = BitcastTaggedToWord(map);
 
   TNode<Int32T> map32 = TruncateIntPtrToInt32(UncheckedCast<IntPtrT>(
-      WordXor(map_word, WordShr(map_word, StubCache::kPrimaryTableBits))));
+      WordXor(map_word, WordShr(map_word, StubCache::kPrimaryHashShift))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(raw_hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  TNode<Uint32T> mask = Load<Uint32T>(
+      StubCacheTables(stub_cache),
+      IntPtrConstant(offsetof(StubCache::Tables, primary_mask)));
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
-TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
-                                                           TNode<Map> map) {
+TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(
+    StubCache* stub_cache, TNode<Name> name, TNode<Map> map) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
@@ -2899,12 +2906,12 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
   TNode<Int32T> map32 = TruncateIntPtrToInt32(BitcastTaggedToWord(map));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash_a = Int32Add(map32, name32);
-  TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kSecondaryTableBits);
+  TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kSecondaryHashShift);
   TNode<Word32T> hash = Int32Add(hash_a, hash_b);
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  TNode<Uint32T> mask = Load<Uint32T>(
+      StubCacheTables(stub_cache),
+      IntPtrConstant(offsetof(StubCache::Tables, secondary_mask)));
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
@@ -2913,35 +2920,51 @@ void AccessorAssembler::TryProbeStubCacheTable(
     TNode<Object> name, TNode<Map> map, Label* if_handler,
     TVariable<MaybeObject>* var_handler, Label* if_miss) {
   StubCache::Table table = static_cast<StubCache::Table>(table_id);
+  // The secondary table consists of sets of entries that are probed in
+  // order.
+  const int kWays =
+      table == StubCache::kPrimary ? 1 : StubCache::kSecondaryAssociativity;
   // The {table_offset} holds the entry offset times four (due to masking
   // and shifting optimizations).
   const int kMultiplier =
       sizeof(StubCache::Entry) >> StubCache::kCacheIndexShift;
-  entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier));
-
-  TNode<ExternalReference> key_base = ExternalConstant(
-      ExternalReference::Create(stub_cache->key_reference(table)));
-
-  // Check that the key in the entry matches the name.
-  DCHECK_EQ(0, offsetof(StubCache::Entry, key));
-  TNode<HeapObject> cached_key =
-      CAST(Load(MachineType::TaggedPointer(), key_base, entry_offset));
-  GotoIf(TaggedNotEqual(name, cached_key), if_miss);
-
-  // Check that the map in the entry matches.
-  TNode<Object> cached_map = Load<Object>(
-      key_base,
-      IntPtrAdd(entry_offset, IntPtrConstant(offsetof(StubCache::Entry, map))));
-  GotoIf(TaggedNotEqual(map, cached_map), if_miss);
-
-  TNode<MaybeObject> handler = ReinterpretCast<MaybeObject>(
-      Load(MachineType::AnyTagged(), key_base,
-           IntPtrAdd(entry_offset,
-                     IntPtrConstant(offsetof(StubCache::Entry, value)))));
+  entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier * kWays));
+
+  TNode<RawPtrT> entries = Load<RawPtrT>(
+      StubCacheTables(stub_cache),
+      IntPtrConstant(table == StubCache::kPrimary
+                         ? offsetof(StubCache::Tables, primary)
+                         : offsetof(StubCache::Tables, secondary)));
+
+  for (int way = 0; way < kWays; way++) {
+    Label next_way(this);
+    Label* if_way_miss = way == kWays - 1 ? if_miss : &next_way;
+    TNode<IntPtrT> way_offset = IntPtrAdd(
+        entry_offset, IntPtrConstant(way * sizeof(StubCache::Entry)));
+
+    // Check that the key in the entry matches the name.
+    DCHECK_EQ(0, offsetof(StubCache::Entry, key));
+    TNode<HeapObject> cached_key =
+        CAST(Load(MachineType::TaggedPointer(), entries, way_offset));
+    GotoIf(TaggedNotEqual(name, cached_key), if_way_miss);
+
+    // Check that the map in the entry matches.
+    TNode<Object> cached_map = Load<Object>(
+        entries,
+        IntPtrAdd(way_offset, IntPtrConstant(offsetof(StubCache::Entry, map))));
+    GotoIf(TaggedNotEqual(map, cached_map), if_way_miss);
+
+    TNode<MaybeObject> handler = ReinterpretCast<MaybeObject>(
+        Load(MachineType::AnyTagged(), entries,
+             IntPtrAdd(way_offset,
+                       IntPtrConstant(offsetof(StubCache::Entry, value)))));
+
+    // We found the handler.
+    *var_handler = handler;
+    Goto(if_handler);
 
-  // We found the handler.
-  *var_handler = handler;
-  Goto(if_handler);
+    if (if_way_miss == &next_way) BIND(&next_way);
+  }
 }
 
 void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
@@ -2957,7 +2980,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
 
   // Probe the primary table.
   TNode<IntPtrT> primary_offset =
-      StubCachePrimaryOffset(name, lookup_start_object_map);
+      StubCachePrimaryOffset(stub_cache, name, lookup_start_object_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          lookup_start_object_map, if_handler, var_handler,
                          &try_secondary);
@@ -2966,7 +2989,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   {
     // Probe the secondary table.
     TNode<IntPtrT> secondary_offset =
-        StubCacheSecondaryOffset(name, lookup_start_object_map);
+        StubCacheSecondaryOffset(stub_cache, name, lookup_start_object_map);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            lookup_start_object_map, if_handler, var_handler,
                            &miss);
@@ -2975,6 +2998,14 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   BIND(&miss);
   {
     IncrementCounter(counters->megamorphic_stub_cache_misses(), 1);
+    // Record the miss for the growth heuristic in StubCache::Clear(). The
+    // miss is handled in the runtime anyway, so this is cheap.
+    TNode<ExternalReference> tables = StubCacheTables(stub_cache);
+    TNode<IntPtrT> misses_offset =
+        IntPtrConstant(offsetof(StubCache::Tables, misses));
+    TNode<Uint32T> misses = Load<Uint32T>(tables, misses_offset);
+    StoreNoWriteBarrier(MachineRepresentation::kWord32, tables, misses_offset,
+                        Uint32Add(misses, Uint32Constant(1)));
     Goto(if_miss);
   }
 }
@@ -93,13 +93,15 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
                              if_handler, var_handler, if_miss);
   }
 
-  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(TNode<Name> name,
+  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(StubCache* stub_cache,
+                                                  TNode<Name> name,
                                                   TNode<Map> map) {
-    return StubCachePrimaryOffset(name, map);
+    return StubCachePrimaryOffset(stub_cache, name, map);
   }
-  TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(TNode<Name> name,
+  TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(StubCache* stub_cache,
+                                                    TNode<Name> name,
                                                     TNode<Map> map) {
-    return StubCacheSecondaryOffset(name, map);
+    return StubCacheSecondaryOffset(stub_cache, name, map);
   }
 
   struct LoadICParameters {
@@ -566,8 +568,12 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   // including stub cache header.
   enum StubCacheTable : int;
 
-  TNode<IntPtrT> StubCachePrimaryOffset(TNode<Name> name, TNode<Map> map);
-  TNode<IntPtrT> StubCacheSecondaryOffset(TNode<Name> name, TNode<Map> map);
+  // The address of the StubCache::Tables of {stub_cache}.
+  TNode<ExternalReference> StubCacheTables(StubCache* stub_cache);
+  TNode<IntPtrT> StubCachePrimaryOffset(StubCache* stub_cache,
+                                        TNode<Name> name, TNode<Map> map);
+  TNode<IntPtrT> StubCacheSecondaryOffset(StubCache* stub_cache,
+                                          TNode<Name> name, TNode<Map> map);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
                               TNode<IntPtrT> entry_offset, TNode<Object> name,
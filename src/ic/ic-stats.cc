@@ -4,6 +4,10 @@
 
 #include "src/ic/ic-stats.h"
 
+#include <algorithm>
+#include <tuple>
+
+#include "src/base/functional.h"
 #include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/objects/objects-inl.h"
@@ -142,5 +146,80 @@ void ICInfo::AppendToTracedValue(v8::tracing::TracedValue* value) const {
   value->EndDictionary();
 }
 
+size_t ICSiteStats::SiteKeyHash::operator()(const SiteKey& key) const {
+  return base::hash_combine(key.script_id, key.function_position, key.slot);
+}
+
+void ICSiteStats::RecordTransition(SharedFunctionInfo shared, int slot,
+                                   const char* type, bool keyed,
+                                   InlineCacheState old_state,
+                                   InlineCacheState new_state) {
+  DisallowGarbageCollection no_gc;
+  int script_id =
+      shared->script().IsScript() ? Script::cast(shared->script())->id() : -1;
+  SiteKey key{script_id, shared->StartPosition(), slot};
+  auto it = sites_.find(key);
+  if (it == sites_.end()) {
+    Site site{key.script_id, key.function_position, key.slot};
+    site.type = keyed ? "Keyed" : "";
+    site.type += type;
+    site.function_name = shared->DebugNameCStr().get();
+    site.state = old_state;
+    it = sites_.emplace(key, std::move(site)).first;
+  }
+  Site& site = it->second;
+  if (old_state == InlineCacheState::MEGAMORPHIC) site.megamorphic_misses++;
+  if (old_state != new_state) {
+    site.transitions[static_cast<int>(new_state)]++;
+  }
+  site.state = new_state;
+}
+
+std::vector<const ICSiteStats::Site*> ICSiteStats::TopMegamorphicSites(
+    size_t count) const {
+  std::vector<const Site*> result;
+  for (const auto& entry : sites_) {
+    const Site& site = entry.second;
+    if (site.transitions[static_cast<int>(InlineCacheState::MEGAMORPHIC)] ==
+        0) {
+      continue;
+    }
+    result.push_back(&site);
+  }
+  auto by_misses = [](const Site* a, const Site* b) {
+    if (a->megamorphic_misses != b->megamorphic_misses) {
+      return a->megamorphic_misses > b->megamorphic_misses;
+    }
+    return std::tie(a->script_id, a->function_position, a->slot) <
+           std::tie(b->script_id, b->function_position, b->slot);
+  };
+  if (result.size() > count) {
+    std::partial_sort(result.begin(), result.begin() + count, result.end(),
+                      by_misses);
+    result.resize(count);
+  } else {
+    std::sort(result.begin(), result.end(), by_misses);
+  }
+  return result;
+}
+
+void ICSiteStats::Print(std::ostream& os, size_t count) const {
+  std::vector<const Site*> sites = TopMegamorphicSites(count);
+  os << "=== Megamorphic IC sites (" << sites.size() << " of " << sites_.size()
+     << " sites) ===" << std::endl;
+  for (const Site* site : sites) {
+    os << site->type << " in " << site->function_name << " (script "
+       << site->script_id << ", position " << site->function_position
+       << ", slot " << site->slot << "): " << site->megamorphic_misses
+       << " megamorphic misses, transitions:";
+    for (int i = 0; i < kNumStates; i++) {
+      if (site->transitions[i] == 0) continue;
+      os << " " << InlineCacheState2String(static_cast<InlineCacheState>(i))
+         << "=" << site->transitions[i];
+    }
+    os << std::endl;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,8 @@
 #ifndef V8_IC_IC_STATS_H_
 #define V8_IC_IC_STATS_H_
 
+#include <array>
+#include <iosfwd>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -13,6 +15,7 @@
 #include "include/v8-internal.h"  // For Address.
 #include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
+#include "src/common/globals.h"
 
 namespace v8 {
 
@@ -24,6 +27,7 @@ namespace internal {
 
 class JSFunction;
 class Script;
+class SharedFunctionInfo;
 
 struct ICInfo {
   ICInfo();
@@ -75,6 +79,61 @@ class ICStats {
   int pos_;
 };
 
+// Aggregates the state transitions of all inline caches of an isolate by
+// feedback site, i.e. by function and feedback slot, when --ic-site-stats is
+// enabled. Unlike --log-ic and ICStats, this doesn't record individual events
+// and is cheap enough to keep enabled for a whole run.
+class ICSiteStats {
+ public:
+  static constexpr int kNumStates =
+      static_cast<int>(InlineCacheState::GENERIC) + 1;
+
+  struct Site {
+    // Functions are identified by their script and start position, which
+    // unlike their SharedFunctionInfo don't move.
+    int script_id;
+    int function_position;
+    int slot;
+    std::string type;
+    std::string function_name;
+    InlineCacheState state = InlineCacheState::UNINITIALIZED;
+    // Number of transitions into each state.
+    std::array<uint32_t, kNumStates> transitions = {};
+    // Number of misses while the site was already megamorphic, i.e. of
+    // stub cache misses for property loads and stores.
+    uint32_t megamorphic_misses = 0;
+  };
+
+  void RecordTransition(SharedFunctionInfo shared, int slot, const char* type,
+                        bool keyed, InlineCacheState old_state,
+                        InlineCacheState new_state);
+
+  // Returns up to {count} sites that went megamorphic, ordered by their number
+  // of megamorphic misses.
+  std::vector<const Site*> TopMegamorphicSites(size_t count) const;
+
+  size_t site_count() const { return sites_.size(); }
+  void Print(std::ostream& os, size_t count) const;
+  void Reset() { sites_.clear(); }
+
+ private:
+  struct SiteKey {
+    int script_id;
+    int function_position;
+    int slot;
+    bool operator==(const SiteKey& other) const {
+      return script_id == other.script_id &&
+             function_position == other.function_position &&
+             slot == other.slot;
+    }
+  };
+  struct SiteKeyHash {
+    size_t operator()(const SiteKey& key) const;
+  };
+
+  std::unordered_map<SiteKey, Site, SiteKeyHash> sites_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -103,7 +103,10 @@ const char* GetModifier(KeyedAccessStoreMode mode) {
 }  // namespace
 
 void IC::TraceIC(const char* type, Handle<Object> name) {
-  if (V8_LIKELY(!TracingFlags::is_ic_stats_enabled())) return;
+  if (V8_LIKELY(!TracingFlags::is_ic_stats_enabled()) &&
+      V8_LIKELY(isolate()->ic_site_stats() == nullptr)) {
+    return;
+  }
   State new_state =
       (state() == NO_FEEDBACK) ? NO_FEEDBACK : nexus()->ic_state();
   TraceIC(type, name, state(), new_state);
@@ -111,6 +114,12 @@ void IC::TraceIC(const char* type, Handle<Object> name) {
 
 void IC::TraceIC(const char* type, Handle<Object> name, State old_state,
                  State new_state) {
+  if (V8_UNLIKELY(isolate()->ic_site_stats() != nullptr) &&
+      state() != NO_FEEDBACK) {
+    isolate()->ic_site_stats()->RecordTransition(
+        nexus()->vector()->shared_function_info(), nexus()->slot().ToInt(),
+        type, is_keyed() && !IsStoreInArrayLiteralIC(), old_state, new_state);
+  }
   if (V8_LIKELY(!TracingFlags::is_ic_stats_enabled())) return;
 
   Handle<Map> map = lookup_start_object_map();  // Might be empty.
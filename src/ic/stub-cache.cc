@@ -4,6 +4,8 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
@@ -18,18 +20,42 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
+  max_primary_table_bits_ =
+      std::clamp(v8_flags.stub_cache_max_primary_table_bits.value(),
+                 kMinPrimaryTableBits, kMaxPrimaryTableBits);
+  AllocateTables(std::clamp(v8_flags.stub_cache_primary_table_bits.value(),
+                            kMinPrimaryTableBits, max_primary_table_bits_));
+}
+
+StubCache::~StubCache() {
+  delete[] tables_.primary;
+  delete[] tables_.secondary;
+}
+
+void StubCache::AllocateTables(int primary_table_bits) {
+  DCHECK_GE(primary_table_bits, kMinPrimaryTableBits);
+  DCHECK_LE(primary_table_bits, kMaxPrimaryTableBits);
+  delete[] tables_.primary;
+  delete[] tables_.secondary;
+  primary_table_bits_ = primary_table_bits;
+  const int secondary_sets = 1 << secondary_table_bits();
+  tables_.primary = new Entry[primary_table_size()];
+  tables_.secondary = new Entry[secondary_table_size()];
+  tables_.primary_mask = (primary_table_size() - 1) << kCacheIndexShift;
+  tables_.secondary_mask = (secondary_sets - 1) << kCacheIndexShift;
+  tables_.misses = 0;
 }
 
 void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo(primary_table_size()));
+  DCHECK(base::bits::IsPowerOfTwo(secondary_table_size()));
   Clear();
 }
 
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
-int StubCache::PrimaryOffset(Name name, Map map) {
+int StubCache::PrimaryOffset(Name name, Map map) const {
   // Compute the hash of the name (use entire hash field).
   uint32_t field = name->RawHash();
   DCHECK(Name::IsHashFieldComputed(field));
@@ -37,22 +63,22 @@ int StubCache::PrimaryOffset(Name name, Map map) {
   // risk of collision even if the heap is spread over an area larger than
   // 4Gb (and not at all if it isn't).
   uint32_t map_low32bits =
-      static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kPrimaryTableBits));
+      static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kPrimaryHashShift));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & tables_.primary_mask;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
 // assembler. This hash should be sufficiently different from the primary one
 // in order to avoid collisions for minified code with short names.
-// Returns an index into the table that is scaled by 1 << kCacheIndexShift.
-int StubCache::SecondaryOffset(Name name, Map old_map) {
+// Returns the index of a set that is scaled by 1 << kCacheIndexShift.
+int StubCache::SecondaryOffset(Name name, Map old_map) const {
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
-  key = key + (key >> kSecondaryTableBits);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  key = key + (key >> kSecondaryHashShift);
+  return key & tables_.secondary_mask;
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -85,7 +111,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
 
   // Compute the primary entry.
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = entry(tables_.primary, primary_offset);
   MaybeObject old_handler(
       TaggedValue::ToMaybeObject(isolate(), primary->value));
   // If the primary entry has useful data in it, we retire it to the
@@ -98,8 +124,10 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
     Name old_name =
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key));
     int secondary_offset = SecondaryOffset(old_name, old_map);
-    Entry* secondary = entry(secondary_, secondary_offset);
-    *secondary = *primary;
+    Entry* secondary = secondary_set(secondary_offset);
+    static_assert(kSecondaryAssociativity == 2);
+    secondary[1] = secondary[0];
+    secondary[0] = *primary;
   }
 
   // Update primary cache.
@@ -112,31 +140,46 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
 MaybeObject StubCache::Get(Name name, Map map) {
   DCHECK(CommonStubCacheChecks(this, name, map, MaybeObject()));
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = entry(tables_.primary, primary_offset);
   if (primary->key == name && primary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), primary->value);
   }
   int secondary_offset = SecondaryOffset(name, map);
-  Entry* secondary = entry(secondary_, secondary_offset);
-  if (secondary->key == name && secondary->map == map) {
-    return TaggedValue::ToMaybeObject(isolate(), secondary->value);
+  Entry* secondary = secondary_set(secondary_offset);
+  for (int way = 0; way < kSecondaryAssociativity; way++) {
+    if (secondary[way].key == name && secondary[way].map == map) {
+      return TaggedValue::ToMaybeObject(isolate(), secondary[way].value);
+    }
   }
   return MaybeObject();
 }
 
 void StubCache::Clear() {
+  // More misses than the primary table has entries since the last clear
+  // means that the working set doesn't fit, so it is worth growing the tables
+  // while they are empty anyway.
+  if (tables_.misses > static_cast<uint32_t>(primary_table_size()) &&
+      primary_table_bits_ < max_primary_table_bits_) {
+    AllocateTables(primary_table_bits_ + 1);
+    if (v8_flags.trace_stub_cache_growth) {
+      PrintIsolate(isolate(), "Growing stub cache %p to %d entries\n", this,
+                   primary_table_size() + secondary_table_size());
+    }
+  }
+  tables_.misses = 0;
+
   MaybeObject empty =
       MaybeObject::FromObject(isolate_->builtins()->code(Builtin::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
-    primary_[i].key = StrongTaggedValue(empty_string);
-    primary_[i].map = StrongTaggedValue(Smi::zero());
-    primary_[i].value = TaggedValue(empty);
+  for (int i = 0; i < primary_table_size(); i++) {
+    tables_.primary[i].key = StrongTaggedValue(empty_string);
+    tables_.primary[i].map = StrongTaggedValue(Smi::zero());
+    tables_.primary[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
-    secondary_[j].key = StrongTaggedValue(empty_string);
-    secondary_[j].map = StrongTaggedValue(Smi::zero());
-    secondary_[j].value = TaggedValue(empty);
+  for (int j = 0; j < secondary_table_size(); j++) {
+    tables_.secondary[j].key = StrongTaggedValue(empty_string);
+    tables_.secondary[j].map = StrongTaggedValue(Smi::zero());
+    tables_.secondary[j].value = TaggedValue(empty);
   }
 }
 
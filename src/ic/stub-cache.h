@@ -42,41 +42,43 @@ class V8_EXPORT_PRIVATE StubCache {
     StrongTaggedValue map;
   };
 
+  // The tables are sized per isolate and may be reallocated when the cache is
+  // cleared, so generated code loads their addresses and index masks from
+  // here instead of embedding them.
+  struct Tables {
+    Entry* primary;
+    // The secondary table is made of sets of kSecondaryAssociativity entries.
+    Entry* secondary;
+    // (number of entries - 1) << kCacheIndexShift.
+    uint32_t primary_mask;
+    // (number of sets - 1) << kCacheIndexShift.
+    uint32_t secondary_mask;
+    // Number of probes of generated code that missed both tables since the
+    // last clear.
+    uint32_t misses;
+  };
+
   void Initialize();
   // Access cache for entry hash(name, map).
   void Set(Name name, Map map, MaybeObject handler);
   MaybeObject Get(Name name, Map map);
-  // Clear the lookup table (@ mark compact collection).
+  // Clear the lookup table (@ mark compact collection). Grows the tables
+  // first if they missed too often since the last clear.
   void Clear();
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
-  }
-
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
+  SCTableReference tables_reference() {
+    return SCTableReference(reinterpret_cast<Address>(&tables_));
   }
 
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
-  }
+  Isolate* isolate() { return isolate_; }
 
-  StubCache::Entry* first_entry(StubCache::Table table) {
-    switch (table) {
-      case StubCache::kPrimary:
-        return StubCache::primary_;
-      case StubCache::kSecondary:
-        return StubCache::secondary_;
-    }
-    UNREACHABLE();
+  int primary_table_size() const { return 1 << primary_table_bits_; }
+  int secondary_table_size() const {
+    return (1 << secondary_table_bits()) * kSecondaryAssociativity;
   }
-
-  Isolate* isolate() { return isolate_; }
+  uint32_t misses() const { return tables_.misses; }
 
   // Setting kCacheIndexShift to Name::HashBits::kShift is convenient because it
   // causes the bit field inside the hash field to get shifted out implicitly.
@@ -85,16 +87,26 @@ class V8_EXPORT_PRIVATE StubCache {
   // the static_assert below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // The primary table is direct mapped, the secondary table keeps the two
+  // entries most recently evicted from the primary table for each set.
+  static constexpr int kSecondaryAssociativity = 2;
+  // The secondary table has a quarter as many sets as the primary table has
+  // entries.
+  static constexpr int kSecondaryTableBitsDelta = 2;
+  static constexpr int kMinPrimaryTableBits = kSecondaryTableBitsDelta + 1;
+  static constexpr int kMaxPrimaryTableBits = 20;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, Map map);
+  // Shift amounts used to fold the high bits of the map and name addresses
+  // into the hashes. They don't depend on the table sizes.
+  static constexpr int kPrimaryHashShift = 11;
+  static constexpr int kSecondaryHashShift = 9;
+
+  int PrimaryOffsetForTesting(Name name, Map map);
+  int SecondaryOffsetForTesting(Name name, Map map);
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -103,18 +115,18 @@ class V8_EXPORT_PRIVATE StubCache {
   // different hashing algorithms in order to avoid simultaneous collisions
   // in both caches.  Unlike a probing strategy (quadratic or otherwise) the
   // update strategy on updates is fairly clear and simple:  Any existing entry
-  // in the primary cache is moved to the secondary cache, and secondary cache
-  // entries are overwritten.
+  // in the primary cache is moved to the first way of its secondary set,
+  // pushing the entry there to the second way.
 
   // Hash algorithm for the primary table.  This algorithm is replicated in
-  // assembler for every architecture.  Returns an index into the table that
-  // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  // the AccessorAssembler.  Returns an index into the table that is scaled by
+  // 1 << kCacheIndexShift.
+  int PrimaryOffset(Name name, Map map) const;
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
-  // assembler for every architecture.  Returns an index into the table that
-  // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, Map map);
+  // the AccessorAssembler.  Returns the index of a set that is scaled by
+  // 1 << kCacheIndexShift.
+  int SecondaryOffset(Name name, Map map) const;
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -130,9 +142,20 @@ class V8_EXPORT_PRIVATE StubCache {
                                     offset * multiplier);
   }
 
- private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  // The first entry of the secondary set for a given offset.
+  Entry* secondary_set(int offset) const {
+    return entry(tables_.secondary, offset * kSecondaryAssociativity);
+  }
+
+  int secondary_table_bits() const {
+    return primary_table_bits_ - kSecondaryTableBitsDelta;
+  }
+
+  void AllocateTables(int primary_table_bits);
+
+  Tables tables_ = {};
+  int primary_table_bits_ = 0;
+  int max_primary_table_bits_;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -40,6 +40,7 @@ struct PtrComprCageReservationParams
 #else
     jit = JitPermission::kNoJit;
 #endif
+    use_huge_pages = v8_flags.heap_huge_pages;
   }
 };
 #endif  // V8_COMPRESS_POINTERS
@@ -0,0 +1,93 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/interpreter/bytecode-sampler.h"
+
+#include "include/v8-unwinder.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+#include "src/execution/isolate.h"
+#include "src/snapshot/embedded/embedded-data.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+class BytecodeSampler::SamplingThread final : public base::Thread {
+ public:
+  static const int kSamplingThreadStackSize = 64 * KB;
+
+  SamplingThread(BytecodeSampler* sampler, int interval_microseconds)
+      : base::Thread(base::Thread::Options("v8:BytecodeSampler",
+                                           kSamplingThreadStackSize)),
+        sampler_(sampler),
+        interval_microseconds_(interval_microseconds) {}
+
+  void Run() override {
+    while (sampler_->IsActive()) {
+      sampler_->DoSample();
+      base::OS::Sleep(
+          base::TimeDelta::FromMicroseconds(interval_microseconds_));
+    }
+  }
+
+ private:
+  BytecodeSampler* const sampler_;
+  const int interval_microseconds_;
+};
+
+BytecodeSampler::BytecodeSampler(Isolate* isolate, int interval_microseconds)
+    : sampler::Sampler(reinterpret_cast<v8::Isolate*>(isolate)),
+      interval_microseconds_(interval_microseconds) {
+  DCHECK_GT(interval_microseconds, 0);
+}
+
+BytecodeSampler::~BytecodeSampler() {
+  if (IsActive()) StopSampling();
+}
+
+void BytecodeSampler::StartSampling() {
+  DCHECK(!IsActive());
+  Start();
+  sampling_thread_ =
+      std::make_unique<SamplingThread>(this, interval_microseconds_);
+  CHECK(sampling_thread_->StartSynchronously());
+}
+
+void BytecodeSampler::StopSampling() {
+  DCHECK(IsActive());
+  Stop();
+  sampling_thread_->Join();
+  sampling_thread_.reset();
+}
+
+void BytecodeSampler::SampleStack(const v8::RegisterState& state) {
+  total_samples_.fetch_add(1, std::memory_order_relaxed);
+#if !defined(USE_SIMULATOR)
+  // The lookup is a binary search over the embedded blob's builtin table,
+  // which neither allocates nor takes locks.
+  Builtin builtin = OffHeapInstructionStream::TryLookupCode(
+      reinterpret_cast<Isolate*>(isolate()),
+      reinterpret_cast<Address>(state.pc));
+  if (!Builtins::IsBuiltinId(builtin)) return;
+  // Bytecode handlers are sorted last, see Builtins.
+  int index = Builtins::ToInt(builtin) -
+              static_cast<int>(Builtin::kFirstBytecodeHandler);
+  if (index < 0) return;
+  DCHECK_LT(index, kNumberOfHandlers);
+  handler_samples_[index].fetch_add(1, std::memory_order_relaxed);
+#endif  // !defined(USE_SIMULATOR)
+}
+
+uint32_t BytecodeSampler::HandlerSamples(Builtin handler) const {
+  int index = Builtins::ToInt(handler) -
+              static_cast<int>(Builtin::kFirstBytecodeHandler);
+  DCHECK_LE(0, index);
+  DCHECK_LT(index, kNumberOfHandlers);
+  return handler_samples_[index].load(std::memory_order_relaxed);
+}
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,69 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INTERPRETER_BYTECODE_SAMPLER_H_
+#define V8_INTERPRETER_BYTECODE_SAMPLER_H_
+
+#include <atomic>
+#include <memory>
+
+#include "src/builtins/builtins.h"
+#include "src/libsampler/sampler.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+
+namespace interpreter {
+
+// Periodically interrupts the isolate's thread and attributes each sample to
+// the bytecode handler it was executing, if any. The per-handler sample counts
+// approximate how much time is spent in each bytecode, at a cost that only
+// depends on the sampling interval and not on how many bytecodes are
+// dispatched. Unlike v8_enable_ignition_dispatch_counting, it can therefore be
+// switched on at runtime in release builds.
+//
+// Samples are only taken on platforms where libsampler can interrupt the
+// thread, and not on simulator builds.
+class BytecodeSampler final : public sampler::Sampler {
+ public:
+  BytecodeSampler(Isolate* isolate, int interval_microseconds);
+  ~BytecodeSampler() override;
+  BytecodeSampler(const BytecodeSampler&) = delete;
+  BytecodeSampler& operator=(const BytecodeSampler&) = delete;
+
+  // Must be called on the isolate's thread, which is the one being sampled.
+  void StartSampling();
+  void StopSampling();
+
+  // Called from the signal handler; only does an address lookup.
+  void SampleStack(const v8::RegisterState& state) override;
+
+  // Returns the number of samples that hit the bytecode handler |handler|.
+  uint32_t HandlerSamples(Builtin handler) const;
+
+  // Returns the number of samples taken, inside or outside of handlers.
+  uint32_t total_samples() const {
+    return total_samples_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  class SamplingThread;
+
+  static constexpr int kNumberOfHandlers =
+      Builtins::kLastBytecodeHandlerPlusOne -
+      static_cast<int>(Builtin::kFirstBytecodeHandler);
+
+  const int interval_microseconds_;
+  std::unique_ptr<SamplingThread> sampling_thread_;
+  std::atomic<uint32_t> total_samples_{0};
+  std::atomic<uint32_t> handler_samples_[kNumberOfHandlers] = {};
+};
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INTERPRETER_BYTECODE_SAMPLER_H_
@@ -275,12 +275,15 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       // array and would not work correctly if it instead read kDebugBreak0.
       case Bytecode::kDebugBreak0:
 
+      case Bytecode::kLdar:
       case Bytecode::kLdaZero:
       case Bytecode::kLdaSmi:
       case Bytecode::kLdaNull:
       case Bytecode::kLdaTheHole:
       case Bytecode::kLdaConstant:
       case Bytecode::kLdaUndefined:
+      case Bytecode::kLdaTrue:
+      case Bytecode::kLdaFalse:
       case Bytecode::kLdaGlobal:
       case Bytecode::kGetNamedProperty:
       case Bytecode::kGetKeyedProperty:
@@ -319,6 +322,35 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
   return false;
 }
 
+// static
+bool Bytecodes::IsConditionalJumpLookahead(Bytecode bytecode,
+                                           OperandScale operand_scale) {
+  if (operand_scale == OperandScale::kSingle) {
+    switch (bytecode) {
+      // These bytecodes leave a boolean in the accumulator, so the bytecode
+      // generator follows them with JumpIfTrue/JumpIfFalse rather than the
+      // ToBoolean variants.
+      case Bytecode::kTestEqual:
+      case Bytecode::kTestEqualStrict:
+      case Bytecode::kTestLessThan:
+      case Bytecode::kTestGreaterThan:
+      case Bytecode::kTestLessThanOrEqual:
+      case Bytecode::kTestGreaterThanOrEqual:
+      case Bytecode::kTestReferenceEqual:
+      case Bytecode::kTestInstanceOf:
+      case Bytecode::kTestIn:
+      case Bytecode::kTestUndetectable:
+      case Bytecode::kTestNull:
+      case Bytecode::kTestUndefined:
+      case Bytecode::kTestTypeOf:
+        return true;
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
 // static
 bool Bytecodes::IsBytecodeWithScalableOperands(Bytecode bytecode) {
   for (int i = 0; i < NumberOfOperands(bytecode); i++) {
@@ -7,13 +7,16 @@
 #include <cmath>
 #include <functional>
 #include <set>
+#include <type_traits>
 
 #include "src/ast/ast-value-factory.h"
 #include "src/ast/scopes.h"
 #include "src/base/functional.h"
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/handles/handles.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/logging/counters.h"
 #include "src/objects/objects-inl.h"
 
 namespace v8 {
@@ -183,8 +186,66 @@ template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE)
     MaybeHandle<Object> ConstantArrayBuilder::At(size_t index,
                                                  LocalIsolate* isolate) const;
 
+namespace {
+
+// Constant pools with at most this many entries are candidates for sharing.
+// Larger pools rarely repeat exactly and are too costly to compare.
+constexpr size_t kMaxSharedConstantPoolSize = 4;
+
+}  // namespace
+
+bool ConstantArrayBuilder::CanShareConstantPool() const {
+  const ConstantArraySlice* slice = idx_slice_[0];
+  size_t count = size();
+  // All entries have to be in the first slice, without reservation holes.
+  if (count == 0 || count > kMaxSharedConstantPoolSize ||
+      slice->size() != count) {
+    return false;
+  }
+  if (!slice->At(0).IsRawString()) return false;
+  for (size_t i = 1; i < count; ++i) {
+    if (!slice->At(i).IsShareable()) return false;
+  }
+  return true;
+}
+
+Handle<FixedArray> ConstantArrayBuilder::ToSharedFixedArray(Isolate* isolate) {
+  DCHECK(CanShareConstantPool());
+  const ConstantArraySlice* slice = idx_slice_[0];
+  int count = static_cast<int>(slice->size());
+  Handle<String> key = Handle<String>::cast(slice->At(0).ToHandle(isolate));
+
+  Object cached = isolate->SharedConstantPoolCacheGet(key);
+  if (cached.IsFixedArray() && FixedArray::cast(cached)->length() == count) {
+    Handle<FixedArray> cached_pool(FixedArray::cast(cached), isolate);
+    bool matches = true;
+    for (int i = 1; i < count && matches; ++i) {
+      matches = *slice->At(i).ToHandle(isolate) == cached_pool->get(i);
+    }
+    if (matches) {
+      isolate->counters()->shared_constant_pools()->Increment();
+      return cached_pool;
+    }
+  }
+
+  Handle<FixedArray> fixed_array =
+      isolate->factory()->NewFixedArray(count, AllocationType::kOld);
+  for (int i = 0; i < count; ++i) {
+    fixed_array->set(i, *slice->At(i).ToHandle(isolate));
+  }
+  isolate->SharedConstantPoolCacheSet(key, fixed_array);
+  return fixed_array;
+}
+
 template <typename IsolateT>
 Handle<FixedArray> ConstantArrayBuilder::ToFixedArray(IsolateT* isolate) {
+  // Background compilation can't touch the isolate's cache; the pools it
+  // produces are simply not shared.
+  if constexpr (std::is_same_v<IsolateT, Isolate>) {
+    if (v8_flags.ignition_share_constant_pools && CanShareConstantPool()) {
+      return ToSharedFixedArray(isolate);
+    }
+  }
   Handle<FixedArray> fixed_array = isolate->factory()->NewFixedArrayWithHoles(
       static_cast<int>(size()), AllocationType::kOld);
   int array_index = 0;
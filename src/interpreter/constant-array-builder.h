@@ -136,6 +136,14 @@ class V8_EXPORT_PRIVATE ConstantArrayBuilder final {
 
     bool IsDeferred() const { return tag_ == Tag::kDeferred; }
 
+    bool IsRawString() const { return tag_ == Tag::kRawString; }
+
+    // Entries whose handles are immutable and identical for every bytecode
+    // array, so that a constant pool made of them can be shared.
+    bool IsShareable() const {
+      return tag_ == Tag::kSmi || tag_ == Tag::kRawString;
+    }
+
     bool IsJumpTableEntry() const {
       return tag_ == Tag::kUninitializedJumpTableSmi ||
              tag_ == Tag::kJumpTableSmi;
@@ -226,6 +234,12 @@ class V8_EXPORT_PRIVATE ConstantArrayBuilder final {
     ZoneVector<Entry> constants_;
   };
 
+  // Returns true if the constant pool is small and only holds shareable
+  // entries, starting with a string, so that ToFixedArray may return an
+  // identical pool that was built before.
+  bool CanShareConstantPool() const;
+  Handle<FixedArray> ToSharedFixedArray(Isolate* isolate);
+
   ConstantArraySlice* IndexToSlice(size_t index) const;
   ConstantArraySlice* OperandSizeToSlice(OperandSize operand_size) const;
 
@@ -1246,6 +1246,56 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   implicit_register_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::ConditionalJumpDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label jump_if_true(this), jump_if_false(this), done(this);
+
+  // A JumpIfTrue/JumpIfFalse with a breakpoint reads as a DebugBreak, so it
+  // falls through to the regular dispatch below.
+  TNode<Int32T> bytecode = TruncateWordToInt32(target_bytecode);
+  GotoIf(Word32Equal(bytecode, Int32Constant(static_cast<int>(
+                                   Bytecode::kJumpIfTrue))),
+         &jump_if_true);
+  Branch(Word32Equal(bytecode, Int32Constant(static_cast<int>(
+                                   Bytecode::kJumpIfFalse))),
+         &jump_if_false, &done);
+
+  BIND(&jump_if_true);
+  InlineConditionalJump(Bytecode::kJumpIfTrue);
+
+  BIND(&jump_if_false);
+  InlineConditionalJump(Bytecode::kJumpIfFalse);
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineConditionalJump(Bytecode jump_bytecode) {
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+
+  bytecode_ = jump_bytecode;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  // Both the jump and the fall-through dispatch, so nothing is emitted after
+  // this point.
+  TNode<Object> accumulator = GetAccumulator();
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+  TNode<Oddball> expected = jump_bytecode == Bytecode::kJumpIfTrue
+                                ? TrueConstant()
+                                : FalseConstant();
+  JumpIfTaggedEqual(accumulator, expected, 0);
+
+  DCHECK_EQ(implicit_register_use_,
+            Bytecodes::GetImplicitRegisterUse(bytecode_));
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
@@ -1259,6 +1309,9 @@ void InterpreterAssembler::DispatchToBytecodeWithOptionalStarLookahead(
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     StarDispatchLookahead(target_bytecode);
   }
+  if (Bytecodes::IsConditionalJumpLookahead(bytecode_, operand_scale_)) {
+    ConditionalJumpDispatchLookahead(target_bytecode);
+  }
   DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
 
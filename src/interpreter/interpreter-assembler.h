@@ -441,6 +441,14 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for a single-width JumpIfTrue or JumpIfFalse and inline it in a
+  // branch, including the dispatch to the jump target or the next bytecode.
+  void ConditionalJumpDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode| at the current BytecodeOffset() and
+  // dispatch to wherever it goes.
+  void InlineConditionalJump(Bytecode jump_bytecode);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -17,6 +17,7 @@
 #include "src/heap/parked-scope.h"
 #include "src/init/setup-isolate.h"
 #include "src/interpreter/bytecode-generator.h"
+#include "src/interpreter/bytecode-sampler.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/objects-inl.h"
@@ -72,6 +73,8 @@ Interpreter::Interpreter(Isolate* isolate)
   }
 }
 
+Interpreter::~Interpreter() = default;
+
 void Interpreter::InitDispatchCounters() {
   static const int kBytecodeCount = static_cast<int>(Bytecode::kLast) + 1;
   bytecode_dispatch_counters_table_.reset(
@@ -419,6 +422,49 @@ Handle<JSObject> Interpreter::GetDispatchCountersObject() {
   return counters_map;
 }
 
+void Interpreter::StartBytecodeSampling(int interval_microseconds) {
+  if (IsBytecodeSamplingActive()) StopBytecodeSampling();
+  bytecode_sampler_ =
+      std::make_unique<BytecodeSampler>(isolate_, interval_microseconds);
+  bytecode_sampler_->StartSampling();
+}
+
+void Interpreter::StopBytecodeSampling() {
+  if (IsBytecodeSamplingActive()) bytecode_sampler_->StopSampling();
+}
+
+bool Interpreter::IsBytecodeSamplingActive() const {
+  return bytecode_sampler_ && bytecode_sampler_->IsActive();
+}
+
+Handle<JSObject> Interpreter::GetBytecodeSamplesObject() {
+  Handle<JSObject> samples_map =
+      isolate_->factory()->NewJSObjectWithNullProto();
+
+  // Output is a JSON-encoded object. The keys are the names of bytecode
+  // handlers, e.g. "LdarHandler" or "LdarWideHandler", with the number of
+  // samples that hit the handler as value. Bytecodes that share a handler,
+  // such as the short Star bytecodes, are reported under the shared handler.
+  // Only non-zero counts are included; "total" holds the number of samples
+  // in and outside of handlers.
+  if (!bytecode_sampler_) return samples_map;
+
+  for (int i = static_cast<int>(Builtin::kFirstBytecodeHandler);
+       i < Builtins::kLastBytecodeHandlerPlusOne; ++i) {
+    Builtin handler = Builtins::FromInt(i);
+    uint32_t samples = bytecode_sampler_->HandlerSamples(handler);
+    if (samples == 0) continue;
+    JSObject::AddProperty(isolate_, samples_map, Builtins::name(handler),
+                          isolate_->factory()->NewNumberFromUint(samples),
+                          NONE);
+  }
+  uint32_t total = bytecode_sampler_->total_samples();
+  JSObject::AddProperty(isolate_, samples_map, "total",
+                        isolate_->factory()->NewNumberFromUint(total), NONE);
+
+  return samples_map;
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
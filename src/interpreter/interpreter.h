@@ -33,12 +33,13 @@ class ZoneVector;
 
 namespace interpreter {
 
+class BytecodeSampler;
 class InterpreterAssembler;
 
 class Interpreter {
  public:
   explicit Interpreter(Isolate* isolate);
-  virtual ~Interpreter() = default;
+  virtual ~Interpreter();
   Interpreter(const Interpreter&) = delete;
   Interpreter& operator=(const Interpreter&) = delete;
 
@@ -71,6 +72,17 @@ class Interpreter {
 
   V8_EXPORT_PRIVATE Handle<JSObject> GetDispatchCountersObject();
 
+  // Starts or stops sampling which bytecode handler the isolate's thread is
+  // executing, see BytecodeSampler. Restarting sampling discards the previous
+  // samples.
+  V8_EXPORT_PRIVATE void StartBytecodeSampling(int interval_microseconds);
+  V8_EXPORT_PRIVATE void StopBytecodeSampling();
+  bool IsBytecodeSamplingActive() const;
+
+  // Returns the samples of the last or current sampling session, as a JSON
+  // encodable object mapping bytecode handler names to sample counts.
+  V8_EXPORT_PRIVATE Handle<JSObject> GetBytecodeSamplesObject();
+
   void ForEachBytecode(const std::function<void(Bytecode, OperandScale)>& f);
 
   void Initialize();
@@ -110,6 +122,7 @@ class Interpreter {
   Isolate* isolate_;
   Address dispatch_table_[kDispatchTableSize];
   std::unique_ptr<uintptr_t[]> bytecode_dispatch_counters_table_;
+  std::unique_ptr<BytecodeSampler> bytecode_sampler_;
   Address interpreter_entry_trampoline_instruction_start_;
 };
 
@@ -4,6 +4,9 @@
 
 #include "src/json/json-parser.h"
 
+#include <algorithm>
+
+#include "include/v8-primitive.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -11,16 +14,19 @@
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
 #include "src/heap/factory.h"
+#include "src/heap/pretenuring-handler.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
+#include "src/objects/field-index-inl.h"
 #include "src/objects/field-type.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/map-updater.h"
 #include "src/objects/objects-inl.h"
-#include "src/objects/property-descriptor.h"
 #include "src/roots/roots.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/string-simd.h"
+#include "src/strings/unicode-decoder.h"
 
 namespace v8 {
 namespace internal {
@@ -122,6 +128,51 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Skips over characters that cannot terminate a JSON string, i.e. anything
+// but '"', '\\' and control characters, a SimdCharBlock at a time. Returns a
+// pointer to the first potential terminator, or to the remaining tail that is
+// shorter than a block. For two-byte input, |bits| is updated to exceed
+// Latin1::kMaxChar if any skipped character does.
+template <typename Char>
+V8_INLINE const Char* SkipJsonStringCharacters(const Char* cursor,
+                                               const Char* end,
+                                               base::uc32* bits) {
+  using Block = SimdCharBlock<Char>;
+  while (end - cursor >= Block::kLanes) {
+    Block block = Block::Load(cursor);
+    uint32_t terminators = block.EqualMask('"') | block.EqualMask('\\') |
+                           block.LessThanMask(0x20);
+    if (sizeof(Char) == 2) {
+      uint32_t wide = block.GreaterThanMask(unibrow::Latin1::kMaxChar);
+      if (terminators != 0) {
+        wide &= Block::LanesBefore(Block::FirstLane(terminators));
+      }
+      if (wide != 0) *bits |= unibrow::Latin1::kMaxChar + 1;
+    }
+    if (terminators != 0) return cursor + Block::FirstLane(terminators);
+    cursor += Block::kLanes;
+  }
+  return cursor;
+}
+
+// Skips over a run of JSON whitespace a SimdCharBlock at a time. Returns a
+// pointer to the first non-whitespace character, or to the remaining tail that
+// is shorter than a block.
+template <typename Char>
+V8_INLINE const Char* SkipJsonWhitespace(const Char* cursor, const Char* end) {
+  using Block = SimdCharBlock<Char>;
+  while (end - cursor >= Block::kLanes) {
+    Block block = Block::Load(cursor);
+    uint32_t whitespace = block.EqualMask(' ') | block.EqualMask('\n') |
+                          block.EqualMask('\r') | block.EqualMask('\t');
+    if (whitespace != Block::kAllLanes) {
+      return cursor + Block::FirstLane(~whitespace & Block::kAllLanes);
+    }
+    cursor += Block::kLanes;
+  }
+  return cursor;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -136,24 +187,71 @@ MaybeHandle<Object> JsonParseInternalizer::Internalize(
   JSObject::AddProperty(isolate, holder, name, result, NONE);
   if (v8_flags.harmony_json_parse_with_source) {
     return internalizer.InternalizeJsonProperty<kWithSource>(
-        holder, name, val_node.ToHandleChecked(), result);
+        holder, name, result, val_node.ToHandleChecked(), result);
   }
   return internalizer.InternalizeJsonProperty<kWithoutSource>(
-      holder, name, Handle<Object>(), Handle<Object>());
+      holder, name, result, Handle<Object>(), Handle<Object>());
+}
+
+// static
+bool JsonParseInternalizer::HasOnlyEnumerableDataFields(JSObject object,
+                                                        Isolate* isolate) {
+  DisallowGarbageCollection no_gc;
+  Map map = object->map(isolate);
+  // Array index keys, which are enumerated first, live in the elements.
+  if (map->instance_type() != JS_OBJECT_TYPE || map->is_dictionary_map() ||
+      object->elements(isolate) != ReadOnlyRoots(isolate).empty_fixed_array()) {
+    return false;
+  }
+  DescriptorArray descriptors = map->instance_descriptors(isolate);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.kind() != PropertyKind::kData ||
+        details.location() != PropertyLocation::kField ||
+        (details.attributes() & DONT_ENUM) != 0 ||
+        !descriptors->GetKey(i).IsString()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool JsonParseInternalizer::InternalizeDataFields(Handle<JSObject> object) {
+  Handle<Map> map(object->map(), isolate_);
+  Handle<DescriptorArray> descriptors(map->instance_descriptors(isolate_),
+                                      isolate_);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    HandleScope inner_scope(isolate_);
+    Handle<String> key_name(String::cast(descriptors->GetKey(i)), isolate_);
+    Handle<Object> value;
+    if (object->map() == *map) {
+      PropertyDetails details = descriptors->GetDetails(i);
+      value = JSObject::FastPropertyAt(isolate_, object,
+                                       details.representation(),
+                                       FieldIndex::ForDetails(*map, details));
+    } else {
+      // The reviver changed the object through |this|; fall back to the
+      // generic lookup, which also sees properties that have been deleted.
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+          isolate_, value,
+          Object::GetPropertyOrElement(isolate_, object, key_name), false);
+    }
+    if (!RecurseAndApply<kWithoutSource>(object, key_name, value,
+                                         Handle<Object>(), Handle<Object>())) {
+      return false;
+    }
+  }
+  return true;
 }
 
 template <JsonParseInternalizer::WithOrWithoutSource with_source>
 MaybeHandle<Object> JsonParseInternalizer::InternalizeJsonProperty(
-    Handle<JSReceiver> holder, Handle<String> name, Handle<Object> val_node,
-    Handle<Object> snapshot) {
+    Handle<JSReceiver> holder, Handle<String> name, Handle<Object> value,
+    Handle<Object> val_node, Handle<Object> snapshot) {
   DCHECK_EQ(with_source == kWithSource,
             !val_node.is_null() && !snapshot.is_null());
   DCHECK(reviver_->IsCallable());
   HandleScope outer_scope(isolate_);
-  Handle<Object> value;
-  ASSIGN_RETURN_ON_EXCEPTION(
-      isolate_, value, Object::GetPropertyOrElement(isolate_, holder, name),
-      Object);
 
   // When with_source == kWithSource, the source text is passed to the reviver
   // if the reviver has not mucked with the originally parsed value.
@@ -178,21 +276,24 @@ MaybeHandle<Object> JsonParseInternalizer::InternalizeJsonProperty(
         int snapshot_length = val_nodes_and_snapshots->length() / 2;
         for (int i = 0; i < length; i++) {
           HandleScope inner_scope(isolate_);
-          Handle<Object> index = isolate_->factory()->NewNumber(i);
-          Handle<String> index_name =
-              isolate_->factory()->NumberToString(index);
+          Handle<String> index_name = isolate_->factory()->SizeToString(i);
+          Handle<Object> element;
+          ASSIGN_RETURN_ON_EXCEPTION(isolate_, element,
+                                     Object::GetElement(isolate_, object, i),
+                                     Object);
           // Even if the array pointer snapshot matched, it's possible the
           // array had new elements added that are not in the snapshotted
           // elements.
           const bool rv =
               i < snapshot_length
                   ? RecurseAndApply<kWithSource>(
-                        object, index_name,
+                        object, index_name, element,
                         handle(val_nodes_and_snapshots->get(i * 2), isolate_),
                         handle(val_nodes_and_snapshots->get(i * 2 + 1),
                                isolate_))
-                  : RecurseAndApply<kWithoutSource>(
-                        object, index_name, Handle<Object>(), Handle<Object>());
+                  : RecurseAndApply<kWithoutSource>(object, index_name, element,
+                                                    Handle<Object>(),
+                                                    Handle<Object>());
           if (!rv) {
             return MaybeHandle<Object>();
           }
@@ -200,15 +301,24 @@ MaybeHandle<Object> JsonParseInternalizer::InternalizeJsonProperty(
       } else {
         for (int i = 0; i < length; i++) {
           HandleScope inner_scope(isolate_);
-          Handle<Object> index = isolate_->factory()->NewNumber(i);
-          Handle<String> index_name =
-              isolate_->factory()->NumberToString(index);
-          if (!RecurseAndApply<kWithoutSource>(
-                  object, index_name, Handle<Object>(), Handle<Object>())) {
+          Handle<String> index_name = isolate_->factory()->SizeToString(i);
+          Handle<Object> element;
+          ASSIGN_RETURN_ON_EXCEPTION(isolate_, element,
+                                     Object::GetElement(isolate_, object, i),
+                                     Object);
+          if (!RecurseAndApply<kWithoutSource>(object, index_name, element,
+                                               Handle<Object>(),
+                                               Handle<Object>())) {
             return MaybeHandle<Object>();
           }
         }
       }
+    } else if (!pass_source_to_reviver && object->IsJSObject() &&
+               HasOnlyEnumerableDataFields(JSObject::cast(*object),
+                                           isolate_)) {
+      if (!InternalizeDataFields(Handle<JSObject>::cast(object))) {
+        return MaybeHandle<Object>();
+      }
     } else {
       Handle<FixedArray> contents;
       ASSIGN_RETURN_ON_EXCEPTION(
@@ -232,12 +342,19 @@ MaybeHandle<Object> JsonParseInternalizer::InternalizeJsonProperty(
           // Even if the object pointer snapshot matched, it's possible the
           // object had new properties added that are not in the snapshotted
           // contents.
+          Handle<Object> property_value;
+          ASSIGN_RETURN_ON_EXCEPTION(
+              isolate_, property_value,
+              Object::GetPropertyOrElement(isolate_, object, key_name), Object);
           const bool rv =
               !property_snapshot->IsTheHole()
-                  ? RecurseAndApply<kWithSource>(
-                        object, key_name, property_val_node, property_snapshot)
+                  ? RecurseAndApply<kWithSource>(object, key_name,
+                                                 property_value,
+                                                 property_val_node,
+                                                 property_snapshot)
                   : RecurseAndApply<kWithoutSource>(
-                        object, key_name, Handle<Object>(), Handle<Object>());
+                        object, key_name, property_value, Handle<Object>(),
+                        Handle<Object>());
           if (!rv) {
             return MaybeHandle<Object>();
           }
@@ -246,8 +363,13 @@ MaybeHandle<Object> JsonParseInternalizer::InternalizeJsonProperty(
         for (int i = 0; i < contents->length(); i++) {
           HandleScope inner_scope(isolate_);
           Handle<String> key_name(String::cast(contents->get(i)), isolate_);
-          if (!RecurseAndApply<kWithoutSource>(
-                  object, key_name, Handle<Object>(), Handle<Object>())) {
+          Handle<Object> property_value;
+          ASSIGN_RETURN_ON_EXCEPTION(
+              isolate_, property_value,
+              Object::GetPropertyOrElement(isolate_, object, key_name), Object);
+          if (!RecurseAndApply<kWithoutSource>(object, key_name, property_value,
+                                               Handle<Object>(),
+                                               Handle<Object>())) {
             return MaybeHandle<Object>();
           }
         }
@@ -281,6 +403,7 @@ MaybeHandle<Object> JsonParseInternalizer::InternalizeJsonProperty(
 template <JsonParseInternalizer::WithOrWithoutSource with_source>
 bool JsonParseInternalizer::RecurseAndApply(Handle<JSReceiver> holder,
                                             Handle<String> name,
+                                            Handle<Object> value,
                                             Handle<Object> val_node,
                                             Handle<Object> snapshot) {
   STACK_CHECK(isolate_, false);
@@ -288,20 +411,18 @@ bool JsonParseInternalizer::RecurseAndApply(Handle<JSReceiver> holder,
   Handle<Object> result;
   ASSIGN_RETURN_ON_EXCEPTION_VALUE(
       isolate_, result,
-      InternalizeJsonProperty<with_source>(holder, name, val_node, snapshot),
+      InternalizeJsonProperty<with_source>(holder, name, value, val_node,
+                                           snapshot),
       false);
   Maybe<bool> change_result = Nothing<bool>();
   if (result->IsUndefined(isolate_)) {
     change_result = JSReceiver::DeletePropertyOrElement(holder, name,
                                                         LanguageMode::kSloppy);
   } else {
-    PropertyDescriptor desc;
-    desc.set_value(result);
-    desc.set_configurable(true);
-    desc.set_enumerable(true);
-    desc.set_writable(true);
-    change_result = JSReceiver::DefineOwnProperty(isolate_, holder, name, &desc,
-                                                  Just(kDontThrow));
+    // For ordinary objects this takes the JSObject shortcut, rather than
+    // validating a full property descriptor against the existing property.
+    change_result = JSReceiver::CreateDataProperty(isolate_, holder, name,
+                                                   result, Just(kDontThrow));
   }
   MAYBE_RETURN(change_result, false);
   return true;
@@ -312,7 +433,11 @@ JsonParser<Char>::JsonParser(Isolate* isolate, Handle<String> source)
     : isolate_(isolate),
       hash_seed_(HashSeed(isolate)),
       object_constructor_(isolate_->object_function()),
-      original_source_(source) {
+      original_source_(source),
+      allocation_(
+          isolate->heap()->pretenuring_handler()->GetRuntimeAllocationType(
+              PretenuringHandler::RuntimeAllocator::kJsonParse,
+              source->length() * sizeof(Char))) {
   size_t start = 0;
   size_t length = source->length();
   PtrComprCageBase cage_base(isolate);
@@ -558,6 +683,9 @@ MaybeHandle<Object> JsonParser<Char>::ParseJson(Handle<Object> reviver) {
   if (isolate_->has_pending_exception()) {
     return MaybeHandle<Object>();
   }
+  isolate_->heap()->pretenuring_handler()->SampleRuntimeAllocation(
+      PretenuringHandler::RuntimeAllocator::kJsonParse,
+      original_source_->length() * sizeof(Char), result);
   return result;
 }
 
@@ -568,6 +696,15 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   next_ = JsonToken::EOS;
 
+  if constexpr (SimdCharBlock<Char>::kIsVectorized) {
+    // Most tokens are not preceded by whitespace at all, so only take the
+    // vector path for runs such as newlines followed by indentation.
+    if (!is_at_end() && *cursor_ <= unibrow::Latin1::kMaxChar &&
+        one_char_json_tokens[*cursor_] == JsonToken::WHITESPACE) {
+      cursor_ = SkipJsonWhitespace(cursor_ + 1, end_);
+    }
+  }
+
   cursor_ = std::find_if(cursor_, end_, [this](Char c) {
     JsonToken current = V8_LIKELY(c <= unibrow::Latin1::kMaxChar)
                             ? one_char_json_tokens[c]
@@ -647,6 +784,31 @@ Handle<Map> ParentOfDescriptorOwner(Isolate* isolate, Handle<Map> maybe_root,
 }
 }  // namespace
 
+template <typename Char>
+Map JsonParser<Char>::ExpectedMapAt(size_t depth) {
+  DisallowGarbageCollection no_gc;
+  FixedArray raw_maps = *expected_maps_;
+  if (depth >= static_cast<size_t>(raw_maps->length())) return Map();
+  Object maybe_map = raw_maps->get(static_cast<int>(depth));
+  if (!maybe_map.IsMap()) return Map();
+  return Map::cast(maybe_map);
+}
+
+template <typename Char>
+void JsonParser<Char>::SetExpectedMapAt(size_t depth, Handle<Object> value) {
+  if (depth >= kMaxExpectedMapDepth || !value->IsJSObject()) return;
+  Handle<Map> map(JSObject::cast(*value)->map(), isolate_);
+  if (map->is_dictionary_map()) return;
+  int index = static_cast<int>(depth);
+  if (index >= expected_maps_->length()) {
+    int capacity = std::min(std::max(2 * index, 4), kMaxExpectedMapDepth);
+    Handle<FixedArray> maps = factory()->CopyFixedArrayAndGrow(
+        expected_maps_, capacity - expected_maps_->length());
+    expected_maps_.PatchValue(*maps);
+  }
+  expected_maps_->set(index, *map);
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonObject(
     const JsonContinuation& cont,
@@ -667,7 +829,7 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
     // Store as dictionary elements if that would use less memory.
     if (ShouldConvertToSlowElements(cont.elements, cont.max_index + 1)) {
       Handle<NumberDictionary> elms =
-          NumberDictionary::New(isolate_, cont.elements);
+          NumberDictionary::New(isolate_, cont.elements, allocation_);
       for (int i = 0; i < length; i++) {
         const JsonProperty& property = property_stack[start + i];
         if (!property.string.is_index()) continue;
@@ -681,7 +843,7 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
       elements = elms;
     } else {
       Handle<FixedArray> elms =
-          factory()->NewFixedArrayWithHoles(cont.max_index + 1);
+          factory()->NewFixedArrayWithHoles(cont.max_index + 1, allocation_);
       DisallowGarbageCollection no_gc;
       FixedArray raw_elements = *elms;
       WriteBarrierMode mode = raw_elements->GetWriteBarrierMode(no_gc);
@@ -806,9 +968,15 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
         factory()->NewByteArray(kMutableDoubleSize * new_mutable_double);
   }
 
-  Handle<JSObject> object = initial_map->is_dictionary_map()
-                                ? factory()->NewSlowJSObjectFromMap(map)
-                                : factory()->NewJSObjectFromMap(map);
+  Handle<JSObject> object =
+      initial_map->is_dictionary_map()
+          ? factory()->NewSlowJSObjectFromMap(
+                map,
+                V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL
+                    ? SwissNameDictionary::kInitialCapacity
+                    : NameDictionary::kInitialCapacity,
+                allocation_)
+          : factory()->NewJSObjectFromMap(map, allocation_);
   object->set_elements(*elements);
 
   {
@@ -927,7 +1095,9 @@ Handle<Object> JsonParser<Char>::BuildJsonArray(
     }
   }
 
-  Handle<JSArray> array = factory()->NewJSArray(kind, length, length);
+  Handle<JSArray> array = factory()->NewJSArray(
+      kind, length, length,
+      ArrayStorageAllocationMode::DONT_INITIALIZE_ARRAY_ELEMENTS, allocation_);
   if (kind == PACKED_DOUBLE_ELEMENTS) {
     DisallowGarbageCollection no_gc;
     FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
@@ -1003,6 +1173,10 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
 
   cont_stack.reserve(16);
 
+  // Allocate the handle outside of the continuation scopes so that the cache
+  // survives them; the backing store is allocated lazily.
+  expected_maps_ = factory()->empty_fixed_array();
+
   JsonContinuation cont(isolate_, JsonContinuation::kReturn, 0);
 
   Handle<Object> value;
@@ -1218,21 +1392,26 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
           }
 
           Handle<Map> feedback;
+          Map maybe_feedback;
           if (cont_stack.size() > 0 &&
               cont_stack.back().type() == JsonContinuation::kArrayElement &&
               cont_stack.back().index < element_stack.size() &&
               element_stack.back()->IsJSObject()) {
-            Map maybe_feedback = JSObject::cast(*element_stack.back())->map();
-            // Don't consume feedback from objects with a map that's detached
-            // from the transition tree.
-            if (!maybe_feedback->IsDetached(isolate_)) {
-              feedback = handle(maybe_feedback, isolate_);
-              if (maybe_feedback->is_deprecated()) {
-                feedback = Map::Update(isolate_, feedback);
-              }
+            maybe_feedback = JSObject::cast(*element_stack.back())->map();
+          } else {
+            maybe_feedback = ExpectedMapAt(cont_stack.size());
+          }
+          // Don't consume feedback from objects with a map that's detached
+          // from the transition tree.
+          if (!maybe_feedback.is_null() &&
+              !maybe_feedback->IsDetached(isolate_)) {
+            feedback = handle(maybe_feedback, isolate_);
+            if (maybe_feedback->is_deprecated()) {
+              feedback = Map::Update(isolate_, feedback);
             }
           }
           value = BuildJsonObject(cont, property_stack, feedback);
+          SetExpectedMapAt(cont_stack.size(), value);
           Expect(JsonToken::RBRACE,
                  MessageTemplate::kJsonParseExpectedCommaOrRBrace);
           // Return the object.
@@ -1465,6 +1644,10 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
                                             Handle<String> hint) {
   if (string.length() == 0) return factory()->empty_string();
 
+  if (sizeof(Char) == 1 && V8_UNLIKELY(string.is_utf8())) {
+    return MakeUtf8String(string, hint);
+  }
+
   if (string.internalize() && !string.has_escape()) {
     if (!hint.is_null()) {
       base::Vector<const Char> data(chars_ + string.start(), string.length());
@@ -1482,15 +1665,118 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
   if (sizeof(Char) == 1 ? V8_LIKELY(!string.needs_conversion())
                         : string.needs_conversion()) {
     Handle<SeqOneByteString> intermediate =
-        factory()->NewRawOneByteString(string.length()).ToHandleChecked();
+        factory()
+            ->NewRawOneByteString(string.length(), allocation_)
+            .ToHandleChecked();
     return DecodeString(string, intermediate, hint);
   }
 
   Handle<SeqTwoByteString> intermediate =
-      factory()->NewRawTwoByteString(string.length()).ToHandleChecked();
+      factory()
+          ->NewRawTwoByteString(string.length(), allocation_)
+          .ToHandleChecked();
   return DecodeString(string, intermediate, hint);
 }
 
+template <typename Char>
+Handle<String> JsonParser<Char>::MakeUtf8String(const JsonString& string,
+                                                Handle<String> hint) {
+  DCHECK(utf8_input_);
+  std::vector<base::uc16> decoded;
+  {
+    DisallowGarbageCollection no_gc;
+    const uint8_t* cursor =
+        reinterpret_cast<const uint8_t*>(chars_) + string.start();
+    const uint8_t* end = cursor + string.length();
+    decoded.reserve(string.length());
+    while (cursor < end) {
+      uint8_t c = *cursor;
+      if (c > unibrow::Utf8::kMaxOneByteChar) {
+        // Continuation bytes are non-ASCII too, so the run of non-ASCII bytes
+        // consists of complete sequences unless the input is malformed, in
+        // which case the decoder produces replacement characters.
+        const uint8_t* run_end = std::find_if(cursor, end, [](uint8_t c) {
+          return c <= unibrow::Utf8::kMaxOneByteChar;
+        });
+        base::Vector<const uint8_t> run(cursor, run_end - cursor);
+        Utf8Decoder decoder(run);
+        size_t length = decoded.size();
+        decoded.resize(length + decoder.utf16_length());
+        decoder.Decode(decoded.data() + length, run);
+        cursor = run_end;
+        continue;
+      }
+      cursor++;
+      if (c != '\\') {
+        decoded.push_back(c);
+        continue;
+      }
+      // Escapes have been validated by ScanJsonString.
+      switch (GetEscapeKind(character_json_scan_flags[*cursor])) {
+        case EscapeKind::kSelf:
+          decoded.push_back(*cursor);
+          break;
+        case EscapeKind::kBackspace:
+          decoded.push_back('\x08');
+          break;
+        case EscapeKind::kTab:
+          decoded.push_back('\x09');
+          break;
+        case EscapeKind::kNewLine:
+          decoded.push_back('\x0A');
+          break;
+        case EscapeKind::kFormFeed:
+          decoded.push_back('\x0C');
+          break;
+        case EscapeKind::kCarriageReturn:
+          decoded.push_back('\x0D');
+          break;
+        case EscapeKind::kUnicode: {
+          base::uc32 value = 0;
+          for (int i = 0; i < 4; i++) {
+            value = value * 16 + base::HexValue(*++cursor);
+          }
+          decoded.push_back(static_cast<base::uc16>(value));
+          break;
+        }
+        case EscapeKind::kIllegal:
+          UNREACHABLE();
+      }
+      cursor++;
+    }
+  }
+
+  base::Vector<const base::uc16> chars(decoded.data(),
+                                       static_cast<int>(decoded.size()));
+  if (!hint.is_null() && Matches(chars, hint)) return hint;
+  if (string.internalize()) {
+    return factory()->InternalizeString(
+        chars, String::IsOneByte(chars.begin(), chars.length()));
+  }
+  return factory()->NewStringFromTwoByte(chars).ToHandleChecked();
+}
+
+template <typename Char>
+MaybeHandle<Object> JsonParser<Char>::ParseUtf8(
+    Isolate* isolate, base::Vector<const uint8_t> utf8_source) {
+  // UTF-8 input is stored in a one-byte string.
+  if constexpr (!kIsOneByte) UNREACHABLE();
+  HighAllocationThroughputScope high_throughput_scope(
+      V8::GetCurrentPlatform());
+  Handle<SeqOneByteString> source;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, source,
+      isolate->factory()->NewRawOneByteString(utf8_source.length()), Object);
+  {
+    DisallowGarbageCollection no_gc;
+    CopyChars(source->GetChars(no_gc), utf8_source.begin(),
+              utf8_source.length());
+  }
+  JsonParser parser(isolate, source);
+  parser.utf8_input_ = true;
+  return parser.ParseJson(isolate->factory()->undefined_value());
+}
+
 template <typename Char>
 template <typename SinkChar>
 void JsonParser<Char>::DecodeString(SinkChar* sink, int start, int length) {
@@ -1564,6 +1850,9 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    if constexpr (SimdCharBlock<Char>::kIsVectorized) {
+      cursor_ = SkipJsonStringCharacters(cursor_, end_, &bits);
+    }
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -1582,6 +1871,14 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
     if (*cursor_ == '"') {
       int end = position();
       advance();
+      if (sizeof(Char) == 1 && V8_UNLIKELY(utf8_input_) &&
+          std::any_of(chars_ + start, chars_ + end, [](Char c) {
+            return c > unibrow::Utf8::kMaxOneByteChar;
+          })) {
+        // The decoded length is only known once the string is decoded.
+        return JsonString(start, end - start, false, needs_internalization,
+                          has_escape, true);
+      }
       int length = end - offset;
       bool convert = sizeof(Char) == 1 ? bits > unibrow::Latin1::kMaxChar
                                        : bits <= unibrow::Latin1::kMaxChar;
@@ -1650,5 +1947,105 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
 template class JsonParser<uint8_t>;
 template class JsonParser<uint16_t>;
 
+namespace {
+
+// External string resource that takes ownership of the buffer accumulated by
+// a JsonStreamingParser.
+template <typename Char, typename Resource>
+class JsonStreamingSourceResource final : public Resource {
+ public:
+  explicit JsonStreamingSourceResource(std::vector<Char> chars)
+      : chars_(std::move(chars)) {}
+
+  const Char* data() const override { return chars_.data(); }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  const std::vector<Char> chars_;
+};
+
+using JsonStreamingOneByteResource =
+    JsonStreamingSourceResource<char,
+                                v8::String::ExternalOneByteStringResource>;
+using JsonStreamingTwoByteResource =
+    JsonStreamingSourceResource<uint16_t,
+                                v8::String::ExternalStringResource>;
+
+}  // namespace
+
+void JsonStreamingParser::AppendOneByte(const uint8_t* data, size_t length) {
+  if (is_one_byte_) {
+    const char* chars = reinterpret_cast<const char*>(data);
+    one_byte_chars_.insert(one_byte_chars_.end(), chars, chars + length);
+  } else {
+    two_byte_chars_.insert(two_byte_chars_.end(), data, data + length);
+  }
+}
+
+void JsonStreamingParser::AppendTwoByte(const uint16_t* data, size_t length) {
+  if (is_one_byte_) {
+    const uint16_t* end = data + length;
+    if (std::all_of(data, end, [](uint16_t c) {
+          return c <= String::kMaxOneByteCharCode;
+        })) {
+      one_byte_chars_.reserve(one_byte_chars_.size() + length);
+      for (const uint16_t* p = data; p < end; ++p) {
+        one_byte_chars_.push_back(static_cast<char>(*p));
+      }
+      return;
+    }
+    Widen();
+  }
+  two_byte_chars_.insert(two_byte_chars_.end(), data, data + length);
+}
+
+void JsonStreamingParser::Widen() {
+  DCHECK(is_one_byte_);
+  DCHECK(two_byte_chars_.empty());
+  two_byte_chars_.reserve(one_byte_chars_.size());
+  for (char c : one_byte_chars_) {
+    two_byte_chars_.push_back(static_cast<uint8_t>(c));
+  }
+  std::vector<char>().swap(one_byte_chars_);
+  is_one_byte_ = false;
+}
+
+MaybeHandle<Object> JsonStreamingParser::Finish(Isolate* isolate) {
+  Handle<Object> undefined = isolate->factory()->undefined_value();
+  bool is_one_byte = is_one_byte_;
+  std::vector<char> one_byte_chars = std::move(one_byte_chars_);
+  std::vector<uint16_t> two_byte_chars = std::move(two_byte_chars_);
+  one_byte_chars_.clear();
+  two_byte_chars_.clear();
+  is_one_byte_ = true;
+
+  Handle<String> source;
+  if (is_one_byte) {
+    if (one_byte_chars.empty()) {
+      return JsonParser<uint8_t>::Parse(
+          isolate, isolate->factory()->empty_string(), undefined);
+    }
+    auto resource = std::make_unique<JsonStreamingOneByteResource>(
+        std::move(one_byte_chars));
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate, source,
+        isolate->factory()->NewExternalStringFromOneByte(resource.get()),
+        Object);
+    // The string now owns the resource and disposes of it when it dies.
+    resource.release();
+    return JsonParser<uint8_t>::Parse(isolate, source, undefined);
+  }
+
+  DCHECK(!two_byte_chars.empty());
+  auto resource =
+      std::make_unique<JsonStreamingTwoByteResource>(std::move(two_byte_chars));
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, source,
+      isolate->factory()->NewExternalStringFromTwoByte(resource.get()),
+      Object);
+  resource.release();
+  return JsonParser<uint16_t>::Parse(isolate, source, undefined);
+}
+
 }  // namespace internal
 }  // namespace v8
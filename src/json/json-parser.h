@@ -5,6 +5,8 @@
 #ifndef V8_JSON_JSON_PARSER_H_
 #define V8_JSON_JSON_PARSER_H_
 
+#include <vector>
+
 #include "include/v8-callbacks.h"
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
@@ -28,7 +30,8 @@ class JsonString final {
         needs_conversion_(false),
         internalize_(false),
         has_escape_(false),
-        is_index_(false) {}
+        is_index_(false),
+        is_utf8_(false) {}
 
   explicit JsonString(uint32_t index)
       : index_(index),
@@ -36,17 +39,20 @@ class JsonString final {
         needs_conversion_(false),
         internalize_(false),
         has_escape_(false),
-        is_index_(true) {}
+        is_index_(true),
+        is_utf8_(false) {}
 
   JsonString(int start, int length, bool needs_conversion,
-             bool needs_internalization, bool has_escape)
+             bool needs_internalization, bool has_escape,
+             bool is_utf8 = false)
       : start_(start),
         length_(length),
         needs_conversion_(needs_conversion),
         internalize_(needs_internalization ||
                      length_ <= kMaxInternalizedStringValueLength),
         has_escape_(has_escape),
-        is_index_(false) {}
+        is_index_(false),
+        is_utf8_(is_utf8) {}
 
   bool internalize() const {
     DCHECK(!is_index_);
@@ -80,6 +86,14 @@ class JsonString final {
 
   bool is_index() const { return is_index_; }
 
+  // Whether the string contains non-ASCII characters of UTF-8 encoded input.
+  // In that case length() is the number of source bytes rather than the
+  // number of decoded characters.
+  bool is_utf8() const {
+    DCHECK(!is_index_);
+    return is_utf8_;
+  }
+
  private:
   static const int kMaxInternalizedStringValueLength = 10;
 
@@ -92,6 +106,7 @@ class JsonString final {
   const bool internalize_ : 1;
   const bool has_escape_ : 1;
   const bool is_index_ : 1;
+  const bool is_utf8_ : 1;
 };
 
 struct JsonProperty {
@@ -117,15 +132,29 @@ class JsonParseInternalizer {
 
   enum WithOrWithoutSource { kWithoutSource, kWithSource };
 
+  // |value| is the result of Get(holder, key), which the caller has already
+  // performed.
   template <WithOrWithoutSource with_source>
   MaybeHandle<Object> InternalizeJsonProperty(Handle<JSReceiver> holder,
                                               Handle<String> key,
+                                              Handle<Object> value,
                                               Handle<Object> val_node,
                                               Handle<Object> snapshot);
 
   template <WithOrWithoutSource with_source>
   bool RecurseAndApply(Handle<JSReceiver> holder, Handle<String> name,
-                       Handle<Object> val_node, Handle<Object> snapshot);
+                       Handle<Object> value, Handle<Object> val_node,
+                       Handle<Object> snapshot);
+
+  // Whether the enumerable own property keys of |object| are exactly the keys
+  // of its own descriptors, in order, and all of them are data fields. This
+  // holds for the objects created by JsonParser.
+  static bool HasOnlyEnumerableDataFields(JSObject object, Isolate* isolate);
+
+  // Visits the properties of an object for which HasOnlyEnumerableDataFields
+  // holds, reading them straight from their fields as long as the reviver
+  // does not change the object's map.
+  bool InternalizeDataFields(Handle<JSObject> object);
 
   Isolate* isolate_;
   Handle<JSReceiver> reviver_;
@@ -180,6 +209,13 @@ class JsonParser final {
     return result;
   }
 
+  // Parses UTF-8 encoded JSON text that was copied verbatim into a one-byte
+  // string. Outside of string literals valid JSON is pure ASCII; non-ASCII
+  // bytes inside string literals are decoded as UTF-8 when the string is
+  // created. Error positions refer to bytes rather than characters.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> ParseUtf8(
+      Isolate* isolate, base::Vector<const uint8_t> utf8_source);
+
   static constexpr base::uc32 kEndOfString = static_cast<base::uc32>(-1);
   static constexpr base::uc32 kInvalidUnicodeCharacter =
       static_cast<base::uc32>(-1);
@@ -301,6 +337,7 @@ class JsonParser final {
   base::uc32 ScanUnicodeCharacter();
   Handle<String> MakeString(const JsonString& string,
                             Handle<String> hint = Handle<String>());
+  Handle<String> MakeUtf8String(const JsonString& string, Handle<String> hint);
 
   template <typename SinkChar>
   void DecodeString(SinkChar* sink, int start, int length);
@@ -331,6 +368,14 @@ class JsonParser final {
       const JsonContinuation& cont,
       const SmallVector<Handle<Object>>& element_stack);
 
+  // Per-parse cache of the map of the object literal that was built last at a
+  // given nesting depth. It provides feedback to BuildJsonObject for literals
+  // that have no preceding sibling in the same array, e.g. the values of the
+  // same property in an array of records.
+  Map ExpectedMapAt(size_t depth);
+  void SetExpectedMapAt(size_t depth, Handle<Object> value);
+  static const int kMaxExpectedMapDepth = 32;
+
   static const int kMaxContextCharacters = 10;
   static const int kMinOriginalSourceLengthForContext =
       (kMaxContextCharacters * 2) + 1;
@@ -388,14 +433,21 @@ class JsonParser final {
   Isolate* isolate_;
   const uint64_t hash_seed_;
   JsonToken next_;
+  // Whether the one-byte source holds UTF-8 rather than Latin1 characters.
+  bool utf8_input_ = false;
   // Indicates whether the bytes underneath source_ can relocate during GC.
   bool chars_may_relocate_;
   Handle<JSFunction> object_constructor_;
   const Handle<String> original_source_;
+  // Where to allocate the objects of the result, see
+  // PretenuringHandler::GetRuntimeAllocationType.
+  const AllocationType allocation_;
   Handle<String> source_;
   // The parsed value's source to be passed to the reviver, if the reviver is
   // callable.
   MaybeHandle<Object> parsed_val_node_;
+  // Maps indexed by nesting depth, see ExpectedMapAt.
+  Handle<FixedArray> expected_maps_;
 
   // Cached pointer to the raw chars in source. In case source is on-heap, we
   // register an UpdatePointers callback. For this reason, chars_, cursor_ and
@@ -411,6 +463,36 @@ class JsonParser final {
 extern template class JsonParser<uint8_t>;
 extern template class JsonParser<uint16_t>;
 
+// Backs v8::JSON::StreamingParser. Source chunks are accumulated in an
+// off-heap buffer which is wrapped into an external string on Finish(), so the
+// JsonParser reads the characters in place. The buffer is one-byte until a
+// chunk containing a non-Latin-1 character is appended; from then on all
+// chunks are widened into the two-byte buffer.
+class V8_EXPORT_PRIVATE JsonStreamingParser final {
+ public:
+  JsonStreamingParser() = default;
+  JsonStreamingParser(const JsonStreamingParser&) = delete;
+  JsonStreamingParser& operator=(const JsonStreamingParser&) = delete;
+
+  void AppendOneByte(const uint8_t* data, size_t length);
+  void AppendTwoByte(const uint16_t* data, size_t length);
+
+  // Parses the accumulated source and resets the parser.
+  V8_WARN_UNUSED_RESULT MaybeHandle<Object> Finish(Isolate* isolate);
+
+  size_t length() const {
+    return is_one_byte_ ? one_byte_chars_.size() : two_byte_chars_.size();
+  }
+
+ private:
+  void Widen();
+
+  bool is_one_byte_ = true;
+  // Latin-1 characters, stored as char to match the external string resource.
+  std::vector<char> one_byte_chars_;
+  std::vector<uint16_t> two_byte_chars_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -15,14 +15,20 @@
 #include "src/objects/oddball-inl.h"
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/smi.h"
+#include "src/profiler/output-stream-writer.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/string-simd.h"
+#include "src/utils/memcopy.h"
 
 namespace v8 {
 namespace internal {
 
 class JsonStringifier {
  public:
-  explicit JsonStringifier(Isolate* isolate);
+  // If {output_stream} is given, the output is written to it as UTF-8 in
+  // chunks whenever the buffer fills up, see StringifyToStream.
+  explicit JsonStringifier(Isolate* isolate,
+                           v8::OutputStream* output_stream = nullptr);
 
   ~JsonStringifier() {
     if (one_byte_ptr_ != one_byte_array_) delete[] one_byte_ptr_;
@@ -34,6 +40,9 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(Handle<Object> object,
+                                                      Handle<Object> gap);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION };
 
@@ -225,6 +234,11 @@ class JsonStringifier {
       const uint8_t* u = reinterpret_cast<const uint8_t*>(s);
       while (*u != '\0') Append(*(u++));
     }
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(const SrcChar* chars, int length) {
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
 
    private:
     int* current_index_;
@@ -239,9 +253,26 @@ class JsonStringifier {
   template <typename SrcChar, typename DestChar>
   V8_INLINE void SerializeString_(Handle<String> string);
 
+  // Serializes a ConsString segment by segment instead of flattening it, if
+  // the escaped string fits into the current part.
+  bool TrySerializeConsString(Handle<String> string);
+  template <typename DestChar>
+  void SerializeConsString_(String string);
+
+  template <typename DestChar>
+  static void AppendLoneSurrogate(base::uc16 c,
+                                  NoExtendBuilder<DestChar>* dest);
+
   template <typename Char>
   V8_INLINE static bool DoNotEscape(Char c);
 
+  // Returns the length of the longest prefix of {chars} that can be copied to
+  // the output verbatim, looking at a SimdCharBlock at a time. Characters that
+  // are left over because they do not fill a whole block are not counted.
+  template <typename Char>
+  V8_INLINE static int CountLeadingCharsNotToEscape(const Char* chars,
+                                                    int length);
+
   V8_INLINE void NewLine();
   V8_NOINLINE void NewLineOutline();
   V8_INLINE void Indent() { indent_++; }
@@ -271,6 +302,9 @@ class JsonStringifier {
 
   V8_NOINLINE void Extend();
   V8_NOINLINE void ChangeEncoding();
+  // Writes the buffered output to {output_stream_writer_} and empties the
+  // buffer, except for a trailing lead surrogate.
+  void WriteToOutputStream();
 
   Isolate* isolate_;
   String::Encoding encoding_;
@@ -285,6 +319,7 @@ class JsonStringifier {
   int part_length_;
   int current_index_;
   bool overflowed_;
+  std::unique_ptr<OutputStreamWriter> output_stream_writer_;
 
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
@@ -299,6 +334,13 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<Object> object,
+                                  Handle<Object> gap,
+                                  v8::OutputStream* stream) {
+  JsonStringifier stringifier(isolate, stream);
+  return stringifier.StringifyToStream(object, gap);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -367,7 +409,8 @@ const char* const JsonStringifier::JsonEscapeTable =
     "\xF8\0      \xF9\0      \xFA\0      \xFB\0      "
     "\xFC\0      \xFD\0      \xFE\0      \xFF\0      ";
 
-JsonStringifier::JsonStringifier(Isolate* isolate)
+JsonStringifier::JsonStringifier(Isolate* isolate,
+                                 v8::OutputStream* output_stream)
     : isolate_(isolate),
       encoding_(String::ONE_BYTE_ENCODING),
       gap_(nullptr),
@@ -379,6 +422,9 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       stack_() {
   one_byte_ptr_ = one_byte_array_;
   part_ptr_ = one_byte_ptr_;
+  if (output_stream != nullptr) {
+    output_stream_writer_ = std::make_unique<OutputStreamWriter>(output_stream);
+  }
 }
 
 MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
@@ -409,6 +455,26 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   return MaybeHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToStream(Handle<Object> object,
+                                               Handle<Object> gap) {
+  DCHECK_NOT_NULL(output_stream_writer_);
+  if (!gap->IsUndefined(isolate_) && !InitializeGap(gap)) {
+    CHECK(isolate_->has_pending_exception());
+    return Nothing<bool>();
+  }
+  Result result = SerializeObject(object);
+  if (result == EXCEPTION) {
+    CHECK(isolate_->has_pending_exception());
+    return Nothing<bool>();
+  }
+  if (result == UNCHANGED) return Just(false);
+  DCHECK_EQ(SUCCESS, result);
+  WriteToOutputStream();
+  DCHECK_EQ(0, current_index_);
+  output_stream_writer_->Finalize();
+  return Just(!output_stream_writer_->aborted());
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<Object> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -1155,6 +1221,15 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   for (int i = 0; i < src.length(); i++) {
+    if constexpr (SimdCharBlock<SrcChar>::kIsVectorized) {
+      int clean =
+          CountLeadingCharsNotToEscape(src.begin() + i, src.length() - i);
+      if (clean > 0) {
+        dest->AppendChars(src.begin() + i, clean);
+        i += clean;
+        if (i == src.length()) break;
+      }
+    }
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
       dest->Append(c);
@@ -1288,6 +1363,25 @@ bool JsonStringifier::DoNotEscape(uint16_t c) {
          (c >= 0x23 && c != 0x5C && c != 0x7F && (c < 0xD800 || c > 0xDFFF));
 }
 
+template <typename Char>
+int JsonStringifier::CountLeadingCharsNotToEscape(const Char* chars,
+                                                  int length) {
+  using Block = SimdCharBlock<Char>;
+  int count = 0;
+  while (length - count >= Block::kLanes) {
+    Block block = Block::Load(chars + count);
+    // Latin1 characters from 0x7F upwards are their own escape table entry,
+    // so apart from lone surrogates only the JSON single character escapes
+    // and control characters need to take the slow path.
+    uint32_t escape = block.EqualMask('"') | block.EqualMask('\\') |
+                      block.LessThanMask(0x20);
+    if (sizeof(Char) == 2) escape |= block.InRangeMask(0xD800, 0xDFFF);
+    if (escape != 0) return count + Block::FirstLane(escape);
+    count += Block::kLanes;
+  }
+  return count;
+}
+
 void JsonStringifier::NewLine() {
   if (gap_ == nullptr) return;
   NewLineOutline();
@@ -1311,7 +1405,82 @@ void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
   if (gap_ != nullptr) AppendCharacter(' ');
 }
 
+template <typename DestChar>
+void JsonStringifier::AppendLoneSurrogate(base::uc16 c,
+                                          NoExtendBuilder<DestChar>* dest) {
+  dest->AppendCString("\\u");
+  char* const hex = DoubleToRadixCString(c, 16);
+  dest->AppendCString(hex);
+  DeleteArray(hex);
+}
+
+template <typename DestChar>
+void JsonStringifier::SerializeConsString_(String string) {
+  Append<uint8_t, DestChar>('"');
+  {
+    DisallowGarbageCollection no_gc;
+    NoExtendBuilder<DestChar> no_extend(
+        reinterpret_cast<DestChar*>(part_ptr_) + current_index_,
+        &current_index_);
+    // A surrogate pair may be split between two segments, so a leading
+    // surrogate at the end of a segment is held back until the next one.
+    base::uc16 lead = 0;
+    StringSegmentIterator segments(string, 0, no_gc);
+    while (segments.Next()) {
+      if (segments.length() == 0) continue;
+      if (segments.IsOneByte()) {
+        if (lead != 0) AppendLoneSurrogate(lead, &no_extend);
+        lead = 0;
+        SerializeStringUnchecked_(segments.ToOneByteVector(), &no_extend);
+        continue;
+      }
+      if constexpr (sizeof(DestChar) == 1) {
+        UNREACHABLE();
+      } else {
+        base::Vector<const base::uc16> chars = segments.ToUC16Vector();
+        if (lead != 0) {
+          if (unibrow::Utf16::IsTrailSurrogate(chars[0])) {
+            no_extend.Append(lead);
+            no_extend.Append(chars[0]);
+            chars = chars.SubVector(1, chars.length());
+          } else {
+            AppendLoneSurrogate(lead, &no_extend);
+          }
+          lead = 0;
+        }
+        if (!chars.empty() &&
+            unibrow::Utf16::IsLeadSurrogate(chars[chars.length() - 1])) {
+          lead = chars[chars.length() - 1];
+          chars = chars.SubVector(0, chars.length() - 1);
+        }
+        SerializeStringUnchecked_(chars, &no_extend);
+      }
+    }
+    if (lead != 0) AppendLoneSurrogate(lead, &no_extend);
+  }
+  Append<uint8_t, DestChar>('"');
+}
+
+bool JsonStringifier::TrySerializeConsString(Handle<String> object) {
+  // The segments of a one-byte ConsString are all one-byte.
+  if (encoding_ == String::ONE_BYTE_ENCODING &&
+      !object->IsOneByteRepresentation()) {
+    ChangeEncoding();
+  }
+  if (!EscapedLengthIfCurrentPartFits(object->length())) return false;
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    SerializeConsString_<uint8_t>(*object);
+  } else {
+    SerializeConsString_<base::uc16>(*object);
+  }
+  return true;
+}
+
 void JsonStringifier::SerializeString(Handle<String> object) {
+  if (object->IsConsString() && !object->IsFlat() &&
+      TrySerializeConsString(object)) {
+    return;
+  }
   object = String::Flatten(isolate_, object);
   if (encoding_ == String::ONE_BYTE_ENCODING) {
     if (String::IsOneByteRepresentationUnderneath(*object)) {
@@ -1330,6 +1499,14 @@ void JsonStringifier::SerializeString(Handle<String> object) {
 }
 
 void JsonStringifier::Extend() {
+  if (output_stream_writer_) {
+    // Streamed output does not need to fit into a single string, so empty the
+    // current buffer instead of growing it. The buffer still grows if that
+    // made no progress, e.g. when a single string does not fit into it.
+    int buffered = current_index_;
+    WriteToOutputStream();
+    if (current_index_ < buffered) return;
+  }
   if (part_length_ >= String::kMaxLength) overflowed_ = true;
   part_length_ *= kPartLengthGrowthFactor;
   if (encoding_ == String::ONE_BYTE_ENCODING) {
@@ -1349,6 +1526,48 @@ void JsonStringifier::Extend() {
   }
 }
 
+void JsonStringifier::WriteToOutputStream() {
+  DCHECK_NOT_NULL(output_stream_writer_);
+  int length = current_index_;
+  int remaining = 0;
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    for (int i = 0; i < length; i++) {
+      uint8_t c = one_byte_ptr_[i];
+      if (c <= unibrow::Utf8::kMaxOneByteChar) {
+        output_stream_writer_->AddCharacter(static_cast<char>(c));
+      } else {
+        output_stream_writer_->AddCharacter(static_cast<char>(0xC0 | (c >> 6)));
+        output_stream_writer_->AddCharacter(
+            static_cast<char>(0x80 | (c & 0x3F)));
+      }
+    }
+  } else {
+    // Lone surrogates are always escaped, so a trailing lead surrogate is the
+    // first half of a pair whose second half has not been appended yet.
+    if (length > 0 &&
+        unibrow::Utf16::IsLeadSurrogate(two_byte_ptr_[length - 1])) {
+      length--;
+      remaining = 1;
+    }
+    char buffer[unibrow::Utf8::kMaxEncodedSize];
+    for (int i = 0; i < length; i++) {
+      unibrow::uchar c = two_byte_ptr_[i];
+      if (unibrow::Utf16::IsLeadSurrogate(c)) {
+        DCHECK_LT(i + 1, length);
+        DCHECK(unibrow::Utf16::IsTrailSurrogate(two_byte_ptr_[i + 1]));
+        c = unibrow::Utf16::CombineSurrogatePair(c, two_byte_ptr_[++i]);
+      }
+      unsigned size = unibrow::Utf8::Encode(
+          buffer, c, unibrow::Utf16::kNoPreviousCharacter);
+      for (unsigned j = 0; j < size; j++) {
+        output_stream_writer_->AddCharacter(buffer[j]);
+      }
+    }
+    if (remaining > 0) two_byte_ptr_[0] = two_byte_ptr_[length];
+  }
+  current_index_ = remaining;
+}
+
 void JsonStringifier::ChangeEncoding() {
   encoding_ = String::TWO_BYTE_ENCODING;
   two_byte_ptr_ = new base::uc16[part_length_];
@@ -8,12 +8,22 @@
 #include "src/objects/objects.h"
 
 namespace v8 {
+
+class OutputStream;
+
 namespace internal {
 
 V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
                                                         Handle<Object> object,
                                                         Handle<Object> replacer,
                                                         Handle<Object> gap);
+
+// Serializes {object} like JsonStringify without a replacer, but writes the
+// result to {stream} as UTF-8 instead of creating a string. Returns false if
+// {object} does not serialize to anything or the stream aborted.
+V8_WARN_UNUSED_RESULT Maybe<bool> JsonStringifyToStream(
+    Isolate* isolate, Handle<Object> object, Handle<Object> gap,
+    v8::OutputStream* stream);
 }  // namespace internal
 }  // namespace v8
 
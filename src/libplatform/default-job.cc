@@ -175,7 +175,7 @@ bool DefaultJobState::CanRunFirstTask() {
   return true;
 }
 
-bool DefaultJobState::DidRunTask() {
+bool DefaultJobState::DidRunTask(bool yielded_to_other_groups) {
   size_t num_tasks_to_post = 0;
   TaskPriority priority;
   {
@@ -188,6 +188,12 @@ bool DefaultJobState::DidRunTask() {
       worker_released_condition_.NotifyOne();
       return false;
     }
+    if (yielded_to_other_groups) {
+      // Release the current worker too, but post a new one below that picks
+      // up the work once it's the turn of this worker group again.
+      --active_workers_;
+      worker_released_condition_.NotifyOne();
+    }
     // Consider |pending_tasks_| to avoid posting too many tasks.
     if (max_concurrency > active_workers_ + pending_tasks_) {
       num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
@@ -204,7 +210,7 @@ bool DefaultJobState::DidRunTask() {
     CallOnWorkerThread(priority, std::make_unique<DefaultJobWorker>(
                                      shared_from_this(), job_task_.get()));
   }
-  return true;
+  return !yielded_to_other_groups;
 }
 
 size_t DefaultJobState::CappedMaxConcurrency(size_t worker_count) const {
@@ -225,8 +231,23 @@ void DefaultJobState::CallOnWorkerThread(TaskPriority priority,
 }
 
 void DefaultJobState::UpdatePriority(TaskPriority priority) {
-  base::MutexGuard guard(&mutex_);
-  priority_ = priority;
+  size_t num_tasks_to_post = 0;
+  {
+    base::MutexGuard guard(&mutex_);
+    // Worker tasks that are still queued at the old, lower priority would only
+    // run once all work of their new priority is done. Post as many workers
+    // at the new priority; whichever tasks run last will find no work left.
+    if (priority > priority_ &&
+        !is_canceled_.load(std::memory_order_relaxed)) {
+      num_tasks_to_post = pending_tasks_;
+      pending_tasks_ += num_tasks_to_post;
+    }
+    priority_ = priority;
+  }
+  for (size_t i = 0; i < num_tasks_to_post; ++i) {
+    CallOnWorkerThread(priority, std::make_unique<DefaultJobWorker>(
+                                     shared_from_this(), job_task_.get()));
+  }
 }
 
 DefaultJobHandle::DefaultJobHandle(std::shared_ptr<DefaultJobState> state)
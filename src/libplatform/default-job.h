@@ -12,6 +12,7 @@
 #include "include/v8-platform.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/libplatform/default-worker-threads-task-runner.h"
 
 namespace v8 {
 namespace platform {
@@ -36,11 +37,17 @@ class V8_PLATFORM_EXPORT DefaultJobState
       // Thread-safe but may return an outdated result.
       was_told_to_yield_ |=
           outer_->is_canceled_.load(std::memory_order_relaxed);
+      if (!was_told_to_yield_ && !is_joining_thread_ &&
+          DefaultWorkerThreadsTaskRunner::ShouldYieldToOtherGroups()) {
+        was_told_to_yield_ = yielded_to_other_groups_ = true;
+      }
       return was_told_to_yield_;
     }
     uint8_t GetTaskId() override;
     bool IsJoiningThread() const override { return is_joining_thread_; }
 
+    bool yielded_to_other_groups() const { return yielded_to_other_groups_; }
+
    private:
     static constexpr uint8_t kInvalidTaskId =
         std::numeric_limits<uint8_t>::max();
@@ -49,6 +56,7 @@ class V8_PLATFORM_EXPORT DefaultJobState
     uint8_t task_id_ = kInvalidTaskId;
     bool is_joining_thread_;
     bool was_told_to_yield_ = false;
+    bool yielded_to_other_groups_ = false;
   };
 
   DefaultJobState(Platform* platform, std::unique_ptr<JobTask> job_task,
@@ -69,8 +77,9 @@ class V8_PLATFORM_EXPORT DefaultJobState
   // false if it should return.
   bool CanRunFirstTask();
   // Must be called after running |job_task_|. Returns true if the worker thread
-  // must contribute again, or false if it should return.
-  bool DidRunTask();
+  // must contribute again, or false if it should return. A worker that yielded
+  // to other worker groups returns and leaves its work to a new worker task.
+  bool DidRunTask(bool yielded_to_other_groups = false);
 
   void UpdatePriority(TaskPriority);
 
@@ -140,12 +149,14 @@ class DefaultJobWorker : public Task {
     auto shared_state = state_.lock();
     if (!shared_state) return;
     if (!shared_state->CanRunFirstTask()) return;
+    bool yielded_to_other_groups;
     do {
       // Scope of |delegate| must not outlive DidRunTask() so that associated
       // state is freed before the worker becomes inactive.
       DefaultJobState::JobDelegate delegate(shared_state.get());
       job_task_->Run(&delegate);
-    } while (shared_state->DidRunTask());
+      yielded_to_other_groups = delegate.yielded_to_other_groups();
+    } while (shared_state->DidRunTask(yielded_to_other_groups));
   }
 
  private:
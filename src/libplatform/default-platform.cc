@@ -92,6 +92,25 @@ void NotifyIsolateShutdown(v8::Platform* platform, Isolate* isolate) {
   static_cast<DefaultPlatform*>(platform)->NotifyIsolateShutdown(isolate);
 }
 
+int NewWorkerGroup(v8::Platform* platform) {
+  return static_cast<DefaultPlatform*>(platform)->NewWorkerGroup();
+}
+
+void SetWorkerGroup(v8::Platform* platform, v8::Isolate* isolate, int group) {
+  static_cast<DefaultPlatform*>(platform)->SetWorkerGroup(isolate, group);
+}
+
+WorkerGroupScope::WorkerGroupScope(v8::Platform* platform,
+                                   v8::Isolate* isolate)
+    : previous_group_(DefaultWorkerThreadsTaskRunner::CurrentGroup()) {
+  DefaultWorkerThreadsTaskRunner::SetCurrentGroup(
+      static_cast<DefaultPlatform*>(platform)->GetWorkerGroup(isolate));
+}
+
+WorkerGroupScope::~WorkerGroupScope() {
+  DefaultWorkerThreadsTaskRunner::SetCurrentGroup(previous_group_);
+}
+
 DefaultPlatform::DefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
     std::unique_ptr<v8::TracingController> tracing_controller,
@@ -169,6 +188,7 @@ bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate,
   std::unique_ptr<Task> task = task_runner->PopTaskFromQueue(wait_for_work);
   if (!task) return failed_result;
 
+  WorkerGroupScope worker_group_scope(this, isolate);
   DefaultForegroundTaskRunner::RunTaskScope scope(task_runner);
   task->Run();
   return true;
@@ -189,6 +209,7 @@ void DefaultPlatform::RunIdleTasks(v8::Isolate* isolate,
   double deadline_in_seconds =
       MonotonicallyIncreasingTime() + idle_time_in_seconds;
 
+  WorkerGroupScope worker_group_scope(this, isolate);
   while (deadline_in_seconds > MonotonicallyIncreasingTime()) {
     std::unique_ptr<IdleTask> task = task_runner->PopTaskFromIdleQueue();
     if (!task) return;
@@ -221,7 +242,9 @@ void DefaultPlatform::PostTaskOnWorkerThreadImpl(
   //   and posting a background task.
   int index = priority_to_index(priority);
   DCHECK_NOT_NULL(worker_threads_task_runners_[index]);
-  worker_threads_task_runners_[index]->PostTask(std::move(task));
+  // Without PriorityMode::kApply, tasks of all priorities share one runner,
+  // which runs them in order of priority.
+  worker_threads_task_runners_[index]->PostTask(std::move(task), priority);
 }
 
 void DefaultPlatform::PostDelayedTaskOnWorkerThreadImpl(
@@ -234,8 +257,8 @@ void DefaultPlatform::PostDelayedTaskOnWorkerThreadImpl(
   //   and posting a background task.
   int index = priority_to_index(priority);
   DCHECK_NOT_NULL(worker_threads_task_runners_[index]);
-  worker_threads_task_runners_[index]->PostDelayedTask(std::move(task),
-                                                       delay_in_seconds);
+  worker_threads_task_runners_[index]->PostDelayedTask(
+      std::move(task), delay_in_seconds, priority);
 }
 
 bool DefaultPlatform::IdleTasksEnabled(Isolate* isolate) {
@@ -297,9 +320,36 @@ void DefaultPlatform::NotifyIsolateShutdown(Isolate* isolate) {
       taskrunner = it->second;
       foreground_task_runner_map_.erase(it);
     }
+    worker_group_map_.erase(isolate);
   }
   taskrunner->Terminate();
 }
 
+int DefaultPlatform::NewWorkerGroup() {
+  base::MutexGuard guard(&lock_);
+  CHECK_LT(num_worker_groups_, DefaultWorkerThreadsTaskRunner::kMaxGroups);
+  return num_worker_groups_++;
+}
+
+void DefaultPlatform::SetWorkerGroup(Isolate* isolate, int group) {
+  base::MutexGuard guard(&lock_);
+  CHECK_LE(0, group);
+  CHECK_LT(group, num_worker_groups_);
+  if (group == DefaultWorkerThreadsTaskRunner::kDefaultGroup) {
+    worker_group_map_.erase(isolate);
+  } else {
+    worker_group_map_[isolate] = group;
+  }
+}
+
+int DefaultPlatform::GetWorkerGroup(Isolate* isolate) {
+  base::MutexGuard guard(&lock_);
+  auto it = worker_group_map_.find(isolate);
+  if (it == worker_group_map_.end()) {
+    return DefaultWorkerThreadsTaskRunner::kDefaultGroup;
+  }
+  return it->second;
+}
+
 }  // namespace platform
 }  // namespace v8
@@ -75,6 +75,10 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
 
   void NotifyIsolateShutdown(Isolate* isolate);
 
+  int NewWorkerGroup();
+  void SetWorkerGroup(Isolate* isolate, int group);
+  int GetWorkerGroup(Isolate* isolate);
+
  private:
   base::Thread::Priority priority_from_index(int i) const {
     if (priority_mode_ == PriorityMode::kDontApply) {
@@ -108,6 +112,9 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
       [static_cast<int>(TaskPriority::kMaxPriority) + 1] = {0};
   std::map<v8::Isolate*, std::shared_ptr<DefaultForegroundTaskRunner>>
       foreground_task_runner_map_;
+  // Isolates in other than the default worker group.
+  std::map<v8::Isolate*, int> worker_group_map_;
+  int num_worker_groups_ = 1;
 
   std::unique_ptr<TracingController> tracing_controller_;
   std::unique_ptr<PageAllocator> page_allocator_;
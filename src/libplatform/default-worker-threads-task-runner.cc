@@ -4,16 +4,53 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
+#include <algorithm>
+
 #include "src/base/platform/time.h"
 #include "src/libplatform/delayed-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
+namespace {
+
+// The worker thread the current thread runs, across all runners.
+thread_local base::Thread* current_worker_thread = nullptr;
+// The worker group of the tasks that the current thread posts. Worker threads
+// use the group of the task they run.
+thread_local int current_worker_group =
+    DefaultWorkerThreadsTaskRunner::kDefaultGroup;
+
+}  // namespace
+
+// static
+int DefaultWorkerThreadsTaskRunner::CurrentGroup() {
+  return current_worker_group;
+}
+
+// static
+void DefaultWorkerThreadsTaskRunner::SetCurrentGroup(int group) {
+  DCHECK_LE(0, group);
+  DCHECK_GT(kMaxGroups, group);
+  current_worker_group = group;
+}
+
+// static
+bool DefaultWorkerThreadsTaskRunner::ShouldYieldToOtherGroups() {
+  if (current_worker_thread == nullptr) return false;
+  WorkerThread* worker = static_cast<WorkerThread*>(current_worker_thread);
+  return worker->runner()->ShouldYield(current_worker_group);
+}
+
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
     uint32_t thread_pool_size, TimeFunction time_function,
     base::Thread::Priority priority)
-    : queue_(time_function), time_function_(time_function) {
+    : time_function_(time_function) {
+  // Workers that start up steal from the pool, so don't let them see it
+  // before it is complete.
+  base::MutexGuard guard(&lock_);
+  groups_[kDefaultGroup] = std::make_unique<Group>(time_function);
+  num_groups_.store(1, std::memory_order_release);
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
     thread_pool_.push_back(std::make_unique<WorkerThread>(this, priority));
   }
@@ -28,35 +65,59 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
 void DefaultWorkerThreadsTaskRunner::Terminate() {
   {
     base::MutexGuard guard(&lock_);
-    terminated_ = true;
-    queue_.Terminate();
+    terminated_.store(true, std::memory_order_relaxed);
+    for (int i = 0; i < num_groups_.load(std::memory_order_relaxed); ++i) {
+      groups_[i]->queue.Terminate();
+    }
     idle_threads_.clear();
+    num_idle_threads_.store(0, std::memory_order_relaxed);
   }
   // Clearing the thread pool lets all worker threads join.
   thread_pool_.clear();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.Append(std::move(task));
-
-  if (!idle_threads_.empty()) {
-    idle_threads_.back()->Notify();
-    idle_threads_.pop_back();
-  }
+  PostTask(std::move(task), TaskPriority::kUserVisible);
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.AppendDelayed(std::move(task), delay_in_seconds);
+  PostDelayedTask(std::move(task), delay_in_seconds,
+                  TaskPriority::kUserVisible);
+}
 
-  if (!idle_threads_.empty()) {
-    idle_threads_.back()->Notify();
-    idle_threads_.pop_back();
+void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task,
+                                              TaskPriority priority) {
+  WorkerThread* worker = CurrentWorker();
+  if (worker && num_groups_.load(std::memory_order_relaxed) == 1) {
+    if (terminated_.load(std::memory_order_relaxed)) return;
+    worker->PushLocal(GroupTask{std::move(task), current_worker_group},
+                      priority);
+    // Pairs with the fence in GetNext(): Either an idle thread sees the task
+    // when it looks for work, or we see the idle thread here.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_idle_threads_.load(std::memory_order_relaxed) == 0) return;
+    base::MutexGuard guard(&lock_);
+    NotifyIdleThread();
+    return;
   }
+
+  base::MutexGuard guard(&lock_);
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  Group* group = EnsureCurrentGroup();
+  group->queue.Append(std::move(task), priority);
+  group->has_tasks.store(true, std::memory_order_relaxed);
+  NotifyIdleThread();
+}
+
+void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
+                                                     double delay_in_seconds,
+                                                     TaskPriority priority) {
+  base::MutexGuard guard(&lock_);
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  EnsureCurrentGroup()->queue.AppendDelayed(std::move(task), delay_in_seconds,
+                                            priority);
+  NotifyIdleThread();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostIdleTask(
@@ -70,6 +131,197 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
+DefaultWorkerThreadsTaskRunner::WorkerThread*
+DefaultWorkerThreadsTaskRunner::CurrentWorker() const {
+  if (current_worker_thread == nullptr) return nullptr;
+  WorkerThread* worker = static_cast<WorkerThread*>(current_worker_thread);
+  return worker->runner() == this ? worker : nullptr;
+}
+
+DefaultWorkerThreadsTaskRunner::Group*
+DefaultWorkerThreadsTaskRunner::EnsureCurrentGroup() {
+  const int group = current_worker_group;
+  const int num_groups = num_groups_.load(std::memory_order_relaxed);
+  if (group >= num_groups) {
+    for (int i = num_groups; i <= group; ++i) {
+      groups_[i] = std::make_unique<Group>(time_function_);
+    }
+    // Pairs with the acquire load in ShouldYield().
+    num_groups_.store(group + 1, std::memory_order_release);
+  }
+  return groups_[group].get();
+}
+
+DelayedTaskQueue::MaybeNextTask
+DefaultWorkerThreadsTaskRunner::TryGetNextShared(int* group_index) {
+  const int num_groups = num_groups_.load(std::memory_order_relaxed);
+  // Of the groups with tasks of the highest priority, pick the one that runs
+  // the fewest tasks, starting the search after the last group picked.
+  int best = -1;
+  TaskPriority best_priority = TaskPriority::kBestEffort;
+  int best_running = 0;
+  for (int n = 0; n < num_groups; ++n) {
+    const int i = (next_group_ + n) % num_groups;
+    Group* group = groups_[i].get();
+    group->queue.PromoteDelayedTasks();
+    const bool has_tasks = group->queue.HasImmediateTasks();
+    group->has_tasks.store(has_tasks, std::memory_order_relaxed);
+    if (!has_tasks) continue;
+    const TaskPriority priority = group->queue.HighestPriority();
+    const int running = group->num_running.load(std::memory_order_relaxed);
+    if (best == -1 || priority > best_priority ||
+        (priority == best_priority && running < best_running)) {
+      best = i;
+      best_priority = priority;
+      best_running = running;
+    }
+  }
+  if (best != -1) {
+    next_group_ = (best + 1) % num_groups;
+    *group_index = best;
+    Group* group = groups_[best].get();
+    DelayedTaskQueue::MaybeNextTask next_task = group->queue.TryGetNext();
+    DCHECK_EQ(DelayedTaskQueue::MaybeNextTask::kTask, next_task.state);
+    group->has_tasks.store(group->queue.HasImmediateTasks(),
+                           std::memory_order_relaxed);
+    return next_task;
+  }
+
+  // No group has immediate tasks, so wait for the earliest delayed task.
+  DelayedTaskQueue::MaybeNextTask result{
+      DelayedTaskQueue::MaybeNextTask::kTerminated, {}, {}};
+  for (int i = 0; i < num_groups; ++i) {
+    DelayedTaskQueue::MaybeNextTask next_task = groups_[i]->queue.TryGetNext();
+    switch (next_task.state) {
+      case DelayedTaskQueue::MaybeNextTask::kTask:
+        // A delayed task became due in the meantime.
+        *group_index = i;
+        groups_[i]->has_tasks.store(groups_[i]->queue.HasImmediateTasks(),
+                                    std::memory_order_relaxed);
+        return next_task;
+      case DelayedTaskQueue::MaybeNextTask::kWaitDelayed:
+        if (result.state != DelayedTaskQueue::MaybeNextTask::kWaitDelayed ||
+            next_task.wait_time < result.wait_time) {
+          result = std::move(next_task);
+        }
+        break;
+      case DelayedTaskQueue::MaybeNextTask::kWaitIndefinite:
+        if (result.state == DelayedTaskQueue::MaybeNextTask::kTerminated) {
+          result = std::move(next_task);
+        }
+        break;
+      case DelayedTaskQueue::MaybeNextTask::kTerminated:
+        break;
+    }
+  }
+  return result;
+}
+
+bool DefaultWorkerThreadsTaskRunner::ShouldYield(int group) const {
+  const int num_groups = num_groups_.load(std::memory_order_acquire);
+  if (num_groups == 1 || group >= num_groups) return false;
+  const int running =
+      groups_[group]->num_running.load(std::memory_order_relaxed);
+  // Leave some slack so that two groups don't keep yielding to each other.
+  for (int i = 0; i < num_groups; ++i) {
+    if (i == group) continue;
+    const Group& other = *groups_[i];
+    if (other.has_tasks.load(std::memory_order_relaxed) &&
+        other.num_running.load(std::memory_order_relaxed) + 1 < running) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void DefaultWorkerThreadsTaskRunner::UpdateSharedPriority() {
+  TaskPriority priority = TaskPriority::kBestEffort;
+  for (int i = 0; i < num_groups_.load(std::memory_order_relaxed); ++i) {
+    priority = std::max(priority, groups_[i]->queue.HighestPriority());
+  }
+  shared_priority_.store(priority, std::memory_order_relaxed);
+}
+
+DefaultWorkerThreadsTaskRunner::GroupTask
+DefaultWorkerThreadsTaskRunner::GetNext(WorkerThread* worker) {
+  if (!terminated_.load(std::memory_order_relaxed)) {
+    GroupTask task =
+        worker->PopLocal(shared_priority_.load(std::memory_order_relaxed));
+    if (task.task) return task;
+  }
+
+  base::MutexGuard guard(&lock_);
+  while (true) {
+    int group = kDefaultGroup;
+    DelayedTaskQueue::MaybeNextTask next_task = TryGetNextShared(&group);
+    UpdateSharedPriority();
+    if (next_task.state == DelayedTaskQueue::MaybeNextTask::kTask) {
+      return GroupTask{std::move(next_task.task), group};
+    }
+    if (next_task.state == DelayedTaskQueue::MaybeNextTask::kTerminated) {
+      return GroupTask{};
+    }
+
+    // Announce that this thread is about to go idle before looking at the
+    // local queues, see PostTask().
+    idle_threads_.push_back(worker);
+    num_idle_threads_.store(idle_threads_.size(), std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (GroupTask task = Steal(worker); task.task) {
+      RemoveIdleThread(worker);
+      return task;
+    }
+
+    if (next_task.state == DelayedTaskQueue::MaybeNextTask::kWaitIndefinite) {
+      worker->Wait(&lock_);
+    } else {
+      DCHECK_EQ(DelayedTaskQueue::MaybeNextTask::kWaitDelayed,
+                next_task.state);
+      // WaitFor unfortunately doesn't care about our fake time and will wait
+      // the 'real' amount of time, based on whatever clock the system call
+      // uses.
+      worker->WaitFor(&lock_, next_task.wait_time);
+    }
+    // A thread that timed out or was woken up spuriously is still in the list.
+    RemoveIdleThread(worker);
+  }
+}
+
+DefaultWorkerThreadsTaskRunner::GroupTask
+DefaultWorkerThreadsTaskRunner::Steal(WorkerThread* thief) {
+  for (const std::unique_ptr<WorkerThread>& worker : thread_pool_) {
+    if (worker.get() == thief) continue;
+    if (GroupTask task = worker->StealLocal(); task.task) return task;
+  }
+  // A thread may also have posted to its own queue right before going idle.
+  return thief->PopLocal();
+}
+
+void DefaultWorkerThreadsTaskRunner::RunTask(GroupTask task) {
+  DCHECK_LT(task.group, num_groups_.load(std::memory_order_relaxed));
+  std::atomic<int>& num_running = groups_[task.group]->num_running;
+  num_running.fetch_add(1, std::memory_order_relaxed);
+  current_worker_group = task.group;
+  task.task->Run();
+  current_worker_group = kDefaultGroup;
+  num_running.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void DefaultWorkerThreadsTaskRunner::NotifyIdleThread() {
+  UpdateSharedPriority();
+  if (idle_threads_.empty()) return;
+  idle_threads_.back()->Notify();
+  idle_threads_.pop_back();
+  num_idle_threads_.store(idle_threads_.size(), std::memory_order_relaxed);
+}
+
+void DefaultWorkerThreadsTaskRunner::RemoveIdleThread(WorkerThread* worker) {
+  idle_threads_.erase(
+      std::remove(idle_threads_.begin(), idle_threads_.end(), worker),
+      idle_threads_.end());
+  num_idle_threads_.store(idle_threads_.size(), std::memory_order_relaxed);
+}
+
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
     DefaultWorkerThreadsTaskRunner* runner, base::Thread::Priority priority)
     : Thread(
@@ -84,37 +336,62 @@ DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() {
 }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
-  base::MutexGuard guard(&runner_->lock_);
+  current_worker_thread = this;
   while (true) {
-    DelayedTaskQueue::MaybeNextTask next_task = runner_->queue_.TryGetNext();
-    switch (next_task.state) {
-      case DelayedTaskQueue::MaybeNextTask::kTask:
-        runner_->lock_.Unlock();
-        next_task.task->Run();
-        runner_->lock_.Lock();
-        continue;
-      case DelayedTaskQueue::MaybeNextTask::kTerminated:
-        return;
-      case DelayedTaskQueue::MaybeNextTask::kWaitIndefinite:
-        runner_->idle_threads_.push_back(this);
-        condition_var_.Wait(&runner_->lock_);
-        continue;
-      case DelayedTaskQueue::MaybeNextTask::kWaitDelayed:
-        // WaitFor unfortunately doesn't care about our fake time and will wait
-        // the 'real' amount of time, based on whatever clock the system call
-        // uses.
-        runner_->idle_threads_.push_back(this);
-        bool notified =
-            condition_var_.WaitFor(&runner_->lock_, next_task.wait_time);
-        USE(notified);
-        continue;
-    }
+    GroupTask task = runner_->GetNext(this);
+    if (!task.task) break;
+    runner_->RunTask(std::move(task));
   }
+  current_worker_thread = nullptr;
 }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Notify() {
   condition_var_.NotifyAll();
 }
 
+void DefaultWorkerThreadsTaskRunner::WorkerThread::Wait(base::Mutex* mutex) {
+  condition_var_.Wait(mutex);
+}
+
+void DefaultWorkerThreadsTaskRunner::WorkerThread::WaitFor(
+    base::Mutex* mutex, base::TimeDelta wait_time) {
+  bool notified = condition_var_.WaitFor(mutex, wait_time);
+  USE(notified);
+}
+
+void DefaultWorkerThreadsTaskRunner::WorkerThread::PushLocal(
+    GroupTask task, TaskPriority priority) {
+  base::MutexGuard guard(&local_lock_);
+  local_queues_[static_cast<int>(priority)].push_back(std::move(task));
+}
+
+DefaultWorkerThreadsTaskRunner::GroupTask
+DefaultWorkerThreadsTaskRunner::WorkerThread::PopLocal(
+    TaskPriority min_priority) {
+  base::MutexGuard guard(&local_lock_);
+  for (int i = static_cast<int>(TaskPriority::kMaxPriority);
+       i >= static_cast<int>(min_priority); --i) {
+    std::deque<GroupTask>& local_queue = local_queues_[i];
+    if (local_queue.empty()) continue;
+    GroupTask task = std::move(local_queue.front());
+    local_queue.pop_front();
+    return task;
+  }
+  return GroupTask{};
+}
+
+DefaultWorkerThreadsTaskRunner::GroupTask
+DefaultWorkerThreadsTaskRunner::WorkerThread::StealLocal() {
+  base::MutexGuard guard(&local_lock_);
+  for (int i = static_cast<int>(TaskPriority::kMaxPriority); i >= 0; --i) {
+    std::deque<GroupTask>& local_queue = local_queues_[i];
+    if (local_queue.empty()) continue;
+    GroupTask task = std::move(local_queue.back());
+    local_queue.pop_back();
+    return task;
+  }
+  return GroupTask{};
+}
+
 }  // namespace platform
 }  // namespace v8
@@ -5,6 +5,8 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -18,11 +20,35 @@
 namespace v8 {
 namespace platform {
 
+// Runs tasks on a pool of worker threads. Tasks that are posted from a worker
+// thread of the runner itself, e.g. the workers a job spawns from within a
+// job worker, are queued on that thread without touching the shared queue.
+// Idle workers steal from the local queues of other workers. Within each
+// queue, tasks of higher priority run first.
+//
+// Tasks belong to the worker group of the thread that posts them, see
+// v8::platform::WorkerGroupScope. Each group has its own shared queue. Among
+// the groups that have tasks of the highest priority, the one that runs the
+// fewest tasks goes first, and a job worker yields if its group runs more
+// tasks than another group with queued tasks. Once there is more than one
+// group, tasks posted from worker threads go to the shared queue of their
+// group, so that they can't bypass this.
 class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     : public NON_EXPORTED_BASE(TaskRunner) {
  public:
   using TimeFunction = double (*)();
 
+  static constexpr int kDefaultGroup = 0;
+  static constexpr int kMaxGroups = 32;
+
+  // The worker group of the tasks posted from the current thread.
+  static int CurrentGroup();
+  static void SetCurrentGroup(int group);
+
+  // Returns whether the task that runs on the current thread should return
+  // early, since its group gets more than its fair share of the workers.
+  static bool ShouldYieldToOtherGroups();
+
   DefaultWorkerThreadsTaskRunner(
       uint32_t thread_pool_size, TimeFunction time_function,
       base::Thread::Priority priority = base::Thread::Priority::kDefault);
@@ -39,11 +65,21 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   void PostDelayedTask(std::unique_ptr<Task> task,
                        double delay_in_seconds) override;
 
+  void PostTask(std::unique_ptr<Task> task, TaskPriority priority);
+
+  void PostDelayedTask(std::unique_ptr<Task> task, double delay_in_seconds,
+                       TaskPriority priority);
+
   void PostIdleTask(std::unique_ptr<IdleTask> task) override;
 
   bool IdleTasksEnabled() override;
 
  private:
+  struct GroupTask {
+    std::unique_ptr<Task> task;
+    int group = kDefaultGroup;
+  };
+
   class WorkerThread : public base::Thread {
    public:
     explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner,
@@ -57,26 +93,86 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     void Run() override;
 
     void Notify();
+    void Wait(base::Mutex* mutex);
+    void WaitFor(base::Mutex* mutex, base::TimeDelta wait_time);
+
+    void PushLocal(GroupTask task, TaskPriority priority);
+    // Takes the oldest task of the highest priority of the local queue, unless
+    // that priority is below |min_priority|.
+    GroupTask PopLocal(TaskPriority min_priority = TaskPriority::kBestEffort);
+    // Takes the most recent task of the highest priority of the local queue,
+    // which the owning thread would get to last among them.
+    GroupTask StealLocal();
+
+    DefaultWorkerThreadsTaskRunner* runner() const { return runner_; }
 
    private:
     DefaultWorkerThreadsTaskRunner* runner_;
     base::ConditionVariable condition_var_;
+    base::Mutex local_lock_;
+    // Indexed by TaskPriority.
+    std::deque<GroupTask>
+        local_queues_[static_cast<int>(TaskPriority::kMaxPriority) + 1];
   };
 
-  // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
-  // executed. Blocks if no task is available.
-  std::unique_ptr<Task> GetNext();
+  struct Group {
+    explicit Group(TimeFunction time_function) : queue(time_function) {}
+
+    DelayedTaskQueue queue;
+    // Whether {queue} has immediate tasks, and the number of workers that run
+    // tasks of this group. Both are read without {lock_}.
+    std::atomic<bool> has_tasks{false};
+    std::atomic<int> num_running{0};
+  };
 
-  bool terminated_ = false;
+  // Returns the worker thread of this runner that is the current thread, if
+  // any.
+  WorkerThread* CurrentWorker() const;
+
+  // Called by the WorkerThread. Gets the next task (delayed or immediate) to
+  // be executed. Blocks if no task is available and returns an empty task
+  // once the runner is terminated.
+  GroupTask GetNext(WorkerThread* worker);
+  void RunTask(GroupTask task);
+
+  // Takes a task from the local queue of any worker other than {thief}.
+  // Requires {lock_}.
+  GroupTask Steal(WorkerThread* thief);
+
+  // Returns the group of the current thread, creating it if necessary.
+  // Requires {lock_}.
+  Group* EnsureCurrentGroup();
+  // Takes the next task from the shared queue of the group whose turn it is,
+  // or returns how long to wait for one. Requires {lock_}.
+  DelayedTaskQueue::MaybeNextTask TryGetNextShared(int* group);
+  bool ShouldYield(int group) const;
+  // Requires {lock_}.
+  void UpdateSharedPriority();
+
+  // Wakes up the most recently idle thread and updates {shared_priority_}.
+  // Requires {lock_}.
+  void NotifyIdleThread();
+  void RemoveIdleThread(WorkerThread* worker);
+
+  std::atomic<bool> terminated_{false};
   base::Mutex lock_;
   // Vector of idle threads -- these are pushed in LIFO order, so that the most
   // recently active thread is the first to be reactivated.
   std::vector<WorkerThread*> idle_threads_;
+  // The size of {idle_threads_}, which tasks posted to local queues check
+  // without {lock_} to see whether some thread needs to be woken up.
+  std::atomic<size_t> num_idle_threads_{0};
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
-  // Worker threads access this queue, so we can only destroy it after all
-  // workers stopped.
-  DelayedTaskQueue queue_;
-  std::queue<std::unique_ptr<Task>> task_queue_;
+  // Worker threads access these queues, so we can only destroy them after all
+  // workers stopped. Groups are created on demand and never removed, so the
+  // first {num_groups_} entries can be read without {lock_}.
+  std::unique_ptr<Group> groups_[kMaxGroups];
+  std::atomic<int> num_groups_{0};
+  // The group after the one that got the last task from the shared queues.
+  int next_group_ = 0;
+  // The highest priority of the tasks in the shared queues, which workers
+  // check without {lock_} to see whether their local tasks go first.
+  std::atomic<TaskPriority> shared_priority_{TaskPriority::kBestEffort};
   TimeFunction time_function_;
 };
 
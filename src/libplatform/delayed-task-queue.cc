@@ -4,6 +4,8 @@
 
 #include "src/libplatform/delayed-task-queue.h"
 
+#include <algorithm>
+
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
 #include "src/base/platform/time.h"
@@ -16,40 +18,55 @@ DelayedTaskQueue::DelayedTaskQueue(TimeFunction time_function)
 
 DelayedTaskQueue::~DelayedTaskQueue() {
   DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+#ifdef DEBUG
+  for (const auto& task_queue : task_queues_) DCHECK(task_queue.empty());
+#endif  // DEBUG
 }
 
 double DelayedTaskQueue::MonotonicallyIncreasingTime() {
   return time_function_();
 }
 
-void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
+void DelayedTaskQueue::Append(std::unique_ptr<Task> task,
+                              TaskPriority priority) {
   DCHECK(!terminated_);
-  task_queue_.push(std::move(task));
+  task_queues_[static_cast<int>(priority)].push(std::move(task));
 }
 
 void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
-                                     double delay_in_seconds) {
+                                     double delay_in_seconds,
+                                     TaskPriority priority) {
   DCHECK_GE(delay_in_seconds, 0.0);
   double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
-  {
-    DCHECK(!terminated_);
-    delayed_task_queue_.emplace(deadline, std::move(task));
+  DCHECK(!terminated_);
+  delayed_task_heap_.push_back(DelayedEntry{
+      deadline, next_sequence_++, DelayedTask{std::move(task), priority}});
+  SiftUp(delayed_task_heap_.size() - 1);
+}
+
+TaskPriority DelayedTaskQueue::HighestPriority() const {
+  for (int i = kNumPriorities - 1; i > 0; --i) {
+    if (!task_queues_[i].empty()) return static_cast<TaskPriority>(i);
   }
+  return TaskPriority::kBestEffort;
+}
+
+bool DelayedTaskQueue::HasImmediateTasks() const {
+  for (const auto& task_queue : task_queues_) {
+    if (!task_queue.empty()) return true;
+  }
+  return false;
 }
 
 DelayedTaskQueue::MaybeNextTask DelayedTaskQueue::TryGetNext() {
   for (;;) {
-    // Move delayed tasks that have hit their deadline to the main queue.
     double now = MonotonicallyIncreasingTime();
-    for (;;) {
-      std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
-      if (!task) break;
-      task_queue_.push(std::move(task));
-    }
-    if (!task_queue_.empty()) {
-      std::unique_ptr<Task> task = std::move(task_queue_.front());
-      task_queue_.pop();
+    PromoteDelayedTasks(now);
+    for (int i = kNumPriorities - 1; i >= 0; --i) {
+      std::queue<std::unique_ptr<Task>>& task_queue = task_queues_[i];
+      if (task_queue.empty()) continue;
+      std::unique_ptr<Task> task = std::move(task_queue.front());
+      task_queue.pop();
       return {MaybeNextTask::kTask, std::move(task), {}};
     }
 
@@ -57,9 +74,9 @@ DelayedTaskQueue::MaybeNextTask DelayedTaskQueue::TryGetNext() {
       return {MaybeNextTask::kTerminated, {}, {}};
     }
 
-    if (task_queue_.empty() && !delayed_task_queue_.empty()) {
+    if (!delayed_task_heap_.empty()) {
       // Wait for the next delayed task or a newly posted task.
-      double wait_in_seconds = delayed_task_queue_.begin()->first - now;
+      double wait_in_seconds = delayed_task_heap_.front().deadline - now;
       return {
           MaybeNextTask::kWaitDelayed,
           {},
@@ -71,17 +88,62 @@ DelayedTaskQueue::MaybeNextTask DelayedTaskQueue::TryGetNext() {
   }
 }
 
+// Moves delayed tasks that have hit their deadline to the main queue.
+void DelayedTaskQueue::PromoteDelayedTasks(double now) {
+  DelayedTask delayed_task;
+  while (PopTaskFromDelayedQueue(now, &delayed_task)) {
+    task_queues_[static_cast<int>(delayed_task.priority)].push(
+        std::move(delayed_task.task));
+  }
+}
+
 // Gets the next task from the delayed queue for which the deadline has passed
-// according to |now|. Returns nullptr if no such task exists.
-std::unique_ptr<Task> DelayedTaskQueue::PopTaskFromDelayedQueue(double now) {
-  if (delayed_task_queue_.empty()) return nullptr;
+// according to |now|. Returns false if no such task exists.
+bool DelayedTaskQueue::PopTaskFromDelayedQueue(double now,
+                                               DelayedTask* result) {
+  if (delayed_task_heap_.empty()) return false;
+  if (delayed_task_heap_.front().deadline > now) return false;
+
+  *result = std::move(delayed_task_heap_.front().delayed_task);
+  if (delayed_task_heap_.size() > 1) {
+    delayed_task_heap_.front() = std::move(delayed_task_heap_.back());
+    delayed_task_heap_.pop_back();
+    SiftDown(0);
+  } else {
+    delayed_task_heap_.pop_back();
+  }
+  return true;
+}
 
-  auto it = delayed_task_queue_.begin();
-  if (it->first > now) return nullptr;
+void DelayedTaskQueue::SiftUp(size_t index) {
+  DelayedEntry entry = std::move(delayed_task_heap_[index]);
+  while (index > 0) {
+    size_t parent = (index - 1) / kHeapArity;
+    if (!(entry < delayed_task_heap_[parent])) break;
+    delayed_task_heap_[index] = std::move(delayed_task_heap_[parent]);
+    index = parent;
+  }
+  delayed_task_heap_[index] = std::move(entry);
+}
 
-  std::unique_ptr<Task> result = std::move(it->second);
-  delayed_task_queue_.erase(it);
-  return result;
+void DelayedTaskQueue::SiftDown(size_t index) {
+  const size_t size = delayed_task_heap_.size();
+  DelayedEntry entry = std::move(delayed_task_heap_[index]);
+  while (true) {
+    size_t first_child = index * kHeapArity + 1;
+    if (first_child >= size) break;
+    size_t last_child = std::min(first_child + kHeapArity, size);
+    size_t min_child = first_child;
+    for (size_t child = first_child + 1; child < last_child; ++child) {
+      if (delayed_task_heap_[child] < delayed_task_heap_[min_child]) {
+        min_child = child;
+      }
+    }
+    if (!(delayed_task_heap_[min_child] < entry)) break;
+    delayed_task_heap_[index] = std::move(delayed_task_heap_[min_child]);
+    index = min_child;
+  }
+  delayed_task_heap_[index] = std::move(entry);
 }
 
 void DelayedTaskQueue::Terminate() {
@@ -5,24 +5,23 @@
 #ifndef V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
 #define V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
 
-#include <map>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include "include/libplatform/libplatform-export.h"
+#include "include/v8-platform.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
 
 namespace v8 {
-
-class Task;
-
 namespace platform {
 
 // DelayedTaskQueue provides queueing for immediate and delayed tasks. It does
 // not provide any guarantees about ordering of tasks, except that immediate
-// tasks will be run in the order that they are posted.
+// tasks of higher priority are run first, and immediate tasks of the same
+// priority will be run in the order that they are posted.
 //
 // This class is not thread-safe, and should be guarded by a lock.
 class V8_PLATFORM_EXPORT DelayedTaskQueue {
@@ -38,13 +37,29 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   double MonotonicallyIncreasingTime();
 
   // Appends an immediate task to the queue. The queue takes ownership of
-  // |task|. Tasks appended via this method will be run in order.
-  void Append(std::unique_ptr<Task> task);
+  // |task|. Tasks appended via this method with the same |priority| will be
+  // run in order.
+  void Append(std::unique_ptr<Task> task,
+              TaskPriority priority = TaskPriority::kUserVisible);
 
   // Appends a delayed task to the queue. There is no ordering guarantee
   // provided regarding delayed tasks, both with respect to other delayed tasks
-  // and non-delayed tasks that were appended using Append().
-  void AppendDelayed(std::unique_ptr<Task> task, double delay_in_seconds);
+  // and non-delayed tasks that were appended using Append(). Once its deadline
+  // has passed, the task is queued like an immediate task of |priority|.
+  void AppendDelayed(std::unique_ptr<Task> task, double delay_in_seconds,
+                     TaskPriority priority = TaskPriority::kUserVisible);
+
+  // Returns the highest priority of the immediate tasks in the queue, or
+  // kBestEffort if there are none.
+  TaskPriority HighestPriority() const;
+
+  // Returns whether there are immediate tasks in the queue.
+  bool HasImmediateTasks() const;
+
+  // Queues the delayed tasks whose deadline has passed like immediate tasks.
+  void PromoteDelayedTasks() {
+    PromoteDelayedTasks(MonotonicallyIncreasingTime());
+  }
 
   struct MaybeNextTask {
     enum { kTask, kWaitIndefinite, kWaitDelayed, kTerminated } state;
@@ -62,10 +77,39 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   void Terminate();
 
  private:
-  std::unique_ptr<Task> PopTaskFromDelayedQueue(double now);
+  static constexpr int kNumPriorities =
+      static_cast<int>(TaskPriority::kMaxPriority) + 1;
+
+  struct DelayedTask {
+    std::unique_ptr<Task> task;
+    TaskPriority priority = TaskPriority::kUserVisible;
+  };
+
+  struct DelayedEntry {
+    double deadline;
+    // Orders tasks with the same deadline by posting order.
+    uint64_t sequence;
+    DelayedTask delayed_task;
+
+    bool operator<(const DelayedEntry& other) const {
+      if (deadline != other.deadline) return deadline < other.deadline;
+      return sequence < other.sequence;
+    }
+  };
+
+  // The delayed tasks form a 4-ary min-heap, which is shallower than a binary
+  // heap and keeps the children of a node in one cache line.
+  static constexpr size_t kHeapArity = 4;
+
+  void PromoteDelayedTasks(double now);
+  bool PopTaskFromDelayedQueue(double now, DelayedTask* result);
+  void SiftUp(size_t index);
+  void SiftDown(size_t index);
 
-  std::queue<std::unique_ptr<Task>> task_queue_;
-  std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
+  // Indexed by TaskPriority.
+  std::queue<std::unique_ptr<Task>> task_queues_[kNumPriorities];
+  std::vector<DelayedEntry> delayed_task_heap_;
+  uint64_t next_sequence_ = 0;
   bool terminated_ = false;
   TimeFunction time_function_;
 };
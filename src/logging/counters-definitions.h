@@ -53,6 +53,13 @@ namespace internal {
   HR(compile_script_cache_behaviour, V8.CompileScript.CacheBehaviour, 0, 20,   \
      21)                                                                       \
   HR(wasm_memory_allocation_result, V8.WasmMemoryAllocationResult, 0, 3, 4)    \
+  /* Invocation count of a function when it is marked for optimization. */     \
+  HR(tiering_invocations_to_maglev, V8.TieringInvocationsToMaglev, 1, 100000,  \
+     50)                                                                       \
+  HR(tiering_invocations_to_turbofan, V8.TieringInvocationsToTurbofan, 1,      \
+     100000, 50)                                                               \
+  /* Reason of eager deopts that invalidated optimized code. */                \
+  HR(deopt_reason, V8.DeoptReason, 0, 127, 128)                                \
   /* Committed code size per module, collected on GC. */                       \
   HR(wasm_module_code_size_mb, V8.WasmModuleCodeSizeMiB, 0, 1024, 64)          \
   /* Percent of freed code size per module, collected on GC. */                \
@@ -217,6 +224,13 @@ namespace internal {
   HT(gc_time_to_safepoint, V8.GC.TimeToSafepoint, 10000000, MICROSECOND)       \
   HT(gc_time_to_collection_on_background, V8.GC.TimeToCollectionOnBackground,  \
      10000000, MICROSECOND)                                                    \
+  /* Concurrent Sparkplug timers. */                                           \
+  HT(sparkplug_concurrent_prepare, V8.SparkplugConcurrentPrepare, 100000,      \
+     MICROSECOND)                                                              \
+  HT(sparkplug_concurrent_execute, V8.SparkplugConcurrentExecute, 1000000,     \
+     MICROSECOND)                                                              \
+  HT(sparkplug_concurrent_install, V8.SparkplugConcurrentInstall, 100000,      \
+     MICROSECOND)                                                              \
   /* Maglev timers. */                                                         \
   HT(maglev_optimize_prepare, V8.MaglevOptimizePrepare, 100000, MICROSECOND)   \
   HT(maglev_optimize_execute, V8.MaglevOptimizeExecute, 100000, MICROSECOND)   \
@@ -362,7 +376,13 @@ namespace internal {
      V8.GCCompactorCausedByOldspaceExhaustion)                                 \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
+  SC(icu_object_cache_hits, V8.ICUObjectCacheHits)                             \
+  SC(icu_object_cache_misses, V8.ICUObjectCacheMisses)                         \
+  SC(shared_constant_pools, V8.SharedConstantPools)                            \
   SC(maps_created, V8.MapsCreated)                                             \
+  SC(feedback_vectors_created, V8.FeedbackVectorsCreated)                      \
+  SC(feedback_vectors_bytes, V8.FeedbackVectorsBytes)                          \
+  SC(feedback_vectors_delayed_by_size, V8.FeedbackVectorsDelayedBySize)        \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
@@ -384,6 +404,7 @@ namespace internal {
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                      \
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)           \
+  SC(wasm_lazily_deserialized_functions, V8.WasmLazilyDeserializedFunctions)   \
   SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)
 
 // List of counters that can be incremented from generated code. We need them in
@@ -39,6 +39,7 @@
 #include "src/objects/api-callbacks.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/code.h"
+#include "src/objects/script.h"
 #include "src/profiler/tick-sample.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/strings/string-stream.h"
@@ -2282,6 +2283,42 @@ void V8FileLogger::SetCodeEventHandler(uint32_t options,
   }
 }
 
+void V8FileLogger::SetPerfJitLogging(bool enabled) {
+#if V8_OS_LINUX
+  if (enabled == (perf_jit_logger_ != nullptr)) return;
+  if (!enabled) {
+    RemoveLogEventListener(perf_jit_logger_.get());
+    perf_jit_logger_.reset();
+    isolate_->UpdateLogObjectRelocation();
+    return;
+  }
+
+#if V8_ENABLE_WEBASSEMBLY
+  wasm::GetWasmEngine()->EnableCodeLogging(isolate_);
+#endif  // V8_ENABLE_WEBASSEMBLY
+  perf_jit_logger_ = std::make_unique<LinuxPerfJitLogger>(isolate_);
+  AddLogEventListener(perf_jit_logger_.get());
+  // Code compaction is not disabled, so the logger needs code move events.
+  isolate_->UpdateLogObjectRelocation();
+  HandleScope scope(isolate_);
+  // Scripts only get line ends for their debug info on creation if
+  // --perf-prof is given.
+  std::vector<Handle<Script>> scripts;
+  {
+    Script::Iterator iterator(isolate_);
+    for (Script script = iterator.Next(); !script.is_null();
+         script = iterator.Next()) {
+      scripts.push_back(handle(script, isolate_));
+    }
+  }
+  for (Handle<Script> script : scripts) Script::InitLineEnds(isolate_, script);
+  ExistingCodeLogger existing_code_logger(isolate_, perf_jit_logger_.get());
+  existing_code_logger.LogBuiltins();
+  existing_code_logger.LogCodeObjects();
+  existing_code_logger.LogCompiledFunctions(false);
+#endif  // V8_OS_LINUX
+}
+
 sampler::Sampler* V8FileLogger::sampler() { return ticker_.get(); }
 std::string V8FileLogger::file_name() const { return log_.get()->file_name(); }
 
@@ -130,6 +130,10 @@ class V8FileLogger : public LogEventListener {
   // Sets the current code event handler.
   void SetCodeEventHandler(uint32_t options, JitCodeEventHandler event_handler);
 
+  // Starts or stops writing the jitdump file of --perf-prof. When started,
+  // the existing code is written as well.
+  V8_EXPORT_PRIVATE void SetPerfJitLogging(bool enabled);
+
 #if defined(V8_OS_WIN) && defined(V8_ENABLE_ETW_STACK_WALKING)
   void SetEtwCodeEventHandler(uint32_t options);
   void ResetEtwCodeEventHandler();
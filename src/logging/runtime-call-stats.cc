@@ -352,6 +352,78 @@ WorkerThreadRuntimeCallStatsScope::~WorkerThreadRuntimeCallStatsScope() {
   }
 }
 
+class RuntimeCallStatsSampler::SamplingThread final : public base::Thread {
+ public:
+  static const int kSamplingThreadStackSize = 64 * KB;
+
+  SamplingThread(RuntimeCallStatsSampler* sampler, int interval_microseconds)
+      : base::Thread(base::Thread::Options("v8:RuntimeCallStatsSampler",
+                                           kSamplingThreadStackSize)),
+        sampler_(sampler),
+        interval_microseconds_(interval_microseconds) {}
+
+  void Run() override {
+    while (sampler_->IsActive()) {
+      sampler_->DoSample();
+      base::OS::Sleep(
+          base::TimeDelta::FromMicroseconds(interval_microseconds_));
+    }
+  }
+
+ private:
+  RuntimeCallStatsSampler* const sampler_;
+  const int interval_microseconds_;
+};
+
+RuntimeCallStatsSampler::RuntimeCallStatsSampler(RuntimeCallStats* stats,
+                                                 int interval_microseconds)
+    : stats_(stats), interval_microseconds_(interval_microseconds) {
+  DCHECK_GT(interval_microseconds, 0);
+}
+
+RuntimeCallStatsSampler::~RuntimeCallStatsSampler() {
+  if (IsActive()) StopSampling();
+}
+
+void RuntimeCallStatsSampler::StartSampling() {
+  DCHECK(!IsActive());
+  active_.store(true, std::memory_order_relaxed);
+  sampling_thread_ =
+      std::make_unique<SamplingThread>(this, interval_microseconds_);
+  CHECK(sampling_thread_->StartSynchronously());
+}
+
+void RuntimeCallStatsSampler::StopSampling() {
+  DCHECK(IsActive());
+  active_.store(false, std::memory_order_relaxed);
+  sampling_thread_->Join();
+  sampling_thread_.reset();
+}
+
+void RuntimeCallStatsSampler::DoSample() {
+  // The counters live in the table itself, so the current counter can be read
+  // racily without the sampled thread having to synchronize with us.
+  RuntimeCallCounter* counter = stats_->current_counter();
+  total_samples_.fetch_add(1, std::memory_order_relaxed);
+  if (counter == nullptr) return;
+  ptrdiff_t index = counter - stats_->GetCounter(0);
+  DCHECK_LT(index, RuntimeCallStats::kNumberOfCounters);
+  samples_[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+void RuntimeCallStatsSampler::TakeSamples(
+    v8::metrics::RuntimeCallStatsSampled* event) {
+  event->sampling_interval_in_us = interval_microseconds_;
+  event->total_sample_count =
+      total_samples_.exchange(0, std::memory_order_relaxed);
+  event->counters.clear();
+  for (int i = 0; i < RuntimeCallStats::kNumberOfCounters; ++i) {
+    int64_t samples = samples_[i].exchange(0, std::memory_order_relaxed);
+    if (samples == 0) continue;
+    event->counters.push_back({stats_->GetCounter(i)->name(), samples});
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
 
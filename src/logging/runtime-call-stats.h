@@ -9,6 +9,10 @@
 
 #ifdef V8_RUNTIME_CALL_STATS
 
+#include <atomic>
+#include <memory>
+
+#include "include/v8-metrics.h"
 #include "src/base/atomic-utils.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
@@ -171,7 +175,9 @@ class RuntimeCallTimer final {
   V(Isolate_DateTimeConfigurationChangeNotification)       \
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
+  V(JSON_StreamingParse)                                   \
   V(JSON_Stringify)                                        \
+  V(JSON_StringifyToStream)                                \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
   V(Map_Delete)                                            \
@@ -725,6 +731,42 @@ class V8_EXPORT_PRIVATE V8_NODISCARD WorkerThreadRuntimeCallStatsScope final {
   RuntimeCallStats* table_ = nullptr;
 };
 
+// Periodically reads the current counter of a RuntimeCallStats table from a
+// separate thread and attributes a sample to it. With --rcs-sampling the
+// timers are not started, so that the only cost on the sampled thread is
+// keeping track of the current counter. This is cheap enough to be left on in
+// production, and the samples are reported via v8::metrics.
+class V8_EXPORT_PRIVATE RuntimeCallStatsSampler final {
+ public:
+  RuntimeCallStatsSampler(RuntimeCallStats* stats, int interval_microseconds);
+  ~RuntimeCallStatsSampler();
+  RuntimeCallStatsSampler(const RuntimeCallStatsSampler&) = delete;
+  RuntimeCallStatsSampler& operator=(const RuntimeCallStatsSampler&) = delete;
+
+  void StartSampling();
+  void StopSampling();
+  bool IsActive() const { return active_.load(std::memory_order_relaxed); }
+
+  void DoSample();
+
+  int64_t Samples(RuntimeCallCounterId counter_id) const {
+    return samples_[static_cast<int>(counter_id)].load(
+        std::memory_order_relaxed);
+  }
+  // Moves the samples taken since the last call into |event|.
+  void TakeSamples(v8::metrics::RuntimeCallStatsSampled* event);
+
+ private:
+  class SamplingThread;
+
+  RuntimeCallStats* const stats_;
+  const int interval_microseconds_;
+  std::atomic<bool> active_{false};
+  std::unique_ptr<SamplingThread> sampling_thread_;
+  std::atomic<int64_t> total_samples_{0};
+  std::atomic<int64_t> samples_[RuntimeCallStats::kNumberOfCounters] = {};
+};
+
 #define CHANGE_CURRENT_RUNTIME_COUNTER(runtime_call_stats, counter_id) \
   do {                                                                 \
     if (V8_UNLIKELY(TracingFlags::is_runtime_stats_enabled()) &&       \
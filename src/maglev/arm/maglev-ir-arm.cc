@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "include/v8-fast-api-calls.h"
 #include "src/base/logging.h"
 #include "src/codegen/arm/assembler-arm.h"
 #include "src/codegen/arm/register-arm.h"
@@ -664,6 +665,94 @@ void Float64Ieee754Unary::GenerateCode(MaglevAssembler* masm,
   __ MovFromFloatResult(out);
 }
 
+namespace {
+
+// The slots holding the options and the data, see
+// CallFastApiFunction::GenerateCode.
+constexpr int kFastApiOptionsStackSlots = 4;
+
+}  // namespace
+
+int CallFastApiFunction::MaxCallStackArgs() const {
+  // The slot holding the receiver and the options.
+  return c_signature_->HasOptions() ? 1 + kFastApiOptionsStackSlots : 1;
+}
+void CallFastApiFunction::GenerateCode(MaglevAssembler* masm,
+                                       const ProcessingState& state) {
+  FrameScope frame_scope(masm, StackFrame::MANUAL);
+  MaglevAssembler::ScratchRegisterScope temps(masm);
+  const bool has_options = c_signature_->HasOptions();
+  Register options = no_reg;
+  if (has_options) {
+    options = CArgumentRegister(num_args() + 1);
+    temps.SetAvailable(temps.Available() - options);
+  }
+  Register target = temps.Acquire();
+  Register scratch = temps.Acquire();
+  const int num_arguments = num_c_args();
+
+  if (has_options) {
+    // The options are initialized like Turbofan does, with their data being
+    // a v8::Local, i.e. the address of a slot holding the data.
+    if (data_.IsSmi()) {
+      __ Move(scratch, Smi::FromInt(data_.AsSmi()));
+    } else {
+      __ Move(scratch, data_.AsHeapObject().object());
+    }
+    __ push(scratch);
+    __ mov(scratch, sp);
+    __ mov(target, Operand(0));
+    __ push(target);   // wasm_memory
+    __ push(scratch);  // data
+    __ push(target);   // fallback
+  }
+  // The receiver is passed as a v8::Local, i.e. as the address of a slot
+  // holding it.
+  DCHECK_EQ(arg_reg_1, ToRegister(receiver()));
+  __ push(arg_reg_1);
+  __ mov(arg_reg_1, sp);
+  if (has_options) __ add(options, sp, Operand(kSystemPointerSize));
+  __ PrepareCallCFunction(num_arguments, 0);
+
+  // Let the CPU profiler attribute ticks to the C function.
+  ExternalReference c_function =
+      ExternalReference::Create(c_function_, ExternalReference::FAST_C_CALL);
+  __ Move(target, c_function);
+  ExternalReference target_address =
+      ExternalReference::fast_api_call_target_address(masm->isolate());
+  __ str(target, __ ExternalReferenceAsOperand(target_address, scratch));
+  __ CallCFunction(target, num_arguments);
+  __ mov(target, Operand(0));
+  __ str(target, __ ExternalReferenceAsOperand(target_address, scratch));
+
+  DoubleRegister result = ToDoubleRegister(this->result());
+  switch (c_signature_->ReturnInfo().GetType()) {
+    case CTypeInfo::Type::kBool:
+      __ uxtb(kReturnRegister0, kReturnRegister0);
+      __ Int32ToDouble(result, kReturnRegister0);
+      break;
+    case CTypeInfo::Type::kInt32:
+      __ Int32ToDouble(result, kReturnRegister0);
+      break;
+    default:
+      DCHECK_EQ(CTypeInfo::Type::kVoid, c_signature_->ReturnInfo().GetType());
+      __ Move(result, 0.0);
+      break;
+  }
+  if (has_options) {
+    Label done;
+    __ ldrb(scratch, MemOperand(sp, kSystemPointerSize));
+    __ cmp(scratch, Operand(0));
+    __ b(eq, &done);
+    __ Move(result, Float64::FromBits(kHoleNanInt64));
+    __ bind(&done);
+    __ add(sp, sp,
+           Operand((1 + kFastApiOptionsStackSlots) * kSystemPointerSize));
+  } else {
+    __ add(sp, sp, Operand(kSystemPointerSize));
+  }
+}
+
 void CheckJSTypedArrayBounds::SetValueLocationConstraints() {
   UseRegister(receiver_input());
   if (ElementsKindSize(elements_kind_) == 1) {
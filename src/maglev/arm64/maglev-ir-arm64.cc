@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "include/v8-fast-api-calls.h"
 #include "src/base/logging.h"
 #include "src/codegen/arm64/assembler-arm64-inl.h"
 #include "src/codegen/arm64/register-arm64.h"
@@ -572,6 +573,94 @@ void Float64Ieee754Unary::GenerateCode(MaglevAssembler* masm,
   __ CallCFunction(ieee_function_, 1);
 }
 
+namespace {
+
+// The slots holding the options and the data, see
+// CallFastApiFunction::GenerateCode.
+constexpr int kFastApiOptionsStackSlots = 4;
+
+}  // namespace
+
+int CallFastApiFunction::MaxCallStackArgs() const {
+  // The slot holding the receiver, padded to keep the stack aligned, or
+  // followed by the options.
+  return c_signature_->HasOptions() ? 2 + kFastApiOptionsStackSlots : 2;
+}
+void CallFastApiFunction::GenerateCode(MaglevAssembler* masm,
+                                       const ProcessingState& state) {
+  AllowExternalCallThatCantCauseGC scope(masm);
+  MaglevAssembler::ScratchRegisterScope temps(masm);
+  const bool has_options = c_signature_->HasOptions();
+  Register options = no_reg;
+  if (has_options) {
+    options = CArgumentRegister(num_args() + 1);
+    temps.SetAvailable(temps.Available() - options);
+  }
+  Register target = temps.Acquire();
+  Register scratch = temps.Acquire();
+  const int num_arguments = num_c_args();
+
+  // The receiver is passed as a v8::Local, i.e. as the address of a slot
+  // holding it.
+  DCHECK_EQ(arg_reg_1, ToRegister(receiver()));
+  if (has_options) {
+    // The options are initialized like Turbofan does, with their data being
+    // a v8::Local, i.e. the address of a slot holding the data. They are
+    // pushed so that the fallback field ends up right above the receiver.
+    if (data_.IsSmi()) {
+      __ Move(scratch, Smi::FromInt(data_.AsSmi()));
+    } else {
+      __ Move(scratch, data_.AsHeapObject().object());
+    }
+    __ Push(padreg, scratch);
+    __ Mov(scratch, sp);
+    // wasm_memory and data.
+    __ Push(xzr, scratch);
+    // fallback and the receiver.
+    __ Push(xzr, arg_reg_1);
+    __ Mov(arg_reg_1, sp);
+    __ Add(options, sp, kSystemPointerSize);
+  } else {
+    __ Push(padreg, arg_reg_1);
+    __ Mov(arg_reg_1, sp);
+  }
+
+  // Let the CPU profiler attribute ticks to the C function.
+  ExternalReference c_function =
+      ExternalReference::Create(c_function_, ExternalReference::FAST_C_CALL);
+  __ Mov(target, c_function);
+  ExternalReference target_address =
+      ExternalReference::fast_api_call_target_address(masm->isolate());
+  __ Str(target, __ ExternalReferenceAsOperand(target_address, scratch));
+  __ CallCFunction(target, num_arguments, 0);
+  __ Str(xzr, __ ExternalReferenceAsOperand(target_address, scratch));
+
+  DoubleRegister result = ToDoubleRegister(this->result());
+  switch (c_signature_->ReturnInfo().GetType()) {
+    case CTypeInfo::Type::kBool:
+      __ Uxtb(kReturnRegister0.W(), kReturnRegister0.W());
+      __ Int32ToDouble(result, kReturnRegister0);
+      break;
+    case CTypeInfo::Type::kInt32:
+      __ Int32ToDouble(result, kReturnRegister0);
+      break;
+    default:
+      DCHECK_EQ(CTypeInfo::Type::kVoid, c_signature_->ReturnInfo().GetType());
+      __ Move(result, 0.0);
+      break;
+  }
+  if (has_options) {
+    Label done;
+    __ Ldrb(scratch.W(), MemOperand(sp, kSystemPointerSize));
+    __ Cbz(scratch.W(), &done);
+    __ Move(result, Float64::FromBits(kHoleNanInt64));
+    __ bind(&done);
+    __ Drop(2 + kFastApiOptionsStackSlots);
+  } else {
+    __ Drop(2);
+  }
+}
+
 void CheckJSTypedArrayBounds::SetValueLocationConstraints() {
   UseRegister(receiver_input());
   if (ElementsKindSize(elements_kind_) == 1) {
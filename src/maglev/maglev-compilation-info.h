@@ -43,6 +43,18 @@ class MaglevCodeGenerator;
   V(print_maglev_graph)                 \
   V(trace_maglev_regalloc)
 
+// Counters gathered by the register allocator, reported through
+// MaglevPipelineStatistics.
+struct MaglevRegallocStatistics {
+  // Values assigned a spill slot.
+  size_t spills = 0;
+  // Gap moves from a spill slot into a register.
+  size_t reloads = 0;
+  // Values reloaded into a register on a loop back-edge, i.e. on every
+  // iteration.
+  size_t back_edge_reloads = 0;
+};
+
 class MaglevCompilationInfo final {
  public:
   static std::unique_ptr<MaglevCompilationInfo> New(Isolate* isolate,
@@ -78,6 +90,10 @@ class MaglevCompilationInfo final {
   void set_code_generator(std::unique_ptr<MaglevCodeGenerator> code_generator);
   MaglevCodeGenerator* code_generator() const { return code_generator_.get(); }
 
+  MaglevRegallocStatistics& regalloc_statistics() {
+    return regalloc_statistics_;
+  }
+
   // Flag accessors (for thread-safe access to global flags).
   // TODO(v8:7700): Consider caching these.
 #define V(Name) \
@@ -129,6 +145,7 @@ class MaglevCompilationInfo final {
 
   // Produced off-thread during ExecuteJobImpl.
   std::unique_ptr<MaglevCodeGenerator> code_generator_;
+  MaglevRegallocStatistics regalloc_statistics_;
 
 #define V(Name) const bool Name##_;
   MAGLEV_COMPILATION_FLAG_LIST(V)
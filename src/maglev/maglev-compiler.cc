@@ -38,6 +38,7 @@
 #include "src/maglev/maglev-interpreter-frame-state.h"
 #include "src/maglev/maglev-ir-inl.h"
 #include "src/maglev/maglev-ir.h"
+#include "src/maglev/maglev-loop-invariant-code-motion.h"
 #include "src/maglev/maglev-phi-representation-selector.h"
 #include "src/maglev/maglev-regalloc-data.h"
 #include "src/maglev/maglev-regalloc.h"
@@ -412,6 +413,19 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
       }
     }
 
+    if (v8_flags.maglev_licm) {
+      TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                   "V8.Maglev.LoopInvariantCodeMotion");
+
+      MaglevLoopInvariantCodeMotion licm(compilation_info, graph);
+      licm.Run();
+
+      if (v8_flags.print_maglev_graphs) {
+        std::cout << "\nAfter loop invariant code motion" << std::endl;
+        PrintGraph(std::cout, compilation_info, graph);
+      }
+    }
+
     if (v8_flags.maglev_untagged_phis) {
       TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                    "V8.Maglev.PhiUntagging");
@@ -521,6 +535,11 @@ MaybeHandle<Code> MaglevCompiler::GenerateCode(
     }
   }
 
+  compilation_info->toplevel_compilation_unit()
+      ->shared_function_info()
+      .object()
+      ->set_maglev_compiled(true);
+
   if (v8_flags.print_maglev_code) {
     code->Print();
   }
@@ -133,6 +133,10 @@ CompilationJob::Status MaglevCompilationJob::ExecuteJobImpl(
   if (!maglev::MaglevCompiler::Compile(local_isolate, info())) {
     return CompilationJob::FAILED;
   }
+  if (V8_UNLIKELY(pipeline_statistics_ != nullptr)) {
+    pipeline_statistics_->RecordRegallocStatistics(
+        info()->regalloc_statistics());
+  }
   EndPhaseKind();
   // TODO(v8:7700): Actual return codes.
   return CompilationJob::SUCCEEDED;
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <limits>
 
+#include "include/v8-fast-api-calls.h"
 #include "src/base/logging.h"
 #include "src/base/optional.h"
 #include "src/base/v8-fallthrough.h"
@@ -20,11 +21,13 @@
 #include "src/compiler/access-info.h"
 #include "src/compiler/bytecode-liveness-map.h"
 #include "src/compiler/compilation-dependencies.h"
+#include "src/compiler/fast-api-calls.h"
 #include "src/compiler/feedback-source.h"
 #include "src/compiler/heap-refs.h"
 #include "src/compiler/js-heap-broker-inl.h"
 #include "src/compiler/processed-feedback.h"
 #include "src/deoptimizer/deoptimize-reason.h"
+#include "src/execution/simulator-base.h"
 #include "src/flags/flags.h"
 #include "src/handles/maybe-handles-inl.h"
 #include "src/ic/handler-configuration-inl.h"
@@ -3802,6 +3805,36 @@ void MaglevGraphBuilder::BuildStoreReceiverMap(ValueNode* receiver,
   }
 }
 
+bool MaglevGraphBuilder::CanStoreToSharedObjectWithoutSharing(
+    ValueNode* value) {
+  // Int32 and Uint32 values are tagged with a Smi check, which only fails if
+  // they overflowed the Smi range.
+  switch (value->properties().value_representation()) {
+    case ValueRepresentation::kInt32:
+    case ValueRepresentation::kUint32:
+      return true;
+    case ValueRepresentation::kFloat64:
+    case ValueRepresentation::kHoleyFloat64:
+      return false;
+    case ValueRepresentation::kWord64:
+      UNREACHABLE();
+    case ValueRepresentation::kTagged:
+      return CheckType(value, NodeType::kSmi);
+  }
+}
+
+// static
+bool MaglevGraphBuilder::StoresToSharedObject(
+    compiler::PropertyAccessInfo const& access_info) {
+  for (compiler::MapRef map : access_info.lookup_start_object_maps()) {
+    if (InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(map.instance_type())) {
+      DCHECK(!access_info.HasTransitionMap());
+      return true;
+    }
+  }
+  return false;
+}
+
 ReduceResult MaglevGraphBuilder::TryBuildStoreField(
     compiler::PropertyAccessInfo const& access_info, ValueNode* receiver,
     compiler::AccessMode access_mode) {
@@ -3830,7 +3863,17 @@ ReduceResult MaglevGraphBuilder::TryBuildStoreField(
   }
 
   ValueNode* value;
-  if (field_representation.IsDouble()) {
+  if (access_mode == compiler::AccessMode::kStore &&
+      StoresToSharedObject(access_info)) {
+    // Only Smis are stored to objects in shared space, which don't need a
+    // write barrier.
+    DCHECK(field_representation.IsTagged());
+    DCHECK(CanStoreToSharedObjectWithoutSharing(GetRawAccumulator()));
+    value = GetAccumulatorSmi();
+    BuildStoreTaggedFieldNoWriteBarrier(store_target, value,
+                                        field_index.offset());
+    return ReduceResult::Done();
+  } else if (field_representation.IsDouble()) {
     value = GetAccumulatorFloat64();
     if (access_info.HasTransitionMap()) {
       // Allocate the mutable double box owned by the field.
@@ -4045,12 +4088,13 @@ ReduceResult MaglevGraphBuilder::TryBuildNamedAccess(
     for (compiler::MapRef map : inferred_maps) {
       if (map.is_deprecated()) continue;
 
-      // TODO(v8:12547): Support writing to objects in shared space, which
-      // need a write barrier that calls Object::Share to ensure the RHS is
-      // shared.
+      // TODO(v8:12547): Support writing arbitrary values to objects in shared
+      // space, which need a write barrier that calls Object::Share to ensure
+      // the RHS is shared. Smis are always shared.
       if (InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(
               map.instance_type()) &&
-          access_mode == compiler::AccessMode::kStore) {
+          access_mode == compiler::AccessMode::kStore &&
+          !CanStoreToSharedObjectWithoutSharing(GetRawAccumulator())) {
         return ReduceResult::Fail();
       }
 
@@ -5506,12 +5550,19 @@ ReduceResult MaglevGraphBuilder::BuildInlined(ValueNode* context,
 
 bool MaglevGraphBuilder::ShouldInlineCall(
     compiler::SharedFunctionInfoRef shared,
-    compiler::OptionalFeedbackVectorRef feedback_vector, float call_frequency) {
+    compiler::OptionalFeedbackVectorRef feedback_vector, float call_frequency,
+    bool has_unboxed_float64_args) {
   if (graph()->total_inlined_bytecode_size() >
       v8_flags.max_maglev_inlined_bytecode_size_cumulative) {
     TRACE_CANNOT_INLINE("maximum inlined bytecode size");
     return false;
   }
+  if (inlining_depth() > v8_flags.max_maglev_hard_inline_depth) {
+    TRACE_CANNOT_INLINE("inlining depth ("
+                        << inlining_depth() << ") >= hard-max-depth ("
+                        << v8_flags.max_maglev_hard_inline_depth << ")");
+    return false;
+  }
   if (!feedback_vector) {
     // TODO(verwaest): Soft deopt instead?
     TRACE_CANNOT_INLINE("it has not been compiled/run with feedback yet");
@@ -5551,14 +5602,28 @@ bool MaglevGraphBuilder::ShouldInlineCall(
         break;
     }
   }
-  if (call_frequency < v8_flags.min_maglev_inlining_frequency) {
+  const bool is_small_function =
+      bytecode.length() < v8_flags.max_maglev_inlined_bytecode_size_small;
+  // A call passes its arguments tagged, so unboxed float64 arguments would need
+  // a HeapNumber allocation each, and the result would likely be unboxed again
+  // by the caller. Inlining small numeric helpers avoids that, even on
+  // infrequent calls.
+  const bool avoids_boxing = is_small_function && has_unboxed_float64_args &&
+                             v8_flags.maglev_inline_unboxed_calls;
+  if (call_frequency < v8_flags.min_maglev_inlining_frequency &&
+      !avoids_boxing) {
     TRACE_CANNOT_INLINE("call frequency ("
                         << call_frequency << ") < minimum threshold ("
                         << v8_flags.min_maglev_inlining_frequency << ")");
     return false;
   }
-  if (bytecode.length() < v8_flags.max_maglev_inlined_bytecode_size_small) {
-    TRACE_INLINING("  inlining " << shared << ": small function");
+  if (is_small_function) {
+    TRACE_INLINING("  inlining " << shared << ": small function"
+                                 << (avoids_boxing ? " with unboxed arguments"
+                                                   : ""));
+    // Small functions are not bound by the soft depth limit, but still count
+    // towards the cumulative budget.
+    graph()->add_inlined_bytecode_size(bytecode.length());
     return true;
   }
   if (bytecode.length() > v8_flags.max_maglev_inlined_bytecode_size) {
@@ -5594,9 +5659,21 @@ ReduceResult MaglevGraphBuilder::TryBuildInlinedCall(
         broker()->GetFeedbackForCall(feedback_source);
     feedback_frequency =
         feedback.IsInsufficient() ? 0.0f : feedback.AsCall().frequency();
+  } else {
+    // Calls without call feedback (e.g. getter and setter calls of monomorphic
+    // property accesses) happen whenever the current bytecode executes.
+    feedback_frequency = 1.0f;
   }
   float call_frequency = feedback_frequency * call_frequency_;
-  if (!ShouldInlineCall(shared, feedback_vector, call_frequency)) {
+  bool has_unboxed_float64_args = false;
+  for (size_t i = 0; i < args.count(); i++) {
+    if (IsDoubleRepresentation(args[i]->properties().value_representation())) {
+      has_unboxed_float64_args = true;
+      break;
+    }
+  }
+  if (!ShouldInlineCall(shared, feedback_vector, call_frequency,
+                        has_unboxed_float64_args)) {
     return ReduceResult::Fail();
   }
 
@@ -6532,6 +6609,116 @@ bool MaglevGraphBuilder::TargetIsCurrentCompilingUnit(
          compilation_unit_->info()->toplevel_function()->shared();
 }
 
+namespace {
+
+bool CanCallFastApiFunction(const CFunctionInfo* c_signature) {
+  const int options = c_signature->HasOptions() ? 1 : 0;
+  if (static_cast<int>(c_signature->ArgumentCount()) + options >
+      CallFastApiFunction::kMaxCArgs) {
+    return false;
+  }
+  switch (c_signature->ReturnInfo().GetType()) {
+    case CTypeInfo::Type::kVoid:
+    case CTypeInfo::Type::kBool:
+    case CTypeInfo::Type::kInt32:
+      break;
+    default:
+      return false;
+  }
+  for (unsigned int i = 0; i < c_signature->ArgumentCount(); ++i) {
+    CTypeInfo type = c_signature->ArgumentInfo(i);
+    if (type.GetSequenceType() != CTypeInfo::SequenceType::kScalar ||
+        type.GetFlags() != CTypeInfo::Flags::kNone) {
+      return false;
+    }
+    if (i == 0) {
+      if (type.GetType() != CTypeInfo::Type::kV8Value) return false;
+    } else if (type.GetType() != CTypeInfo::Type::kInt32 &&
+               type.GetType() != CTypeInfo::Type::kUint32) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+template <typename SlowCallFunction>
+ReduceResult MaglevGraphBuilder::TryBuildCallFastApiFunction(
+    compiler::FunctionTemplateInfoRef api_callback, compiler::ObjectRef data,
+    ValueNode* receiver, CallArguments& args,
+    const SlowCallFunction& build_slow_call) {
+  if (!v8_flags.maglev_fast_api_calls) return ReduceResult::Fail();
+  // Resolve the overloads by their number of arguments like Turbofan does.
+  // Overloads with the same number of arguments are resolved on whether an
+  // argument is a JSArray or a typed array, which Maglev doesn't pass to C
+  // functions.
+  compiler::FastApiCallFunctionVector candidates =
+      compiler::fast_api_call::CanOptimizeFastCall(broker(), zone(),
+                                                   api_callback, args.count());
+  if (candidates.size() != 1) return ReduceResult::Fail();
+  Address c_function = candidates[0].address;
+  const CFunctionInfo* c_signature = candidates[0].signature;
+  if (!CanCallFastApiFunction(c_signature)) return ReduceResult::Fail();
+
+  const int num_args = static_cast<int>(c_signature->ArgumentCount()) - 1;
+  DCHECK_LE(num_args, static_cast<int>(args.count()));
+  // Without call feedback, only convert arguments that are known to be
+  // numbers, so that the conversions can't deopt.
+  for (int i = 0; i < num_args; i++) {
+    if (args[i]->properties().value_representation() ==
+            ValueRepresentation::kTagged &&
+        !CheckType(args[i], NodeType::kNumber)) {
+      return ReduceResult::Fail();
+    }
+  }
+
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  broker()->isolate()->simulator_data()->RegisterFunctionsAndSignatures(
+      &c_function, &c_signature, 1);
+#endif  // V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+
+  ValueNode* result = AddNewNode<CallFastApiFunction>(
+      num_args + CallFastApiFunction::kFixedInputCount,
+      [&](CallFastApiFunction* call) {
+        for (int i = 0; i < num_args; i++) {
+          call->set_arg(i, GetTruncatedInt32ForToNumber(
+                               args[i], ToNumberHint::kAssumeNumber));
+        }
+      },
+      api_callback, c_function, c_signature, data, receiver);
+  auto convert_return_value = [&]() -> ValueNode* {
+    switch (c_signature->ReturnInfo().GetType()) {
+      case CTypeInfo::Type::kVoid:
+        return GetRootConstant(RootIndex::kUndefinedValue);
+      case CTypeInfo::Type::kBool:
+        return AddNewNode<Int32GreaterThan>(
+            {AddNewNode<TruncateFloat64ToInt32>({result}),
+             GetInt32Constant(0)});
+      case CTypeInfo::Type::kInt32:
+        return AddNewNode<TruncateFloat64ToInt32>({result});
+      default:
+        UNREACHABLE();
+    }
+  };
+  if (!c_signature->HasOptions()) return convert_return_value();
+
+  // The C function returns the hole NaN if it requested the fallback, in
+  // which case the regular API callback is called instead, like in Turbofan.
+  MaglevSubGraphBuilder sub_builder(this, 1);
+  MaglevSubGraphBuilder::Variable var_result(0);
+  MaglevSubGraphBuilder::Label fallback(&sub_builder, 1);
+  MaglevSubGraphBuilder::Label done(&sub_builder, 2, {&var_result});
+  sub_builder.GotoIfTrue<BranchIfFloat64IsHole>(&fallback, {result});
+  sub_builder.set(var_result, GetTaggedValue(convert_return_value()));
+  sub_builder.Goto(&done);
+  sub_builder.Bind(&fallback);
+  sub_builder.set(var_result, build_slow_call());
+  sub_builder.Goto(&done);
+  sub_builder.Bind(&done);
+  return sub_builder.get(var_result);
+}
+
 ReduceResult MaglevGraphBuilder::ReduceCallForApiFunction(
     compiler::FunctionTemplateInfoRef api_callback,
     compiler::OptionalSharedFunctionInfoRef maybe_shared,
@@ -6561,20 +6748,26 @@ ReduceResult MaglevGraphBuilder::ReduceCallForApiFunction(
     CHECK_NOT_NULL(receiver);
   }
 
-  CallKnownApiFunction::Mode mode =
-      broker()->dependencies()->DependOnNoProfilingProtector()
-          ? CallKnownApiFunction::kNoProfiling
-          : CallKnownApiFunction::kGeneric;
+  auto build_slow_call = [&]() -> ValueNode* {
+    CallKnownApiFunction::Mode mode =
+        broker()->dependencies()->DependOnNoProfilingProtector()
+            ? CallKnownApiFunction::kNoProfiling
+            : CallKnownApiFunction::kGeneric;
 
-  return AddNewNode<CallKnownApiFunction>(
-      input_count,
-      [&](CallKnownApiFunction* call) {
-        for (int i = 0; i < static_cast<int>(args.count()); i++) {
-          call->set_arg(i, GetTaggedValue(args[i]));
-        }
-      },
-      mode, api_callback, call_handler_info, data, api_holder, GetContext(),
-      receiver);
+    return AddNewNode<CallKnownApiFunction>(
+        input_count,
+        [&](CallKnownApiFunction* call) {
+          for (int i = 0; i < static_cast<int>(args.count()); i++) {
+            call->set_arg(i, GetTaggedValue(args[i]));
+          }
+        },
+        mode, api_callback, call_handler_info, data, api_holder, GetContext(),
+        receiver);
+  };
+
+  RETURN_IF_DONE(TryBuildCallFastApiFunction(api_callback, data, receiver,
+                                             args, build_slow_call));
+  return build_slow_call();
 }
 
 ReduceResult MaglevGraphBuilder::TryBuildCallKnownApiFunction(
@@ -8352,7 +8545,8 @@ ValueNode* MaglevGraphBuilder::BuildAllocateFastObject(
       BuildAllocateFastObject(object.elements, allocation_type);
 
   DCHECK(object.map.IsJSObjectMap());
-  // TODO(leszeks): Fold allocations.
+  // The nested objects allocated above are folded into the same allocation,
+  // unless it would exceed kMaxRegularHeapObjectSize.
   ValueNode* allocation = ExtendOrReallocateCurrentRawAllocation(
       object.instance_size, allocation_type);
   BuildStoreReceiverMap(allocation, object.map);
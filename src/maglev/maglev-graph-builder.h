@@ -1585,7 +1585,7 @@ class MaglevGraphBuilder {
       const compiler::FeedbackSource& feedback_source);
   bool ShouldInlineCall(compiler::SharedFunctionInfoRef shared,
                         compiler::OptionalFeedbackVectorRef feedback_vector,
-                        float call_frequency);
+                        float call_frequency, bool has_unboxed_float64_args);
   ReduceResult TryBuildInlinedCall(
       ValueNode* context, ValueNode* function, ValueNode* new_target,
       compiler::SharedFunctionInfoRef shared,
@@ -1618,6 +1618,11 @@ class MaglevGraphBuilder {
       compiler::FunctionTemplateInfoRef api_callback,
       compiler::OptionalSharedFunctionInfoRef maybe_shared,
       compiler::OptionalJSObjectRef api_holder, CallArguments& args);
+  template <typename SlowCallFunction>
+  ReduceResult TryBuildCallFastApiFunction(
+      compiler::FunctionTemplateInfoRef api_callback, compiler::ObjectRef data,
+      ValueNode* receiver, CallArguments& args,
+      const SlowCallFunction& build_slow_call);
   ReduceResult ReduceFunctionPrototypeApplyCallWithReceiver(
       ValueNode* target_node, compiler::JSFunctionRef receiver,
       CallArguments& args, const compiler::FeedbackSource& feedback_source,
@@ -1714,6 +1719,11 @@ class MaglevGraphBuilder {
   // Returns the loaded value node but doesn't update the accumulator yet.
   ValueNode* BuildLoadField(compiler::PropertyAccessInfo const& access_info,
                             ValueNode* lookup_start_object);
+  // Whether `value` is guaranteed to be a Smi once tagged, so that it can be
+  // stored to an object in shared space without first being shared.
+  bool CanStoreToSharedObjectWithoutSharing(ValueNode* value);
+  static bool StoresToSharedObject(
+      compiler::PropertyAccessInfo const& access_info);
   ReduceResult TryBuildStoreField(
       compiler::PropertyAccessInfo const& access_info, ValueNode* receiver,
       compiler::AccessMode access_mode);
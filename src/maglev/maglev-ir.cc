@@ -6,6 +6,7 @@
 
 #include <limits>
 
+#include "include/v8-fast-api-calls.h"
 #include "src/base/bounds.h"
 #include "src/builtins/builtins-constructor.h"
 #include "src/codegen/interface-descriptors-inl.h"
@@ -580,6 +581,20 @@ void CallKnownApiFunction::MarkTaggedInputsAsDecompressing() {
   }
 }
 
+void CallFastApiFunction::VerifyInputs(
+    MaglevGraphLabeller* graph_labeller) const {
+  CheckValueInputIs(this, kReceiverIndex, ValueRepresentation::kTagged,
+                    graph_labeller);
+  for (int i = kFixedInputCount; i < input_count(); i++) {
+    CheckValueInputIs(this, i, ValueRepresentation::kInt32, graph_labeller);
+  }
+}
+
+void CallFastApiFunction::MarkTaggedInputsAsDecompressing() {
+  // The receiver is passed to the C function as a full pointer.
+  receiver().node()->SetTaggedResultNeedsDecompress();
+}
+
 void Construct::VerifyInputs(MaglevGraphLabeller* graph_labeller) const {
   for (int i = 0; i < input_count(); i++) {
     CheckValueInputIs(this, i, ValueRepresentation::kTagged, graph_labeller);
@@ -4778,6 +4793,41 @@ int CallKnownApiFunction::MaxCallStackArgs() const {
   return actual_parameter_count;
 }
 
+// The code generators build the options right above the slot holding the
+// receiver, as three words followed by the slot holding the data.
+static_assert(sizeof(FastApiCallbackOptions) == 3 * kSystemPointerSize);
+static_assert(offsetof(FastApiCallbackOptions, fallback) == 0);
+static_assert(offsetof(FastApiCallbackOptions, data) == kSystemPointerSize);
+static_assert(offsetof(FastApiCallbackOptions, wasm_memory) ==
+              2 * kSystemPointerSize);
+
+int CallFastApiFunction::num_c_args() const {
+  return num_args() + 1 + (c_signature_->HasOptions() ? 1 : 0);
+}
+
+// static
+Register CallFastApiFunction::CArgumentRegister(int index) {
+  static constexpr Register kArgRegs[] = {arg_reg_1, arg_reg_2, arg_reg_3,
+                                          arg_reg_4};
+  static_assert(arraysize(kArgRegs) == kMaxCArgs);
+  DCHECK_LT(index, kMaxCArgs);
+  return kArgRegs[index];
+}
+
+void CallFastApiFunction::SetValueLocationConstraints() {
+  DCHECK_LE(num_c_args(), kMaxCArgs);
+  UseFixed(receiver(), CArgumentRegister(0));
+  for (int i = 0; i < num_args(); i++) {
+    UseFixed(arg(i), CArgumentRegister(i + 1));
+  }
+  if (c_signature_->HasOptions()) {
+    RequireSpecificTemporary(CArgumentRegister(num_args() + 1));
+  }
+  DefineAsRegister(this);
+  // The call target, and a scratch register for storing it for the profiler.
+  set_temporaries_needed(2);
+}
+
 void CallKnownApiFunction::SetValueLocationConstraints() {
   if (api_holder_.has_value()) {
     UseAny(receiver());
@@ -6129,6 +6179,11 @@ void CallKnownApiFunction::PrintParams(
   os << ")";
 }
 
+void CallFastApiFunction::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << function_template_info_.object() << ")";
+}
+
 void CallBuiltin::PrintParams(std::ostream& os,
                               MaglevGraphLabeller* graph_labeller) const {
   os << "(" << Builtins::name(builtin()) << ")";
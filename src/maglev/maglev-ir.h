@@ -146,6 +146,7 @@ class MergePointInterpreterFrameState;
   V(CallWithArrayLike)                       \
   V(CallWithSpread)                          \
   V(CallKnownApiFunction)                    \
+  V(CallFastApiFunction)                     \
   V(CallKnownJSFunction)                     \
   V(CallSelf)                                \
   V(Construct)                               \
@@ -7285,6 +7286,80 @@ class CallKnownApiFunction : public ValueNodeT<CallKnownApiFunction> {
   const compiler::OptionalJSObjectRef api_holder_;
 };
 
+// Calls the C function of a fast API callback directly. Only signatures with
+// int32/uint32 arguments and a void, bool or int32 return value are
+// supported, so that the receiver, all arguments and the options are passed
+// in registers on all platforms. The result is the return value of the C
+// function as a float64, or the hole NaN if the C function requested a
+// fallback to the regular API callback through its options.
+class CallFastApiFunction : public ValueNodeT<CallFastApiFunction> {
+  using Base = ValueNodeT<CallFastApiFunction>;
+
+ public:
+  static constexpr int kReceiverIndex = 0;
+  static constexpr int kFixedInputCount = 1;
+
+  // The receiver, the arguments and the options must all fit into
+  // arg_reg_1..arg_reg_4.
+  static constexpr int kMaxCArgs = 4;
+  static constexpr int kMaxArgs = kMaxCArgs - 1;
+
+  // This ctor is used when for variable input counts.
+  // Inputs must be initialized manually.
+  CallFastApiFunction(uint64_t bitfield,
+                      compiler::FunctionTemplateInfoRef function_template_info,
+                      Address c_function, const CFunctionInfo* c_signature,
+                      compiler::ObjectRef data, ValueNode* receiver)
+      : Base(bitfield),
+        function_template_info_(function_template_info),
+        c_function_(c_function),
+        c_signature_(c_signature),
+        data_(data) {
+    set_input(kReceiverIndex, receiver);
+  }
+
+  // The C function can't call back into JavaScript, but it may still change
+  // any state the embedder exposes to it.
+  static constexpr OpProperties kProperties = OpProperties::HoleyFloat64() |
+                                              OpProperties::Call() |
+                                              OpProperties::CanWrite();
+
+  Input& receiver() { return input(kReceiverIndex); }
+  const Input& receiver() const { return input(kReceiverIndex); }
+  int num_args() const { return input_count() - kFixedInputCount; }
+  Input& arg(int i) { return input(i + kFixedInputCount); }
+  void set_arg(int i, ValueNode* node) {
+    set_input(i + kFixedInputCount, node);
+  }
+
+  compiler::FunctionTemplateInfoRef function_template_info() const {
+    return function_template_info_;
+  }
+  Address c_function() const { return c_function_; }
+  const CFunctionInfo* c_signature() const { return c_signature_; }
+  // The data of the API callback, passed to the C function in its options.
+  compiler::ObjectRef data() const { return data_; }
+
+  // The number of arguments of the C function, including the receiver and
+  // the options.
+  int num_c_args() const;
+  // The register holding the C argument with the given index.
+  static Register CArgumentRegister(int index);
+
+  void VerifyInputs(MaglevGraphLabeller* graph_labeller) const;
+  void MarkTaggedInputsAsDecompressing();
+  int MaxCallStackArgs() const;
+  void SetValueLocationConstraints();
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::FunctionTemplateInfoRef function_template_info_;
+  const Address c_function_;
+  const CFunctionInfo* const c_signature_;
+  const compiler::ObjectRef data_;
+};
+
 class ConstructWithSpread : public ValueNodeT<ConstructWithSpread> {
   using Base = ValueNodeT<ConstructWithSpread>;
 
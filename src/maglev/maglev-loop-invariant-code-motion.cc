@@ -0,0 +1,180 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/maglev/maglev-loop-invariant-code-motion.h"
+
+#include "src/maglev/maglev-basic-block.h"
+#include "src/maglev/maglev-compilation-info.h"
+#include "src/maglev/maglev-graph-labeller.h"
+#include "src/maglev/maglev-interpreter-frame-state.h"
+#include "src/maglev/maglev-ir-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+MaglevLoopInvariantCodeMotion::MaglevLoopInvariantCodeMotion(
+    MaglevCompilationInfo* compilation_info, Graph* graph)
+    : compilation_info_(compilation_info),
+      graph_(graph),
+      zone_(compilation_info->zone()),
+      loop_values_(compilation_info->zone()) {}
+
+void MaglevLoopInvariantCodeMotion::Run() {
+  // OSR graphs enter their outermost loop through the OSR prologue rather
+  // than through a regular pre-header.
+  if (graph_->is_osr()) return;
+
+  // Loops are contiguous in the block order, which follows the bytecode, so
+  // the body of a loop consists of the blocks from its header up to the block
+  // with the back edge.
+  for (int i = 0; i < graph_->num_blocks(); i++) {
+    BasicBlock* header = (*graph_)[i];
+    if (!header->is_loop() || header->state()->is_resumable_loop()) continue;
+    if (header->predecessor_count() != 2) continue;
+    BasicBlock* back_edge = header->predecessor_at(1);
+    for (int j = i; j < graph_->num_blocks(); j++) {
+      if ((*graph_)[j] == back_edge) {
+        ProcessLoop(i, j);
+        break;
+      }
+    }
+  }
+}
+
+void MaglevLoopInvariantCodeMotion::ProcessLoop(int header_index,
+                                                int back_edge_index) {
+  BasicBlock* header = (*graph_)[header_index];
+  BasicBlock* pre_header = header->predecessor_at(0);
+  if (!pre_header->control_node()->Is<Jump>()) return;
+
+  loop_values_.clear();
+  for (int i = header_index; i <= back_edge_index; i++) {
+    BasicBlock* block = (*graph_)[i];
+    if (block->has_phi()) {
+      for (Phi* phi : *block->phis()) loop_values_.insert(phi);
+    }
+    for (Node* node : block->nodes()) {
+      // Anything that writes to the heap could invalidate a hoisted map check
+      // or load. Loop interrupts are not considered writes, like in TurboFan.
+      if (node->properties().can_write()) return;
+      if (node->Is<ValueNode>()) loop_values_.insert(node->Cast<ValueNode>());
+    }
+  }
+
+  for (auto it = header->nodes().begin(); it != header->nodes().end();) {
+    Node* node = *it;
+    if (!CanHoist(node)) {
+      // Nodes after a deopt that stays in the loop must not deopt before it,
+      // and nodes after a side effect that stays in the loop must not move
+      // above it.
+      const OpProperties& properties = node->properties();
+      if (properties.can_deopt() || properties.is_any_call() ||
+          properties.can_allocate()) {
+        return;
+      }
+      ++it;
+      continue;
+    }
+
+    if (CheckMaps* check = node->TryCast<CheckMaps>()) {
+      const CompactInterpreterFrameState* frame_state =
+          TryGetLoopEntryFrameState(check, header);
+      if (frame_state == nullptr) return;
+      DeoptFrame& top_frame = check->eager_deopt_info()->top_frame();
+      const InterpretedDeoptFrame& frame = top_frame.as_interpreted();
+      CheckMaps* hoisted = NodeBase::New<CheckMaps>(
+          zone_, {check->receiver_input().node()}, check->maps(),
+          check->check_type());
+      hoisted->SetEagerDeoptInfo(
+          zone_,
+          InterpretedDeoptFrame(frame.unit(), frame_state, frame.closure(),
+                                frame.bytecode_position(),
+                                frame.source_position(), top_frame.parent()),
+          check->eager_deopt_info()->feedback_to_update());
+      if (compilation_info_->has_graph_labeller()) {
+        compilation_info_->graph_labeller()->RegisterNode(hoisted);
+      }
+      it = header->nodes().RemoveAt(it);
+      pre_header->nodes().Add(hoisted);
+      continue;
+    }
+
+    it = header->nodes().RemoveAt(it);
+    pre_header->nodes().Add(node);
+    if (node->Is<ValueNode>()) loop_values_.erase(node->Cast<ValueNode>());
+  }
+}
+
+bool MaglevLoopInvariantCodeMotion::CanHoist(Node* node) const {
+  switch (node->opcode()) {
+    case Opcode::kCheckMaps:
+    case Opcode::kLoadTaggedField:
+    case Opcode::kLoadDoubleField:
+      break;
+    default:
+      if (!node->properties().is_pure()) return false;
+      break;
+  }
+  for (Input& input : *node) {
+    if (!IsLoopInvariant(input.node())) return false;
+  }
+  return true;
+}
+
+const CompactInterpreterFrameState*
+MaglevLoopInvariantCodeMotion::TryGetLoopEntryFrameState(
+    CheckMaps* check, BasicBlock* header) const {
+  const DeoptFrame& top_frame = check->eager_deopt_info()->top_frame();
+  if (top_frame.type() != DeoptFrame::FrameType::kInterpretedFrame) {
+    return nullptr;
+  }
+  const InterpretedDeoptFrame& frame = top_frame.as_interpreted();
+  if (!IsLoopInvariant(frame.closure())) return nullptr;
+
+  // The parent frames are shared with other nodes, so they can't be updated
+  // and have to be loop invariant already.
+  bool parents_are_invariant = true;
+  for (const DeoptFrame* parent = frame.parent();
+       parent != nullptr && parents_are_invariant; parent = parent->parent()) {
+    if (parent->type() != DeoptFrame::FrameType::kInterpretedFrame) {
+      return nullptr;
+    }
+    const InterpretedDeoptFrame& interpreted = parent->as_interpreted();
+    parents_are_invariant = IsLoopInvariant(interpreted.closure());
+    interpreted.frame_state()->ForEachValue(
+        interpreted.unit(), [&](ValueNode* value, interpreter::Register) {
+          if (!IsLoopInvariant(value)) parents_are_invariant = false;
+        });
+  }
+  if (!parents_are_invariant) return nullptr;
+
+  // The frame state itself may be shared with other checks that stay in the
+  // loop, so copy it and map the header's phis to their loop entry value.
+  CompactInterpreterFrameState* entry_state =
+      zone_->New<CompactInterpreterFrameState>(
+          frame.unit(), frame.frame_state()->liveness());
+  ZoneVector<ValueNode*> values(zone_);
+  bool is_invariant = true;
+  frame.frame_state()->ForEachValue(
+      frame.unit(), [&](ValueNode* value, interpreter::Register) {
+        Phi* phi = value->TryCast<Phi>();
+        if (phi != nullptr && phi->merge_state() == header->state()) {
+          value = phi->input(0).node();
+        }
+        if (!IsLoopInvariant(value)) is_invariant = false;
+        values.push_back(value);
+      });
+  if (!is_invariant) return nullptr;
+  size_t index = 0;
+  entry_state->ForEachValue(frame.unit(),
+                            [&](ValueNode*& entry, interpreter::Register) {
+                              entry = values[index++];
+                            });
+  return entry_state;
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
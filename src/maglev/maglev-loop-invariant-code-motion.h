@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_MAGLEV_MAGLEV_LOOP_INVARIANT_CODE_MOTION_H_
+#define V8_MAGLEV_MAGLEV_LOOP_INVARIANT_CODE_MOTION_H_
+
+#include "src/maglev/maglev-graph.h"
+#include "src/maglev/maglev-ir.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+class MaglevCompilationInfo;
+
+// Hoists map checks, field loads and pure computations with loop-invariant
+// inputs out of loops that don't write to the heap.
+//
+// Only nodes of the loop header block are hoisted, since it is the only block
+// of the loop that runs whenever the loop is entered. Hoisting stops at the
+// first node of the header that stays in the loop and can deopt, so that
+// deopts happen in the original order. A hoisted map check deopts to its
+// original bytecode offset, with the loop phis in its frame state replaced by
+// their value on loop entry: the state in which the check runs in the first
+// iteration.
+class MaglevLoopInvariantCodeMotion {
+ public:
+  MaglevLoopInvariantCodeMotion(MaglevCompilationInfo* compilation_info,
+                                Graph* graph);
+
+  void Run();
+
+ private:
+  void ProcessLoop(int header_index, int back_edge_index);
+
+  bool IsLoopInvariant(ValueNode* node) const {
+    return loop_values_.find(node) == loop_values_.end();
+  }
+  bool CanHoist(Node* node) const;
+  // Returns the frame state of {check} as of loop entry, or nullptr if it
+  // refers to values computed in the loop.
+  const CompactInterpreterFrameState* TryGetLoopEntryFrameState(
+      CheckMaps* check, BasicBlock* header) const;
+
+  MaglevCompilationInfo* compilation_info_;
+  Graph* graph_;
+  Zone* zone_;
+  // Values defined in the loop that is currently processed.
+  ZoneSet<ValueNode*> loop_values_;
+};
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_MAGLEV_MAGLEV_LOOP_INVARIANT_CODE_MOTION_H_
@@ -50,6 +50,16 @@ void MaglevPipelineStatistics::EndPhase() {
                    TRACE_STR_COPY(diff.AsJSON().c_str()));
 }
 
+void MaglevPipelineStatistics::RecordRegallocStatistics(
+    const MaglevRegallocStatistics& stats) {
+  Base::RecordCounter("regalloc_spills", stats.spills);
+  Base::RecordCounter("regalloc_reloads", stats.reloads);
+  Base::RecordCounter("regalloc_back_edge_reloads", stats.back_edge_reloads);
+  TRACE_EVENT_INSTANT2(kTraceCategory, "V8.MaglevRegallocStatistics",
+                       TRACE_EVENT_SCOPE_THREAD, "spills", stats.spills,
+                       "reloads", stats.reloads);
+}
+
 }  // namespace maglev
 }  // namespace internal
 }  // namespace v8
@@ -33,6 +33,8 @@ class MaglevPipelineStatistics : public compiler::PipelineStatisticsBase,
   void EndPhaseKind();
   void BeginPhase(const char* name);
   void EndPhase();
+
+  void RecordRegallocStatistics(const MaglevRegallocStatistics& stats);
 };
 
 }  // namespace maglev
@@ -1131,6 +1131,9 @@ void StraightForwardRegisterAllocator::AddMoveBeforeCurrentNode(
     gap_move =
         Node::New<ConstantGapMove>(compilation_info_->zone(), {}, node, target);
   } else {
+    if (source.IsAnyStackSlot()) {
+      compilation_info_->regalloc_statistics().reloads++;
+    }
     if (v8_flags.trace_maglev_regalloc) {
       printing_visitor_->os() << "  gap move: " << target << " ← "
                               << PrintNodeLabel(graph_labeller(), node) << ":"
@@ -1602,6 +1605,7 @@ void StraightForwardRegisterAllocator::AllocateSpillSlot(ValueNode* node) {
   }
   node->Spill(compiler::AllocatedOperand(compiler::AllocatedOperand::STACK_SLOT,
                                          representation, free_slot));
+  compilation_info_->regalloc_statistics().spills++;
 }
 
 template <typename RegisterT>
@@ -2112,6 +2116,46 @@ void StraightForwardRegisterAllocator::HoistLoopSpills(BasicBlock* target) {
   }
 }
 
+// Values that are live across a loop but not used inside of it would otherwise
+// keep their register for the whole loop. Once a call or register pressure in
+// the loop evicts them, the merge state forces a reload on every back-edge.
+// Split their live range at the loop boundary instead: spill them on loop entry
+// and let the first use after the loop reload them.
+template <typename RegisterT>
+void StraightForwardRegisterAllocator::SplitLiveRangesAtLoopEntry(
+    ControlNode* source, BasicBlock* target, NodeIdT loop_end) {
+  RegisterFrameState<RegisterT>& registers = GetRegisterFrameState<RegisterT>();
+  const bool kForceSpill = true;
+  for (RegisterT reg : registers.used()) {
+    if (registers.free().has(reg)) continue;
+    ValueNode* node = registers.GetValue(reg);
+    if (!IsLiveAtTarget(node, source, target)) continue;
+    if (node->next_use() <= loop_end) continue;
+    if (v8_flags.trace_maglev_regalloc) {
+      printing_visitor_->os()
+          << "  " << reg << " - splitting "
+          << PrintNodeLabel(graph_labeller(), node)
+          << " at loop entry, next use " << node->next_use() << "\n";
+    }
+    DropRegisterValueAtEnd(reg, kForceSpill);
+  }
+}
+
+void StraightForwardRegisterAllocator::SplitLiveRangesAtLoopEntry(
+    ControlNode* source, BasicBlock* target) {
+  if (!v8_flags.maglev_split_live_ranges_at_loops) return;
+  MergePointInterpreterFrameState* state = target->state();
+  if (!state->is_loop() || state->is_unmerged_loop()) return;
+  // All values are dropped on resumable loop headers anyway.
+  if (state->is_resumable_loop()) return;
+  // The back-edge is the last predecessor of a loop header, so every node in
+  // the loop has an id up to its JumpLoop's.
+  BasicBlock* back_edge = state->predecessor_at(state->predecessor_count() - 1);
+  NodeIdT loop_end = back_edge->control_node()->id();
+  SplitLiveRangesAtLoopEntry<Register>(source, target, loop_end);
+  SplitLiveRangesAtLoopEntry<DoubleRegister>(source, target, loop_end);
+}
+
 void StraightForwardRegisterAllocator::InitializeBranchTargetRegisterValues(
     ControlNode* source, BasicBlock* target) {
   MergePointRegisterState& target_state = target->state()->register_state();
@@ -2125,6 +2169,7 @@ void StraightForwardRegisterAllocator::InitializeBranchTargetRegisterValues(
     }
     state = {node, initialized_node};
   };
+  SplitLiveRangesAtLoopEntry(source, target);
   HoistLoopReloads(target, general_registers_);
   HoistLoopReloads(target, double_registers_);
   HoistLoopSpills(target);
@@ -2170,6 +2215,11 @@ void StraightForwardRegisterAllocator::MergeRegisterValues(ControlNode* control,
   }
 
   int predecessor_count = target->state()->predecessor_count();
+  auto count_back_edge_reload = [&](ControlNode* control, ValueNode* node) {
+    if (control->Is<JumpLoop>() && node->allocation().IsAnyStackSlot()) {
+      compilation_info_->regalloc_statistics().back_edge_reloads++;
+    }
+  };
   auto merge = [&](auto& registers, auto reg, RegisterState& state) {
     ValueNode* node;
     RegisterMerge* merge;
@@ -2238,6 +2288,7 @@ void StraightForwardRegisterAllocator::MergeRegisterValues(ControlNode* control,
       // The register is already occupied with a different node. Figure out
       // where that node is allocated on the incoming branch.
       merge->operand(predecessor_id) = node->allocation();
+      count_back_edge_reload(control, node);
       if (v8_flags.trace_maglev_regalloc) {
         printing_visitor_->os() << "  " << reg << " - merge: loading "
                                 << PrintNodeLabel(graph_labeller(), node)
@@ -2307,6 +2358,7 @@ void StraightForwardRegisterAllocator::MergeRegisterValues(ControlNode* control,
       }
     } else {
       merge->operand(predecessor_id) = node->allocation();
+      count_back_edge_reload(control, node);
       if (v8_flags.trace_maglev_regalloc) {
         printing_visitor_->os() << "  " << reg << " - new merge: loading "
                                 << PrintNodeLabel(graph_labeller(), node)
@@ -269,6 +269,10 @@ class StraightForwardRegisterAllocator {
   void HoistLoopReloads(BasicBlock* target,
                         RegisterFrameState<RegisterT>& registers);
   void HoistLoopSpills(BasicBlock* target);
+  template <typename RegisterT>
+  void SplitLiveRangesAtLoopEntry(ControlNode* source, BasicBlock* target,
+                                  NodeIdT loop_end);
+  void SplitLiveRangesAtLoopEntry(ControlNode* source, BasicBlock* target);
   void InitializeBranchTargetRegisterValues(ControlNode* source,
                                             BasicBlock* target);
   void InitializeEmptyBlockRegisterValues(ControlNode* source,
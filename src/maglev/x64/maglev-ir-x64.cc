@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "include/v8-fast-api-calls.h"
 #include "src/base/logging.h"
 #include "src/codegen/interface-descriptors-inl.h"
 #include "src/codegen/x64/assembler-x64-inl.h"
@@ -712,6 +713,93 @@ void Float64Ieee754Unary::GenerateCode(MaglevAssembler* masm,
   __ CallCFunction(ieee_function_, 1);
 }
 
+namespace {
+
+// The slots holding the options and the data, see
+// CallFastApiFunction::GenerateCode.
+constexpr int kFastApiOptionsStackSlots = 4;
+
+}  // namespace
+
+int CallFastApiFunction::MaxCallStackArgs() const {
+  // The slot holding the receiver, the options and the C arguments.
+  int slots = 1;
+  if (c_signature_->HasOptions()) slots += kFastApiOptionsStackSlots;
+  return slots +
+         MaglevAssembler::ArgumentStackSlotsForCFunctionCall(num_c_args());
+}
+void CallFastApiFunction::GenerateCode(MaglevAssembler* masm,
+                                       const ProcessingState& state) {
+  AllowExternalCallThatCantCauseGC scope(masm);
+  MaglevAssembler::ScratchRegisterScope temps(masm);
+  const bool has_options = c_signature_->HasOptions();
+  Register options = no_reg;
+  if (has_options) {
+    options = CArgumentRegister(num_args() + 1);
+    temps.SetAvailable(temps.Available() - options);
+  }
+  Register target = temps.Acquire();
+  const int num_arguments = num_c_args();
+
+  if (has_options) {
+    // The options are initialized like Turbofan does, with their data being
+    // a v8::Local, i.e. the address of a slot holding the data.
+    if (data_.IsSmi()) {
+      __ Move(target, Smi::FromInt(data_.AsSmi()));
+    } else {
+      __ Move(target, data_.AsHeapObject().object());
+    }
+    __ pushq(target);
+    __ movq(target, rsp);
+    __ pushq(Immediate(0));  // wasm_memory
+    __ pushq(target);        // data
+    __ pushq(Immediate(0));  // fallback
+  }
+  // The receiver is passed as a v8::Local, i.e. as the address of a slot
+  // holding it.
+  DCHECK_EQ(arg_reg_1, ToRegister(receiver()));
+  __ pushq(arg_reg_1);
+  __ movq(arg_reg_1, rsp);
+  if (has_options) __ leaq(options, Operand(rsp, kSystemPointerSize));
+  __ PrepareCallCFunction(num_arguments);
+
+  // Let the CPU profiler attribute ticks to the C function.
+  ExternalReference c_function =
+      ExternalReference::Create(c_function_, ExternalReference::FAST_C_CALL);
+  __ Move(target, c_function);
+  ExternalReference target_address =
+      ExternalReference::fast_api_call_target_address(masm->isolate());
+  __ movq(__ ExternalReferenceAsOperand(target_address), target);
+  __ CallCFunction(target, num_arguments);
+  __ movq(__ ExternalReferenceAsOperand(target_address), Immediate(0));
+
+  DoubleRegister result = ToDoubleRegister(this->result());
+  switch (c_signature_->ReturnInfo().GetType()) {
+    case CTypeInfo::Type::kBool:
+      __ movzxbl(kReturnRegister0, kReturnRegister0);
+      __ Int32ToDouble(result, kReturnRegister0);
+      break;
+    case CTypeInfo::Type::kInt32:
+      __ Int32ToDouble(result, kReturnRegister0);
+      break;
+    default:
+      DCHECK_EQ(CTypeInfo::Type::kVoid, c_signature_->ReturnInfo().GetType());
+      __ Move(result, 0.0);
+      break;
+  }
+  if (has_options) {
+    Label done;
+    __ cmpb(Operand(rsp, kSystemPointerSize), Immediate(0));
+    __ j(equal, &done, Label::kNear);
+    __ Move(result, Float64::FromBits(kHoleNanInt64));
+    __ bind(&done);
+    __ addq(rsp,
+            Immediate((1 + kFastApiOptionsStackSlots) * kSystemPointerSize));
+  } else {
+    __ addq(rsp, Immediate(kSystemPointerSize));
+  }
+}
+
 void HoleyFloat64ToMaybeNanFloat64::SetValueLocationConstraints() {
   UseRegister(input());
   DefineSameAsFirst(this);
@@ -6,8 +6,10 @@
 
 #include <cstring>
 
+#include "src/base/bounds.h"
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles.h"
+#include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/sandbox/sandbox.h"
 
@@ -119,6 +121,19 @@ inline void DebugCheckZero(void* start, size_t byte_length) {
   }
 #endif
 }
+
+#if V8_ENABLE_WEBASSEMBLY
+// Returns whether all {size} bytes starting at {start} are zero, using the same
+// shifted {memcmp} as {DebugCheckZero}.
+bool IsZeroMemory(const uint8_t* start, size_t size) {
+  const size_t kBaseCase = 32;
+  DCHECK_LE(kBaseCase, size);
+  for (size_t i = 0; i < kBaseCase; i++) {
+    if (start[i] != 0) return false;
+  }
+  return memcmp(start, start + kBaseCase, size - kBaseCase) == 0;
+}
+#endif  // V8_ENABLE_WEBASSEMBLY
 }  // namespace
 
 // The backing store for a Wasm shared memory remembers all the isolates
@@ -231,6 +246,12 @@ BackingStore::~BackingStore() {
     auto allocator = get_v8_api_array_buffer_allocator();
     TRACE_BS("BS:free   bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
              buffer_start_, byte_length(), byte_capacity_);
+    if (pool_) {
+      if (pool_->TryPut(buffer_start_, byte_length_)) return;
+      allocator->Free(buffer_start_,
+                      ArrayBufferPool::AllocationLength(byte_length_));
+      return;
+    }
     allocator->Free(buffer_start_, byte_length_);
   }
 }
@@ -242,6 +263,13 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
   void* buffer_start = nullptr;
   auto allocator = isolate->array_buffer_allocator();
   CHECK_NOT_NULL(allocator);
+  // Only non-shared array buffers are pooled, since they are the ones that
+  // are typically allocated and dropped at high rates.
+  std::shared_ptr<ArrayBufferPool> pool;
+  if (shared == SharedFlag::kNotShared &&
+      ArrayBufferPool::IsPoolable(byte_length)) {
+    pool = isolate->array_buffer_pool();
+  }
   if (byte_length != 0) {
     auto counters = isolate->counters();
     int mb_length = static_cast<int>(byte_length / MB);
@@ -251,7 +279,17 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
     if (shared == SharedFlag::kShared) {
       counters->shared_array_allocations()->AddSample(mb_length);
     }
-    auto allocate_buffer = [allocator, initialized](size_t byte_length) {
+    auto allocate_buffer = [allocator, initialized,
+                            &pool](size_t byte_length) {
+      if (pool) {
+        if (void* buffer_start = pool->TryTake(byte_length)) {
+          if (initialized == InitializedFlag::kZeroInitialized) {
+            memset(buffer_start, 0, byte_length);
+          }
+          return buffer_start;
+        }
+        byte_length = ArrayBufferPool::AllocationLength(byte_length);
+      }
       if (initialized == InitializedFlag::kUninitialized) {
         return allocator->AllocateUninitialized(byte_length);
       }
@@ -302,6 +340,7 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
   TRACE_BS("BS:alloc  bs=%p mem=%p (length=%zu)\n", result,
            result->buffer_start(), byte_length);
   result->SetAllocatorFromIsolate(isolate);
+  result->pool_ = std::move(pool);
   return std::unique_ptr<BackingStore>(result);
 }
 
@@ -578,6 +617,72 @@ base::Optional<size_t> BackingStore::GrowWasmMemoryInPlace(Isolate* isolate,
   return {old_length / wasm::kWasmPageSize};
 }
 
+size_t BackingStore::DiscardWasmMemory(size_t offset, size_t length) {
+  DCHECK(is_wasm_memory_);
+  DCHECK(!is_shared_);
+  DCHECK(base::IsInBounds<size_t>(offset, length, byte_length()));
+  uint8_t* start = reinterpret_cast<uint8_t*>(buffer_start_) + offset;
+  uint8_t* end = start + length;
+
+  // Only whole pages can be returned to the OS; the rest of the range is
+  // cleared by hand.
+  PageAllocator* page_allocator = GetArrayBufferPageAllocator();
+  size_t page_size = page_allocator->CommitPageSize();
+  uint8_t* pages_start = reinterpret_cast<uint8_t*>(
+      RoundUp(reinterpret_cast<uintptr_t>(start), page_size));
+  uint8_t* pages_end = reinterpret_cast<uint8_t*>(
+      RoundDown(reinterpret_cast<uintptr_t>(end), page_size));
+  if (pages_start >= pages_end) {
+    memset(start, 0, length);
+    return 0;
+  }
+  memset(start, 0, pages_start - start);
+  memset(pages_end, 0, end - pages_end);
+
+  // Decommitting guarantees that the pages read as zero once they are
+  // accessible again. Since the memory is not shared, no other thread can
+  // access the pages while they are inaccessible.
+  size_t pages_size = pages_end - pages_start;
+  if (!page_allocator->DecommitPages(pages_start, pages_size)) {
+    memset(pages_start, 0, pages_size);
+    return 0;
+  }
+  if (!i::SetPermissions(page_allocator, pages_start, pages_size,
+                         PageAllocator::kReadWrite)) {
+    // The pages were accessible before, so they must become accessible again.
+    V8::FatalProcessOutOfMemory(nullptr, "BackingStore::DiscardWasmMemory");
+  }
+  TRACE_BS("BSw:discard bs=%p mem=%p (length=%zu)\n", this, pages_start,
+           pages_size);
+  return pages_size;
+}
+
+size_t BackingStore::DiscardZeroedWasmMemoryTail() {
+  DCHECK(is_wasm_memory_);
+  DCHECK(!is_shared_);
+  uint8_t* start = reinterpret_cast<uint8_t*>(buffer_start_);
+  size_t page_size = GetArrayBufferPageAllocator()->CommitPageSize();
+  // Wasm memory is a multiple of the Wasm page size, which is a multiple of
+  // any commit page size.
+  DCHECK_EQ(0, byte_length() % page_size);
+  size_t tail_start = byte_length();
+  while (tail_start > 0 &&
+         IsZeroMemory(start + tail_start - page_size, page_size)) {
+    tail_start -= page_size;
+  }
+  size_t tail_size = byte_length() - tail_start;
+  if (tail_size == 0) return 0;
+  // The pages only contain zeros, so it does not matter whether the OS drops
+  // their contents immediately, later, or not at all.
+  if (!GetArrayBufferPageAllocator()->DiscardSystemPages(start + tail_start,
+                                                         tail_size)) {
+    return 0;
+  }
+  TRACE_BS("BSw:discard tail bs=%p mem=%p (length=%zu)\n", this,
+           start + tail_start, tail_size);
+  return tail_size;
+}
+
 void BackingStore::AttachSharedWasmMemoryObject(
     Isolate* isolate, Handle<WasmMemoryObject> memory_object) {
   DCHECK(is_wasm_memory_);
@@ -783,9 +888,20 @@ bool BackingStore::Reallocate(Isolate* isolate, size_t new_byte_length) {
   auto allocator = get_v8_api_array_buffer_allocator();
   CHECK_EQ(isolate->array_buffer_allocator(), allocator);
   CHECK_EQ(byte_length_, byte_capacity_);
+  size_t allocation_length = byte_length_;
+  if (pool_) {
+    // Pooled memory is allocated in size classes. Clear the bytes beyond the
+    // byte length, which may be left over from a previous use, so that they
+    // read as zero if the buffer grows into them.
+    allocation_length = ArrayBufferPool::AllocationLength(byte_length_);
+    memset(static_cast<uint8_t*>(buffer_start_) + byte_length_, 0,
+           allocation_length - byte_length_);
+  }
   void* new_start =
-      allocator->Reallocate(buffer_start_, byte_length_, new_byte_length);
+      allocator->Reallocate(buffer_start_, allocation_length, new_byte_length);
   if (!new_start) return false;
+  // The new memory is owned by the allocator like any other.
+  pool_.reset();
   buffer_start_ = new_start;
   byte_capacity_ = new_byte_length;
   byte_length_ = new_byte_length;
@@ -810,6 +926,40 @@ SharedWasmMemoryData* BackingStore::get_shared_wasm_memory_data() const {
   return shared_wasm_memory_data;
 }
 
+void* ArrayBufferPool::TryTake(size_t byte_length) {
+  base::MutexGuard guard(&mutex_);
+  std::vector<void*>& free_memory = free_memory_[SizeClass(byte_length)];
+  if (free_memory.empty()) return nullptr;
+  void* memory = free_memory.back();
+  free_memory.pop_back();
+  pooled_bytes_ -= AllocationLength(byte_length);
+  return memory;
+}
+
+bool ArrayBufferPool::TryPut(void* memory, size_t byte_length) {
+  size_t allocation_length = AllocationLength(byte_length);
+  base::MutexGuard guard(&mutex_);
+  if (torn_down_ || pooled_bytes_ + allocation_length > kMaxPooledBytes) {
+    return false;
+  }
+  free_memory_[SizeClass(byte_length)].push_back(memory);
+  pooled_bytes_ += allocation_length;
+  return true;
+}
+
+void ArrayBufferPool::TearDown(v8::ArrayBuffer::Allocator* allocator) {
+  base::MutexGuard guard(&mutex_);
+  DCHECK(!torn_down_);
+  torn_down_ = true;
+  for (size_t i = 0; i < kSizeClassCount; i++) {
+    for (void* memory : free_memory_[i]) {
+      allocator->Free(memory, (i + 1) * kSizeClassGranularity);
+    }
+    free_memory_[i].clear();
+  }
+  pooled_bytes_ = 0;
+}
+
 namespace {
 // Implementation details of GlobalBackingStoreRegistry.
 struct GlobalBackingStoreRegistryImpl {
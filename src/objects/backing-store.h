@@ -6,15 +6,18 @@
 #define V8_OBJECTS_BACKING_STORE_H_
 
 #include <memory>
+#include <vector>
 
 #include "include/v8-array-buffer.h"
 #include "include/v8-internal.h"
 #include "src/base/optional.h"
+#include "src/base/platform/mutex.h"
 #include "src/handles/handles.h"
 
 namespace v8 {
 namespace internal {
 
+class ArrayBufferPool;
 class Isolate;
 class WasmMemoryObject;
 
@@ -136,6 +139,16 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
                                                size_t max_pages,
                                                WasmMemoryFlag wasm_memory);
 
+  // Zero the given range of this (non-shared) Wasm memory, returning all pages
+  // fully contained in it to the OS. The range must be within
+  // {byte_length()}. Returns the number of bytes returned to the OS.
+  size_t DiscardWasmMemory(size_t offset, size_t length);
+
+  // Return the trailing pages of this (non-shared) Wasm memory that only
+  // contain zeros to the OS. The memory stays accessible and keeps its
+  // contents. Returns the number of bytes discarded.
+  size_t DiscardZeroedWasmMemoryTail();
+
   // Attach the given memory object to this backing store. The memory object
   // will be updated if this backing store is grown.
   void AttachSharedWasmMemoryObject(Isolate* isolate,
@@ -192,6 +205,8 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
 
   void* buffer_start_ = nullptr;
   std::atomic<size_t> byte_length_;
+  // The pool that the memory is returned to, if it was allocated from one.
+  std::shared_ptr<ArrayBufferPool> pool_;
   // Max byte length of the corresponding JSArrayBuffer(s).
   size_t max_byte_length_;
   // Amount of the memory allocated
@@ -240,6 +255,59 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   const bool empty_deleter_ : 1;
 };
 
+// A per-isolate cache of the memory of freed array buffer backing stores of
+// up to kMaxPooledByteLength bytes, used with --array-buffer-pool. Pooled
+// memory is allocated from the embedder's allocator in size classes of
+// kSizeClassGranularity bytes. When a pooled backing store is freed, on any
+// thread, its memory goes back to the pool and is handed out again for the
+// next allocation of the same size class.
+class ArrayBufferPool final {
+ public:
+  static constexpr size_t kSizeClassGranularity = 4 * KB;
+  static constexpr size_t kMaxPooledByteLength = 64 * KB;
+  // Upper bound on the memory kept in the pool.
+  static constexpr size_t kMaxPooledBytes = 4 * MB;
+
+  ArrayBufferPool() = default;
+  ArrayBufferPool(const ArrayBufferPool&) = delete;
+  ArrayBufferPool& operator=(const ArrayBufferPool&) = delete;
+
+  static bool IsPoolable(size_t byte_length) {
+    return byte_length != 0 && byte_length <= kMaxPooledByteLength;
+  }
+
+  // The number of bytes actually allocated for a pooled backing store.
+  static size_t AllocationLength(size_t byte_length) {
+    DCHECK(IsPoolable(byte_length));
+    return RoundUp(byte_length, kSizeClassGranularity);
+  }
+
+  // Returns pooled memory for a backing store of the given length, or
+  // nullptr if there is none. The memory is not initialized.
+  void* TryTake(size_t byte_length);
+
+  // Returns the memory of a freed backing store of the given length to the
+  // pool. Returns false if the pool is full or torn down, in which case the
+  // caller needs to free the memory itself.
+  bool TryPut(void* memory, size_t byte_length);
+
+  // Frees all pooled memory through the given allocator, and stops pooling.
+  void TearDown(v8::ArrayBuffer::Allocator* allocator);
+
+ private:
+  static constexpr size_t kSizeClassCount =
+      kMaxPooledByteLength / kSizeClassGranularity;
+
+  static size_t SizeClass(size_t byte_length) {
+    return AllocationLength(byte_length) / kSizeClassGranularity - 1;
+  }
+
+  base::Mutex mutex_;
+  std::vector<void*> free_memory_[kSizeClassCount];
+  size_t pooled_bytes_ = 0;
+  bool torn_down_ = false;
+};
+
 // A global, per-process mapping from buffer addresses to backing stores
 // of wasm memory objects.
 class GlobalBackingStoreRegistry {
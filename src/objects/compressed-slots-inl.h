@@ -214,12 +214,13 @@ void OffHeapCompressedObjectSlot<CompressionScheme>::Release_Store(
 }
 
 template <typename CompressionScheme>
-void OffHeapCompressedObjectSlot<CompressionScheme>::Release_CompareAndSwap(
-    Object old, Object target) const {
+Object OffHeapCompressedObjectSlot<CompressionScheme>::Release_CompareAndSwap(
+    PtrComprCageBase cage_base, Object old, Object target) const {
   Tagged_t old_ptr = CompressionScheme::CompressObject(old.ptr());
   Tagged_t target_ptr = CompressionScheme::CompressObject(target.ptr());
-  AsAtomicTagged::Release_CompareAndSwap(TSlotBase::location(), old_ptr,
-                                         target_ptr);
+  Tagged_t result = AsAtomicTagged::Release_CompareAndSwap(
+      TSlotBase::location(), old_ptr, target_ptr);
+  return Object(CompressionScheme::DecompressTagged(cage_base, result));
 }
 
 }  // namespace v8::internal
@@ -154,7 +154,8 @@ class OffHeapCompressedObjectSlot
   inline Object Acquire_Load(PtrComprCageBase cage_base) const;
   inline void Relaxed_Store(Object value) const;
   inline void Release_Store(Object value) const;
-  inline void Release_CompareAndSwap(Object old, Object target) const;
+  inline Object Release_CompareAndSwap(PtrComprCageBase cage_base, Object old,
+                                       Object target) const;
 };
 
 #endif  // V8_COMPRESS_POINTERS
@@ -22,6 +22,7 @@
 #include "src/objects/js-shared-array-inl.h"
 #include "src/objects/keys.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/simd.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots.h"
 #include "src/utils/utils.h"
@@ -2257,6 +2258,12 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
                            int hole_end) {
     DisallowGarbageCollection no_gc;
     BackingStore dst_elms = BackingStore::cast(*backing_store);
+    if (len > JSArray::kMaxCopyElements && dst_index == 0) {
+      // Left trimming only works on swept pages. Sweep the page right away
+      // instead of moving all elements on every shift until the concurrent
+      // sweeper gets to it, which makes queue-like arrays quadratic.
+      isolate->heap()->EnsureSweepingCompletedForObject(dst_elms);
+    }
     if (len > JSArray::kMaxCopyElements && dst_index == 0 &&
         isolate->heap()->CanMoveObjectStart(dst_elms)) {
       dst_elms = BackingStore::cast(
@@ -2298,9 +2305,30 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
       CHECK_EQ(Subclass::kind(), receiver->GetElementsKind());
     }
     DCHECK_LE(end, Subclass::GetCapacityImpl(*receiver, receiver->elements()));
+    if (start == end) return MaybeHandle<Object>(receiver);
 
-    for (size_t index = start; index < end; ++index) {
-      Subclass::SetImpl(receiver, InternalIndex(index), *obj_value);
+    DisallowGarbageCollection no_gc;
+    int from = static_cast<int>(start);
+    int to = static_cast<int>(end);
+    if (IsDoubleElementsKind(Subclass::kind())) {
+      FixedDoubleArray elements = FixedDoubleArray::cast(receiver->elements());
+      double value = obj_value->Number();
+      for (int index = from; index < to; ++index) {
+        elements->set(index, value);
+      }
+    } else {
+      // Store the value without a write barrier per element and record the
+      // whole range with a single barrier afterwards.
+      FixedArray elements = FixedArray::cast(receiver->elements());
+      Object value = *obj_value;
+      for (int index = from; index < to; ++index) {
+        elements->set(index, value, SKIP_WRITE_BARRIER);
+      }
+      if (value.IsHeapObject()) {
+        receiver->GetIsolate()->heap()->WriteBarrierForRange(
+            elements, elements->RawFieldOfElementAt(from),
+            elements->RawFieldOfElementAt(to));
+      }
     }
     return MaybeHandle<Object>(receiver);
   }
@@ -3507,11 +3535,8 @@ class TypedElementsAccessor
       }
     }
 
-    for (size_t k = start_from; k < length; ++k) {
-      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
-      if (elem_k == typed_search_value) return Just(true);
-    }
-    return Just(false);
+    return Just(SearchImpl(data_ptr, start_from, length, typed_search_value,
+                           is_shared) != -1);
   }
 
   static Maybe<int64_t> IndexOfValueImpl(Isolate* isolate,
@@ -3571,11 +3596,46 @@ class TypedElementsAccessor
     }
 
     auto is_shared = typed_array->buffer()->is_shared() ? kShared : kUnshared;
+    return Just<int64_t>(SearchImpl(data_ptr, start_from, length,
+                                    typed_search_value, is_shared));
+  }
+
+  // Returns the index of the first element in [start_from, length) that is
+  // equal to {value}, or -1. {value} must not be NaN. Unshared, aligned
+  // backing stores of 32- and 64-bit elements are searched with SIMD.
+  static int64_t SearchImpl(ElementType* data_ptr, size_t start_from,
+                            size_t length, ElementType value,
+                            IsSharedBuffer is_shared) {
+    if (start_from >= length) return -1;
+    constexpr bool kIsInt32 =
+        std::is_integral_v<ElementType> && sizeof(ElementType) == 4;
+    constexpr bool kIsInt64 =
+        std::is_integral_v<ElementType> && sizeof(ElementType) == 8;
+    constexpr bool kIsFloat64 = std::is_same_v<ElementType, double>;
+    if constexpr (kIsInt32 || kIsInt64 || kIsFloat64) {
+      if (is_shared == kUnshared &&
+          IsAligned(reinterpret_cast<uintptr_t>(data_ptr),
+                    alignof(ElementType))) {
+        uintptr_t index;
+        if constexpr (kIsInt32) {
+          index = TypedArrayIndexOf(reinterpret_cast<uint32_t*>(data_ptr),
+                                    length, start_from,
+                                    static_cast<uint32_t>(value));
+        } else if constexpr (kIsInt64) {
+          index = TypedArrayIndexOf(reinterpret_cast<uint64_t*>(data_ptr),
+                                    length, start_from,
+                                    static_cast<uint64_t>(value));
+        } else {
+          index = TypedArrayIndexOf(data_ptr, length, start_from, value);
+        }
+        return static_cast<intptr_t>(index);
+      }
+    }
     for (size_t k = start_from; k < length; ++k) {
       ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
-      if (elem_k == typed_search_value) return Just<int64_t>(k);
+      if (elem_k == value) return static_cast<int64_t>(k);
     }
-    return Just<int64_t>(-1);
+    return -1;
   }
 
   static Maybe<int64_t> LastIndexOfValueImpl(Handle<JSObject> receiver,
@@ -3745,6 +3805,22 @@ class TypedElementsAccessor
     }
   }
 
+  // Like CopyBetweenBackingStores, but from the last element to the first.
+  template <ElementsKind SourceKind, typename SourceElementType>
+  static void CopyBetweenBackingStoresBackward(
+      SourceElementType* source_data_ptr, ElementType* dest_data_ptr,
+      size_t length, IsSharedBuffer is_shared) {
+    source_data_ptr += length;
+    dest_data_ptr += length;
+    for (; length > 0; --length) {
+      SourceElementType source_elem =
+          TypedElementsAccessor<SourceKind, SourceElementType>::GetImpl(
+              --source_data_ptr, is_shared);
+      ElementType dest_elem = FromScalar(source_elem);
+      SetImpl(--dest_data_ptr, dest_elem, is_shared);
+    }
+  }
+
   static void CopyElementsFromTypedArray(JSTypedArray source,
                                          JSTypedArray destination,
                                          size_t length, size_t offset) {
@@ -3769,8 +3845,6 @@ class TypedElementsAccessor
 
     uint8_t* source_data = static_cast<uint8_t*>(source->DataPtr());
     uint8_t* dest_data = static_cast<uint8_t*>(destination->DataPtr());
-    size_t source_byte_length = source->GetByteLength();
-    size_t dest_byte_length = destination->GetByteLength();
 
     bool source_shared = source->buffer()->is_shared();
     bool destination_shared = destination->buffer()->is_shared();
@@ -3791,31 +3865,51 @@ class TypedElementsAccessor
                      length * element_size);
       }
     } else {
+      size_t source_element_size = source->element_size();
+      size_t dest_element_size = destination->element_size();
+      uint8_t* dest_start = dest_data + offset * dest_element_size;
+      size_t source_copy_length = length * source_element_size;
+      bool backward = false;
       std::unique_ptr<uint8_t[]> cloned_source_elements;
 
-      // If the typedarrays are overlapped, clone the source.
-      if (dest_data + dest_byte_length > source_data &&
-          source_data + source_byte_length > dest_data) {
-        cloned_source_elements.reset(new uint8_t[source_byte_length]);
-        if (source_shared) {
-          base::Relaxed_Memcpy(
-              reinterpret_cast<base::Atomic8*>(cloned_source_elements.get()),
-              reinterpret_cast<base::Atomic8*>(source_data),
-              source_byte_length);
-        } else {
-          std::memcpy(cloned_source_elements.get(), source_data,
-                      source_byte_length);
+      // If the copied ranges overlap, iterate in the direction in which each
+      // element is read before any element stored earlier can clobber it. If
+      // there is no such direction, clone the part of the source that is read.
+      if (dest_start + length * dest_element_size > source_data &&
+          source_data + source_copy_length > dest_start) {
+        if (dest_start >= source_data &&
+            dest_element_size >= source_element_size) {
+          backward = true;
+        } else if (dest_start > source_data ||
+                   dest_element_size > source_element_size) {
+          cloned_source_elements.reset(new uint8_t[source_copy_length]);
+          if (source_shared) {
+            base::Relaxed_Memcpy(
+                reinterpret_cast<base::Atomic8*>(cloned_source_elements.get()),
+                reinterpret_cast<base::Atomic8*>(source_data),
+                source_copy_length);
+          } else {
+            std::memcpy(cloned_source_elements.get(), source_data,
+                        source_copy_length);
+          }
+          source_data = cloned_source_elements.get();
         }
-        source_data = cloned_source_elements.get();
       }
+      IsSharedBuffer is_shared =
+          source_shared || destination_shared ? kShared : kUnshared;
 
       switch (source->GetElementsKind()) {
-#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype)                   \
-  case TYPE##_ELEMENTS:                                             \
-    CopyBetweenBackingStores<TYPE##_ELEMENTS, ctype>(               \
-        reinterpret_cast<ctype*>(source_data),                      \
-        reinterpret_cast<ElementType*>(dest_data) + offset, length, \
-        source_shared || destination_shared ? kShared : kUnshared); \
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype)                           \
+  case TYPE##_ELEMENTS:                                                     \
+    if (backward) {                                                         \
+      CopyBetweenBackingStoresBackward<TYPE##_ELEMENTS, ctype>(             \
+          reinterpret_cast<ctype*>(source_data),                            \
+          reinterpret_cast<ElementType*>(dest_start), length, is_shared);   \
+    } else {                                                                \
+      CopyBetweenBackingStores<TYPE##_ELEMENTS, ctype>(                     \
+          reinterpret_cast<ctype*>(source_data),                            \
+          reinterpret_cast<ElementType*>(dest_start), length, is_shared);   \
+    }                                                                       \
     break;
         TYPED_ARRAYS(TYPED_ARRAY_CASE)
         RAB_GSAB_TYPED_ARRAYS(TYPED_ARRAY_CASE)
@@ -4045,6 +4139,15 @@ class TypedElementsAccessor
   }
 };
 
+// Rounds a value in (0, 255] to the nearest integer, ties to even, like lrint
+// in the default rounding mode. Adding and subtracting 2^52 leaves no bits for
+// the fraction, and unlike a call to lrint this can be vectorized.
+inline uint8_t RoundToUint8(double value) {
+  DCHECK(value > 0 && value <= 0xFF);
+  constexpr double kTwoTo52 = 4503599627370496.0;
+  return static_cast<uint8_t>((value + kTwoTo52) - kTwoTo52);
+}
+
 // static
 template <>
 Handle<Object> TypedElementsAccessor<INT8_ELEMENTS, int8_t>::ToHandle(
@@ -4140,7 +4243,7 @@ uint8_t TypedElementsAccessor<UINT8_CLAMPED_ELEMENTS, uint8_t>::FromScalar(
   // Handle NaNs and less than zero values which clamp to zero.
   if (!(value > 0)) return 0;
   if (value > 0xFF) return 0xFF;
-  return static_cast<uint8_t>(lrint(value));
+  return RoundToUint8(value);
 }
 
 // static
@@ -4351,7 +4454,7 @@ uint8_t TypedElementsAccessor<RAB_GSAB_UINT8_CLAMPED_ELEMENTS,
   // Handle NaNs and less than zero values which clamp to zero.
   if (!(value > 0)) return 0;
   if (value > 0xFF) return 0xFF;
-  return static_cast<uint8_t>(lrint(value));
+  return RoundToUint8(value);
 }
 
 // static
@@ -238,9 +238,11 @@ Object FixedArray::swap(int index, Smi value, SeqCstAccessTag tag) {
 }
 
 void FixedArray::FillWithHoles(int from, int to) {
-  for (int i = from; i < to; i++) {
-    set_the_hole(i);
-  }
+  DCHECK_LE(from, to);
+  DCHECK_LE(to, length());
+  // The hole is immortal and immovable, so no write barrier is needed.
+  MemsetTagged(RawFieldOfElementAt(from), GetReadOnlyRoots().the_hole_value(),
+               to - from);
 }
 
 ObjectSlot FixedArray::data_start() { return RawField(OffsetOfElementAt(0)); }
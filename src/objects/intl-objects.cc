@@ -2663,8 +2663,37 @@ class ICUTimezoneCache : public base::TimezoneCache {
   bool GetOffsets(double time_ms, bool is_utc, int32_t* raw_offset,
                   int32_t* dst_offset);
 
+  // Looks up the offsets in effect at the given UTC time in the transition
+  // table, building the table first if necessary. Returns false for times
+  // that the table doesn't cover.
+  bool LookupOffsets(double time_ms, int32_t* raw_offset,
+                     int32_t* dst_offset);
+
+  void BuildTransitionTable();
+
+  // The transition table covers all times before kTransitionTableEndMs
+  // (2100-01-01T00:00:00Z), so that lookups of time values that are typically
+  // used take a binary search instead of a call into ICU.
+  static constexpr double kTransitionTableEndMs = 4102444800000.0;
+
+  struct Transition {
+    double time_ms;
+    int32_t raw_offset;
+    int32_t dst_offset;
+  };
+
   icu::TimeZone* timezone_;
 
+  // The offsets in effect from each transition on, ordered by time. The
+  // offsets in effect before the first transition are kept separately.
+  std::vector<Transition> transitions_;
+  int32_t initial_raw_offset_;
+  int32_t initial_dst_offset_;
+  bool transitions_valid_;
+  // The index of the last transition found, as subsequent lookups tend to be
+  // close to each other.
+  size_t last_transition_index_;
+
   std::string timezone_name_;
   std::string dst_timezone_name_;
 };
@@ -2691,10 +2720,68 @@ icu::TimeZone* ICUTimezoneCache::GetTimeZone() {
   return timezone_;
 }
 
+void ICUTimezoneCache::BuildTransitionTable() {
+  DCHECK(!transitions_valid_);
+  DCHECK(transitions_.empty());
+  transitions_valid_ = true;
+  last_transition_index_ = 0;
+  // Note that casting TimeZone to BasicTimeZone is safe because we know that
+  // icu::TimeZone used here is a BasicTimeZone.
+  const icu::BasicTimeZone* time_zone =
+      static_cast<const icu::BasicTimeZone*>(GetTimeZone());
+  UErrorCode status = U_ZERO_ERROR;
+  time_zone->getOffset(-DateCache::kMaxTimeInMs, false, initial_raw_offset_,
+                       initial_dst_offset_, status);
+  if (U_FAILURE(status)) {
+    initial_raw_offset_ = 0;
+    initial_dst_offset_ = 0;
+  }
+  icu::TimeZoneTransition transition;
+  double time_ms = -DateCache::kMaxTimeInMs;
+  while (time_zone->getNextTransition(time_ms, false, transition)) {
+    time_ms = transition.getTime();
+    if (time_ms >= kTransitionTableEndMs) break;
+    const icu::TimeZoneRule* rule = transition.getTo();
+    DCHECK_NOT_NULL(rule);
+    transitions_.push_back(
+        {time_ms, rule->getRawOffset(), rule->getDSTSavings()});
+  }
+}
+
+bool ICUTimezoneCache::LookupOffsets(double time_ms, int32_t* raw_offset,
+                                     int32_t* dst_offset) {
+  // This also rejects NaN.
+  if (!(time_ms < kTransitionTableEndMs)) return false;
+  if (!transitions_valid_) BuildTransitionTable();
+
+  // Find the number of transitions at or before the given time, checking the
+  // last result first.
+  size_t index = last_transition_index_;
+  DCHECK_LE(index, transitions_.size());
+  if ((index > 0 && time_ms < transitions_[index - 1].time_ms) ||
+      (index < transitions_.size() && transitions_[index].time_ms <= time_ms)) {
+    index = std::upper_bound(transitions_.begin(), transitions_.end(), time_ms,
+                             [](double time_ms, const Transition& transition) {
+                               return time_ms < transition.time_ms;
+                             }) -
+            transitions_.begin();
+    last_transition_index_ = index;
+  }
+  if (index == 0) {
+    *raw_offset = initial_raw_offset_;
+    *dst_offset = initial_dst_offset_;
+  } else {
+    *raw_offset = transitions_[index - 1].raw_offset;
+    *dst_offset = transitions_[index - 1].dst_offset;
+  }
+  return true;
+}
+
 bool ICUTimezoneCache::GetOffsets(double time_ms, bool is_utc,
                                   int32_t* raw_offset, int32_t* dst_offset) {
   UErrorCode status = U_ZERO_ERROR;
   if (is_utc) {
+    if (LookupOffsets(time_ms, raw_offset, dst_offset)) return true;
     GetTimeZone()->getOffset(time_ms, false, *raw_offset, *dst_offset, status);
   } else {
     // Note that casting TimeZone to BasicTimeZone is safe because we know that
@@ -2723,6 +2810,9 @@ double ICUTimezoneCache::LocalTimeOffset(double time_ms, bool is_utc) {
 void ICUTimezoneCache::Clear(TimeZoneDetection time_zone_detection) {
   delete timezone_;
   timezone_ = nullptr;
+  transitions_.clear();
+  transitions_valid_ = false;
+  last_transition_index_ = 0;
   timezone_name_.clear();
   dst_timezone_name_.clear();
   if (time_zone_detection == TimeZoneDetection::kRedetect) {
@@ -216,7 +216,7 @@ ArrayBufferExtension* JSArrayBuffer::EnsureExtension() {
   ArrayBufferExtension* extension = this->extension();
   if (extension != nullptr) return extension;
 
-  extension = new ArrayBufferExtension(std::shared_ptr<BackingStore>());
+  extension = GetIsolate()->heap()->AllocateArrayBufferExtension(*this);
   set_extension(extension);
   return extension;
 }
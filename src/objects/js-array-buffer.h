@@ -127,8 +127,8 @@ class JSArrayBuffer
       ShouldThrow should_throw, size_t* page_size, size_t* initial_pages,
       size_t* max_pages);
 
-  // Allocates an ArrayBufferExtension for this array buffer, unless it is
-  // already associated with an extension.
+  // Allocates an ArrayBufferExtension for this array buffer from the heap's
+  // extension slabs, unless it is already associated with an extension.
   ArrayBufferExtension* EnsureExtension();
 
   // Frees the associated ArrayBufferExtension and returns its backing store.
@@ -180,11 +180,11 @@ class JSArrayBuffer
 
 // Each JSArrayBuffer (with a backing store) has a corresponding native-heap
 // allocated ArrayBufferExtension for GC purposes and storing the backing store.
-// When marking a JSArrayBuffer, the GC also marks the native
-// extension-object. The GC periodically iterates all extensions concurrently
-// and frees unmarked ones.
+// Extensions are allocated in slabs owned by the ArrayBufferSweeper. When
+// marking a JSArrayBuffer, the GC also marks the native extension-object. The
+// GC periodically iterates all extensions concurrently and frees unmarked ones.
 // https://docs.google.com/document/d/1-ZrLdlFX1nXT3z-FAgLbKal1gI8Auiaya_My-a0UJ28/edit
-class ArrayBufferExtension final : public Malloced {
+class ArrayBufferExtension final {
  public:
   ArrayBufferExtension() : backing_store_(std::shared_ptr<BackingStore>()) {}
   explicit ArrayBufferExtension(std::shared_ptr<BackingStore> backing_store)
@@ -226,16 +226,12 @@ class ArrayBufferExtension final : public Malloced {
 
   void reset_backing_store() { backing_store_.reset(); }
 
-  ArrayBufferExtension* next() const { return next_; }
-  void set_next(ArrayBufferExtension* extension) { next_ = extension; }
-
  private:
   enum class GcState : uint8_t { Dead = 0, Copied, Promoted };
 
   std::atomic<bool> marked_{false};
   std::atomic<GcState> young_gc_state_{GcState::Dead};
   std::shared_ptr<BackingStore> backing_store_;
-  ArrayBufferExtension* next_ = nullptr;
   std::atomic<size_t> accounting_length_{0};
 
   GcState young_gc_state() const {
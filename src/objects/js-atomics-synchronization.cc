@@ -343,7 +343,12 @@ void JSAtomicsMutex::LockSlowPath(Isolate* requester,
     int backoff = 1;
     StateT current_state = state->load(std::memory_order_relaxed);
     do {
-      if (TryLockExplicit(state, current_state)) return;
+      // Only try to take the lock if it looks free, so that spinning threads
+      // don't steal the state's cache line from the lock owner.
+      if (!(current_state & kIsLockedBit) &&
+          TryLockExplicit(state, current_state)) {
+        return;
+      }
 
       for (int yields = 0; yields < backoff; yields++) {
         YIELD_PROCESSOR;
@@ -351,6 +356,7 @@ void JSAtomicsMutex::LockSlowPath(Isolate* requester,
       }
 
       backoff = std::min(kMaxBackoff, backoff << 1);
+      current_state = state->load(std::memory_order_relaxed);
     } while (tries < kSpinCount);
 
     // At this point the lock is considered contended, so try to go to sleep and
@@ -589,7 +589,6 @@ void JSFunction::CreateAndAttachFeedbackVector(
   Handle<FeedbackVector> feedback_vector = FeedbackVector::New(
       isolate, shared, closure_feedback_cell_array,
       handle(function->raw_feedback_cell(isolate), isolate), compiled_scope);
-  USE(feedback_vector);
   // EnsureClosureFeedbackCellArray should handle the special case where we need
   // to allocate a new feedback cell. Please look at comment in that function
   // for more details.
@@ -597,6 +596,15 @@ void JSFunction::CreateAndAttachFeedbackVector(
          isolate->heap()->many_closures_cell());
   DCHECK_EQ(function->raw_feedback_cell()->value(), *feedback_vector);
   function->SetInterruptBudget(isolate);
+  shared->set_had_feedback_vector(true);
+
+  Counters* counters = isolate->counters();
+  counters->feedback_vectors_created()->Increment();
+  counters->feedback_vectors_bytes()->Increment(feedback_vector->Size());
+  if (TieringManager::FeedbackAllocationDelayFactor(
+          shared->GetBytecodeArray(isolate)->length()) > 1) {
+    counters->feedback_vectors_delayed_by_size()->Increment();
+  }
 
   DCHECK_EQ(v8_flags.log_function_events,
             feedback_vector->log_next_execution());
@@ -634,7 +642,9 @@ void JSFunction::InitializeFeedbackCell(
       // profile and more precise code coverage.
       v8_flags.log_function_events ||
       !isolate->is_best_effort_code_coverage() ||
-      function->shared()->sparkplug_compiled();
+      function->shared()->sparkplug_compiled() ||
+      (v8_flags.allocate_feedback_vector_with_hint &&
+       function->shared()->had_feedback_vector());
 
   if (needs_feedback_vector) {
     CreateAndAttachFeedbackVector(isolate, function, is_compiled_scope);
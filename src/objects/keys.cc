@@ -22,6 +22,7 @@
 #include "src/objects/prototype-info.h"
 #include "src/objects/prototype.h"
 #include "src/objects/slots-atomic-inl.h"
+#include "src/objects/swiss-name-dictionary-inl.h"
 #include "src/utils/identity-map.h"
 #include "src/zone/zone-hashmap.h"
 
@@ -1404,6 +1405,96 @@ Maybe<bool> KeyAccumulator::CollectOwnJSProxyTargetKeys(
   return result;
 }
 
+
+namespace {
+
+// Checks that {keys} are exactly the enumerable string keys of {dictionary},
+// in enumeration order.
+bool HasEnumKeys(ReadOnlyRoots roots, SwissNameDictionary dictionary,
+                 FixedArray keys) {
+  int length = keys->length();
+  int index = 0;
+  for (InternalIndex i : dictionary->IterateEntries()) {
+    Object key;
+    if (!dictionary->ToKey(roots, i, &key)) continue;
+    if (key.IsSymbol() || dictionary->DetailsAt(i).IsDontEnum()) continue;
+    if (index == length || keys->get(index) != key) return false;
+    index++;
+  }
+  return index == length;
+}
+
+}  // namespace
+
+// static
+bool ObjectKeysCache::IsCacheable(JSReceiver object, HeapObject* dictionary) {
+  // Only SwissNameDictionary enumerates its keys in order, which makes
+  // validating an entry a single walk over the dictionary.
+  if (!V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) return false;
+  Map map = object->map();
+  if (!map->is_dictionary_map() || map->IsCustomElementsReceiverMap() ||
+      map->is_access_check_needed() || map->has_named_interceptor() ||
+      map->has_indexed_interceptor() || !object.IsJSObject()) {
+    return false;
+  }
+  JSObject js_object = JSObject::cast(object);
+  ReadOnlyRoots roots = object->GetReadOnlyRoots();
+  FixedArrayBase elements = js_object->elements();
+  if (elements != roots.empty_fixed_array() &&
+      elements != roots.empty_slow_element_dictionary()) {
+    return false;
+  }
+  *dictionary = js_object->property_dictionary_swiss();
+  return true;
+}
+
+// static
+int ObjectKeysCache::EntryIndexFor(HeapObject dictionary) {
+  return (ComputeAddressHash(dictionary.ptr()) & (kEntries - 1)) * kEntrySize;
+}
+
+// static
+MaybeHandle<FixedArray> ObjectKeysCache::Lookup(Isolate* isolate,
+                                                Handle<JSReceiver> object) {
+  DisallowGarbageCollection no_gc;
+  HeapObject dictionary;
+  if (!IsCacheable(*object, &dictionary)) return MaybeHandle<FixedArray>();
+  FixedArray cache = isolate->heap()->object_keys_cache();
+  int index = EntryIndexFor(dictionary);
+  if (cache->get(index + kDictionaryOffset) != dictionary) {
+    return MaybeHandle<FixedArray>();
+  }
+  FixedArray keys = FixedArray::cast(cache->get(index + kKeysOffset));
+  if (!HasEnumKeys(ReadOnlyRoots(isolate),
+                   SwissNameDictionary::cast(dictionary), keys)) {
+    return MaybeHandle<FixedArray>();
+  }
+  return handle(keys, isolate);
+}
+
+// static
+void ObjectKeysCache::Enter(Isolate* isolate, Handle<JSReceiver> object,
+                            Handle<FixedArray> keys) {
+  DisallowGarbageCollection no_gc;
+  HeapObject dictionary;
+  if (keys->length() == 0 || !IsCacheable(*object, &dictionary)) return;
+  DCHECK_EQ(keys->map(), ReadOnlyRoots(isolate).fixed_array_map());
+  DCHECK(HasEnumKeys(ReadOnlyRoots(isolate),
+                     SwissNameDictionary::cast(dictionary), *keys));
+  FixedArray cache = isolate->heap()->object_keys_cache();
+  int index = EntryIndexFor(dictionary);
+  cache->set(index + kDictionaryOffset, dictionary);
+  cache->set(index + kKeysOffset, *keys);
+  keys->set_map_no_write_barrier(ReadOnlyRoots(isolate).fixed_cow_array_map());
+}
+
+// static
+void ObjectKeysCache::Clear(FixedArray cache) {
+  for (int i = 0; i < kSize; i++) {
+    cache->set(i, Smi::zero());
+  }
+}
+
 #undef RETURN_NOTHING_IF_NOT_SUCCESSFUL
 #undef RETURN_FAILURE_IF_NOT_SUCCESSFUL
 }  // namespace internal
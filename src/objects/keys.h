@@ -242,6 +242,37 @@ class FastKeyAccumulator {
   bool only_own_has_simple_elements_ = false;
 };
 
+// Caches the result of Object.keys for dictionary mode objects without
+// elements, which don't have an enum cache. Entries are keyed by the
+// property dictionary and are validated against its current contents on
+// lookup, which is cheaper than collecting (and for NameDictionary, sorting)
+// the keys again and doesn't allocate. The cached key arrays are
+// copy-on-write, so they can be handed out as JSArray backing stores
+// directly. The cache is cleared on every mark-compact.
+class ObjectKeysCache : public AllStatic {
+ public:
+  // Returns the cached keys of {object}, or an empty handle.
+  static MaybeHandle<FixedArray> Lookup(Isolate* isolate,
+                                        Handle<JSReceiver> object);
+  // Caches {keys} for {object} if possible. {keys} must be freshly allocated
+  // and is turned into a copy-on-write array.
+  static void Enter(Isolate* isolate, Handle<JSReceiver> object,
+                    Handle<FixedArray> keys);
+
+  static void Clear(FixedArray cache);
+
+  static constexpr int kEntries = 64;
+  static constexpr int kEntrySize = 2;
+  static constexpr int kSize = kEntries * kEntrySize;
+
+ private:
+  static constexpr int kDictionaryOffset = 0;
+  static constexpr int kKeysOffset = 1;
+
+  static bool IsCacheable(JSReceiver object, HeapObject* dictionary);
+  static int EntryIndexFor(HeapObject dictionary);
+};
+
 }  // namespace internal
 }  // namespace v8
 
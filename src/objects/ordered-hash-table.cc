@@ -275,27 +275,48 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
   int removed_holes_index = 0;
 
   DisallowGarbageCollection no_gc;
+  // The new table is usually young, so we can skip the write barrier.
+  WriteBarrierMode mode = new_table->GetWriteBarrierMode(no_gc);
 
-  for (InternalIndex old_entry : table->IterateEntries()) {
-    int old_entry_raw = old_entry.as_int();
-    Object key = table->KeyAt(old_entry);
-    if (key.IsTheHole(isolate)) {
-      table->SetRemovedIndexAt(removed_holes_index++, old_entry_raw);
-      continue;
+  if (table->NumberOfDeletedElements() == 0) {
+    // Without holes, every entry keeps its index. Copy all entries at once
+    // and only rebuild the buckets and chains afterwards.
+    int nof = table->NumberOfElements();
+    if (nof > 0) {
+      new_table->CopyElements(isolate, new_table->EntryToIndexRaw(0), *table,
+                              table->EntryToIndexRaw(0), nof * kEntrySize,
+                              mode);
+    }
+    for (; new_entry < nof; ++new_entry) {
+      int new_index = new_table->EntryToIndexRaw(new_entry);
+      Object hash = new_table->get(new_index).GetHash();
+      int bucket = Smi::ToInt(hash) & (new_buckets - 1);
+      Object chain_entry = new_table->get(HashTableStartIndex() + bucket);
+      new_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
+      new_table->set(new_index + kChainOffset, chain_entry);
     }
+  } else {
+    for (InternalIndex old_entry : table->IterateEntries()) {
+      int old_entry_raw = old_entry.as_int();
+      Object key = table->KeyAt(old_entry);
+      if (key.IsTheHole(isolate)) {
+        table->SetRemovedIndexAt(removed_holes_index++, old_entry_raw);
+        continue;
+      }
 
-    Object hash = key.GetHash();
-    int bucket = Smi::ToInt(hash) & (new_buckets - 1);
-    Object chain_entry = new_table->get(HashTableStartIndex() + bucket);
-    new_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
-    int new_index = new_table->EntryToIndexRaw(new_entry);
-    int old_index = table->EntryToIndexRaw(old_entry_raw);
-    for (int i = 0; i < entrysize; ++i) {
-      Object value = table->get(old_index + i);
-      new_table->set(new_index + i, value);
+      Object hash = key.GetHash();
+      int bucket = Smi::ToInt(hash) & (new_buckets - 1);
+      Object chain_entry = new_table->get(HashTableStartIndex() + bucket);
+      new_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
+      int new_index = new_table->EntryToIndexRaw(new_entry);
+      int old_index = table->EntryToIndexRaw(old_entry_raw);
+      for (int i = 0; i < entrysize; ++i) {
+        Object value = table->get(old_index + i);
+        new_table->set(new_index + i, value, mode);
+      }
+      new_table->set(new_index + kChainOffset, chain_entry);
+      ++new_entry;
     }
-    new_table->set(new_index + kChainOffset, chain_entry);
-    ++new_entry;
   }
 
   DCHECK_EQ(table->NumberOfDeletedElements(), removed_holes_index);
@@ -284,6 +284,15 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, maglev_compilation_failed,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, sparkplug_compiled,
                     SharedFunctionInfo::SparkplugCompiledBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, inlining_profile_hot,
+                    SharedFunctionInfo::InliningProfileHotBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, maglev_compiled,
+                    SharedFunctionInfo::MaglevCompiledBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, had_feedback_vector,
+                    SharedFunctionInfo::HadFeedbackVectorBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -316,6 +325,8 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, properties_are_final,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags,
                     private_name_lookup_skips_outer_class,
                     SharedFunctionInfo::PrivateNameLookupSkipsOuterClassBit)
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, bytecode_was_flushed,
+                    SharedFunctionInfo::BytecodeWasFlushedBit)
 
 bool SharedFunctionInfo::optimization_disabled() const {
   return disabled_optimization_reason() != BailoutReason::kNoReason;
@@ -845,7 +845,8 @@ void SharedFunctionInfo::UninstallDebugBytecode(SharedFunctionInfo shared,
 // static
 void SharedFunctionInfo::EnsureOldForTesting(SharedFunctionInfo sfi) {
   if (v8_flags.flush_code_based_on_time ||
-      v8_flags.flush_code_based_on_tab_visibility) {
+      v8_flags.flush_code_based_on_tab_visibility ||
+      v8_flags.flush_code_adaptive_age) {
     sfi->set_age(kMaxAge);
   } else {
     sfi->set_age(v8_flags.bytecode_old_age);
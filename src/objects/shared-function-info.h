@@ -461,6 +461,21 @@ class SharedFunctionInfo
 
   DECL_BOOLEAN_ACCESSORS(sparkplug_compiled)
 
+  // True if a previous run recorded this function as inlined by TurboFan, see
+  // compiler::JSInliningProfile.
+  DECL_BOOLEAN_ACCESSORS(inlining_profile_hot)
+
+  // True if this function was successfully compiled with Maglev at some point.
+  // Like sparkplug_compiled, the bit survives the code cache and is used as a
+  // tiering hint after deserialization.
+  DECL_BOOLEAN_ACCESSORS(maglev_compiled)
+
+  // True if a closure of this function has been allocated a feedback vector
+  // at some point. The bit survives the code cache, and with
+  // --allocate-feedback-vector-with-hint new closures get a feedback vector
+  // right away instead of after a few invocations.
+  DECL_BOOLEAN_ACCESSORS(had_feedback_vector)
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
@@ -507,6 +522,10 @@ class SharedFunctionInfo
   // closest outer class scope.
   DECL_BOOLEAN_ACCESSORS(private_name_lookup_skips_outer_class)
 
+  // Indicates that the function's bytecode was flushed and it hasn't been
+  // recompiled since. Used to measure how often flushing was premature.
+  DECL_BOOLEAN_ACCESSORS(bytecode_was_flushed)
+
   inline FunctionKind kind() const;
 
   // Defines the index in a native context of closure's map instantiated using
@@ -424,6 +424,23 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
       array_start, array_len, from_index, search_element);
 }
 
+uintptr_t TypedArrayIndexOf(uint32_t* array, uintptr_t array_len,
+                            uintptr_t from_index, uint32_t search_element) {
+  return search<uint32_t>(array, array_len, from_index, search_element);
+}
+
+uintptr_t TypedArrayIndexOf(uint64_t* array, uintptr_t array_len,
+                            uintptr_t from_index, uint64_t search_element) {
+  return search<uint64_t>(array, array_len, from_index, search_element);
+}
+
+uintptr_t TypedArrayIndexOf(double* array, uintptr_t array_len,
+                            uintptr_t from_index, double search_element) {
+  // NaN is never equal to anything; callers handle it separately.
+  DCHECK(!std::isnan(search_element));
+  return search<double>(array, array_len, from_index, search_element);
+}
+
 #ifdef NEON64
 #undef NEON64
 #endif
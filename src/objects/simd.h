@@ -20,6 +20,17 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
                                      uintptr_t from_index,
                                      Address search_element);
 
+// Return the index of the first element of the typed array backing store
+// |array| in [from_index, array_len) that is equal to |search_element|, or -1.
+// The backing store must not be shared, since the elements are read with
+// plain (vector) loads, and must be aligned to the element size.
+uintptr_t TypedArrayIndexOf(uint32_t* array, uintptr_t array_len,
+                            uintptr_t from_index, uint32_t search_element);
+uintptr_t TypedArrayIndexOf(uint64_t* array, uintptr_t array_len,
+                            uintptr_t from_index, uint64_t search_element);
+uintptr_t TypedArrayIndexOf(double* array, uintptr_t array_len,
+                            uintptr_t from_index, double search_element);
+
 }  // namespace internal
 }  // namespace v8
 
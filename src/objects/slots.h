@@ -280,6 +280,13 @@ class OffHeapFullObjectSlot : public FullObjectSlot {
 
   using FullObjectSlot::Relaxed_Load;
   inline Object Relaxed_Load() const = delete;
+
+  using FullObjectSlot::Release_CompareAndSwap;
+  // Same signature as OffHeapCompressedObjectSlot's.
+  inline Object Release_CompareAndSwap(PtrComprCageBase cage_base, Object old,
+                                       Object target) const {
+    return Release_CompareAndSwap(old, target);
+  }
 };
 
 // An ExternalPointerSlot instance describes a kExternalPointerSlotSize-sized
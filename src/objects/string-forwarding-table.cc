@@ -161,6 +161,7 @@ StringForwardingTable::StringForwardingTable(Isolate* isolate)
 }
 
 StringForwardingTable::~StringForwardingTable() {
+  FreeRetiredBlocks();
   BlockVector* blocks = blocks_.load(std::memory_order_relaxed);
   for (uint32_t block_index = 0; block_index < blocks->size(); block_index++) {
     delete blocks->LoadBlock(block_index);
@@ -334,19 +335,34 @@ void StringForwardingTable::TearDown() {
 }
 
 void StringForwardingTable::Reset() {
+  ResetAndRetireBlocks();
+  FreeRetiredBlocks();
+}
+
+void StringForwardingTable::ResetAndRetireBlocks() {
   isolate_->heap()->safepoint()->AssertActive();
   DCHECK_NE(isolate_->heap()->gc_state(), Heap::NOT_IN_GC);
+  DCHECK_NULL(retired_blocks_);
 
-  BlockVector* blocks = blocks_.load(std::memory_order_relaxed);
-  for (uint32_t block_index = 0; block_index < blocks->size(); ++block_index) {
-    delete blocks->LoadBlock(block_index);
-  }
-
+  // The current BlockVector holds all blocks, older ones are only kept alive
+  // for concurrent readers.
+  retired_blocks_ = blocks_.load(std::memory_order_relaxed);
+  retired_block_vector_storage_ = std::move(block_vector_storage_);
   block_vector_storage_.clear();
   InitializeBlockVector();
   next_free_index_ = 0;
 }
 
+void StringForwardingTable::FreeRetiredBlocks() {
+  if (retired_blocks_ == nullptr) return;
+  for (uint32_t block_index = 0; block_index < retired_blocks_->size();
+       ++block_index) {
+    delete retired_blocks_->LoadBlock(block_index);
+  }
+  retired_blocks_ = nullptr;
+  retired_block_vector_storage_.clear();
+}
+
 void StringForwardingTable::UpdateAfterYoungEvacuation() {
   // This is only used for the Scavenger.
   DCHECK(!v8_flags.minor_ms);
@@ -65,6 +65,10 @@ class StringForwardingTable {
   // Dispose all external resources stored in the table.
   void TearDown();
   void Reset();
+  // Like Reset(), but keeps the memory of the old records alive until
+  // FreeRetiredBlocks(), which may be called from a background thread.
+  void ResetAndRetireBlocks();
+  void FreeRetiredBlocks();
   void UpdateAfterYoungEvacuation();
   void UpdateAfterFullEvacuation();
 
@@ -95,6 +99,9 @@ class StringForwardingTable {
   // held. All regular access go through |block_|, which holds a pointer to the
   // current BlockVector.
   std::vector<std::unique_ptr<BlockVector>> block_vector_storage_;
+  // The blocks of the table before the last ResetAndRetireBlocks().
+  BlockVector* retired_blocks_ = nullptr;
+  std::vector<std::unique_ptr<BlockVector>> retired_block_vector_storage_;
   std::atomic<int> next_free_index_;
   base::Mutex grow_mutex_;
 };
@@ -1430,6 +1430,84 @@ void StringCharacterStream::VisitTwoByteString(const uint16_t* chars,
   end_ = reinterpret_cast<const uint8_t*>(chars + length);
 }
 
+// Iterates over the flat segments of a string starting at an offset, i.e.
+// the leaves of its ConsString tree. Unlike String::Flatten, this doesn't
+// allocate, so large ropes that are only read once can be scanned without
+// copying them. Segments may be empty, and their encodings may differ.
+class StringSegmentIterator {
+ public:
+  inline StringSegmentIterator(String string, int offset,
+                               const DisallowGarbageCollection& no_gc);
+  StringSegmentIterator(const StringSegmentIterator&) = delete;
+  StringSegmentIterator& operator=(const StringSegmentIterator&) = delete;
+
+  // Advances to the next segment, or returns false if there is none. Has to
+  // be called before accessing the first segment.
+  inline bool Next();
+
+  bool IsOneByte() const { return is_one_byte_; }
+  int length() const { return length_; }
+  base::Vector<const uint8_t> ToOneByteVector() const {
+    DCHECK(is_one_byte_);
+    return base::Vector<const uint8_t>(chars8_, length_);
+  }
+  base::Vector<const base::uc16> ToUC16Vector() const {
+    DCHECK(!is_one_byte_);
+    return base::Vector<const base::uc16>(chars16_, length_);
+  }
+
+  inline void VisitOneByteString(const uint8_t* chars, int length);
+  inline void VisitTwoByteString(const uint16_t* chars, int length);
+
+ private:
+  ConsStringIterator iter_;
+  bool started_ = false;
+  bool is_one_byte_ = true;
+  union {
+    const uint8_t* chars8_;
+    const uint16_t* chars16_;
+  };
+  int length_ = 0;
+};
+
+StringSegmentIterator::StringSegmentIterator(
+    String string, int offset, const DisallowGarbageCollection& no_gc)
+    : chars8_(nullptr) {
+  ConsString cons_string = String::VisitFlat(this, string, offset);
+  iter_.Reset(cons_string, offset);
+  if (!cons_string.is_null()) {
+    string = iter_.Next(&offset);
+    if (!string.is_null()) String::VisitFlat(this, string, offset);
+  }
+}
+
+bool StringSegmentIterator::Next() {
+  if (!started_) {
+    started_ = true;
+    return true;
+  }
+  int offset;
+  String string = iter_.Next(&offset);
+  if (string.is_null()) return false;
+  DCHECK_EQ(offset, 0);
+  String::VisitFlat(this, string, 0);
+  return true;
+}
+
+void StringSegmentIterator::VisitOneByteString(const uint8_t* chars,
+                                               int length) {
+  is_one_byte_ = true;
+  chars8_ = chars;
+  length_ = length;
+}
+
+void StringSegmentIterator::VisitTwoByteString(const uint16_t* chars,
+                                               int length) {
+  is_one_byte_ = false;
+  chars16_ = chars;
+  length_ = length;
+}
+
 bool String::AsArrayIndex(uint32_t* index) {
   DisallowGarbageCollection no_gc;
   uint32_t field = raw_hash_field();
@@ -88,6 +88,10 @@ bool KeyIsMatch(IsolateT* isolate, StringTableKey* key, String string) {
 // The elements themselves are stored as an open-addressed hash table, with
 // quadratic probing and Smi 0 and Smi 1 as the empty and deleted sentinels,
 // respectively.
+//
+// Outside of GCs, entries only ever change from a sentinel to a string. This
+// allows concurrent inserters to claim free entries with compare-and-swap, see
+// InsertConcurrently.
 class StringTable::Data {
  public:
   static std::unique_ptr<Data> New(int capacity);
@@ -106,25 +110,47 @@ class StringTable::Data {
     slot(index).Release_Store(entry);
   }
 
+  // Stores `entry` at `index` if it still holds the sentinel `expected`.
+  bool TrySet(PtrComprCageBase cage_base, InternalIndex index, Smi expected,
+              String entry) {
+    return slot(index).Release_CompareAndSwap(cage_base, expected, entry) ==
+           expected;
+  }
+
   void ElementAdded() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
+    DCHECK_LT(number_of_elements() + 1, capacity());
     DCHECK(StringTableHasSufficientCapacityToAdd(
         capacity(), number_of_elements(), number_of_deleted_elements(), 1));
 
-    number_of_elements_++;
+    number_of_elements_.fetch_add(1, std::memory_order_relaxed);
   }
   void DeletedElementOverwritten() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
+    DCHECK_LT(number_of_elements() + 1, capacity());
     DCHECK(StringTableHasSufficientCapacityToAdd(
         capacity(), number_of_elements(), number_of_deleted_elements() - 1, 1));
 
-    number_of_elements_++;
-    number_of_deleted_elements_--;
+    number_of_elements_.fetch_add(1, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_sub(1, std::memory_order_relaxed);
   }
   void ElementsRemoved(int count) {
-    DCHECK_LE(count, number_of_elements_);
-    number_of_elements_ -= count;
-    number_of_deleted_elements_ += count;
+    DCHECK_LE(count, number_of_elements());
+    number_of_elements_.fetch_sub(count, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  // Accounts for one more element ahead of a concurrent insertion. Returns
+  // false if the table should be resized first, which requires exclusive
+  // access.
+  bool TryReserveElement() {
+    int nof = number_of_elements_.fetch_add(1, std::memory_order_relaxed);
+    if (ComputeStringTableCapacityWithShrink(capacity(), nof + 1) ==
+            capacity() &&
+        StringTableHasSufficientCapacityToAdd(
+            capacity(), nof, number_of_deleted_elements(), 1)) {
+      return true;
+    }
+    number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
   }
 
   void* operator new(size_t size, int capacity);
@@ -132,8 +158,12 @@ class StringTable::Data {
   void operator delete(void* description);
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
-  int number_of_deleted_elements() const { return number_of_deleted_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
+  int number_of_deleted_elements() const {
+    return number_of_deleted_elements_.load(std::memory_order_relaxed);
+  }
 
   template <typename IsolateT, typename StringTableKey>
   InternalIndex FindEntry(IsolateT* isolate, StringTableKey* key,
@@ -147,6 +177,12 @@ class StringTable::Data {
                                           StringTableKey* key,
                                           uint32_t hash) const;
 
+  // Returns the string matching `key`, inserting it if there is none. Other
+  // threads may insert at the same time. The caller must have reserved an
+  // element with TryReserveElement.
+  template <typename IsolateT, typename StringTableKey>
+  Handle<String> InsertConcurrently(IsolateT* isolate, StringTableKey* key);
+
   // Helper method for StringTable::TryStringToIndexOrLookupExisting.
   template <typename Char>
   static Address TryStringToIndexOrLookupExisting(Isolate* isolate,
@@ -154,6 +190,7 @@ class StringTable::Data {
                                                   size_t start);
 
   void IterateElements(RootVisitor* visitor);
+  void IterateElements(RootVisitor* visitor, int start, int end);
 
   Data* PreviousData() { return previous_data_.get(); }
   void DropPreviousData() { previous_data_.reset(); }
@@ -176,8 +213,8 @@ class StringTable::Data {
 
  private:
   std::unique_ptr<Data> previous_data_;
-  int number_of_elements_;
-  int number_of_deleted_elements_;
+  std::atomic<int> number_of_elements_;
+  std::atomic<int> number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
 };
@@ -243,7 +280,8 @@ std::unique_ptr<StringTable::Data> StringTable::Data::Resize(
         new_data->FindInsertionEntry(cage_base, hash);
     new_data->Set(insertion_index, string);
   }
-  new_data->number_of_elements_ = data->number_of_elements();
+  new_data->number_of_elements_.store(data->number_of_elements(),
+                                      std::memory_order_relaxed);
 
   new_data->previous_data_ = std::move(data);
   return new_data;
@@ -310,9 +348,79 @@ InternalIndex StringTable::Data::FindEntryOrInsertionEntry(
   }
 }
 
+template <typename IsolateT, typename StringTableKey>
+Handle<String> StringTable::Data::InsertConcurrently(IsolateT* isolate,
+                                                     StringTableKey* key) {
+  // All threads inserting the same key follow the same probe sequence and try
+  // to claim the first free entry on it that they saw. Since entries never
+  // become free again, a thread that loses the race for an entry finds either
+  // the string that won it, or a later free entry that all other inserters of
+  // the key will also see.
+  const uint32_t hash = key->hash();
+  InternalIndex insertion_entry = InternalIndex::NotFound();
+  Smi insertion_element = empty_element();
+  uint32_t insertion_count = 0;
+  uint32_t count = 1;
+  // The reservation guarantees that the hash table is never full.
+  for (InternalIndex entry = FirstProbe(hash, capacity_);;
+       entry = NextProbe(entry, count++, capacity_)) {
+    Object element = Get(isolate, entry);
+    if (element == deleted_element()) {
+      // Deleted entries are insertion candidates, but the key may still come
+      // later in the probe sequence.
+      if (insertion_entry.is_not_found()) {
+        insertion_entry = entry;
+        insertion_element = deleted_element();
+        insertion_count = count;
+      }
+      continue;
+    }
+    if (element != empty_element()) {
+      String string = String::cast(element);
+      if (KeyIsMatch(isolate, key, string)) {
+        number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
+        return handle(string, isolate);
+      }
+      continue;
+    }
+
+    if (insertion_entry.is_not_found()) {
+      insertion_entry = entry;
+      insertion_element = empty_element();
+      insertion_count = count;
+    }
+    Handle<String> new_string = key->GetHandleForInsertion();
+    DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+    if (TrySet(isolate, insertion_entry, insertion_element, *new_string)) {
+      if (insertion_element == deleted_element()) {
+        number_of_deleted_elements_.fetch_sub(1, std::memory_order_relaxed);
+      }
+      return new_string;
+    }
+    // Another thread claimed the entry first, possibly for the same key, so
+    // continue the search from there.
+    entry = insertion_entry;
+    count = insertion_count;
+    insertion_entry = InternalIndex::NotFound();
+    Object winner = Get(isolate, entry);
+    if (KeyIsMatch(isolate, key, String::cast(winner))) {
+      number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
+      return handle(String::cast(winner), isolate);
+    }
+  }
+}
+
 void StringTable::Data::IterateElements(RootVisitor* visitor) {
-  OffHeapObjectSlot first_slot = slot(InternalIndex(0));
-  OffHeapObjectSlot end_slot = slot(InternalIndex(capacity_));
+  IterateElements(visitor, 0, capacity_);
+}
+
+void StringTable::Data::IterateElements(RootVisitor* visitor, int start,
+                                        int end) {
+  DCHECK_LE(0, start);
+  DCHECK_LE(start, end);
+  DCHECK_LE(end, capacity_);
+  OffHeapObjectSlot first_slot = slot(InternalIndex(start));
+  OffHeapObjectSlot end_slot = slot(InternalIndex(end));
   visitor->VisitRootPointers(Root::kStringTable, nullptr, first_slot, end_slot);
 }
 
@@ -335,10 +443,7 @@ int StringTable::Capacity() const {
   return data_.load(std::memory_order_acquire)->capacity();
 }
 int StringTable::NumberOfElements() const {
-  {
-    base::MutexGuard table_write_guard(&write_mutex_);
-    return data_.load(std::memory_order_relaxed)->number_of_elements();
-  }
+  return data_.load(std::memory_order_acquire)->number_of_elements();
 }
 
 // InternalizedStringKey carries a string/internalized-string object as key.
@@ -424,7 +529,8 @@ class InternalizedStringKey final : public StringTableKey {
       // It is always safe to overwrite the map. The only transition possible
       // is another thread migrated the string to internalized already.
       // Migrations to thin are impossible, as we only call this method on table
-      // misses inside the critical section.
+      // misses inside the exclusive critical section (see
+      // MustInsertExclusively).
       string_->set_map_safe_transition_no_write_barrier(*internalized_map);
       DCHECK(string_->IsInternalizedString());
       return string_;
@@ -439,6 +545,12 @@ class InternalizedStringKey final : public StringTableKey {
     return internalized_string_.ToHandleChecked();
   }
 
+  // An in-place transition can't be undone if another thread inserts an equal
+  // string first.
+  bool MustInsertExclusively() const {
+    return !maybe_internalized_map_.is_null();
+  }
+
  private:
   Handle<String> string_;
   // Copy of the string to be internalized (only set if the string is not
@@ -557,7 +669,8 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
   //   - All writes to the string table are guarded by the Isolate string table
-  //     mutex,
+  //     mutex, and only change entries from a sentinel to a string while it is
+  //     held shared,
   //   - Resizes of the string table first copies the old contents to the new
   //     table, and only then sets the new string table pointer to the new
   //     table,
@@ -577,7 +690,10 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   // We therefore try to optimistically read from the string table without
   // taking the lock (both here and in the NoAllocate version of the lookup),
   // and on a miss we take the lock and try to write the entry, with a second
-  // read lookup in case the non-locked read missed a write.
+  // read lookup in case the non-locked read missed a write. Most writes only
+  // need the lock shared, and race other writers with compare-and-swap on the
+  // entries; only resizes and in-place transitions of the key need it
+  // exclusively.
   //
   // One complication is allocation -- we don't want to allocate while holding
   // the string table lock. This applies to both allocation of new strings, and
@@ -605,8 +721,16 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
 
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
+  if (!key->MustInsertExclusively()) {
+    base::SharedMutexGuard<base::kShared> table_write_guard(&write_mutex_);
+    // The data can only be replaced while the lock is held exclusively.
+    Data* data = data_.load(std::memory_order_relaxed);
+    if (data->TryReserveElement()) {
+      return data->InsertConcurrently(isolate, key);
+    }
+  }
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
 
     Data* data = EnsureCapacity(isolate, 1);
 
@@ -659,8 +783,7 @@ template Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
 
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
+  // This call is only allowed while the write mutex is held exclusively.
 
   // This load can be relaxed as the table pointer can only be modified while
   // the lock is held.
@@ -844,6 +967,13 @@ void StringTable::IterateElements(RootVisitor* visitor) {
   data_.load(std::memory_order_relaxed)->IterateElements(visitor);
 }
 
+void StringTable::IterateElements(RootVisitor* visitor, int start, int end) {
+  // This should only happen during garbage collection when background threads
+  // are paused, so the load can be relaxed.
+  isolate_->heap()->safepoint()->AssertActive();
+  data_.load(std::memory_order_relaxed)->IterateElements(visitor, start, end);
+}
+
 void StringTable::DropOldData() {
   // This should only happen during garbage collection when background threads
   // are paused, so the load can be relaxed.
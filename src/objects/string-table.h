@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_STRING_TABLE_H_
 #define V8_OBJECTS_STRING_TABLE_H_
 
+#include "src/base/platform/mutex.h"
 #include "src/common/assert-scope.h"
 #include "src/objects/string.h"
 #include "src/roots/roots.h"
@@ -30,6 +31,11 @@ class StringTableKey {
   inline uint32_t hash() const;
   int length() const { return length_; }
 
+  // Whether GetHandleForInsertion has side effects that must only happen once
+  // the key is known to be missing from the table (e.g. transitioning the
+  // string in-place), which rules out racing other inserters for a slot.
+  bool MustInsertExclusively() const { return false; }
+
  protected:
   inline void set_raw_hash_field(uint32_t raw_hash_field);
 
@@ -78,6 +84,9 @@ class V8_EXPORT_PRIVATE StringTable {
   // The following methods must be called either while holding the write lock,
   // or while in a Heap safepoint.
   void IterateElements(RootVisitor* visitor);
+  // Visits the entries in [start, end). Disjoint ranges may be visited
+  // concurrently.
+  void IterateElements(RootVisitor* visitor, int start, int end);
   void DropOldData();
   void NotifyElementsRemoved(int count);
 
@@ -89,9 +98,10 @@ class V8_EXPORT_PRIVATE StringTable {
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
   std::atomic<Data*> data_;
-  // Write mutex is mutable so that readers of concurrently mutated values (e.g.
-  // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  // Inserts into free slots of the current data take this mutex shared and
+  // race for slots with compare-and-swap. Replacing the data on resize, and
+  // inserts of keys that MustInsertExclusively, take it exclusively.
+  base::SharedMutex write_mutex_;
   Isolate* isolate_;
 };
 
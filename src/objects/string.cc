@@ -473,6 +473,10 @@ bool String::MakeExternal(v8::String::ExternalStringResource* resource) {
   isolate->heap()->RegisterExternalString(*this);
   // Force regeneration of the hash value.
   if (is_internalized) self->EnsureHash();
+  uint32_t raw_hash = self->raw_hash_field();
+  if (IsHashFieldComputed(raw_hash)) {
+    self->CacheRawHashInResource(raw_hash, HashSeed(isolate));
+  }
   return true;
 }
 
@@ -560,6 +564,10 @@ bool String::MakeExternal(v8::String::ExternalOneByteStringResource* resource) {
   isolate->heap()->RegisterExternalString(*this);
   // Force regeneration of the hash value.
   if (is_internalized) self->EnsureHash();
+  uint32_t raw_hash = self->raw_hash_field();
+  if (IsHashFieldComputed(raw_hash)) {
+    self->CacheRawHashInResource(raw_hash, HashSeed(isolate));
+  }
   return true;
 }
 
@@ -1307,6 +1315,66 @@ int SearchString(Isolate* isolate, String::FlatContent receiver_content,
                       start_index);
 }
 
+// Ropes are searched segment by segment if the pattern is at most this long.
+// Matches that span segments are found in a window of the last characters of
+// the previous segments and the first ones of the next.
+constexpr int kMaxSegmentedSearchPatternLength = 32;
+
+// Returns the index of the first match that ends in {segment}, given the
+// characters in front of it in {carry}, and updates {carry} for the next
+// segment.
+template <typename SubjectChar, typename PatternChar>
+int SearchSegment(Isolate* isolate, base::Vector<const SubjectChar> segment,
+                  base::Vector<const PatternChar> pattern, int segment_start,
+                  base::uc16* carry, int* carry_length) {
+  const int overlap = pattern.length() - 1;
+  const int head = std::min(segment.length(), overlap);
+  CopyChars(carry + *carry_length, segment.begin(), head);
+  const int window_length = *carry_length + head;
+  // A match that begins in the previous segments ends before any match that
+  // begins in this one.
+  for (int i = 0; i < *carry_length && i + pattern.length() <= window_length;
+       i++) {
+    if (CompareCharsEqual(carry + i, pattern.begin(), pattern.length())) {
+      return segment_start - *carry_length + i;
+    }
+  }
+  if (segment.length() >= pattern.length()) {
+    int index = SearchString(isolate, segment, pattern, 0);
+    if (index != -1) return segment_start + index;
+    CopyChars(carry, segment.end() - overlap, overlap);
+    *carry_length = overlap;
+  } else {
+    const int keep = std::min(window_length, overlap);
+    MemMove(carry, carry + window_length - keep, keep * sizeof(base::uc16));
+    *carry_length = keep;
+  }
+  return -1;
+}
+
+template <typename PatternChar>
+int SearchStringSegments(Isolate* isolate, String receiver,
+                         base::Vector<const PatternChar> pattern,
+                         int start_index,
+                         const DisallowGarbageCollection& no_gc) {
+  DCHECK_LE(pattern.length(), kMaxSegmentedSearchPatternLength);
+  base::uc16 carry[2 * kMaxSegmentedSearchPatternLength];
+  int carry_length = 0;
+  int segment_start = start_index;
+  StringSegmentIterator segments(receiver, start_index, no_gc);
+  while (segments.Next()) {
+    int index =
+        segments.IsOneByte()
+            ? SearchSegment(isolate, segments.ToOneByteVector(), pattern,
+                            segment_start, carry, &carry_length)
+            : SearchSegment(isolate, segments.ToUC16Vector(), pattern,
+                            segment_start, carry, &carry_length);
+    if (index != -1) return index;
+    segment_start += segments.length();
+  }
+  return -1;
+}
+
 }  // namespace
 
 int String::IndexOf(Isolate* isolate, Handle<String> receiver,
@@ -1320,8 +1388,22 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
-  receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
+  if (receiver->IsConsString() && !receiver->IsFlat() &&
+      search_length <= kMaxSegmentedSearchPatternLength) {
+    // Scan the rope in place instead of copying it.
+    DisallowGarbageCollection no_gc;
+    String::FlatContent search_content = search->GetFlatContent(no_gc);
+    if (search_content.IsOneByte()) {
+      return SearchStringSegments(isolate, *receiver,
+                                  search_content.ToOneByteVector(),
+                                  start_index, no_gc);
+    }
+    return SearchStringSegments(isolate, *receiver,
+                                search_content.ToUC16Vector(), start_index,
+                                no_gc);
+  }
+  receiver = String::Flatten(isolate, receiver);
 
   DisallowGarbageCollection no_gc;  // ensure vectors stay valid
   // Extract flattened substrings of cons strings before getting encoding.
@@ -1724,6 +1806,9 @@ uint32_t String::ComputeAndSetRawHash(
           : HashString<uint16_t>(string, start, length(), seed, cage_base,
                                  access_guard);
   set_raw_hash_field_if_empty(raw_hash_field);
+  if (shape.IsExternal() && string == *this) {
+    ExternalString::cast(string)->CacheRawHashInResource(raw_hash_field, seed);
+  }
   // Check the hash code is there (or a forwarding index if the string was
   // internalized/externalized in parallel).
   DCHECK(HasHashCode() || HasForwardingIndex(kAcquireLoad));
@@ -1903,6 +1988,41 @@ int ExternalString::ExternalPayloadSize() const {
   return length() * length_multiplier;
 }
 
+namespace {
+
+// The hash is only valid for the seed it was computed with, which is why the
+// resource gets both. The hash only depends on the lower half of the seed.
+uint64_t EncodeCachedRawHash(uint32_t raw_hash, uint64_t seed) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(seed)) << 32) | raw_hash;
+}
+
+}  // namespace
+
+void ExternalString::CacheRawHashInResource(uint32_t raw_hash,
+                                            uint64_t seed) {
+  DCHECK(IsHashFieldComputed(raw_hash));
+  const v8::String::ExternalStringResourceBase* resource =
+      IsOneByteRepresentation()
+          ? static_cast<const v8::String::ExternalStringResourceBase*>(
+                ExternalOneByteString::cast(*this)->resource())
+          : ExternalTwoByteString::cast(*this)->resource();
+  if (resource == nullptr) return;
+  resource->SetCachedHash(EncodeCachedRawHash(raw_hash, seed));
+}
+
+// static
+uint32_t ExternalString::GetRawHashCachedInResource(
+    const v8::String::ExternalStringResourceBase* resource, uint64_t seed) {
+  uint64_t cached;
+  if (!resource->GetCachedHash(&cached)) return kEmptyHashField;
+  uint32_t raw_hash = static_cast<uint32_t>(cached);
+  if (cached != EncodeCachedRawHash(raw_hash, seed) ||
+      !IsHashFieldComputed(raw_hash)) {
+    return kEmptyHashField;
+  }
+  return raw_hash;
+}
+
 FlatStringReader::FlatStringReader(Isolate* isolate, Handle<String> str)
     : Relocatable(isolate), str_(str), length_(str->length()) {
 #if DEBUG
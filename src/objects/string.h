@@ -961,6 +961,14 @@ class ExternalString
   // Disposes string's resource object if it has not already been disposed.
   inline void DisposeResource(Isolate* isolate);
 
+  // Passes the hash of this string to its resource, see
+  // v8::String::ExternalStringResourceBase::SetCachedHash.
+  void CacheRawHashInResource(uint32_t raw_hash, uint64_t seed);
+  // Returns the hash that was cached for `resource`'s contents, or
+  // kEmptyHashField if there is none for `seed`.
+  static uint32_t GetRawHashCachedInResource(
+      const v8::String::ExternalStringResourceBase* resource, uint64_t seed);
+
   static_assert(kResourceOffset == Internals::kStringResourceOffset);
   static const int kSizeOfAllExternalStrings = kHeaderSize;
 
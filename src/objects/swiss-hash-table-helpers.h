@@ -40,6 +40,17 @@
 #error "Bad configuration!"
 #endif
 
+// Taken from Abseil's raw_hash_set.h (but renamed). We only use NEON on
+// little endian arm64, where the byte order of a group matches the portable
+// implementation.
+#ifndef V8_SWISS_TABLE_HAVE_NEON_HOST
+#if defined(__ARM_NEON) && defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN)
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 1
+#else
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 0
+#endif
+#endif
+
 // Unlike Abseil, we cannot select SSE purely by host capabilities. When
 // creating a snapshot, the group width must be compatible. The SSE
 // implementation uses a group width of 16, whereas the non-SSE version uses 8.
@@ -64,6 +75,10 @@
 #include <tmmintrin.h>
 #endif
 
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 namespace swiss_table {
@@ -322,24 +337,37 @@ struct GroupPortableImpl {
   uint64_t ctrl;
 };
 
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+// Counterpart to GroupPortableImpl that uses NEON to compare all bytes of a
+// group at once. Has the same width and produces the same byte masks, so it
+// can be used with snapshots built for the portable implementation. Unlike
+// the portable implementation, Match has no false positives.
+struct GroupNeonImpl {
+  static constexpr size_t kWidth = 8;  // the number of slots per group
+
+  explicit GroupNeonImpl(const ctrl_t* pos)
+      : ctrl(vld1_u8(reinterpret_cast<const uint8_t*>(pos))) {}
+
+  static constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+
+  // Returns a bitmask representing the positions of slots that match |hash|.
+  BitMask<uint64_t, kWidth, 3> Match(h2_t hash) const {
+    uint8x8_t matches = vceq_u8(ctrl, vdup_n_u8(static_cast<uint8_t>(hash)));
+    return BitMask<uint64_t, kWidth, 3>(
+        vget_lane_u64(vreinterpret_u64_u8(matches), 0) & kMsbs);
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  BitMask<uint64_t, kWidth, 3> MatchEmpty() const {
+    return Match(static_cast<h2_t>(kEmpty));
+  }
+
+  uint8x8_t ctrl;
+};
+#endif  // V8_SWISS_TABLE_HAVE_NEON_HOST
+
 // Determine which Group implementation SwissNameDictionary uses.
-#if defined(V8_ENABLE_SWISS_NAME_DICTIONARY) && DEBUG
-// TODO(v8:11388) If v8_enable_swiss_name_dictionary is enabled, we are supposed
-// to use SwissNameDictionary as the dictionary backing store. If we want to use
-// the SIMD version of SwissNameDictionary, that would require us to compile SSE
-// instructions into the snapshot that exceed the minimum requirements for V8
-// SSE support. Therefore, this fails a DCHECK. However, given the experimental
-// nature of v8_enable_swiss_name_dictionary mode, we only except this to be run
-// by developers/bots, that always have the necessary instructions. This means
-// that if v8_enable_swiss_name_dictionary is enabled and debug mode isn't, we
-// ignore the DCHECK that would fail in debug mode. However, if both
-// v8_enable_swiss_name_dictionary and debug mode are enabled, we must fallback
-// to the non-SSE implementation. Given that V8 requires SSE2, there should be a
-// solution that doesn't require the workaround present here. Instead, the
-// backend should only use SSE2 when compiling the SIMD version of
-// SwissNameDictionary into the builtin.
-using Group = GroupPortableImpl;
-#elif V8_SWISS_TABLE_HAVE_SSE2_TARGET
+#if V8_SWISS_TABLE_HAVE_SSE2_TARGET
 // Use a matching group size between host and target.
 #if V8_SWISS_TABLE_HAVE_SSE2_HOST
 using Group = GroupSse2Impl;
@@ -353,6 +381,8 @@ using Group = GroupSse2Impl;
 #endif
 using Group = GroupSse2Polyfill;
 #endif
+#elif V8_SWISS_TABLE_HAVE_NEON_HOST
+using Group = GroupNeonImpl;
 #else
 using Group = GroupPortableImpl;
 #endif
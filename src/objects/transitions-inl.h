@@ -202,6 +202,10 @@ int TransitionArray::SearchSpecial(Symbol symbol, bool concurrent_search,
 int TransitionArray::SearchName(Name name, bool concurrent_search,
                                 int* out_insertion_index) {
   DCHECK(name->IsUniqueName());
+  if (!concurrent_search &&
+      number_of_entries() > kMaxTransitionsForLinearSearch) {
+    return InterpolationSearchName(name, out_insertion_index);
+  }
   return internal::Search<ALL_ENTRIES>(this, name, number_of_entries(),
                                        out_insertion_index, concurrent_search);
 }
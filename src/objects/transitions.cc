@@ -705,6 +705,53 @@ Map TransitionArray::SearchDetailsAndGetTarget(int transition,
   return Map();
 }
 
+int TransitionArray::InterpolationSearchName(Name name,
+                                             int* out_insertion_index) {
+  SLOW_DCHECK(IsSortedNoDuplicates());
+  const uint32_t hash = name->hash();
+  const int nof_transitions = number_of_transitions();
+  // Find the first transition whose key hash is not below {hash}. The keys
+  // of all transitions in [low, high) have hashes in [low_hash, high_hash],
+  // and so does {hash}.
+  int low = 0;
+  int high = nof_transitions;
+  uint32_t low_hash = 0;
+  uint32_t high_hash = Name::HashBits::kMax;
+  bool interpolate = true;
+  while (low < high) {
+    const int size = high - low;
+    int mid;
+    if (interpolate && high_hash > low_hash) {
+      uint64_t offset = static_cast<uint64_t>(hash - low_hash) * size /
+                        (static_cast<uint64_t>(high_hash - low_hash) + 1);
+      mid = low + static_cast<int>(offset);
+    } else {
+      mid = low + size / 2;
+    }
+    DCHECK_LE(low, mid);
+    DCHECK_LT(mid, high);
+    uint32_t mid_hash = GetKey(mid)->hash();
+    if (mid_hash >= hash) {
+      high = mid;
+      high_hash = mid_hash;
+    } else {
+      low = mid + 1;
+      low_hash = mid_hash;
+    }
+    // Bisect once whenever an estimate did not at least halve the range, so
+    // that skewed hashes can't degrade the search to a linear one.
+    interpolate = !interpolate || 2 * (high - low) <= size;
+  }
+
+  for (; low < nof_transitions; ++low) {
+    Name key = GetKey(low);
+    if (key->hash() != hash) break;
+    if (key == name) return low;
+  }
+  if (out_insertion_index != nullptr) *out_insertion_index = low;
+  return kNotFound;
+}
+
 int TransitionArray::Search(PropertyKind kind, Name name,
                             PropertyAttributes attributes,
                             int* out_insertion_index) {
@@ -285,6 +285,9 @@ class TransitionArray : public WeakFixedArray {
   static const int kEntryTargetIndex = 1;
   static const int kEntrySize = 2;
 
+  // Arrays up to this size are searched linearly (see internal::Search).
+  static const int kMaxTransitionsForLinearSearch = 8;
+
   // Conversion from transition number to array indices.
   static int ToKeyIndex(int transition_number) {
     return kFirstIndex + (transition_number * kEntrySize) + kEntryKeyIndex;
@@ -347,6 +350,10 @@ class TransitionArray : public WeakFixedArray {
   // Search a first transition for a given property name.
   inline int SearchName(Name name, bool concurrent_search = false,
                         int* out_insertion_index = nullptr);
+  // Like SearchName, for larger arrays on the main thread. Since the keys
+  // are sorted by their hash, which is uniformly distributed, the position
+  // of a hash within the array can be estimated from its value.
+  int InterpolationSearchName(Name name, int* out_insertion_index);
   int SearchDetails(int transition, PropertyKind kind,
                     PropertyAttributes attributes, int* out_insertion_index);
   Map SearchDetailsAndGetTarget(int transition, PropertyKind kind,
@@ -4,9 +4,11 @@
 
 #include "src/objects/value-serializer.h"
 
+#include <atomic>
 #include <type_traits>
 
 #include "include/v8-maybe.h"
+#include "include/v8-platform.h"
 #include "include/v8-value-serializer-version.h"
 #include "include/v8-value-serializer.h"
 #include "include/v8-wasm.h"
@@ -20,7 +22,10 @@
 #include "src/handles/maybe-handles-inl.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/heap/factory.h"
+#include "src/heap/pretenuring-handler.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-buffer.h"
@@ -162,6 +167,9 @@ enum class SerializationTag : uint8_t {
   kResizableArrayBuffer = '~',
   // Array buffer (transferred). transferID:uint32_t
   kArrayBufferTransfer = 't',
+  // Array buffer whose backing store is passed out of band.
+  // backingStoreIndex:uint32_t
+  kArrayBufferOutOfBand = 'E',
   // View into an array buffer.
   // subtag:ArrayBufferViewTag, byteOffset:uint32_t, byteLength:uint32_t
   // For typed arrays, byteOffset and byteLength must be divisible by the size
@@ -259,6 +267,41 @@ enum class ErrorTag : uint8_t {
   kEnd = '.',
 };
 
+// Copies a large block of memory in fixed-size chunks, claimed by the joining
+// thread and by any worker threads the platform provides.
+class ParallelCopyJob final : public JobTask {
+ public:
+  static constexpr size_t kChunkSize = 1 * MB;
+
+  ParallelCopyJob(uint8_t* dest, const uint8_t* source, size_t length)
+      : dest_(dest),
+        source_(source),
+        length_(length),
+        num_chunks_((length + kChunkSize - 1) / kChunkSize) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= num_chunks_) return;
+      size_t offset = chunk * kChunkSize;
+      memcpy(dest_ + offset, source_ + offset,
+             std::min(kChunkSize, length_ - offset));
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return next_chunk < num_chunks_ ? num_chunks_ - next_chunk : 0;
+  }
+
+ private:
+  uint8_t* const dest_;
+  const uint8_t* const source_;
+  const size_t length_;
+  const size_t num_chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
 }  // namespace
 
 ValueSerializer::ValueSerializer(Isolate* isolate,
@@ -294,6 +337,19 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetCopyArrayBuffersInParallel(bool mode) {
+  copy_array_buffers_in_parallel_ = mode;
+}
+
+void ValueSerializer::SetOutOfBandArrayBufferThreshold(size_t min_byte_length) {
+  out_of_band_array_buffer_threshold_ = min_byte_length;
+}
+
+std::vector<std::shared_ptr<BackingStore>>
+ValueSerializer::ReleaseOutOfBandBackingStores() {
+  return std::move(out_of_band_backing_stores_);
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -380,6 +436,35 @@ Maybe<uint8_t*> ValueSerializer::ReserveRawBytes(size_t bytes) {
   return Just(&buffer_[old_size]);
 }
 
+void ValueSerializer::WriteArrayBufferContents(
+    Handle<JSArrayBuffer> array_buffer, size_t byte_length) {
+  if (!copy_array_buffers_in_parallel_ ||
+      byte_length < kMinParallelCopyByteLength) {
+    WriteRawBytes(array_buffer->backing_store(), byte_length);
+    return;
+  }
+  uint8_t* dest;
+  if (!ReserveRawBytes(byte_length).To(&dest)) return;
+  // No JavaScript or GC can run while joining, so the backing store stays
+  // alive and unchanged until all chunks are copied.
+  DisallowGarbageCollection no_gc;
+  DisallowJavascriptExecution no_js(isolate_);
+  V8::GetCurrentPlatform()
+      ->PostJob(TaskPriority::kUserBlocking,
+                std::make_unique<ParallelCopyJob>(
+                    dest,
+                    reinterpret_cast<const uint8_t*>(
+                        array_buffer->backing_store()),
+                    byte_length))
+      ->Join();
+}
+
+Maybe<bool> ValueSerializer::ReserveCapacity(size_t bytes) {
+  size_t required_capacity = buffer_size_ + bytes;
+  if (V8_LIKELY(required_capacity <= buffer_capacity_)) return Just(true);
+  return ExpandBuffer(required_capacity);
+}
+
 Maybe<bool> ValueSerializer::ExpandBuffer(size_t required_capacity) {
   DCHECK_GT(required_capacity, buffer_capacity_);
   size_t requested_capacity =
@@ -952,6 +1037,26 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
   if (byte_length > std::numeric_limits<uint32_t>::max()) {
     return ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
   }
+  if (byte_length >= out_of_band_array_buffer_threshold_ &&
+      !array_buffer->is_resizable_by_js()) {
+    std::shared_ptr<BackingStore> backing_store =
+        array_buffer->GetBackingStore();
+    if (backing_store && !backing_store->is_wasm_memory()) {
+      WriteTag(SerializationTag::kArrayBufferOutOfBand);
+      WriteVarint<uint32_t>(
+          static_cast<uint32_t>(out_of_band_backing_stores_.size()));
+      out_of_band_backing_stores_.push_back(std::move(backing_store));
+      return ThrowIfOutOfMemory();
+    }
+  }
+  // Size the buffer for the whole record, and for the view record that usually
+  // follows it, before writing anything. Otherwise the few bytes written after
+  // a large payload would double an already large buffer.
+  static constexpr size_t kMaxArrayBufferRecordsOverhead = 32;
+  if (ReserveCapacity(kMaxArrayBufferRecordsOverhead + byte_length)
+          .IsNothing()) {
+    return ThrowIfOutOfMemory();
+  }
   if (array_buffer->is_resizable_by_js()) {
     size_t max_byte_length = array_buffer->max_byte_length();
     if (max_byte_length > std::numeric_limits<uint32_t>::max()) {
@@ -962,12 +1067,12 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
     WriteTag(SerializationTag::kResizableArrayBuffer);
     WriteVarint<uint32_t>(static_cast<uint32_t>(byte_length));
     WriteVarint<uint32_t>(static_cast<uint32_t>(max_byte_length));
-    WriteRawBytes(array_buffer->backing_store(), byte_length);
+    WriteArrayBufferContents(array_buffer, byte_length);
     return ThrowIfOutOfMemory();
   }
   WriteTag(SerializationTag::kArrayBuffer);
   WriteVarint<uint32_t>(static_cast<uint32_t>(byte_length));
-  WriteRawBytes(array_buffer->backing_store(), byte_length);
+  WriteArrayBufferContents(array_buffer, byte_length);
   return ThrowIfOutOfMemory();
 }
 
@@ -1252,7 +1357,13 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       delegate_(delegate),
       position_(data.begin()),
       end_(data.end()),
+      allocation_(
+          isolate->heap()->pretenuring_handler()->GetRuntimeAllocationType(
+              PretenuringHandler::RuntimeAllocator::kValueDeserializer,
+              static_cast<size_t>(end_ - position_))),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      expected_maps_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
@@ -1261,12 +1372,19 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
       delegate_(nullptr),
       position_(data),
       end_(data + size),
+      allocation_(
+          isolate->heap()->pretenuring_handler()->GetRuntimeAllocationType(
+              PretenuringHandler::RuntimeAllocator::kValueDeserializer,
+              static_cast<size_t>(end_ - position_))),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      expected_maps_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   DCHECK_LE(position_, end_);
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(expected_maps_.location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1479,6 +1597,11 @@ void ValueDeserializer::TransferArrayBuffer(
   }
 }
 
+void ValueDeserializer::SetOutOfBandBackingStores(
+    std::vector<std::shared_ptr<BackingStore>> backing_stores) {
+  out_of_band_backing_stores_ = std::move(backing_stores);
+}
+
 MaybeHandle<Object> ValueDeserializer::ReadObjectWrapper() {
   // We had a bug which produced invalid version 13 data (see
   // crbug.com/1284506). This compatibility mode tries to first read the data
@@ -1502,6 +1625,12 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectWrapper() {
         MessageTemplate::kDataCloneDeserializationError));
   }
 
+  Handle<Object> object;
+  if (result.ToHandle(&object)) {
+    isolate_->heap()->pretenuring_handler()->SampleRuntimeAllocation(
+        PretenuringHandler::RuntimeAllocator::kValueDeserializer,
+        static_cast<size_t>(end_ - original_position), object);
+  }
   return result;
 }
 
@@ -1571,11 +1700,11 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kBigInt:
       return ReadBigInt();
     case SerializationTag::kUtf8String:
-      return ReadUtf8String();
+      return ReadUtf8String(allocation_);
     case SerializationTag::kOneByteString:
-      return ReadOneByteString();
+      return ReadOneByteString(allocation_);
     case SerializationTag::kTwoByteString:
-      return ReadTwoByteString();
+      return ReadTwoByteString(allocation_);
     case SerializationTag::kObjectReference: {
       uint32_t id;
       if (!ReadVarint<uint32_t>().To(&id)) return MaybeHandle<Object>();
@@ -1614,6 +1743,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kArrayBufferTransfer: {
       return ReadTransferredJSArrayBuffer();
     }
+    case SerializationTag::kArrayBufferOutOfBand:
+      return ReadOutOfBandJSArrayBuffer();
     case SerializationTag::kSharedArrayBuffer: {
       constexpr bool is_shared = true;
       constexpr bool is_resizable = false;
@@ -1646,7 +1777,7 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
 }
 
 MaybeHandle<String> ValueDeserializer::ReadString() {
-  if (version_ < 12) return ReadUtf8String();
+  if (version_ < 12) return ReadUtf8String(allocation_);
   Handle<Object> object;
   if (!ReadObject().ToHandle(&object) || !object->IsString(isolate_)) {
     return MaybeHandle<String>();
@@ -1771,14 +1902,17 @@ MaybeHandle<JSObject> ValueDeserializer::ReadJSObject() {
 
   uint32_t id = next_id_++;
   HandleScope scope(isolate_);
-  Handle<JSObject> object =
-      isolate_->factory()->NewJSObject(isolate_->object_function());
+  Handle<JSObject> object = isolate_->factory()->NewJSObject(
+      isolate_->object_function(), allocation_);
   AddObjectWithID(id, object);
 
   uint32_t num_properties;
   uint32_t expected_num_properties;
-  if (!ReadJSObjectProperties(object, SerializationTag::kEndJSObject, true)
-           .To(&num_properties) ||
+  object_depth_++;
+  Maybe<uint32_t> maybe_num_properties =
+      ReadJSObjectProperties(object, SerializationTag::kEndJSObject, true);
+  object_depth_--;
+  if (!maybe_num_properties.To(&num_properties) ||
       !ReadVarint<uint32_t>().To(&expected_num_properties) ||
       num_properties != expected_num_properties) {
     return MaybeHandle<JSObject>();
@@ -1797,8 +1931,8 @@ MaybeHandle<JSArray> ValueDeserializer::ReadSparseJSArray() {
 
   uint32_t id = next_id_++;
   HandleScope scope(isolate_);
-  Handle<JSArray> array =
-      isolate_->factory()->NewJSArray(0, TERMINAL_FAST_ELEMENTS_KIND);
+  Handle<JSArray> array = isolate_->factory()->NewJSArray(
+      0, TERMINAL_FAST_ELEMENTS_KIND, allocation_);
   MAYBE_RETURN(JSArray::SetLength(array, length), MaybeHandle<JSArray>());
   AddObjectWithID(id, array);
 
@@ -1835,7 +1969,8 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
   HandleScope scope(isolate_);
   Handle<JSArray> array = isolate_->factory()->NewJSArray(
       HOLEY_ELEMENTS, length, length,
-      ArrayStorageAllocationMode::INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE);
+      ArrayStorageAllocationMode::INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE,
+      allocation_);
   AddObjectWithID(id, array);
 
   Handle<FixedArray> elements(FixedArray::cast(array->elements()), isolate_);
@@ -2120,6 +2255,25 @@ MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadTransferredJSArrayBuffer() {
   return array_buffer;
 }
 
+MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadOutOfBandJSArrayBuffer() {
+  uint32_t id = next_id_++;
+  uint32_t index;
+  if (!ReadVarint<uint32_t>().To(&index) ||
+      index >= out_of_band_backing_stores_.size()) {
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  std::shared_ptr<BackingStore> backing_store =
+      out_of_band_backing_stores_[index];
+  if (!backing_store || backing_store->is_shared() ||
+      backing_store->is_resizable_by_js() || backing_store->is_wasm_memory()) {
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  Handle<JSArrayBuffer> array_buffer =
+      isolate_->factory()->NewJSArrayBuffer(std::move(backing_store));
+  AddObjectWithID(id, array_buffer);
+  return array_buffer;
+}
+
 MaybeHandle<JSArrayBufferView> ValueDeserializer::ReadJSArrayBufferView(
     Handle<JSArrayBuffer> buffer) {
   uint32_t buffer_byte_length = static_cast<uint32_t>(buffer->GetByteLength());
@@ -2446,6 +2600,21 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
     std::vector<Handle<Object>> properties;
     properties.reserve(8);
 
+    // The map of the last object read at the same depth is likely to be the
+    // one this object ends up with (e.g. in arrays of records), so its keys
+    // are tried first where the transition tree branches.
+    Handle<Map> expected_map;
+    {
+      Map maybe_expected_map = ExpectedMapAt(object_depth_);
+      if (!maybe_expected_map.is_null() &&
+          !maybe_expected_map->IsDetached(isolate_)) {
+        expected_map = handle(maybe_expected_map, isolate_);
+        if (expected_map->is_deprecated()) {
+          expected_map = Map::Update(isolate_, expected_map);
+        }
+      }
+    }
+
     while (transitioning) {
       // If there are no more properties, finish.
       SerializationTag tag;
@@ -2453,6 +2622,9 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
       if (tag == end_tag) {
         ConsumeTag(end_tag);
         CommitProperties(object, map, properties);
+        if (!map.is_identical_to(expected_map)) {
+          SetExpectedMapAt(object_depth_, map);
+        }
         CHECK_LT(properties.size(), std::numeric_limits<uint32_t>::max());
         return Just(static_cast<uint32_t>(properties.size()));
       }
@@ -2468,6 +2640,20 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
         expected_key = transitions.ExpectedTransitionKey();
         if (!expected_key.is_null()) {
           target = transitions.ExpectedTransitionTarget();
+        } else if (!expected_map.is_null()) {
+          DisallowGarbageCollection no_gc;
+          InternalIndex descriptor(properties.size());
+          if (descriptor.as_int() < expected_map->NumberOfOwnDescriptors()) {
+            Name expected_name =
+                expected_map->instance_descriptors(isolate_)->GetKey(
+                    descriptor);
+            Map expected_target = transitions.SearchTransition(
+                expected_name, PropertyKind::kData, NONE);
+            if (!expected_target.is_null() && expected_name.IsString()) {
+              expected_key = handle(String::cast(expected_name), isolate_);
+              target = handle(expected_target, isolate_);
+            }
+          }
         }
       }
       if (!expected_key.is_null() && ReadExpectedString(expected_key)) {
@@ -2594,6 +2780,27 @@ MaybeHandle<JSReceiver> ValueDeserializer::GetObjectWithID(uint32_t id) {
   return Handle<JSReceiver>(JSReceiver::cast(value), isolate_);
 }
 
+Map ValueDeserializer::ExpectedMapAt(uint32_t depth) {
+  DisallowGarbageCollection no_gc;
+  FixedArray raw_maps = *expected_maps_;
+  if (depth >= static_cast<uint32_t>(raw_maps->length())) return Map();
+  Object maybe_map = raw_maps->get(static_cast<int>(depth));
+  if (!maybe_map.IsMap()) return Map();
+  return Map::cast(maybe_map);
+}
+
+void ValueDeserializer::SetExpectedMapAt(uint32_t depth, Handle<Map> map) {
+  if (depth >= kMaxExpectedMapDepth || map->is_dictionary_map()) return;
+  Handle<FixedArray> new_array = FixedArray::SetAndGrow(
+      isolate_, expected_maps_, static_cast<int>(depth), map);
+
+  // If the array was reallocated, update the global handle.
+  if (!new_array.is_identical_to(expected_maps_)) {
+    GlobalHandles::Destroy(expected_maps_.location());
+    expected_maps_ = isolate_->global_handles()->Create(*new_array);
+  }
+}
+
 void ValueDeserializer::AddObjectWithID(uint32_t id,
                                         Handle<JSReceiver> object) {
   DCHECK(!HasObjectWithID(id));
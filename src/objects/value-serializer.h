@@ -6,6 +6,9 @@
 #define V8_OBJECTS_VALUE_SERIALIZER_H_
 
 #include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
 
 #include "include/v8-value-serializer.h"
 #include "src/base/compiler-specific.h"
@@ -20,6 +23,7 @@
 namespace v8 {
 namespace internal {
 
+class BackingStore;
 class BigInt;
 class HeapNumber;
 class Isolate;
@@ -32,6 +36,7 @@ class JSRegExp;
 class JSSet;
 class JSSharedArray;
 class JSSharedStruct;
+class Map;
 class Object;
 class Oddball;
 class SharedObjectConveyorHandles;
@@ -97,9 +102,35 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Indicate whether to copy the contents of large ArrayBuffers into the
+   * buffer using worker threads. See
+   * v8::ValueSerializer::SetCopyArrayBuffersInParallel.
+   */
+  void SetCopyArrayBuffersInParallel(bool mode);
+
+  /*
+   * Makes the backing stores of ArrayBuffers of at least |min_byte_length|
+   * bytes be referenced by index into a side list instead of being copied
+   * into the buffer. See v8::ValueSerializer::SetOutOfBandArrayBufferThreshold.
+   */
+  void SetOutOfBandArrayBufferThreshold(size_t min_byte_length);
+
+  /*
+   * Returns the backing stores referenced by kArrayBufferOutOfBand records, in
+   * index order.
+   */
+  std::vector<std::shared_ptr<BackingStore>> ReleaseOutOfBandBackingStores();
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
+  // Ensures that |bytes| more bytes can be written without reallocating.
+  Maybe<bool> ReserveCapacity(size_t bytes);
+
+  // ArrayBuffers of at least this many bytes are copied in parallel if
+  // copy_array_buffers_in_parallel_ is set.
+  static constexpr size_t kMinParallelCopyByteLength = 8 * MB;
 
   // Writing the wire format.
   void WriteTag(SerializationTag tag);
@@ -111,6 +142,8 @@ class ValueSerializer {
   void WriteTwoByteString(base::Vector<const base::uc16> chars);
   void WriteBigIntContents(BigInt bigint);
   Maybe<uint8_t*> ReserveRawBytes(size_t bytes);
+  void WriteArrayBufferContents(Handle<JSArrayBuffer> array_buffer,
+                                size_t byte_length);
 
   // Writing V8 objects of various kinds.
   void WriteOddball(Oddball oddball);
@@ -176,7 +209,11 @@ class ValueSerializer {
   size_t buffer_capacity_ = 0;
   bool has_custom_host_objects_ = false;
   bool treat_array_buffer_views_as_host_objects_ = false;
+  bool copy_array_buffers_in_parallel_ = false;
   bool out_of_memory_ = false;
+  size_t out_of_band_array_buffer_threshold_ =
+      std::numeric_limits<size_t>::max();
+  std::vector<std::shared_ptr<BackingStore>> out_of_band_backing_stores_;
   Zone zone_;
 
   // To avoid extra lookups in the identity map, ID+1 is actually stored in the
@@ -239,6 +276,13 @@ class ValueDeserializer {
   void TransferArrayBuffer(uint32_t transfer_id,
                            Handle<JSArrayBuffer> array_buffer);
 
+  /*
+   * Accepts the backing stores returned by
+   * ValueSerializer::ReleaseOutOfBandBackingStores.
+   */
+  void SetOutOfBandBackingStores(
+      std::vector<std::shared_ptr<BackingStore>> backing_stores);
+
   /*
    * Publicly exposed wire format writing methods.
    * These are intended for use within the delegate's WriteHostObject method.
@@ -300,6 +344,7 @@ class ValueDeserializer {
       bool is_shared, bool is_resizable) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer()
       V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSArrayBuffer> ReadOutOfBandJSArrayBuffer() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBufferView> ReadJSArrayBufferView(
       Handle<JSArrayBuffer> buffer) V8_WARN_UNUSED_RESULT;
   bool ValidateJSArrayBufferViewFlags(
@@ -326,19 +371,31 @@ class ValueDeserializer {
   MaybeHandle<JSReceiver> GetObjectWithID(uint32_t id);
   void AddObjectWithID(uint32_t id, Handle<JSReceiver> object);
 
+  // Manipulating the per-depth cache of the maps of recently read objects.
+  Map ExpectedMapAt(uint32_t depth);
+  void SetExpectedMapAt(uint32_t depth, Handle<Map> map);
+  static constexpr uint32_t kMaxExpectedMapDepth = 16;
+
   Isolate* const isolate_;
   v8::ValueDeserializer::Delegate* const delegate_;
   const uint8_t* position_;
   const uint8_t* const end_;
+  // Where objects, arrays and strings of the result graph are allocated,
+  // based on the survival of earlier results of similar size.
+  const AllocationType allocation_;
   uint32_t version_ = 0;
   uint32_t next_id_ = 0;
+  uint32_t object_depth_ = 0;
   bool version_13_broken_data_mode_ = false;
   bool suppress_deserialization_errors_ = false;
 
   // Always global handles.
   Handle<FixedArray> id_map_;
+  Handle<FixedArray> expected_maps_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
 
+  std::vector<std::shared_ptr<BackingStore>> out_of_band_backing_stores_;
+
   // The conveyor used to keep shared objects alive.
   const SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
 };
@@ -625,6 +625,13 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
       chars++;
       if (t > unibrow::Utf16::kMaxNonSurrogateCharCode) chars++;
     }
+    // Fast path for ascii sequences, where each byte is one char.
+    if (state != unibrow::Utf8::State::kAccept || chars >= position) continue;
+    size_t remaining = end - cursor;
+    int max_length = static_cast<int>(std::min(remaining, position - chars));
+    int ascii_length = NonAsciiStart(cursor, max_length);
+    cursor += ascii_length;
+    chars += ascii_length;
   }
 
   current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data.get());
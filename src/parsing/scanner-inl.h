@@ -325,19 +325,25 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
     next().after_line_terminator = true;
   }
 
-  // Advance as long as character is a WhiteSpace or LineTerminator.
+  // Advance as long as character is a WhiteSpace or LineTerminator. Runs of
+  // spaces and tabs (indentation) are skipped a block at a time.
   base::uc32 hint = ' ';
-  AdvanceUntil([this, &hint](base::uc32 c0) {
-    if (V8_LIKELY(c0 == hint)) return false;
-    if (IsWhiteSpaceOrLineTerminator(c0)) {
-      if (!next().after_line_terminator && unibrow::IsLineTerminator(c0)) {
-        next().after_line_terminator = true;
-      }
-      hint = c0;
-      return false;
-    }
-    return true;
-  });
+  AdvanceUntil(
+      [](const SimdCharBlock<uint16_t>& block) {
+        return ~(block.EqualMask(' ') | block.EqualMask('\t')) &
+               SimdCharBlock<uint16_t>::kAllLanes;
+      },
+      [this, &hint](base::uc32 c0) {
+        if (V8_LIKELY(c0 == hint)) return false;
+        if (IsWhiteSpaceOrLineTerminator(c0)) {
+          if (!next().after_line_terminator && unibrow::IsLineTerminator(c0)) {
+            next().after_line_terminator = true;
+          }
+          hint = c0;
+          return false;
+        }
+        return true;
+      });
 
   return Token::WHITESPACE;
 }
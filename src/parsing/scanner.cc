@@ -204,13 +204,26 @@ Token::Value Scanner::SkipSingleHTMLComment() {
   return SkipSingleLineComment();
 }
 
+namespace {
+
+using CharBlock = SimdCharBlock<uint16_t>;
+
+// Lanes that may hold a line terminator, i.e. <LF>, <CR>, <LS> or <PS>.
+V8_INLINE uint32_t LineTerminatorCandidates(const CharBlock& block) {
+  return block.LessOrEqualMask('\r') | block.InRangeMask(0x2028, 0x2029);
+}
+
+}  // namespace
+
 Token::Value Scanner::SkipSingleLineComment() {
   // The line terminator at the end of the line is not considered
   // to be part of the single-line comment; it is recognized
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntil(LineTerminatorCandidates, [](base::uc32 c0) {
+    return unibrow::IsLineTerminator(c0);
+  });
 
   return Token::WHITESPACE;
 }
@@ -288,13 +301,17 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      AdvanceUntil(
+          [](const CharBlock& block) {
+            return block.EqualMask('*') | LineTerminatorCandidates(block);
+          },
+          [](base::uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              return unibrow::IsLineTerminator(c0);
+            }
+            uint8_t char_flags = character_scan_flags[c0];
+            return MultilineCommentCharacterNeedsSlowPath(char_flags);
+          });
 
       while (c0_ == '*') {
         Advance();
@@ -313,7 +330,8 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntil([](const CharBlock& block) { return block.EqualMask('*'); },
+                 [](base::uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
       Advance();
@@ -19,6 +19,7 @@
 #include "src/parsing/token.h"
 #include "src/regexp/regexp-flags.h"
 #include "src/strings/char-predicates.h"
+#include "src/strings/string-simd.h"
 #include "src/strings/unicode.h"
 #include "src/utils/allocation.h"
 
@@ -95,6 +96,41 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil(check), but skips whole blocks of code units for which
+  // |candidates| (applied to a SimdCharBlock) returns no lanes. |candidates|
+  // must report every code unit for which |check| might return true or have
+  // a side effect; |check| is only called on the reported ones.
+  template <typename BlockFunctionType, typename FunctionType>
+  V8_INLINE base::uc32 AdvanceUntil(BlockFunctionType candidates,
+                                    FunctionType check) {
+    using Block = SimdCharBlock<uint16_t>;
+    if (!Block::kIsVectorized) return AdvanceUntil(check);
+    while (true) {
+      const uint16_t* cursor = buffer_cursor_;
+      while (cursor != buffer_end_) {
+        if (buffer_end_ - cursor >= Block::kLanes) {
+          uint32_t mask = candidates(Block::Load(cursor));
+          if (mask == 0) {
+            cursor += Block::kLanes;
+            continue;
+          }
+          cursor += Block::FirstLane(mask);
+        }
+        base::uc32 c0 = static_cast<base::uc32>(*cursor);
+        if (check(c0)) {
+          buffer_cursor_ = cursor + 1;
+          return c0;
+        }
+        cursor++;
+      }
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked(pos())) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -545,6 +581,12 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename BlockFunctionType, typename FunctionType>
+  V8_INLINE void AdvanceUntil(BlockFunctionType candidates,
+                              FunctionType check) {
+    c0_ = source_->AdvanceUntil(candidates, check);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
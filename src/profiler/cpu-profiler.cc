@@ -18,6 +18,7 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/profiler/cpu-profiler-inl.h"
+#include "src/profiler/hardware-event-counter.h"
 #include "src/profiler/profiler-stats.h"
 #include "src/profiler/symbolizer.h"
 #include "src/utils/locked-queue-inl.h"
@@ -36,7 +37,9 @@ class CpuSampler : public sampler::Sampler {
   CpuSampler(Isolate* isolate, SamplingEventsProcessor* processor)
       : sampler::Sampler(reinterpret_cast<v8::Isolate*>(isolate)),
         processor_(processor),
-        perThreadData_(isolate->FindPerThreadDataForThisThread()) {}
+        perThreadData_(isolate->FindPerThreadDataForThisThread()),
+        hardware_event_counter_(HardwareEventCounter::New(
+            v8_flags.cpu_profiler_hardware_event)) {}
 
   void SampleStack(const v8::RegisterState& regs) override {
     Isolate* isolate = reinterpret_cast<Isolate*>(this->isolate());
@@ -62,6 +65,8 @@ class CpuSampler : public sampler::Sampler {
     sample->Init(isolate, regs, TickSample::kIncludeCEntryFrame,
                  /* update_stats */ true,
                  /* use_simulator_reg_state */ true, processor_->period());
+    sample->hardware_events =
+        hardware_event_counter_ ? hardware_event_counter_->ReadDelta() : 0;
     if (is_counting_samples_ && !sample->timestamp.IsNull()) {
       if (sample->state == JS) ++js_sample_count_;
       if (sample->state == EXTERNAL) ++external_sample_count_;
@@ -72,6 +77,8 @@ class CpuSampler : public sampler::Sampler {
  private:
   SamplingEventsProcessor* processor_;
   Isolate::PerIsolateThreadData* perThreadData_;
+  // Counts events on the thread that started the profiler.
+  std::unique_ptr<HardwareEventCounter> hardware_event_counter_;
 };
 
 ProfilingScope::ProfilingScope(Isolate* isolate, ProfilerListener* listener)
@@ -245,7 +252,8 @@ void SamplingEventsProcessor::SymbolizeAndAddToProfiles(
       tick_sample.update_stats_, tick_sample.sampling_interval_,
       tick_sample.state, tick_sample.embedder_state,
       reinterpret_cast<Address>(tick_sample.context),
-      reinterpret_cast<Address>(tick_sample.embedder_context));
+      reinterpret_cast<Address>(tick_sample.embedder_context),
+      tick_sample.hardware_events);
 }
 
 ProfilerEventsProcessor::SampleProcessingResult
@@ -0,0 +1,99 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/profiler/hardware-event-counter.h"
+
+#include <cstring>
+
+#include "src/base/build_config.h"
+#include "src/base/macros.h"
+
+#if V8_OS_LINUX
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // V8_OS_LINUX
+
+namespace v8 {
+namespace internal {
+
+#if V8_OS_LINUX
+
+namespace {
+
+bool GetEventConfig(const char* event_name, uint64_t* config) {
+  static constexpr struct {
+    const char* name;
+    uint64_t config;
+  } kEvents[] = {
+      {"cycles", PERF_COUNT_HW_CPU_CYCLES},
+      {"instructions", PERF_COUNT_HW_INSTRUCTIONS},
+      {"cache-misses", PERF_COUNT_HW_CACHE_MISSES},
+      {"branch-misses", PERF_COUNT_HW_BRANCH_MISSES},
+  };
+  for (const auto& event : kEvents) {
+    if (strcmp(event.name, event_name) == 0) {
+      *config = event.config;
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+// static
+std::unique_ptr<HardwareEventCounter> HardwareEventCounter::New(
+    const char* event_name) {
+  uint64_t config;
+  if (event_name == nullptr || !GetEventConfig(event_name, &config)) {
+    return nullptr;
+  }
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  // Only count events in user space, which also works with the default
+  // perf_event_paranoid setting.
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // Count on the calling thread, on any CPU.
+  int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1,
+                                    PERF_FLAG_FD_CLOEXEC));
+  if (fd < 0) return nullptr;
+  std::unique_ptr<HardwareEventCounter> counter(new HardwareEventCounter(fd));
+  counter->ReadDelta();
+  return counter;
+}
+
+HardwareEventCounter::~HardwareEventCounter() { close(fd_); }
+
+uint64_t HardwareEventCounter::ReadDelta() {
+  uint64_t value;
+  if (read(fd_, &value, sizeof(value)) != sizeof(value)) return 0;
+  uint64_t delta = value - last_value_;
+  last_value_ = value;
+  return delta;
+}
+
+#else  // !V8_OS_LINUX
+
+// static
+std::unique_ptr<HardwareEventCounter> HardwareEventCounter::New(
+    const char* event_name) {
+  return nullptr;
+}
+
+HardwareEventCounter::~HardwareEventCounter() = default;
+
+uint64_t HardwareEventCounter::ReadDelta() {
+  USE(fd_, last_value_);
+  return 0;
+}
+
+#endif  // V8_OS_LINUX
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,44 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_HARDWARE_EVENT_COUNTER_H_
+#define V8_PROFILER_HARDWARE_EVENT_COUNTER_H_
+
+#include <cstdint>
+#include <memory>
+
+namespace v8 {
+namespace internal {
+
+// Counts a hardware event (e.g. cycles or cache misses) on the thread that
+// created the counter, using perf_event_open on Linux. The CPU profiler reads
+// it on every sample to attribute the events that happened since the previous
+// sample to the sampled stack.
+class HardwareEventCounter {
+ public:
+  // Returns nullptr if |event_name| is unknown or the event cannot be counted
+  // on this platform (e.g. if perf events are restricted by the kernel).
+  // Supported names are "cycles", "instructions", "cache-misses" and
+  // "branch-misses".
+  static std::unique_ptr<HardwareEventCounter> New(const char* event_name);
+
+  ~HardwareEventCounter();
+  HardwareEventCounter(const HardwareEventCounter&) = delete;
+  HardwareEventCounter& operator=(const HardwareEventCounter&) = delete;
+
+  // Returns the number of events since the previous call. This is
+  // async-signal-safe, so it can be called from the sampler's signal handler.
+  uint64_t ReadDelta();
+
+ private:
+  explicit HardwareEventCounter(int fd) : fd_(fd) {}
+
+  const int fd_;
+  uint64_t last_value_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PROFILER_HARDWARE_EVENT_COUNTER_H_
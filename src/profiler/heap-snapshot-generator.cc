@@ -1059,7 +1059,10 @@ void V8HeapExplorer::PopulateLineEnds() {
 }
 
 uint32_t V8HeapExplorer::EstimateObjectsCount() {
-  CombinedHeapObjectIterator it(heap_, HeapObjectIterator::kFilterUnreachable);
+  // Filtering unreachable objects would mark the whole heap once more just
+  // for the progress total. The snapshot is taken right after a full GC, so
+  // the unfiltered count is only slightly larger.
+  CombinedHeapObjectIterator it(heap_, HeapObjectIterator::kNoFiltering);
   uint32_t objects_count = 0;
   // Avoid overflowing the objects count. In worst case, we will show the same
   // progress for a longer period of time, but we do not expect to have that
@@ -2884,6 +2887,9 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
+  // The entry lookup tables are as large as the snapshot's nodes, so free
+  // them before the children array is allocated.
+  ReleaseEntriesMaps();
   snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
@@ -2933,6 +2939,15 @@ bool HeapSnapshotGenerator::FillReferences() {
          dom_explorer_.IterateAndExtractReferences(this);
 }
 
+void HeapSnapshotGenerator::ReleaseEntriesMaps() {
+  // Clearing an unordered_map keeps its buckets, so swap in empty maps.
+  HeapEntriesMap().swap(entries_map_);
+  SmiEntriesMap().swap(smis_map_);
+#ifdef V8_ENABLE_HEAP_SNAPSHOT_VERIFY
+  std::unordered_map<HeapEntry*, HeapThing>().swap(reverse_entries_map_);
+#endif
+}
+
 // type, name, id, self_size, edge_count, trace_node_id, detachedness.
 const int HeapSnapshotJSONSerializer::kNodeFieldsCount = 7;
 
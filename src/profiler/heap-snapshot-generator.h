@@ -666,6 +666,9 @@ class HeapSnapshotGenerator : public SnapshottingProgressReportingInterface {
 
  private:
   bool FillReferences();
+  // Frees the mappings from heap objects to entries. No entries can be found
+  // or added afterwards.
+  void ReleaseEntriesMaps();
   void ProgressStep() override;
   bool ProgressReport(bool force = false) override;
   void InitProgressCounter();
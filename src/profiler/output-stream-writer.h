@@ -72,6 +72,18 @@ class OutputStreamWriter {
       MaybeWriteChunk();
     }
   }
+  // Unlike the other methods, doesn't expect text. Binary data is still
+  // passed to OutputStream::WriteAsciiChunk.
+  void AddBytes(const uint8_t* bytes, int n) {
+    while (n > 0) {
+      int chunk_size = std::min(chunk_size_ - chunk_pos_, n);
+      MemCopy(chunk_.begin() + chunk_pos_, bytes, chunk_size);
+      bytes += chunk_size;
+      n -= chunk_size;
+      chunk_pos_ += chunk_size;
+      MaybeWriteChunk();
+    }
+  }
   void AddNumber(unsigned n) { AddNumberImpl<unsigned>(n, "%u"); }
   void Finalize() {
     if (aborted_) return;
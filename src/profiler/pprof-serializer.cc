@@ -0,0 +1,286 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/profiler/pprof-serializer.h"
+
+#include <algorithm>
+
+#include "src/profiler/profile-generator.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Field numbers of profile.proto.
+namespace profile {
+constexpr int kSampleType = 1;
+constexpr int kSample = 2;
+constexpr int kLocation = 4;
+constexpr int kFunction = 5;
+constexpr int kStringTable = 6;
+constexpr int kDurationNanos = 10;
+constexpr int kPeriodType = 11;
+constexpr int kPeriod = 12;
+}  // namespace profile
+
+namespace value_type {
+constexpr int kType = 1;
+constexpr int kUnit = 2;
+}  // namespace value_type
+
+namespace sample {
+constexpr int kLocationId = 1;
+constexpr int kValue = 2;
+constexpr int kLabel = 3;
+}  // namespace sample
+
+namespace label {
+constexpr int kKey = 1;
+constexpr int kNum = 3;
+constexpr int kNumUnit = 4;
+}  // namespace label
+
+namespace location {
+constexpr int kId = 1;
+constexpr int kLine = 4;
+}  // namespace location
+
+namespace line {
+constexpr int kFunctionId = 1;
+constexpr int kLine = 2;
+}  // namespace line
+
+namespace function {
+constexpr int kId = 1;
+constexpr int kName = 2;
+constexpr int kSystemName = 3;
+constexpr int kFilename = 4;
+constexpr int kStartLine = 5;
+}  // namespace function
+
+constexpr int kVarintWireType = 0;
+constexpr int kLengthDelimitedWireType = 2;
+
+std::string ToStdString(v8::Isolate* isolate, v8::Local<v8::String> string) {
+  if (string.IsEmpty()) return std::string();
+  v8::String::Utf8Value utf8(isolate, string);
+  return *utf8 == nullptr ? std::string() : std::string(*utf8, utf8.length());
+}
+
+}  // namespace
+
+void PprofSerializer::Message::AddRawVarint(uint64_t value) {
+  while (value >= 0x80) {
+    bytes_.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  bytes_.push_back(static_cast<uint8_t>(value));
+}
+
+void PprofSerializer::Message::AddTag(int field, int wire_type) {
+  AddRawVarint(static_cast<uint64_t>(field) << 3 | wire_type);
+}
+
+void PprofSerializer::Message::AddVarint(int field, uint64_t value) {
+  AddTag(field, kVarintWireType);
+  AddRawVarint(value);
+}
+
+void PprofSerializer::Message::AddMessage(int field, const Message& message) {
+  AddTag(field, kLengthDelimitedWireType);
+  AddRawVarint(message.bytes_.size());
+  bytes_.insert(bytes_.end(), message.bytes_.begin(), message.bytes_.end());
+}
+
+void PprofSerializer::Message::AddString(int field, const std::string& value) {
+  AddTag(field, kLengthDelimitedWireType);
+  AddRawVarint(value.size());
+  bytes_.insert(bytes_.end(), value.begin(), value.end());
+}
+
+void PprofSerializer::Message::AddPackedVarints(
+    int field, const std::vector<uint64_t>& values) {
+  Message packed;
+  for (uint64_t value : values) packed.AddRawVarint(value);
+  AddMessage(field, packed);
+}
+
+PprofSerializer::PprofSerializer(v8::OutputStream* stream) : writer_(stream) {
+  // The first string of the string table must be empty.
+  GetStringId(std::string());
+}
+
+void PprofSerializer::Write(const Message& field) {
+  writer_.AddBytes(field.bytes().data(),
+                   static_cast<int>(field.bytes().size()));
+}
+
+int64_t PprofSerializer::GetStringId(const std::string& s) {
+  auto it = string_ids_.find(s);
+  if (it != string_ids_.end()) return it->second;
+  int64_t id = static_cast<int64_t>(strings_.size());
+  strings_.push_back(s);
+  string_ids_.emplace(s, id);
+  return id;
+}
+
+uint64_t PprofSerializer::GetFunctionId(const std::string& name,
+                                        const std::string& filename,
+                                        int64_t start_line) {
+  auto key =
+      std::make_tuple(GetStringId(name), GetStringId(filename), start_line);
+  auto it = function_ids_.find(key);
+  if (it != function_ids_.end()) return it->second;
+  uint64_t id = function_ids_.size() + 1;
+  function_ids_.emplace(key, id);
+
+  Message function;
+  function.AddVarint(function::kId, id);
+  function.AddVarint(function::kName, std::get<0>(key));
+  function.AddVarint(function::kSystemName, std::get<0>(key));
+  function.AddVarint(function::kFilename, std::get<1>(key));
+  function.AddVarint(function::kStartLine, start_line);
+  Message field;
+  field.AddMessage(profile::kFunction, function);
+  Write(field);
+  return id;
+}
+
+uint64_t PprofSerializer::AddLocation(uint64_t function_id,
+                                      int64_t line_number) {
+  uint64_t id = next_location_id_++;
+  Message line;
+  line.AddVarint(line::kFunctionId, function_id);
+  line.AddVarint(line::kLine, line_number);
+  Message location;
+  location.AddVarint(location::kId, id);
+  location.AddMessage(location::kLine, line);
+  Message field;
+  field.AddMessage(profile::kLocation, location);
+  Write(field);
+  return id;
+}
+
+void PprofSerializer::AddValueType(int field_number, const char* type,
+                                   const char* unit) {
+  Message value_type;
+  value_type.AddVarint(value_type::kType, GetStringId(type));
+  value_type.AddVarint(value_type::kUnit, GetStringId(unit));
+  Message field;
+  field.AddMessage(field_number, value_type);
+  Write(field);
+}
+
+void PprofSerializer::AddSample(const std::vector<uint64_t>& stack,
+                                const std::vector<uint64_t>& values,
+                                const Message* label) {
+  // Locations are listed from the leaf to the root.
+  std::vector<uint64_t> location_ids(stack.rbegin(), stack.rend());
+  Message sample;
+  sample.AddPackedVarints(sample::kLocationId, location_ids);
+  sample.AddPackedVarints(sample::kValue, values);
+  if (label) sample.AddMessage(sample::kLabel, *label);
+  Message field;
+  field.AddMessage(profile::kSample, sample);
+  Write(field);
+}
+
+void PprofSerializer::Finish() {
+  // Strings are only written at the end, but order doesn't matter in
+  // protobuf messages.
+  for (const std::string& s : strings_) {
+    if (writer_.aborted()) return;
+    Message field;
+    field.AddString(profile::kStringTable, s);
+    Write(field);
+  }
+  writer_.Finalize();
+}
+
+void PprofSerializer::SerializeCpuNode(const ProfileNode* node, int64_t period,
+                                       std::vector<uint64_t>* stack) {
+  if (writer_.aborted()) return;
+  const CodeEntry* entry = node->entry();
+  uint64_t function_id = GetFunctionId(entry->name(), entry->resource_name(),
+                                       entry->line_number());
+  stack->push_back(AddLocation(function_id, node->line_number()));
+  if (node->self_ticks() > 0) {
+    uint64_t ticks = node->self_ticks();
+    AddSample(*stack, {ticks, ticks * static_cast<uint64_t>(period)});
+  }
+  for (const ProfileNode* child : *node->children()) {
+    SerializeCpuNode(child, period, stack);
+  }
+  stack->pop_back();
+}
+
+void PprofSerializer::SerializeCpuProfile(const CpuProfile* profile) {
+  AddValueType(profile::kSampleType, "samples", "count");
+  AddValueType(profile::kSampleType, "cpu", "nanoseconds");
+  AddValueType(profile::kPeriodType, "cpu", "nanoseconds");
+  const int64_t period = profile->sampling_interval_us() * 1000;
+  Message header;
+  header.AddVarint(profile::kPeriod, period);
+  header.AddVarint(
+      profile::kDurationNanos,
+      (profile->end_time() - profile->start_time()).InMicroseconds() * 1000);
+  Write(header);
+
+  // The root node only stands for the empty stack.
+  std::vector<uint64_t> stack;
+  for (const ProfileNode* child : *profile->top_down()->root()->children()) {
+    SerializeCpuNode(child, period, &stack);
+  }
+  Finish();
+}
+
+void PprofSerializer::AddAllocationSamples(
+    v8::AllocationProfile::Node* node, const std::vector<uint64_t>& stack) {
+  for (const v8::AllocationProfile::Allocation& allocation :
+       node->allocations) {
+    uint64_t count = allocation.count;
+    uint64_t size = allocation.size;
+    Message label;
+    label.AddVarint(label::kKey, GetStringId("bytes"));
+    label.AddVarint(label::kNum, size);
+    label.AddVarint(label::kNumUnit, GetStringId("bytes"));
+    AddSample(stack, {count, count * size}, &label);
+  }
+}
+
+void PprofSerializer::SerializeAllocationNode(
+    v8::Isolate* isolate, v8::AllocationProfile::Node* node,
+    std::vector<uint64_t>* stack) {
+  if (writer_.aborted()) return;
+  uint64_t function_id =
+      GetFunctionId(ToStdString(isolate, node->name),
+                    ToStdString(isolate, node->script_name),
+                    std::max(node->line_number, 0));
+  stack->push_back(AddLocation(function_id, std::max(node->line_number, 0)));
+  AddAllocationSamples(node, *stack);
+  for (v8::AllocationProfile::Node* child : node->children) {
+    SerializeAllocationNode(isolate, child, stack);
+  }
+  stack->pop_back();
+}
+
+void PprofSerializer::SerializeAllocationProfile(
+    v8::Isolate* isolate, v8::AllocationProfile* profile) {
+  AddValueType(profile::kSampleType, "objects", "count");
+  AddValueType(profile::kSampleType, "space", "bytes");
+
+  // The root node stands for the empty stack.
+  std::vector<uint64_t> stack;
+  if (v8::AllocationProfile::Node* root = profile->GetRootNode()) {
+    AddAllocationSamples(root, stack);
+    for (v8::AllocationProfile::Node* child : root->children) {
+      SerializeAllocationNode(isolate, child, &stack);
+    }
+  }
+  Finish();
+}
+
+}  // namespace internal
+}  // namespace v8
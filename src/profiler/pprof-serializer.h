@@ -0,0 +1,92 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_PPROF_SERIALIZER_H_
+#define V8_PROFILER_PPROF_SERIALIZER_H_
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-profiler.h"
+#include "src/profiler/output-stream-writer.h"
+
+namespace v8 {
+namespace internal {
+
+class CpuProfile;
+class ProfileNode;
+
+// Writes profiles as a Profile message of pprof's profile.proto
+// (https://github.com/google/pprof/blob/main/proto/profile.proto). The few
+// message types needed are encoded by hand. Each call stack frame becomes a
+// Location with a single Line, so inlined frames, which are separate nodes
+// in V8's profile trees, become separate Locations as well.
+class PprofSerializer {
+ public:
+  explicit PprofSerializer(v8::OutputStream* stream);
+  PprofSerializer(const PprofSerializer&) = delete;
+  PprofSerializer& operator=(const PprofSerializer&) = delete;
+
+  // Writes a CPU profile with a "samples"/"count" and a "cpu"/"nanoseconds"
+  // value per sample.
+  void SerializeCpuProfile(const CpuProfile* profile);
+  // Writes an allocation profile with an "objects"/"count" and a
+  // "space"/"bytes" value per sample, and the allocation size as "bytes"
+  // label.
+  void SerializeAllocationProfile(v8::Isolate* isolate,
+                                  v8::AllocationProfile* profile);
+
+ private:
+  // A protobuf message under construction.
+  class Message {
+   public:
+    void AddVarint(int field, uint64_t value);
+    void AddMessage(int field, const Message& message);
+    void AddString(int field, const std::string& value);
+    void AddPackedVarints(int field, const std::vector<uint64_t>& values);
+
+    const std::vector<uint8_t>& bytes() const { return bytes_; }
+
+   private:
+    void AddTag(int field, int wire_type);
+    void AddRawVarint(uint64_t value);
+
+    std::vector<uint8_t> bytes_;
+  };
+
+  void SerializeCpuNode(const ProfileNode* node, int64_t period,
+                        std::vector<uint64_t>* stack);
+  void AddAllocationSamples(v8::AllocationProfile::Node* node,
+                            const std::vector<uint64_t>& stack);
+  void SerializeAllocationNode(v8::Isolate* isolate,
+                               v8::AllocationProfile::Node* node,
+                               std::vector<uint64_t>* stack);
+
+  int64_t GetStringId(const std::string& s);
+  uint64_t GetFunctionId(const std::string& name, const std::string& filename,
+                         int64_t start_line);
+  uint64_t AddLocation(uint64_t function_id, int64_t line);
+  void AddValueType(int field, const char* type, const char* unit);
+  void AddSample(const std::vector<uint64_t>& stack,
+                 const std::vector<uint64_t>& values,
+                 const Message* label = nullptr);
+  void Finish();
+
+  // Writes a top-level field of the Profile message to the stream.
+  void Write(const Message& field);
+
+  OutputStreamWriter writer_;
+  std::vector<std::string> strings_;
+  std::unordered_map<std::string, int64_t> string_ids_;
+  std::map<std::tuple<int64_t, int64_t, int64_t>, uint64_t> function_ids_;
+  uint64_t next_location_id_ = 1;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PROFILER_PPROF_SERIALIZER_H_
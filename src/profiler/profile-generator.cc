@@ -622,7 +622,9 @@ void CpuProfile::AddPath(base::TimeTicks timestamp,
                          const ProfileStackTrace& path, int src_line,
                          bool update_stats, base::TimeDelta sampling_interval,
                          StateTag state_tag,
-                         EmbedderStateTag embedder_state_tag) {
+                         EmbedderStateTag embedder_state_tag,
+                         uint64_t hardware_events) {
+  pending_hardware_events_ += hardware_events;
   if (!CheckSubsample(sampling_interval)) return;
 
   ProfileNode* top_frame_node =
@@ -635,8 +637,9 @@ void CpuProfile::AddPath(base::TimeTicks timestamp,
       !timestamp.IsNull() && timestamp >= start_time_ && !is_buffer_full;
 
   if (should_record_sample) {
-    samples_.push_back(
-        {top_frame_node, timestamp, src_line, state_tag, embedder_state_tag});
+    samples_.push_back({top_frame_node, timestamp, src_line, state_tag,
+                        embedder_state_tag, pending_hardware_events_});
+    pending_hardware_events_ = 0;
   } else if (is_buffer_full && delegate_ != nullptr) {
     const auto task_runner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
         reinterpret_cast<v8::Isolate*>(profiler_->isolate()));
@@ -948,6 +951,7 @@ InstructionStreamMap::InstructionStreamMap(CodeEntryStorage& storage)
 InstructionStreamMap::~InstructionStreamMap() { Clear(); }
 
 void InstructionStreamMap::Clear() {
+  InvalidateLookupCache();
   for (auto& slot : code_map_) {
     if (CodeEntry* entry = slot.second.entry) {
       code_entries_.DecRef(entry);
@@ -962,11 +966,13 @@ void InstructionStreamMap::Clear() {
 
 void InstructionStreamMap::AddCode(Address addr, CodeEntry* entry,
                                    unsigned size) {
+  InvalidateLookupCache();
   code_map_.emplace(addr, CodeEntryMapInfo{entry, size});
   entry->set_instruction_start(addr);
 }
 
 bool InstructionStreamMap::RemoveCode(CodeEntry* entry) {
+  InvalidateLookupCache();
   auto range = code_map_.equal_range(entry->instruction_start());
   for (auto i = range.first; i != range.second; ++i) {
     if (i->second.entry == entry) {
@@ -979,6 +985,7 @@ bool InstructionStreamMap::RemoveCode(CodeEntry* entry) {
 }
 
 void InstructionStreamMap::ClearCodesInRange(Address start, Address end) {
+  InvalidateLookupCache();
   auto left = code_map_.upper_bound(start);
   if (left != code_map_.begin()) {
     --left;
@@ -993,16 +1000,29 @@ void InstructionStreamMap::ClearCodesInRange(Address start, Address end) {
 
 CodeEntry* InstructionStreamMap::FindEntry(Address addr,
                                            Address* out_instruction_start) {
+  LookupCacheEntry& cached =
+      lookup_cache_[(addr ^ (addr >> 12)) % kLookupCacheSize];
+  if (cached.generation == lookup_cache_generation_ && cached.addr == addr) {
+    if (cached.entry && out_instruction_start) {
+      *out_instruction_start = cached.instruction_start;
+    }
+    return cached.entry;
+  }
+
   // Note that an address may correspond to multiple CodeEntry objects. An
   // arbitrary selection is made (as per multimap spec) in the event of a
   // collision.
+  CodeEntry* ret = nullptr;
+  Address start_address = kNullAddress;
   auto it = code_map_.upper_bound(addr);
-  if (it == code_map_.begin()) return nullptr;
-  --it;
-  Address start_address = it->first;
-  Address end_address = start_address + it->second.size;
-  CodeEntry* ret = addr < end_address ? it->second.entry : nullptr;
-  DCHECK(!ret || (addr >= start_address && addr < end_address));
+  if (it != code_map_.begin()) {
+    --it;
+    start_address = it->first;
+    Address end_address = start_address + it->second.size;
+    if (addr < end_address) ret = it->second.entry;
+    DCHECK(!ret || (addr >= start_address && addr < end_address));
+  }
+  cached = {addr, lookup_cache_generation_, ret, start_address};
   if (ret && out_instruction_start) *out_instruction_start = start_address;
   return ret;
 }
@@ -1010,6 +1030,7 @@ CodeEntry* InstructionStreamMap::FindEntry(Address addr,
 void InstructionStreamMap::MoveCode(Address from, Address to) {
   if (from == to) return;
 
+  InvalidateLookupCache();
   auto range = code_map_.equal_range(from);
   // Instead of iterating until |range.second|, iterate the number of elements.
   // This is because the |range.second| may no longer be the element past the
@@ -1186,7 +1207,7 @@ void CpuProfilesCollection::AddPathToCurrentProfiles(
     base::TimeTicks timestamp, const ProfileStackTrace& path, int src_line,
     bool update_stats, base::TimeDelta sampling_interval, StateTag state,
     EmbedderStateTag embedder_state_tag, Address native_context_address,
-    Address embedder_native_context_address) {
+    Address embedder_native_context_address, uint64_t hardware_events) {
   // As starting / stopping profiles is rare relatively to this
   // method, we don't bother minimizing the duration of lock holding,
   // e.g. copying contents of the list to a local vector.
@@ -1208,7 +1229,8 @@ void CpuProfilesCollection::AddPathToCurrentProfiles(
     profile->AddPath(timestamp, accepts_context ? path : empty_path, src_line,
                      update_stats, sampling_interval, state,
                      accepts_embedder_context ? embedder_state_tag
-                                              : EmbedderStateTag::EMPTY);
+                                              : EmbedderStateTag::EMPTY,
+                     hardware_events);
   }
 }
 
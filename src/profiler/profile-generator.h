@@ -414,6 +414,8 @@ class CpuProfile {
     int line;
     StateTag state_tag;
     EmbedderStateTag embedder_state_tag;
+    // Hardware events since the previous recorded sample.
+    uint64_t hardware_events;
   };
 
   V8_EXPORT_PRIVATE CpuProfile(
@@ -430,7 +432,7 @@ class CpuProfile {
   void AddPath(base::TimeTicks timestamp, const ProfileStackTrace& path,
                int src_line, bool update_stats,
                base::TimeDelta sampling_interval, StateTag state,
-               EmbedderStateTag embedder_state);
+               EmbedderStateTag embedder_state, uint64_t hardware_events = 0);
   void FinishProfile();
 
   const char* title() const { return title_; }
@@ -470,6 +472,9 @@ class CpuProfile {
   // Number of microseconds worth of profiler ticks that should elapse before
   // the next sample is recorded.
   base::TimeDelta next_sample_delta_;
+  // Hardware events of the ticks that were skipped by subsampling, which are
+  // attributed to the next recorded sample.
+  uint64_t pending_hardware_events_ = 0;
 };
 
 class CpuProfileMaxSamplesCallbackTask : public v8::Task {
@@ -515,8 +520,23 @@ class V8_EXPORT_PRIVATE InstructionStreamMap {
     unsigned size;
   };
 
+  // Samples mostly contain the same few return addresses, so the results of
+  // FindEntry are cached. Any change to the map invalidates all cached
+  // results by bumping the generation.
+  struct LookupCacheEntry {
+    Address addr;
+    size_t generation;
+    CodeEntry* entry;
+    Address instruction_start;
+  };
+  static constexpr size_t kLookupCacheSize = 256;
+
+  void InvalidateLookupCache() { ++lookup_cache_generation_; }
+
   std::multimap<Address, CodeEntryMapInfo> code_map_;
   CodeEntryStorage& code_entries_;
+  LookupCacheEntry lookup_cache_[kLookupCacheSize] = {};
+  size_t lookup_cache_generation_ = 1;
 };
 
 // Manages the lifetime of CodeEntry objects, and stores shared resources
@@ -573,7 +593,8 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
       bool update_stats, base::TimeDelta sampling_interval, StateTag state,
       EmbedderStateTag embedder_state_tag,
       Address native_context_address = kNullAddress,
-      Address native_embedder_context_address = kNullAddress);
+      Address native_embedder_context_address = kNullAddress,
+      uint64_t hardware_events = 0);
 
   // Called from profile generator thread.
   void UpdateNativeContextAddressForCurrentProfiles(Address from, Address to);
@@ -153,6 +153,7 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   JavaScriptStackFrameIterator frame_it(isolate_);
   int frames_captured = 0;
   bool found_arguments_marker_frames = false;
+  int allocation_position = kNoSourcePosition;
   while (!frame_it.done() && frames_captured < stack_depth_) {
     JavaScriptFrame* frame = frame_it.frame();
     // If we are materializing objects during deoptimization, inlined
@@ -162,6 +163,15 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
     // sensitive moment belong to the formerly optimized frame anyway.
     if (frame->unchecked_function().IsJSFunction()) {
       SharedFunctionInfo shared = frame->function()->shared();
+      if (frames_captured == 0 &&
+          (flags_ & v8::HeapProfiler::kSamplingSplitByAllocationSite)) {
+        // The bottom summary belongs to the function of the physical frame.
+        // For an allocation in an inlined function, this is the position of
+        // the outermost inlined call. Positions may be unavailable if they
+        // are collected lazily.
+        allocation_position =
+            FrameSummary::GetBottom(frame).AsJavaScript().SourcePosition();
+      }
       stack.push_back(shared);
       frames_captured++;
     } else {
@@ -220,6 +230,9 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   if (found_arguments_marker_frames) {
     node =
         FindOrAddChildNode(node, "(deopt)", v8::UnboundScript::kNoScriptId, 0);
+  } else if (allocation_position != kNoSourcePosition) {
+    node = FindOrAddChildNode(node, "(allocation site)", node->script_id_,
+                              allocation_position);
   }
 
   return node;
@@ -97,6 +97,9 @@ struct V8_EXPORT TickSample {
   bool has_external_callback = false;
   // Whether the sample should update aggregated stats.
   bool update_stats_ = true;
+  // Hardware events counted since the previous sample, see
+  // --cpu-profiler-hardware-event.
+  uint64_t hardware_events = 0;
 
   void* stack[kMaxFramesCount];  // Call stack.
 };
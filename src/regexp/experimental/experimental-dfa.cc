@@ -0,0 +1,250 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-dfa.h"
+
+#include <algorithm>
+
+#include "src/objects/string.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+ExperimentalRegExpDfa* ExperimentalRegExpDfa::New(
+    base::Vector<const RegExpInstruction> bytecode, Direction direction,
+    size_t memory_budget, Zone* zone) {
+  int start_pc = -1;
+  for (int pc = 0; pc < bytecode.length(); ++pc) {
+    const RegExpInstruction& inst = bytecode[pc];
+    if (inst.opcode == RegExpInstruction::ASSERTION) return nullptr;
+    // Register 0 holds the begin of the match and is only set once.
+    if (start_pc == -1 &&
+        inst.opcode == RegExpInstruction::SET_REGISTER_TO_CP &&
+        inst.payload.register_index == 0) {
+      start_pc = pc;
+    }
+  }
+  if (start_pc == -1) return nullptr;
+  return zone->New<ExperimentalRegExpDfa>(zone->CloneVector(bytecode),
+                                          direction, start_pc, memory_budget,
+                                          zone);
+}
+
+ExperimentalRegExpDfa::ExperimentalRegExpDfa(
+    base::Vector<const RegExpInstruction> bytecode, Direction direction,
+    int start_pc, size_t memory_budget, Zone* zone)
+    : zone_(zone),
+      bytecode_(bytecode),
+      direction_(direction),
+      start_pc_(start_pc),
+      memory_budget_(memory_budget),
+      class_boundaries_(zone),
+      predecessors_(zone),
+      states_(zone),
+      state_ids_(zone),
+      visited_(bytecode.length(), -1, zone),
+      worklist_(zone) {
+  class_boundaries_.push_back(0);
+  for (const RegExpInstruction& inst : bytecode_) {
+    if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+    RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+    if (range.min > range.max) continue;
+    class_boundaries_.push_back(range.min);
+    class_boundaries_.push_back(range.max + 1);
+  }
+  std::sort(class_boundaries_.begin(), class_boundaries_.end());
+  class_boundaries_.erase(
+      std::unique(class_boundaries_.begin(), class_boundaries_.end()),
+      class_boundaries_.end());
+  // One-byte input only ever needs the first classes.
+  one_byte_classes_ = zone->AllocateVector<int>(
+      static_cast<size_t>(String::kMaxOneByteCharCode) + 1);
+  for (int c = 0, cls = 0; c <= String::kMaxOneByteCharCode; ++c) {
+    while (cls + 1 < static_cast<int>(class_boundaries_.size()) &&
+           class_boundaries_[cls + 1] <= c) {
+      ++cls;
+    }
+    one_byte_classes_[c] = cls;
+  }
+
+  if (direction_ == Direction::kBackward) {
+    predecessors_.resize(bytecode_.length(), ZoneVector<int>(zone));
+    for (int pc = 0; pc < bytecode_.length(); ++pc) {
+      const RegExpInstruction& inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::FORK:
+          predecessors_[inst.payload.pc].push_back(pc);
+          predecessors_[pc + 1].push_back(pc);
+          break;
+        case RegExpInstruction::JMP:
+          predecessors_[inst.payload.pc].push_back(pc);
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+          predecessors_[pc + 1].push_back(pc);
+          break;
+        case RegExpInstruction::ACCEPT:
+        case RegExpInstruction::CONSUME_RANGE:
+          break;
+        case RegExpInstruction::ASSERTION:
+          UNREACHABLE();
+      }
+    }
+  }
+
+  // The dead state has no pcs, so all its transitions lead back to it.
+  const int num_classes = static_cast<int>(class_boundaries_.size());
+  int* dead_transitions = zone_->AllocateArray<int>(num_classes);
+  std::fill(dead_transitions, dead_transitions + num_classes, kDeadState);
+  states_.push_back(State{ZoneVector<int>(zone_), false, dead_transitions});
+}
+
+int ExperimentalRegExpDfa::ClassOf(base::uc16 c) const {
+  if (c <= String::kMaxOneByteCharCode) return one_byte_classes_[c];
+  auto it = std::upper_bound(class_boundaries_.begin(),
+                             class_boundaries_.end(), static_cast<int>(c));
+  return static_cast<int>(it - class_boundaries_.begin()) - 1;
+}
+
+bool ExperimentalRegExpDfa::Consumes(int pc, base::uc16 c) const {
+  const RegExpInstruction& inst = bytecode_[pc];
+  if (inst.opcode != RegExpInstruction::CONSUME_RANGE) return false;
+  RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+  return range.min <= c && c <= range.max;
+}
+
+void ExperimentalRegExpDfa::ForwardClosure(const ZoneVector<int>& entries,
+                                           ZoneVector<int>* pcs,
+                                           bool* is_match) {
+  // Mirrors `NfaInterpreter::RunActiveThread`: Threads are run in order of
+  // priority, a FORKed thread runs right after the thread forking it blocks,
+  // and a pc that was already reached by a thread with higher priority is
+  // skipped.
+  ++visited_epoch_;
+  *is_match = false;
+  for (int entry : entries) {
+    worklist_.push_back(entry);
+    while (!worklist_.empty()) {
+      int pc = worklist_.back();
+      worklist_.pop_back();
+      if (visited_[pc] == visited_epoch_) continue;
+      visited_[pc] = visited_epoch_;
+      const RegExpInstruction& inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          pcs->push_back(pc);
+          break;
+        case RegExpInstruction::FORK:
+          worklist_.push_back(inst.payload.pc);
+          worklist_.push_back(pc + 1);
+          break;
+        case RegExpInstruction::JMP:
+          worklist_.push_back(inst.payload.pc);
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+          worklist_.push_back(pc + 1);
+          break;
+        case RegExpInstruction::ACCEPT:
+          // All remaining threads have lower priority.
+          *is_match = true;
+          worklist_.clear();
+          return;
+        case RegExpInstruction::ASSERTION:
+          UNREACHABLE();
+      }
+    }
+  }
+}
+
+void ExperimentalRegExpDfa::BackwardClosure(const ZoneVector<int>& entries,
+                                            ZoneVector<int>* pcs) {
+  ++visited_epoch_;
+  for (int entry : entries) worklist_.push_back(entry);
+  while (!worklist_.empty()) {
+    int pc = worklist_.back();
+    worklist_.pop_back();
+    if (visited_[pc] == visited_epoch_) continue;
+    visited_[pc] = visited_epoch_;
+    pcs->push_back(pc);
+    for (int predecessor : predecessors_[pc]) worklist_.push_back(predecessor);
+  }
+  std::sort(pcs->begin(), pcs->end());
+}
+
+int ExperimentalRegExpDfa::FindOrAddState(ZoneVector<int>* pcs,
+                                          bool is_match) {
+  if (pcs->empty() && !is_match) return kDeadState;
+
+  ZoneVector<int> key = *pcs;
+  if (direction_ == Direction::kForward && is_match) key.push_back(-1);
+  auto it = state_ids_.find(key);
+  if (it != state_ids_.end()) return it->second;
+
+  const size_t num_classes = class_boundaries_.size();
+  const size_t size = sizeof(State) + 2 * key.size() * sizeof(int) +
+                      num_classes * sizeof(int);
+  if (memory_used_ + size > memory_budget_) return kOutOfMemory;
+  memory_used_ += size;
+
+  int* transitions = zone_->AllocateArray<int>(num_classes);
+  std::fill(transitions, transitions + num_classes, kUnknownState);
+  int id = static_cast<int>(states_.size());
+  states_.push_back(State{std::move(*pcs), is_match, transitions});
+  state_ids_.emplace(std::move(key), id);
+  return id;
+}
+
+int ExperimentalRegExpDfa::StartState() {
+  if (start_state_ != kUnknownState) return start_state_;
+
+  ZoneVector<int> pcs(zone_);
+  bool is_match = false;
+  if (direction_ == Direction::kForward) {
+    ForwardClosure(ZoneVector<int>({0}, zone_), &pcs, &is_match);
+  } else {
+    ZoneVector<int> accepts(zone_);
+    for (int pc = 0; pc < bytecode_.length(); ++pc) {
+      if (bytecode_[pc].opcode == RegExpInstruction::ACCEPT) {
+        accepts.push_back(pc);
+      }
+    }
+    BackwardClosure(accepts, &pcs);
+    is_match = std::binary_search(pcs.begin(), pcs.end(), start_pc_);
+  }
+  int state = FindOrAddState(&pcs, is_match);
+  if (state != kOutOfMemory) start_state_ = state;
+  return state;
+}
+
+int ExperimentalRegExpDfa::Next(int state, base::uc16 c) {
+  DCHECK_NE(state, kOutOfMemory);
+  const int cls = ClassOf(c);
+  int next = states_[state].transitions[cls];
+  if (next != kUnknownState) return next;
+
+  ZoneVector<int> entries(zone_);
+  ZoneVector<int> pcs(zone_);
+  bool is_match = false;
+  if (direction_ == Direction::kForward) {
+    for (int pc : states_[state].pcs) {
+      if (Consumes(pc, c)) entries.push_back(pc + 1);
+    }
+    ForwardClosure(entries, &pcs, &is_match);
+  } else {
+    for (int pc : states_[state].pcs) {
+      if (pc > 0 && Consumes(pc - 1, c)) entries.push_back(pc - 1);
+    }
+    BackwardClosure(entries, &pcs);
+    is_match = std::binary_search(pcs.begin(), pcs.end(), start_pc_);
+  }
+  next = FindOrAddState(&pcs, is_match);
+  // {states_} may have been reallocated.
+  if (next != kOutOfMemory) states_[state].transitions[cls] = next;
+  return next;
+}
+
+}  // namespace internal
+}  // namespace v8
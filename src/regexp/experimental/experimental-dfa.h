@@ -0,0 +1,122 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/zone/zone-containers.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+// A lazily built deterministic finite automaton (DFA) for a program in
+// EXPERIMENTAL bytecode, in the style of re2's DFA.  A state of the automaton
+// is the set of program counters of all threads of the NFA at an input
+// position, without their registers.  States and transitions are only
+// computed when some input reaches them, and their total size is bounded by a
+// memory budget.  Once the budget is exhausted, `Next` returns `kOutOfMemory`
+// and the caller has to fall back to the NFA.
+//
+// A forward automaton orders the program counters of its states by thread
+// priority and drops all threads with lower priority than an ACCEPTing one,
+// exactly like `NfaInterpreter`.  Thus, after starting it at some input
+// position, the last position at which it is in a state that `IsMatch` is the
+// end of the match the NFA reports.
+//
+// A backward automaton runs the program in reverse, starting at the end of a
+// match.  Its states `IsMatch` at all positions where a match with this end
+// can begin; the smallest of them is the begin of the match the NFA reports.
+//
+// Programs with ASSERTIONs are not supported, since their outcome depends on
+// the surrounding input and not only on the current state.
+class ExperimentalRegExpDfa final : public ZoneObject {
+ public:
+  enum class Direction { kForward, kBackward };
+
+  // The state without any live threads.  All its transitions lead back to
+  // it.
+  static constexpr int kDeadState = 0;
+  // Returned instead of a state if the memory budget is exhausted.
+  static constexpr int kOutOfMemory = -1;
+
+  // Returns nullptr if the automaton can't simulate `bytecode`.
+  static ExperimentalRegExpDfa* New(
+      base::Vector<const RegExpInstruction> bytecode, Direction direction,
+      size_t memory_budget, Zone* zone);
+
+  // The state before consuming any input, or kOutOfMemory.
+  int StartState();
+  // The state after consuming `c` in `state`, or kOutOfMemory.
+  int Next(int state, base::uc16 c);
+
+  bool IsMatch(int state) const {
+    DCHECK_NE(state, kOutOfMemory);
+    return states_[state].is_match;
+  }
+
+  ExperimentalRegExpDfa(base::Vector<const RegExpInstruction> bytecode,
+                        Direction direction, int start_pc,
+                        size_t memory_budget, Zone* zone);
+
+ private:
+  static constexpr int kUnknownState = -2;
+
+  struct State {
+    // Forward: the pcs of the threads that wait for input, from high to low
+    // priority.  Backward: the sorted pcs from which the end of the match can
+    // be reached with the input consumed so far.
+    ZoneVector<int> pcs;
+    bool is_match;
+    // Indexed by character class, kUnknownState if not computed yet.
+    int* transitions;
+  };
+
+  int ClassOf(base::uc16 c) const;
+  bool Consumes(int pc, base::uc16 c) const;
+
+  // Computes the pcs reachable from `entries` without consuming input, in the
+  // order described at `State::pcs`.
+  void ForwardClosure(const ZoneVector<int>& entries, ZoneVector<int>* pcs,
+                      bool* is_match);
+  void BackwardClosure(const ZoneVector<int>& entries, ZoneVector<int>* pcs);
+  // Returns the id of the state with the given contents, creating it if
+  // necessary, or kOutOfMemory.
+  int FindOrAddState(ZoneVector<int>* pcs, bool is_match);
+
+  Zone* const zone_;
+  const base::Vector<const RegExpInstruction> bytecode_;
+  const Direction direction_;
+  // Backward: the pc at which a match begins.
+  const int start_pc_;
+  const size_t memory_budget_;
+  size_t memory_used_ = 0;
+
+  // The character classes are the intervals between consecutive boundaries.
+  // No CONSUME_RANGE distinguishes between the characters of a class.
+  ZoneVector<int> class_boundaries_;
+  base::Vector<int> one_byte_classes_;
+
+  // Backward: the predecessors of each pc that don't consume input.
+  ZoneVector<ZoneVector<int>> predecessors_;
+
+  ZoneVector<State> states_;
+  // Maps the pcs of each state (followed by -1 for matching forward states)
+  // to its index in `states_`.
+  ZoneMap<ZoneVector<int>, int> state_ids_;
+  int start_state_ = kUnknownState;
+
+  // Scratch space for the closures.
+  ZoneVector<int> visited_;
+  int visited_epoch_ = 0;
+  ZoneVector<int> worklist_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
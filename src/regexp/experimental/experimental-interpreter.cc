@@ -7,8 +7,10 @@
 #include "src/base/optional.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
+#include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
+#include "src/regexp/experimental/experimental-dfa.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
@@ -159,6 +161,14 @@ class NfaInterpreter {
     DCHECK_LE(input_index_, input_.length());
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(), -1);
+
+    if (v8_flags.experimental_regexp_engine_dfa_budget > 0) {
+      const size_t budget = v8_flags.experimental_regexp_engine_dfa_budget * KB;
+      forward_dfa_ = ExperimentalRegExpDfa::New(
+          bytecode_, ExperimentalRegExpDfa::Direction::kForward, budget, zone);
+      backward_dfa_ = ExperimentalRegExpDfa::New(
+          bytecode_, ExperimentalRegExpDfa::Direction::kBackward, budget, zone);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -220,6 +230,8 @@ class NfaInterpreter {
     int* register_array_begin;
   };
 
+  static constexpr int kTicksBetweenInterruptHandling = 64;
+
   // Handles pending interrupts if there are any.  Returns
   // RegExp::kInternalRegExpSuccess if execution can continue, and an error
   // code otherwise.
@@ -283,6 +295,67 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  enum class DfaResult { kMatch, kNoMatch, kOutOfMemory };
+
+  // Finds the bounds of the next match with the DFAs: The forward automaton
+  // finds its end, then the backward automaton its begin.  Returns
+  // RegExp::kInternalRegExpSuccess unless an interrupt stopped execution, and
+  // the outcome in `result`.
+  int RunDfas(DfaResult* result, int* match_begin, int* match_end) {
+    int ticks = 0;
+    int index = input_index_;
+    int end = -1;
+    int state = forward_dfa_->StartState();
+    while (true) {
+      if (state == ExperimentalRegExpDfa::kOutOfMemory) {
+        *result = DfaResult::kOutOfMemory;
+        return RegExp::kInternalRegExpSuccess;
+      }
+      if (forward_dfa_->IsMatch(state)) end = index;
+      if (state == ExperimentalRegExpDfa::kDeadState ||
+          index == input_.length()) {
+        break;
+      }
+      state = forward_dfa_->Next(state, input_[index]);
+      ++index;
+      if (++ticks % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+    }
+    if (end == -1) {
+      *result = DfaResult::kNoMatch;
+      return RegExp::kInternalRegExpSuccess;
+    }
+
+    int begin = -1;
+    index = end;
+    state = backward_dfa_->StartState();
+    while (true) {
+      if (state == ExperimentalRegExpDfa::kOutOfMemory) {
+        *result = DfaResult::kOutOfMemory;
+        return RegExp::kInternalRegExpSuccess;
+      }
+      if (backward_dfa_->IsMatch(state)) begin = index;
+      if (state == ExperimentalRegExpDfa::kDeadState ||
+          index == input_index_) {
+        break;
+      }
+      --index;
+      state = backward_dfa_->Next(state, input_[index]);
+      if (++ticks % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+    }
+    DCHECK_GE(begin, input_index_);
+    DCHECK_LE(begin, end);
+    *result = DfaResult::kMatch;
+    *match_begin = begin;
+    *match_end = end;
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Change the current input index for future calls to `FindNextMatch`.
   void SetInputIndex(int new_input_index) {
     DCHECK_GE(input_index_, 0);
@@ -328,6 +401,34 @@ class NfaInterpreter {
       best_match_registers_ = base::nullopt;
     }
 
+    if (forward_dfa_ != nullptr && backward_dfa_ != nullptr) {
+      DfaResult result;
+      int match_begin, match_end;
+      int err_code = RunDfas(&result, &match_begin, &match_end);
+      if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      switch (result) {
+        case DfaResult::kNoMatch:
+          return RegExp::kInternalRegExpSuccess;
+        case DfaResult::kMatch:
+          if (register_count_per_match_ == 2) {
+            // Without captures the bounds are all we need.
+            best_match_registers_ = base::Vector<int>(
+                NewRegisterArrayUninitialized(), register_count_per_match_);
+            (*best_match_registers_)[0] = match_begin;
+            (*best_match_registers_)[1] = match_end;
+            return RegExp::kInternalRegExpSuccess;
+          }
+          // No match begins before `match_begin`, so the NFA only needs to
+          // run on the match itself to find the captures.
+          SetInputIndex(match_begin);
+          break;
+        case DfaResult::kOutOfMemory:
+          forward_dfa_ = nullptr;
+          backward_dfa_ = nullptr;
+          break;
+      }
+    }
+
     // All threads start at bytecode 0.
     active_threads_.Add(
         InterpreterThread{0, NewRegisterArray(kUndefinedRegisterValue)}, zone_);
@@ -348,7 +449,6 @@ class NfaInterpreter {
       base::uc16 input_char = input_[input_index_];
       ++input_index_;
 
-      static constexpr int kTicksBetweenInterruptHandling = 64;
       if (input_index_ % kTicksBetweenInterruptHandling == 0) {
         int err_code = HandleInterrupts();
         if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
@@ -551,6 +651,11 @@ class NfaInterpreter {
   // `register_array_allocator_`.
   base::Optional<base::Vector<int>> best_match_registers_;
 
+  // Lazily built automata to find the bounds of matches quickly, or nullptr
+  // if the program isn't supported or one of them ran out of memory.
+  ExperimentalRegExpDfa* forward_dfa_ = nullptr;
+  ExperimentalRegExpDfa* backward_dfa_ = nullptr;
+
   Zone* zone_;
 };
 
@@ -0,0 +1,60 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/common/globals.h"
+#include "src/flags/flags.h"
+
+namespace v8 {
+namespace internal {
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(RegExpBytecodeCache, RegExpBytecodeCache::Get)
+
+size_t RegExpBytecodeCache::KeyHash::operator()(const Key& key) const {
+  return base::hash_combine(
+      base::hash_range(key.source.begin(), key.source.end()),
+      static_cast<int>(key.flags), key.is_one_byte, key.backtrack_limit);
+}
+
+// static
+bool RegExpBytecodeCache::IsEnabled() {
+  return v8_flags.regexp_shared_bytecode_cache_size > 0;
+}
+
+// static
+std::shared_ptr<const RegExpBytecodeCache::Entry> RegExpBytecodeCache::Lookup(
+    const Key& key) {
+  DCHECK(IsEnabled());
+  RegExpBytecodeCache* cache = Get();
+  base::MutexGuard guard(&cache->mutex_);
+  auto it = cache->entries_.find(key);
+  if (it == cache->entries_.end()) return {};
+  return it->second;
+}
+
+// static
+void RegExpBytecodeCache::Insert(Key key, std::shared_ptr<const Entry> entry) {
+  DCHECK(IsEnabled());
+  const size_t max_size = v8_flags.regexp_shared_bytecode_cache_size * KB;
+  const size_t size = entry->bytecode.size() +
+                      key.source.size() * sizeof(base::uc16);
+  if (size > max_size) return;
+
+  RegExpBytecodeCache* cache = Get();
+  base::MutexGuard guard(&cache->mutex_);
+  if (cache->size_ + size > max_size) {
+    // Entries in use stay alive through their shared_ptrs.
+    cache->entries_.clear();
+    cache->size_ = 0;
+  }
+  if (cache->entries_.emplace(std::move(key), std::move(entry)).second) {
+    cache->size_ += size;
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
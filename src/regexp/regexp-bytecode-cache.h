@@ -0,0 +1,71 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8 {
+namespace internal {
+
+// A process-wide cache of irregexp bytecode, shared by all isolates.  Bytecode
+// doesn't reference any heap objects, so isolates that compile the same
+// pattern with the same flags can reuse it instead of parsing and compiling
+// the pattern again.  Native code is isolate-specific and not cached here.
+//
+// The total size of the cached bytecode is bounded by
+// --regexp-shared-bytecode-cache-size; the cache is cleared when it is full.
+class RegExpBytecodeCache final {
+ public:
+  struct Key {
+    std::vector<base::uc16> source;
+    RegExpFlags flags;
+    bool is_one_byte;
+    uint32_t backtrack_limit;
+
+    bool operator==(const Key& other) const {
+      return source == other.source && flags == other.flags &&
+             is_one_byte == other.is_one_byte &&
+             backtrack_limit == other.backtrack_limit;
+    }
+  };
+
+  struct Entry {
+    std::vector<uint8_t> bytecode;
+    int register_count;
+    // The named captures and their indices, sorted by index.
+    std::vector<std::pair<std::vector<base::uc16>, int>> named_captures;
+  };
+
+  static bool IsEnabled();
+
+  // Returns nullptr if there is no entry for `key`.
+  static std::shared_ptr<const Entry> Lookup(const Key& key);
+  static void Insert(Key key, std::shared_ptr<const Entry> entry);
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  base::Mutex mutex_;
+  std::unordered_map<Key, std::shared_ptr<const Entry>, KeyHash> entries_;
+  size_t size_ = 0;
+
+  static RegExpBytecodeCache* Get();
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
@@ -614,6 +614,48 @@ void RegExpBytecodePeephole::DefineStandardSequences() {
       .IgnoreArgument(2, 4, 4)   // indirect loop jump
       .IgnoreArgument(3, 4, 4)   // jump out of loop
       .IgnoreArgument(4, 4, 4);  // loop jump
+
+  // Greedy loops over a character class, e.g. /[a-z]*/.
+  CreateSequence(BC_LOAD_CURRENT_CHAR)
+      .FollowedBy(BC_CHECK_CHAR_NOT_IN_RANGE)
+      // Sequence is only valid if the jump targets of LOAD_CURRENT_CHAR and
+      // CHECK_CHAR_NOT_IN_RANGE are equal.
+      .IfArgumentEqualsValueAtOffset(8, 4, 0, 4, 4)
+      .FollowedBy(BC_ADVANCE_CP_AND_GOTO)
+      // Sequence is only valid if the jump target of ADVANCE_CP_AND_GOTO is the
+      // first bytecode in this sequence.
+      .IfArgumentEqualsOffset(4, 4, 0)
+      .ReplaceWith(BC_SKIP_WHILE_CHAR_IN_RANGE)
+      .MapArgument(0, 1, 3)      // load offset
+      .MapArgument(2, 1, 3, 4)   // advance by
+      .MapArgument(1, 4, 2)      // from
+      .MapArgument(1, 6, 2)      // to
+      .MapArgument(0, 4, 4)      // goto when not in range or at end of input
+      .IgnoreArgument(1, 8, 4)   // goto when not in range
+      .IgnoreArgument(2, 4, 4);  // loop jump
+
+  // Runs of literal characters after the bounds check, e.g. /abcd/.
+  CreateSequence(BC_LOAD_CURRENT_CHAR_UNCHECKED)
+      .FollowedBy(BC_CHECK_NOT_CHAR)
+      .ReplaceWith(BC_CHECK_NOT_CHAR_AT_UNCHECKED)
+      .MapArgument(0, 1, 3)     // load offset
+      .MapArgument(1, 1, 3, 4)  // character
+      .MapArgument(1, 4, 4);    // goto when not matched
+
+  CreateSequence(BC_LOAD_CURRENT_CHAR_UNCHECKED)
+      .FollowedBy(BC_CHECK_NOT_CHAR)
+      .FollowedBy(BC_LOAD_CURRENT_CHAR_UNCHECKED)
+      .FollowedBy(BC_CHECK_NOT_CHAR)
+      // Sequence is only valid if the jump targets of both CHECK_NOT_CHAR
+      // bytecodes are equal.
+      .IfArgumentEqualsValueAtOffset(4, 4, 1, 4, 4)
+      .ReplaceWith(BC_CHECK_NOT_2_CHARS_AT_UNCHECKED)
+      .MapArgument(0, 1, 3)      // load offset 1
+      .MapArgument(1, 1, 3, 4)   // character 1
+      .MapArgument(2, 1, 3, 4)   // load offset 2
+      .MapArgument(3, 1, 3, 4)   // character 2
+      .MapArgument(1, 4, 4)      // goto when not matched
+      .IgnoreArgument(3, 4, 4);  // goto when not matched 2
 }
 
 bool RegExpBytecodePeephole::OptimizeBytecode(const uint8_t* bytecode,
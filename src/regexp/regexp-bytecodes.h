@@ -211,7 +211,40 @@ static_assert(1 << BYTECODE_SHIFT > BYTECODE_MASK);
   /* 0x40 - 0xBF    Bit Table                                               */ \
   /* 0xC0 - 0xDF    Address of bytecode when character is matched           */ \
   /* 0xE0 - 0xFF    Address of bytecode when no match                       */ \
-  V(SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE, 58, 32)
+  V(SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE, 58, 32)                                 \
+  /* Combination of:                                                        */ \
+  /* LOAD_CURRENT_CHAR, CHECK_CHAR_NOT_IN_RANGE and ADVANCE_CP_AND_GOTO     */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3B (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x3F    Number of characters to advance                         */ \
+  /* 0x40 - 0x4F    Lower bound of the range                                */ \
+  /* 0x50 - 0x5F    Upper bound of the range                                */ \
+  /* 0x60 - 0x7F    Address of bytecode when character is not in range or   */ \
+  /*                the end of input is reached                             */ \
+  V(SKIP_WHILE_CHAR_IN_RANGE, 59, 16)                                          \
+  /* Combination of:                                                        */ \
+  /* LOAD_CURRENT_CHAR_UNCHECKED and CHECK_NOT_CHAR                         */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3C (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x3F    Character to match                                      */ \
+  /* 0x40 - 0x5F    Address of bytecode when character is not matched       */ \
+  V(CHECK_NOT_CHAR_AT_UNCHECKED, 60, 12)                                       \
+  /* Combination of two consecutive CHECK_NOT_CHAR_AT_UNCHECKED with the    */ \
+  /* same failure address, as emitted for runs of literal characters.       */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3D (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load offset of the first character                      */ \
+  /* 0x20 - 0x3F    First character to match                                */ \
+  /* 0x40 - 0x5F    Load offset of the second character                     */ \
+  /* 0x60 - 0x7F    Second character to match                               */ \
+  /* 0x80 - 0x9F    Address of bytecode when either character is not        */ \
+  /*                matched                                                 */ \
+  V(CHECK_NOT_2_CHARS_AT_UNCHECKED, 61, 20)
 
 #define COUNT(...) +1
 static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT);
@@ -221,7 +254,7 @@ static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT);
 // contiguous, strictly increasing, and start at 0.
 // TODO(jgruber): Do not explicitly assign values, instead generate them
 // implicitly from the list order.
-static_assert(kRegExpBytecodeCount == 59);
+static_assert(kRegExpBytecodeCount == 62);
 
 #define DECLARE_BYTECODES(name, code, length) \
   static constexpr int BC_##name = code;
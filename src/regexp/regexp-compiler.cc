@@ -2753,6 +2753,13 @@ int BitsetFirstSetBit(BoyerMoorePositionInfo::Bitset bitset) {
 void BoyerMoorePositionInfo::SetInterval(const Interval& interval) {
   w_ = AddRange(w_, kWordRanges, kWordRangeCount, interval);
 
+  if (interval.size() == 1 && (single_character_ == kNoSingleCharacter ||
+                               single_character_ == interval.from())) {
+    single_character_ = interval.from();
+  } else {
+    single_character_ = kSeveralCharacters;
+  }
+
   if (interval.size() >= kMapSize) {
     map_count_ = kMapSize;
     map_.set();
@@ -2771,6 +2778,7 @@ void BoyerMoorePositionInfo::SetInterval(const Interval& interval) {
 
 void BoyerMoorePositionInfo::SetAll() {
   w_ = kLatticeUnknown;
+  single_character_ = kSeveralCharacters;
   if (map_count_ != kMapSize) {
     map_count_ = kMapSize;
     map_.set();
@@ -2904,6 +2912,7 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   // contains precisely one character.
   bool found_single_character = false;
   int single_character = 0;
+  int exact_single_character = BoyerMoorePositionInfo::kNoSingleCharacter;
   for (int i = max_lookahead; i >= min_lookahead; i--) {
     BoyerMoorePositionInfo* map = bitmaps_->at(i);
     if (map->map_count() == 0) continue;
@@ -2918,12 +2927,24 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
 
     found_single_character = true;
     single_character = BitsetFirstSetBit(map->raw_bitset());
+    exact_single_character = map->single_character();
 
     DCHECK_NE(single_character, -1);
   }
 
   int lookahead_width = max_lookahead + 1 - min_lookahead;
 
+  if (found_single_character &&
+      exact_single_character != BoyerMoorePositionInfo::kNoSingleCharacter &&
+      v8_flags.regexp_simd_skip &&
+      masm->SkipUntilCharacter(
+          max_lookahead, static_cast<base::uc16>(exact_single_character))) {
+    // If the character at max_lookahead is not the single character then no
+    // match can start at the current position, so skipping to its next
+    // occurrence is equivalent to (and at least as fast as) the loop below.
+    return;
+  }
+
   if (found_single_character && lookahead_width == 1 && max_lookahead < 3) {
     // The mask-compare can probably handle this better.
     return;
@@ -2952,8 +2973,27 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
       GetSkipTable(min_lookahead, max_lookahead, boolean_skip_table);
   DCHECK_NE(0, skip_distance);
 
+  // If some position of the interval admits only a single character (e.g.
+  // for a literal), first skip to the next occurrence of that character; no
+  // match can start before it.
+  int skip_until_offset = -1;
+  int skip_until_character = BoyerMoorePositionInfo::kNoSingleCharacter;
+  if (v8_flags.regexp_simd_skip) {
+    for (int i = max_lookahead; i >= min_lookahead; i--) {
+      int c = bitmaps_->at(i)->single_character();
+      if (c == BoyerMoorePositionInfo::kNoSingleCharacter) continue;
+      skip_until_offset = i;
+      skip_until_character = c;
+      break;
+    }
+  }
+
   Label cont, again;
   masm->Bind(&again);
+  if (skip_until_offset >= 0) {
+    masm->SkipUntilCharacter(skip_until_offset,
+                             static_cast<base::uc16>(skip_until_character));
+  }
   masm->LoadCurrentCharacter(max_lookahead, &cont, true);
   masm->CheckBitInTable(boolean_skip_table, &cont);
   masm->AdvanceCurrentPosition(skip_distance);
@@ -146,6 +146,13 @@ class BoyerMoorePositionInfo : public ZoneObject {
 
   int map_count() const { return map_count_; }
 
+  // The only character that was set at this position, before masking, or
+  // kNoSingleCharacter if none or several characters were set.
+  static constexpr int kNoSingleCharacter = -1;
+  int single_character() const {
+    return single_character_ >= 0 ? single_character_ : kNoSingleCharacter;
+  }
+
   void Set(int character);
   void SetInterval(const Interval& interval);
   void SetAll();
@@ -159,6 +166,8 @@ class BoyerMoorePositionInfo : public ZoneObject {
  private:
   Bitset map_;
   int map_count_ = 0;               // Number of set bits in the map.
+  static constexpr int kSeveralCharacters = -2;
+  int single_character_ = kNoSingleCharacter;
   ContainedInLattice w_ = kNotYet;  // The \w character class.
 };
 
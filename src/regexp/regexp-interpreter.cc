@@ -407,13 +407,10 @@ IrregexpInterpreter::Result RawMatch(
 // Fill dispatch table from last defined bytecode up to the next power of two
 // with BREAK (invalid operation).
 // TODO(pthier): Find a way to fill up automatically (at compile time)
-// 59 real bytecodes -> 5 fillers
+// 62 real bytecodes -> 2 fillers
 #define BYTECODE_FILLER_ITERATOR(V) \
   V(BREAK) /* 1 */                  \
-  V(BREAK) /* 2 */                  \
-  V(BREAK) /* 3 */                  \
-  V(BREAK) /* 4 */                  \
-  V(BREAK) /* 5 */
+  V(BREAK) /* 2 */
 
 #define COUNT(...) +1
   static constexpr int kRegExpBytecodeFillerCount =
@@ -1028,6 +1025,45 @@ IrregexpInterpreter::Result RawMatch(
       SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
       DISPATCH();
     }
+    BYTECODE(SKIP_WHILE_CHAR_IN_RANGE) {
+      int32_t load_offset = LoadPacked24Signed(insn);
+      int32_t advance = Load32Aligned(pc + 4);
+      uint32_t from = Load16Aligned(pc + 8);
+      uint32_t to = Load16Aligned(pc + 10);
+      while (IndexIsInBounds(current + load_offset, subject.length())) {
+        current_char = subject[current + load_offset];
+        if (from > current_char || current_char > to) break;
+        ADVANCE_CURRENT_POSITION(advance);
+      }
+      SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+      DISPATCH();
+    }
+    BYTECODE(CHECK_NOT_CHAR_AT_UNCHECKED) {
+      uint32_t c = Load32Aligned(pc + 4);
+      current_char = subject[current + LoadPacked24Signed(insn)];
+      if (c != current_char) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
+      } else {
+        ADVANCE(CHECK_NOT_CHAR_AT_UNCHECKED);
+      }
+      DISPATCH();
+    }
+    BYTECODE(CHECK_NOT_2_CHARS_AT_UNCHECKED) {
+      uint32_t c = Load32Aligned(pc + 4);
+      current_char = subject[current + LoadPacked24Signed(insn)];
+      if (c != current_char) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
+        DISPATCH();
+      }
+      uint32_t c2 = Load32Aligned(pc + 12);
+      current_char = subject[current + Load32Aligned(pc + 8)];
+      if (c2 != current_char) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
+      } else {
+        ADVANCE(CHECK_NOT_2_CHARS_AT_UNCHECKED);
+      }
+      DISPATCH();
+    }
 #if V8_USE_COMPUTED_GOTO
 // Lint gets confused a lot if we just use !V8_USE_COMPUTED_GOTO or ifndef
 // V8_USE_COMPUTED_GOTO here.
@@ -11,6 +11,7 @@
 #include "src/execution/simulator.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/regexp/special-case.h"
+#include "src/strings/string-simd.h"
 #include "src/strings/unicode-inl.h"
 
 #ifdef V8_INTL_SUPPORT
@@ -236,6 +237,47 @@ void RegExpMacroAssembler::CheckNotInSurrogatePair(int cp_offset,
   Bind(&ok);
 }
 
+namespace {
+
+template <typename Char>
+const Char* FindCharacterImpl(const Char* start, const Char* end,
+                              Char character) {
+  using Block = SimdCharBlock<Char>;
+  const Char* current = start;
+  if (Block::kIsVectorized) {
+    for (; end - current >= Block::kLanes; current += Block::kLanes) {
+      uint32_t mask = Block::Load(current).EqualMask(character);
+      if (mask != 0) return current + Block::FirstLane(mask);
+    }
+  }
+  for (; current < end; current++) {
+    if (*current == character) return current;
+  }
+  return end;
+}
+
+}  // namespace
+
+// static
+Address RegExpMacroAssembler::FindCharacter(Address start, Address end,
+                                            uint32_t character,
+                                            int char_size) {
+  if (start >= end) return start;
+  if (char_size == 1) {
+    DCHECK_LE(character, String::kMaxOneByteCharCode);
+    return reinterpret_cast<Address>(FindCharacterImpl(
+        reinterpret_cast<const uint8_t*>(start),
+        reinterpret_cast<const uint8_t*>(end),
+        static_cast<uint8_t>(character)));
+  }
+  DCHECK_EQ(2, char_size);
+  DCHECK_LE(character, String::kMaxUtf16CodeUnit);
+  return reinterpret_cast<Address>(FindCharacterImpl(
+      reinterpret_cast<const uint16_t*>(start),
+      reinterpret_cast<const uint16_t*>(end),
+      static_cast<uint16_t>(character)));
+}
+
 void RegExpMacroAssembler::CheckPosition(int cp_offset,
                                          Label* on_outside_input) {
   LoadCurrentCharacter(cp_offset, on_outside_input, true);
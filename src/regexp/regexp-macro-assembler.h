@@ -119,6 +119,14 @@ class RegExpMacroAssembler {
                                        Label* on_no_match) {
     return false;
   }
+  // Advances the current position to the first position p at or after it
+  // where the character at p + cp_offset is c, or to the end of the input if
+  // there is no such position. Returns false (and does nothing) if there is no
+  // vectorized support for this, in which case a plain loop is usually better.
+  // May clobber the current loaded character.
+  virtual bool SkipUntilCharacter(int cp_offset, base::uc16 c) {
+    return false;
+  }
 
   // Control-flow integrity:
   // Define a jump target and bind a label.
@@ -219,6 +227,14 @@ class RegExpMacroAssembler {
                                           Address raw_byte_array,
                                           Isolate* isolate);
 
+  // Returns the address of the first occurrence of `character` in the Latin1
+  // (char_size 1) or UC16 (char_size 2) characters in [start, end), or `end`
+  // if there is none. Returns `start` if it is not before `end`.
+  //
+  // Called from generated code.
+  static Address FindCharacter(Address start, Address end, uint32_t character,
+                               int char_size);
+
   // Controls the generation of large inlined constants in the code.
   void set_slow_safe(bool ssc) { slow_safe_compiler_ = ssc; }
   bool slow_safe() const { return slow_safe_compiler_; }
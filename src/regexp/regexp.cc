@@ -4,6 +4,7 @@
 
 #include "src/regexp/regexp.h"
 
+#include "src/base/optional.h"
 #include "src/base/strings.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/diagnostics/code-tracer.h"
@@ -11,6 +12,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -83,6 +85,10 @@ class RegExpImpl final : public AllStatic {
 
   static bool CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                               Handle<String> sample_subject, bool is_one_byte);
+  // Sets the bytecode of `re` from the process-wide bytecode cache.
+  static void InstallCachedBytecode(Isolate* isolate, Handle<JSRegExp> re,
+                                    bool is_one_byte,
+                                    const RegExpBytecodeCache::Entry& entry);
   static inline bool EnsureCompiledIrregexp(Isolate* isolate,
                                             Handle<JSRegExp> re,
                                             Handle<String> sample_subject,
@@ -549,6 +555,23 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
 
   Handle<String> pattern(re->source(), isolate);
   pattern = String::Flatten(isolate, pattern);
+  uint32_t backtrack_limit = re->backtrack_limit();
+
+  // Bytecode is isolate-independent, so another isolate may already have
+  // compiled this pattern.
+  base::Optional<RegExpBytecodeCache::Key> cache_key;
+  if (re->ShouldProduceBytecode() && RegExpBytecodeCache::IsEnabled()) {
+    std::vector<base::uc16> source(pattern->length());
+    String::WriteToFlat(*pattern, source.data(), 0, pattern->length());
+    cache_key = RegExpBytecodeCache::Key{std::move(source), flags, is_one_byte,
+                                         backtrack_limit};
+    if (std::shared_ptr<const RegExpBytecodeCache::Entry> entry =
+            RegExpBytecodeCache::Lookup(*cache_key)) {
+      InstallCachedBytecode(isolate, re, is_one_byte, *entry);
+      return true;
+    }
+  }
+
   RegExpCompileData compile_data;
   if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, pattern, flags,
                                                &compile_data)) {
@@ -566,7 +589,6 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   compile_data.compilation_target = re->ShouldProduceBytecode()
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
-  uint32_t backtrack_limit = re->backtrack_limit();
   const bool compilation_succeeded =
       Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
               is_one_byte, backtrack_limit);
@@ -605,6 +627,24 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   }
   data->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
 
+  if (cache_key.has_value()) {
+    auto entry = std::make_shared<RegExpBytecodeCache::Entry>();
+    ByteArray bytecode = ByteArray::cast(*compile_data.code);
+    entry->bytecode.resize(bytecode.length());
+    bytecode.copy_out(0, entry->bytecode.data(), bytecode.length());
+    entry->register_count = compile_data.register_count;
+    if (compile_data.named_captures != nullptr) {
+      // Sorted by index by CreateCaptureNameMap.
+      for (const RegExpCapture* capture : *compile_data.named_captures) {
+        entry->named_captures.emplace_back(
+            std::vector<base::uc16>(capture->name()->begin(),
+                                    capture->name()->end()),
+            capture->index());
+      }
+    }
+    RegExpBytecodeCache::Insert(std::move(*cache_key), std::move(entry));
+  }
+
   if (v8_flags.trace_regexp_tier_up) {
     PrintF("JSRegExp object %p %s size: %d\n",
            reinterpret_cast<void*>(re->ptr()),
@@ -617,6 +657,40 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   return true;
 }
 
+void RegExpImpl::InstallCachedBytecode(
+    Isolate* isolate, Handle<JSRegExp> re, bool is_one_byte,
+    const RegExpBytecodeCache::Entry& entry) {
+  int length = static_cast<int>(entry.bytecode.size());
+  Handle<ByteArray> bytecode =
+      isolate->factory()->NewByteArray(length, AllocationType::kOld);
+  bytecode->copy_in(0, entry.bytecode.data(), length);
+
+  Handle<FixedArray> capture_name_map;
+  if (!entry.named_captures.empty()) {
+    int len = static_cast<int>(entry.named_captures.size()) * 2;
+    capture_name_map = isolate->factory()->NewFixedArray(len);
+    for (int i = 0; i < len / 2; i++) {
+      const auto& [name, index] = entry.named_captures[i];
+      Handle<String> internalized_name = isolate->factory()->InternalizeString(
+          base::Vector<const base::uc16>(name.data(), name.size()));
+      capture_name_map->set(i * 2, *internalized_name);
+      capture_name_map->set(i * 2 + 1, Smi::FromInt(index));
+    }
+  }
+
+  DisallowGarbageCollection no_gc;
+  FixedArray data = FixedArray::cast(re->data());
+  data.set(JSRegExp::bytecode_index(is_one_byte), *bytecode);
+  data.set(JSRegExp::code_index(is_one_byte),
+           *BUILTIN_CODE(isolate, RegExpInterpreterTrampoline));
+  re->set_capture_name_map(capture_name_map);
+  if (entry.register_count > IrregexpMaxRegisterCount(data)) {
+    SetIrregexpMaxRegisterCount(data, entry.register_count);
+  }
+  data.set(JSRegExp::kIrregexpBacktrackLimit,
+           Smi::FromInt(re->backtrack_limit()));
+}
+
 int RegExpImpl::IrregexpMaxRegisterCount(FixedArray re) {
   return Smi::ToInt(re->get(JSRegExp::kIrregexpMaxRegisterCountIndex));
 }
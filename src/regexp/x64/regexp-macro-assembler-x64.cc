@@ -596,6 +596,49 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
   BranchOrBacktrack(not_equal, on_bit_set);
 }
 
+bool RegExpMacroAssemblerX64::SkipUntilCharacter(int cp_offset,
+                                                 base::uc16 c) {
+  Label done;
+  const int offset = cp_offset * char_size();
+  // Nothing left to search.
+  __ cmpl(rdi, Immediate(-offset));
+  __ j(greater_equal, &done);
+  // Avoid the call if the current position already is a candidate.
+  if (mode_ == LATIN1) {
+    __ cmpb(Operand(rsi, rdi, times_1, offset), Immediate(c));
+  } else {
+    DCHECK_EQ(UC16, mode_);
+    __ cmpw(Operand(rsi, rdi, times_1, offset), Immediate(c));
+  }
+  __ j(equal, &done);
+
+  PushCallerSavedRegisters();
+  static const int kNumArguments = 4;
+  __ PrepareCallCFunction(kNumArguments);
+  // On Linux arg_reg_1 is rdi and arg_reg_2 is rsi, so compute the start
+  // before overwriting the arguments.
+  __ leaq(rax, Operand(rsi, rdi, times_1, offset));
+  __ movq(arg_reg_2, rsi);
+  __ movq(arg_reg_1, rax);
+  __ movl(arg_reg_3, Immediate(c));
+  __ movl(arg_reg_4, Immediate(char_size()));
+  {
+    // We have a frame (set up in GetCode), but the assembler doesn't know.
+    FrameScope scope(&masm_, StackFrame::MANUAL);
+    CallCFunctionFromIrregexpCode(ExternalReference::re_find_character(),
+                                  kNumArguments);
+  }
+  PopCallerSavedRegisters();
+  __ Move(code_object_pointer(), masm_.CodeObject());
+
+  // rax is the address of the found character (or the end of input); turn it
+  // back into the current position.
+  __ subq(rax, rsi);
+  __ leaq(rdi, Operand(rax, -offset));
+  __ bind(&done);
+  return true;
+}
+
 bool RegExpMacroAssemblerX64::CheckSpecialClassRanges(StandardCharacterSet type,
                                                       Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
@@ -12,6 +12,7 @@
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/execution/tiering-manager.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -372,6 +373,9 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
     return ReadOnlyRoots(isolate).undefined_value();
   }
 
+  isolate->tiering_manager()->OnDeoptimization(function, optimized_code->kind(),
+                                               deopt_reason);
+
   // Non-OSR'd code is deoptimized unconditionally. If the deoptimization occurs
   // inside the outermost loop containning a loop that can trigger OSR
   // compilation, we remove the OSR code, it will avoid hit the out of date OSR
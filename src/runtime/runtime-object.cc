@@ -269,11 +269,15 @@ RUNTIME_FUNCTION(Runtime_ObjectKeys) {
 
   // Collect the own keys for the {receiver}.
   Handle<FixedArray> keys;
+  if (ObjectKeysCache::Lookup(isolate, receiver).ToHandle(&keys)) {
+    return *keys;
+  }
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
       isolate, keys,
       KeyAccumulator::GetKeys(isolate, receiver, KeyCollectionMode::kOwnOnly,
                               ENUMERABLE_STRINGS,
                               GetKeysConversion::kConvertToString));
+  ObjectKeysCache::Enter(isolate, receiver, keys);
   return *keys;
 }
 
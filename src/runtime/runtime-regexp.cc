@@ -620,6 +620,94 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalAtomRegExpWithString(
   return *result;
 }
 
+// Replaces all matches with a replacement string without substitution
+// patterns. Collects the match boundaries first, so the result can be written
+// into a single string of the exact size instead of building it from parts.
+template <typename ResultSeqString>
+V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithSimpleString(
+    Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
+    Handle<String> replacement, Handle<RegExpMatchInfo> last_match_info) {
+  DCHECK(subject->IsFlat());
+  DCHECK(replacement->IsFlat());
+
+  RegExpGlobalCache global_cache(regexp, subject, isolate);
+  if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
+
+  std::vector<int>* indices = GetRewoundRegexpIndicesList(isolate);
+  int subject_len = subject->length();
+  int replacement_len = replacement->length();
+  int64_t result_len_64 = subject_len;
+  for (int32_t* current_match = global_cache.FetchNext();
+       current_match != nullptr; current_match = global_cache.FetchNext()) {
+    indices->push_back(current_match[0]);
+    indices->push_back(current_match[1]);
+    result_len_64 += replacement_len - (current_match[1] - current_match[0]);
+  }
+  if (global_cache.HasException()) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).exception();
+  }
+  if (indices->empty()) return *subject;
+
+  RegExp::SetLastMatchInfo(isolate, last_match_info, subject,
+                           regexp->capture_count(),
+                           global_cache.LastSuccessfulMatch());
+
+  int result_len;
+  if (result_len_64 > static_cast<int64_t>(String::kMaxLength)) {
+    static_assert(String::kMaxLength < kMaxInt);
+    result_len = kMaxInt;  // Provoke exception.
+  } else {
+    result_len = static_cast<int>(result_len_64);
+  }
+  if (result_len == 0) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).empty_string();
+  }
+
+  MaybeHandle<SeqString> maybe_res;
+  if (ResultSeqString::kHasOneByteEncoding) {
+    maybe_res = isolate->factory()->NewRawOneByteString(result_len);
+  } else {
+    maybe_res = isolate->factory()->NewRawTwoByteString(result_len);
+  }
+  Handle<SeqString> untyped_res;
+  if (!maybe_res.ToHandle(&untyped_res)) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).exception();
+  }
+  Handle<ResultSeqString> result = Handle<ResultSeqString>::cast(untyped_res);
+
+  DisallowGarbageCollection no_gc;
+  typename ResultSeqString::Char* dest = result->GetChars(no_gc);
+  int subject_pos = 0;
+  for (size_t i = 0; i < indices->size(); i += 2) {
+    int start = (*indices)[i];
+    int end = (*indices)[i + 1];
+    // Copy non-matched subject content.
+    if (subject_pos < start) {
+      String::WriteToFlat(*subject, dest, subject_pos, start - subject_pos);
+      dest += start - subject_pos;
+    }
+    // Replace match.
+    if (replacement_len > 0) {
+      String::WriteToFlat(*replacement, dest, 0, replacement_len);
+      dest += replacement_len;
+    }
+    subject_pos = end;
+  }
+  // Add remaining subject content at the end.
+  if (subject_pos < subject_len) {
+    String::WriteToFlat(*subject, dest, subject_pos, subject_len - subject_pos);
+    dest += subject_len - subject_pos;
+  }
+  DCHECK_EQ(dest, result->GetChars(no_gc) + result_len);
+
+  TruncateRegexpIndicesList(isolate);
+
+  return *result;
+}
+
 V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
     Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
     Handle<String> replacement, Handle<RegExpMatchInfo> last_match_info) {
@@ -650,6 +738,17 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
     }
   }
 
+  if (simple_replace) {
+    if (subject->IsOneByteRepresentation() &&
+        replacement->IsOneByteRepresentation()) {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqOneByteString>(
+          isolate, subject, regexp, replacement, last_match_info);
+    } else {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqTwoByteString>(
+          isolate, subject, regexp, replacement, last_match_info);
+    }
+  }
+
   RegExpGlobalCache global_cache(regexp, subject, isolate);
   if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
 
@@ -677,11 +776,7 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
       builder.AddSubjectSlice(prev, start);
     }
 
-    if (simple_replace) {
-      builder.AddString(replacement);
-    } else {
-      compiled_replacement.Apply(&builder, start, end, current_match);
-    }
+    compiled_replacement.Apply(&builder, start, end, current_match);
     prev = end;
 
     current_match = global_cache.FetchNext();
@@ -3,6 +3,8 @@
 // found in the LICENSE file.
 
 #include "src/base/atomicops.h"
+#include "src/base/macros.h"
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/heap/factory.h"
@@ -95,6 +97,132 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Arrays shorter than this are sorted with std::sort.
+constexpr size_t kMinRadixSortLength = 64;
+
+template <size_t kSize>
+struct UnsignedOfSize;
+template <>
+struct UnsignedOfSize<1> {
+  using type = uint8_t;
+};
+template <>
+struct UnsignedOfSize<2> {
+  using type = uint16_t;
+};
+template <>
+struct UnsignedOfSize<4> {
+  using type = uint32_t;
+};
+template <>
+struct UnsignedOfSize<8> {
+  using type = uint64_t;
+};
+
+// Radix sort keys are unsigned integers with the same order as CompareNum
+// on the values, except for NaNs.
+template <typename T>
+using RadixKey = typename UnsignedOfSize<sizeof(T)>::type;
+
+template <typename T>
+constexpr RadixKey<T> kRadixKeySignBit = RadixKey<T>{1}
+                                         << (sizeof(T) * kBitsPerByte - 1);
+
+template <typename T>
+RadixKey<T> ToRadixKey(T value) {
+  RadixKey<T> bits = base::bit_cast<RadixKey<T>>(value);
+  if constexpr (std::is_floating_point<T>::value) {
+    // Negative numbers are ordered by the reverse of their magnitude, and
+    // -0.0 ends up right below +0.0.
+    return (bits & kRadixKeySignBit<T>) ? ~bits : bits | kRadixKeySignBit<T>;
+  } else if constexpr (std::is_signed<T>::value) {
+    return bits ^ kRadixKeySignBit<T>;
+  } else {
+    return bits;
+  }
+}
+
+template <typename T>
+T FromRadixKey(RadixKey<T> key) {
+  RadixKey<T> bits = key;
+  if constexpr (std::is_floating_point<T>::value) {
+    bits = (key & kRadixKeySignBit<T>) ? key ^ kRadixKeySignBit<T> : ~key;
+  } else if constexpr (std::is_signed<T>::value) {
+    bits = key ^ kRadixKeySignBit<T>;
+  }
+  return base::bit_cast<T>(bits);
+}
+
+// Sorts the {length} values of type T at {data} like std::sort with
+// CompareNum, with an LSD radix sort on 8 bit digits. This takes at most
+// sizeof(T) linear passes independent of the input, and its loops are simple
+// enough to be vectorized. {data} does not have to be aligned.
+template <typename T>
+void RadixSortNum(Address data, size_t length) {
+  using Key = RadixKey<T>;
+  constexpr size_t kRadix = 1 << kBitsPerByte;
+  auto load = [data](size_t i) {
+    return base::ReadUnalignedValue<T>(data + i * sizeof(T));
+  };
+  auto store = [data](size_t i, T value) {
+    base::WriteUnalignedValue<T>(data + i * sizeof(T), value);
+  };
+
+  if constexpr (sizeof(T) == 1) {
+    // A single pass is a counting sort, which can write the values directly.
+    size_t counts[kRadix] = {};
+    for (size_t i = 0; i < length; i++) counts[ToRadixKey(load(i))]++;
+    size_t i = 0;
+    for (size_t key = 0; key < kRadix; key++) {
+      T value = FromRadixKey<T>(static_cast<Key>(key));
+      for (size_t count = counts[key]; count > 0; count--) store(i++, value);
+    }
+    return;
+  }
+
+  // NaNs compare greater than everything, no matter their bits, so they are
+  // moved to the end as they are.
+  std::vector<Key> keys;
+  std::vector<T> nans;
+  keys.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    T value = load(i);
+    if constexpr (std::is_floating_point<T>::value) {
+      if (std::isnan(value)) {
+        nans.push_back(value);
+        continue;
+      }
+    }
+    keys.push_back(ToRadixKey(value));
+  }
+
+  const size_t count = keys.size();
+  std::vector<Key> scratch(count);
+  Key* from = keys.data();
+  Key* to = scratch.data();
+  for (size_t shift = 0; count > 1 && shift < sizeof(Key) * kBitsPerByte;
+       shift += kBitsPerByte) {
+    size_t offsets[kRadix] = {};
+    for (size_t i = 0; i < count; i++) offsets[(from[i] >> shift) & 0xFF]++;
+    // Skip digits that are the same for all keys, like the high bytes of
+    // small integers.
+    if (offsets[(from[0] >> shift) & 0xFF] == count) continue;
+    size_t offset = 0;
+    for (size_t& digit_offset : offsets) {
+      size_t digit_count = digit_offset;
+      digit_offset = offset;
+      offset += digit_count;
+    }
+    for (size_t i = 0; i < count; i++) {
+      to[offsets[(from[i] >> shift) & 0xFF]++] = from[i];
+    }
+    std::swap(from, to);
+  }
+
+  for (size_t i = 0; i < count; i++) store(i, FromRadixKey<T>(from[i]));
+  for (size_t i = 0; i < nans.size(); i++) store(count + i, nans[i]);
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -149,8 +277,10 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   case kExternal##Type##Array: {                                           \
     ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
                             : static_cast<ctype*>(array->DataPtr());       \
-    if (kExternal##Type##Array == kExternalFloat64Array ||                 \
-        kExternal##Type##Array == kExternalFloat32Array) {                 \
+    if (length >= kMinRadixSortLength) {                                   \
+      RadixSortNum<ctype>(reinterpret_cast<Address>(data), length);        \
+    } else if (kExternal##Type##Array == kExternalFloat64Array ||          \
+               kExternal##Type##Array == kExternalFloat32Array) {          \
       if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
         std::sort(UnalignedSlot<ctype>(data),                              \
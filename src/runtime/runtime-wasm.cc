@@ -11,6 +11,7 @@
 #include "src/heap/factory.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/objects-inl.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/trap-handler/trap-handler.h"
 #include "src/wasm/module-compiler.h"
@@ -807,46 +808,6 @@ RUNTIME_FUNCTION(Runtime_WasmDebugBreak) {
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
-// Assumes copy ranges are in-bounds and copy length > 0.
-RUNTIME_FUNCTION(Runtime_WasmArrayCopy) {
-  ClearThreadInWasmScope flag_scope(isolate);
-  HandleScope scope(isolate);
-  DisallowGarbageCollection no_gc;
-  DCHECK_EQ(5, args.length());
-  WasmArray dst_array = WasmArray::cast(args[0]);
-  uint32_t dst_index = args.positive_smi_value_at(1);
-  WasmArray src_array = WasmArray::cast(args[2]);
-  uint32_t src_index = args.positive_smi_value_at(3);
-  uint32_t length = args.positive_smi_value_at(4);
-  DCHECK_GT(length, 0);
-  bool overlapping_ranges =
-      dst_array.ptr() == src_array.ptr() &&
-      (dst_index < src_index ? dst_index + length > src_index
-                             : src_index + length > dst_index);
-  wasm::ValueType element_type = src_array->type()->element_type();
-  if (element_type.is_reference()) {
-    ObjectSlot dst_slot = dst_array->ElementSlot(dst_index);
-    ObjectSlot src_slot = src_array->ElementSlot(src_index);
-    if (overlapping_ranges) {
-      isolate->heap()->MoveRange(dst_array, dst_slot, src_slot, length,
-                                 UPDATE_WRITE_BARRIER);
-    } else {
-      isolate->heap()->CopyRange(dst_array, dst_slot, src_slot, length,
-                                 UPDATE_WRITE_BARRIER);
-    }
-  } else {
-    void* dst = reinterpret_cast<void*>(dst_array->ElementAddress(dst_index));
-    void* src = reinterpret_cast<void*>(src_array->ElementAddress(src_index));
-    size_t copy_size = length * element_type.value_kind_size();
-    if (overlapping_ranges) {
-      MemMove(dst, src, copy_size);
-    } else {
-      MemCopy(dst, src, copy_size);
-    }
-  }
-  return ReadOnlyRoots(isolate).undefined_value();
-}
-
 RUNTIME_FUNCTION(Runtime_WasmArrayNewSegment) {
   ClearThreadInWasmScope flag_scope(isolate);
   HandleScope scope(isolate);
@@ -1204,11 +1165,14 @@ namespace {
 template <typename T>
 int MeasureWtf8(base::Vector<const T> wtf16) {
   int previous = unibrow::Utf16::kNoPreviousCharacter;
-  int length = 0;
   DCHECK(wtf16.size() <= String::kMaxLength);
   static_assert(String::kMaxLength <=
                 (kMaxInt / unibrow::Utf8::kMaxEncodedSize));
-  for (size_t i = 0; i < wtf16.size(); i++) {
+  // Every code unit of the ASCII prefix encodes as a single byte.
+  int ascii_length =
+      NonAsciiStart(wtf16.begin(), static_cast<int>(wtf16.size()));
+  int length = ascii_length;
+  for (size_t i = ascii_length; i < wtf16.size(); i++) {
     int current = wtf16[i];
     length += unibrow::Utf8::Length(current, previous);
     previous = current;
@@ -1269,8 +1233,14 @@ int EncodeWtf8(base::Vector<char> bytes, size_t offset,
 
   char* dst_start = bytes.begin() + offset;
   char* dst = dst_start;
+  // Copy the ASCII prefix in bulk; none of it can start a surrogate pair, so
+  // the encoder below can start with no previous character.
+  int ascii_length =
+      NonAsciiStart(wtf16.begin(), static_cast<int>(wtf16.size()));
+  CopyChars(dst, wtf16.begin(), ascii_length);
+  dst += ascii_length;
   int previous = unibrow::Utf16::kNoPreviousCharacter;
-  for (auto code_unit : wtf16) {
+  for (auto code_unit : wtf16.SubVectorFrom(ascii_length)) {
     dst += unibrow::Utf8::Encode(dst, code_unit, previous, replace_invalid);
     previous = code_unit;
   }
@@ -39,6 +39,10 @@ uint32_t CodePointerTableEntry::GetNextFreelistEntryIndex() const {
 }
 
 void CodePointerTableEntry::Mark() {
+  // Entry points are loaded from the same cache line on every call through
+  // the table, so avoid dirtying it if the entry is already marked, which it
+  // is for all entries allocated since the last sweep.
+  if (IsMarked()) return;
   marking_state_.store(1, std::memory_order_relaxed);
 }
 
@@ -377,11 +377,15 @@ void FinalizeDeserialization(Isolate* isolate,
   }
 }
 
+// We trigger early baseline compilation only in concurrent sparkplug and
+// baseline batch compilation mode, which consumes little main thread execution
+// time.
+bool ShouldBaselineBatchCompileDeserializedCode() {
+  return v8_flags.concurrent_sparkplug && v8_flags.baseline_batch_compilation;
+}
+
 void BaselineBatchCompileIfSparkplugCompiled(Isolate* isolate, Script script) {
-  // Here is main thread, we trigger early baseline compilation only in
-  // concurrent sparkplug and baseline batch compilation mode which consumes
-  // little main thread execution time.
-  if (v8_flags.concurrent_sparkplug && v8_flags.baseline_batch_compilation) {
+  if (ShouldBaselineBatchCompileDeserializedCode()) {
     SharedFunctionInfo::ScriptIterator iter(isolate, script);
     for (SharedFunctionInfo info = iter.Next(); !info.is_null();
          info = iter.Next()) {
@@ -509,6 +513,19 @@ CodeSerializer::StartDeserializeOffThread(LocalIsolate* local_isolate,
 
   result.maybe_result =
       local_isolate->heap()->NewPersistentMaybeHandle(local_maybe_result);
+  if (!local_maybe_result.is_null() &&
+      ShouldBaselineBatchCompileDeserializedCode()) {
+    for (Handle<Script> script : result.scripts) {
+      SharedFunctionInfo::ScriptIterator iter(
+          handle(script->shared_function_infos(), local_isolate));
+      for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+           info = iter.Next()) {
+        if (!info->sparkplug_compiled()) continue;
+        result.sparkplug_compiled_functions.push_back(
+            local_isolate->heap()->NewPersistentHandle(info));
+      }
+    }
+  }
   result.persistent_handles = local_isolate->heap()->DetachPersistentHandles();
 
   return result;
@@ -588,8 +605,13 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
 
     // Fix up the script list to include the newly deserialized script.
     Handle<WeakArrayList> list = isolate->factory()->script_list();
+    for (Handle<SharedFunctionInfo> info : data.sparkplug_compiled_functions) {
+      DCHECK(data.persistent_handles->Contains(info.location()));
+      if (CanCompileWithBaseline(isolate, *info)) {
+        isolate->baseline_batch_compiler()->EnqueueSFI(*info);
+      }
+    }
     for (Handle<Script> script : data.scripts) {
-      BaselineBatchCompileIfSparkplugCompiled(isolate, *script);
       DCHECK(data.persistent_handles->Contains(script.location()));
       list = WeakArrayList::AddToEnd(isolate, list,
                                      MaybeObjectHandle::Weak(script));
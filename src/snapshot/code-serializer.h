@@ -71,6 +71,10 @@ class CodeSerializer : public Serializer {
     friend class CodeSerializer;
     MaybeHandle<SharedFunctionInfo> maybe_result;
     std::vector<Handle<Script>> scripts;
+    // The functions to enqueue for baseline batch compilation, found while
+    // still off-thread so that finishing doesn't have to visit every
+    // function of the script.
+    std::vector<Handle<SharedFunctionInfo>> sparkplug_compiled_functions;
     std::unique_ptr<PersistentHandles> persistent_handles;
     SerializedCodeSanityCheckResult sanity_check_result;
   };
@@ -110,6 +114,13 @@ class CodeSerializer : public Serializer {
  private:
   void SerializeObjectImpl(Handle<HeapObject> o, SlotType slot_type) override;
 
+  // Code caches are deserialized with rehashing, and each deserialized script
+  // gets a new id. Leaving both out makes the cache of a script the same in
+  // all processes, so that identical caches can be deduplicated and mapped
+  // from a shared file.
+  bool RecomputesStringHashes() const override { return true; }
+  bool RecomputesScriptIds() const override { return true; }
+
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
 };
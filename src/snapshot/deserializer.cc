@@ -4,6 +4,9 @@
 
 #include "src/snapshot/deserializer.h"
 
+#include <atomic>
+#include <type_traits>
+
 #include "src/base/logging.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/reloc-info-inl.h"
@@ -16,6 +19,7 @@
 #include "src/heap/heap-write-barrier.h"
 #include "src/heap/heap.h"
 #include "src/heap/local-heap-inl.h"
+#include "src/init/v8.h"
 #include "src/logging/local-logger.h"
 #include "src/logging/log.h"
 #include "src/objects/backing-store.h"
@@ -216,9 +220,69 @@ Deserializer<IsolateT>::Deserializer(IsolateT* isolate,
   CHECK_EQ(magic_number_, SerializedData::kMagicNumber);
 }
 
+namespace {
+
+// Hashes sequential strings in batches. Hashing neither allocates nor
+// touches anything but the string itself, so this can run on worker threads
+// while the main thread waits for the job.
+class HashStringsJob final : public JobTask {
+ public:
+  explicit HashStringsJob(const std::vector<Address>* strings)
+      : strings_(strings) {}
+
+  void Run(JobDelegate* delegate) override {
+    const size_t count = strings_->size();
+    while (!delegate->ShouldYield()) {
+      size_t begin = next_.fetch_add(kBatchSize, std::memory_order_relaxed);
+      if (begin >= count) return;
+      size_t end = std::min(begin + kBatchSize, count);
+      for (size_t i = begin; i < end; i++) {
+        String::cast(Object((*strings_)[i]))->EnsureHash();
+      }
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next = next_.load(std::memory_order_relaxed);
+    if (next >= strings_->size()) return 0;
+    return worker_count + (strings_->size() - next + kBatchSize - 1) /
+                              kBatchSize;
+  }
+
+  static constexpr size_t kBatchSize = 256;
+
+ private:
+  const std::vector<Address>* const strings_;
+  std::atomic<size_t> next_{0};
+};
+
+}  // namespace
+
+template <typename IsolateT>
+void Deserializer<IsolateT>::HashStrings() {
+  // Below this, starting a job costs more than it saves.
+  static constexpr size_t kMinStringsForParallelHashing =
+      8 * HashStringsJob::kBatchSize;
+  DisallowGarbageCollection no_gc;
+  if (!std::is_same_v<IsolateT, Isolate> || v8_flags.single_threaded ||
+      to_hash_.size() < kMinStringsForParallelHashing) {
+    for (Handle<String> string : to_hash_) string->EnsureHash();
+  } else {
+    std::vector<Address> strings;
+    strings.reserve(to_hash_.size());
+    for (Handle<String> string : to_hash_) strings.push_back(string->ptr());
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<HashStringsJob>(&strings))
+        ->Join();
+  }
+  to_hash_.clear();
+}
+
 template <typename IsolateT>
 void Deserializer<IsolateT>::Rehash() {
   DCHECK(should_rehash());
+  HashStrings();
   for (Handle<HeapObject> item : to_rehash_) {
     item->RehashBasedOnMap(isolate());
   }
@@ -438,6 +502,13 @@ void Deserializer<IsolateT>::PostProcessNewObject(Handle<Map> map,
       // read-only space are rehashed lazily. (e.g. when rehashing dictionaries)
       if (space == SnapshotSpace::kReadOnlyHeap) {
         PushObjectToRehash(obj);
+      } else if (!deserializing_user_code() &&
+                 InstanceTypeChecker::IsInternalizedString(instance_type) &&
+                 (instance_type & kStringRepresentationMask) ==
+                     kSeqStringTag) {
+        // Internalized strings are mostly keys of the hash tables and
+        // descriptor arrays that {Rehash} handles, so hash them up front.
+        to_hash_.push_back(Handle<String>::cast(obj));
       }
     } else if (raw_obj->NeedsRehashing(instance_type)) {
       PushObjectToRehash(obj);
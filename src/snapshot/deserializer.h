@@ -109,6 +109,9 @@ class Deserializer : public SerializerDeserializer {
     to_rehash_.push_back(object);
   }
   void Rehash();
+  // Computes the hashes of the internalized strings that the objects to
+  // rehash are likely to look up, on worker threads if there are many.
+  void HashStrings();
 
   Handle<HeapObject> ReadObject();
 
@@ -287,6 +290,7 @@ class Deserializer : public SerializerDeserializer {
   // TODO(6593): generalize rehashing, and remove this flag.
   const bool should_rehash_;
   std::vector<Handle<HeapObject>> to_rehash_;
+  std::vector<Handle<String>> to_hash_;
 
   // Do not collect any gc stats during deserialization since objects might
   // be in an invalid state
@@ -60,11 +60,27 @@ class ReadOnlyHeapImageDeserializer final {
       uint32_t compressed_page_addr = source_->GetUint32();
       Address pos = isolate_->GetPtrComprCage()->base() + compressed_page_addr;
       ro_space()->AllocateNextPageAt(pos);
+      segments_end_ = ro_space()->pages().back()->area_start();
     } else {
       ro_space()->AllocateNextPage();
     }
   }
 
+  // Makes sure that the memory the serializer left out between segments is
+  // zero. Fresh pages already are, and reading them doesn't make the OS
+  // allocate memory for them.
+  void ZeroGapBefore(Address segment_start) {
+    DCHECK(V8_STATIC_ROOTS_BOOL);
+    DCHECK_LE(segments_end_, segment_start);
+    for (Address a = segments_end_; a < segment_start;
+         a += kSystemPointerSize) {
+      if (base::Memory<Address>(a) != 0) {
+        memset(reinterpret_cast<void*>(a), 0, segment_start - a);
+        break;
+      }
+    }
+  }
+
   void DeserializeReadOnlySegment() {
     ReadOnlyPage* cur_page = ro_space()->pages().back();
 
@@ -72,6 +88,10 @@ class ReadOnlyHeapImageDeserializer final {
     Address start = cur_page->area_start() + source_->GetUint30();
     int size_in_bytes = source_->GetUint30();
     CHECK_LE(start + size_in_bytes, cur_page->area_end());
+    if (V8_STATIC_ROOTS_BOOL) {
+      ZeroGapBefore(start);
+      segments_end_ = start + size_in_bytes;
+    }
     source_->CopyRaw(reinterpret_cast<void*>(start), size_in_bytes);
     ro_space()->top_ = start + size_in_bytes;
 
@@ -97,10 +117,9 @@ class ReadOnlyHeapImageDeserializer final {
   void DecodeTaggedSlots(Address segment_start,
                          const ro::BitSet& tagged_slots) {
     DCHECK(!V8_STATIC_ROOTS_BOOL);
-    for (size_t i = 0; i < tagged_slots.size_in_bits(); i++) {
-      // TODO(jgruber): Depending on sparseness, different iteration methods
-      // could be more efficient.
-      if (!tagged_slots.contains(static_cast<int>(i))) continue;
+    tagged_slots.IterateSetBits([this, segment_start, &tagged_slots](int i) {
+      DCHECK_LT(static_cast<size_t>(i), tagged_slots.size_in_bits());
+      USE(tagged_slots);
       Address slot_addr = segment_start + i * kTaggedSize;
       Address obj_addr = Decode(ro::EncodedTagged_t::FromAddress(slot_addr));
       Address obj_ptr = obj_addr + kHeapObjectTag;
@@ -109,7 +128,7 @@ class ReadOnlyHeapImageDeserializer final {
       *dst = COMPRESS_POINTERS_BOOL
                  ? V8HeapCompressionScheme::CompressObject(obj_ptr)
                  : static_cast<Tagged_t>(obj_ptr);
-    }
+    });
   }
 
   void DeserializeReadOnlyRootsTable() {
@@ -132,6 +151,8 @@ class ReadOnlyHeapImageDeserializer final {
 
   SnapshotByteSource* const source_;
   Isolate* const isolate_;
+  // With static roots, the end of the last segment of the current page.
+  Address segments_end_ = kNullAddress;
 };
 
 ReadOnlyDeserializer::ReadOnlyDeserializer(Isolate* isolate,
@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_READ_ONLY_SERIALIZER_DESERIALIZER_H_
 #define V8_SNAPSHOT_READ_ONLY_SERIALIZER_DESERIALIZER_H_
 
+#include "src/base/bits.h"
+#include "src/base/memory.h"
 #include "src/common/globals.h"
 
 namespace v8 {
@@ -42,6 +44,13 @@ namespace ro {
 // tagged_slots_bitfield[] - bitfield of tagged slots
 // #endif  // V8_STATIC_ROOTS
 // ----------------------------------------------------------------
+//
+// With static roots, segments leave out aligned blocks of kZeroBlockSize
+// zero bytes. The deserializer only has to make sure that memory between
+// segments is zero, which it usually already is, so these OS pages are never
+// written to and are only materialized when touched.
+static constexpr size_t kZeroBlockSize = 4 * KB;
+
 enum Bytecode {
   kPage,
   kSegment,
@@ -78,6 +87,32 @@ class BitSet final {
     data_[chunk_index(i)] |= bit_mask(i);
   }
 
+  // Calls {callback(i)} for each i in the set, in increasing order. Unset
+  // bits are skipped a word at a time, which matters for the long untagged
+  // runs (strings, bytecode, ...) of a segment.
+  template <typename Callback>
+  void IterateSetBits(Callback callback) const {
+    const size_t size = size_in_bytes();
+    size_t byte = 0;
+    for (; byte + kInt64Size <= size; byte += kInt64Size) {
+      uint64_t word = base::ReadLittleEndianValue<uint64_t>(
+          reinterpret_cast<Address>(data_ + byte));
+      while (word != 0) {
+        callback(static_cast<int>(byte * kBitsPerByte +
+                                  base::bits::CountTrailingZeros64(word)));
+        word &= word - 1;
+      }
+    }
+    for (; byte < size; byte++) {
+      uint32_t bits = data_[byte];
+      while (bits != 0) {
+        callback(static_cast<int>(byte * kBitsPerByte +
+                                  base::bits::CountTrailingZeros32(bits)));
+        bits &= bits - 1;
+      }
+    }
+  }
+
   size_t size_in_bits() const { return size_in_bits_; }
   size_t size_in_bytes() const {
     return RoundUp<kBitsPerByte>(size_in_bits_) / kBitsPerByte;
@@ -4,6 +4,8 @@
 
 #include "src/snapshot/read-only-serializer.h"
 
+#include <algorithm>
+
 #include "src/heap/heap-inl.h"
 #include "src/heap/read-only-heap.h"
 #include "src/objects/objects-inl.h"
@@ -242,7 +244,7 @@ class ReadOnlyHeapImageSerializer {
         size_t segment_size = r->start - pos;
         ReadOnlySegmentForSerialization segment(isolate_, page, pos,
                                                 segment_size);
-        WriteSegment(&segment);
+        WriteSegmentSkippingZeroBlocks(&segment);
         pos += segment_size + r->size;
       }
     }
@@ -251,20 +253,48 @@ class ReadOnlyHeapImageSerializer {
     // uninitialized and we do not want to include it in the snapshot.
     size_t segment_size = page->HighWaterMark() - pos;
     ReadOnlySegmentForSerialization segment(isolate_, page, pos, segment_size);
-    WriteSegment(&segment);
+    WriteSegmentSkippingZeroBlocks(&segment);
 
     sink_->Put(Bytecode::kFinalizePage, "page end");
   }
 
-  void WriteSegment(const ReadOnlySegmentForSerialization* segment) {
+  // Splits the segment around aligned blocks of ro::kZeroBlockSize zeros.
+  // Without static roots, zero bytes may encode tagged slots that have to be
+  // relocated, so segments are written as a whole.
+  void WriteSegmentSkippingZeroBlocks(
+      const ReadOnlySegmentForSerialization* segment) {
+    const size_t size = segment->segment_size;
+    if (!V8_STATIC_ROOTS_BOOL) return WriteSegment(segment, 0, size);
+
+    const uint8_t* contents = segment->contents.get();
+    size_t start = 0;
+    for (size_t offset = RoundUp(segment->segment_start, ro::kZeroBlockSize) -
+                         segment->segment_start;
+         offset + ro::kZeroBlockSize <= size; offset += ro::kZeroBlockSize) {
+      if (!std::all_of(contents + offset,
+                       contents + offset + ro::kZeroBlockSize,
+                       [](uint8_t byte) { return byte == 0; })) {
+        continue;
+      }
+      if (offset > start) WriteSegment(segment, start, offset - start);
+      start = offset + ro::kZeroBlockSize;
+    }
+    if (start < size) WriteSegment(segment, start, size - start);
+  }
+
+  // Writes the bytes [offset, offset + size) of the segment.
+  void WriteSegment(const ReadOnlySegmentForSerialization* segment,
+                    size_t offset, size_t size) {
+    DCHECK_LE(offset + size, segment->segment_size);
     sink_->Put(Bytecode::kSegment, "segment begin");
-    sink_->PutUint30(static_cast<uint32_t>(segment->segment_offset),
+    sink_->PutUint30(static_cast<uint32_t>(segment->segment_offset + offset),
                      "segment start offset");
-    sink_->PutUint30(static_cast<uint32_t>(segment->segment_size),
-                     "segment byte size");
-    sink_->PutRaw(segment->contents.get(),
-                  static_cast<int>(segment->segment_size), "page");
+    sink_->PutUint30(static_cast<uint32_t>(size), "segment byte size");
+    sink_->PutRaw(segment->contents.get() + offset, static_cast<int>(size),
+                  "page");
     if (!V8_STATIC_ROOTS_BOOL) {
+      DCHECK_EQ(offset, 0);
+      DCHECK_EQ(size, segment->segment_size);
       sink_->Put(Bytecode::kRelocateSegment, "relocate segment");
       sink_->PutRaw(segment->tagged_slots.data(),
                     static_cast<int>(segment->tagged_slots.size_in_bytes()),
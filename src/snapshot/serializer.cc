@@ -16,6 +16,7 @@
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/map.h"
 #include "src/objects/objects-body-descriptors-inl.h"
+#include "src/objects/script.h"
 #include "src/objects/slots-inl.h"
 #include "src/objects/smi.h"
 #include "src/snapshot/embedded/embedded-data.h"
@@ -1191,9 +1192,34 @@ void Serializer::ObjectSerializer::OutputRawData(Address up_to) {
           SeqString::cast(*object_)->GetDataAndPaddingSizes();
       DCHECK_EQ(bytes_to_output, sizes.data_size - base + sizes.padding_size);
       int data_bytes_to_output = sizes.data_size - base;
-      sink_->PutRaw(reinterpret_cast<uint8_t*>(object_start + base),
-                    data_bytes_to_output, "SeqStringData");
+      if (serializer_->RecomputesStringHashes()) {
+        static const uint32_t field_value = String::kEmptyHashField;
+        OutputRawWithCustomField(
+            sink_, object_start, base, data_bytes_to_output,
+            String::kRawHashFieldOffset, sizeof(field_value),
+            reinterpret_cast<const uint8_t*>(&field_value));
+      } else {
+        sink_->PutRaw(reinterpret_cast<uint8_t*>(object_start + base),
+                      data_bytes_to_output, "SeqStringData");
+      }
       sink_->PutN(sizes.padding_size, 0, "SeqStringPadding");
+    } else if (object_->IsString(cage_base) &&
+               serializer_->RecomputesStringHashes()) {
+      // The hash depends on the hash seed of the isolate, which is usually
+      // random. Leave it out if the deserializer computes it anyway.
+      static const uint32_t field_value = String::kEmptyHashField;
+      OutputRawWithCustomField(sink_, object_start, base, bytes_to_output,
+                               String::kRawHashFieldOffset,
+                               sizeof(field_value),
+                               reinterpret_cast<const uint8_t*>(&field_value));
+    } else if (object_->IsScript(cage_base) &&
+               serializer_->RecomputesScriptIds()) {
+      // The id depends on the number of scripts the isolate has seen before.
+      static uint8_t field_value[kTaggedSize] = {0};
+      static_assert(Smi::zero().ptr() == 0);
+      OutputRawWithCustomField(sink_, object_start, base, bytes_to_output,
+                               Script::kIdOffset, sizeof(field_value),
+                               field_value);
     } else {
       sink_->PutRaw(reinterpret_cast<uint8_t*>(object_start + base),
                     bytes_to_output, "Bytes");
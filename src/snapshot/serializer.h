@@ -236,6 +236,11 @@ class Serializer : public SerializerDeserializer {
 
   virtual bool MustBeDeferred(HeapObject object);
 
+  // Whether the deserializer overwrites these fields, so that the serializer
+  // can write placeholders instead of values that differ between isolates.
+  virtual bool RecomputesStringHashes() const { return false; }
+  virtual bool RecomputesScriptIds() const { return false; }
+
   void VisitRootPointers(Root root, const char* description,
                          FullObjectSlot start, FullObjectSlot end) override;
   void SerializeRootObject(FullObjectSlot slot);
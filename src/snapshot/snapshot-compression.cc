@@ -4,7 +4,12 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 #include "src/base/platform/elapsed-timer.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,12 +17,92 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+namespace {
+
+// Compressed snapshots are laid out as
+//   uncompressed size         - uint32_t
+//   number of chunks          - uint32_t
+//   compressed chunk sizes    - uint32_t each
+//   compressed chunks
+// Each chunk but the last holds kChunkSize uncompressed bytes. Chunks are
+// compressed independently, so that they can be decompressed in parallel.
+
+uint32_t ReadUint32(const Bytef* data) {
+  uint32_t value;
+  MemCopy(&value, data, sizeof(value));
+  return value;
 }
 
+void WriteUint32(Bytef* data, uint32_t value) {
+  MemCopy(data, &value, sizeof(value));
+}
+
+struct ChunkedData {
+  explicit ChunkedData(base::Vector<const uint8_t> compressed_data)
+      : data(base::bit_cast<const Bytef*>(compressed_data.begin())),
+        uncompressed_size(ReadUint32(data)),
+        chunk_count(ReadUint32(data + kUInt32Size)) {
+    CHECK_EQ(chunk_count,
+             (uncompressed_size + SnapshotCompression::kChunkSize - 1) /
+                 SnapshotCompression::kChunkSize);
+    size_t offset = (2 + chunk_count) * kUInt32Size;
+    CHECK_LE(offset, compressed_data.size());
+    chunk_offsets.reserve(chunk_count + 1);
+    for (uint32_t i = 0; i < chunk_count; i++) {
+      chunk_offsets.push_back(offset);
+      offset += ReadUint32(data + (2 + i) * kUInt32Size);
+    }
+    chunk_offsets.push_back(offset);
+    CHECK_EQ(offset, compressed_data.size());
+  }
+
+  void DecompressChunk(uint32_t i, uint8_t* out) const {
+    DCHECK_LT(i, chunk_count);
+    uint32_t begin = i * SnapshotCompression::kChunkSize;
+    uLongf size =
+        std::min(uncompressed_size - begin, SnapshotCompression::kChunkSize);
+    uLongf expected_size = size;
+    CHECK_EQ(zlib_internal::UncompressHelper(
+                 zlib_internal::ZRAW, base::bit_cast<Bytef*>(out + begin),
+                 &size, data + chunk_offsets[i],
+                 static_cast<uLong>(chunk_offsets[i + 1] - chunk_offsets[i])),
+             Z_OK);
+    CHECK_EQ(size, expected_size);
+  }
+
+  const Bytef* const data;
+  const uint32_t uncompressed_size;
+  const uint32_t chunk_count;
+  std::vector<size_t> chunk_offsets;
+};
+
+class DecompressChunksJob final : public JobTask {
+ public:
+  DecompressChunksJob(const ChunkedData* chunked_data, uint8_t* out)
+      : chunked_data_(chunked_data), out_(out) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      uint32_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= chunked_data_->chunk_count) return;
+      chunked_data_->DecompressChunk(chunk, out_);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    uint32_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    if (next_chunk >= chunked_data_->chunk_count) return 0;
+    return worker_count + chunked_data_->chunk_count - next_chunk;
+  }
+
+ private:
+  const ChunkedData* const chunked_data_;
+  uint8_t* const out_;
+  std::atomic<uint32_t> next_chunk_{0};
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -25,40 +110,51 @@ SnapshotData SnapshotCompression::Compress(
   if (v8_flags.profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
-      static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  const base::Vector<const uint8_t> input = uncompressed_data->RawData();
+  const uint32_t payload_length = static_cast<uint32_t>(input.size());
+  const uint32_t chunk_count = (payload_length + kChunkSize - 1) / kChunkSize;
+  const uint32_t header_size = (2 + chunk_count) * kUInt32Size;
 
   // Allocating >= the final amount we will need.
-  snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+  uLongf max_compressed_size = header_size;
+  for (uint32_t begin = 0; begin < payload_length; begin += kChunkSize) {
+    max_compressed_size += compressBound(
+        static_cast<uLong>(std::min(payload_length - begin, kChunkSize)));
+  }
+  snapshot_data.AllocateData(static_cast<uint32_t>(max_compressed_size));
 
-  uint8_t* compressed_data =
-      const_cast<uint8_t*>(snapshot_data.RawData().begin());
+  Bytef* compressed_data =
+      const_cast<Bytef*>(snapshot_data.RawData().begin());
   // Since we are doing raw compression (no zlib or gzip headers), we need to
   // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          base::bit_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
+  WriteUint32(compressed_data, payload_length);
+  WriteUint32(compressed_data + kUInt32Size, chunk_count);
+
+  uLongf compressed_size = header_size;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    const uint32_t begin = i * kChunkSize;
+    const uLong chunk_size =
+        static_cast<uLong>(std::min(payload_length - begin, kChunkSize));
+    uLongf compressed_chunk_size = max_compressed_size - compressed_size;
+    CHECK_EQ(zlib_internal::CompressHelper(
+                 zlib_internal::ZRAW, compressed_data + compressed_size,
+                 &compressed_chunk_size,
+                 base::bit_cast<const Bytef*>(input.begin() + begin),
+                 chunk_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+             Z_OK);
+    WriteUint32(compressed_data + (2 + i) * kUInt32Size,
+                static_cast<uint32_t>(compressed_chunk_size));
+    compressed_size += compressed_chunk_size;
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
-  DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+  snapshot_data.Resize(static_cast<uint32_t>(compressed_size));
+  DCHECK_EQ(payload_length, ReadUint32(snapshot_data.RawData().begin()));
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Compressing %d bytes took %0.3f ms]\n", payload_length, ms);
+    PrintF("[Compressing %d bytes in %d chunks took %0.3f ms]\n",
+           payload_length, chunk_count, ms);
   }
   return snapshot_data;
 }
@@ -69,29 +165,25 @@ SnapshotData SnapshotCompression::Decompress(
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef =
-      base::bit_cast<const Bytef*>(compressed_data.begin());
-
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
-
-  snapshot_data.AllocateData(uncompressed_payload_length);
-
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               base::bit_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  const ChunkedData chunked_data(compressed_data);
+  snapshot_data.AllocateData(chunked_data.uncompressed_size);
+  uint8_t* out = const_cast<uint8_t*>(snapshot_data.RawData().begin());
+
+  if (chunked_data.chunk_count < 2 || v8_flags.single_threaded) {
+    for (uint32_t i = 0; i < chunked_data.chunk_count; i++) {
+      chunked_data.DecompressChunk(i, out);
+    }
+  } else {
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<DecompressChunksJob>(&chunked_data, out))
+        ->Join();
+  }
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+    PrintF("[Decompressing %d bytes in %d chunks took %0.3f ms]\n",
+           chunked_data.uncompressed_size, chunked_data.chunk_count, ms);
   }
   return snapshot_data;
 }
@@ -13,6 +13,10 @@ namespace internal {
 
 class SnapshotCompression : public AllStatic {
  public:
+  // Snapshots are compressed in independent chunks of this many bytes, which
+  // Decompress spreads over worker threads.
+  static constexpr uint32_t kChunkSize = 256 * KB;
+
   V8_EXPORT_PRIVATE static SnapshotData Compress(
       const SnapshotData* uncompressed_data);
   V8_EXPORT_PRIVATE static SnapshotData Decompress(
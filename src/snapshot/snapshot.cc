@@ -265,6 +265,10 @@ void Snapshot::ClearReconstructableDataForSerialization(
     }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+    // The shared constant pool cache is rebuilt as functions are recompiled.
+    isolate->heap()->set_shared_constant_pool_cache(
+        i::ReadOnlyRoots(isolate).undefined_value());
+
     // Must happen after heap iteration since SFI::DiscardCompiled may allocate.
     for (i::Handle<i::SharedFunctionInfo> shared : sfis_to_clear) {
       if (shared->CanDiscardCompiled()) {
@@ -159,6 +159,57 @@ bool AddBuiltinIfNotProcessed(Builtin builtin, std::vector<Builtin>& order,
   return false;
 }
 
+void BuiltinsSorter::AddCallProbability(Builtin caller_id, Builtin callee_id,
+                                        int32_t normalized_count) {
+  int32_t outgoing_prob = 0;
+  int32_t incoming_prob = 0;
+  int caller_density = 0;
+  int callee_density = 0;
+  if (builtin_density_map_.count(caller_id)) {
+    caller_density = builtin_density_map_.at(caller_id);
+  }
+
+  if (caller_density != 0) {
+    outgoing_prob = normalized_count * 100 / caller_density;
+  } else {
+    // If the caller density was normalized as 0 but the block density
+    // was not, we set caller prob as 100, otherwise it's 0. Because in
+    // the normalization, we may loss fidelity.
+    // For example, a caller was executed 8 times, but after
+    // normalization, it may be 0 time. At that time, if the
+    // normalized_count of this block (it may be a loop body) is a
+    // positive number, we could think normalized_count is bigger than the
+    // execution count of caller, hence we set it as 100, otherwise it's
+    // smaller than execution count of caller, we could set it as 0.
+    outgoing_prob = normalized_count ? 100 : 0;
+  }
+
+  if (builtin_density_map_.count(callee_id)) {
+    callee_density = builtin_density_map_.at(callee_id);
+    if (callee_density != 0) {
+      incoming_prob = normalized_count * 100 / callee_density;
+    } else {
+      // Same as caller prob when callee density exists but is 0.
+      incoming_prob = normalized_count ? 100 : 0;
+    }
+
+  } else {
+    // If callee_density does not exist, it means the callee was not
+    // compiled by TurboFan or execution count is too small (0 after
+    // normalization), we couldn't get the callee count, so we set it as
+    // -1. In that case we could avoid merging this callee builtin into
+    // any other cluster.
+    incoming_prob = -1;
+  }
+
+  CallProbability probs = CallProbability(incoming_prob, outgoing_prob);
+  if (call_graph_.count(caller_id) == 0) {
+    call_graph_.emplace(caller_id, CallProbabilities());
+  }
+  CallProbabilities& call_probs = call_graph_.at(caller_id);
+  call_probs.emplace(callee_id, probs);
+}
+
 void BuiltinsSorter::ProcessBlockCountLineInfo(
     std::istringstream& line_stream,
     std::unordered_map<std::string, Builtin>& name2id) {
@@ -187,13 +238,7 @@ void BuiltinsSorter::ProcessBlockCountLineInfo(
 
   const BuiltinCallees* block_callees = profiler->GetBuiltinCallees(caller_id);
   if (block_callees) {
-    int32_t outgoing_prob = 0;
-    int32_t incoming_prob = 0;
-    int caller_density = 0;
-    int callee_density = 0;
-
     CHECK(builtin_density_map_.count(caller_id));
-    caller_density = builtin_density_map_.at(caller_id);
 
     // TODO(v8:13938): Remove the below if check when we just store
     // interesting blocks (contain call other builtins) execution count into
@@ -202,51 +247,38 @@ void BuiltinsSorter::ProcessBlockCountLineInfo(
       // If the line of block density make sense (means it contain call to
       // other builtins in this block).
       for (const auto& callee_id : block_callees->at(block_id)) {
-        if (caller_density != 0) {
-          outgoing_prob = normalized_count * 100 / caller_density;
-        } else {
-          // If the caller density was normalized as 0 but the block density
-          // was not, we set caller prob as 100, otherwise it's 0. Because in
-          // the normalization, we may loss fidelity.
-          // For example, a caller was executed 8 times, but after
-          // normalization, it may be 0 time. At that time, if the
-          // normalized_count of this block (it may be a loop body) is a
-          // positive number, we could think normalized_count is bigger than the
-          // execution count of caller, hence we set it as 100, otherwise it's
-          // smaller than execution count of caller, we could set it as 0.
-          outgoing_prob = normalized_count ? 100 : 0;
-        }
-
-        if (builtin_density_map_.count(callee_id)) {
-          callee_density = builtin_density_map_.at(callee_id);
-          if (callee_density != 0) {
-            incoming_prob = normalized_count * 100 / callee_density;
-          } else {
-            // Same as caller prob when callee density exists but is 0.
-            incoming_prob = normalized_count ? 100 : 0;
-          }
-
-        } else {
-          // If callee_density does not exist, it means the callee was not
-          // compiled by TurboFan or execution count is too small (0 after
-          // normalization), we couldn't get the callee count, so we set it as
-          // -1. In that case we could avoid merging this callee builtin into
-          // any other cluster.
-          incoming_prob = -1;
-        }
-
-        CallProbability probs = CallProbability(incoming_prob, outgoing_prob);
-        if (call_graph_.count(caller_id) == 0) {
-          call_graph_.emplace(caller_id, CallProbabilities());
-        }
-        CallProbabilities& call_probs = call_graph_.at(caller_id);
-        call_probs.emplace(callee_id, probs);
+        AddCallProbability(caller_id, callee_id, normalized_count);
       }
     }
   }
   CHECK(line_stream.eof());
 }
 
+void BuiltinsSorter::ProcessCallCountLineInfo(
+    std::istringstream& line_stream,
+    std::unordered_map<std::string, Builtin>& name2id) {
+  // Any line starting with kBuiltinCallDensityMarker is a normalized count of
+  // calls from one builtin to another, as sampled at runtime by
+  // BuiltinsSampler. Unlike block counts, it doesn't need the call graph of
+  // the builtins. The format is:
+  //   literal kBuiltinCallDensityMarker , caller , callee , normalized_count
+  std::string token;
+  std::string caller_name;
+  std::string callee_name;
+  CHECK(std::getline(line_stream, caller_name, ','));
+  CHECK(std::getline(line_stream, callee_name, ','));
+  CHECK(std::getline(line_stream, token, ','));
+  CHECK(line_stream.eof());
+  char* end = nullptr;
+  errno = 0;
+  int32_t normalized_count =
+      static_cast<int32_t>(strtoul(token.c_str(), &end, 0));
+  CHECK(errno == 0 && end != token.c_str());
+
+  AddCallProbability(name2id[caller_name], name2id[callee_name],
+                     normalized_count);
+}
+
 void BuiltinsSorter::ProcessBuiltinDensityLineInfo(
     std::istringstream& line_stream,
     std::unordered_map<std::string, Builtin>& name2id) {
@@ -283,11 +315,13 @@ void BuiltinsSorter::InitializeCallGraph(const char* profiling_file,
     std::string token;
     std::istringstream line_stream(line);
     // We must put lines start with kBuiltinDensityMarker before lines start
-    // with kBuiltinCallBlockDensityMarker, because we have to density to
-    // calculate call prob.
+    // with kBuiltinCallBlockDensityMarker or kBuiltinCallDensityMarker,
+    // because we have to density to calculate call prob.
     if (!std::getline(line_stream, token, ',')) continue;
     if (token == kBuiltinCallBlockDensityMarker) {
       ProcessBlockCountLineInfo(line_stream, name2id);
+    } else if (token == kBuiltinCallDensityMarker) {
+      ProcessCallCountLineInfo(line_stream, name2id);
     } else if (token == kBuiltinDensityMarker) {
       ProcessBuiltinDensityLineInfo(line_stream, name2id);
     }
@@ -77,6 +77,7 @@ class BuiltinsSorter {
 
   const std::string kBuiltinCallBlockDensityMarker = "block_count";
   const std::string kBuiltinDensityMarker = "builtin_count";
+  const std::string kBuiltinCallDensityMarker = "call_count";
 
   // Pair of denstity of builtin and builtin id.
   struct BuiltinDensitySlot {
@@ -106,6 +107,11 @@ class BuiltinsSorter {
   void ProcessBuiltinDensityLineInfo(
       std::istringstream& line_stream,
       std::unordered_map<std::string, Builtin>& name2id);
+  void ProcessCallCountLineInfo(
+      std::istringstream& line_stream,
+      std::unordered_map<std::string, Builtin>& name2id);
+  void AddCallProbability(Builtin caller_id, Builtin callee_id,
+                          int32_t normalized_count);
 
   std::vector<Cluster*> clusters_;
 
@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/bits.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -114,6 +115,28 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
   // Non-index hash.
   uint32_t running_hash = static_cast<uint32_t>(seed);
   const uchar* end = &chars[length];
+  if (length >= kMinLaneHashLength) {
+    // Each lane hashes every kHashLanes-th character. The lanes don't depend
+    // on each other, so they are computed in parallel (and vectorized by the
+    // compiler), and are mixed into the running hash at the end. As for the
+    // character-wise hash, the result only depends on the code units and not
+    // on the encoding.
+    static_assert(base::bits::IsPowerOfTwo(kHashLanes));
+    uint32_t lanes[kHashLanes];
+    for (int j = 0; j < kHashLanes; j++) lanes[j] = running_hash + j;
+    const uchar* blocks_end = &chars[length & ~(kHashLanes - 1)];
+    for (; chars != blocks_end; chars += kHashLanes) {
+      for (int j = 0; j < kHashLanes; j++) {
+        lanes[j] = AddCharacterCore(lanes[j], chars[j]);
+      }
+    }
+    for (int j = 0; j < kHashLanes; j++) {
+      running_hash =
+          AddCharacterCore(running_hash, static_cast<uint16_t>(lanes[j]));
+      running_hash = AddCharacterCore(running_hash,
+                                      static_cast<uint16_t>(lanes[j] >> 16));
+    }
+  }
   while (chars != end) {
     running_hash = AddCharacterCore(running_hash, *chars++);
   }
@@ -35,6 +35,11 @@ class V8_EXPORT_PRIVATE StringHasher final {
   // use 27 instead.
   static const int kZeroHash = 27;
 
+  // Strings of at least this length are hashed in kHashLanes interleaved
+  // lanes, see HashSequentialString.
+  static const int kMinLaneHashLength = 64;
+  static const int kHashLanes = 8;
+
   // Reusable parts of the hashing algorithm.
   V8_INLINE static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c);
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
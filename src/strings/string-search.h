@@ -9,6 +9,7 @@
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
 #include "src/objects/string.h"
+#include "src/strings/string-simd.h"
 
 namespace v8 {
 namespace internal {
@@ -42,6 +43,11 @@ class StringSearchBase {
   // to compensate for the algorithmic overhead compared to simple brute force.
   static const int kBMMinPatternLength = 7;
 
+  // Longest pattern searched for with vector compares of its first and last
+  // character. Beyond this, the shifts of Boyer-Moore(-Horspool) win, and the
+  // quadratic worst case of verifying every candidate gets too expensive.
+  static const int kSimdMaxPatternLength = 32;
+
   static inline bool IsOneByteString(base::Vector<const uint8_t> string) {
     return true;
   }
@@ -67,11 +73,16 @@ class StringSearch : private StringSearchBase {
       }
     }
     int pattern_length = pattern_.length();
+    if (pattern_length == 1) {
+      strategy_ = &SingleCharSearch;
+      return;
+    }
+    if (SimdCharBlock<SubjectChar>::kIsVectorized &&
+        pattern_length <= kSimdMaxPatternLength) {
+      strategy_ = &SimdSearch;
+      return;
+    }
     if (pattern_length < kBMMinPatternLength) {
-      if (pattern_length == 1) {
-        strategy_ = &SingleCharSearch;
-        return;
-      }
       strategy_ = &LinearSearch;
       return;
     }
@@ -110,6 +121,10 @@ class StringSearch : private StringSearchBase {
                           base::Vector<const SubjectChar> subject,
                           int start_index);
 
+  static int SimdSearch(StringSearch<PatternChar, SubjectChar>* search,
+                        base::Vector<const SubjectChar> subject,
+                        int start_index);
+
   static int InitialSearch(StringSearch<PatternChar, SubjectChar>* search,
                            base::Vector<const SubjectChar> subject,
                            int start_index);
@@ -289,6 +304,53 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   return -1;
 }
 
+//---------------------------------------------------------------------
+// Vectorized Search Strategy
+//---------------------------------------------------------------------
+
+// Compares a block of subject characters with the first pattern character and
+// the block pattern_length - 1 characters further with the last one, and only
+// verifies the positions where both match.  Never bails out.
+template <typename PatternChar, typename SubjectChar>
+int StringSearch<PatternChar, SubjectChar>::SimdSearch(
+    StringSearch<PatternChar, SubjectChar>* search,
+    base::Vector<const SubjectChar> subject, int index) {
+  using Block = SimdCharBlock<SubjectChar>;
+  base::Vector<const PatternChar> pattern = search->pattern_;
+  int pattern_length = pattern.length();
+  DCHECK_GT(pattern_length, 1);
+  // If the pattern is wider than the subject, it is one-byte (otherwise this
+  // would be a FailSearch), so these casts are lossless.
+  const SubjectChar first = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last =
+      static_cast<SubjectChar>(pattern[pattern_length - 1]);
+  auto matches_inner = [&](int i) {
+    return pattern_length == 2 ||
+           CharCompare(pattern.begin() + 1, subject.begin() + i + 1,
+                       pattern_length - 2);
+  };
+
+  int i = index;
+  int n = subject.length() - pattern_length;
+  for (; i <= n - Block::kLanes + 1; i += Block::kLanes) {
+    uint32_t mask =
+        Block::Load(subject.begin() + i).EqualMask(first) &
+        Block::Load(subject.begin() + i + pattern_length - 1).EqualMask(last);
+    while (mask != 0) {
+      int candidate = i + Block::FirstLane(mask);
+      if (matches_inner(candidate)) return candidate;
+      mask &= mask - 1;
+    }
+  }
+  for (; i <= n; i++) {
+    if (subject[i] == first && subject[i + pattern_length - 1] == last &&
+        matches_inner(i)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
 //---------------------------------------------------------------------
 // Boyer-Moore string search
 //---------------------------------------------------------------------
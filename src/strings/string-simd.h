@@ -0,0 +1,240 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_STRING_SIMD_H_
+#define V8_STRINGS_STRING_SIMD_H_
+
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/macros.h"
+
+#if (defined(__SSE2__) || \
+     (defined(_MSC_VER) && \
+      (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2))))
+#define V8_STRING_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+// Neon is only used on 64-bit ARM, where it is guaranteed to be present and
+// where the across-vector reductions (vaddv) are available.
+#define V8_STRING_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+// A block of 16 bytes worth of one-byte (uint8_t) or two-byte (uint16_t)
+// characters, used to classify many characters of a flat string at once.
+//
+// All predicates return a lane mask where bit i is set iff the predicate holds
+// for the i-th character of the block (in memory order). Without SSE2 or Neon
+// a scalar implementation with identical semantics is used; callers that only
+// want to take a vector path when it pays off can check kIsVectorized.
+template <typename Char>
+class SimdCharBlock final {
+  static_assert(std::is_same<Char, uint8_t>::value ||
+                std::is_same<Char, uint16_t>::value);
+
+ public:
+  static constexpr int kLanes = 16 / sizeof(Char);
+  static constexpr uint32_t kAllLanes = (uint32_t{1} << kLanes) - 1;
+#if defined(V8_STRING_SIMD_SSE2) || defined(V8_STRING_SIMD_NEON)
+  static constexpr bool kIsVectorized = true;
+#else
+  static constexpr bool kIsVectorized = false;
+#endif
+
+  // Loads kLanes characters starting at |chars|, which need not be aligned.
+  static V8_INLINE SimdCharBlock Load(const Char* chars) {
+    return SimdCharBlock(chars);
+  }
+
+  // Lanes equal to |c|.
+  V8_INLINE uint32_t EqualMask(Char c) const;
+  // Lanes whose (unsigned) value is <= |c|.
+  V8_INLINE uint32_t LessOrEqualMask(Char c) const;
+  // Lanes whose value is in the inclusive range [|from|, |to|].
+  V8_INLINE uint32_t InRangeMask(Char from, Char to) const;
+
+  // Lanes whose (unsigned) value is < |c|.
+  V8_INLINE uint32_t LessThanMask(Char c) const {
+    return c == 0 ? 0 : LessOrEqualMask(c - 1);
+  }
+  // Lanes whose (unsigned) value is > |c|.
+  V8_INLINE uint32_t GreaterThanMask(Char c) const {
+    return ~LessOrEqualMask(c) & kAllLanes;
+  }
+
+  // Index of the first lane set in the non-empty |mask|.
+  static V8_INLINE int FirstLane(uint32_t mask) {
+    DCHECK_NE(mask, 0);
+    return base::bits::CountTrailingZeros32(mask);
+  }
+
+  // Mask of all lanes before |lane|.
+  static V8_INLINE uint32_t LanesBefore(int lane) {
+    DCHECK_LE(lane, kLanes);
+    return (uint32_t{1} << lane) - 1;
+  }
+
+ private:
+#if defined(V8_STRING_SIMD_SSE2)
+  explicit SimdCharBlock(const Char* chars)
+      : value_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(chars))) {}
+
+  static V8_INLINE __m128i Splat(Char c) {
+    return sizeof(Char) == 1 ? _mm_set1_epi8(static_cast<char>(c))
+                             : _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+
+  static V8_INLINE uint32_t ToLaneMask(__m128i lanes) {
+    if (sizeof(Char) == 2) {
+      // Narrow the 16-bit all-ones/all-zeros lanes to bytes.
+      lanes = _mm_packs_epi16(lanes, _mm_setzero_si128());
+    }
+    return static_cast<uint32_t>(_mm_movemask_epi8(lanes)) & kAllLanes;
+  }
+
+  static V8_INLINE uint32_t LessOrEqual(__m128i value, Char c) {
+    // There is no unsigned compare in SSE2, but the saturating difference
+    // value - c is zero exactly if value <= c.
+    __m128i diff = sizeof(Char) == 1 ? _mm_subs_epu8(value, Splat(c))
+                                     : _mm_subs_epu16(value, Splat(c));
+    __m128i zero = _mm_setzero_si128();
+    return ToLaneMask(sizeof(Char) == 1 ? _mm_cmpeq_epi8(diff, zero)
+                                        : _mm_cmpeq_epi16(diff, zero));
+  }
+
+  __m128i value_;
+#elif defined(V8_STRING_SIMD_NEON)
+  using VectorType =
+      typename std::conditional<sizeof(Char) == 1, uint8x16_t,
+                                uint16x8_t>::type;
+
+  explicit SimdCharBlock(const Char* chars) : value_(LoadVector(chars)) {}
+
+  static V8_INLINE uint8x16_t LoadVector(const uint8_t* chars) {
+    return vld1q_u8(chars);
+  }
+  static V8_INLINE uint16x8_t LoadVector(const uint16_t* chars) {
+    return vld1q_u16(chars);
+  }
+
+  static V8_INLINE uint32_t ToLaneMask(uint8x16_t lanes) {
+    // Neon has no movemask; weight each lane by its bit and add up the halves.
+    static constexpr uint8_t kBits[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                          1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t bits = vandq_u8(lanes, vld1q_u8(kBits));
+    return vaddv_u8(vget_low_u8(bits)) |
+           (static_cast<uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8);
+  }
+  static V8_INLINE uint32_t ToLaneMask(uint16x8_t lanes) {
+    static constexpr uint16_t kBits[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+    return vaddvq_u16(vandq_u16(lanes, vld1q_u16(kBits)));
+  }
+
+  static V8_INLINE uint32_t LessOrEqual(uint8x16_t value, uint8_t c) {
+    return ToLaneMask(vcleq_u8(value, vdupq_n_u8(c)));
+  }
+  static V8_INLINE uint32_t LessOrEqual(uint16x8_t value, uint16_t c) {
+    return ToLaneMask(vcleq_u16(value, vdupq_n_u16(c)));
+  }
+
+  VectorType value_;
+#else
+  explicit SimdCharBlock(const Char* chars) {
+    for (int i = 0; i < kLanes; i++) value_[i] = chars[i];
+  }
+
+  template <typename Predicate>
+  V8_INLINE uint32_t Mask(Predicate predicate) const {
+    uint32_t mask = 0;
+    for (int i = 0; i < kLanes; i++) {
+      if (predicate(value_[i])) mask |= uint32_t{1} << i;
+    }
+    return mask;
+  }
+
+  Char value_[kLanes];
+#endif
+};
+
+#if defined(V8_STRING_SIMD_SSE2)
+
+template <typename Char>
+uint32_t SimdCharBlock<Char>::EqualMask(Char c) const {
+  return ToLaneMask(sizeof(Char) == 1 ? _mm_cmpeq_epi8(value_, Splat(c))
+                                      : _mm_cmpeq_epi16(value_, Splat(c)));
+}
+
+template <typename Char>
+uint32_t SimdCharBlock<Char>::LessOrEqualMask(Char c) const {
+  return LessOrEqual(value_, c);
+}
+
+template <typename Char>
+uint32_t SimdCharBlock<Char>::InRangeMask(Char from, Char to) const {
+  DCHECK_LE(from, to);
+  // Wrapping subtraction maps [from, to] onto [0, to - from].
+  __m128i rebased = sizeof(Char) == 1 ? _mm_sub_epi8(value_, Splat(from))
+                                      : _mm_sub_epi16(value_, Splat(from));
+  return LessOrEqual(rebased, static_cast<Char>(to - from));
+}
+
+#elif defined(V8_STRING_SIMD_NEON)
+
+template <typename Char>
+uint32_t SimdCharBlock<Char>::EqualMask(Char c) const {
+  if constexpr (sizeof(Char) == 1) {
+    return ToLaneMask(vceqq_u8(value_, vdupq_n_u8(c)));
+  } else {
+    return ToLaneMask(vceqq_u16(value_, vdupq_n_u16(c)));
+  }
+}
+
+template <typename Char>
+uint32_t SimdCharBlock<Char>::LessOrEqualMask(Char c) const {
+  return LessOrEqual(value_, c);
+}
+
+template <typename Char>
+uint32_t SimdCharBlock<Char>::InRangeMask(Char from, Char to) const {
+  DCHECK_LE(from, to);
+  if constexpr (sizeof(Char) == 1) {
+    return LessOrEqual(vsubq_u8(value_, vdupq_n_u8(from)),
+                       static_cast<uint8_t>(to - from));
+  } else {
+    return LessOrEqual(vsubq_u16(value_, vdupq_n_u16(from)),
+                       static_cast<uint16_t>(to - from));
+  }
+}
+
+#else
+
+template <typename Char>
+uint32_t SimdCharBlock<Char>::EqualMask(Char c) const {
+  return Mask([c](Char value) { return value == c; });
+}
+
+template <typename Char>
+uint32_t SimdCharBlock<Char>::LessOrEqualMask(Char c) const {
+  return Mask([c](Char value) { return value <= c; });
+}
+
+template <typename Char>
+uint32_t SimdCharBlock<Char>::InRangeMask(Char from, Char to) const {
+  DCHECK_LE(from, to);
+  return Mask([from, to](Char value) { return from <= value && value <= to; });
+}
+
+#endif
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_STRING_SIMD_H_
@@ -4,6 +4,8 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include <algorithm>
+
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
 
@@ -15,6 +17,16 @@ namespace v8 {
 namespace internal {
 
 namespace {
+// Returns the length of the run of ASCII characters that starts at {cursor},
+// which has to be an ASCII character.
+int AsciiRunLength(const uint8_t* cursor, const uint8_t* end) {
+  DCHECK_LE(*cursor, unibrow::Utf8::kMaxOneByteChar);
+  int length = static_cast<int>(end - cursor);
+  // NonAsciiStart may stop at the start of a word that contains a non-ASCII
+  // character.
+  return std::max(1, std::min(length, NonAsciiStart(cursor, length)));
+}
+
 template <class Decoder>
 struct DecoderTraits;
 
@@ -76,9 +88,11 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
       DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
-      previous = *cursor;
-      utf16_length_++;
-      cursor++;
+      // Skip the whole run of ASCII characters.
+      int ascii_length = AsciiRunLength(cursor, end);
+      previous = cursor[ascii_length - 1];
+      utf16_length_ += ascii_length;
+      cursor += ascii_length;
       continue;
     }
 
@@ -144,8 +158,10 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
     if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      *(out++) = static_cast<Char>(*cursor);
-      cursor++;
+      int ascii_length = AsciiRunLength(cursor, end);
+      CopyChars(out, cursor, ascii_length);
+      out += ascii_length;
+      cursor += ascii_length;
       continue;
     }
 
@@ -6,6 +6,7 @@
 #define V8_STRINGS_UNICODE_DECODER_H_
 
 #include "src/base/vector.h"
+#include "src/strings/string-simd.h"
 #include "src/strings/unicode.h"
 
 namespace v8 {
@@ -19,7 +20,19 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   const uint8_t* start = chars;
   const uint8_t* limit = chars + length;
 
-  if (static_cast<size_t>(length) >= kIntptrSize) {
+  if constexpr (SimdCharBlock<uint8_t>::kIsVectorized) {
+    // Check 16 bytes at a time; loads don't need to be aligned.
+    using Block = SimdCharBlock<uint8_t>;
+    while (chars + Block::kLanes <= limit) {
+      uint32_t non_one_byte = Block::Load(chars).GreaterThanMask(
+          unibrow::Utf8::kMaxOneByteChar);
+      if (non_one_byte != 0) {
+        return static_cast<int>(chars - start) +
+               Block::FirstLane(non_one_byte);
+      }
+      chars += Block::kLanes;
+    }
+  } else if (static_cast<size_t>(length) >= kIntptrSize) {
     // Check unaligned bytes.
     while (!IsAligned(reinterpret_cast<intptr_t>(chars), kIntptrSize)) {
       if (*chars > unibrow::Utf8::kMaxOneByteChar) {
@@ -48,6 +61,31 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   return static_cast<int>(chars - start);
 }
 
+// Returns the index of the first non-ASCII character, or length if there is
+// none.
+inline int NonAsciiStart(const uint16_t* chars, int length) {
+  const uint16_t* start = chars;
+  const uint16_t* limit = chars + length;
+  if constexpr (SimdCharBlock<uint16_t>::kIsVectorized) {
+    using Block = SimdCharBlock<uint16_t>;
+    while (chars + Block::kLanes <= limit) {
+      uint32_t non_ascii = Block::Load(chars).GreaterThanMask(
+          unibrow::Utf8::kMaxOneByteChar);
+      if (non_ascii != 0) {
+        return static_cast<int>(chars - start) + Block::FirstLane(non_ascii);
+      }
+      chars += Block::kLanes;
+    }
+  }
+  while (chars < limit) {
+    if (*chars > unibrow::Utf8::kMaxOneByteChar) {
+      return static_cast<int>(chars - start);
+    }
+    ++chars;
+  }
+  return length;
+}
+
 template <class Decoder>
 class Utf8DecoderBase {
  public:
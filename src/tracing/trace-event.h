@@ -282,6 +282,12 @@ enum CategoryGroupEnabledFlags {
 #define TRACE_EVENT_CALL_STATS_SCOPED(isolate, category_group, name) \
   INTERNAL_TRACE_EVENT_CALL_STATS_SCOPED(isolate, category_group, name)
 
+// Records |value| as the new value of the counter track |name|.
+#define TRACE_EVENT_COUNTER(category_group, name, value)                 \
+  INTERNAL_TRACE_EVENT_ADD(TRACE_EVENT_PHASE_COUNTER, category_group, name, \
+                           TRACE_EVENT_FLAG_NONE, "value",                  \
+                           static_cast<int64_t>(value))
+
 #ifdef V8_RUNTIME_CALL_STATS
 #define INTERNAL_TRACE_EVENT_CALL_STATS_SCOPED(isolate, category_group, name)  \
   INTERNAL_TRACE_EVENT_GET_CATEGORY_INFO(category_group);                      \
@@ -628,6 +634,10 @@ class CallStatsScopedTracer {
 
 #else  // defined(V8_USE_PERFETTO)
 
+// Records |value| as the new value of the counter track |name|.
+#define TRACE_EVENT_COUNTER(category, name, value) \
+  TRACE_COUNTER(category, name, static_cast<int64_t>(value))
+
 #ifdef V8_RUNTIME_CALL_STATS
 
 #define TRACE_EVENT_CALL_STATS_SCOPED(isolate, category, name)             \
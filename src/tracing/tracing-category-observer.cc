@@ -5,6 +5,7 @@
 #include "src/tracing/tracing-category-observer.h"
 
 #include "src/base/atomic-utils.h"
+#include "src/flags/flags.h"
 #include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/tracing/trace-event.h"
@@ -87,8 +88,11 @@ void TracingCategoryObserver::OnStop(
 #else
 void TracingCategoryObserver::OnTraceDisabled() {
 #endif
+  // --rcs-sampling keeps sampling after the trace ends.
   i::TracingFlags::runtime_stats.fetch_and(
-      ~(ENABLED_BY_TRACING | ENABLED_BY_SAMPLING), std::memory_order_relaxed);
+      ~(i::v8_flags.rcs_sampling ? ENABLED_BY_TRACING
+                                 : ENABLED_BY_TRACING | ENABLED_BY_SAMPLING),
+      std::memory_order_relaxed);
 
   i::TracingFlags::gc.fetch_and(~ENABLED_BY_TRACING, std::memory_order_relaxed);
 
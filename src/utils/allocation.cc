@@ -12,6 +12,7 @@
 #include "src/base/logging.h"
 #include "src/base/page-allocator.h"
 #include "src/base/platform/memory.h"
+#include "src/base/platform/platform.h"
 #include "src/base/sanitizer/lsan-page-allocator.h"
 #include "src/base/sanitizer/lsan-virtual-address-space.h"
 #include "src/base/virtual-address-space.h"
@@ -375,6 +376,14 @@ bool VirtualMemoryCage::InitReservation(
       params.page_size,
       base::PageInitializationMode::kAllocatedPagesCanBeUninitialized,
       page_freeing_mode);
+
+  if (params.use_huge_pages) {
+    // The advice is sticky, so pages committed in the cage later on are
+    // backed by huge pages once a whole huge page is committed. Failure just
+    // leaves the cage backed by regular OS pages.
+    USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(allocatable_base),
+                                  allocatable_size));
+  }
   return true;
 }
 
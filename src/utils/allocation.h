@@ -387,6 +387,8 @@ class VirtualMemoryCage {
     size_t page_size;
     Address requested_start_hint;
     JitPermission jit;
+    // Whether the OS is advised to back the cage with huge pages.
+    bool use_huge_pages = false;
 
     static constexpr size_t kAnyBaseAlignment = 1;
   };
@@ -246,6 +246,12 @@ class LiftoffAssembler : public MacroAssembler {
     // TODO(13918): Consider caching the hottest / LRU memory instead of always
     // memory 0.
     Register cached_mem0_start = no_reg;
+    // The index register of the last explicit bounds check of memory 0, and
+    // the end offset it was checked against. Memories never shrink, so the
+    // check stays valid for as long as the register holds the same value, i.e.
+    // until its last use is released.
+    Register checked_mem0_index = no_reg;
+    uintptr_t checked_mem0_end_offset = 0;
 #if DEBUG
     uint32_t frozen = 0;
 #endif
@@ -400,7 +406,12 @@ class LiftoffAssembler : public MacroAssembler {
       }
       int code = reg.liftoff_code();
       DCHECK_LT(0, register_use_count[code]);
-      if (--register_use_count[code] == 0) used_registers.clear(reg);
+      if (--register_use_count[code] == 0) {
+        used_registers.clear(reg);
+        if (reg.is_gp() && reg.gp() == checked_mem0_index) {
+          ClearCheckedMem0Index();
+        }
+      }
     }
 
     bool is_used(LiftoffRegister reg) const {
@@ -429,6 +440,29 @@ class LiftoffAssembler : public MacroAssembler {
       }
       register_use_count[reg.liftoff_code()] = 0;
       used_registers.clear(reg);
+      if (reg.is_gp() && reg.gp() == checked_mem0_index) {
+        ClearCheckedMem0Index();
+      }
+    }
+
+    // Returns whether {index} was already checked for an access to memory 0
+    // ending at {end_offset} or above, and is hence known to be in bounds.
+    bool IsCheckedMem0Index(Register index, uintptr_t end_offset) const {
+      return index == checked_mem0_index &&
+             end_offset <= checked_mem0_end_offset;
+    }
+
+    // Records a bounds check of {index}. This is only useful if the register
+    // remains in use after the access.
+    void SetCheckedMem0Index(Register index, uintptr_t end_offset) {
+      DCHECK(is_used(LiftoffRegister(index)));
+      checked_mem0_index = index;
+      checked_mem0_end_offset = end_offset;
+    }
+
+    void ClearCheckedMem0Index() {
+      checked_mem0_index = no_reg;
+      checked_mem0_end_offset = 0;
     }
 
     bool is_free(LiftoffRegister reg) const { return !is_used(reg); }
@@ -437,6 +471,7 @@ class LiftoffAssembler : public MacroAssembler {
       DCHECK(!frozen);
       used_registers = {};
       memset(register_use_count, 0, sizeof(register_use_count));
+      ClearCheckedMem0Index();
     }
 
     LiftoffRegister GetNextSpillReg(LiftoffRegList candidates) {
@@ -3034,6 +3034,17 @@ class LiftoffCompiler {
       return index_ptrsize;
     }
 
+    uintptr_t end_offset = offset + access_size - 1u;
+
+    // Skip the check if the same index register was already checked for at
+    // least this end offset (e.g. for consecutive accesses via the same
+    // local).
+    if (memory->index == 0 && index.is_gp() &&
+        __ cache_state()->IsCheckedMem0Index(index_ptrsize, end_offset)) {
+      CODE_COMMENT("bounds check memory (redundant)");
+      return index_ptrsize;
+    }
+
     CODE_COMMENT("bounds check memory");
 
     // Set {pc} of the OOL code to {0} to avoid generation of protected
@@ -3052,8 +3063,6 @@ class LiftoffCompiler {
                         trapping);
     }
 
-    uintptr_t end_offset = offset + access_size - 1u;
-
     pinned.set(index_ptrsize);
     LiftoffRegister end_offset_reg =
         pinned.set(__ GetUnusedRegister(kGpReg, pinned));
@@ -3089,6 +3098,13 @@ class LiftoffCompiler {
 
     __ emit_cond_jump(kUnsignedGreaterThanEqual, trap_label, kIntPtrKind,
                       index_ptrsize, effective_size_reg.gp(), trapping);
+
+    // If the index value stays around (e.g. in a local), remember the check
+    // for later accesses with the same index.
+    if (memory->index == 0 && index.is_gp() &&
+        __ cache_state()->is_used(index)) {
+      __ cache_state()->SetCheckedMem0Index(index_ptrsize, end_offset);
+    }
     return index_ptrsize;
   }
 
@@ -5690,15 +5706,28 @@ class LiftoffCompiler {
 
   void StructNew(FullDecoder* decoder, const StructIndexImmediate& imm,
                  bool initial_values_on_stack) {
-    LiftoffRegister rtt = RttCanon(imm.index, {});
-
-    CallRuntimeStub(WasmCode::kWasmAllocateStructWithRtt,
-                    MakeSig::Returns(kRef).Params(kRtt, kI32),
-                    {VarState{kRtt, rtt, 0},
-                     VarState{kI32, WasmStruct::Size(imm.struct_type), 0}},
-                    decoder->position());
-
     LiftoffRegister obj(kReturnRegister0);
+    int size = WasmStruct::Size(imm.struct_type);
+    {
+      // The builtin call on the slow path spills everything anyway, so do it
+      // upfront to have the same state on both paths.
+      __ SpillAllRegisters();
+      LiftoffRegister rtt = RttCanon(imm.index, LiftoffRegList{obj});
+      Label slow_path, done;
+      if (CanInlineAllocate(size)) {
+        LiftoffRegList pinned{obj, rtt};
+        InlineAllocate(obj.gp(), no_reg, size, &slow_path, pinned);
+        InitializeWasmObjectHeader(obj.gp(), rtt, pinned);
+        __ emit_jump(&done);
+      }
+      __ bind(&slow_path);
+      CallRuntimeStub(WasmCode::kWasmAllocateStructWithRtt,
+                      MakeSig::Returns(kRef).Params(kRtt, kI32),
+                      {VarState{kRtt, rtt, 0}, VarState{kI32, size, 0}},
+                      decoder->position());
+      __ bind(&done);
+    }
+
     LiftoffRegList pinned{obj};
 
     for (uint32_t i = imm.struct_type->field_count(); i > 0;) {
@@ -5783,18 +5812,52 @@ class LiftoffCompiler {
     ValueType elem_type = imm.array_type->element_type();
     ValueKind elem_kind = elem_type.kind();
     int elem_size = value_kind_size(elem_kind);
+    LiftoffRegister obj(kReturnRegister0);
     // Allocate the array.
     {
-      LiftoffRegister rtt = RttCanon(imm.index, {});
+      // As for structs, spill upfront to have the same state on both paths.
+      __ SpillAllRegisters();
+      LiftoffRegister rtt = RttCanon(imm.index, LiftoffRegList{obj});
+      Label slow_path, done;
+      if (CanInlineAllocate(WasmArray::kHeaderSize)) {
+        LiftoffRegList pinned{obj, rtt};
+        LiftoffRegister length = pinned.set(
+            __ LoadToRegister(__ cache_state()->stack_state.end()[-1], pinned));
+        // Leave big arrays to the builtin, which can also allocate them in
+        // large object space.
+        int elem_size_log2 = value_kind_size_log2(elem_kind);
+        constexpr int kAlignmentMask = static_cast<int>(kObjectAlignmentMask);
+        {
+          FREEZE_STATE(frozen);
+          __ emit_i32_cond_jumpi(kUnsignedGreaterThan, &slow_path, length.gp(),
+                                 (kMaxRegularHeapObjectSize -
+                                  WasmArray::kHeaderSize - kAlignmentMask) >>
+                                     elem_size_log2,
+                                 frozen);
+        }
+        // size = RoundUp(kHeaderSize + length * elem_size, kObjectAlignment).
+        Register size = pinned.set(__ GetUnusedRegister(kGpReg, pinned)).gp();
+        __ emit_i32_shli(size, length.gp(), elem_size_log2);
+        __ emit_i32_addi(size, size, WasmArray::kHeaderSize + kAlignmentMask);
+        __ emit_i32_andi(size, size, ~kAlignmentMask);
+        __ emit_u32_to_uintptr(size, size);
+        InlineAllocate(obj.gp(), size, 0, &slow_path, pinned);
+        InitializeWasmObjectHeader(obj.gp(), rtt, pinned);
+        StoreObjectField(obj.gp(), no_reg,
+                         ObjectAccess::ToTagged(WasmArray::kLengthOffset),
+                         length, pinned, kI32);
+        __ emit_jump(&done);
+      }
+      __ bind(&slow_path);
       CallRuntimeStub(WasmCode::kWasmAllocateArray_Uninitialized,
                       MakeSig::Returns(kRef).Params(kRtt, kI32, kI32),
                       {VarState{kRtt, rtt, 0},
                        __ cache_state()->stack_state.end()[-1],  // length
                        VarState{kI32, elem_size, 0}},
                       decoder->position());
+      __ bind(&done);
     }
 
-    LiftoffRegister obj(kReturnRegister0);
     LiftoffRegList pinned{obj};
     LiftoffRegister length = pinned.set(__ PopToModifiableRegister(pinned));
     LiftoffRegister value =
@@ -5840,25 +5903,9 @@ class LiftoffCompiler {
       MaybeEmitNullCheck(decoder, array_reg.gp(), pinned, array.type);
 
       // Bounds checks.
-      Label* trap_label =
-          AddOutOfLineTrap(decoder, WasmCode::kThrowWasmTrapArrayOutOfBounds);
-      LiftoffRegister array_length =
-          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      LoadObjectField(array_length, array_reg.gp(), no_reg,
-                      ObjectAccess::ToTagged(WasmArray::kLengthOffset), kI32,
-                      false, pinned);
       LiftoffRegister index = pinned.set(__ PeekToRegister(2, pinned));
       LiftoffRegister length = pinned.set(__ PeekToRegister(0, pinned));
-      LiftoffRegister index_plus_length =
-          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      DCHECK(index_plus_length != array_length);
-      __ emit_i32_add(index_plus_length.gp(), length.gp(), index.gp());
-      FREEZE_STATE(frozen);
-      __ emit_cond_jump(kUnsignedGreaterThan, trap_label, kI32,
-                        index_plus_length.gp(), array_length.gp(), frozen);
-      // Guard against overflow.
-      __ emit_cond_jump(kUnsignedGreaterThan, trap_label, kI32, index.gp(),
-                        index_plus_length.gp(), frozen);
+      BoundsCheckArrayRange(decoder, array_reg, index, length, pinned);
     }
 
     LiftoffRegList pinned;
@@ -5928,38 +5975,82 @@ class LiftoffCompiler {
   void ArrayCopy(FullDecoder* decoder, const Value& dst, const Value& dst_index,
                  const Value& src, const Value& src_index,
                  const ArrayIndexImmediate& src_imm, const Value& length) {
-    // TODO(14034): Unify implementation with TF: Implement this with
-    // GenerateCCall. Remove runtime function and builtin in wasm.tq.
-    CallRuntimeStub(v8_flags.experimental_wasm_skip_bounds_checks
-                        ? WasmCode::kWasmArrayCopy
-                        : WasmCode::kWasmArrayCopyWithChecks,
-                    MakeSig::Params(kI32, kI32, kI32, kRefNull, kRefNull),
-                    // Builtin parameter order:
-                    // [dst_index, src_index, length, dst, src].
-                    {__ cache_state()->stack_state.end()[-4],
-                     __ cache_state()->stack_state.end()[-2],
-                     __ cache_state()->stack_state.end()[-1],
-                     __ cache_state()->stack_state.end()[-5],
-                     __ cache_state()->stack_state.end()[-3]},
-                    decoder->position());
-    __ DropValues(5);
+    // Null and bounds checks. Check one array at a time to not run out of
+    // registers on ia32.
+    {
+      LiftoffRegList pinned;
+      LiftoffRegister dst_reg = pinned.set(__ PeekToRegister(4, pinned));
+      MaybeEmitNullCheck(decoder, dst_reg.gp(), pinned, dst.type);
+      LiftoffRegister dst_index_reg = pinned.set(__ PeekToRegister(3, pinned));
+      LiftoffRegister length_reg = pinned.set(__ PeekToRegister(0, pinned));
+      BoundsCheckArrayRange(decoder, dst_reg, dst_index_reg, length_reg,
+                            pinned);
+    }
+    {
+      LiftoffRegList pinned;
+      LiftoffRegister src_reg = pinned.set(__ PeekToRegister(2, pinned));
+      MaybeEmitNullCheck(decoder, src_reg.gp(), pinned, src.type);
+      LiftoffRegister src_index_reg = pinned.set(__ PeekToRegister(1, pinned));
+      LiftoffRegister length_reg = pinned.set(__ PeekToRegister(0, pinned));
+      BoundsCheckArrayRange(decoder, src_reg, src_index_reg, length_reg,
+                            pinned);
+    }
+
+    // Copy with {memmove} (or the heap's {MoveRange} for references) in C.
+    LiftoffRegList pinned;
+    LiftoffRegister length_reg = pinned.set(__ PopToRegister(pinned));
+    LiftoffRegister src_index_reg = pinned.set(__ PopToRegister(pinned));
+    LiftoffRegister src_reg = pinned.set(__ PopToRegister(pinned));
+    LiftoffRegister dst_index_reg = pinned.set(__ PopToRegister(pinned));
+    LiftoffRegister dst_reg = pinned.set(__ PopToRegister(pinned));
+    LiftoffRegister instance = pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    __ LoadInstanceFromFrame(instance.gp());
+    GenerateCCall(nullptr, kVoid, kVoid,
+                  {VarState{kIntPtrKind, instance, 0},
+                   VarState{kIntPtrKind, dst_reg, 0},
+                   VarState{kIntPtrKind, src_reg, 0},
+                   VarState{kI32, dst_index_reg, 0},
+                   VarState{kI32, src_index_reg, 0},
+                   VarState{kI32, length_reg, 0}},
+                  ExternalReference::wasm_array_copy_from_buffer());
   }
 
   void ArrayNewFixed(FullDecoder* decoder, const ArrayIndexImmediate& array_imm,
                      const IndexImmediate& length_imm,
                      const Value* /* elements */, Value* /* result */) {
-    LiftoffRegister rtt = RttCanon(array_imm.index, {});
     ValueKind elem_kind = array_imm.array_type->element_type().kind();
     int32_t elem_count = length_imm.index;
+    LiftoffRegister array(kReturnRegister0);
     // Allocate the array.
-    CallRuntimeStub(WasmCode::kWasmAllocateArray_Uninitialized,
-                    MakeSig::Returns(kRef).Params(kRtt, kI32, kI32),
-                    {VarState{kRtt, rtt, 0}, VarState{kI32, elem_count, 0},
-                     VarState{kI32, value_kind_size(elem_kind), 0}},
-                    decoder->position());
+    {
+      __ SpillAllRegisters();
+      LiftoffRegister rtt = RttCanon(array_imm.index, LiftoffRegList{array});
+      int size = static_cast<int>(OBJECT_POINTER_ALIGN(
+          WasmArray::kHeaderSize +
+          (elem_count << value_kind_size_log2(elem_kind))));
+      Label slow_path, done;
+      if (CanInlineAllocate(size)) {
+        LiftoffRegList pinned{array, rtt};
+        InlineAllocate(array.gp(), no_reg, size, &slow_path, pinned);
+        InitializeWasmObjectHeader(array.gp(), rtt, pinned);
+        LiftoffRegister length =
+            pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+        __ LoadConstant(length, WasmValue(elem_count));
+        StoreObjectField(array.gp(), no_reg,
+                         ObjectAccess::ToTagged(WasmArray::kLengthOffset),
+                         length, pinned, kI32);
+        __ emit_jump(&done);
+      }
+      __ bind(&slow_path);
+      CallRuntimeStub(WasmCode::kWasmAllocateArray_Uninitialized,
+                      MakeSig::Returns(kRef).Params(kRtt, kI32, kI32),
+                      {VarState{kRtt, rtt, 0}, VarState{kI32, elem_count, 0},
+                       VarState{kI32, value_kind_size(elem_kind), 0}},
+                      decoder->position());
+      __ bind(&done);
+    }
 
     // Initialize the array with stack arguments.
-    LiftoffRegister array(kReturnRegister0);
     if (!CheckSupportedType(decoder, elem_kind, "array.new_fixed")) return;
     for (int i = elem_count - 1; i >= 0; i--) {
       LiftoffRegList pinned{array};
@@ -8028,6 +8119,91 @@ class LiftoffCompiler {
                       length.gp(), trapping);
   }
 
+  // Checks that [index, index + length) is within the bounds of {array}.
+  void BoundsCheckArrayRange(FullDecoder* decoder, LiftoffRegister array,
+                             LiftoffRegister index, LiftoffRegister length,
+                             LiftoffRegList pinned) {
+    if (V8_UNLIKELY(v8_flags.experimental_wasm_skip_bounds_checks)) return;
+    Label* trap_label =
+        AddOutOfLineTrap(decoder, WasmCode::kThrowWasmTrapArrayOutOfBounds);
+    LiftoffRegister array_length =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    constexpr int kLengthOffset =
+        wasm::ObjectAccess::ToTagged(WasmArray::kLengthOffset);
+    __ Load(array_length, array.gp(), no_reg, kLengthOffset,
+            LoadType::kI32Load);
+    LiftoffRegister index_plus_length =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    DCHECK(index_plus_length != array_length);
+    __ emit_i32_add(index_plus_length.gp(), length.gp(), index.gp());
+    FREEZE_STATE(trapping);
+    __ emit_cond_jump(kUnsignedGreaterThan, trap_label, kI32,
+                      index_plus_length.gp(), array_length.gp(), trapping);
+    // Guard against overflow.
+    __ emit_cond_jump(kUnsignedGreaterThan, trap_label, kI32, index.gp(),
+                      index_plus_length.gp(), trapping);
+  }
+
+  // Whether objects of up to {size} bytes are allocated inline. This needs a
+  // few scratch registers, so we only do it on 64-bit platforms, and we leave
+  // the additional alignment of the 8GB-heap configuration to the builtins.
+  static bool CanInlineAllocate(int size) {
+    return kSystemPointerSize == 8 && !V8_COMPRESS_POINTERS_8GB_BOOL &&
+           v8_flags.inline_new && size <= kMaxRegularHeapObjectSize;
+  }
+
+  // Bump-pointer allocates {size_reg} (or, if that is {no_reg}, {size}) bytes
+  // in the young generation's linear allocation area. Jumps to {slow_path} if
+  // the area is exhausted, otherwise {obj} holds the tagged, uninitialized
+  // object afterwards. Since the object is young, initializing stores can
+  // skip the write barrier.
+  void InlineAllocate(Register obj, Register size_reg, int size,
+                      Label* slow_path, LiftoffRegList pinned) {
+    CODE_COMMENT("inline allocation");
+    pinned.set(obj);
+    Register top_address =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned)).gp();
+    Register limit = pinned.set(__ GetUnusedRegister(kGpReg, pinned)).gp();
+    LOAD_INSTANCE_FIELD(top_address, NewAllocationTopAddress,
+                        kSystemPointerSize, pinned);
+    LOAD_INSTANCE_FIELD(limit, NewAllocationLimitAddress, kSystemPointerSize,
+                        pinned);
+    __ LoadFullPointer(limit, limit, 0);
+    __ LoadFullPointer(obj, top_address, 0);
+    Register new_top = pinned.set(__ GetUnusedRegister(kGpReg, pinned)).gp();
+    if (size_reg == no_reg) {
+      __ emit_ptrsize_addi(new_top, obj, size);
+    } else {
+      __ emit_ptrsize_add(new_top, obj, size_reg);
+    }
+    {
+      FREEZE_STATE(frozen);
+      __ emit_cond_jump(kUnsignedGreaterThanEqual, slow_path, kIntPtrKind,
+                        new_top, limit, frozen);
+    }
+    __ Store(top_address, no_reg, 0, LiftoffRegister(new_top),
+             StoreType::ForValueKind(kIntPtrKind), pinned);
+    __ emit_ptrsize_addi(obj, obj, kHeapObjectTag);
+  }
+
+  // Initializes the map and the (unused) properties of a freshly allocated
+  // Wasm struct or array, like the allocation builtins do.
+  void InitializeWasmObjectHeader(Register obj, LiftoffRegister rtt,
+                                  LiftoffRegList pinned) {
+    StoreObjectField(obj, no_reg,
+                     ObjectAccess::ToTagged(HeapObject::kMapOffset), rtt,
+                     pinned, kRtt, LiftoffAssembler::kSkipWriteBarrier);
+    LiftoffRegister empty_fixed_array =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    __ LoadFullPointer(
+        empty_fixed_array.gp(), kRootRegister,
+        IsolateData::root_slot_offset(RootIndex::kEmptyFixedArray));
+    constexpr int kPropertiesOffset =
+        ObjectAccess::ToTagged(JSReceiver::kPropertiesOrHashOffset);
+    StoreObjectField(obj, no_reg, kPropertiesOffset, empty_fixed_array, pinned,
+                     kRef, LiftoffAssembler::kSkipWriteBarrier);
+  }
+
   int StructFieldOffset(const StructType* struct_type, int field_index) {
     return wasm::ObjectAccess::ToTagged(WasmStruct::kHeaderSize +
                                         struct_type->field_offset(field_index));
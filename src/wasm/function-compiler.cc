@@ -86,11 +86,9 @@ WasmCompilationResult WasmCompilationUnit::ExecuteFunctionCompilation(
     // This code path can only be reached in
     // - eager compilation mode,
     // - with lazy validation,
-    // - with PGO (which compiles some functions eagerly), or
+    // - with PGO (which compiles some functions eagerly; the profile can come
+    //   from a file or from the embedder, so there is no DCHECK here), or
     // - with compilation hints (which also compiles some functions eagerly).
-    DCHECK(!v8_flags.wasm_lazy_compilation || v8_flags.wasm_lazy_validation ||
-           v8_flags.experimental_wasm_pgo_from_file ||
-           v8_flags.experimental_wasm_compilation_hints);
     if (ValidateFunctionBody(env->enabled_features, env->module, detected,
                              func_body)
             .failed()) {
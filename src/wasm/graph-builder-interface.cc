@@ -854,6 +854,29 @@ class WasmGraphBuildingInterface {
         break;
       }
 
+      // Math.* imports that correspond to a single Wasm instruction.
+      case WKI::kMathF64Abs:
+        result = builder_->Unop(kExprF64Abs, args[0].node);
+        break;
+      case WKI::kMathF64Ceil:
+        result = builder_->Unop(kExprF64Ceil, args[0].node);
+        break;
+      case WKI::kMathF64Floor:
+        result = builder_->Unop(kExprF64Floor, args[0].node);
+        break;
+      case WKI::kMathF64Max:
+        result = builder_->Binop(kExprF64Max, args[0].node, args[1].node);
+        break;
+      case WKI::kMathF64Min:
+        result = builder_->Binop(kExprF64Min, args[0].node, args[1].node);
+        break;
+      case WKI::kMathF64Sqrt:
+        result = builder_->Unop(kExprF64Sqrt, args[0].node);
+        break;
+      case WKI::kMathF64Trunc:
+        result = builder_->Unop(kExprF64Trunc, args[0].node);
+        break;
+
       // Other string-related imports.
       case WKI::kDoubleToString:
         result = builder_->WellKnown_DoubleToString(args[0].node);
@@ -846,6 +846,10 @@ void CompilationState::TierUpAllFunctions() {
   Impl(this)->TierUpAllFunctions();
 }
 
+void CompilationState::ApplyPgoInfo(ProfileInformation* pgo_info) {
+  Impl(this)->ApplyPgoInfoLate(pgo_info);
+}
+
 void CompilationState::AllowAnotherTopTierJob(uint32_t func_index) {
   Impl(this)->AllowAnotherTopTierJob(func_index);
 }
@@ -1047,6 +1051,8 @@ class CompilationUnitBuilder {
     js_to_wasm_wrapper_units_.clear();
   }
 
+  size_t num_baseline_units() const { return baseline_units_.size(); }
+
   const WasmModule* module() { return native_module_->module(); }
 
  private:
@@ -1106,6 +1112,16 @@ class CompileLazyTimingScope {
   base::ElapsedTimer timer_;
 };
 
+void LogLazyCode(Isolate* isolate, WasmModuleObject module_object,
+                 WasmCode* code) {
+  if (!WasmCode::ShouldBeLogged(isolate)) return;
+  Object url_obj = module_object->script()->name();
+  DCHECK(url_obj.IsString() || url_obj.IsUndefined());
+  std::unique_ptr<char[]> url =
+      url_obj.IsString() ? String::cast(url_obj)->ToCString() : nullptr;
+  code->LogCode(isolate, url.get(), module_object->script()->id());
+}
+
 }  // namespace
 
 bool CompileLazy(Isolate* isolate, WasmInstanceObject instance,
@@ -1130,6 +1146,19 @@ bool CompileLazy(Isolate* isolate, WasmInstanceObject instance,
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
   DebugState is_in_debug_state = native_module->IsInDebugState();
+
+  WasmCodeRefScope code_ref_scope;
+  // TurboFan code deferred by --wasm-lazy-deserialization only needs to be
+  // copied and relocated. Debugging needs Liftoff code instead.
+  if (is_in_debug_state == kNotDebugging) {
+    if (WasmCode* code = DeserializeFunctionLazily(native_module, func_index)) {
+      DCHECK_EQ(func_index, code->index());
+      LogLazyCode(isolate, module_object, code);
+      counters->wasm_lazily_deserialized_functions()->Increment();
+      return true;
+    }
+  }
+
   ExecutionTierPair tiers =
       GetLazyCompilationTiers(native_module, func_index, is_in_debug_state);
 
@@ -1153,18 +1182,10 @@ bool CompileLazy(Isolate* isolate, WasmInstanceObject instance,
     return false;
   }
 
-  WasmCodeRefScope code_ref_scope;
   WasmCode* code =
       native_module->PublishCode(native_module->AddCompiledCode(result));
   DCHECK_EQ(func_index, code->index());
-
-  if (WasmCode::ShouldBeLogged(isolate)) {
-    Object url_obj = module_object->script()->name();
-    DCHECK(url_obj.IsString() || url_obj.IsUndefined());
-    std::unique_ptr<char[]> url =
-        url_obj.IsString() ? String::cast(url_obj)->ToCString() : nullptr;
-    code->LogCode(isolate, url.get(), module_object->script()->id());
-  }
+  LogLazyCode(isolate, module_object, code);
 
   counters->wasm_lazily_compiled_functions()->Increment();
 
@@ -2929,6 +2950,17 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(
   auto* compilation_state = Impl(job_->native_module_->compilation_state());
   compilation_state->AddCompilationUnit(compilation_unit_builder_.get(),
                                         func_index);
+
+  // Do not wait for the end of the chunk (which can hold the whole module) if
+  // the background threads are running out of work. As long as their queue
+  // holds more units than we collected, i.e. while the network outpaces
+  // compilation, keep collecting to avoid the overhead of many small commits.
+  size_t num_collected_units = compilation_unit_builder_->num_baseline_units();
+  if (num_collected_units > 0 &&
+      num_collected_units >= compilation_state->NumOutstandingCompilations(
+                                 CompilationTier::kBaseline)) {
+    CommitCompilationUnits();
+  }
   return true;
 }
 
@@ -3980,8 +4012,26 @@ WasmCode* CompileImportWrapper(
   // Keep the {WasmCode} alive until we explicitly call {IncRef}.
   WasmCodeRefScope code_ref_scope;
   CompilationEnv env = native_module->CreateCompilationEnv();
-  WasmCompilationResult result = compiler::CompileWasmImportCallWrapper(
-      &env, kind, sig, source_positions, expected_arity, suspend);
+  // Wrappers which do not depend on the module are compiled only once per
+  // process and then copied into each module that needs them.
+  std::shared_ptr<const WasmCompilationResult> shared_result;
+  base::Optional<WasmCompilationResult> local_result;
+  if (SharedImportWrapperCache::IsShareable(native_module->module(), sig)) {
+    SharedImportWrapperCache* shared_cache =
+        GetWasmEngine()->shared_import_wrapper_cache();
+    SharedImportWrapperCache::Key shared_key(key, env.enabled_features);
+    shared_result = shared_cache->MaybeGet(shared_key);
+    if (!shared_result) {
+      shared_result = shared_cache->Add(
+          shared_key, compiler::CompileWasmImportCallWrapper(
+                          &env, kind, sig, false, expected_arity, suspend));
+    }
+  } else {
+    local_result.emplace(compiler::CompileWasmImportCallWrapper(
+        &env, kind, sig, source_positions, expected_arity, suspend));
+  }
+  const WasmCompilationResult& result =
+      shared_result ? *shared_result : *local_result;
 
   std::unique_ptr<WasmCode> wasm_code = native_module->AddCode(
       result.func_index, result.code_desc, result.frame_slot_count,
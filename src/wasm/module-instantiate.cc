@@ -480,6 +480,45 @@ WellKnownImport CheckForWellKnownImport(Handle<WasmInstanceObject> instance,
       default:
         break;
     }
+    // Math functions that map directly to a Wasm instruction, so that
+    // optimized code can inline them instead of calling the (intrinsified)
+    // import wrapper.
+    if (!v8_flags.wasm_math_intrinsics) return kGeneric;
+    auto is_f64_sig = [sig](size_t param_count) {
+      if (sig->parameter_count() != param_count) return false;
+      if (sig->return_count() != 1 || sig->GetReturn(0) != kWasmF64) {
+        return false;
+      }
+      for (size_t i = 0; i < param_count; i++) {
+        if (sig->GetParam(i) != kWasmF64) return false;
+      }
+      return true;
+    };
+    switch (sfi->builtin_id()) {
+      case Builtin::kMathAbs:
+        if (is_f64_sig(1)) return WellKnownImport::kMathF64Abs;
+        break;
+      case Builtin::kMathCeil:
+        if (is_f64_sig(1)) return WellKnownImport::kMathF64Ceil;
+        break;
+      case Builtin::kMathFloor:
+        if (is_f64_sig(1)) return WellKnownImport::kMathF64Floor;
+        break;
+      case Builtin::kMathMax:
+        if (is_f64_sig(2)) return WellKnownImport::kMathF64Max;
+        break;
+      case Builtin::kMathMin:
+        if (is_f64_sig(2)) return WellKnownImport::kMathF64Min;
+        break;
+      case Builtin::kMathSqrt:
+        if (is_f64_sig(1)) return WellKnownImport::kMathF64Sqrt;
+        break;
+      case Builtin::kMathTrunc:
+        if (is_f64_sig(1)) return WellKnownImport::kMathF64Trunc;
+        break;
+      default:
+        break;
+    }
     return kGeneric;
   }
 
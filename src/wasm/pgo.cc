@@ -4,6 +4,8 @@
 
 #include "src/wasm/pgo.h"
 
+#include "src/base/memory.h"
+#include "src/utils/version.h"
 #include "src/wasm/decoder.h"
 #include "src/wasm/wasm-module-builder.h"  // For {ZoneBuffer}.
 
@@ -20,9 +22,13 @@ class ProfileGenerator {
         type_feedback_mutex_guard_(&module->type_feedback.mutex),
         tiering_budget_array_(tiering_budget_array) {}
 
-  base::OwnedVector<uint8_t> GetProfileData() {
+  base::OwnedVector<uint8_t> GetProfileData(
+      base::Vector<const uint8_t> embedder_header = {}) {
     ZoneBuffer buffer{&zone_};
 
+    if (!embedder_header.empty()) {
+      buffer.write(embedder_header.begin(), embedder_header.size());
+    }
     SerializeTypeFeedback(buffer);
     SerializeTieringInfo(buffer);
 
@@ -177,7 +183,7 @@ std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
 }
 
 std::unique_ptr<ProfileInformation> RestoreProfileData(
-    const WasmModule* module, base::Vector<uint8_t> profile_data) {
+    const WasmModule* module, base::Vector<const uint8_t> profile_data) {
   Decoder decoder{profile_data.begin(), profile_data.end()};
 
   DeserializeTypeFeedback(decoder, module);
@@ -190,6 +196,123 @@ std::unique_ptr<ProfileInformation> RestoreProfileData(
   return pgo_info;
 }
 
+// Checks that {decoder} holds well-formed profile data for {module} that is
+// consistent with the feedback collected so far, without applying any of it.
+// {RestoreProfileData} CHECKs all of that, which is fine for files written by
+// V8 itself, but not for data handed to us by the embedder.
+bool ValidateProfileData(Decoder& decoder, const WasmModule* module) {
+  base::SharedMutexGuard<base::kShared> type_feedback_guard{
+      &module->type_feedback.mutex};
+  const std::unordered_map<uint32_t, FunctionTypeFeedback>&
+      feedback_for_function = module->type_feedback.feedback_for_function;
+  const uint32_t num_functions =
+      module->num_imported_functions + module->num_declared_functions;
+  auto is_function_index = [num_functions](int index) {
+    return index >= 0 && static_cast<uint32_t>(index) < num_functions;
+  };
+
+  uint32_t num_entries = decoder.consume_u32v("num function entries");
+  if (num_entries > module->num_declared_functions) return false;
+  for (uint32_t entry = 0; entry < num_entries && decoder.ok(); ++entry) {
+    uint32_t function_index = decoder.consume_u32v("function index");
+    if (function_index < module->num_imported_functions ||
+        function_index >= num_functions) {
+      return false;
+    }
+    uint32_t feedback_vector_size =
+        decoder.consume_u32v("feedback vector size");
+    // Every call site takes at least one byte.
+    if (feedback_vector_size > decoder.available_bytes()) return false;
+    for (uint32_t i = 0; i < feedback_vector_size && decoder.ok(); ++i) {
+      int num_cases = decoder.consume_i32v("num cases");
+      if (num_cases < 0 || num_cases > kMaxPolymorphism) return false;
+      for (int j = 0; j < num_cases; ++j) {
+        if (!is_function_index(decoder.consume_i32v("function index"))) {
+          return false;
+        }
+        if (decoder.consume_i32v("call count") < 0) return false;
+      }
+    }
+    uint32_t num_call_targets = decoder.consume_u32v("num call targets");
+    if (num_call_targets > decoder.available_bytes()) return false;
+    auto existing = feedback_for_function.find(function_index);
+    const FunctionTypeFeedback* old_feedback =
+        existing == feedback_for_function.end() ? nullptr : &existing->second;
+    if (old_feedback && !old_feedback->feedback_vector.empty() &&
+        old_feedback->feedback_vector.size() != feedback_vector_size) {
+      return false;
+    }
+    if (old_feedback &&
+        old_feedback->call_targets.size() != num_call_targets) {
+      return false;
+    }
+    for (uint32_t i = 0; i < num_call_targets && decoder.ok(); ++i) {
+      uint32_t call_target = decoder.consume_u32v("call target");
+      if (call_target != FunctionTypeFeedback::kNonDirectCall &&
+          call_target >= num_functions) {
+        return false;
+      }
+      if (old_feedback && old_feedback->call_targets[i] != call_target) {
+        return false;
+      }
+    }
+  }
+
+  for (uint32_t i = 0; i < module->num_declared_functions; ++i) {
+    uint8_t tiering_info = decoder.consume_u8("tiering info");
+    if (tiering_info & ~(kFunctionExecutedBit | kFunctionTieredUpBit)) {
+      return false;
+    }
+  }
+  return decoder.ok() && decoder.pc() == decoder.end();
+}
+
+// Profiles for the embedder start with a header that identifies the V8
+// version and the module, so that stale or mismatching profiles are rejected.
+constexpr size_t kEmbedderProfileHeaderSize = 3 * sizeof(uint32_t);
+
+void WriteEmbedderProfileHeader(const WasmModule* module,
+                                base::Vector<const uint8_t> wire_bytes,
+                                base::Vector<uint8_t> header) {
+  DCHECK_EQ(kEmbedderProfileHeaderSize, header.size());
+  uint32_t values[] = {Version::Hash(),
+                       static_cast<uint32_t>(GetWireBytesHash(wire_bytes)),
+                       module->num_declared_functions};
+  static_assert(sizeof(values) == kEmbedderProfileHeaderSize);
+  for (size_t i = 0; i < arraysize(values); ++i) {
+    base::WriteLittleEndianValue<uint32_t>(
+        reinterpret_cast<Address>(header.begin() + i * sizeof(uint32_t)),
+        values[i]);
+  }
+}
+
+base::OwnedVector<uint8_t> GetProfileDataForEmbedder(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    const uint32_t* tiering_budget_array) {
+  uint8_t header[kEmbedderProfileHeaderSize];
+  WriteEmbedderProfileHeader(module, wire_bytes, base::ArrayVector(header));
+  ProfileGenerator profile_generator{module, tiering_budget_array};
+  return profile_generator.GetProfileData(base::ArrayVector(header));
+}
+
+std::unique_ptr<ProfileInformation> RestoreProfileDataFromEmbedder(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    base::Vector<const uint8_t> profile_data) {
+  if (profile_data.size() < kEmbedderProfileHeaderSize) return {};
+  uint8_t expected_header[kEmbedderProfileHeaderSize];
+  WriteEmbedderProfileHeader(module, wire_bytes,
+                             base::ArrayVector(expected_header));
+  if (memcmp(profile_data.begin(), expected_header,
+             kEmbedderProfileHeaderSize) != 0) {
+    return {};
+  }
+  base::Vector<const uint8_t> body =
+      profile_data + kEmbedderProfileHeaderSize;
+  Decoder validator{body.begin(), body.end()};
+  if (!ValidateProfileData(validator, module)) return {};
+  return RestoreProfileData(module, body);
+}
+
 void DumpProfileToFile(const WasmModule* module,
                        base::Vector<const uint8_t> wire_bytes,
                        uint32_t* tiering_budget_array) {
@@ -47,6 +47,22 @@ void DumpProfileToFile(const WasmModule* module,
 V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation> LoadProfileFromFile(
     const WasmModule* module, base::Vector<const uint8_t> wire_bytes);
 
+// Returns the profile in the format used by the embedder API (see
+// {v8::CompiledWasmModule::SerializeProfile}), which is the file format plus a
+// header identifying the V8 version and the module.
+base::OwnedVector<uint8_t> GetProfileDataForEmbedder(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    const uint32_t* tiering_budget_array);
+
+// Restores the type feedback of an embedder-provided profile, and returns the
+// tiering information to apply. Unlike {LoadProfileFromFile}, the data is
+// fully validated first; returns nullptr if it is malformed, or was created by
+// a different V8 version or for a different module.
+V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation>
+RestoreProfileDataFromEmbedder(const WasmModule* module,
+                               base::Vector<const uint8_t> wire_bytes,
+                               base::Vector<const uint8_t> profile_data);
+
 }  // namespace v8::internal::wasm
 
 #endif  // V8_WASM_PGO_H_
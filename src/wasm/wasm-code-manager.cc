@@ -42,6 +42,7 @@
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects-inl.h"
 #include "src/wasm/wasm-objects.h"
+#include "src/wasm/wasm-serialization.h"
 #include "src/wasm/well-known-imports.h"
 
 #if defined(V8_OS_WIN64)
@@ -1771,8 +1772,22 @@ WasmCode::RuntimeStubId NativeModule::GetRuntimeStubId(Address target) const {
   return WasmCode::kRuntimeStubCount;
 }
 
+void NativeModule::set_lazy_deserialization_data(
+    std::unique_ptr<LazyDeserializationData> data) {
+  DCHECK_NULL(lazy_deserialization_data_);
+  lazy_deserialization_data_ = std::move(data);
+}
+
 NativeModule::~NativeModule() {
   TRACE_HEAP("Deleting native module: %p\n", this);
+  // Write out the code for other processes before anything gets freed, unless
+  // it was loaded from a code cache file in the first place.
+  if (V8_UNLIKELY(v8_flags.experimental_wasm_code_cache_files) &&
+      module_->origin == kWasmOrigin &&
+      !(lazy_deserialization_data_ &&
+        lazy_deserialization_data_->is_mapped_from_file())) {
+    SerializeNativeModuleToFile(this);
+  }
   // Cancel all background compilation before resetting any field of the
   // NativeModule or freeing anything.
   compilation_state_->CancelCompilation();
@@ -43,6 +43,7 @@ namespace wasm {
 
 class AssumptionsJournal;
 class DebugInfo;
+class LazyDeserializationData;
 class NamesProvider;
 class NativeModule;
 struct WasmCompilationResult;
@@ -119,8 +120,6 @@ enum class WellKnownImport : uint8_t;
   IF_TSAN(V, TSANRelaxedLoad64IgnoreFP)  \
   IF_TSAN(V, TSANRelaxedLoad64SaveFP)    \
   V(WasmAllocateArray_Uninitialized)     \
-  V(WasmArrayCopy)                       \
-  V(WasmArrayCopyWithChecks)             \
   V(WasmArrayNewSegment)                 \
   V(WasmArrayInitSegment)                \
   V(WasmAllocateStructWithRtt)           \
@@ -743,6 +742,7 @@ class V8_EXPORT_PRIVATE NativeModule final {
   size_t generated_code_size() const {
     return code_allocator_.generated_code_size();
   }
+  size_t freed_code_size() const { return code_allocator_.freed_code_size(); }
   size_t liftoff_bailout_count() const {
     return liftoff_bailout_count_.load(std::memory_order_relaxed);
   }
@@ -857,6 +857,15 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   uint32_t* tiering_budget_array() const { return tiering_budgets_.get(); }
 
+  // The serialized code of functions whose deserialization was deferred until
+  // they are first called (--wasm-lazy-deserialization). Set once during
+  // deserialization, before the module is shared, and immutable afterwards.
+  void set_lazy_deserialization_data(
+      std::unique_ptr<LazyDeserializationData> data);
+  const LazyDeserializationData* lazy_deserialization_data() const {
+    return lazy_deserialization_data_.get();
+  }
+
   Counters* counters() const { return code_allocator_.counters(); }
 
  private:
@@ -974,6 +983,8 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // Array to handle number of function calls.
   std::unique_ptr<uint32_t[]> tiering_budgets_;
 
+  std::unique_ptr<LazyDeserializationData> lazy_deserialization_data_;
+
   // This mutex protects concurrent calls to {AddCode} and friends.
   // TODO(dlehmann): Revert this to a regular {Mutex} again.
   // This needs to be a {RecursiveMutex} only because of {CodeSpaceWriteScope}
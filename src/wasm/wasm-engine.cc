@@ -33,6 +33,7 @@
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects-inl.h"
+#include "src/wasm/wasm-serialization.h"
 
 #ifdef V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
 #include "src/debug/wasm/gdb-server/gdb-server.h"
@@ -535,6 +536,11 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
     ModuleWireBytes bytes) {
   int compilation_id = next_compilation_id_.fetch_add(1);
   TRACE_EVENT1("v8.wasm", "wasm.SyncCompile", "id", compilation_id);
+  if (V8_UNLIKELY(v8_flags.experimental_wasm_code_cache_files)) {
+    MaybeHandle<WasmModuleObject> cached_module =
+        DeserializeNativeModuleFromFile(isolate, bytes.module_bytes());
+    if (!cached_module.is_null()) return cached_module;
+  }
   v8::metrics::Recorder::ContextId context_id =
       isolate->GetOrRegisterRecorderContextId(isolate->native_context());
   std::shared_ptr<WasmModule> module;
@@ -693,6 +699,14 @@ void WasmEngine::AsyncCompile(
     streaming_decoder->Finish();
     return;
   }
+  if (V8_UNLIKELY(v8_flags.experimental_wasm_code_cache_files) && !is_shared) {
+    Handle<WasmModuleObject> cached_module;
+    if (DeserializeNativeModuleFromFile(isolate, bytes.module_bytes())
+            .ToHandle(&cached_module)) {
+      resolver->OnCompilationSucceeded(cached_module);
+      return;
+    }
+  }
   // Make a copy of the wire bytes in case the user program changes them
   // during asynchronous compilation.
   base::OwnedVector<const uint8_t> copy =
@@ -1236,6 +1250,10 @@ std::shared_ptr<NativeModule> WasmEngine::NewNativeModule(
   }
 #endif  // V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
 
+  if (V8_UNLIKELY(v8_flags.wasm_precompile_import_wrappers)) {
+    shared_import_wrapper_cache_.PrecompileCommonWrappersInBackground();
+  }
+
   std::shared_ptr<NativeModule> native_module =
       GetWasmCodeManager()->NewNativeModule(
           isolate, enabled, code_size_estimate, std::move(module));
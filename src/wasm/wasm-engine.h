@@ -22,6 +22,7 @@
 #include "src/tasks/operations-barrier.h"
 #include "src/wasm/canonical-types.h"
 #include "src/wasm/wasm-code-manager.h"
+#include "src/wasm/wasm-import-wrapper-cache.h"
 #include "src/wasm/wasm-tier.h"
 #include "src/zone/accounting-allocator.h"
 
@@ -367,6 +368,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
     return &call_descriptors_;
   }
 
+  SharedImportWrapperCache* shared_import_wrapper_cache() {
+    return &shared_import_wrapper_cache_;
+  }
+
   // Returns either the compressed tagged pointer representing a null value or
   // 0 if pointer compression is not available.
   Tagged_t compressed_wasm_null_value_or_zero() const {
@@ -415,6 +420,8 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   compiler::WasmCallDescriptors call_descriptors_;
 
+  SharedImportWrapperCache shared_import_wrapper_cache_;
+
   // This mutex protects all information which is mutated concurrently or
   // fields that are initialized lazily on the first access.
   base::Mutex mutex_;
@@ -595,6 +595,19 @@ void array_copy_wrapper(Address raw_instance, Address raw_dst_array,
   }
 }
 
+void array_copy_from_buffer_wrapper(Address data) {
+  size_t offset = 0;
+  Address raw_instance = ReadAndIncrementOffset<Address>(data, &offset);
+  Address raw_dst_array = ReadAndIncrementOffset<Address>(data, &offset);
+  Address raw_src_array = ReadAndIncrementOffset<Address>(data, &offset);
+  uint32_t dst_index = ReadAndIncrementOffset<uint32_t>(data, &offset);
+  uint32_t src_index = ReadAndIncrementOffset<uint32_t>(data, &offset);
+  uint32_t length = ReadAndIncrementOffset<uint32_t>(data, &offset);
+  if (length == 0) return;
+  array_copy_wrapper(raw_instance, raw_dst_array, dst_index, raw_src_array,
+                     src_index, length);
+}
+
 void array_fill_wrapper(Address raw_array, uint32_t index, uint32_t length,
                         uint32_t emit_write_barrier, uint32_t raw_type,
                         Address initial_value_addr) {
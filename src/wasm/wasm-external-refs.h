@@ -121,6 +121,12 @@ void array_copy_wrapper(Address raw_instance, Address raw_dst_array,
                         uint32_t dst_index, Address raw_src_array,
                         uint32_t src_index, uint32_t length);
 
+// Same as {array_copy_wrapper}, but reads the arguments from the buffer at
+// {data}: the instance, destination and source array as full pointers, then
+// the destination index, source index and length as uint32. Does nothing if
+// the length is 0.
+void array_copy_from_buffer_wrapper(Address data);
+
 // The initial value is passed as an int64_t on the stack. Cannot handle s128
 // other than 0.
 void array_fill_wrapper(Address raw_array, uint32_t index, uint32_t length,
@@ -6,7 +6,13 @@
 
 #include <vector>
 
+#include "src/compiler/wasm-compiler.h"
+#include "src/init/v8.h"
+#include "src/wasm/canonical-types.h"
+#include "src/wasm/function-compiler.h"
 #include "src/wasm/wasm-code-manager.h"
+#include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-module.h"
 
 namespace v8 {
 namespace internal {
@@ -57,6 +63,100 @@ WasmImportWrapperCache::~WasmImportWrapperCache() {
   WasmCode::DecrementRefCount(base::VectorOf(ptrs));
 }
 
+// static
+bool SharedImportWrapperCache::IsShareable(const WasmModule* module,
+                                           const FunctionSig* sig) {
+  if (is_asmjs_module(module)) return false;
+  for (ValueType type : sig->all()) {
+    if (!type.is_numeric()) return false;
+  }
+  return true;
+}
+
+std::shared_ptr<const WasmCompilationResult> SharedImportWrapperCache::MaybeGet(
+    const Key& key) const {
+  base::MutexGuard lock(&mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return {};
+  return it->second;
+}
+
+std::shared_ptr<const WasmCompilationResult> SharedImportWrapperCache::Add(
+    const Key& key, WasmCompilationResult result) {
+  DCHECK(result.succeeded());
+  auto entry =
+      std::make_shared<const WasmCompilationResult>(std::move(result));
+  base::MutexGuard lock(&mutex_);
+  // If another thread added the same wrapper in the meantime, keep that one.
+  return entries_.emplace(key, std::move(entry)).first->second;
+}
+
+namespace {
+
+class PrecompileImportWrappersTask final : public v8::Task {
+ public:
+  explicit PrecompileImportWrappersTask(SharedImportWrapperCache* cache)
+      : cache_(cache) {}
+
+  void Run() override {
+    // Keep the engine alive; if it is being torn down, just do nothing.
+    OperationsBarrier::Token token =
+        GetWasmEngine()->GetBarrierForBackgroundCompile()->TryLock();
+    if (!token) return;
+
+    // Wrappers of numeric signatures do not look at the module, so an empty
+    // one is enough.
+    WasmModule empty_module;
+    constexpr ValueType kI32 = kWasmI32;
+    constexpr ValueType kF32 = kWasmF32;
+    constexpr ValueType kF64 = kWasmF64;
+    using Sig = FixedSizeSignature<ValueType>;
+    Compile(&empty_module, Sig::Params());
+    Compile(&empty_module, Sig::Params(kI32));
+    Compile(&empty_module, Sig::Params(kI32, kI32));
+    Compile(&empty_module, Sig::Params(kI32, kI32, kI32));
+    Compile(&empty_module, Sig::Returns(kI32));
+    Compile(&empty_module, Sig::Returns(kI32).Params(kI32));
+    Compile(&empty_module, Sig::Returns(kI32).Params(kI32, kI32));
+    Compile(&empty_module, Sig::Returns(kI32).Params(kI32, kI32, kI32));
+    Compile(&empty_module, Sig::Returns(kF32).Params(kF32));
+    Compile(&empty_module, Sig::Returns(kF64).Params(kF64));
+    Compile(&empty_module, Sig::Returns(kF64).Params(kF64, kF64));
+  }
+
+ private:
+  void Compile(const WasmModule* module, const FunctionSig& sig) {
+    WasmFeatures enabled_features = WasmFeatures::FromFlags();
+    CompilationEnv env(module, kRuntimeExceptionSupport,
+                       enabled_features,
+                       DynamicTiering{v8_flags.wasm_dynamic_tiering.value()});
+    int expected_arity = static_cast<int>(sig.parameter_count());
+    WasmImportWrapperCache::CacheKey wrapper_key(
+        ImportCallKind::kJSFunctionArityMatch,
+        GetTypeCanonicalizer()->AddRecursiveGroup(&sig), expected_arity,
+        kNoSuspend);
+    SharedImportWrapperCache::Key key(wrapper_key, enabled_features);
+    if (cache_->MaybeGet(key)) return;
+    cache_->Add(key, compiler::CompileWasmImportCallWrapper(
+                         &env, ImportCallKind::kJSFunctionArityMatch, &sig,
+                         false, expected_arity, kNoSuspend));
+  }
+
+  SharedImportWrapperCache* const cache_;
+};
+
+}  // namespace
+
+void SharedImportWrapperCache::PrecompileCommonWrappersInBackground() {
+  {
+    base::MutexGuard lock(&mutex_);
+    if (precompilation_started_) return;
+    precompilation_started_ = true;
+  }
+  V8::GetCurrentPlatform()->CallOnWorkerThread(
+      std::make_unique<PrecompileImportWrappersTask>(this));
+}
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -9,8 +9,12 @@
 #ifndef V8_WASM_WASM_IMPORT_WRAPPER_CACHE_H_
 #define V8_WASM_WASM_IMPORT_WRAPPER_CACHE_H_
 
+#include <memory>
+#include <unordered_map>
+
 #include "src/base/platform/mutex.h"
 #include "src/wasm/module-instantiate.h"
+#include "src/wasm/wasm-features.h"
 
 namespace v8 {
 namespace internal {
@@ -21,6 +25,8 @@ namespace wasm {
 
 class WasmCode;
 class WasmEngine;
+struct WasmCompilationResult;
+struct WasmModule;
 
 using FunctionSig = Signature<ValueType>;
 
@@ -87,6 +93,60 @@ class WasmImportWrapperCache {
   std::unordered_map<CacheKey, WasmCode*, CacheKeyHash> entry_map_;
 };
 
+// An engine-wide cache of compiled, but not yet relocated, import wrappers.
+// Each {NativeModule} still gets its own copy of a wrapper in its code space
+// (see {WasmImportWrapperCache}), but only the first module that needs a
+// wrapper compiles it; all others just copy and relocate the cached code.
+class SharedImportWrapperCache {
+ public:
+  struct Key {
+    Key(const WasmImportWrapperCache::CacheKey& wrapper_key,
+        const WasmFeatures& enabled_features)
+        : wrapper_key(wrapper_key), enabled_features(enabled_features) {}
+
+    bool operator==(const Key& rhs) const {
+      return wrapper_key == rhs.wrapper_key &&
+             enabled_features == rhs.enabled_features;
+    }
+
+    WasmImportWrapperCache::CacheKey wrapper_key;
+    WasmFeatures enabled_features;
+  };
+
+  class KeyHash {
+   public:
+    size_t operator()(const Key& key) const {
+      return base::hash_combine(
+          WasmImportWrapperCache::CacheKeyHash{}(key.wrapper_key),
+          key.enabled_features.ToIntegral());
+    }
+  };
+
+  // Whether the wrapper for {sig} only depends on the cache key. Wrappers for
+  // signatures with reference types depend on the module's type definitions,
+  // and asm.js wrappers carry source positions.
+  static bool IsShareable(const WasmModule* module, const FunctionSig* sig);
+
+  // Thread-safe. Returns nullptr if no wrapper was added for {key} yet.
+  std::shared_ptr<const WasmCompilationResult> MaybeGet(const Key& key) const;
+
+  // Thread-safe. Returns the cached wrapper for {key}, which is the one added
+  // first if several threads race to add one.
+  std::shared_ptr<const WasmCompilationResult> Add(
+      const Key& key, WasmCompilationResult result);
+
+  // Compiles the wrappers for a few common signatures on a background thread,
+  // see --wasm-precompile-import-wrappers.
+  void PrecompileCommonWrappersInBackground();
+
+ private:
+  mutable base::Mutex mutex_;
+  std::unordered_map<Key, std::shared_ptr<const WasmCompilationResult>,
+                     KeyHash>
+      entries_;
+  bool precompilation_started_ = false;
+};
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -755,6 +755,10 @@ Handle<WasmMemoryObject> WasmMemoryObject::New(Isolate* isolate,
     backing_store->AttachSharedWasmMemoryObject(isolate, memory_object);
   } else if (backing_store) {
     CHECK(!backing_store->is_shared());
+    if (v8_flags.wasm_discard_zeroed_memory_pages &&
+        backing_store->is_wasm_memory()) {
+      isolate->AddDiscardableWasmMemory(memory_object);
+    }
   }
 
   // For debugging purposes we memorize a link from the JSArrayBuffer
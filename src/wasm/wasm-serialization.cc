@@ -9,6 +9,7 @@
 #include "src/debug/debug.h"
 #include "src/runtime/runtime.h"
 #include "src/snapshot/snapshot-data.h"
+#include "src/tracing/trace-event.h"
 #include "src/utils/ostreams.h"
 #include "src/utils/version.h"
 #include "src/wasm/code-space-access.h"
@@ -277,6 +278,13 @@ class ExternalReferenceList {
 static_assert(std::is_trivially_destructible<ExternalReferenceList>::value,
               "static destructors not allowed");
 
+// A TurboFan function together with the slice of the output buffer it gets
+// serialized into.
+struct SerializationUnit {
+  const WasmCode* code;
+  base::Vector<uint8_t> dst_buffer;
+};
+
 }  // namespace
 
 class V8_EXPORT_PRIVATE NativeModuleSerializer {
@@ -290,17 +298,53 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
   bool Write(Writer* writer);
 
  private:
+  friend class SerializeCodeTask;
+
   size_t MeasureCode(const WasmCode*) const;
+  // Returns the record of a function that was not deserialized yet, if any.
+  base::Vector<const uint8_t> DeferredRecord(int declared_index) const;
   void WriteHeader(Writer*, size_t total_code_size);
-  void WriteCode(const WasmCode*, Writer*);
+  // Thread-safe, so TurboFan functions can be written concurrently.
+  void WriteCode(const WasmCode*, Writer*) const;
+  void WriteUnits(std::vector<std::vector<SerializationUnit>> batches) const;
   void WriteTieringBudget(Writer* writer);
 
   const NativeModule* const native_module_;
   const base::Vector<WasmCode* const> code_table_;
   const base::Vector<WellKnownImport const> import_statuses_;
   bool write_called_ = false;
-  size_t total_written_code_ = 0;
-  int num_turbofan_functions_ = 0;
+};
+
+// Writes batches of TurboFan functions, which is where almost all the time of
+// serialization is spent (copying and relocating the code). Each unit has its
+// own slice of the output buffer, so the units can be written in any order.
+class SerializeCodeTask : public JobTask {
+ public:
+  SerializeCodeTask(const NativeModuleSerializer* serializer,
+                    std::vector<std::vector<SerializationUnit>> batches)
+      : serializer_(serializer), batches_(std::move(batches)) {}
+
+  void Run(JobDelegate* delegate) override {
+    do {
+      size_t index = next_batch_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= batches_.size()) return;
+      for (const SerializationUnit& unit : batches_[index]) {
+        Writer writer(unit.dst_buffer);
+        serializer_->WriteCode(unit.code, &writer);
+        DCHECK_EQ(unit.dst_buffer.size(), writer.bytes_written());
+      }
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    size_t next_batch = next_batch_.load(std::memory_order_relaxed);
+    return batches_.size() - std::min(next_batch, batches_.size());
+  }
+
+ private:
+  const NativeModuleSerializer* const serializer_;
+  const std::vector<std::vector<SerializationUnit>> batches_;
+  std::atomic<size_t> next_batch_{0};
 };
 
 NativeModuleSerializer::NativeModuleSerializer(
@@ -326,10 +370,21 @@ size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
          code->protected_instructions_data().size();
 }
 
+base::Vector<const uint8_t> NativeModuleSerializer::DeferredRecord(
+    int declared_index) const {
+  const LazyDeserializationData* data =
+      native_module_->lazy_deserialization_data();
+  if (data == nullptr) return {};
+  return data->GetRecord(declared_index);
+}
+
 size_t NativeModuleSerializer::Measure() const {
   size_t size = kHeaderSize;
-  for (WasmCode* code : code_table_) {
-    size += MeasureCode(code);
+  for (int i = 0; i < static_cast<int>(code_table_.size()); ++i) {
+    base::Vector<const uint8_t> deferred_record;
+    if (code_table_[i] == nullptr) deferred_record = DeferredRecord(i);
+    size += deferred_record.empty() ? MeasureCode(code_table_[i])
+                                    : deferred_record.size();
   }
   // Add the size of the well-known imports status.
   size += import_statuses_.size() * sizeof(WellKnownImport);
@@ -363,7 +418,8 @@ void NativeModuleSerializer::WriteHeader(Writer* writer,
   writer->WriteVector(base::VectorOf(import_statuses_));
 }
 
-void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
+void NativeModuleSerializer::WriteCode(const WasmCode* code,
+                                       Writer* writer) const {
   if (code == nullptr) {
     writer->Write(kLazyFunction);
     return;
@@ -388,7 +444,6 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
     return;
   }
 
-  ++num_turbofan_functions_;
   writer->Write(kTurboFanFunction);
   // Write the size of the entire code section, followed by the code header.
   writer->Write(code->constant_pool_offset());
@@ -480,7 +535,29 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
   if (code_start != serialized_code_start) {
     memcpy(serialized_code_start, code_start, code_size);
   }
-  total_written_code_ += code_size;
+}
+
+void NativeModuleSerializer::WriteUnits(
+    std::vector<std::vector<SerializationUnit>> batches) const {
+  if (batches.empty()) return;
+  // Tracing output of concurrent writers would be interleaved.
+  if (!v8_flags.wasm_concurrent_serialization ||
+      v8_flags.trace_wasm_serialization || batches.size() == 1) {
+    for (const auto& batch : batches) {
+      for (const SerializationUnit& unit : batch) {
+        Writer writer(unit.dst_buffer);
+        WriteCode(unit.code, &writer);
+        DCHECK_EQ(unit.dst_buffer.size(), writer.bytes_written());
+      }
+    }
+    return;
+  }
+
+  std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->CreateJob(
+      TaskPriority::kUserVisible,
+      std::make_unique<SerializeCodeTask>(this, std::move(batches)));
+  // Wait for all tasks to finish, while participating in their work.
+  job_handle->Join();
 }
 
 void NativeModuleSerializer::WriteTieringBudget(Writer* writer) {
@@ -493,24 +570,69 @@ bool NativeModuleSerializer::Write(Writer* writer) {
   DCHECK(!write_called_);
   write_called_ = true;
 
+  const LazyDeserializationData* lazy_data =
+      native_module_->lazy_deserialization_data();
   size_t total_code_size = 0;
-  for (WasmCode* code : code_table_) {
+  for (int i = 0; i < static_cast<int>(code_table_.size()); ++i) {
+    WasmCode* code = code_table_[i];
     if (code && code->tier() == ExecutionTier::kTurbofan) {
       DCHECK(IsAligned(code->instructions().size(), kCodeAlignment));
       total_code_size += code->instructions().size();
+    } else if (!code && !DeferredRecord(i).empty()) {
+      total_code_size += lazy_data->GetCodeSize(i);
     }
   }
   WriteHeader(writer, total_code_size);
 
-  for (WasmCode* code : code_table_) {
-    WriteCode(code, writer);
+  // Lazy and eager functions are a single byte and written right away. For
+  // TurboFan functions, the exact size is known upfront, so we only reserve
+  // their slice of the buffer here and write them in batches afterwards,
+  // possibly on background threads. The format does not depend on that.
+  // Choose a batch size such that we do not create too small batches (>=100k
+  // code bytes), but also not too many (<=100 batches), like the deserializer.
+  constexpr size_t kMinBatchSizeInBytes = 100000;
+  const size_t batch_limit =
+      std::max(kMinBatchSizeInBytes, total_code_size / 100);
+  std::vector<std::vector<SerializationUnit>> batches;
+  std::vector<SerializationUnit> batch;
+  size_t batch_size = 0;
+  size_t total_reserved_code = 0;
+  bool wrote_deferred_code = false;
+  for (int i = 0; i < static_cast<int>(code_table_.size()); ++i) {
+    WasmCode* code = code_table_[i];
+    // Code that was never deserialized is written out as it was read.
+    base::Vector<const uint8_t> deferred_record;
+    if (code == nullptr) deferred_record = DeferredRecord(i);
+    if (!deferred_record.empty()) {
+      writer->WriteVector(deferred_record);
+      total_reserved_code += lazy_data->GetCodeSize(i);
+      wrote_deferred_code = true;
+      continue;
+    }
+    if (code == nullptr || code->tier() != ExecutionTier::kTurbofan) {
+      WriteCode(code, writer);
+      continue;
+    }
+    size_t size = MeasureCode(code);
+    batch.push_back({code, writer->current_buffer().SubVector(0, size)});
+    writer->Skip(size);
+    total_reserved_code += code->instructions().size();
+    batch_size += code->instructions().size();
+    if (batch_size >= batch_limit) {
+      batches.emplace_back(std::move(batch));
+      batch.clear();
+      batch_size = 0;
+    }
   }
+  if (!batch.empty()) batches.emplace_back(std::move(batch));
+
   // If not a single function was written, serialization was not successful.
-  if (num_turbofan_functions_ == 0) return false;
+  if (batches.empty() && !wrote_deferred_code) return false;
 
   // Make sure that the serialized total code size was correct.
-  CHECK_EQ(total_written_code_, total_code_size);
+  CHECK_EQ(total_reserved_code, total_code_size);
 
+  WriteUnits(std::move(batches));
   WriteTieringBudget(writer);
   return true;
 }
@@ -593,6 +715,18 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
 
   bool Read(Reader* reader);
 
+  // Defer all TurboFan code and keep the records in {file}, which holds the
+  // data passed to {Read}.
+  void KeepDeferredRecordsInFile(
+      std::unique_ptr<base::OS::MemoryMappedFile> file) {
+    mapped_file_ = std::move(file);
+  }
+
+  // Deserializes the single function record {record}, as deferred by
+  // --wasm-lazy-deserialization.
+  WasmCode* ReadDeferredCode(int fn_index, base::Vector<const uint8_t> record,
+                             size_t code_size);
+
   base::Vector<const int> lazy_functions() {
     return base::VectorOf(lazy_functions_);
   }
@@ -607,6 +741,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   void ReadHeader(Reader* reader);
   DeserializationUnit ReadCode(int fn_index, Reader* reader);
   void ReadTieringBudget(Reader* reader);
+  void StoreDeferredRecords();
   void CopyAndRelocate(const DeserializationUnit& unit);
   void Publish(std::vector<DeserializationUnit> batch);
 
@@ -618,6 +753,12 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   // Updated in {ReadCode}.
   size_t remaining_code_size_ = 0;
   bool all_functions_validated_ = false;
+  // Set for --wasm-lazy-deserialization; TurboFan functions are then only
+  // recorded in {deferred_records_} by {ReadCode}.
+  bool defer_code_ = false;
+  std::vector<std::pair<int, base::Vector<const uint8_t>>> deferred_records_;
+  std::vector<size_t> deferred_code_sizes_;
+  std::unique_ptr<base::OS::MemoryMappedFile> mapped_file_;
   base::Vector<uint8_t> current_code_space_;
   NativeModule::JumpTablesRef current_jump_tables_;
   std::vector<int> lazy_functions_;
@@ -688,6 +829,21 @@ class DeserializeCodeTask : public JobTask {
 NativeModuleDeserializer::NativeModuleDeserializer(NativeModule* native_module)
     : native_module_(native_module) {}
 
+WasmCode* NativeModuleDeserializer::ReadDeferredCode(
+    int fn_index, base::Vector<const uint8_t> record, size_t code_size) {
+  DCHECK(!defer_code_);
+  remaining_code_size_ = code_size;
+  Reader reader(record);
+  DeserializationUnit unit = ReadCode(fn_index, &reader);
+  DCHECK_EQ(0, reader.current_size());
+  DCHECK_NOT_NULL(unit.code);
+  CopyAndRelocate(unit);
+  WasmCode* code = native_module_->PublishCode(std::move(unit.code));
+  code->MaybePrint();
+  code->Validate();
+  return code;
+}
+
 bool NativeModuleDeserializer::Read(Reader* reader) {
   DCHECK(!read_called_);
 #ifdef DEBUG
@@ -698,6 +854,21 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   uint32_t total_fns = native_module_->num_functions();
   uint32_t first_wasm_fn = native_module_->num_imported_functions();
 
+  // Lazy deserialization only keeps a copy of the TurboFan code records, and
+  // does the expensive copying and relocation into the code space on the first
+  // call of each function, see {DeserializeFunctionLazily}.
+  if (v8_flags.wasm_lazy_deserialization || mapped_file_) {
+    defer_code_ = true;
+    for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
+      DeserializationUnit unit = ReadCode(i, reader);
+      DCHECK_NULL(unit.code);
+    }
+    DCHECK_EQ(0, remaining_code_size_);
+    StoreDeferredRecords();
+    ReadTieringBudget(reader);
+    return reader->current_size() == 0;
+  }
+
   if (all_functions_validated_) {
     native_module_->module()->set_all_functions_validated();
   }
@@ -765,6 +936,7 @@ void NativeModuleDeserializer::ReadHeader(Reader* reader) {
 
 DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
                                                        Reader* reader) {
+  const uint8_t* record_start = reader->current_location();
   uint8_t code_kind = reader->Read<uint8_t>();
   if (code_kind == kLazyFunction) {
     lazy_functions_.push_back(fn_index);
@@ -792,6 +964,26 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
 
   DCHECK(IsAligned(code_size, kCodeAlignment));
   DCHECK_GE(remaining_code_size_, code_size);
+
+  DeserializationUnit unit;
+  unit.src_code_buffer = reader->ReadVector<uint8_t>(code_size);
+  auto reloc_info = reader->ReadVector<uint8_t>(reloc_size);
+  auto source_pos = reader->ReadVector<uint8_t>(source_position_size);
+  auto inlining_pos = reader->ReadVector<uint8_t>(inlining_position_size);
+  auto protected_instructions =
+      reader->ReadVector<uint8_t>(protected_instructions_size);
+
+  if (defer_code_) {
+    DCHECK_EQ(ExecutionTier::kTurbofan, tier);
+    remaining_code_size_ -= code_size;
+    size_t record_size = reader->current_location() - record_start;
+    deferred_records_.emplace_back(fn_index,
+                                   base::VectorOf(record_start, record_size));
+    deferred_code_sizes_.push_back(code_size);
+    lazy_functions_.push_back(fn_index);
+    return {};
+  }
+
   if (current_code_space_.size() < static_cast<size_t>(code_size)) {
     // Allocate the next code space. Don't allocate more than 90% of
     // {kMaxCodeSpaceSize}, to leave some space for jump tables.
@@ -804,14 +996,6 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
     CHECK(current_jump_tables_.is_valid());
   }
 
-  DeserializationUnit unit;
-  unit.src_code_buffer = reader->ReadVector<uint8_t>(code_size);
-  auto reloc_info = reader->ReadVector<uint8_t>(reloc_size);
-  auto source_pos = reader->ReadVector<uint8_t>(source_position_size);
-  auto inlining_pos = reader->ReadVector<uint8_t>(inlining_position_size);
-  auto protected_instructions =
-      reader->ReadVector<uint8_t>(protected_instructions_size);
-
   base::Vector<uint8_t> instructions =
       current_code_space_.SubVector(0, code_size);
   current_code_space_ += code_size;
@@ -898,6 +1082,50 @@ void NativeModuleDeserializer::ReadTieringBudget(Reader* reader) {
          size_of_tiering_budget);
 }
 
+void NativeModuleDeserializer::StoreDeferredRecords() {
+  if (deferred_records_.empty()) return;
+  const WasmModule* module = native_module_->module();
+  if (mapped_file_) {
+    // Point into the mapped file instead of copying, so the pages stay shared
+    // with other processes until a function is deserialized.
+    const uint8_t* file_start =
+        static_cast<const uint8_t*>(mapped_file_->memory());
+    std::vector<LazyDeserializationData::Record> records(
+        module->num_declared_functions);
+    for (size_t i = 0; i < deferred_records_.size(); ++i) {
+      const auto& [fn_index, record] = deferred_records_[i];
+      records[declared_function_index(module, fn_index)] = {
+          static_cast<size_t>(record.begin() - file_start), record.size(),
+          deferred_code_sizes_[i]};
+    }
+    native_module_->set_lazy_deserialization_data(
+        std::make_unique<LazyDeserializationData>(std::move(mapped_file_),
+                                                  std::move(records)));
+    return;
+  }
+  // The serialized data is owned by the embedder, so copy the records. This is
+  // a single memcpy per function, much cheaper than allocating code space and
+  // relocating.
+  size_t total_size = 0;
+  for (const auto& [fn_index, record] : deferred_records_) {
+    total_size += record.size();
+  }
+  auto bytes = base::OwnedVector<uint8_t>::NewForOverwrite(total_size);
+  std::vector<LazyDeserializationData::Record> records(
+      module->num_declared_functions);
+  size_t offset = 0;
+  for (size_t i = 0; i < deferred_records_.size(); ++i) {
+    const auto& [fn_index, record] = deferred_records_[i];
+    memcpy(bytes.begin() + offset, record.begin(), record.size());
+    records[declared_function_index(module, fn_index)] = {
+        offset, record.size(), deferred_code_sizes_[i]};
+    offset += record.size();
+  }
+  native_module_->set_lazy_deserialization_data(
+      std::make_unique<LazyDeserializationData>(std::move(bytes),
+                                                std::move(records)));
+}
+
 void NativeModuleDeserializer::Publish(std::vector<DeserializationUnit> batch) {
   DCHECK(!batch.empty());
   std::vector<std::unique_ptr<WasmCode>> codes;
@@ -921,10 +1149,28 @@ bool IsSupportedVersion(base::Vector<const uint8_t> header) {
          0;
 }
 
-MaybeHandle<WasmModuleObject> DeserializeNativeModule(
+WasmCode* DeserializeFunctionLazily(NativeModule* native_module,
+                                    int func_index) {
+  const LazyDeserializationData* data =
+      native_module->lazy_deserialization_data();
+  if (data == nullptr) return nullptr;
+  int declared_index = declared_function_index(native_module->module(),
+                                               func_index);
+  base::Vector<const uint8_t> record = data->GetRecord(declared_index);
+  if (record.empty()) return nullptr;
+  TRACE_EVENT1("v8.wasm", "wasm.DeserializeFunctionLazily", "func_index",
+               func_index);
+  NativeModuleDeserializer deserializer(native_module);
+  return deserializer.ReadDeferredCode(func_index, record,
+                                       data->GetCodeSize(declared_index));
+}
+
+namespace {
+MaybeHandle<WasmModuleObject> DeserializeNativeModuleImpl(
     Isolate* isolate, base::Vector<const uint8_t> data,
     base::Vector<const uint8_t> wire_bytes_vec,
-    base::Vector<const char> source_url) {
+    base::Vector<const char> source_url,
+    std::unique_ptr<base::OS::MemoryMappedFile> mapped_file) {
   if (!IsWasmCodegenAllowed(isolate, isolate->native_context())) return {};
   if (!IsSupportedVersion(data)) return {};
 
@@ -963,6 +1209,9 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     shared_native_module->SetWireBytes(std::move(owned_wire_bytes));
 
     NativeModuleDeserializer deserializer(shared_native_module.get());
+    if (mapped_file) {
+      deserializer.KeepDeferredRecordsInFile(std::move(mapped_file));
+    }
     Reader reader(data + WasmSerializer::kHeaderSize);
     bool error = !deserializer.Read(&reader);
     if (error) {
@@ -989,6 +1238,94 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
   return module_object;
 }
 
+// Code cache files are named `code-wasm-<hash>`, using the same hash as PGO
+// files (see {DumpProfileToFile}). As hashes can collide, the files start with
+// the wire bytes (prefixed by their length), followed by the serialized module.
+base::EmbeddedVector<char, 32> GetCodeCacheFileName(
+    base::Vector<const uint8_t> wire_bytes) {
+  uint32_t hash = static_cast<uint32_t>(GetWireBytesHash(wire_bytes));
+  base::EmbeddedVector<char, 32> filename;
+  SNPrintF(filename, "code-wasm-%08x", hash);
+  return filename;
+}
+}  // namespace
+
+MaybeHandle<WasmModuleObject> DeserializeNativeModule(
+    Isolate* isolate, base::Vector<const uint8_t> data,
+    base::Vector<const uint8_t> wire_bytes_vec,
+    base::Vector<const char> source_url) {
+  return DeserializeNativeModuleImpl(isolate, data, wire_bytes_vec, source_url,
+                                     nullptr);
+}
+
+MaybeHandle<WasmModuleObject> DeserializeNativeModuleFromFile(
+    Isolate* isolate, base::Vector<const uint8_t> wire_bytes) {
+  base::EmbeddedVector<char, 32> filename = GetCodeCacheFileName(wire_bytes);
+  std::unique_ptr<base::OS::MemoryMappedFile> file{
+      base::OS::MemoryMappedFile::open(
+          filename.begin(), base::OS::MemoryMappedFile::FileMode::kReadOnly)};
+  if (!file) return {};
+  base::Vector<const uint8_t> contents{
+      static_cast<const uint8_t*>(file->memory()), file->size()};
+
+  constexpr size_t kLengthSize = sizeof(uint64_t);
+  if (contents.size() < kLengthSize) return {};
+  uint64_t wire_bytes_length =
+      ReadUnalignedValue<uint64_t>(reinterpret_cast<Address>(contents.begin()));
+  if (wire_bytes_length != wire_bytes.size() ||
+      contents.size() - kLengthSize < wire_bytes_length ||
+      memcmp(contents.begin() + kLengthSize, wire_bytes.begin(),
+             wire_bytes.size()) != 0) {
+    return {};
+  }
+  base::Vector<const uint8_t> data =
+      contents.SubVectorFrom(kLengthSize + wire_bytes.size());
+  if (v8_flags.trace_wasm_serialization) {
+    PrintF("Reading code cache file '%s' (%zu bytes)\n", filename.begin(),
+           contents.size());
+  }
+  constexpr base::Vector<const char> kNoSourceUrl;
+  return DeserializeNativeModuleImpl(isolate, data, wire_bytes, kNoSourceUrl,
+                                     std::move(file));
+}
+
+void SerializeNativeModuleToFile(NativeModule* native_module) {
+  base::Vector<const uint8_t> wire_bytes = native_module->wire_bytes();
+  if (wire_bytes.empty()) return;
+  WasmSerializer serializer(native_module);
+  constexpr size_t kLengthSize = sizeof(uint64_t);
+  size_t data_offset = kLengthSize + wire_bytes.size();
+  auto contents = base::OwnedVector<uint8_t>::NewForOverwrite(
+      data_offset + serializer.GetSerializedNativeModuleSize());
+  WriteUnalignedValue<uint64_t>(reinterpret_cast<Address>(contents.begin()),
+                               wire_bytes.size());
+  memcpy(contents.begin() + kLengthSize, wire_bytes.begin(), wire_bytes.size());
+  if (!serializer.SerializeNativeModule(
+          contents.as_vector().SubVectorFrom(data_offset))) {
+    return;
+  }
+
+  // Write to a temporary file and rename that, so processes which still map
+  // an older version of the file are not affected.
+  base::EmbeddedVector<char, 32> filename = GetCodeCacheFileName(wire_bytes);
+  base::EmbeddedVector<char, 48> temp_filename;
+  SNPrintF(temp_filename, "%s.%d", filename.begin(),
+           base::OS::GetCurrentProcessId());
+  FILE* file = base::OS::FOpen(temp_filename.begin(), "wb");
+  if (!file) return;
+  size_t written = fwrite(contents.begin(), 1, contents.size(), file);
+  base::Fclose(file);
+  if (written != contents.size() ||
+      std::rename(temp_filename.begin(), filename.begin()) != 0) {
+    base::OS::Remove(temp_filename.begin());
+    return;
+  }
+  if (v8_flags.trace_wasm_serialization) {
+    PrintF("Wrote code cache file '%s' (%zu bytes)\n", filename.begin(),
+           contents.size());
+  }
+}
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -9,6 +9,7 @@
 #ifndef V8_WASM_WASM_SERIALIZATION_H_
 #define V8_WASM_WASM_SERIALIZATION_H_
 
+#include "src/base/platform/platform.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-objects.h"
 
@@ -53,6 +54,60 @@ class V8_EXPORT_PRIVATE WasmSerializer {
   std::vector<WellKnownImport> import_statuses_;
 };
 
+// The serialized TurboFan code of the functions of a {NativeModule} that were
+// not deserialized yet, see --wasm-lazy-deserialization. The records are in
+// the same format as in the serialized module, so they can be written out
+// verbatim when the module gets serialized again.
+class LazyDeserializationData {
+ public:
+  struct Record {
+    size_t offset = 0;
+    size_t size = 0;
+    size_t code_size = 0;
+  };
+
+  LazyDeserializationData(base::OwnedVector<uint8_t> bytes,
+                          std::vector<Record> records)
+      : owned_bytes_(std::move(bytes)),
+        bytes_(owned_bytes_.as_vector()),
+        records_(std::move(records)) {}
+  // Keeps the records in the read-only mapping of a code cache file (see
+  // --experimental-wasm-code-cache-files), which other processes can share.
+  LazyDeserializationData(std::unique_ptr<base::OS::MemoryMappedFile> file,
+                          std::vector<Record> records)
+      : file_(std::move(file)),
+        bytes_(static_cast<const uint8_t*>(file_->memory()), file_->size()),
+        records_(std::move(records)) {}
+  LazyDeserializationData(const LazyDeserializationData&) = delete;
+  LazyDeserializationData& operator=(const LazyDeserializationData&) = delete;
+
+  // Returns the serialized code of the declared function {declared_index}, or
+  // an empty vector if it was deserialized eagerly or not serialized at all.
+  base::Vector<const uint8_t> GetRecord(int declared_index) const {
+    const Record& record = records_[declared_index];
+    return bytes_.SubVector(record.offset, record.offset + record.size);
+  }
+
+  // Returns the size of the instructions in the record of {declared_index}.
+  size_t GetCodeSize(int declared_index) const {
+    return records_[declared_index].code_size;
+  }
+
+  bool is_mapped_from_file() const { return file_ != nullptr; }
+
+ private:
+  const base::OwnedVector<uint8_t> owned_bytes_;
+  const std::unique_ptr<base::OS::MemoryMappedFile> file_;
+  const base::Vector<const uint8_t> bytes_;
+  // Indexed by declared function index.
+  const std::vector<Record> records_;
+};
+
+// Copies and relocates the deferred code of {func_index}, if there is any,
+// and publishes it. Returns nullptr if there was nothing to deserialize.
+// Must be called within a {WasmCodeRefScope}.
+WasmCode* DeserializeFunctionLazily(NativeModule*, int func_index);
+
 // Support for deserializing WebAssembly {NativeModule} objects.
 // Checks the version header of the data against the current version.
 bool IsSupportedVersion(base::Vector<const uint8_t> data);
@@ -63,6 +118,15 @@ V8_EXPORT_PRIVATE MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     base::Vector<const uint8_t> wire_bytes,
     base::Vector<const char> source_url);
 
+// Support for --experimental-wasm-code-cache-files: Modules are serialized to
+// files named `code-wasm-<hash>` in the current directory when their
+// {NativeModule} dies, and later compilations of the same wire bytes in any
+// process map that file read-only instead of compiling. Only the code of
+// functions that actually get called is then copied out of the mapping.
+V8_EXPORT_PRIVATE MaybeHandle<WasmModuleObject> DeserializeNativeModuleFromFile(
+    Isolate*, base::Vector<const uint8_t> wire_bytes);
+V8_EXPORT_PRIVATE void SerializeNativeModuleToFile(NativeModule*);
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -21,6 +21,20 @@ const char* WellKnownImportName(WellKnownImport wki) {
       return "DoubleToString";
     case WellKnownImport::kIntToString:
       return "IntToString";
+    case WellKnownImport::kMathF64Abs:
+      return "Math.abs";
+    case WellKnownImport::kMathF64Ceil:
+      return "Math.ceil";
+    case WellKnownImport::kMathF64Floor:
+      return "Math.floor";
+    case WellKnownImport::kMathF64Max:
+      return "Math.max";
+    case WellKnownImport::kMathF64Min:
+      return "Math.min";
+    case WellKnownImport::kMathF64Sqrt:
+      return "Math.sqrt";
+    case WellKnownImport::kMathF64Trunc:
+      return "Math.trunc";
     case WellKnownImport::kParseFloat:
       return "ParseFloat";
     case WellKnownImport::kStringCharCodeAt:
@@ -26,6 +26,13 @@ enum class WellKnownImport : uint8_t {
   // Functions:
   kDoubleToString,
   kIntToString,
+  kMathF64Abs,
+  kMathF64Ceil,
+  kMathF64Floor,
+  kMathF64Max,
+  kMathF64Min,
+  kMathF64Sqrt,
+  kMathF64Trunc,
   kParseFloat,
   kStringCharCodeAt,
   kStringCodePointAt,
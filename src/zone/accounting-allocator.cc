@@ -4,11 +4,14 @@
 
 #include "src/zone/accounting-allocator.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "src/base/bounded-page-allocator.h"
+#include "src/base/bits.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -67,7 +70,8 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
 }  // namespace
 
 AccountingAllocator::AccountingAllocator()
-    : zone_backing_malloc_(
+    : max_pooled_memory_usage_(v8_flags.zone_segment_pool_size),
+      zone_backing_malloc_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetMallocFn()),
       zone_backing_free_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetFreeFn()) {
@@ -80,10 +84,16 @@ AccountingAllocator::AccountingAllocator()
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
+  if (!(COMPRESS_ZONES_BOOL && supports_compression)) {
+    if (Segment* segment = TryTakePooledSegment(bytes)) {
+      IncreaseMemoryUsage(segment->total_size());
+      return segment;
+    }
+  }
   void* memory;
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     bytes = RoundUp(bytes, kZonePageSize);
@@ -97,6 +107,12 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
   }
   if (memory == nullptr) return nullptr;
 
+  IncreaseMemoryUsage(bytes);
+  DCHECK_LE(sizeof(Segment), bytes);
+  return new (memory) Segment(bytes);
+}
+
+void AccountingAllocator::IncreaseMemoryUsage(size_t bytes) {
   size_t current =
       current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
   size_t max = max_memory_usage_.load(std::memory_order_relaxed);
@@ -104,15 +120,84 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                               max, current, std::memory_order_relaxed)) {
     // {max} was updated by {compare_exchange_weak}; retry.
   }
-  DCHECK_LE(sizeof(Segment), bytes);
-  return new (memory) Segment(bytes);
 }
 
 void AccountingAllocator::ReturnSegment(Segment* segment,
                                         bool supports_compression) {
   segment->ZapContents();
+  current_memory_usage_.fetch_sub(segment->total_size(),
+                                  std::memory_order_relaxed);
+  if (!(COMPRESS_ZONES_BOOL && supports_compression) &&
+      TryPoolSegment(segment)) {
+    return;
+  }
+  FreeSegment(segment, supports_compression);
+}
+
+Segment* AccountingAllocator::TryTakePooledSegment(size_t bytes) {
+  if (bytes > (size_t{1} << kMaxPooledSegmentSizeLog2)) return nullptr;
+  // Any segment of the smallest bucket that can hold {bytes} will do.
+  int bucket = std::max(base::bits::WhichPowerOfTwo(
+                            base::bits::RoundUpToPowerOfTwo32(
+                                static_cast<uint32_t>(bytes))),
+                        kMinPooledSegmentSizeLog2) -
+               kMinPooledSegmentSizeLog2;
+  base::MutexGuard guard(&pool_mutex_);
+  Segment* segment = pool_[bucket];
+  if (segment == nullptr) return nullptr;
+  pool_[bucket] = segment->next();
+  segment->set_next(nullptr);
+  pooled_memory_usage_.fetch_sub(segment->total_size(),
+                                 std::memory_order_relaxed);
+  DCHECK_GE(segment->total_size(), bytes);
+  return segment;
+}
+
+bool AccountingAllocator::TryPoolSegment(Segment* segment) {
+  size_t segment_size = segment->total_size();
+  if (segment_size < (size_t{1} << kMinPooledSegmentSizeLog2) ||
+      segment_size >= (size_t{1} << (kMaxPooledSegmentSizeLog2 + 1))) {
+    return false;
+  }
+  // Segments may be larger than requested, so bucket them by the size they
+  // can serve at least.
+  int bucket = base::bits::WhichPowerOfTwo(base::bits::RoundDownToPowerOfTwo32(
+                   static_cast<uint32_t>(segment_size))) -
+               kMinPooledSegmentSizeLog2;
+  base::MutexGuard guard(&pool_mutex_);
+  if (pooled_memory_usage_.load(std::memory_order_relaxed) + segment_size >
+      max_pooled_memory_usage_) {
+    return false;
+  }
+  segment->set_zone(nullptr);
+  segment->set_next(pool_[bucket]);
+  pool_[bucket] = segment;
+  pooled_memory_usage_.fetch_add(segment_size, std::memory_order_relaxed);
+  return true;
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  Segment* segments[kNumberOfPoolBuckets];
+  {
+    base::MutexGuard guard(&pool_mutex_);
+    for (int i = 0; i < kNumberOfPoolBuckets; i++) {
+      segments[i] = pool_[i];
+      pool_[i] = nullptr;
+    }
+    pooled_memory_usage_.store(0, std::memory_order_relaxed);
+  }
+  for (Segment* segment : segments) {
+    while (segment != nullptr) {
+      Segment* next = segment->next();
+      FreeSegment(segment, false);
+      segment = next;
+    }
+  }
+}
+
+void AccountingAllocator::FreeSegment(Segment* segment,
+                                      bool supports_compression) {
   size_t segment_size = segment->total_size();
-  current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
   segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
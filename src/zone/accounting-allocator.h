@@ -10,6 +10,7 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -46,6 +47,15 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Returns the size of the segments kept for reuse, which are not included in
+  // GetCurrentMemoryUsage().
+  size_t GetPooledMemoryUsage() const {
+    return pooled_memory_usage_.load(std::memory_order_relaxed);
+  }
+
+  // Frees all segments kept for reuse, e.g. under memory pressure.
+  void ReleasePooledSegments();
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,8 +77,28 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Returned segments of up to 2^kMaxPooledSegmentSizeLog2 bytes are kept in
+  // per-size buckets, bounded by --zone-segment-pool-size, instead of being
+  // freed. This avoids much of the allocation churn of the short-lived zones
+  // of compilation jobs. Bucket i holds segments of at least
+  // 2^(kMinPooledSegmentSizeLog2 + i) bytes.
+  static constexpr int kMinPooledSegmentSizeLog2 = 13;  // 8 KB
+  static constexpr int kMaxPooledSegmentSizeLog2 = 18;  // 256 KB
+  static constexpr int kNumberOfPoolBuckets =
+      kMaxPooledSegmentSizeLog2 - kMinPooledSegmentSizeLog2 + 1;
+
+  Segment* TryTakePooledSegment(size_t bytes);
+  bool TryPoolSegment(Segment* segment);
+  void FreeSegment(Segment* segment, bool supports_compression);
+  void IncreaseMemoryUsage(size_t bytes);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
+  std::atomic<size_t> pooled_memory_usage_{0};
+
+  base::Mutex pool_mutex_;
+  Segment* pool_[kNumberOfPoolBuckets] = {};
+  const size_t max_pooled_memory_usage_;
 
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
@@ -469,6 +469,13 @@ class ZoneVector {
     T* old_end = end_;
     size_t old_size = size();
     size_t new_capacity = NewCapacity(minimum);
+    // Vectors that are grown right after their last allocation don't leave
+    // their old buffer behind in the zone.
+    if (old_data && zone_->TryGrowArrayInPlace(old_data, capacity(),
+                                               new_capacity)) {
+      capacity_ = data_ + new_capacity;
+      return;
+    }
     data_ = zone_->AllocateArray<T>(new_capacity);
     end_ = data_ + old_size;
     if (old_data) {
@@ -80,8 +80,8 @@ class V8_EXPORT_PRIVATE Zone final {
 #endif  // V8_USE_ADDRESS_SANITIZER
   }
 
-  // Return 'size' bytes of memory back to Zone. These bytes can be reused
-  // for following allocations.
+  // Return 'size' bytes of memory back to Zone. These bytes are only reused
+  // for following allocations if they were the last ones allocated.
   //
   // When V8_ENABLE_PRECISE_ZONE_STATS is defined, the deallocated bytes are
   // associated with the provided TypeTag type.
@@ -101,6 +101,42 @@ class V8_EXPORT_PRIVATE Zone final {
     static const unsigned char kZapDeadByte = 0xcd;
     memset(pointer, kZapDeadByte, size);
 #endif
+
+#ifndef V8_USE_ADDRESS_SANITIZER
+    Address start = reinterpret_cast<Address>(pointer);
+    if (start + size == position_) position_ = start;
+#endif
+  }
+
+  // Grows the 'old_size' bytes at 'pointer' to 'new_size' bytes without
+  // moving them. This only succeeds if they were the last bytes allocated and
+  // the current segment has enough space left, otherwise returns false and
+  // the caller needs to allocate new memory instead.
+  //
+  // When V8_ENABLE_PRECISE_ZONE_STATS is defined, the additionally allocated
+  // bytes are associated with the provided TypeTag type.
+  template <typename TypeTag = void>
+  bool TryGrowInPlace(void* pointer, size_t old_size, size_t new_size) {
+    DCHECK_NOT_NULL(pointer);
+    DCHECK_LT(old_size, new_size);
+#ifdef V8_USE_ADDRESS_SANITIZER
+    return false;
+#else
+    old_size = RoundUp(old_size, kAlignmentInBytes);
+    new_size = RoundUp(new_size, kAlignmentInBytes);
+    Address start = reinterpret_cast<Address>(pointer);
+    if (start + old_size != position_) return false;
+    size_t size = new_size - old_size;
+    if (size > limit_ - position_) return false;
+#ifdef V8_ENABLE_PRECISE_ZONE_STATS
+    if (V8_UNLIKELY(TracingFlags::is_zone_stats_enabled())) {
+      type_stats_.AddAllocated<TypeTag>(size);
+    }
+    allocation_size_for_tracing_ += size;
+#endif
+    position_ += size;
+    return true;
+#endif  // V8_USE_ADDRESS_SANITIZER
   }
 
   // Allocates memory for T instance and constructs object by calling respective
@@ -129,6 +165,14 @@ class V8_EXPORT_PRIVATE Zone final {
     return static_cast<T*>(Allocate<TypeTag>(length * sizeof(T)));
   }
 
+  // Like TryGrowInPlace, for memory allocated with AllocateArray.
+  template <typename T, typename TypeTag = T[]>
+  bool TryGrowArrayInPlace(T* pointer, size_t old_length, size_t new_length) {
+    DCHECK_LT(new_length, std::numeric_limits<size_t>::max() / sizeof(T));
+    return TryGrowInPlace<TypeTag>(pointer, old_length * sizeof(T),
+                                   new_length * sizeof(T));
+  }
+
   // Allocates a Vector with 'length' uninitialized entries.
   template <typename T, typename TypeTag = T[]>
   base::Vector<T> AllocateVector(size_t length) {
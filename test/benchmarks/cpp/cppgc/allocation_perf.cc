@@ -2,10 +2,14 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <memory>
+#include <vector>
+
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/garbage-collected.h"
 #include "include/cppgc/heap-consistency.h"
 #include "src/base/macros.h"
+#include "src/heap/cppgc/free-list.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap.h"
 #include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
@@ -17,20 +21,67 @@ namespace {
 
 using Allocate = testing::BenchmarkWithHeap;
 
+template <typename T>
+void AllocateLoop(cppgc::Heap& heap, benchmark::State& st) {
+  subtle::NoGarbageCollectionScope no_gc(*Heap::From(&heap));
+  for (auto _ : st) {
+    USE(_);
+    T* result = cppgc::MakeGarbageCollected<T>(heap.GetAllocationHandle());
+    benchmark::DoNotOptimize(result);
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(T));
+}
+
 class TinyObject final : public cppgc::GarbageCollected<TinyObject> {
  public:
   void Trace(cppgc::Visitor*) const {}
 };
 
 BENCHMARK_F(Allocate, Tiny)(benchmark::State& st) {
-  subtle::NoGarbageCollectionScope no_gc(*Heap::From(&heap()));
+  AllocateLoop<TinyObject>(heap(), st);
+}
+
+// Objects of the following sizes are allocated on different normal page
+// spaces, see ObjectAllocator::GetInitialSpaceIndexForSize().
+template <size_t kSize>
+class SizedObject final : public GarbageCollected<SizedObject<kSize>> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+  char padding[kSize];
+};
+
+BENCHMARK_F(Allocate, Small)(benchmark::State& st) {
+  AllocateLoop<SizedObject<40>>(heap(), st);
+}
+
+BENCHMARK_F(Allocate, Medium)(benchmark::State& st) {
+  AllocateLoop<SizedObject<96>>(heap(), st);
+}
+
+BENCHMARK_F(Allocate, Regular)(benchmark::State& st) {
+  AllocateLoop<SizedObject<512>>(heap(), st);
+}
+
+// Refills linear allocation buffers from a fragmented free list, i.e., the
+// allocation slow path taken after sweeping.
+BENCHMARK_F(Allocate, RefillFromFreeList)(benchmark::State& st) {
+  static constexpr size_t kEntrySizes[] = {32, 48, 96, 160, 320, 4096};
+  static constexpr size_t kNumEntries = 1024;
+  std::vector<std::unique_ptr<uint8_t[]>> memory;
+  for (size_t i = 0; i < kNumEntries; ++i) {
+    memory.emplace_back(
+        new uint8_t[kEntrySizes[i % arraysize(kEntrySizes)]]());
+  }
   for (auto _ : st) {
     USE(_);
-    TinyObject* result =
-        cppgc::MakeGarbageCollected<TinyObject>(heap().GetAllocationHandle());
-    benchmark::DoNotOptimize(result);
+    FreeList list;
+    for (size_t i = 0; i < kNumEntries; ++i) {
+      list.Add({memory[i].get(), kEntrySizes[i % arraysize(kEntrySizes)]});
+    }
+    while (list.Allocate(kFreeListEntrySize).address) {
+    }
   }
-  st.SetBytesProcessed(st.iterations() * sizeof(TinyObject));
+  st.SetItemsProcessed(st.iterations() * kNumEntries);
 }
 
 class LargeObject final : public GarbageCollected<LargeObject> {
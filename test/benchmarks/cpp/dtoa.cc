@@ -3,13 +3,17 @@
 // found in the LICENSE file.
 
 #include "src/base/macros.h"
+#include "src/base/numbers/bignum-dtoa.h"
 #include "src/base/numbers/fast-dtoa.h"
+#include "src/base/numbers/ryu-dtoa.h"
 #include "src/base/vector.h"
 #include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
 
+using v8::base::BIGNUM_DTOA_SHORTEST;
 using v8::base::FAST_DTOA_PRECISION;
 using v8::base::FAST_DTOA_SHORTEST;
 using v8::base::kFastDtoaMaximalLength;
+using v8::base::kRyuDtoaMaximalLength;
 using v8::base::Vector;
 
 // This is a dump from a benchmark (MotionMark suits).
@@ -1053,6 +1057,30 @@ static void BM_DtoaShortest(benchmark::State& state) {
   }
 }
 
+// FastDtoa with the BignumDtoa fallback for the inputs it fails on.
+static void BM_DtoaShortestWithFallback(benchmark::State& state) {
+  char output[kFastDtoaMaximalLength + 10];
+  Vector<char> buffer(output, sizeof(output));
+  int length, decimal_point;
+  unsigned idx = 0;
+  for (auto _ : state) {
+    double v = kTestDoubles[idx++ % 4096];
+    if (!FastDtoa(v, FAST_DTOA_SHORTEST, 0, buffer, &length, &decimal_point)) {
+      BignumDtoa(v, BIGNUM_DTOA_SHORTEST, 0, buffer, &length, &decimal_point);
+    }
+  }
+}
+
+static void BM_DtoaShortestRyu(benchmark::State& state) {
+  char output[kRyuDtoaMaximalLength + 10];
+  Vector<char> buffer(output, sizeof(output));
+  int length, decimal_point;
+  unsigned idx = 0;
+  for (auto _ : state) {
+    RyuDtoa(kTestDoubles[idx++ % 4096], buffer, &length, &decimal_point);
+  }
+}
+
 static void BM_DtoaSixDigits(benchmark::State& state) {
   char output[kFastDtoaMaximalLength + 10];
   Vector<char> buffer(output, sizeof(output));
@@ -1066,4 +1094,6 @@ static void BM_DtoaSixDigits(benchmark::State& state) {
 }
 
 BENCHMARK(BM_DtoaShortest);
+BENCHMARK(BM_DtoaShortestWithFallback);
+BENCHMARK(BM_DtoaShortestRyu);
 BENCHMARK(BM_DtoaSixDigits);
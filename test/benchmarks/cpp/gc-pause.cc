@@ -0,0 +1,201 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures GC pause times for a few allocation patterns. V8 flags are taken
+// from the command line, so e.g. Scavenger and MinorMS can be compared with
+//
+//   gc_pause_benchmark
+//   gc_pause_benchmark --minor-ms
+//
+// Pauses are measured between the GC prologue and epilogue callbacks, so
+// incremental marking steps are not included.
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-function.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// The isolate is shared by all benchmarks and never disposed.
+v8::Isolate* GetIsolate() {
+  static v8::Isolate* isolate = [] {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator =
+        v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+    return v8::Isolate::New(create_params);
+  }();
+  return isolate;
+}
+
+enum class Mix { kShortLived, kLargeArrays, kRetainedCache, kArrayBuffers };
+
+// Each script defines a |step| function which allocates a few megabytes.
+const char* GetScript(Mix mix) {
+  switch (mix) {
+    case Mix::kShortLived:
+      return R"(
+        let sink;
+        function step() {
+          for (let i = 0; i < 20000; i++) sink = {a: i, b: [i, i + 1]};
+        })";
+    case Mix::kLargeArrays:
+      return R"(
+        let sink;
+        function step() {
+          for (let i = 0; i < 4; i++) sink = new Array(200000).fill(i + 0.5);
+        })";
+    case Mix::kRetainedCache:
+      return R"(
+        const kCacheSize = 100000;
+        let cache = new Array(kCacheSize);
+        let next = 0;
+        function step() {
+          for (let i = 0; i < 10000; i++, next++) {
+            cache[next % kCacheSize] = {key: 'k' + next, value: [next]};
+          }
+        })";
+    case Mix::kArrayBuffers:
+      return R"(
+        let buffers = new Array(256);
+        let next = 0;
+        function step() {
+          for (let i = 0; i < 32; i++, next++) {
+            buffers[next % buffers.length] = new ArrayBuffer(64 * 1024);
+          }
+        })";
+  }
+}
+
+// Records the duration of every young and full generation GC pause.
+class PauseRecorder {
+ public:
+  explicit PauseRecorder(v8::Isolate* isolate) : isolate_(isolate) {
+    isolate_->AddGCPrologueCallback(Prologue, this, kGCTypes);
+    isolate_->AddGCEpilogueCallback(Epilogue, this, kGCTypes);
+  }
+  ~PauseRecorder() {
+    isolate_->RemoveGCPrologueCallback(Prologue, this);
+    isolate_->RemoveGCEpilogueCallback(Epilogue, this);
+  }
+
+  void Report(benchmark::State& state) {
+    Report(state, "young", &young_pauses_);
+    Report(state, "full", &full_pauses_);
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr v8::GCType kGCTypes = static_cast<v8::GCType>(
+      v8::kGCTypeScavenge | v8::kGCTypeMinorMarkSweep |
+      v8::kGCTypeMarkSweepCompact);
+
+  static bool IsYoung(v8::GCType type) {
+    return type != v8::kGCTypeMarkSweepCompact;
+  }
+
+  static void Prologue(v8::Isolate*, v8::GCType type, v8::GCCallbackFlags,
+                       void* data) {
+    auto* recorder = static_cast<PauseRecorder*>(data);
+    (IsYoung(type) ? recorder->young_start_ : recorder->full_start_) =
+        Clock::now();
+  }
+
+  static void Epilogue(v8::Isolate*, v8::GCType type, v8::GCCallbackFlags,
+                       void* data) {
+    auto* recorder = static_cast<PauseRecorder*>(data);
+    bool young = IsYoung(type);
+    Clock::duration pause =
+        Clock::now() - (young ? recorder->young_start_ : recorder->full_start_);
+    (young ? recorder->young_pauses_ : recorder->full_pauses_)
+        .push_back(std::chrono::duration<double, std::micro>(pause).count());
+  }
+
+  static void Report(benchmark::State& state, const char* name,
+                     std::vector<double>* pauses) {
+    std::string prefix(name);
+    state.counters[prefix + "_gcs"] = static_cast<double>(pauses->size());
+    if (pauses->empty()) return;
+    std::sort(pauses->begin(), pauses->end());
+    auto percentile = [pauses](double p) {
+      size_t index = static_cast<size_t>(p * pauses->size());
+      return (*pauses)[std::min(index, pauses->size() - 1)];
+    };
+    state.counters[prefix + "_p50_us"] = percentile(0.5);
+    state.counters[prefix + "_p99_us"] = percentile(0.99);
+    state.counters[prefix + "_p999_us"] = percentile(0.999);
+    state.counters[prefix + "_max_us"] = pauses->back();
+  }
+
+  v8::Isolate* const isolate_;
+  Clock::time_point young_start_;
+  Clock::time_point full_start_;
+  std::vector<double> young_pauses_;
+  std::vector<double> full_pauses_;
+};
+
+void GCPause(benchmark::State& state, Mix mix) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+
+  v8::Local<v8::String> source =
+      v8::String::NewFromUtf8(isolate, GetScript(mix)).ToLocalChecked();
+  v8::Script::Compile(context, source)
+      .ToLocalChecked()
+      ->Run(context)
+      .ToLocalChecked();
+  v8::Local<v8::Function> step =
+      context->Global()
+          ->Get(context, v8::String::NewFromUtf8Literal(isolate, "step"))
+          .ToLocalChecked()
+          .As<v8::Function>();
+
+  // Start every benchmark from a clean heap.
+  isolate->LowMemoryNotification();
+  PauseRecorder recorder(isolate);
+  for (auto _ : state) {
+    v8::HandleScope step_scope(isolate);
+    step->Call(context, context->Global(), 0, nullptr).ToLocalChecked();
+  }
+  recorder.Report(state);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(GCPause, ShortLived, Mix::kShortLived);
+BENCHMARK_CAPTURE(GCPause, LargeArrays, Mix::kLargeArrays);
+BENCHMARK_CAPTURE(GCPause, RetainedCache, Mix::kRetainedCache);
+BENCHMARK_CAPTURE(GCPause, ArrayBuffers, Mix::kArrayBuffers);
+
+// Expanded macro BENCHMARK_MAIN() to pass V8 flags before initialization.
+int main(int argc, char** argv) {
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+  // Contents of BENCHMARK_MAIN().
+  {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+  }
+  return 0;
+}
@@ -0,0 +1,210 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Benchmarks for JSON::Parse, JSON::Stringify and ValueSerializer round trips
+// over a few representative payloads. See utf8.cc for String::NewFromUtf8 and
+// String::WriteUtf8.
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-json.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-value-serializer.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// The isolate is shared by all benchmarks and never disposed.
+v8::Isolate* GetIsolate() {
+  static v8::Isolate* isolate = [] {
+    static std::unique_ptr<v8::Platform> platform =
+        v8::platform::NewDefaultPlatform();
+    v8::V8::InitializePlatform(platform.get());
+    v8::V8::Initialize();
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator =
+        v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+    return v8::Isolate::New(create_params);
+  }();
+  return isolate;
+}
+
+v8::Local<v8::Context> GetContext() {
+  static v8::Global<v8::Context> context(GetIsolate(),
+                                         v8::Context::New(GetIsolate()));
+  return context.Get(GetIsolate());
+}
+
+enum class Payload { kApiResponse, kNestedConfig, kNumericArray };
+
+// Returns a script evaluating to the payload.
+const char* GetPayloadScript(Payload payload) {
+  switch (payload) {
+    case Payload::kApiResponse:
+      // A page of a typical REST response.
+      return R"(({
+        total: 2500,
+        next: 'https://example.com/api/v1/items?page=2&per_page=100',
+        items: Array.from({length: 100}, (_, i) => ({
+          id: 1000 + i,
+          name: 'Item number ' + i,
+          description: 'A short description of item ' + i + '.',
+          price: i * 1.25,
+          active: i % 3 != 0,
+          tags: ['alpha', 'beta', 'tag' + (i % 7)],
+          owner: {id: i * 7, login: 'user' + i, verified: true},
+          created: '2023-06-01T12:00:00.000Z',
+        })),
+      }))";
+    case Payload::kNestedConfig:
+      // A deeply nested tree of small objects.
+      return R"((function make(depth) {
+        let node = {enabled: true, weight: depth / 10, name: 'n' + depth};
+        if (depth > 0) {
+          node.children = [make(depth - 1), make(depth - 1), make(depth - 1)];
+        }
+        return node;
+      })(7))";
+    case Payload::kNumericArray:
+      return "Array.from({length: 10000}, (_, i) => i * 0.5 + Math.sin(i))";
+  }
+}
+
+v8::Local<v8::Value> MakePayload(Payload payload) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Local<v8::Context> context = GetContext();
+  v8::Local<v8::String> source =
+      v8::String::NewFromUtf8(isolate, GetPayloadScript(payload))
+          .ToLocalChecked();
+  return v8::Script::Compile(context, source)
+      .ToLocalChecked()
+      ->Run(context)
+      .ToLocalChecked();
+}
+
+std::string ToStdString(v8::Isolate* isolate, v8::Local<v8::String> string) {
+  std::string result(string->Utf8Length(isolate), '\0');
+  string->WriteUtf8(isolate, result.data(), static_cast<int>(result.size()));
+  return result;
+}
+
+void JsonParse(benchmark::State& state, Payload payload) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = GetContext();
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::String> json =
+      v8::JSON::Stringify(context, MakePayload(payload)).ToLocalChecked();
+  for (auto _ : state) {
+    v8::HandleScope iteration_scope(isolate);
+    v8::Local<v8::Value> value =
+        v8::JSON::Parse(context, json).ToLocalChecked();
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetBytesProcessed(state.iterations() * json->Length());
+}
+
+void JsonParseUtf8(benchmark::State& state, Payload payload) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = GetContext();
+  v8::Context::Scope context_scope(context);
+  std::string json = ToStdString(
+      isolate,
+      v8::JSON::Stringify(context, MakePayload(payload)).ToLocalChecked());
+  for (auto _ : state) {
+    v8::HandleScope iteration_scope(isolate);
+    v8::Local<v8::Value> value =
+        v8::JSON::Parse(context, json.data(), json.size()).ToLocalChecked();
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+void JsonStringify(benchmark::State& state, Payload payload) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = GetContext();
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::Value> value = MakePayload(payload);
+  size_t length = 0;
+  for (auto _ : state) {
+    v8::HandleScope iteration_scope(isolate);
+    v8::Local<v8::String> json =
+        v8::JSON::Stringify(context, value).ToLocalChecked();
+    length = json->Length();
+    benchmark::DoNotOptimize(json);
+  }
+  state.SetBytesProcessed(state.iterations() * length);
+}
+
+void Serialize(benchmark::State& state, Payload payload) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = GetContext();
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::Value> value = MakePayload(payload);
+  size_t size = 0;
+  for (auto _ : state) {
+    v8::ValueSerializer serializer(isolate);
+    serializer.WriteHeader();
+    serializer.WriteValue(context, value).Check();
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    size = buffer.second;
+    free(buffer.first);
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+
+void Deserialize(benchmark::State& state, Payload payload) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = GetContext();
+  v8::Context::Scope context_scope(context);
+  v8::ValueSerializer serializer(isolate);
+  serializer.WriteHeader();
+  serializer.WriteValue(context, MakePayload(payload)).Check();
+  std::pair<uint8_t*, size_t> buffer = serializer.Release();
+  for (auto _ : state) {
+    v8::HandleScope iteration_scope(isolate);
+    v8::ValueDeserializer deserializer(isolate, buffer.first, buffer.second);
+    deserializer.ReadHeader(context).Check();
+    v8::Local<v8::Value> value =
+        deserializer.ReadValue(context).ToLocalChecked();
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetBytesProcessed(state.iterations() * buffer.second);
+  free(buffer.first);
+}
+
+}  // namespace
+
+#define SERIALIZATION_BENCHMARKS(Name)                       \
+  BENCHMARK_CAPTURE(JsonParse, Name, Payload::k##Name);      \
+  BENCHMARK_CAPTURE(JsonParseUtf8, Name, Payload::k##Name);  \
+  BENCHMARK_CAPTURE(JsonStringify, Name, Payload::k##Name);  \
+  BENCHMARK_CAPTURE(Serialize, Name, Payload::k##Name);      \
+  BENCHMARK_CAPTURE(Deserialize, Name, Payload::k##Name);
+
+SERIALIZATION_BENCHMARKS(ApiResponse)
+SERIALIZATION_BENCHMARKS(NestedConfig)
+SERIALIZATION_BENCHMARKS(NumericArray)
+
+#undef SERIALIZATION_BENCHMARKS
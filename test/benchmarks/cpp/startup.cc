@@ -0,0 +1,185 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the phases of starting up V8 and running the first script:
+//
+//  - IsolateNew: Isolate::New, which deserializes the startup snapshot.
+//  - ContextNew: Context::New, which deserializes the context snapshot.
+//  - CodeCacheConsume: compiling a script from a code cache.
+//  - FirstCall: compiling, running and calling a script in a fresh context.
+//
+// V8 flags are taken from the command line. With --runtime-call-stats, the
+// runtime call stats are printed after each benchmark (and whenever an isolate
+// is disposed). Use --benchmark_format=json for machine readable output.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-function.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+v8::Isolate::CreateParams GetCreateParams() {
+  static v8::ArrayBuffer::Allocator* allocator =
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator;
+  return create_params;
+}
+
+// The isolate is shared by all benchmarks but IsolateNew and never disposed.
+v8::Isolate* GetIsolate() {
+  static v8::Isolate* isolate = v8::Isolate::New(GetCreateParams());
+  return isolate;
+}
+
+// Returns a script with |functions| small functions and a call to the first
+// of them. The script ends in a comment of fixed width, so that scripts with
+// different |tag|s have the same length and can share a code cache.
+std::string MakeScript(int functions, int tag) {
+  std::string script;
+  for (int i = 0; i < functions; i++) {
+    std::string name = "f" + std::to_string(i);
+    script += "function " + name + "(a, b) {\n" +
+              "  let result = [];\n"
+              "  for (let i = 0; i < a; i++) result.push({i, b, s: 'x' + i});\n"
+              "  return result.length;\n"
+              "}\n";
+  }
+  script += "f0(10, 'y');\n";
+  char comment[16];
+  snprintf(comment, sizeof(comment), "// %08d\n", tag);
+  return script + comment;
+}
+
+v8::Local<v8::String> ToV8String(v8::Isolate* isolate,
+                                 const std::string& string) {
+  return v8::String::NewFromUtf8(isolate, string.data(),
+                                 v8::NewStringType::kNormal,
+                                 static_cast<int>(string.size()))
+      .ToLocalChecked();
+}
+
+void IsolateNew(benchmark::State& state) {
+  for (auto _ : state) {
+    v8::Isolate* isolate = v8::Isolate::New(GetCreateParams());
+    state.PauseTiming();
+    isolate->Dispose();
+    state.ResumeTiming();
+  }
+}
+
+void ContextNew(benchmark::State& state) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  for (auto _ : state) {
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    benchmark::DoNotOptimize(context);
+  }
+  isolate->DumpAndResetStats();
+}
+
+void CodeCacheConsume(benchmark::State& state) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  int functions = static_cast<int>(state.range(0));
+
+  // Produce the cache after running the script, so that it also contains the
+  // lazily compiled function that was called.
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache;
+  {
+    v8::ScriptCompiler::Source source(
+        ToV8String(isolate, MakeScript(functions, 0)));
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(context, &source).ToLocalChecked();
+    script->Run(context).ToLocalChecked();
+    cache.reset(
+        v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+  }
+
+  // Every iteration uses a new source string, which misses the isolate's
+  // compilation cache and has to be deserialized from the code cache.
+  int tag = 1;
+  for (auto _ : state) {
+    state.PauseTiming();
+    v8::HandleScope iteration_scope(isolate);
+    v8::Local<v8::String> source_string =
+        ToV8String(isolate, MakeScript(functions, tag++));
+    state.ResumeTiming();
+    v8::ScriptCompiler::Source source(
+        source_string,
+        new v8::ScriptCompiler::CachedData(
+            cache->data, cache->length,
+            v8::ScriptCompiler::CachedData::BufferNotOwned));
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(context, &source,
+                                    v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    if (source.GetCachedData()->rejected) {
+      state.SkipWithError("The code cache was rejected.");
+      break;
+    }
+    benchmark::DoNotOptimize(script);
+  }
+  state.SetBytesProcessed(state.iterations() * cache->length);
+  isolate->DumpAndResetStats();
+}
+
+void FirstCall(benchmark::State& state) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  int functions = static_cast<int>(state.range(0));
+  int tag = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::String> source_string =
+        ToV8String(isolate, MakeScript(functions, tag++));
+    state.ResumeTiming();
+    v8::Local<v8::Script> script =
+        v8::Script::Compile(context, source_string).ToLocalChecked();
+    script->Run(context).ToLocalChecked();
+    benchmark::DoNotOptimize(script);
+  }
+  isolate->DumpAndResetStats();
+}
+
+}  // namespace
+
+BENCHMARK(IsolateNew);
+BENCHMARK(ContextNew);
+BENCHMARK(CodeCacheConsume)->Range(16, 1024);
+BENCHMARK(FirstCall)->Range(16, 1024);
+
+// Expanded macro BENCHMARK_MAIN() to pass V8 flags before initialization.
+int main(int argc, char** argv) {
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+  // Contents of BENCHMARK_MAIN().
+  {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+  }
+  return 0;
+}
@@ -0,0 +1,170 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+constexpr int kNumWorkerThreads = 4;
+
+v8::Platform* GetPlatform() {
+  static std::unique_ptr<v8::Platform> platform =
+      v8::platform::NewDefaultPlatform(kNumWorkerThreads);
+  return platform.get();
+}
+
+// Counts finished tasks and their total latency from posting to running.
+class Progress {
+ public:
+  explicit Progress(int64_t expected) : expected_(expected) {}
+
+  void Finish(v8::base::TimeTicks posted) {
+    v8::base::TimeDelta latency = v8::base::TimeTicks::Now() - posted;
+    latency_us_.fetch_add(latency.InMicroseconds(), std::memory_order_relaxed);
+    if (finished_.fetch_add(1, std::memory_order_acq_rel) + 1 == expected_) {
+      done_.Signal();
+    }
+  }
+
+  void Wait() { done_.Wait(); }
+  int64_t latency_us() const { return latency_us_.load(); }
+
+ private:
+  const int64_t expected_;
+  std::atomic<int64_t> finished_{0};
+  std::atomic<int64_t> latency_us_{0};
+  v8::base::Semaphore done_{0};
+};
+
+// Posts {fan_out} tasks of the next level from the worker thread it runs on.
+class TreeTask : public v8::Task {
+ public:
+  TreeTask(Progress* progress, int depth, int fan_out)
+      : progress_(progress),
+        depth_(depth),
+        fan_out_(fan_out),
+        posted_(v8::base::TimeTicks::Now()) {}
+
+  void Run() override {
+    if (depth_ > 0) {
+      for (int i = 0; i < fan_out_; ++i) {
+        GetPlatform()->CallOnWorkerThread(
+            std::make_unique<TreeTask>(progress_, depth_ - 1, fan_out_));
+      }
+    }
+    progress_->Finish(posted_);
+  }
+
+ private:
+  Progress* const progress_;
+  const int depth_;
+  const int fan_out_;
+  const v8::base::TimeTicks posted_;
+};
+
+class ItemsJob : public v8::JobTask {
+ public:
+  ItemsJob(Progress* progress, int64_t num_items)
+      : progress_(progress),
+        remaining_items_(num_items),
+        posted_(v8::base::TimeTicks::Now()) {}
+
+  void Run(v8::JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      if (remaining_items_.fetch_sub(1, std::memory_order_relaxed) <= 0) {
+        return;
+      }
+      progress_->Finish(posted_);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    int64_t remaining = remaining_items_.load(std::memory_order_relaxed);
+    return static_cast<size_t>(std::max<int64_t>(0, remaining));
+  }
+
+ private:
+  Progress* const progress_;
+  std::atomic<int64_t> remaining_items_;
+  const v8::base::TimeTicks posted_;
+};
+
+void ReportLatency(benchmark::State& state, int64_t tasks,
+                   int64_t latency_us) {
+  state.SetItemsProcessed(tasks);
+  state.counters["latency_us"] =
+      benchmark::Counter(static_cast<double>(latency_us) / tasks);
+}
+
+// Posts all tasks from the main thread.
+void PostFromMainThread(benchmark::State& state) {
+  const int64_t num_tasks = state.range(0);
+  int64_t total_tasks = 0;
+  int64_t total_latency_us = 0;
+  for (auto _ : state) {
+    Progress progress(num_tasks);
+    for (int64_t i = 0; i < num_tasks; ++i) {
+      GetPlatform()->CallOnWorkerThread(
+          std::make_unique<TreeTask>(&progress, 0, 0));
+    }
+    progress.Wait();
+    total_tasks += num_tasks;
+    total_latency_us += progress.latency_us();
+  }
+  ReportLatency(state, total_tasks, total_latency_us);
+}
+
+// Starts a tree of tasks in which every task posts {fan_out} more from its
+// worker thread.
+void PostFromWorkerThreads(benchmark::State& state) {
+  const int depth = static_cast<int>(state.range(0));
+  constexpr int kFanOut = 8;
+  int64_t num_tasks = 0;
+  for (int64_t level = 1, i = 0; i <= depth; ++i, level *= kFanOut) {
+    num_tasks += level;
+  }
+  int64_t total_tasks = 0;
+  int64_t total_latency_us = 0;
+  for (auto _ : state) {
+    Progress progress(num_tasks);
+    GetPlatform()->CallOnWorkerThread(
+        std::make_unique<TreeTask>(&progress, depth, kFanOut));
+    progress.Wait();
+    total_tasks += num_tasks;
+    total_latency_us += progress.latency_us();
+  }
+  ReportLatency(state, total_tasks, total_latency_us);
+}
+
+// Runs a job whose workers each process one item before checking in again.
+void Job(benchmark::State& state) {
+  const int64_t num_items = state.range(0);
+  int64_t total_items = 0;
+  int64_t total_latency_us = 0;
+  for (auto _ : state) {
+    Progress progress(num_items);
+    GetPlatform()
+        ->PostJob(v8::TaskPriority::kUserVisible,
+                  std::make_unique<ItemsJob>(&progress, num_items))
+        ->Join();
+    progress.Wait();
+    total_items += num_items;
+    total_latency_us += progress.latency_us();
+  }
+  ReportLatency(state, total_items, total_latency_us);
+}
+
+}  // namespace
+
+BENCHMARK(PostFromMainThread)->Range(64, 1 << 16)->UseRealTime();
+BENCHMARK(PostFromWorkerThreads)->DenseRange(2, 5)->UseRealTime();
+BENCHMARK(Job)->Range(64, 1 << 16)->UseRealTime();
@@ -0,0 +1,105 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// The isolate is shared by all benchmarks and never disposed.
+v8::Isolate* GetIsolate() {
+  static v8::Isolate* isolate = [] {
+    static std::unique_ptr<v8::Platform> platform =
+        v8::platform::NewDefaultPlatform();
+    v8::V8::InitializePlatform(platform.get());
+    v8::V8::Initialize();
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator =
+        v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+    return v8::Isolate::New(create_params);
+  }();
+  return isolate;
+}
+
+enum class Text { kAscii, kLatin1, kMixed, kCjk };
+
+// Returns about |length| bytes of UTF-8 text.
+std::string MakeUtf8(Text text, size_t length) {
+  const char* piece = nullptr;
+  switch (text) {
+    case Text::kAscii:
+      piece = "{\"key\": \"The quick brown fox jumps over the lazy dog\"}, ";
+      break;
+    case Text::kLatin1:
+      piece = "Les na\xC3\xAF" "fs \xC3\xA9l\xC3\xA8ves du ch\xC3\xA2teau, ";
+      break;
+    case Text::kMixed:
+      piece =
+          "{\"name\": \"Stra\xC3\x9F"
+          "e \xE2\x82\xAC 5\", \"\xF0\x9F\x98\x80\"}, ";
+      break;
+    case Text::kCjk:
+      piece = "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87, ";
+      break;
+  }
+  std::string result;
+  while (result.size() < length) result += piece;
+  return result;
+}
+
+void NewFromUtf8(benchmark::State& state, Text text) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  std::string utf8 = MakeUtf8(text, state.range(0));
+  for (auto _ : state) {
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::String> string =
+        v8::String::NewFromUtf8(isolate, utf8.data(),
+                                v8::NewStringType::kNormal,
+                                static_cast<int>(utf8.size()))
+            .ToLocalChecked();
+    benchmark::DoNotOptimize(string);
+  }
+  state.SetBytesProcessed(state.iterations() * utf8.size());
+}
+
+void WriteUtf8(benchmark::State& state, Text text) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  std::string utf8 = MakeUtf8(text, state.range(0));
+  v8::Local<v8::String> string =
+      v8::String::NewFromUtf8(isolate, utf8.data(), v8::NewStringType::kNormal,
+                              static_cast<int>(utf8.size()))
+          .ToLocalChecked();
+  std::vector<char> buffer(utf8.size() + 1);
+  for (auto _ : state) {
+    int written = string->WriteUtf8(isolate, buffer.data(),
+                                    static_cast<int>(buffer.size()));
+    benchmark::DoNotOptimize(written);
+  }
+  state.SetBytesProcessed(state.iterations() * utf8.size());
+}
+
+}  // namespace
+
+#define UTF8_BENCHMARKS(Name)                                              \
+  BENCHMARK_CAPTURE(NewFromUtf8, Name, Text::k##Name)->Range(64, 1 << 20); \
+  BENCHMARK_CAPTURE(WriteUtf8, Name, Text::k##Name)->Range(64, 1 << 20);
+
+UTF8_BENCHMARKS(Ascii)
+UTF8_BENCHMARKS(Latin1)
+UTF8_BENCHMARKS(Mixed)
+UTF8_BENCHMARKS(Cjk)
+
+#undef UTF8_BENCHMARKS
@@ -5,6 +5,8 @@
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -36,6 +38,7 @@ int PrintHelp(char** argv) {
   V(kFromString, "fromstring")       \
   V(kFromStringBase2, "fromstring2") \
   V(kKaratsuba, "karatsuba")         \
+  V(kParallel, "parallel")           \
   V(kToom, "toom")                   \
   V(kToString, "tostring")
 
@@ -123,6 +126,23 @@ std::string FormatHex(Digits X) {
   return std::string(result.get(), chars);
 }
 
+// Runs parallel tasks on a few extra threads, the way an embedder would on
+// its worker threads.
+class ThreadsPlatform : public Platform {
+ public:
+  void RunInParallel(ParallelTask* task) override {
+    std::vector<std::thread> workers;
+    for (int i = 0; i < kWorkerThreads; i++) {
+      workers.emplace_back([task]() { task->Run(false); });
+    }
+    task->Run(true);
+    for (std::thread& worker : workers) worker.join();
+  }
+
+ private:
+  static constexpr int kWorkerThreads = 3;
+};
+
 class Runner {
  public:
   Runner() = default;
@@ -204,6 +224,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
       }
+    } else if (test_ == kParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestParallel(&count);
+      }
     } else if (test_ == kToom) {
       for (int i = 0; i < runs_; i++) {
         TestToom(&count);
@@ -311,6 +335,69 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  void TestParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    std::unique_ptr<Processor, Processor::Destroyer> parallel_processor(
+        Processor::New(new ThreadsPlatform()));
+    ProcessorImpl* parallel =
+        static_cast<ProcessorImpl*>(parallel_processor.get());
+    // These inputs are huge, so we test one random sample of each operation.
+    uint64_t random_bits = rng_.NextUint64();
+    int right_size =
+        kFftParallelThreshold / 2 + static_cast<int>(random_bits & 4095);
+    random_bits >>= 12;
+    int left_size = right_size + static_cast<int>(random_bits & 4095);
+    random_bits >>= 12;
+    std::cout << "left " << left_size << " right " << right_size << "\n";
+    ScratchDigits A(left_size);
+    ScratchDigits B(right_size);
+    GenerateRandom(A);
+    GenerateRandom(B);
+    {
+      int result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits result_toom(result_len);
+      parallel->MultiplyFFT(result, A, B);
+      // Using Toom-Cook as reference.
+      processor()->MultiplyToomCook(result_toom, A, B);
+      AssertEquals(A, B, result_toom, result);
+      if (error_) return;
+      (*count)++;
+    }
+    {
+      // Squaring transforms only one input.
+      int result_len = MultiplyResultLength(A, A);
+      ScratchDigits result(result_len);
+      ScratchDigits result_toom(result_len);
+      parallel->MultiplyFFT(result, A, A);
+      processor()->MultiplyToomCook(result_toom, A, A);
+      AssertEquals(A, A, result_toom, result);
+      if (error_) return;
+      (*count)++;
+    }
+    {
+      int size =
+          kToStringParallelThreshold + static_cast<int>(random_bits & 4095);
+      random_bits >>= 12;
+      int radix = 2 + static_cast<int>(random_bits % 35);
+      ScratchDigits X(size);
+      GenerateRandom(X);
+      int chars_required = ToStringResultLength(X, radix, false);
+      int result_len = chars_required;
+      int reference_len = chars_required;
+      std::unique_ptr<char[]> result(new char[result_len]);
+      std::unique_ptr<char[]> reference(new char[reference_len]);
+      parallel->ToStringImpl(result.get(), &result_len, X, radix, false, true);
+      processor()->ToStringImpl(reference.get(), &reference_len, X, radix,
+                                false, false);
+      AssertEquals(X, radix, reference.get(), reference_len, result.get(),
+                   result_len);
+      if (error_) return;
+      (*count)++;
+    }
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr int kMin = kBurnikelThreshold / 2;
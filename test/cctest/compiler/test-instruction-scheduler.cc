@@ -53,6 +53,13 @@ class InstructionSchedulerTester {
              successors.end());
   }
 
+  int64_t estimated_cycles_in_order() const {
+    return scheduler_.estimated_cycles_in_order();
+  }
+  int64_t estimated_cycles_scheduled() const {
+    return scheduler_.estimated_cycles_scheduled();
+  }
+
   Zone* zone() { return scope_.main_zone(); }
 
  private:
@@ -107,6 +114,26 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+TEST(EstimatedCycles) {
+  FlagScope<bool> scheduling_stats(
+      &v8_flags.turbo_instruction_scheduling_stats, true);
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  tester.StartBlock();
+  for (int i = 0; i < 3; i++) {
+    tester.AddInstruction(Instruction::New(zone, kArchNop));
+  }
+  tester.AddTerminator(Instruction::New(zone, kArchRet));
+  tester.EndBlock();
+
+  // The nops are independent, so they are issued back to back in either
+  // order, and the terminator waits for all of them.
+  CHECK_LT(0, tester.estimated_cycles_scheduled());
+  CHECK_EQ(tester.estimated_cycles_in_order(),
+           tester.estimated_cycles_scheduled());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
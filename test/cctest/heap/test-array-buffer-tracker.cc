@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "src/api/api-inl.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
@@ -17,22 +19,22 @@
 namespace {
 
 bool IsTrackedYoung(i::Heap* heap, i::ArrayBufferExtension* extension) {
-  bool in_young = heap->array_buffer_sweeper()->young().ContainsSlow(extension);
-  bool in_old = heap->array_buffer_sweeper()->old().ContainsSlow(extension);
+  bool in_young = heap->array_buffer_sweeper()->ContainsYoungSlow(extension);
+  bool in_old = heap->array_buffer_sweeper()->ContainsOldSlow(extension);
   CHECK(!(in_young && in_old));
   return in_young;
 }
 
 bool IsTrackedOld(i::Heap* heap, i::ArrayBufferExtension* extension) {
-  bool in_young = heap->array_buffer_sweeper()->young().ContainsSlow(extension);
-  bool in_old = heap->array_buffer_sweeper()->old().ContainsSlow(extension);
+  bool in_young = heap->array_buffer_sweeper()->ContainsYoungSlow(extension);
+  bool in_old = heap->array_buffer_sweeper()->ContainsOldSlow(extension);
   CHECK(!(in_young && in_old));
   return in_old;
 }
 
 bool IsTracked(i::Heap* heap, i::ArrayBufferExtension* extension) {
-  bool in_young = heap->array_buffer_sweeper()->young().ContainsSlow(extension);
-  bool in_old = heap->array_buffer_sweeper()->old().ContainsSlow(extension);
+  bool in_young = heap->array_buffer_sweeper()->ContainsYoungSlow(extension);
+  bool in_old = heap->array_buffer_sweeper()->ContainsOldSlow(extension);
   CHECK(!(in_young && in_old));
   return in_young || in_old;
 }
@@ -491,6 +493,49 @@ TEST(ArrayBuffer_ExternalBackingStoreSizeIncreasesMarkCompact) {
   CHECK_EQ(0, backing_store_after - backing_store_before);
 }
 
+TEST(ArrayBuffer_ExtensionSlabs) {
+  v8_flags.concurrent_array_buffer_sweeping = false;
+
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+  i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      CcTest::heap());
+
+  // Span several slabs and keep every other buffer alive.
+  const int kBuffers = 3 * ArrayBufferExtensionSlab::kSlots;
+  std::vector<ArrayBufferExtension*> extensions;
+  {
+    v8::HandleScope handle_scope(isolate);
+    std::vector<v8::Global<v8::ArrayBuffer>> live;
+    for (int i = 0; i < kBuffers; i++) {
+      v8::HandleScope loop_scope(isolate);
+      Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, 100);
+      extensions.push_back(v8::Utils::OpenHandle(*ab)->extension());
+      if (i % 2 == 0) live.emplace_back(isolate, ab);
+    }
+    heap::InvokeAtomicMajorGC(heap);
+    for (int i = 0; i < kBuffers; i++) {
+      CHECK_EQ(i % 2 == 0, IsTracked(heap, extensions[i]));
+      if (i % 2 == 0) CHECK(IsTrackedOld(heap, extensions[i]));
+    }
+    CHECK_EQ(heap->array_buffer_sweeper()->OldBytesSlow(), 100 * live.size());
+
+    // Freed slots are reused by new extensions.
+    v8::HandleScope inner_scope(isolate);
+    Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, 100);
+    ArrayBufferExtension* extension = v8::Utils::OpenHandle(*ab)->extension();
+    CHECK_NE(extensions.end(),
+             std::find(extensions.begin(), extensions.end(), extension));
+  }
+  heap::InvokeAtomicMajorGC(heap);
+  for (ArrayBufferExtension* extension : extensions) {
+    CHECK(!IsTracked(heap, extension));
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
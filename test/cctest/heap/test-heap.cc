@@ -30,6 +30,7 @@
 #include <utility>
 
 #include "include/v8-function.h"
+#include "include/v8-metrics.h"
 #include "src/api/api-inl.h"
 #include "src/base/strings.h"
 #include "src/codegen/assembler-inl.h"
@@ -1208,6 +1209,68 @@ static void TestMultiReferencedBytecodeFlushing(bool sparkplug_compile) {
   }
 }
 
+TEST(TestAdaptiveBytecodeOldAge) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#if ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.flush_code_adaptive_age = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Heap* heap = CcTest::heap();
+  Factory* factory = i_isolate->factory();
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared()->is_compiled());
+
+    // Nothing gets flushed or recompiled, so the age stays put.
+    heap::InvokeMajorGC(heap);
+    CHECK_EQ(v8_flags.bytecode_old_age,
+             static_cast<int>(heap->tracer()->BytecodeOldAge()));
+
+    i::SharedFunctionInfo::EnsureOldForTesting(function->shared());
+    heap::InvokeMajorGC(heap);
+    CHECK(!function->shared()->is_compiled());
+    CHECK(function->shared()->bytecode_was_flushed());
+
+    // Recompiling the function that was just flushed makes the next GC keep
+    // bytecode around for longer.
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+    CHECK(!function->shared()->bytecode_was_flushed());
+    heap::InvokeMajorGC(heap);
+    CHECK_EQ(v8_flags.bytecode_old_age + 1,
+             static_cast<int>(heap->tracer()->BytecodeOldAge()));
+  }
+}
+
 TEST(TestMultiReferencedBytecodeFlushing) {
   TestMultiReferencedBytecodeFlushing(/*sparkplug_compile=*/false);
 }
@@ -4054,6 +4117,38 @@ TEST(DoNotPromoteFillersFromPersistentHandles) {
   TestFillersFromPersistentHandles(true /*promote*/);
 }
 
+TEST(ArrayShiftLeftTrimsElementsOnUnsweptPage) {
+  if (!v8_flags.move_object_start) return;
+  if (v8_flags.stress_incremental_marking) return;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  v8::HandleScope scope(CcTest::isolate());
+
+  v8::Local<v8::Value> result = CompileRun(
+      "var queue = [];"
+      "for (var i = 0; i < 200; i++) queue.push({});"
+      "queue");
+  Handle<JSArray> queue =
+      Handle<JSArray>::cast(v8::Utils::OpenHandle(*result));
+  // Move the elements to old space. They need to end up on a page that is
+  // not swept yet for the test to be meaningful.
+  heap::InvokeMajorGC(heap);
+  heap::InvokeMajorGC(heap);
+  Handle<FixedArrayBase> elements(queue->elements(), isolate);
+  if (!heap->sweeping_in_progress() ||
+      Page::FromHeapObject(*elements)->SweepingDone()) {
+    return;
+  }
+
+  // Shifting sweeps the page instead of moving all remaining elements.
+  Address old_start = elements->address();
+  CompileRun("queue.shift()");
+  CHECK_EQ(old_start + kTaggedSize, queue->elements()->address());
+  CHECK_EQ(Smi::FromInt(199), queue->length());
+}
+
 TEST(IncrementalMarkingStepMakesBigProgressWithLargeObjects) {
   if (!v8_flags.incremental_marking) return;
   ManualGCScope manual_gc_scope;
@@ -7282,6 +7377,89 @@ TEST(LongTaskStatsYoung) {
       v8::metrics::LongTaskStats::Get(isolate).gc_young_wall_clock_duration_us);
 }
 
+TEST(RuntimePretenuringJsonParse) {
+  if (!v8_flags.runtime_pretenuring || v8_flags.single_generation ||
+      v8_flags.gc_global || v8_flags.stress_compaction ||
+      v8_flags.stress_incremental_marking) {
+    return;
+  }
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+
+  // The source is well above --runtime-pretenuring-min-input-kb.
+  CompileRun(
+      "var source = JSON.stringify(new Array(20000).fill({a: 1}));"
+      "var results = [];");
+  // Results that survive their first GC make later results of the same size
+  // class old.
+  for (int i = 0; i < 2; i++) {
+    v8::Local<v8::Value> result =
+        CompileRun("results[results.length] = JSON.parse(source)");
+    CHECK(Heap::InYoungGeneration(*v8::Utils::OpenHandle(*result)));
+    heap::InvokeMinorGC(CcTest::heap());
+  }
+  v8::Local<v8::Value> result = CompileRun("JSON.parse(source)");
+  CHECK(CcTest::heap()->InOldSpace(*v8::Utils::OpenHandle(*result)));
+}
+
+namespace {
+
+class GCCycleRecorder final : public v8::metrics::Recorder {
+ public:
+  void AddMainThreadEvent(const v8::metrics::GarbageCollectionFullCycle& event,
+                          ContextId) final {
+    full_cycles.push_back(event);
+  }
+  void AddMainThreadEvent(const v8::metrics::GarbageCollectionYoungCycle& event,
+                          ContextId) final {
+    young_cycles.push_back(event);
+  }
+
+  std::vector<v8::metrics::GarbageCollectionFullCycle> full_cycles;
+  std::vector<v8::metrics::GarbageCollectionYoungCycle> young_cycles;
+};
+
+}  // namespace
+
+UNINITIALIZED_TEST(MetricsRecorderReportsCycleSizes) {
+  if (v8_flags.single_generation || v8_flags.minor_ms) return;
+  ManualGCScope manual_gc_scope;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+  auto recorder = std::make_shared<GCCycleRecorder>();
+  isolate->SetMetricsRecorder(recorder);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    CompileRun("var retained = new Array(1000).fill({});");
+
+    heap::InvokeMinorGC(heap);
+    CHECK(!recorder->young_cycles.empty());
+    const v8::metrics::GarbageCollectionYoungCycle& young =
+        recorder->young_cycles.back();
+    CHECK_LT(0, young.objects.bytes_before);
+    CHECK_LE(young.objects.bytes_after, young.objects.bytes_before);
+    CHECK_EQ(young.objects.bytes_before - young.objects.bytes_after,
+             young.objects.bytes_freed);
+    CHECK_LE(0, young.promoted_bytes);
+
+    heap::InvokeAtomicMajorGC(heap);
+    heap->EnsureSweepingCompleted(
+        Heap::SweepingForcedFinalizationMode::kV8Only);
+    CHECK(!recorder->full_cycles.empty());
+    const v8::metrics::GarbageCollectionFullCycle& full =
+        recorder->full_cycles.back();
+    CHECK_LT(0, full.objects.bytes_before);
+    CHECK_LE(0, full.objects.bytes_freed);
+    CHECK_LT(0, full.memory.bytes_after);
+  }
+  isolate->Dispose();
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/heap/marking-worklist.h"
 #include "src/heap/memory-measurement-inl.h"
 #include "src/heap/memory-measurement.h"
 #include "src/objects/smi.h"
@@ -77,6 +78,34 @@ TEST(NativeContextStatsMerge) {
   CHECK_EQ(30, stats1.Get(native_context->ptr()));
 }
 
+TEST(NativeContextStatsRuns) {
+  LocalContext env;
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  Handle<NativeContext> native_context = GetNativeContext(isolate, env.local());
+  v8::Local<v8::Value> result = CompileRun("({a : 10})");
+  Handle<HeapObject> object =
+      Handle<HeapObject>::cast(Utils::OpenHandle(*result));
+  const Address context = native_context->ptr();
+  const Address shared = MarkingWorklists::kSharedContext;
+  NativeContextStats stats;
+  stats.IncrementSize(context, object->map(), *object, 10);
+  stats.IncrementSize(context, object->map(), *object, 20);
+  CHECK_EQ(30, stats.Get(context));
+  stats.IncrementSize(shared, object->map(), *object, 5);
+  stats.IncrementSize(context, object->map(), *object, 40);
+  CHECK_EQ(70, stats.Get(context));
+  CHECK_EQ(5, stats.Get(shared));
+  NativeContextStats merged;
+  merged.IncrementSize(shared, object->map(), *object, 1);
+  merged.Merge(stats);
+  CHECK_EQ(70, merged.Get(context));
+  CHECK_EQ(6, merged.Get(shared));
+  stats.Clear();
+  CHECK_EQ(0, stats.Get(context));
+  CHECK_EQ(0, stats.Get(shared));
+}
+
 TEST(NativeContextStatsArrayBuffers) {
   LocalContext env;
   Isolate* isolate = CcTest::i_isolate();
@@ -22,6 +22,7 @@ namespace {
 
 void TestStubCacheOffsetCalculation(StubCache::Table table) {
   Isolate* isolate(CcTest::InitIsolateOnce());
+  StubCache* stub_cache = isolate->load_stub_cache();
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, JSParameterCount(kNumParams));
   AccessorAssembler m(data.state());
@@ -30,13 +31,13 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, map);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name, map);
     }
     m.Return(m.SmiTag(result));
   }
@@ -73,11 +74,11 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
-          expected_result = StubCache::SecondaryOffsetForTesting(*name, *map);
+          expected_result = stub_cache->SecondaryOffsetForTesting(*name, *map);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -159,21 +160,23 @@ TEST(TryProbeStubCache) {
   Factory* factory = isolate->factory();
 
   // Generate some number of names.
-  for (int i = 0; i < StubCache::kPrimaryTableSize / 7; i++) {
+  const int kPrimaryTableSize = stub_cache.primary_table_size();
+  const int kSecondaryTableSize = stub_cache.secondary_table_size();
+  for (int i = 0; i < kPrimaryTableSize / 7; i++) {
     Handle<Name> name;
     switch (rand_gen.NextInt(3)) {
       case 0: {
         // Generate string.
         std::stringstream ss;
         ss << "s" << std::hex
-           << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+           << (rand_gen.NextInt(Smi::kMaxValue) % kPrimaryTableSize);
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
       case 1: {
         // Generate number string.
         std::stringstream ss;
-        ss << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+        ss << (rand_gen.NextInt(Smi::kMaxValue) % kPrimaryTableSize);
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
@@ -189,7 +192,7 @@ TEST(TryProbeStubCache) {
   }
 
   // Generate some number of receiver maps and receivers.
-  for (int i = 0; i < StubCache::kSecondaryTableSize / 2; i++) {
+  for (int i = 0; i < kSecondaryTableSize / 2; i++) {
     Handle<Map> map = Map::Create(isolate, 0);
     receivers.push_back(factory->NewJSObjectFromMap(map));
   }
@@ -204,7 +207,7 @@ TEST(TryProbeStubCache) {
   DisallowGarbageCollection no_gc;
 
   // Populate {stub_cache}.
-  const int N = StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize;
+  const int N = kPrimaryTableSize + kSecondaryTableSize;
   for (int i = 0; i < N; i++) {
     int index = rand_gen.NextInt();
     Handle<Name> name = names[index % names.size()];
@@ -250,5 +253,45 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(StubCacheGrowsOnMisses) {
+  v8_flags.lazy_feedback_allocation = false;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  StubCache* stub_cache = isolate->load_stub_cache();
+  stub_cache->Clear();
+  const int initial_size = stub_cache->primary_table_size();
+
+  // Load kNames properties from kMaps receiver maps through megamorphic
+  // loads, which misses for each of the pairs. Each map has its own first
+  // property, so the number of transitions from the root map stays small.
+  const int kNames = 16;
+  const int kMaps = 2 * initial_size / kNames;
+  std::stringstream source;
+  source << "let objects = [";
+  for (int i = 0; i < kMaps; i++) {
+    source << "{q" << i << ": 0";
+    for (int j = 0; j < kNames; j++) source << ", p" << j << ": 0";
+    source << "},";
+  }
+  source << "];";
+  for (int j = 0; j < kNames; j++) {
+    source << "function load" << j << "(o) { return o.p" << j << "; }";
+  }
+  source << "for (const o of objects) {";
+  for (int j = 0; j < kNames; j++) source << "load" << j << "(o);";
+  source << "}";
+  CompileRun(source.str().c_str());
+  CHECK_LT(static_cast<uint32_t>(initial_size), stub_cache->misses());
+
+  stub_cache->Clear();
+  CHECK_EQ(0u, stub_cache->misses());
+  if (initial_size < (1 << v8_flags.stub_cache_max_primary_table_bits)) {
+    CHECK_EQ(2 * initial_size, stub_cache->primary_table_size());
+  } else {
+    CHECK_EQ(initial_size, stub_cache->primary_table_size());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
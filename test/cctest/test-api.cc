@@ -47,6 +47,7 @@
 #include "include/v8-json.h"
 #include "include/v8-locker.h"
 #include "include/v8-primitive-object.h"
+#include "include/v8-profiler.h"
 #include "include/v8-regexp.h"
 #include "include/v8-util.h"
 #include "src/api/api-inl.h"
@@ -2902,6 +2903,37 @@ THREADED_TEST(InternalFields) {
   CHECK_EQ(17, obj->GetInternalField(0)->Int32Value(env.local()).FromJust());
 }
 
+#ifdef V8_ENABLE_DIRECT_LOCAL
+THREADED_TEST(InternalFieldsWithoutHandles) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  Local<v8::FunctionTemplate> templ = v8::FunctionTemplate::New(isolate);
+  Local<v8::ObjectTemplate> instance_templ = templ->InstanceTemplate();
+  instance_templ->SetInternalFieldCount(2);
+  Local<v8::Object> obj = templ->GetFunction(env.local())
+                              .ToLocalChecked()
+                              ->NewInstance(env.local())
+                              .ToLocalChecked();
+  Local<v8::Number> value = v8_num(17.5);
+  void* pointer = reinterpret_cast<void*>(0x1234560);
+
+  // With direct locals, accessing the internal fields of a wrapper doesn't
+  // create any handles.
+  int handles = v8::HandleScope::NumberOfHandles(isolate);
+  CHECK_EQ(2, obj->InternalFieldCount());
+  CHECK(obj->IsApiWrapper());
+  obj->SetInternalField(0, value);
+  Local<v8::Value> field = obj->GetInternalField(0);
+  CHECK_EQ(17.5, field->NumberValue(env.local()).FromJust());
+  CHECK_EQ(17, field->Int32Value(env.local()).FromJust());
+  obj->SetAlignedPointerInInternalField(1, pointer);
+  CHECK_EQ(pointer, obj->GetAlignedPointerFromInternalField(1));
+  CHECK_EQ(handles, v8::HandleScope::NumberOfHandles(isolate));
+}
+#endif  // V8_ENABLE_DIRECT_LOCAL
+
 TEST(InternalFieldsSubclassing) {
   LocalContext env;
   v8::Isolate* isolate = env->GetIsolate();
@@ -8485,6 +8517,51 @@ THREADED_TEST(StringWrite) {
   CHECK_EQ(0, str->Write(isolate, nullptr, 0, 0, String::NO_NULL_TERMINATION));
 }
 
+THREADED_TEST(Utf8RoundTripWithAsciiRuns) {
+  // Runs of ASCII characters are copied in bulk by the UTF-8 encoder and
+  // decoder. Interleave them with multi-byte sequences and lone surrogates.
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  const char* const kNonAscii[] = {"\xC3\xA9", "\xE2\x82\xAC",
+                                   "\xF0\x9F\x98\x80"};
+  for (int run = 0; run < 40; run++) {
+    for (const char* non_ascii : kNonAscii) {
+      std::string utf8;
+      for (int i = 0; i < 3; i++) {
+        utf8.append(run, 'a' + i);
+        utf8.append(non_ascii);
+      }
+      utf8.append(run, 'z');
+      Local<String> str =
+          String::NewFromUtf8(isolate, utf8.data(), v8::NewStringType::kNormal,
+                              static_cast<int>(utf8.size()))
+              .ToLocalChecked();
+      CHECK_EQ(static_cast<int>(utf8.size()), str->Utf8Length(isolate));
+      std::vector<char> buffer(utf8.size() + 1, 'X');
+      int charlen;
+      int len = str->WriteUtf8(isolate, buffer.data(),
+                               static_cast<int>(buffer.size()), &charlen);
+      CHECK_EQ(static_cast<int>(utf8.size()) + 1, len);
+      CHECK_EQ(str->Length(), charlen);
+      CHECK_EQ(0, strcmp(utf8.c_str(), buffer.data()));
+    }
+  }
+
+  // A lone surrogate between ASCII runs is replaced.
+  uint16_t lone[] = {'a', 'b', 0xD800, 'c', 'd', 'e', 'f', 'g', 'h',
+                     'i', 'j', 'k', 'l',  'm', 'n', 'o', 'p', 'q'};
+  Local<String> str =
+      String::NewFromTwoByte(isolate, lone, v8::NewStringType::kNormal,
+                             static_cast<int>(arraysize(lone)))
+          .ToLocalChecked();
+  char buffer[64];
+  int len = str->WriteUtf8(isolate, buffer, sizeof(buffer), nullptr,
+                           String::REPLACE_INVALID_UTF8);
+  CHECK_EQ(21, len);
+  CHECK_EQ(0, strcmp("ab\xEF\xBF\xBD" "cdefghijklmnopq", buffer));
+}
+
 static void Utf16Helper(LocalContext& context, const char* name,
                         const char* lengths_name, int len) {
   Local<v8::Array> a = Local<v8::Array>::Cast(
@@ -16859,6 +16936,28 @@ THREADED_TEST(GetHeapStatistics) {
   }
 }
 
+TEST(GetHeapStatisticsRememberedSetSize) {
+  if (i::v8_flags.single_generation) return;
+  i::ManualGCScope manual_gc_scope;
+  LocalContext c1;
+  v8::Isolate* isolate = c1->GetIsolate();
+  v8::HandleScope scope(isolate);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i_isolate->heap()->CompleteSweepingFull();
+
+  // Storing a young object into an old array records an old-to-new slot.
+  i::Handle<i::FixedArray> old =
+      i_isolate->factory()->NewFixedArray(1, i::AllocationType::kOld);
+  i::Handle<i::FixedArray> young =
+      i_isolate->factory()->NewFixedArray(1, i::AllocationType::kYoung);
+  old->set(0, *young);
+
+  v8::HeapStatistics heap_statistics;
+  CHECK_EQ(0u, heap_statistics.remembered_set_size());
+  isolate->GetHeapStatistics(&heap_statistics);
+  CHECK_LT(0u, heap_statistics.remembered_set_size());
+}
+
 TEST(GetHeapSpaceStatistics) {
   // This test is incompatible with concurrent allocation, which may occur
   // while collecting the statistics and break the final `CHECK_EQ`s.
@@ -17002,6 +17101,40 @@ TEST(ExternalizeOldSpaceOneByteCons) {
   CHECK_EQ(String::ONE_BYTE_ENCODING, encoding);
 }
 
+TEST(ExternalOneByteStringResourceOfSubstring) {
+  v8::Isolate* isolate = CcTest::isolate();
+  LocalContext env;
+  v8::HandleScope scope(isolate);
+  const char* c_string = "Content-Type: text/html; charset=utf-8";
+  TestOneByteResource* resource = new TestOneByteResource(i::StrDup(c_string));
+  Local<String> string =
+      String::NewExternalOneByte(isolate, resource).ToLocalChecked();
+  CHECK(env->Global()->Set(env.local(), v8_str("header"), string).FromJust());
+
+  size_t offset = 1;
+  CHECK_EQ(resource, string->GetExternalOneByteStringResource(&offset));
+  CHECK_EQ(0u, offset);
+
+  // Substrings are slices of the external string.
+  Local<String> value = CompileRun("header.substring(14)")
+                            ->ToString(env.local())
+                            .ToLocalChecked();
+  CHECK(v8::Utils::OpenHandle(*value)->IsSlicedString());
+  CHECK(!value->IsExternalOneByte());
+  CHECK_NULL(value->GetExternalOneByteStringResource());
+  CHECK_EQ(resource, value->GetExternalOneByteStringResource(&offset));
+  CHECK_EQ(14u, offset);
+  CHECK_EQ(0, strncmp(resource->data() + offset, "text/html; charset=utf-8",
+                      value->Length()));
+
+  // Substrings of other strings have no resource.
+  Local<String> other = CompileRun("('Content-Type: ' + header).substring(3)")
+                            ->ToString(env.local())
+                            .ToLocalChecked();
+  CHECK_NULL(other->GetExternalOneByteStringResource(&offset));
+  CHECK_EQ(0u, offset);
+}
+
 TEST(ExternalStringCollectedAtTearDown) {
   int destroyed = 0;
   v8::Isolate::CreateParams create_params;
@@ -20780,6 +20913,73 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+THREADED_TEST(JSONParseUtf8) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+
+  // Non-ASCII characters in keys and values, mixed with escapes, including a
+  // character outside of the BMP.
+  const char json[] =
+      "{\"caf\xC3\xA9\": [\"\xCE\xB1\\u0041\\n\xF0\x9F\x98\x80\", "
+      "\"latin \xC3\xBF\", \"plain\", 1.5]}";
+  Local<Value> obj =
+      v8::JSON::Parse(context.local(), json, strlen(json)).ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("Object.keys(obj)[0]", "caf\xC3\xA9");
+  ExpectString("obj['caf\\u00e9'][0]", "\xCE\xB1" "A\n\xF0\x9F\x98\x80");
+  ExpectInt32("obj['caf\\u00e9'][0].length", 5);
+  ExpectString("obj['caf\\u00e9'][1]", "latin \xC3\xBF");
+  ExpectInt32("obj['caf\\u00e9'][1].length", 7);
+  ExpectString("JSON.stringify(obj['caf\\u00e9'].slice(2))",
+               "[\"plain\",1.5]");
+
+  // Invalid sequences inside strings decode to the replacement character.
+  const char invalid[] = "\"a\xFF" "b\"";
+  obj = v8::JSON::Parse(context.local(), invalid, strlen(invalid))
+            .ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectTrue("obj === 'a\\ufffdb'");
+
+  // Non-ASCII characters outside of strings are syntax errors.
+  v8::TryCatch try_catch(isolate);
+  const char bad[] = "[1, \xC3\xA9]";
+  CHECK(v8::JSON::Parse(context.local(), bad, strlen(bad)).IsEmpty());
+  CHECK(try_catch.HasCaught());
+}
+
+THREADED_TEST(JSONStreamingParser) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+
+  v8::JSON::StreamingParser parser;
+  const char* chunks[] = {"{\"x\":", "[1, 2", ", \"ab", "c\"]}"};
+  for (const char* chunk : chunks) {
+    parser.AppendOneByte(reinterpret_cast<const uint8_t*>(chunk),
+                         strlen(chunk));
+  }
+  Local<Value> obj = parser.Finish(context.local()).ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("JSON.stringify(obj)", "{\"x\":[1,2,\"abc\"]}");
+
+  // The parser is reusable and widens to two-byte on demand.
+  const uint8_t one_byte[] = {'[', '"', 'a'};
+  const uint16_t two_byte[] = {0x3B1, '"', ']'};
+  parser.AppendOneByte(one_byte, arraysize(one_byte));
+  parser.AppendTwoByte(two_byte, arraysize(two_byte));
+  obj = parser.Finish(context.local()).ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("obj[0]", "a\xCE\xB1");
+
+  v8::TryCatch try_catch(isolate);
+  const char* truncated = "{\"x\":";
+  parser.AppendOneByte(reinterpret_cast<const uint8_t*>(truncated),
+                       strlen(truncated));
+  CHECK(parser.Finish(context.local()).IsEmpty());
+  CHECK(try_catch.HasCaught());
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -20794,6 +20994,71 @@ THREADED_TEST(JSONStringifyObject) {
   ExpectString("JSON.stringify(obj)", *utf8);
 }
 
+namespace {
+class StringOutputStream : public v8::OutputStream {
+ public:
+  explicit StringOutputStream(int abort_after_chunks = -1)
+      : abort_after_chunks_(abort_after_chunks) {}
+  void EndOfStream() override { eos_signaled_++; }
+  int GetChunkSize() override { return 7; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    CHECK_LE(size, GetChunkSize());
+    contents_.append(data, size);
+    chunks_++;
+    return chunks_ == abort_after_chunks_ ? kAbort : kContinue;
+  }
+  const std::string& contents() const { return contents_; }
+  int eos_signaled() const { return eos_signaled_; }
+
+ private:
+  std::string contents_;
+  int abort_after_chunks_;
+  int chunks_ = 0;
+  int eos_signaled_ = 0;
+};
+}  // namespace
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+
+  // Large enough to fill the stringifier's buffer several times, and with
+  // non-ASCII characters to check the UTF-8 encoding.
+  Local<Value> value = CompileRun(
+      "var obj = [];"
+      "for (var i = 0; i < 1000; i++) {"
+      "  obj.push({i: i, s: 'caf\\u00e9 \\u03b1\\ud83d\\ude00', q: '\"'});"
+      "}"
+      "obj");
+  StringOutputStream stream;
+  CHECK(v8::JSON::Stringify(context.local(), value, &stream).FromJust());
+  CHECK_EQ(1, stream.eos_signaled());
+  Local<String> expected =
+      v8::JSON::Stringify(context.local(), value).ToLocalChecked();
+  v8::String::Utf8Value utf8(isolate, expected);
+  CHECK_EQ(std::string(*utf8, utf8.length()), stream.contents());
+
+  StringOutputStream gap_stream;
+  CHECK(v8::JSON::Stringify(context.local(), value, &gap_stream, v8_str("  "))
+            .FromJust());
+  v8::String::Utf8Value utf8_gap(
+      isolate, v8::JSON::Stringify(context.local(), value, v8_str("  "))
+                   .ToLocalChecked());
+  CHECK_EQ(std::string(*utf8_gap, utf8_gap.length()), gap_stream.contents());
+
+  StringOutputStream aborting_stream(2);
+  CHECK(!v8::JSON::Stringify(context.local(), value, &aborting_stream)
+             .FromJust());
+  CHECK_EQ(0, aborting_stream.eos_signaled());
+
+  StringOutputStream undefined_stream;
+  CHECK(!v8::JSON::Stringify(context.local(), v8::Undefined(isolate),
+                             &undefined_stream)
+             .FromJust());
+  CHECK(undefined_stream.contents().empty());
+}
+
 THREADED_TEST(JSONStringifyObjectWithGap) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -28987,6 +29252,104 @@ TEST(TriggerDelayedMainThreadMetricsEvent) {
   CHECK_EQ(recorder->count_, 1);  // Unchanged.
 }
 
+#if defined(V8_ENABLE_TURBOFAN)
+namespace {
+
+class TurbofanMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  size_t count_ = 0;
+  v8::metrics::TurbofanFunctionCompiled last_event_;
+
+  void AddMainThreadEvent(const v8::metrics::TurbofanFunctionCompiled& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    ++count_;
+    last_event_ = event;
+  }
+};
+
+}  // namespace
+
+TEST(TurbofanFunctionCompiledMetricsEvent) {
+  if (i::v8_flags.jitless) return;
+  i::v8_flags.turbofan = true;
+  i::v8_flags.allow_natives_syntax = true;
+  i::v8_flags.concurrent_recompilation = false;
+  i::v8_flags.always_turbofan = false;
+  i::FlagList::EnforceFlagImplications();
+
+  v8::Isolate* isolate = CcTest::isolate();
+  std::shared_ptr<TurbofanMetricsRecorder> recorder =
+      std::make_shared<TurbofanMetricsRecorder>();
+  isolate->SetMetricsRecorder(recorder);
+
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+  CompileRun(
+      "function reported(a, b) { return a + b; }"
+      "%PrepareFunctionForOptimization(reported);"
+      "reported(1, 2);"
+      "%OptimizeFunctionOnNextCall(reported);"
+      "reported(3, 4);");
+
+  CHECK_EQ(1, recorder->count_);
+  const v8::metrics::TurbofanFunctionCompiled& event = recorder->last_event_;
+  CHECK_EQ(0, event.function_name.compare("reported"));
+  CHECK(event.success);
+  CHECK(!event.osr);
+  CHECK_LT(0, event.bytecode_size_in_bytes);
+  CHECK(!event.phases.empty());
+  int64_t total_in_us = 0;
+  size_t peak_zone_size = 0;
+  for (const v8::metrics::TurbofanPhase& phase : event.phases) {
+    CHECK_NOT_NULL(phase.name);
+    CHECK_LE(0, phase.wall_clock_duration_in_us);
+    total_in_us += phase.wall_clock_duration_in_us;
+    peak_zone_size = std::max(peak_zone_size, phase.peak_zone_size_in_bytes);
+  }
+  CHECK_EQ(total_in_us, event.wall_clock_duration_in_us);
+  CHECK_EQ(peak_zone_size, event.peak_zone_size_in_bytes);
+  CHECK_LT(0, event.peak_zone_size_in_bytes);
+}
+#endif  // defined(V8_ENABLE_TURBOFAN)
+
+namespace {
+
+class PauseTargetRecorder : public v8::metrics::Recorder {
+ public:
+  size_t count_ = 0;
+  int64_t target_in_us_ = -1;
+
+  void AddMainThreadEvent(
+      const v8::metrics::
+          GarbageCollectionFullMainThreadIncrementalMarkPauseTargetViolation&
+              event,
+      v8::metrics::Recorder::ContextId id) override {
+    CHECK_GE(event.wall_clock_duration_in_us, event.target_in_us);
+    ++count_;
+    target_in_us_ = event.target_in_us;
+  }
+};
+
+}  // namespace
+
+TEST(IncrementalMarkingPauseTargetViolation) {
+  if (!i::v8_flags.incremental_marking) return;
+  i::ManualGCScope manual_gc_scope;
+  LocalContext env;
+  v8::Isolate* iso = env->GetIsolate();
+  v8::HandleScope scope(iso);
+  std::shared_ptr<PauseTargetRecorder> recorder =
+      std::make_shared<PauseTargetRecorder>();
+  iso->SetMetricsRecorder(recorder);
+  // A target of one microsecond is exceeded by any step that marks objects.
+  iso->SetIncrementalMarkingPauseTarget(0.001);
+  i::heap::SimulateIncrementalMarking(CcTest::heap());
+  CHECK_LT(0, recorder->count_);
+  CHECK_EQ(1, recorder->target_in_us_);
+  iso->SetIncrementalMarkingPauseTarget(0);
+  i::heap::InvokeAtomicMajorGC(CcTest::heap());
+}
+
 TEST(TriggerThreadSafeMetricsEvent) {
   // Set up isolate and context.
   v8::Isolate* iso = CcTest::isolate();
@@ -51,6 +51,7 @@
 #include "src/logging/log.h"
 #include "src/objects/objects-inl.h"
 #include "src/profiler/cpu-profiler.h"
+#include "src/profiler/hardware-event-counter.h"
 #include "src/profiler/profiler-listener.h"
 #include "src/profiler/symbolizer.h"
 #include "src/utils/utils.h"
@@ -930,6 +931,44 @@ TEST(CollectCpuProfileSamples) {
   profile->Delete();
 }
 
+TEST(CollectCpuProfileHardwareEvents) {
+  v8_flags.allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+
+  int32_t profiling_interval_ms = 200;
+  v8::Local<v8::Value> args[] = {
+      v8::Integer::New(env->GetIsolate(), profiling_interval_ms)};
+
+  // Without a counter, no events are attributed to samples.
+  {
+    ProfilerHelper helper(env.local());
+    v8::CpuProfile* profile =
+        helper.Run(function, args, arraysize(args), 1000, 0);
+    for (int i = 0; i < profile->GetSamplesCount(); i++) {
+      CHECK_EQ(0u, profile->GetSampleHardwareEventCount(i));
+    }
+    profile->Delete();
+  }
+
+  // Hardware counters are unavailable on some platforms and in some sandboxes.
+  if (!HardwareEventCounter::New("instructions")) return;
+  FlagScope<const char*> event_scope(&v8_flags.cpu_profiler_hardware_event,
+                                     "instructions");
+  ProfilerHelper helper(env.local());
+  v8::CpuProfile* profile =
+      helper.Run(function, args, arraysize(args), 1000, 0);
+  uint64_t total_events = 0;
+  for (int i = 0; i < profile->GetSamplesCount(); i++) {
+    total_events += profile->GetSampleHardwareEventCount(i);
+  }
+  CHECK_LT(0u, total_events);
+  profile->Delete();
+}
+
 static const char* cpu_profiler_test_source2 =
     "%NeverOptimizeFunction(loop);\n"
     "%NeverOptimizeFunction(delay);\n"
@@ -4946,6 +4985,33 @@ TEST(CpuProfileJSONSerialization) {
             ->Value() > 0);
 }
 
+TEST(CpuProfilePprofSerialization) {
+  v8_flags.allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env->GetIsolate(), 20)};
+  ProfilerHelper helper(env.local());
+  v8::CpuProfile* profile = helper.Run(function, args, arraysize(args), 10);
+
+  TestJSONStream stream;
+  profile->Serialize(&stream, v8::CpuProfile::kPprof);
+  profile->Delete();
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  base::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+
+  // The message starts with the first sample type, and the function names
+  // are in the string table.
+  CHECK_EQ(0x0a, data[0]);
+  std::string bytes(data.begin(), data.length());
+  CHECK_NE(std::string::npos, bytes.find("nanoseconds"));
+  CHECK_NE(std::string::npos, bytes.find("loop"));
+}
+
 }  // namespace test_cpu_profiler
 }  // namespace internal
 }  // namespace v8
@@ -3731,6 +3731,76 @@ TEST(SamplingHeapProfiler) {
   }
 }
 
+TEST(SamplingHeapProfilerSplitByAllocationSite) {
+  i::v8_flags.allow_natives_syntax = true;
+  i::v8_flags.sampling_heap_profiler_suppress_randomness = true;
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  heap_profiler->StartSamplingHeapProfiler(
+      1024, 1, v8::HeapProfiler::kSamplingSplitByAllocationSite);
+  CompileRun(
+      "var A = [];\n"
+      "function bar(size) {\n"
+      "  A.push(new Array(size));\n"
+      "  A.push(new Array(size));\n"
+      "}\n"
+      "%NeverOptimizeFunction(bar);\n"
+      "for (var i = 0; i < 1024; ++i) bar(1024);\n");
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+
+  const char* names[] = {"bar"};
+  const v8::AllocationProfile::Node* node_bar = FindAllocationProfileNode(
+      env->GetIsolate(), profile.get(), v8::base::ArrayVector(names));
+  CHECK(node_bar);
+  // All allocations of bar are attributed to its allocation sites.
+  CHECK(node_bar->allocations.empty());
+  bool found_line[5] = {false};
+  for (v8::AllocationProfile::Node* site : node_bar->children) {
+    v8::String::Utf8Value site_name(env->GetIsolate(), site->name);
+    CHECK_EQ(0, strcmp(*site_name, "(allocation site)"));
+    CHECK(site->children.empty());
+    CHECK(!site->allocations.empty());
+    CHECK_LT(site->line_number, 5);
+    found_line[site->line_number] = true;
+  }
+  CHECK(found_line[3]);
+  CHECK(found_line[4]);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
+TEST(SamplingHeapProfilerPprofSerialization) {
+  i::v8_flags.allow_natives_syntax = true;
+  i::v8_flags.always_turbofan = false;
+  i::v8_flags.sampling_heap_profiler_suppress_randomness = true;
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  heap_profiler->StartSamplingHeapProfiler(1024);
+  CompileRun(simple_sampling_heap_profiler_script);
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+
+  v8::internal::TestJSONStream stream;
+  profile->Serialize(env->GetIsolate(), &stream);
+  heap_profiler->StopSamplingHeapProfiler();
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  v8::base::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+
+  CHECK_EQ(0x0a, data[0]);
+  std::string bytes(data.begin(), data.length());
+  CHECK_NE(std::string::npos, bytes.find("objects"));
+  CHECK_NE(std::string::npos, bytes.find("bar"));
+}
+
 TEST(SamplingHeapProfilerRateAgnosticEstimates) {
   i::v8_flags.allow_natives_syntax = true;
   v8::HandleScope scope(CcTest::isolate());
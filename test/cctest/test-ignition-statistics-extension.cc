@@ -126,5 +126,35 @@ TEST(IgnitionStatisticsExtension) {
   CHECK(non_empty_result->BooleanValue(isolate));
 }
 
+TEST(IgnitionSamplingExtension) {
+  v8_flags.expose_ignition_statistics = true;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+
+  // Before sampling was started, there are no samples.
+  CHECK(CompileRun("JSON.stringify(getIgnitionSamples()) === '{}'")
+            ->BooleanValue(isolate));
+
+  // Whether samples hit handlers depends on the platform, but the object
+  // must always map handler names to counts and report the total.
+  const char* kSamplingTest = R"(
+    startIgnitionSampling(50);
+    let sum = 0;
+    for (let i = 0; i < 1e6; i++) sum += i % 7;
+    stopIgnitionSampling();
+    let samples = getIgnitionSamples();
+    let handlerSamples = 0;
+    let valid = typeof samples.total === "number";
+    for (let name in samples) {
+      if (name === "total") continue;
+      valid = valid && name.endsWith("Handler") && samples[name] > 0;
+      handlerSamples += samples[name];
+    }
+    valid && handlerSamples <= samples.total;)";
+  CHECK(CompileRun(kSamplingTest)->BooleanValue(isolate));
+  CHECK(!CcTest::i_isolate()->interpreter()->IsBytecodeSamplingActive());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -365,6 +365,31 @@ TEST(CodeMapMoveAndDeleteCode) {
   CHECK_EQ(entry1, instruction_stream_map.FindEntry(ToAddress(0x1700)));
 }
 
+TEST(CodeMapFindEntryAfterChanges) {
+  CodeEntryStorage storage;
+  InstructionStreamMap instruction_stream_map(storage);
+  CodeEntry* entry1 =
+      storage.Create(i::LogEventListener::CodeTag::kFunction, "aaa");
+  CodeEntry* entry2 =
+      storage.Create(i::LogEventListener::CodeTag::kFunction, "bbb");
+  // Repeated lookups are cached, and changes to the map must be seen.
+  CHECK(!instruction_stream_map.FindEntry(ToAddress(0x1510)));
+  instruction_stream_map.AddCode(ToAddress(0x1500), entry1, 0x200);
+  for (int i = 0; i < 2; i++) {
+    Address instruction_start = kNullAddress;
+    CHECK_EQ(entry1, instruction_stream_map.FindEntry(ToAddress(0x1510),
+                                                      &instruction_start));
+    CHECK_EQ(ToAddress(0x1500), instruction_start);
+  }
+  CHECK(instruction_stream_map.RemoveCode(entry1));
+  CHECK(!instruction_stream_map.FindEntry(ToAddress(0x1510)));
+  instruction_stream_map.AddCode(ToAddress(0x1510), entry2, 0x100);
+  CHECK_EQ(entry2, instruction_stream_map.FindEntry(ToAddress(0x1510)));
+  instruction_stream_map.ClearCodesInRange(ToAddress(0x1400),
+                                           ToAddress(0x1600));
+  CHECK(!instruction_stream_map.FindEntry(ToAddress(0x1510)));
+}
+
 TEST(CodeMapClear) {
   CodeEntryStorage storage;
   InstructionStreamMap instruction_stream_map(storage);
@@ -455,6 +455,25 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   shared_space_blob.Dispose();
   context_blob.Dispose();
 }
+
+UNINITIALIZED_TEST(SnapshotCompressionChunks) {
+  // Large blobs are split into chunks, the last of which is usually smaller
+  // than the others.
+  for (uint32_t size : {0u, 1u, i::SnapshotCompression::kChunkSize,
+                        3 * i::SnapshotCompression::kChunkSize + 17}) {
+    std::vector<uint8_t> blob(size);
+    for (uint32_t i = 0; i < size; i++) {
+      blob[i] = static_cast<uint8_t>((i * 7) ^ (i >> 9));
+    }
+    base::Vector<const uint8_t> blob_vector(blob.data(), blob.size());
+    SnapshotData original_snapshot_data(blob_vector);
+    SnapshotData compressed =
+        i::SnapshotCompression::Compress(&original_snapshot_data);
+    SnapshotData decompressed =
+        i::SnapshotCompression::Decompress(compressed.RawData());
+    CHECK_EQ(blob_vector, decompressed.RawData());
+  }
+}
 #endif  // SNAPSHOT_COMPRESSION
 
 UNINITIALIZED_TEST(ContextSerializerContext) {
@@ -2627,6 +2646,86 @@ TEST(CodeSerializerIsolates) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerDeterministic) {
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache1 = CompileRunAndProduceCache(js_source);
+
+  // Produce the second cache in an isolate that has seen other scripts and
+  // strings before, so that the script id differs.
+  v8::ScriptCompiler::CachedData* cache2;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+    CompileRun("var abc = 'abc'; function g() {}");
+    CompileRun("g()");
+
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate2, &source)
+            .ToLocalChecked();
+    cache2 = ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate2->Dispose();
+
+  CHECK_EQ(cache1->length, cache2->length);
+  CHECK_EQ(0, memcmp(cache1->data, cache2->data, cache1->length));
+  delete cache1;
+  delete cache2;
+}
+
+TEST(ScriptCodeCacheSharedBetweenIsolates) {
+  v8_flags.script_shared_code_cache_size = 1024;
+  FlagList::EnforceFlagImplications();
+  // Only scripts of at least 1 KB are cached.
+  std::string js_source = "function f() { return 'abc'; }; f() + 'def'";
+  js_source += "//" + std::string(1024, '-');
+
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    v8::Local<v8::Context> context = CcTest::NewContext();
+    v8::Context::Scope context_scope(context);
+    v8::ScriptOrigin origin(CcTest::isolate(), v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source.c_str()), origin);
+    v8::ScriptCompiler::CompileUnboundScript(CcTest::isolate(), &source)
+        .ToLocalChecked();
+  }
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate2, v8_str("other"));
+    v8::ScriptCompiler::Source source(v8_str(js_source.c_str()), origin);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate2, &source)
+                   .ToLocalChecked();
+    }
+    CHECK(script->GetScriptName()->StrictEquals(v8_str("other")));
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+  v8_flags.script_shared_code_cache_size = 0;
+  FlagList::EnforceFlagImplications();
+}
+
 TEST(CodeSerializerIsolatesEager) {
   const char* js_source =
       "function f() {"
@@ -2726,6 +2825,105 @@ TEST(CodeSerializerAfterExecute) {
   v8_flags.always_turbofan = prev_always_turbofan_value;
 }
 
+TEST(CodeSerializerKeepsPreparseData) {
+  // The code cache carries the preparse data of lazy functions, so that
+  // compiling them after a restart doesn't preparse their inner functions.
+  const char* js_source =
+      "function f() {"
+      "  var s = 'abc';"
+      "  function g() { return s; }"
+      "  return g;"
+      "}"
+      "'abc' + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    v8::Local<v8::Function> f = v8::Local<v8::Function>::Cast(
+        context->Global()->Get(context, v8_str("f")).ToLocalChecked());
+    Handle<JSFunction> f_function =
+        Handle<JSFunction>::cast(v8::Utils::OpenHandle(*f));
+    CHECK(f_function->shared()->HasUncompiledDataWithPreparseData());
+
+    v8::Local<v8::Function> g = v8::Local<v8::Function>::Cast(
+        f->Call(context, context->Global(), 0, nullptr).ToLocalChecked());
+    v8::Local<v8::Value> result =
+        g->Call(context, context->Global(), 0, nullptr).ToLocalChecked();
+    CHECK(result->Equals(context, v8_str("abc")).FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerFeedbackVectorHint) {
+  // Functions that had a feedback vector in the producing isolate get one as
+  // soon as they are instantiated from the code cache.
+  if (!v8_flags.lazy_feedback_allocation || v8_flags.jitless ||
+      v8_flags.always_sparkplug) {
+    return;
+  }
+  v8_flags.allocate_feedback_vector_with_hint = true;
+  FlagList::EnforceFlagImplications();
+  const char* js_source =
+      "function f() { return 'abc'; }"
+      "function g() { return 'def'; }"
+      "if (!this.cold) for (var i = 0; i < 100; i++) f();"
+      "f() + g()";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+    context->Global()
+        ->Set(context, v8_str("cold"), v8::True(isolate2))
+        .FromJust();
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    Handle<JSFunction> f = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("f")).ToLocalChecked()));
+    Handle<JSFunction> g = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("g")).ToLocalChecked()));
+    CHECK(f->shared()->had_feedback_vector());
+    CHECK(f->has_feedback_vector());
+    CHECK(!g->shared()->had_feedback_vector());
+    CHECK(!g->has_feedback_vector());
+  }
+  isolate2->Dispose();
+  v8_flags.allocate_feedback_vector_with_hint = false;
+  FlagList::EnforceFlagImplications();
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
@@ -33,18 +33,7 @@ class CSATestRunner {
  public:
   CSATestRunner(Isolate* isolate, int initial_capacity, KeyCache& keys);
 
-  // TODO(v8:11330): Remove once CSA implementation has a fallback for
-  // non-SSSE3/AVX configurations.
-  static bool IsEnabled() {
-#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_IA32
-    CpuFeatures::SupportedFeatures();
-    return CpuFeatures::IsSupported(CpuFeature::AVX) ||
-           CpuFeatures::IsSupported(CpuFeature::SSSE3);
-#else
-    // Other 64-bit architectures always support the required operations.
-    return true;
-#endif
-  }
+  static bool IsEnabled() { return true; }
 
   void Add(Handle<Name> key, Handle<Object> value, PropertyDetails details);
   InternalIndex FindEntry(Handle<Name> key);
@@ -263,11 +252,6 @@ void CSATestRunner::PrintTable() {
 }
 
 Handle<Code> CSATestRunner::create_find_entry(Isolate* isolate) {
-  // TODO(v8:11330): Remove once CSA implementation has a fallback for
-  // non-SSSE3/AVX configurations.
-  if (!IsEnabled()) {
-    return isolate->builtins()->code_handle(Builtin::kIllegal);
-  }
   static_assert(kFindEntryParams == 2);  // (table, key)
   compiler::CodeAssemblerTester asm_tester(isolate,
                                            JSParameterCount(kFindEntryParams));
@@ -338,11 +322,6 @@ Handle<Code> CSATestRunner::create_put(Isolate* isolate) {
 }
 
 Handle<Code> CSATestRunner::create_delete(Isolate* isolate) {
-  // TODO(v8:11330): Remove once CSA implementation has a fallback for
-  // non-SSSE3/AVX configurations.
-  if (!IsEnabled()) {
-    return isolate->builtins()->code_handle(Builtin::kIllegal);
-  }
   static_assert(kDeleteParams == 2);  // (table, entry)
   compiler::CodeAssemblerTester asm_tester(isolate,
                                            JSParameterCount(kDeleteParams));
@@ -364,11 +343,6 @@ Handle<Code> CSATestRunner::create_delete(Isolate* isolate) {
 }
 
 Handle<Code> CSATestRunner::create_add(Isolate* isolate) {
-  // TODO(v8:11330): Remove once CSA implementation has a fallback for
-  // non-SSSE3/AVX configurations.
-  if (!IsEnabled()) {
-    return isolate->builtins()->code_handle(Builtin::kIllegal);
-  }
   static_assert(kAddParams == 4);  // (table, key, value, details)
   compiler::CodeAssemblerTester asm_tester(isolate,
                                            JSParameterCount(kAddParams));
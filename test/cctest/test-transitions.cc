@@ -15,6 +15,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/transitions-inl.h"
 #include "test/cctest/cctest.h"
+#include "test/cctest/heap/heap-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -193,6 +194,84 @@ TEST(TransitionArray_DifferentFieldNames) {
   DCHECK(transitions.IsSortedNoDuplicates());
 }
 
+TEST(TransitionArray_ManyFieldNames) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  // Enough transitions to exercise the interpolation search, both when
+  // inserting and when looking up.
+  const int PROPS_COUNT = 300;
+  Handle<String> names[PROPS_COUNT];
+  Handle<Map> maps[PROPS_COUNT];
+  PropertyAttributes attributes = NONE;
+
+  Handle<Map> map0 = Map::Create(isolate, 0);
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    base::EmbeddedVector<char, 64> buffer;
+    SNPrintF(buffer, "prop%d", i);
+    Handle<String> name = factory->InternalizeUtf8String(buffer.begin());
+    Handle<Map> map =
+        Map::CopyWithField(isolate, map0, name, FieldType::Any(isolate),
+                           attributes, PropertyConstness::kMutable,
+                           Representation::Tagged(), OMIT_TRANSITION)
+            .ToHandleChecked();
+    names[i] = name;
+    maps[i] = map;
+
+    TransitionsAccessor::Insert(isolate, map0, name, map, PROPERTY_TRANSITION);
+  }
+
+  TestTransitionsAccessor transitions(isolate, map0);
+  CHECK_EQ(PROPS_COUNT, transitions.NumberOfTransitions());
+  DCHECK(transitions.IsSortedNoDuplicates());
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    CHECK_EQ(*maps[i], transitions.SearchTransition(
+                           *names[i], PropertyKind::kData, attributes));
+    CHECK(transitions
+              .SearchTransition(*names[i], PropertyKind::kAccessor, attributes)
+              .is_null());
+  }
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    base::EmbeddedVector<char, 64> buffer;
+    SNPrintF(buffer, "other%d", i);
+    Handle<String> name = factory->InternalizeUtf8String(buffer.begin());
+    CHECK(transitions.SearchTransition(*name, PropertyKind::kData, attributes)
+              .is_null());
+  }
+}
+
+TEST(TransitionArray_TrimSlackWhenReducingMemory) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  const int PROPS_COUNT = 20;
+  Handle<Map> maps[PROPS_COUNT];
+  PropertyAttributes attributes = NONE;
+
+  Handle<Map> map0 = Map::Create(isolate, 0);
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    base::EmbeddedVector<char, 64> buffer;
+    SNPrintF(buffer, "prop%d", i);
+    Handle<String> name = factory->InternalizeUtf8String(buffer.begin());
+    maps[i] = Map::CopyWithField(isolate, map0, name, FieldType::Any(isolate),
+                                 attributes, PropertyConstness::kMutable,
+                                 Representation::Tagged(), OMIT_TRANSITION)
+                  .ToHandleChecked();
+    TransitionsAccessor::Insert(isolate, map0, name, maps[i],
+                                PROPERTY_TRANSITION);
+  }
+  CHECK_LT(PROPS_COUNT, TestTransitionsAccessor(isolate, map0).Capacity());
+
+  // All targets are alive, so only a GC that reduces memory drops the slack.
+  heap::InvokeMemoryReducingMajorGCs(CcTest::heap());
+  TestTransitionsAccessor transitions(isolate, map0);
+  CHECK_EQ(PROPS_COUNT, transitions.NumberOfTransitions());
+  CHECK_EQ(PROPS_COUNT, transitions.Capacity());
+}
 
 TEST(TransitionArray_SameFieldNamesDifferentAttributesSimple) {
   CcTest::InitializeVM();
@@ -163,6 +163,51 @@ TEST(CacheHitMissSig) {
   CHECK_EQ(c2, c4);
 }
 
+TEST(SharedAcrossModules) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  auto module1 = NewModule(isolate);
+  auto module2 = NewModule(isolate);
+  TestSignatures sigs;
+  WasmCodeRefScope wasm_code_ref_scope;
+
+  auto kind = ImportCallKind::kJSFunctionArityMatch;
+  auto sig = sigs.i_ii();
+  uint32_t canonical_type_index =
+      GetTypeCanonicalizer()->AddRecursiveGroup(sig);
+  int expected_arity = static_cast<int>(sig->parameter_count());
+  WasmImportWrapperCache::CacheKey key(kind, canonical_type_index,
+                                       expected_arity, kNoSuspend);
+  SharedImportWrapperCache::Key shared_key(key, WasmFeatures::All());
+  CHECK(SharedImportWrapperCache::IsShareable(module1->module(), sig));
+
+  WasmCode* c1;
+  {
+    WasmImportWrapperCache::ModificationScope cache_scope(
+        module1->import_wrapper_cache());
+    c1 = CompileImportWrapper(module1.get(), isolate->counters(), kind, sig,
+                              canonical_type_index, expected_arity,
+                              kNoSuspend, &cache_scope);
+  }
+  SharedImportWrapperCache* shared_cache =
+      GetWasmEngine()->shared_import_wrapper_cache();
+  std::shared_ptr<const WasmCompilationResult> shared =
+      shared_cache->MaybeGet(shared_key);
+  CHECK_NOT_NULL(shared);
+
+  WasmCode* c2;
+  {
+    WasmImportWrapperCache::ModificationScope cache_scope(
+        module2->import_wrapper_cache());
+    c2 = CompileImportWrapper(module2.get(), isolate->counters(), kind, sig,
+                              canonical_type_index, expected_arity,
+                              kNoSuspend, &cache_scope);
+  }
+  // Each module has its own copy, made from the same compilation result.
+  CHECK_NE(c1, c2);
+  CHECK_EQ(c1->instructions().size(), c2->instructions().size());
+  CHECK_EQ(shared, shared_cache->MaybeGet(shared_key));
+}
+
 }  // namespace test_wasm_import_wrapper_cache
 }  // namespace wasm
 }  // namespace internal
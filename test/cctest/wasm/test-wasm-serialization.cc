@@ -111,6 +111,9 @@ class WasmSerializationTest {
   }
 
   v8::MemorySpan<const uint8_t> wire_bytes() const { return wire_bytes_; }
+  v8::MemorySpan<const uint8_t> serialized_bytes() const {
+    return serialized_bytes_;
+  }
 
  private:
   Zone* zone() { return &zone_; }
@@ -426,6 +429,130 @@ TEST(SerializeTieringBudget) {
   }
 }
 
+TEST(ConcurrentSerializationProducesSameBytes) {
+  WasmSerializationTest test;
+
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  Handle<WasmModuleObject> module_object;
+  CHECK(test.Deserialize().ToHandle(&module_object));
+  v8::Local<v8::WasmModuleObject> v8_module_object =
+      v8::Utils::ToLocal(Handle<JSObject>::cast(module_object))
+          .As<v8::WasmModuleObject>();
+
+  v8::OwnedBuffer sequential_bytes;
+  {
+    FlagScope<bool> sequential(&v8_flags.wasm_concurrent_serialization, false);
+    sequential_bytes = v8_module_object->GetCompiledModule().Serialize();
+  }
+  v8::OwnedBuffer concurrent_bytes;
+  {
+    FlagScope<bool> concurrent(&v8_flags.wasm_concurrent_serialization, true);
+    concurrent_bytes = v8_module_object->GetCompiledModule().Serialize();
+  }
+
+  CHECK_LT(0, sequential_bytes.size);
+  CHECK_EQ(sequential_bytes.size, concurrent_bytes.size);
+  CHECK_EQ(0, memcmp(sequential_bytes.buffer.get(),
+                     concurrent_bytes.buffer.get(), sequential_bytes.size));
+}
+
+TEST(LazyDeserialization) {
+  FlagScope<bool> lazy_deserialization(&v8_flags.wasm_lazy_deserialization,
+                                       true);
+  WasmSerializationTest test;
+
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  Handle<WasmModuleObject> module_object;
+  CHECK(test.Deserialize().ToHandle(&module_object));
+  NativeModule* native_module = module_object->native_module();
+  CHECK_NOT_NULL(native_module->lazy_deserialization_data());
+
+  // No code was deserialized yet, but serializing again must not lose the
+  // deferred TurboFan code.
+  for (uint32_t i = native_module->num_imported_functions();
+       i < native_module->num_functions(); ++i) {
+    CHECK(!native_module->HasCode(i));
+  }
+  v8::OwnedBuffer reserialized =
+      v8::Utils::ToLocal(Handle<JSObject>::cast(module_object))
+          .As<v8::WasmModuleObject>()
+          ->GetCompiledModule()
+          .Serialize();
+  CHECK_EQ(test.serialized_bytes().size(), reserialized.size);
+  CHECK_EQ(0, memcmp(test.serialized_bytes().data(), reserialized.buffer.get(),
+                     reserialized.size));
+
+  // Calling the function deserializes its code.
+  test.DeserializeAndRun();
+  WasmCodeRefScope code_ref_scope;
+  int increment_index = native_module->num_functions() - 1;
+  WasmCode* code = native_module->GetCode(increment_index);
+  CHECK_NOT_NULL(code);
+  CHECK_EQ(ExecutionTier::kTurbofan, code->tier());
+}
+
+TEST(ProfileRoundTrip) {
+  WasmSerializationTest test;
+
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  Handle<WasmModuleObject> module_object;
+  CHECK(test.Deserialize().ToHandle(&module_object));
+  v8::CompiledWasmModule compiled_module =
+      v8::Utils::ToLocal(Handle<JSObject>::cast(module_object))
+          .As<v8::WasmModuleObject>()
+          ->GetCompiledModule();
+
+  v8::OwnedBuffer profile = compiled_module.SerializeProfile();
+  CHECK_LT(0, profile.size);
+  CHECK(compiled_module.ApplyProfile(profile.buffer.get(), profile.size));
+
+  // Truncated or otherwise corrupted profiles are rejected.
+  CHECK(!compiled_module.ApplyProfile(profile.buffer.get(), profile.size - 1));
+  std::unique_ptr<uint8_t[]> corrupted(new uint8_t[profile.size]);
+  memcpy(corrupted.get(), profile.buffer.get(), profile.size);
+  corrupted[0] ^= 1;
+  CHECK(!compiled_module.ApplyProfile(corrupted.get(), profile.size));
+  CHECK(!compiled_module.ApplyProfile(nullptr, 0));
+}
+
+TEST(CodeCacheFile) {
+  WasmSerializationTest test;
+  Isolate* isolate = CcTest::i_isolate();
+  base::Vector<const uint8_t> wire_bytes = base::VectorOf(test.wire_bytes());
+  std::weak_ptr<NativeModule> weak_native_module;
+  {
+    HandleScope scope(isolate);
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    weak_native_module = module_object->shared_native_module();
+    SerializeNativeModuleToFile(module_object->native_module());
+  }
+  // The module must die, otherwise the engine's module cache would be used.
+  test.CollectGarbage();
+  while (weak_native_module.lock()) {
+  }
+
+  {
+    HandleScope scope(isolate);
+    Handle<WasmModuleObject> module_object;
+    CHECK(DeserializeNativeModuleFromFile(isolate, wire_bytes)
+              .ToHandle(&module_object));
+    const LazyDeserializationData* lazy_data =
+        module_object->native_module()->lazy_deserialization_data();
+    CHECK_NOT_NULL(lazy_data);
+    CHECK(lazy_data->is_mapped_from_file());
+  }
+
+  base::EmbeddedVector<char, 32> filename;
+  SNPrintF(filename, "code-wasm-%08x",
+           static_cast<uint32_t>(GetWireBytesHash(wire_bytes)));
+  CHECK(base::OS::Remove(filename.begin()));
+  test.CollectGarbage();
+}
+
 TEST(DeserializeTieringBudgetPartlyMissing) {
   WasmSerializationTest test;
   {
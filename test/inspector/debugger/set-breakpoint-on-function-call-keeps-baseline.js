@@ -0,0 +1,41 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --allow-natives-syntax
+
+let {session, contextGroup, Protocol} = InspectorTest.start(
+    'Checks that a breakpoint on a builtin call keeps unrelated baseline code.');
+
+contextGroup.addScript(`
+function callsPush(array) {
+  array.push(1);
+  return array.length;
+}
+%CompileBaseline(callsPush);
+`);
+
+(async function test() {
+  Protocol.Debugger.enable();
+  const {result: {result: {objectId}}} =
+      await Protocol.Runtime.evaluate({expression: 'Array.prototype.push'});
+  InspectorTest.log('set breakpoint on Array.prototype.push');
+  const {result: {breakpointId}} =
+      await Protocol.Debugger.setBreakpointOnFunctionCall({objectId});
+  await logActiveTier();
+  InspectorTest.log('call function');
+  Protocol.Runtime.evaluate({expression: 'callsPush([])'});
+  const {params: {hitBreakpoints}} = await Protocol.Debugger.oncePaused();
+  InspectorTest.log(
+      `hitBreakpoints contains id: ${hitBreakpoints[0] === breakpointId}`);
+  await Protocol.Debugger.resume();
+  await Protocol.Debugger.removeBreakpoint({breakpointId});
+  await logActiveTier();
+  InspectorTest.completeTest();
+})();
+
+async function logActiveTier() {
+  const {result: {result: {value}}} = await Protocol.Runtime.evaluate(
+      {expression: '%ActiveTierIsSparkplug(callsPush)'});
+  InspectorTest.log(`callsPush runs baseline code: ${value}`);
+}
@@ -0,0 +1,49 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Environment Variables: TZ=America/Los_Angeles
+
+// Local time offsets right before and at a daylight saving time transition.
+assertEquals(480, new Date(Date.UTC(2021, 2, 14, 9, 59, 59, 999))
+                      .getTimezoneOffset());
+assertEquals(420, new Date(Date.UTC(2021, 2, 14, 10)).getTimezoneOffset());
+assertEquals(420, new Date(Date.UTC(2021, 10, 7, 8, 59, 59, 999))
+                      .getTimezoneOffset());
+assertEquals(480, new Date(Date.UTC(2021, 10, 7, 9)).getTimezoneOffset());
+assertEquals(1, new Date(Date.UTC(2021, 2, 14, 9, 59)).getHours());
+assertEquals(3, new Date(Date.UTC(2021, 2, 14, 10)).getHours());
+
+// Local mean time before the introduction of standard time.
+assertEquals(472, new Date(Date.UTC(1880, 0, 1)).getTimezoneOffset());
+
+// The local time components agree with ICU's formatting across a wide range
+// of times, in both directions and across the end of any cached range.
+const formatter = new Intl.DateTimeFormat('en-US', {
+  timeZone: 'America/Los_Angeles',
+  hourCycle: 'h23',
+  year: 'numeric',
+  month: 'numeric',
+  day: 'numeric',
+  hour: 'numeric',
+  minute: 'numeric',
+});
+
+function check(time) {
+  const date = new Date(time);
+  const parts = {};
+  for (const {type, value} of formatter.formatToParts(date)) {
+    parts[type] = Number(value);
+  }
+  assertEquals(parts.year, date.getFullYear(), date.toISOString());
+  assertEquals(parts.month, date.getMonth() + 1, date.toISOString());
+  assertEquals(parts.day, date.getDate(), date.toISOString());
+  assertEquals(parts.hour, date.getHours(), date.toISOString());
+  assertEquals(parts.minute, date.getMinutes(), date.toISOString());
+}
+
+const kStep = 11 * 24 * 3600 * 1000 + 1234567;
+const kStart = Date.UTC(1900, 0, 1);
+const kEnd = Date.UTC(2150, 0, 1);
+for (let time = kStart; time < kEnd; time += kStep) check(time);
+for (let time = kEnd; time >= kStart; time -= kStep) check(time);
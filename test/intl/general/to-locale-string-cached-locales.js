@@ -0,0 +1,28 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// toLocaleString calls that alternate between more locales than are cached
+// keep formatting with the requested locale.
+const locales = ['en-US', 'de-DE', 'fr-FR', 'ja-JP', 'sv-SE', 'hi-IN'];
+const number = 1234567.891;
+const date = new Date(Date.UTC(2020, 11, 31, 12));
+
+const expected = locales.map(locale => ({
+  number: new Intl.NumberFormat(locale).format(number),
+  date: new Intl.DateTimeFormat(locale).format(date),
+  time: new Intl.DateTimeFormat(locale, {timeStyle: 'medium'}).format(date),
+  compare: new Intl.Collator(locale).compare('ä', 'z'),
+}));
+
+for (let round = 0; round < 3; round++) {
+  for (const count of [2, 4, locales.length]) {
+    for (let i = 0; i < count; i++) {
+      const locale = locales[i];
+      assertEquals(expected[i].number, number.toLocaleString(locale), locale);
+      assertEquals(expected[i].date, date.toLocaleDateString(locale), locale);
+      assertEquals(expected[i].time, date.toLocaleTimeString(locale), locale);
+      assertEquals(expected[i].compare, 'ä'.localeCompare('z', locale), locale);
+    }
+  }
+}
@@ -0,0 +1,51 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Each iteration queues long runs of promise reaction jobs back to back, as
+// servers awaiting many independent operations do.
+
+new BenchmarkSuite('PromiseReactions', [1000], [
+  new Benchmark('Fulfill', false, false, 0, Fulfill, Setup),
+  new Benchmark('Reject', false, false, 0, Reject, Setup),
+  new Benchmark('Await', false, false, 0, Await, Setup),
+]);
+
+const kChains = 100;
+const kLength = 10;
+
+var resolved, rejected, identity, rethrow, waiter;
+
+function Setup() {
+  resolved = Promise.resolve(1);
+  rejected = Promise.reject(1);
+  identity = x => x;
+  rethrow = x => { throw x; };
+  waiter = async function waiter() {
+    for (let i = 0; i < kLength; i++) await resolved;
+  };
+
+  %PerformMicrotaskCheckpoint();
+}
+
+function Fulfill() {
+  for (let i = 0; i < kChains; i++) {
+    let p = resolved;
+    for (let j = 0; j < kLength; j++) p = p.then(identity);
+  }
+  %PerformMicrotaskCheckpoint();
+}
+
+function Reject() {
+  for (let i = 0; i < kChains; i++) {
+    let p = rejected;
+    for (let j = 0; j < kLength; j++) p = p.catch(rethrow);
+    p.catch(identity);
+  }
+  %PerformMicrotaskCheckpoint();
+}
+
+function Await() {
+  for (let i = 0; i < kChains; i++) waiter();
+  %PerformMicrotaskCheckpoint();
+}
@@ -7,6 +7,7 @@ d8.file.execute('../base.js');
 d8.file.execute('baseline-babel-es2017.js');
 d8.file.execute('baseline-naive-promises.js');
 d8.file.execute('native.js');
+d8.file.execute('promise-reactions.js');
 
 var success = true;
 
@@ -36,6 +36,16 @@ var MapObjectLargeBenchmark = new BenchmarkSuite('Map-Object-Set-Get-Large', [1e
                 MapSetupObjectBaseLarge, MapTearDown),
 ]);
 
+var MapSmiLargeBenchmark = new BenchmarkSuite('Map-Smi-Set-Get-Large', [1e7], [
+  new Benchmark('Set-Get', false, false, 0, MapSetGetSmiLarge,
+                MapSetupSmiBaseLarge, MapTearDown),
+]);
+
+var MapSmiChurnLargeBenchmark = new BenchmarkSuite('Map-Smi-Churn-Large', [1e7], [
+  new Benchmark('Set-Delete', false, false, 0, MapChurnSmiLarge,
+                MapSetupSmiBaseLarge, MapTearDown),
+]);
+
 var MapIterationBenchmark = new BenchmarkSuite('Map-Iteration', [1000], [
   new Benchmark('ForEach', false, false, 0, MapForEach, MapSetupSmi, MapTearDown),
 ]);
@@ -78,6 +88,11 @@ function MapSetupObjectBase() {
   map = new Map;
 }
 
+function MapSetupSmiBaseLarge() {
+  SetupSmiKeys(2 * LargeN);
+  map = new Map;
+}
+
 function MapSetupObjectBaseLarge() {
   SetupObjectKeys(2 * LargeN);
   map = new Map;
@@ -246,6 +261,36 @@ function MapSetGetObjectLarge() {
   }
 }
 
+function MapSetGetSmiLarge() {
+  for (var i = 0; i < LargeN; i++) {
+    map.set(keys[i * 2], i);
+  }
+  for (var i = 0; i < LargeN; i++) {
+    if (map.get(keys[i * 2]) !== i) {
+      throw new Error();
+    }
+  }
+  for (var i = 0; i < LargeN; i++) {
+    if (map.get(keys[i * 2 + 1]) !== undefined) {
+      throw new Error();
+    }
+  }
+}
+
+// Keeps the most recent LargeN / 2 keys, like a cache that evicts its
+// oldest entry for every new one.
+function MapChurnSmiLarge() {
+  map = new Map;
+  var size = LargeN / 2;
+  for (var i = 0; i < 2 * LargeN; i++) {
+    map.set(keys[i], i);
+    if (i >= size) map.delete(keys[i - size]);
+  }
+  if (map.size !== size) {
+    throw new Error();
+  }
+}
+
 function MapDeleteObject() {
   // This is run more than once per setup so we will end up deleting items
   // more than once. Therefore, we do not the return value of delete.
@@ -0,0 +1,63 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-compilation-cache
+
+// Every iteration evaluates a fresh copy of the same function, collects some
+// feedback for it and compiles it with one tier. The compilation cache is
+// disabled so that each copy gets its own SharedFunctionInfo. The Ignition
+// suite only parses, generates bytecode and runs the function, which all
+// other suites do as well.
+
+const kSource = `(function corpus(points, n) {
+  let sum = 0;
+  for (let i = 0; i < points.length; i++) {
+    const p = points[i];
+    if (p.x > p.y) {
+      sum += Math.sqrt(p.x * p.x + p.y * p.y);
+    } else {
+      sum -= p.label.length * n;
+    }
+    for (let j = 0; j < n; j++) sum += (i ^ j) & 7;
+  }
+  switch (n & 3) {
+    case 0: return sum;
+    case 1: return -sum;
+    default: return sum | 0;
+  }
+})`;
+
+const points = Array.from({length: 16}, (_, i) => ({
+  x: i % 5, y: i % 3, label: 'point' + i
+}));
+
+function MakeFunction() {
+  const f = eval(kSource);
+  %PrepareFunctionForOptimization(f);
+  f(points, 4);
+  f(points, 5);
+  return f;
+}
+
+createSuite('Ignition', 1000, () => {
+  MakeFunction();
+});
+
+createSuite('Sparkplug', 1000, () => {
+  const f = MakeFunction();
+  %CompileBaseline(f);
+  f(points, 6);
+});
+
+createSuite('Maglev', 1000, () => {
+  const f = MakeFunction();
+  %OptimizeMaglevOnNextCall(f);
+  f(points, 6);
+});
+
+createSuite('TurboFan', 1000, () => {
+  const f = MakeFunction();
+  %OptimizeFunctionOnNextCall(f);
+  f(points, 6);
+});
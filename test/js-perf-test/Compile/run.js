@@ -0,0 +1,27 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures compile throughput of a single tier per run; see JSTests5.json for
+// the flags of each configuration. For a breakdown of compile time and zone
+// memory per phase, add --maglev-stats, --turbo-stats or --turbo-stats-wasm.
+
+d8.file.execute('../base.js');
+d8.file.execute(arguments[0] + '.js');
+
+var success = true;
+
+function PrintResult(name, result) {
+  print(name + '-Compile(Score): ' + result);
+}
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
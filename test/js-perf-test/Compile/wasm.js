@@ -0,0 +1,78 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-wasm-lazy-compilation --no-wasm-native-module-cache-enabled
+
+// Synchronously compiles a module with many small functions. The tier is
+// selected by the flags (--liftoff-only or --no-liftoff), and the native
+// module cache is disabled so that every iteration compiles from scratch.
+// The wasm module builder is not available for performance tests, so the
+// module is encoded by hand.
+
+const kFunctionCount = 200;
+
+function EncodeU32(value) {
+  let bytes = [];
+  do {
+    let byte = value & 0x7f;
+    value >>>= 7;
+    if (value != 0) byte |= 0x80;
+    bytes.push(byte);
+  } while (value != 0);
+  return bytes;
+}
+
+function Section(id, contents) {
+  return [id, ...EncodeU32(contents.length), ...contents];
+}
+
+// (i32 acc, i32 n) -> i32: loops n times over a few arithmetic operations.
+function FunctionBody(index) {
+  let code = [
+    0x01, 0x01, 0x7f,                    // One i32 local (the counter).
+    0x02, 0x40,                          // block
+    0x03, 0x40,                          //   loop
+    0x20, 0x02, 0x20, 0x01, 0x4e,        //     counter >= n
+    0x0d, 0x01,                          //     br_if 1
+  ];
+  for (let i = 0; i < 4; i++) {
+    code.push(
+        0x20, 0x00, 0x20, 0x02, 0x6c,    //     acc * counter
+        0x41, ...EncodeU32(index + i),   //     ^ constant
+        0x73,
+        0x20, 0x00, 0x6a,                //     + acc
+        0x21, 0x00);                     //     acc = ...
+  }
+  code.push(
+    0x20, 0x02, 0x41, 0x01, 0x6a,        //     counter + 1
+    0x21, 0x02,                          //     counter = ...
+    0x0c, 0x00,                          //     br 0
+    0x0b,                                //   end
+    0x0b,                                // end
+    0x20, 0x00,                          // acc
+    0x0b);                               // end
+  return [...EncodeU32(code.length), ...code];
+}
+
+const kModuleBytes = (() => {
+  let types = [0x01, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f];
+  let functions = EncodeU32(kFunctionCount);
+  let code = EncodeU32(kFunctionCount);
+  for (let i = 0; i < kFunctionCount; i++) {
+    functions.push(0x00);
+    code.push(...FunctionBody(i));
+  }
+  return new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // Magic and version.
+    ...Section(1, types),
+    ...Section(3, functions),
+    ...Section(10, code),
+  ]);
+})();
+
+createSuite('Module', 100, () => {
+  new WebAssembly.Module(kModuleBytes);
+}, () => {
+  if (!WebAssembly.validate(kModuleBytes)) throw new Error('invalid module');
+});
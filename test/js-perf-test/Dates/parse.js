@@ -0,0 +1,34 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+const kDateCount = 100;
+let isoStrings;
+let utcStrings;
+let legacyStrings;
+
+function SetupDateStrings() {
+  isoStrings = [];
+  utcStrings = [];
+  legacyStrings = [];
+  for (let i = 0; i < kDateCount; i++) {
+    const d = new Date(Date.UTC(2000, 0, 1) + i * 123456789);
+    isoStrings.push(d.toISOString());
+    utcStrings.push(d.toUTCString());
+    legacyStrings.push(d.toString());
+  }
+}
+
+function DateParseISO() {
+  for (let i = 0; i < kDateCount; i++) Date.parse(isoStrings[i]);
+}
+createSuite('DateParseISO', 1000, DateParseISO, SetupDateStrings);
+
+function DateParseUTCString() {
+  for (let i = 0; i < kDateCount; i++) Date.parse(utcStrings[i]);
+}
+createSuite('DateParseUTCString', 1000, DateParseUTCString, SetupDateStrings);
+
+function DateParseLegacy() {
+  for (let i = 0; i < kDateCount; i++) Date.parse(legacyStrings[i]);
+}
+createSuite('DateParseLegacy', 1000, DateParseLegacy, SetupDateStrings);
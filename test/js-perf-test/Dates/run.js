@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 d8.file.execute('../base.js');
 d8.file.execute('toLocaleString.js');
+d8.file.execute('parse.js');
 
 function PrintResult(name, result) {
   console.log(name);
@@ -0,0 +1,46 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Objects whose values are long strings that rarely need escaping, to measure
+// the string serialization loop of JSON.stringify.
+
+function MakeString(chunk, length) {
+  let result = '';
+  while (result.length < length) result += chunk;
+  // Flatten the string so that the benchmark does not measure rope handling.
+  return result.substring(0, length).split('').join('');
+}
+
+function MakeRecords(chunk) {
+  const records = [];
+  for (let i = 0; i < 100; i++) {
+    records.push({
+      id: i,
+      title: MakeString(chunk, 64),
+      body: MakeString(chunk, 1024),
+      escaped: MakeString(chunk, 200) + '"\n' + MakeString(chunk, 200),
+    });
+  }
+  return records;
+}
+
+const ascii_records = MakeRecords('The quick brown fox jumps over the dog. ');
+const latin1_records = MakeRecords('Größenänderung für Fußgänger café. ');
+const two_byte_records = MakeRecords('Быстрая коричневая лиса 快速的棕色狐狸 ');
+
+function StringifyAscii() {
+  return JSON.stringify(ascii_records);
+}
+
+function StringifyLatin1() {
+  return JSON.stringify(latin1_records);
+}
+
+function StringifyTwoByte() {
+  return JSON.stringify(two_byte_records);
+}
+
+createSuiteWithWarmup('StringifyAscii', 1, StringifyAscii);
+createSuiteWithWarmup('StringifyLatin1', 1, StringifyLatin1);
+createSuiteWithWarmup('StringifyTwoByte', 1, StringifyTwoByte);
@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Accessor-heavy code in the style of the class-based JetStream line items.
+// The suites run with --no-turbofan so that they measure Maglev code; compare
+// against a run with --no-maglev-inlining to see the effect of inlining.
+
+new BenchmarkSuite('Getters', [1000], [
+  new Benchmark('Getters', false, false, 0, Getters)
+]);
+
+new BenchmarkSuite('Setters', [1000], [
+  new Benchmark('Setters', false, false, 0, Setters)
+]);
+
+new BenchmarkSuite('SmallMethods', [1000], [
+  new Benchmark('SmallMethods', false, false, 0, SmallMethods)
+]);
+
+// ----------------------------------------------------------------------------
+
+class Vec {
+  constructor(x, y) {
+    this._x = x;
+    this._y = y;
+  }
+  get x() { return this._x; }
+  set x(value) { this._x = value; }
+  get y() { return this._y; }
+  set y(value) { this._y = value; }
+  dot(other) { return this.x * other.x + this.y * other.y; }
+  scale(factor) {
+    this.x *= factor;
+    this.y *= factor;
+    return this;
+  }
+}
+
+const kCount = 100;
+const vecs = [];
+for (let i = 0; i < kCount; i++) vecs.push(new Vec(i, kCount - i));
+
+function Getters() {
+  let sum = 0;
+  for (let i = 0; i < kCount; i++) {
+    sum += vecs[i].x - vecs[i].y;
+  }
+  return sum;
+}
+
+function Setters() {
+  for (let i = 0; i < kCount; i++) {
+    const v = vecs[i];
+    v.x = v.y;
+    v.y = i;
+  }
+}
+
+function SmallMethods() {
+  let sum = 0;
+  for (let i = 1; i < kCount; i++) {
+    sum += vecs[i].scale(1).dot(vecs[i - 1]);
+  }
+  return sum;
+}
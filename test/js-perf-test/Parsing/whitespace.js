@@ -0,0 +1,32 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite("Indentation", [1000], [
+  new Benchmark("Indentation", false, true, iterations, Run, IndentationSetup)
+]);
+
+new BenchmarkSuite("TwoByteComment", [1000], [
+  new Benchmark("TwoByteComment", false, true, iterations, Run,
+                TwoByteCommentSetup)
+]);
+
+new BenchmarkSuite("LicenseComment", [1000], [
+  new Benchmark("LicenseComment", false, true, iterations, Run,
+                LicenseCommentSetup)
+]);
+
+function IndentationSetup() {
+  code = ("\n" + " ".repeat(48) + "x;").repeat(600);
+  %FlattenString(code);
+}
+
+function TwoByteCommentSetup() {
+  code = "// Ein Kommentar – ünïcödé. ".repeat(600);
+  %FlattenString(code);
+}
+
+function LicenseCommentSetup() {
+  code = "/*\n" + " * This is a license comment line...\n".repeat(600) + "*/";
+  %FlattenString(code);
+}
@@ -0,0 +1,37 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Bytecode shapes that dominate the regexp interpreter: greedy loops over
+// character classes, runs of literal characters and skip loops. Run both with
+// and without --regexp-interpret-all to compare the interpreter against
+// native code.
+
+const kWords = (() => {
+  let s = "";
+  for (let i = 0; i < 64; i++) s += "lorem" + i + " ipsum dolor, ";
+  return s;
+})();
+
+function CharClassLoop() {
+  return kWords.match(/[a-z]+\d+/g).length;
+}
+
+function LiteralRun() {
+  return kWords.split(/ipsum dolor/).length;
+}
+
+function SkipUntilChar() {
+  return /,\s*lorem63/.exec(kWords).index;
+}
+
+function CaptureGroups() {
+  return kWords.replace(/(\w+) (\w+)/g, "$2 $1").length;
+}
+
+var benchmarks = [ [CharClassLoop, () => {}],
+                   [LiteralRun, () => {}],
+                   [SkipUntilChar, () => {}],
+                   [CaptureGroups, () => {}],
+                 ];
+createBenchmarkSuite("Interpreter");
@@ -0,0 +1,37 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('IndexOf', [1000], [
+  new Benchmark('IndexOf-Int32', false, false, 0, IndexOfInt32),
+  new Benchmark('IndexOf-Float64', false, false, 0, IndexOfFloat64),
+  new Benchmark('Includes-BigInt64', false, false, 0, IncludesBigInt64),
+]);
+
+const kLength = 10000;
+const int32Array = new Int32Array(kLength);
+const float64Array = new Float64Array(kLength);
+const bigInt64Array = new BigInt64Array(kLength);
+for (let i = 0; i < kLength; ++i) {
+  int32Array[i] = i;
+  float64Array[i] = i + 0.5;
+  bigInt64Array[i] = BigInt(i);
+}
+
+function IndexOfInt32() {
+  if (int32Array.indexOf(kLength - 1) !== kLength - 1) {
+    throw new Error('Unexpected result');
+  }
+}
+
+function IndexOfFloat64() {
+  if (float64Array.indexOf(kLength - 0.5) !== kLength - 1) {
+    throw new Error('Unexpected result');
+  }
+}
+
+function IncludesBigInt64() {
+  if (!bigInt64Array.includes(BigInt(kLength - 1))) {
+    throw new Error('Unexpected result');
+  }
+}
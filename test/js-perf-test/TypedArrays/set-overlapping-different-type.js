@@ -0,0 +1,28 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('SetOverlappingDifferentType', [1000], [
+  new Benchmark('SetOverlappingDifferentType', false, false, 0,
+                SetOverlappingDifferentType),
+]);
+
+const length = 1024;
+
+// All views share one buffer, so every set() below converts between
+// overlapping ranges of different element types.
+const buffer = new ArrayBuffer(length * Float64Array.BYTES_PER_ELEMENT);
+const float64_array = new Float64Array(buffer);
+const float32_array = new Float32Array(buffer);
+const int32_array = new Int32Array(buffer);
+const uint16_array = new Uint16Array(buffer, 0, length);
+const uint8_clamped_array = new Uint8ClampedArray(buffer, 0, length);
+
+function SetOverlappingDifferentType() {
+  for (let i = 0; i < length; i++) float64_array[i] = i + 0.5;
+  float32_array.set(float64_array);
+  float64_array.set(float32_array.subarray(0, length));
+  int32_array.set(float64_array.subarray(0, length));
+  uint16_array.set(int32_array.subarray(0, length));
+  uint8_clamped_array.set(float64_array.subarray(length / 2));
+}
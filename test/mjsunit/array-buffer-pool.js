@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --array-buffer-pool --expose-gc --harmony-rab-gsab-transfer
+
+function assertZero(array) {
+  for (let i = 0; i < array.length; i++) {
+    if (array[i] !== 0) assertUnreachable(`byte ${i} is ${array[i]}`);
+  }
+}
+
+// Reused memory is cleared for new array buffers.
+for (let round = 0; round < 5; round++) {
+  for (const length of [1, 4000, 4096, 5000, 65536]) {
+    let buffers = [];
+    for (let i = 0; i < 10; i++) {
+      const buffer = new ArrayBuffer(length);
+      assertZero(new Uint8Array(buffer));
+      new Uint8Array(buffer).fill(0xab);
+      buffers.push(buffer);
+    }
+    buffers = null;
+    gc();
+  }
+}
+
+// Growing a pooled buffer into the rest of its size class doesn't expose
+// stale bytes.
+{
+  let buffer = new ArrayBuffer(4096);
+  new Uint8Array(buffer).fill(0xcd);
+  buffer = null;
+  gc();
+  buffer = new ArrayBuffer(100);
+  new Uint8Array(buffer).fill(1);
+  const grown = new Uint8Array(buffer.transfer(4096));
+  assertEquals(1, grown[99]);
+  assertZero(grown.subarray(100));
+  const shrunk = new Uint8Array(grown.buffer.transfer(50));
+  assertEquals(50, shrunk.length);
+  assertEquals(1, shrunk[49]);
+}
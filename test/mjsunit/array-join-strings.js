@@ -0,0 +1,46 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Arrays that only contain strings are joined without an intermediate buffer.
+
+function parts(...strings) {
+  const result = [];
+  for (const s of strings) result.push(s);
+  return result;
+}
+
+assertEquals('abc', parts('a', 'b', 'c').join(''));
+assertEquals('a,b,c', parts('a', 'b', 'c').join());
+assertEquals('a--b--c', parts('a', 'b', 'c').join('--'));
+assertEquals(',,', parts('', '', '').join());
+assertEquals('', parts('', '', '').join(''));
+assertEquals('a,,b', parts('a', '', 'b').join());
+assertEquals('hello, hello, hello',
+             parts('hello', 'hello', 'hello').join(', '));
+
+// A single element is returned as is.
+const single = 'x'.repeat(20);
+assertSame(single, parts(single).join('-'));
+
+// Two-byte elements or separators.
+assertEquals('a☃b', parts('a', 'b').join('☃'));
+assertEquals('☃-b', parts('☃', 'b').join('-'));
+
+// Elements that are not strings fall back to the generic path.
+assertEquals('a,1,,b', parts('a', 1, undefined, 'b').join());
+const holey = ['a', , 'b'];
+assertEquals('a,,b', holey.join());
+assertEquals('a,[object Object]', parts('a', {}).join());
+assertEquals('a,x', parts('a', {toString() { return 'x'; }}).join());
+
+// Nested arrays still go through cycle detection.
+const cyclic = ['a', 'b'];
+cyclic.push(cyclic);
+assertEquals('a,b,', cyclic.join());
+
+// The total length is still checked.
+const huge = 'x'.repeat(%StringMaxLength() / 2 + 1);
+assertThrows(() => parts(huge, huge).join(''), RangeError);
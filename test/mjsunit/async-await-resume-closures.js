@@ -0,0 +1,64 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --async-stack-traces
+
+// All awaits of an async function resume it through the same closures.
+// Check that interleaved async functions, and awaits that alternate between
+// fulfilled and rejected values, still resume the right function with the
+// right value.
+
+async function alternate(id, n) {
+  let log = [];
+  for (let i = 0; i < n; i++) {
+    try {
+      log.push(await (i % 2 ? Promise.reject(id + i) : id + i));
+    } catch (e) {
+      log.push(-e);
+    }
+  }
+  return log;
+}
+
+async function thrower(n) {
+  for (let i = 0; i < n; i++) await i;
+  await null;
+  throw new Error();
+}
+
+async function outer(n) {
+  await thrower(n);
+}
+
+function expected(id, n) {
+  let log = [];
+  for (let i = 0; i < n; i++) log.push(i % 2 ? -(id + i) : id + i);
+  return log;
+}
+
+async function test() {
+  let results = await Promise.all([
+    alternate(10, 5), alternate(20, 1), alternate(30, 8), alternate(40, 0)
+  ]);
+  assertEquals(
+      [expected(10, 5), expected(20, 1), expected(30, 8), expected(40, 0)],
+      results);
+
+  try {
+    await outer(3);
+    assertUnreachable();
+  } catch (e) {
+    assertMatches(/Error.+at thrower.+at async outer/ms, e.stack);
+  }
+}
+
+assertPromiseResult((async () => {
+  %PrepareFunctionForOptimization(alternate);
+  %PrepareFunctionForOptimization(thrower);
+  await test();
+  await test();
+  %OptimizeFunctionOnNextCall(alternate);
+  %OptimizeFunctionOnNextCall(thrower);
+  await test();
+})());
@@ -0,0 +1,30 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc --stress-compaction
+// Flags: --code-space-hotness-layout --trace-code-working-set
+
+// Optimized code that is moved to separate pages by compacting GCs keeps
+// working, and so does the unoptimized code it is mixed with.
+
+function hot(x) {
+  return x * 2 + 1;
+}
+%PrepareFunctionForOptimization(hot);
+hot(1);
+hot(2);
+%OptimizeFunctionOnNextCall(hot);
+hot(3);
+
+let cold = [];
+for (let i = 0; i < 100; i++) {
+  cold.push(new Function('x', `return x + ${i};`));
+  cold[i](i);
+}
+
+for (let i = 0; i < 3; i++) {
+  gc();
+  assertEquals(2 * i + 1, hot(i));
+  for (let j = 0; j < cold.length; j++) assertEquals(i + j, cold[j](i));
+}
@@ -0,0 +1,23 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Line terminators must end single-line comments and be seen in whitespace
+// at any offset, including across the blocks the scanner skips at once.
+
+for (let terminator of ["\n", "\r", " ", " "]) {
+  for (let i = 0; i < 40; i++) {
+    let padding = "x".repeat(i);
+    assertEquals(1, eval("//" + padding + terminator + "1"));
+    assertEquals(2, eval("/*" + padding + terminator + "*/ 2"));
+    // A line terminator in a multi-line comment allows ASI.
+    assertEquals(3, eval("var a = 3 /*" + padding + terminator + "*/ a"));
+    // Line terminators within indentation allow ASI too.
+    assertEquals(4, eval("var b = 4" + " ".repeat(i) + terminator +
+                         " ".repeat(i) + "b"));
+  }
+}
+
+// Non-ASCII characters close to the line terminators don't hide them.
+assertEquals(5, eval("// ‧‪é" + " " + "5"));
+assertThrows(() => eval("var c = 6" + " ".repeat(33) + "c"), SyntaxError);
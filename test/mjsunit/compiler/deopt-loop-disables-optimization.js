@@ -0,0 +1,28 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-maglev --max-deopt-count=2
+// Flags: --no-always-turbofan
+
+function load(o) {
+  return o.x;
+}
+
+const objects = [{x: 1}, {y: 1, x: 2}, {z: 1, x: 3}];
+
+// Every new map causes a wrong-map deopt of the optimized code.
+%PrepareFunctionForOptimization(load);
+for (let i = 0; i < 2; i++) {
+  assertEquals(i + 1, load(objects[i]));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(i + 1, load(objects[i]));
+  assertOptimized(load);
+  assertEquals(i + 2, load(objects[i + 1]));
+  assertUnoptimized(load);
+}
+
+// Without Maglev to fall back to, the function is not optimized anymore.
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load(objects[0]));
+assertUnoptimized(load);
@@ -0,0 +1,30 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// Materializes objects whose fields mix Smis, doubles and heap objects.
+
+function f(x, y) {
+  var o = {smi: x, dbl: y + 0.5, str: "s", nested: {smi: x + 1, dbl: y}};
+  var a = [x, x + 1, o];
+  %_DeoptimizeNow();
+  return [o, a];
+}
+
+%PrepareFunctionForOptimization(f);
+f(1, 1.5);
+f(2, 2.5);
+%OptimizeFunctionOnNextCall(f);
+var [o, a] = f(3, 3.5);
+assertEquals(3, o.smi);
+assertEquals(4, o.dbl);
+assertEquals("s", o.str);
+assertEquals(4, o.nested.smi);
+assertEquals(3.5, o.nested.dbl);
+assertEquals([3, 4, o], a);
+
+// Storing a Smi into a double field must still produce a mutable box.
+o.dbl = 1.25;
+assertEquals(1.25, o.dbl);
@@ -0,0 +1,15 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --bench=run --bench-warmup=2 --bench-iterations=3 --bench-cpu=0
+
+// d8 calls the benchmark function once for each warmup and measured
+// iteration after the script ran, and fails if it throws.
+let calls = 0;
+function run() {
+  if (++calls > 5) throw new Error('Benchmark ran too often');
+  let result = [];
+  for (let i = 0; i < 1000; i++) result.push({i});
+  return result;
+}
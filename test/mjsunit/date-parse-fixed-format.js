@@ -0,0 +1,71 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Date strings in the formats produced by toISOString and toUTCString.
+const dates = [
+  Date.UTC(1970, 0, 1),
+  Date.UTC(2024, 1, 29, 23, 59, 59, 999),
+  Date.UTC(1, 5, 15, 12, 30, 45, 7),
+  Date.UTC(9999, 11, 31, 23, 59, 59, 999),
+  -1,
+];
+for (const time of dates) {
+  const date = new Date(time);
+  assertEquals(time, Date.parse(date.toISOString()));
+  assertEquals(new Date(date.getUTCFullYear(), date.getUTCMonth(),
+                        date.getUTCDate(), date.getUTCHours(),
+                        date.getUTCMinutes(), date.getUTCSeconds(),
+                        date.getUTCMilliseconds()).getTime(),
+               Date.parse(date.toISOString().slice(0, -1)));
+  assertEquals(time - date.getUTCMilliseconds(),
+               Date.parse(date.toISOString().slice(0, 19) + 'Z'));
+  if (date.getUTCFullYear() >= 1000) {
+    assertEquals(time - date.getUTCMilliseconds(),
+                 Date.parse(date.toUTCString()));
+  }
+}
+
+for (const weekday of ['Sun', 'Mon', 'Tue', 'Wed', 'Thu', 'Fri', 'Sat']) {
+  assertEquals(Date.UTC(2000, 0, 1, 10, 20, 30),
+               Date.parse(`${weekday}, 01 Jan 2000 10:20:30 GMT`));
+}
+const months = ['Jan', 'Feb', 'Mar', 'Apr', 'May', 'Jun',
+                'Jul', 'Aug', 'Sep', 'Oct', 'Nov', 'Dec'];
+for (let i = 0; i < months.length; i++) {
+  assertEquals(Date.UTC(2000, i, 28),
+               Date.parse(`Fri, 28 ${months[i]} 2000 00:00:00 GMT`));
+}
+
+// Legacy dates keep their two-digit year handling.
+assertEquals(Date.UTC(2049, 0, 1), Date.parse('Fri, 01 Jan 0049 00:00:00 GMT'));
+assertEquals(Date.UTC(1999, 0, 1), Date.parse('Fri, 01 Jan 0099 00:00:00 GMT'));
+// ISO dates don't.
+assertEquals(new Date(0).setUTCFullYear(49),
+             Date.parse('0049-01-01T00:00:00.000Z'));
+
+// Inputs that look similar but are handled by the general parser.
+assertEquals(Date.UTC(2000, 0, 2), Date.parse('2000-01-01T24:00:00.000Z'));
+assertEquals(Date.UTC(2000, 0, 1, 1), Date.parse('2000-01-01t01:00:00.000z'));
+assertEquals(Date.UTC(2000, 0, 1, 0, 0, 0, 123),
+             Date.parse('2000-01-01T00:00:00.123456Z'));
+assertEquals(Date.UTC(2000, 0, 1, 1),
+             Date.parse('2000-01-01T00:00:00.000-01:00'));
+assertEquals(Date.UTC(2000, 0, 1, 10, 20, 30),
+             Date.parse('Saturday, 01 Jan 2000 10:20:30 GMT'));
+assertEquals(Date.UTC(2000, 0, 1, 10, 20, 30),
+             Date.parse('sat, 01 jan 2000 10:20:30 gmt'));
+assertEquals(Date.UTC(2000, 0, 1, 9, 20, 30),
+             Date.parse('Sat, 01 Jan 2000 10:20:30 GMT+0100'));
+
+// Invalid dates.
+assertEquals(NaN, Date.parse('2000-13-01T00:00:00.000Z'));
+assertEquals(NaN, Date.parse('2000-01-32T00:00:00.000Z'));
+assertEquals(NaN, Date.parse('2000-01-01T25:00:00.000Z'));
+assertEquals(NaN, Date.parse('2000-01-01T00:60:00.000Z'));
+assertEquals(NaN, Date.parse('2000-01-01T00:00:60.000Z'));
+assertEquals(NaN, Date.parse('2000-01-01T00:00:00.000Zx'));
+assertEquals(NaN, Date.parse('2000-01-01T00:00:0a.000Z'));
+assertEquals(NaN, Date.parse('Sat, 00 Jan 2000 10:20:30 GMT'));
+assertEquals(NaN, Date.parse('Sat, 01 Jan 2000 24:20:30 GMT'));
+assertEquals(NaN, Date.parse('Sat, 01 Jan 2000 10:60:30 GMT'));
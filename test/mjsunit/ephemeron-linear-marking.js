@@ -0,0 +1,39 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --ephemeron-fixpoint-iterations=1
+
+// A long chain of ephemerons, where each value holds the key of the next
+// entry and a large number of other objects. This forces the linear
+// ephemeron algorithm, and marking discovers many more objects than there
+// are ephemeron keys.
+
+const kChainLength = 200;
+const kPayloadSize = 1000;
+
+let map = new WeakMap();
+let first = {};
+
+(function BuildChain() {
+  let key = first;
+  for (let i = 0; i < kChainLength; i++) {
+    let payload = [];
+    for (let j = 0; j < kPayloadSize; j++) payload.push({j});
+    let next = {};
+    map.set(key, {index: i, next, payload});
+    key = next;
+  }
+})();
+
+gc();
+
+let key = first;
+for (let i = 0; i < kChainLength; i++) {
+  let value = map.get(key);
+  assertEquals(i, value.index);
+  assertEquals(kPayloadSize, value.payload.length);
+  assertEquals(kPayloadSize - 1, value.payload[kPayloadSize - 1].j);
+  key = value.next;
+}
+assertFalse(map.has(key));
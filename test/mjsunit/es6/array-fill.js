@@ -2,7 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
-// Flags: --allow-natives-syntax
+// Flags: --allow-natives-syntax --expose-gc
 
 assertEquals(1, Array.prototype.fill.length);
 
@@ -125,3 +125,25 @@ function TestFillFrozenObject() {
   assertThrows(() => Array.prototype.fill.call(object), TypeError);
 }
 TestFillFrozenObject();
+
+function TestFillHoleyArraysWithHeapObjects() {
+  // The fast path records the filled range with a single write barrier.
+  // Make sure the stored objects survive a GC of an old backing store.
+  let array = new Array(200);
+  gc();
+  gc();
+  array.fill({ value: 1 }, 10, 150);
+  array.fill("x".repeat(20), 50, 60);
+  gc();
+  %HeapObjectVerify(array);
+  assertFalse(array.hasOwnProperty(9));
+  assertEquals(1, array[10].value);
+  assertEquals("xxxxxxxxxxxxxxxxxxxx", array[55]);
+  assertEquals(1, array[149].value);
+  assertFalse(array.hasOwnProperty(150));
+
+  let doubles = [1.5, , 2.5, , , 3.5];
+  doubles.fill(NaN, 1, 4);
+  assertEquals([1.5, NaN, NaN, NaN, , 3.5], doubles);
+}
+TestFillHoleyArraysWithHeapObjects();
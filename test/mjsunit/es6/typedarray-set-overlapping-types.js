@@ -0,0 +1,52 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// TypedArray.prototype.set between overlapping views of different types has
+// to behave as if the source was copied before any element is stored.
+
+const kTypes = [
+  Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+  Int32Array, Uint32Array, Float32Array, Float64Array
+];
+const kBufferSize = 128;
+
+function Fill(buffer) {
+  const bytes = new Uint8Array(buffer);
+  for (let i = 0; i < bytes.length; i++) bytes[i] = (i * 37 + 11) & 0xFF;
+  // Make sure there are some values that need clamping or rounding.
+  const doubles = new Float64Array(buffer, 0, 4);
+  doubles.set([-1.5, 2.5, 300.25, NaN]);
+}
+
+function TestSet(Source, Target, source_offset, target_offset, length) {
+  const buffer = new ArrayBuffer(kBufferSize);
+  Fill(buffer);
+  const expected_buffer = buffer.slice(0);
+  const source = new Source(buffer, source_offset, length);
+  const target = new Target(buffer, target_offset);
+  if (target.length < length) return;
+
+  const expected_target = new Target(expected_buffer, target_offset);
+  expected_target.set(source.slice());
+
+  target.set(source);
+  assertEquals(new Uint8Array(expected_buffer), new Uint8Array(buffer),
+               `${Source.name}(${source_offset}, ${length}) -> ` +
+               `${Target.name}(${target_offset})`);
+}
+
+for (const Source of kTypes) {
+  for (const Target of kTypes) {
+    if (Source === Target) continue;
+    const alignment = Math.max(Source.BYTES_PER_ELEMENT,
+                               Target.BYTES_PER_ELEMENT);
+    for (let source_offset = 0; source_offset <= 48;
+         source_offset += alignment) {
+      for (let target_offset = 0; target_offset <= 48;
+           target_offset += alignment) {
+        TestSet(Source, Target, source_offset, target_offset, 8);
+      }
+    }
+  }
+}
@@ -149,3 +149,32 @@ for (let constructor of constructorsWithArrays) {
   assertArrayLikeEquals(array, constructor.array.reverse(), constructor.ctor);
   assertEquals(array.length, constructor.array.length);
 }
+
+// Long arrays take a different path for the default comparison. Check it
+// against a custom comparison, including the edge cases of each type.
+function cmpNumeric(a, b) {
+  if (a < b) return -1;
+  if (b < a) return 1;
+  if (a === 0 && b === 0) {
+    return Object.is(a, b) ? 0 : Object.is(a, -0) ? -1 : 1;
+  }
+  if (a !== a) return b !== b ? 0 : 1;
+  if (b !== b) return -1;
+  return 0;
+}
+
+for (let constructor of constructorsWithArrays) {
+  const kLength = 1000;
+  let edge_cases = constructor.array;
+  if (constructor.ctor === Float32Array || constructor.ctor === Float64Array) {
+    edge_cases = edge_cases.concat([-0, NaN, Infinity, -Infinity, 0.5, -0.5]);
+  }
+  let array = new constructor.ctor(kLength);
+  for (let i = 0; i < kLength; ++i) {
+    array[i] = edge_cases[(i * 7919) % edge_cases.length];
+  }
+  let expected = Array.from(array).sort(cmpNumeric);
+
+  assertEquals(array.sort(), array);
+  assertArrayLikeEquals(array, expected, constructor.ctor);
+}
@@ -170,3 +170,27 @@ function TestTransfer(method) {
 
 TestTransfer('transfer');
 TestTransfer('transferToFixedLength');
+
+(function TestTransferResizableKeepsMaxByteLength() {
+  const len = 1024;
+  let ab = new ArrayBuffer(len, {maxByteLength: len * 64});
+  new Uint8Array(ab).fill(7);
+  // Grow in several steps, as code that streams into a buffer would.
+  for (let newLen of [len * 2, len * 16, len * 64, len / 2, len * 3]) {
+    const oldLen = ab.byteLength;
+    const xfer = ab.transfer(newLen);
+    assertTrue(ab.detached);
+    assertTrue(xfer.resizable);
+    assertEquals(len * 64, xfer.maxByteLength);
+    assertEquals(newLen, xfer.byteLength);
+    const u8 = new Uint8Array(xfer);
+    for (let i = 0; i < newLen; i++) {
+      assertEquals(i < Math.min(oldLen, len) ? 7 : 0, u8[i]);
+    }
+    ab = xfer;
+  }
+  // The transferred buffer can still be resized up to its maximum.
+  ab.resize(len * 64);
+  assertEquals(0, new Uint8Array(ab)[len * 64 - 1]);
+  assertThrows(() => ab.transfer(len * 64 + 1), RangeError);
+})();
@@ -0,0 +1,30 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Nested object literals at the same depth in an array of records share maps.
+var records = JSON.parse(
+    '[{"id": 1, "pos": {"x": 1, "y": 2}, "tags": [{"k": "a", "v": 1}]},' +
+    ' {"id": 2, "pos": {"x": 3, "y": 4}, "tags": [{"k": "b", "v": 2}]},' +
+    ' {"id": 3, "pos": {"x": 5.5, "y": 6}, "tags": []}]');
+assertTrue(%HaveSameMap(records[0], records[1]));
+assertTrue(%HaveSameMap(records[1], records[2]));
+assertTrue(%HaveSameMap(records[0].pos, records[1].pos));
+assertTrue(%HaveSameMap(records[1].pos, records[2].pos));
+assertTrue(%HaveSameMap(records[0].tags[0], records[1].tags[0]));
+assertEquals(5.5, records[2].pos.x);
+assertEquals(3, records[1].pos.x);
+assertEquals("b", records[1].tags[0].k);
+
+// Mismatching shapes at the same depth fall back to the generic path.
+var mixed = JSON.parse(
+    '[{"a": {"x": 1, "y": 2}}, {"a": {"y": 1, "x": 2}}, {"a": {"x": 3}},' +
+    ' {"a": {"x": 4, "y": 5, "z": 6}}, {"a": {"1": 1, "x": 7}}]');
+assertEquals(2, mixed[1].a.x);
+assertEquals(["y", "x"], Object.keys(mixed[1].a));
+assertEquals(["x"], Object.keys(mixed[2].a));
+assertEquals(["x", "y", "z"], Object.keys(mixed[3].a));
+assertEquals(["1", "x"], Object.keys(mixed[4].a));
+assertTrue(%HaveSameMap(mixed[0].a, JSON.parse('{"x": 0, "y": 0}')));
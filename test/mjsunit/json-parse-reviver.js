@@ -0,0 +1,69 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The reviver sees properties in enumeration order and observes its own
+// changes to the holder.
+
+(function TestOrder() {
+  const log = [];
+  JSON.parse('{"b": 1, "2": 2, "a": {"y": 3, "x": 4}, "1": [5, 6]}',
+             (key, value) => (log.push(key), value));
+  assertEquals(["0", "1", "1", "2", "b", "y", "x", "a", ""], log);
+})();
+
+(function TestReviverChangesHolder() {
+  const result = JSON.parse('{"a": 1, "b": 2, "c": 3, "d": 4}',
+                            function(key, value) {
+    if (key === "a") {
+      delete this.b;
+      this.c = "changed";
+      this.e = "added";
+    }
+    return typeof value === "number" ? value * 10 : value;
+  });
+  // "b" was deleted and Get(holder, "b") is undefined, so it stays deleted.
+  // "e" was added after the keys were collected, so it is not revived.
+  assertEquals({a: 10, c: "changed", d: 40, e: "added"}, result);
+})();
+
+(function TestReviverSeesPrototype() {
+  Object.prototype.fromProto = "proto";
+  try {
+    const seen = [];
+    const result = JSON.parse('{"a": 1, "fromProto": 2}', function(key, value) {
+      if (key === "a") delete this.fromProto;
+      seen.push(key);
+      return value;
+    });
+    assertEquals(["a", "fromProto", ""], seen);
+    // Get(holder, "fromProto") found the inherited value.
+    assertEquals("proto", Object.getOwnPropertyDescriptor(result,
+                                                          "fromProto").value);
+  } finally {
+    delete Object.prototype.fromProto;
+  }
+})();
+
+(function TestUndefinedRemovesProperty() {
+  const result = JSON.parse('[{"keep": 1, "drop": 2}, 3, {"x": [4, 5]}]',
+                            (key, value) => key === "drop" || value === 4 ?
+                                undefined : value);
+  assertEquals({keep: 1}, result[0]);
+  assertFalse(0 in result[2].x);
+  assertEquals(5, result[2].x[1]);
+})();
+
+(function TestFrozenHolder() {
+  const result = JSON.parse('{"a": 1, "b": 2}', function(key, value) {
+    if (key === "a") Object.freeze(this);
+    return typeof value === "number" ? value + 1 : value;
+  });
+  assertEquals({a: 1, b: 2}, result);
+})();
+
+(function TestRevivedObjectsAreVisited() {
+  const result = JSON.parse('{"outer": {"inner": 1}}', (key, value) =>
+      key === "inner" ? {replaced: true} : value);
+  assertEquals({outer: {inner: {replaced: true}}}, result);
+})();
@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-fast-api --allow-natives-syntax --maglev --no-turbofan
+// Flags: --maglev-fast-api-calls --no-always-turbofan --deopt-every-n-times=0
+
+const fast_c_api = new d8.test.FastCAPI();
+
+// `add_32bit_int_no_options` has the following signature:
+// int add_32bit_int_no_options(int32_t, uint32_t)
+
+function add(a, b) {
+  return fast_c_api.add_32bit_int_no_options(a | 0, b >>> 0);
+}
+
+%PrepareFunctionForOptimization(add);
+assertEquals(3, add(1, 2));
+assertEquals(3, add(1.5, 2.5));
+%OptimizeMaglevOnNextCall(add);
+fast_c_api.reset_counts();
+assertEquals(-42 + 45, add(-42, 45));
+assertEquals(7, add(3.5, 4.5));
+if (isMaglevved(add)) {
+  // Maglev calls the C function directly.
+  assertEquals(2, fast_c_api.fast_call_count());
+  assertEquals(0, fast_c_api.slow_call_count());
+}
+
+// Arguments that aren't known to be numbers take the slow callback.
+function add_unknown(a, b) {
+  return fast_c_api.add_32bit_int_no_options(a, b);
+}
+
+%PrepareFunctionForOptimization(add_unknown);
+assertEquals(3, add_unknown(1, 2));
+%OptimizeMaglevOnNextCall(add_unknown);
+fast_c_api.reset_counts();
+assertEquals(3, add_unknown(1, 2));
+assertEquals(0, add_unknown('1', {}));
+if (isMaglevved(add_unknown)) {
+  assertEquals(0, fast_c_api.fast_call_count());
+  assertEquals(2, fast_c_api.slow_call_count());
+}
+
+// `add_32bit_int_or_fallback` has the following signature:
+// int add_32bit_int_or_fallback(int32_t, uint32_t, FastApiCallbackOptions&)
+// It requests the slow callback for sums that don't fit into an int32.
+
+function add_or_fallback(a, b) {
+  return fast_c_api.add_32bit_int_or_fallback(a | 0, b >>> 0);
+}
+
+%PrepareFunctionForOptimization(add_or_fallback);
+assertEquals(3, add_or_fallback(1, 2));
+%OptimizeMaglevOnNextCall(add_or_fallback);
+fast_c_api.reset_counts();
+assertEquals(3, add_or_fallback(1, 2));
+assertEquals(0x80000000, add_or_fallback(0x7fffffff, 1));
+assertEquals(-1, add_or_fallback(-2, 1));
+if (isMaglevved(add_or_fallback)) {
+  // The fast C function is called every time, the slow callback only when it
+  // requests the fallback.
+  assertEquals(3, fast_c_api.fast_call_count());
+  assertEquals(1, fast_c_api.slow_call_count());
+}
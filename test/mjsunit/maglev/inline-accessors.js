@@ -0,0 +1,54 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-inlining --no-turbofan
+
+class Point {
+  constructor(x, y) {
+    this._x = x;
+    this._y = y;
+  }
+  get x() {
+    return this._x + 1;
+  }
+  set x(value) {
+    this._x = value;
+  }
+  get y() {
+    return this._y;
+  }
+}
+
+function foo(p) {
+  p.x = p.x;
+  return p.x + p.y;
+}
+
+%PrepareFunctionForOptimization(foo);
+assertEquals(5, foo(new Point(1, 2)));
+assertEquals(5, foo(new Point(1, 2)));
+
+%OptimizeMaglevOnNextCall(foo);
+assertEquals(5, foo(new Point(1, 2)));
+assertTrue(isMaglevved(foo));
+
+// The addition in the inlined getter deopts on a non-Smi field.
+assertEquals(5.5, foo(new Point(1.5, 2)));
+assertEquals("a11b", foo(new Point("a", "b")));
+
+// Small mutually recursive functions must not be inlined indefinitely.
+function even(n) {
+  return n == 0 ? true : odd(n - 1);
+}
+function odd(n) {
+  return n == 0 ? false : even(n - 1);
+}
+
+%PrepareFunctionForOptimization(even);
+%PrepareFunctionForOptimization(odd);
+assertTrue(even(20));
+assertFalse(even(21));
+%OptimizeMaglevOnNextCall(even);
+assertTrue(even(30));
+assertFalse(even(31));
@@ -0,0 +1,27 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-turbofan
+// Flags: --maglev-inline-unboxed-calls
+
+function square(x) { return x * x; }
+
+// The call to {square} is infrequent, but it is passed an unboxed float64 and
+// its result is used as a float64 again, so it is inlined anyway.
+function f(x, rare) {
+  let y = x * 1.5;
+  if (rare) y = square(y) + 0.25;
+  return y;
+}
+
+%PrepareFunctionForOptimization(square);
+%PrepareFunctionForOptimization(f);
+for (let i = 0; i < 100; i++) f(i, i == 0);
+assertEquals(3, f(2, false));
+assertEquals(9.25, f(2, true));
+%OptimizeMaglevOnNextCall(f);
+assertEquals(3, f(2, false));
+assertEquals(9.25, f(2, true));
+assertEquals(0.25, f(0, true));
+assertTrue(isMaglevved(f));
@@ -0,0 +1,44 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-licm --no-turbofan
+
+function sumUpTo(o) {
+  let sum = 0;
+  // The map check and the load of o.length in the loop condition are loop
+  // invariant and hoisted out of the loop.
+  for (let i = 0; i < o.length; i++) {
+    sum += i;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(sumUpTo);
+assertEquals(45, sumUpTo({length: 10}));
+assertEquals(45, sumUpTo({length: 10}));
+%OptimizeMaglevOnNextCall(sumUpTo);
+assertEquals(45, sumUpTo({length: 10}));
+assertEquals(4950, sumUpTo({length: 100}));
+assertTrue(isMaglevved(sumUpTo));
+
+// The hoisted map check deopts before the first iteration.
+assertEquals(3, sumUpTo({foo: 1, length: 3}));
+assertFalse(isMaglevved(sumUpTo));
+
+function countDown(o) {
+  let count = 0;
+  // The store to o.length keeps the map check and the load in the loop.
+  while (o.length > 0) {
+    o.length--;
+    count++;
+  }
+  return count;
+}
+
+%PrepareFunctionForOptimization(countDown);
+assertEquals(3, countDown({length: 3}));
+assertEquals(3, countDown({length: 3}));
+%OptimizeMaglevOnNextCall(countDown);
+assertEquals(5, countDown({length: 5}));
+assertTrue(isMaglevved(countDown));
@@ -0,0 +1,50 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-turbofan
+
+function inc(x) { return x + 1; }
+%NeverOptimizeFunction(inc);
+
+// {a}, {b} and {c} are live across the loop but only used after it, so their
+// live ranges are split at the loop entry.
+function liveThrough(n, x) {
+  let a = x * 2;
+  let b = x + 0.5;
+  let c = x | 7;
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum = inc(sum);
+  }
+  return a + b + c + sum;
+}
+
+%PrepareFunctionForOptimization(liveThrough);
+assertEquals(liveThrough(10, 3), 26.5);
+%OptimizeMaglevOnNextCall(liveThrough);
+assertEquals(liveThrough(10, 3), 26.5);
+assertEquals(liveThrough(0, 3), 16.5);
+assertEquals(liveThrough(100, 1), 110.5);
+assertTrue(isMaglevved(liveThrough));
+
+// Same, with an inner loop and a value used in the outer loop only.
+function nested(n, x) {
+  let a = x * 3;
+  let b = x + 1;
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    for (let j = 0; j < n; j++) {
+      sum = inc(sum);
+    }
+    sum += b;
+  }
+  return a + sum;
+}
+
+%PrepareFunctionForOptimization(nested);
+assertEquals(nested(3, 2), 24);
+%OptimizeMaglevOnNextCall(nested);
+assertEquals(nested(3, 2), 24);
+assertEquals(nested(0, 2), 6);
+assertTrue(isMaglevved(nested));
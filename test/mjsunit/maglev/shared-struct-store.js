@@ -0,0 +1,46 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --maglev --harmony-struct --allow-natives-syntax --verify-heap
+
+// Maglev stores Smis to shared struct fields directly. Any other value still
+// goes through the IC, which shares it first.
+
+const Box = new SharedStructType(['payload']);
+
+function increment(box) {
+  box.payload = box.payload + 1;
+}
+
+let box = new Box();
+box.payload = 0;
+%PrepareFunctionForOptimization(increment);
+increment(box);
+increment(box);
+%OptimizeMaglevOnNextCall(increment);
+increment(box);
+assertEquals(3, box.payload);
+assertTrue(isMaglevved(increment));
+
+// With 31-bit Smis, the result is no Smi, so the Smi check deopts instead of
+// storing a local HeapNumber.
+box.payload = 2 ** 30 - 1;
+increment(box);
+assertEquals(2 ** 30, box.payload);
+
+function storeValue(box, value) {
+  box.payload = value;
+}
+
+%PrepareFunctionForOptimization(storeValue);
+storeValue(box, 1.5);
+storeValue(box, 'foo');
+%OptimizeMaglevOnNextCall(storeValue);
+storeValue(box, 2000000000.5);
+assertEquals(2000000000.5, box.payload);
+storeValue(box, 'bar');
+assertEquals('bar', box.payload);
+
+// SharedGC verifies that there are no shared->local edges.
+%SharedGC();
@@ -0,0 +1,22 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --streaming-compile
+
+// Sibling imports are streamed in parallel, including ones that also import
+// each other.
+import {a, get_a, set_a} from "modules-skip-1.mjs";
+import {b, c, zzz} from "modules-skip-2.mjs";
+import * as star from "modules-skip-4.mjs";
+
+assertEquals(1, a);
+assertEquals(1, b);
+assertEquals(1, c);
+assertEquals(999, zzz);
+assertEquals(1, star.a);
+set_a(2);
+assertEquals(2, get_a());
+assertEquals(2, star.a);
+assertEquals(2, b);
+assertEquals(2, c);
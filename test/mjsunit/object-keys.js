@@ -115,3 +115,35 @@
       ],
       log);
 })();
+
+// Object.keys results for dictionary mode objects may be cached. Changes to
+// the object and to previously returned arrays must not leak into the cache.
+(function() {
+  const o = {a: 1, b: 2, c: 3};
+  delete o.b;
+  assertFalse(%HasFastProperties(o));
+
+  let keys = Object.keys(o);
+  assertEquals(['a', 'c'], keys);
+  keys.push('x');
+  keys[0] = 'y';
+  assertEquals(['a', 'c'], Object.keys(o));
+  assertNotSame(Object.keys(o), Object.keys(o));
+
+  o.d = 4;
+  assertEquals(['a', 'c', 'd'], Object.keys(o));
+  Object.defineProperty(o, 'a', {enumerable: false});
+  assertEquals(['c', 'd'], Object.keys(o));
+  o[Symbol('s')] = 5;
+  assertEquals(['c', 'd'], Object.keys(o));
+  delete o.c;
+  o.c = 6;
+  assertEquals(['d', 'c'], Object.keys(o));
+  o[0] = 7;
+  assertEquals(['0', 'd', 'c'], Object.keys(o));
+  delete o[0];
+  assertEquals(['d', 'c'], Object.keys(o));
+  delete o.d;
+  delete o.c;
+  assertEquals([], Object.keys(o));
+})();
@@ -0,0 +1,10 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-dfa-budget=1
+
+// With a tiny budget the DFAs run out of memory in the middle of a search and
+// the engine falls back to the NFA.
+d8.file.execute("test/mjsunit/regexp-experimental-dfa.js");
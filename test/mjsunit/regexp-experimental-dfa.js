@@ -0,0 +1,52 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+
+// The experimental engine finds the bounds of matches with a lazily built DFA
+// and only runs the NFA for captures. Its matches must be the same a
+// backtracking engine reports.
+
+function Test(regexp, subject, expected) {
+  assertEquals("EXPERIMENTAL", %RegexpTypeTag(regexp));
+  let result = subject.match(regexp);
+  if (expected === null) {
+    assertNull(result);
+  } else {
+    assertArrayEquals(expected, Array.from(result));
+  }
+}
+
+// Leftmost match, with priorities of alternatives and quantifiers.
+Test(/abcd|c/, "xabcd", ["abcd"]);
+Test(/c|abcd/, "xabcd", ["abcd"]);
+Test(/a|ab/, "ab", ["a"]);
+Test(/ab|a/, "ab", ["ab"]);
+Test(/a+/, "xaaa", ["aaa"]);
+Test(/a+?/, "xaaa", ["a"]);
+Test(/a*?b/, "aaab", ["aaab"]);
+Test(/(a|ab)(c|bcd)/, "abcd", ["abc", "a", "bc"]);
+Test(/x*/, "aaa", [""]);
+Test(/b*$/, "abb", ["bb"]);  // Assertions use the NFA only.
+Test(/\d{3}-\d{4}/, "call 555-1234 now", ["555-1234"]);
+Test(/foo/, "barbaz".repeat(100), null);
+Test(/foo/y, "xfoo", null);
+
+// Two-byte subjects and patterns.
+Test(/☃+/, "abc☃☃☃def", ["☃☃☃"]);
+Test(/[一-龥]+/, "hello 世界 world", ["世界"]);
+Test(/[^a]+/, "aaa☃bc", ["☃bc"]);
+
+// Global matches, including empty ones.
+Test(/a|b/g, "xaybz", ["a", "b"]);
+Test(/a*/g, "baab", ["", "aa", "", ""]);
+Test(/\w+/g, "the quick  fox", ["the", "quick", "fox"]);
+Test(/o/g, "o".repeat(1000), Array(1000).fill("o"));
+
+// Captures.
+let re = /(\w+)@(\w+)\.com/;
+assertEquals(["me@example.com", "me", "example"],
+             Array.from(re.exec("mail me@example.com!")));
+assertEquals(["ab", undefined, "b", undefined],
+             Array.from(/(a)?(?:a)(b)|(a)b/.exec("ab")));
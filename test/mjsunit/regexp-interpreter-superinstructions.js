@@ -0,0 +1,34 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-interpret-all --regexp-peephole-optimization
+
+// The peephole optimizer fuses greedy character class loops and runs of
+// literal characters into single bytecodes. Check that they stop at the end of
+// the input, at the first character out of range, and at the first mismatching
+// literal.
+
+(function TestCharClassLoop() {
+  assertEquals(['abc1'], 'abc1'.match(/[a-z]*\d/));
+  assertEquals(['1'], '1'.match(/[a-z]*\d/));
+  assertNull('abcdef'.match(/[a-z]*\d/));
+  assertEquals(['xyz', 'ab'], 'xyz-ab'.match(/[a-z]+/g));
+  assertEquals(['abc'], 'Aabc'.match(/[a-z]+$/));
+  assertEquals(['bb'], 'Abb{'.match(/[a-z]+/));
+  assertEquals(['ሴሴ'], '-ሴሴ-'.match(/[ሰ-ሹ]+/));
+})();
+
+(function TestLiteralRun() {
+  for (let i = 1; i <= 9; i++) {
+    let literal = 'abcdefghi'.substring(0, i);
+    let re = new RegExp(literal);
+    assertEquals(3, ('xyz' + literal).search(re));
+    assertEquals(-1, ('xyz' + literal.substring(0, i - 1)).search(re));
+    // Mismatch on the last character.
+    assertEquals(-1, (literal.substring(0, i - 1) + 'X').search(re));
+  }
+  assertEquals(['一丁七'], '--一丁七--'.match(/一丁七/));
+  assertNull('--一丁丁--'.match(/一丁七/));
+  assertEquals(['abcd'], 'abcabdabcd'.match(/abcd/));
+})();
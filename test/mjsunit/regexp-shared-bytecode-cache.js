@@ -0,0 +1,35 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-shared-bytecode-cache-size=64 --regexp-interpret-all
+
+// Regexps compiled to bytecode in one realm are reused by the others. Check
+// that a reused regexp behaves like a freshly compiled one, including its named
+// captures and flags.
+
+const kSource = `
+  let named = /(?<year>\\d{4})-(?<month>\\d\\d)(?:-(?<day>\\d\\d))?/;
+  let m = named.exec('on 2023-07-14 and');
+  [m.index, m.groups.year, m.groups.month, m.groups.day,
+   'x1999-01x'.replace(named, '$<month>/$<year>'),
+   /abc/i.test('xABCx'), /abc/.test('xABCx'),
+   'a1b22c333'.match(/\\d+/g).join(),
+   String(/(?<a>x)|(?<b>y)/.exec('y').groups.b)]
+`;
+
+const kExpected =
+    [3, '2023', '07', '14', 'x01/1999x', true, false, '1,22,333', 'y'];
+
+for (let i = 0; i < 5; i++) {
+  let realm = Realm.create();
+  assertEquals(kExpected, Realm.eval(realm, kSource));
+  Realm.dispose(realm);
+}
+assertEquals(kExpected, eval(kSource));
+
+// Same source, different flags or encoding of the subject.
+assertEquals(['ABC'], 'ABC'.match(/abc/i));
+assertNull('ABC'.match(/abc/));
+assertEquals(['abc'], 'ሴabc'.match(/abc/));
+assertEquals(['ABC'], 'ሴABC'.match(/abc/i));
@@ -0,0 +1,64 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-simd-skip --no-regexp-tier-up
+
+// Native irregexp code skips to the next occurrence of a required character
+// before running the matcher. Check that the candidates it finds, in
+// particular close to the end of the input and near vector block boundaries,
+// are the same as those of a plain search.
+
+function Padding(length, c = '-') {
+  return c.repeat(length);
+}
+
+(function TestSingleCharacter() {
+  for (let i = 0; i < 70; i++) {
+    let str = Padding(i) + 'x' + Padding(3);
+    assertEquals(i, str.search(/x../));
+    assertEquals(-1, str.search(/x..../));
+    assertEquals(i, (str + 'ሴ').search(/x../));
+  }
+  assertEquals(-1, Padding(100).search(/x../));
+  assertEquals(-1, ''.search(/x../));
+})();
+
+(function TestLiteral() {
+  for (let i = 0; i < 70; i++) {
+    // Decoys that share most of the literal come first.
+    let str = 'fox' + Padding(i) + 'foo' + 'fo';
+    assertEquals(3 + i, str.search(/foo/));
+    assertEquals(-1, str.search(/fooo/));
+    assertEquals(3 + i, (str + '☃').search(/foo/));
+    assertEquals(3 + i, (str + '☃').search(/fo☃|foo/));
+  }
+  let two_byte = Padding(40, '☃') + '一丁' + Padding(40, '☃');
+  assertEquals(40, two_byte.search(/一丁/));
+  assertEquals(-1, two_byte.search(/丁一/));
+  // Characters whose low bits collide with the literal's.
+  let aliases = Padding(30, 'Ŧ') + Padding(30, 'æ') + 'f';
+  assertEquals(-1, aliases.search(/foo/));
+  assertEquals(-1, aliases.search(/f../));
+})();
+
+(function TestGlobalAndSticky() {
+  let str = Padding(17) + 'abc' + Padding(33) + 'abc' + Padding(5) + 'abc';
+  let global = /abc/g;
+  let indices = [];
+  let match;
+  while ((match = global.exec(str)) !== null) indices.push(match.index);
+  assertEquals([17, 53, 61], indices);
+
+  let sticky = /abc/y;
+  sticky.lastIndex = 16;
+  assertNull(sticky.exec(str));
+  sticky.lastIndex = 17;
+  assertEquals(17, sticky.exec(str).index);
+})();
+
+(function TestMultiline() {
+  let str = Padding(20) + '\n' + Padding(20) + '\nfoo';
+  assertEquals(42, str.search(/^foo/m));
+  assertEquals(-1, str.search(/^-foo/m));
+})();
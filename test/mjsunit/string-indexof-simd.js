@@ -0,0 +1,49 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns are searched for by comparing blocks of the subject with
+// their first and last characters. Check matches and near misses at all
+// offsets around the block size, for every combination of one-byte and
+// two-byte subjects and patterns.
+
+function NaiveIndexOf(subject, pattern, start) {
+  for (let i = start; i + pattern.length <= subject.length; i++) {
+    if (subject.substring(i, i + pattern.length) === pattern) return i;
+  }
+  return -1;
+}
+
+function Check(subject, pattern) {
+  for (let start = 0; start <= 3; start++) {
+    assertEquals(NaiveIndexOf(subject, pattern, start),
+                 subject.indexOf(pattern, start), [subject, pattern, start]);
+  }
+}
+
+const kPatterns = ['ab', 'abc', 'aXb', 'abcdefg', 'a' + '-'.repeat(30) + 'b',
+                   'ሴb', 'aሴ', 'ሴሴሴ'];
+
+for (let pattern of kPatterns) {
+  for (let i = 0; i < 40; i++) {
+    let padding = '-'.repeat(i);
+    Check(padding + pattern, pattern);
+    Check(padding + pattern + padding, pattern);
+    // First and last characters match but the middle doesn't.
+    let decoy = pattern[0] + 'Z'.repeat(pattern.length - 2) +
+                pattern[pattern.length - 1];
+    Check(padding + decoy + padding + pattern, pattern);
+    // Only a prefix of the pattern at the very end.
+    Check(padding + pattern.substring(0, pattern.length - 1), pattern);
+    // Same with a two-byte subject.
+    Check('☃' + padding + pattern, pattern);
+    Check('☃' + padding + decoy, pattern);
+  }
+}
+
+// Two-byte characters whose low byte matches the one-byte pattern.
+assertEquals(-1, 'šĢšĢšĢšĢšĢšĢšĢšĢšĢšĢ'.indexOf('ab'));
+assertEquals(20, ('šĢ'.repeat(10) + 'ab').indexOf('ab'));
+assertEquals(-1, ('ab'.repeat(20)).indexOf('aሴ'));
+assertTrue(('x'.repeat(100) + 'needle').includes('needle'));
+assertEquals(['a', 'b', 'c'], 'a--b--c'.split('--'));
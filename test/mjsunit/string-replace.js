@@ -296,3 +296,18 @@ assertEquals(1, replace_tostring_count);
 
 "a".replace("a", fake_replacer);
 assertEquals(2, replace_tostring_count);
+
+// Global replacements with a plain replacement string write the result in one
+// go; check lengths, encodings, empty matches and RegExp.lastMatch.
+
+assertEquals("x-x-x", "a-bb-ccc".replace(/[a-z]+/g, "x"));
+assertEquals("[]a[]b[]", "ab".replace(/x*/g, "[]"));
+assertEquals("☃-☃", "ab-cd".replace(/\w+/g, "☃"));
+assertEquals("a☃b", "a☃b".replace(/x/g, "y"));
+assertEquals("", "aaaa".replace(/a+/g, ""));
+assertEquals("", "aaaa".replace(/a/g, ""));
+assertEquals("xyz".repeat(1000), "ab".repeat(1000).replace(/ab/g, "xyz"));
+"foo1bar22".replace(/\d+/g, "#");
+assertEquals("22", RegExp.lastMatch);
+assertThrows(() => "a".repeat(1 << 16).replace(/a/g, "b".repeat(1 << 16)),
+             RangeError);
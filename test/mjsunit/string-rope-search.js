@@ -0,0 +1,79 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// String.prototype.indexOf and JSON.stringify scan ropes segment by segment
+// instead of flattening them. Compare against the results on flat copies,
+// with matches and surrogate pairs that are split between segments.
+
+function OneByteRope(pieces) {
+  let rope = pieces[0];
+  for (let i = 1; i < pieces.length; i++) {
+    rope = %ConstructConsString(rope, pieces[i]);
+  }
+  return rope;
+}
+
+function Flat(make) {
+  return %FlattenString(make());
+}
+
+(function TestIndexOf() {
+  const pieces = ['abcdefghijklm', 'n', 'op', 'qrstuvwxyzabc', 'd', 'e', 'fgh'];
+  const make = () => OneByteRope(pieces);
+  const flat = Flat(make);
+  const patterns = ['a', 'm', 'mn', 'mnop', 'lmnopq', 'zabcde', 'cdefgh',
+                    'nop', 'xyz', 'h', 'fgh', 'abcdefghijklmnopqrstuvwxyzab',
+                    'mnopqrstuvwxyzabcdefgh', 'nq', '☃', 'a'.repeat(33),
+                    'klmnopqrstuvwxyzabcdefgh', flat];
+  for (const pattern of patterns) {
+    for (let start = 0; start <= flat.length; start += 3) {
+      assertEquals(flat.indexOf(pattern, start),
+                   make().indexOf(pattern, start), pattern + '@' + start);
+    }
+    assertEquals(flat.includes(pattern), make().includes(pattern));
+  }
+})();
+
+(function TestIndexOfTwoByte() {
+  const pieces = ['abcdefghijklmn☃', 'opqrstuvwxyz☃☃', 'abcdefghijklm'];
+  const make = () => pieces.reduce((rope, piece) => rope + piece);
+  const flat = Flat(make);
+  for (const pattern of ['☃', '☃o', 'z☃☃a', 'n☃opq', 'mn', 'zz']) {
+    for (let start = 0; start < flat.length; start++) {
+      assertEquals(flat.indexOf(pattern, start),
+                   make().indexOf(pattern, start), pattern + '@' + start);
+    }
+  }
+})();
+
+(function TestStringifyOneByte() {
+  const make = () => OneByteRope(['"quoted"\n', 'tab\t', 'back\\slash',
+                                  '\u0001ctrl', 'plain text here']);
+  assertEquals(JSON.stringify(Flat(make)), JSON.stringify(make()));
+  assertEquals(JSON.stringify({[Flat(make)]: [Flat(make)]}),
+               JSON.stringify({[make()]: [make()]}));
+})();
+
+(function TestStringifySurrogates() {
+  const lead = '\uD83D';
+  const trail = '\uDE00';
+  const padding = 'x'.repeat(13);
+  const makers = [
+    // A pair split between segments.
+    () => (padding + lead) + (trail + padding),
+    // Lone surrogates at the end and start of segments.
+    () => (padding + lead) + (padding + trail),
+    () => (padding + trail) + (lead + padding),
+    () => (padding + lead) + (lead + padding) + (trail + padding),
+    // A lone leading surrogate at the very end.
+    () => (padding + trail) + (padding + lead),
+    // A one-byte segment after a leading surrogate.
+    () => (padding + lead) + OneByteRope([padding, padding]),
+  ];
+  for (const make of makers) {
+    assertEquals(JSON.stringify(Flat(make)), JSON.stringify(make()));
+  }
+})();
@@ -0,0 +1,59 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --allow-natives-syntax
+
+// Allocations carried around a loop by a Phi can only be removed if nothing
+// else flows into the Phi and nothing reads the merged objects.
+
+function dead(n) {
+  let o = {x: 0};
+  for (let i = 0; i < n; i++) {
+    o = {x: i};
+  }
+  return n;
+}
+
+let global;
+function escaping(n, other) {
+  let o = other;
+  for (let i = 0; i < n; i++) {
+    o.x = i;
+    o = {x: i};
+  }
+  global = o;
+  return n;
+}
+
+function merged(n, other) {
+  let o = {x: 0};
+  for (let i = 0; i < n; i++) {
+    o.x = i;
+    if (i == 5) o = other;
+  }
+  return n;
+}
+
+%PrepareFunctionForOptimization(dead);
+%PrepareFunctionForOptimization(escaping);
+%PrepareFunctionForOptimization(merged);
+for (let i = 0; i < 3; i++) {
+  assertEquals(10, dead(10));
+  assertEquals(10, escaping(10, {x: -1}));
+  assertEquals(10, merged(10, {x: -1}));
+}
+%OptimizeFunctionOnNextCall(dead);
+%OptimizeFunctionOnNextCall(escaping);
+%OptimizeFunctionOnNextCall(merged);
+
+assertEquals(10, dead(10));
+
+let other = {x: -1};
+assertEquals(10, escaping(10, other));
+assertEquals(0, other.x);
+assertEquals(9, global.x);
+
+other = {x: -1};
+assertEquals(10, merged(10, other));
+assertEquals(9, other.x);
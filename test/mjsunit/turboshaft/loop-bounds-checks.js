@@ -0,0 +1,55 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --allow-natives-syntax
+
+// Bounds checks implied by the loop condition can be removed, but the
+// remaining ones still have to deoptimize when they fail.
+
+function sum(a) {
+  let result = 0;
+  for (let i = 0; i < a.length; i++) {
+    result += a[i];
+  }
+  return result;
+}
+
+function sumWithOffset(a, offset) {
+  let result = 0;
+  for (let i = 0; i < a.length; i++) {
+    // `i + offset` isn't the induction variable, so this needs a check.
+    result += a[i + offset] | 0;
+  }
+  return result;
+}
+
+function sumFrom(a, start) {
+  let result = 0;
+  // `start` can be negative, so `i` isn't known to be positive.
+  for (let i = start; i < a.length; i++) {
+    result += a[i] | 0;
+  }
+  return result;
+}
+
+const array = new Int32Array([1, 2, 3, 4, 5, 6, 7, 8]);
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(36, sum(array));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(36, sum(array));
+assertEquals(10, sum(new Int32Array([1, 2, 3, 4])));
+
+%PrepareFunctionForOptimization(sumWithOffset);
+assertEquals(36, sumWithOffset(array, 0));
+%OptimizeFunctionOnNextCall(sumWithOffset);
+assertEquals(36, sumWithOffset(array, 0));
+assertEquals(35, sumWithOffset(array, 1));
+
+%PrepareFunctionForOptimization(sumFrom);
+assertEquals(36, sumFrom(array, 0));
+%OptimizeFunctionOnNextCall(sumFrom);
+assertEquals(36, sumFrom(array, 0));
+assertEquals(15, sumFrom(array, 6));
+assertEquals(36, sumFrom(array, -2));
@@ -0,0 +1,54 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// indexOf and includes on typed arrays with 32- and 64-bit elements are
+// vectorized; check matches in the unaligned head, the vector loop and the
+// scalar tail, for all start offsets.
+
+const kLength = 67;
+
+function check(ctor, value) {
+  const buffer = new ArrayBuffer((kLength + 1) * ctor.BYTES_PER_ELEMENT);
+  for (let offset = 0; offset < 2; offset++) {
+    const a = new ctor(buffer, offset * ctor.BYTES_PER_ELEMENT, kLength);
+    for (let i = 0; i < kLength; i++) {
+      a.fill(value(0));
+      a[i] = value(1);
+      assertEquals(i, a.indexOf(value(1)));
+      assertTrue(a.includes(value(1)));
+      for (let from = 0; from < kLength; from += 7) {
+        assertEquals(from <= i ? i : -1, a.indexOf(value(1), from));
+        assertEquals(from <= i, a.includes(value(1), from));
+      }
+    }
+    a.fill(value(0));
+    assertEquals(-1, a.indexOf(value(1)));
+    assertFalse(a.includes(value(1)));
+  }
+}
+
+check(Int32Array, v => v === 0 ? 0 : -1);
+check(Uint32Array, v => v === 0 ? 1 : 0xffffffff);
+check(Float64Array, v => v === 0 ? 0.5 : -Infinity);
+check(BigInt64Array, v => v === 0 ? 0n : -(2n ** 63n));
+check(BigUint64Array, v => v === 0 ? 1n : 2n ** 64n - 1n);
+
+// +0 and -0 are equal, NaN is never found.
+(() => {
+  const a = new Float64Array([1, 2, -0, NaN]);
+  assertEquals(2, a.indexOf(0));
+  assertEquals(2, a.indexOf(-0));
+  assertEquals(-1, a.indexOf(NaN));
+  assertTrue(a.includes(NaN));
+})();
+
+// On-heap typed arrays.
+(() => {
+  const a = new Float64Array(9);
+  a[8] = 3;
+  assertEquals(8, a.indexOf(3));
+  const b = new BigInt64Array(9);
+  b[8] = 3n;
+  assertEquals(8, b.indexOf(3n));
+})();
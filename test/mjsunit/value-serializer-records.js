@@ -0,0 +1,39 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Arrays of records deserialize into objects that share maps, also when the
+// transition tree branches at every level.
+
+function roundTrip(value) {
+  return d8.serializer.deserialize(d8.serializer.serialize(value));
+}
+
+// Make the transition trees branch.
+roundTrip([{a: 1, b: 2}, {a: 1, c: 2}, {x: 1}, {b: 1}]);
+roundTrip([{point: {x: 1, z: 2}}, {point: {x: 1, y: "y"}}]);
+
+const records = [];
+for (let i = 0; i < 20; i++) {
+  records.push({id: i, name: "n" + i, point: {x: i, y: i + 0.5}});
+}
+const copy = roundTrip(records);
+assertEquals(records, copy);
+for (let i = 1; i < copy.length; i++) {
+  assertTrue(%HaveSameMap(copy[0], copy[i]));
+  assertTrue(%HaveSameMap(copy[0].point, copy[i].point));
+}
+
+// A differently shaped record in between must not be confused with the
+// cached shape.
+const mixed = roundTrip([
+  {id: 1, name: "a"}, {id: 2, title: "b"}, {name: "c", id: 3}, {id: 4},
+  {id: 5, name: "e", extra: true}, {id: 6, name: 6.5}
+]);
+assertEquals([
+  {id: 1, name: "a"}, {id: 2, title: "b"}, {name: "c", id: 3}, {id: 4},
+  {id: 5, name: "e", extra: true}, {id: 6, name: 6.5}
+], mixed);
+assertEquals(["name", "id"], Object.keys(mixed[2]));
@@ -0,0 +1,165 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-gc --liftoff --no-wasm-tier-up
+
+// Liftoff allocates structs and small arrays inline and calls C for
+// array.copy. Allocate enough to exhaust the linear allocation area many times
+// over, and check array.copy's corner cases.
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+(function TestStructAllocation() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let node = builder.addStruct([makeField(kWasmI32, false),
+                                makeField(wasmRefNullType(0), false)]);
+
+  // Builds a list of {n} nodes and returns the sum of their values.
+  builder.addFunction("buildAndSum", kSig_i_i)
+    .addLocals(wasmRefNullType(node), 1)
+    .addLocals(kWasmI32, 2)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 2,
+        kExprLocalGet, 1,
+        kGCPrefix, kExprStructNew, node,
+        kExprLocalSet, 1,
+        kExprLocalGet, 2, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 2,
+        kExprLocalGet, 0,
+        kExprI32LtU,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprBlock, kWasmVoid,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprRefIsNull, kExprBrIf, 1,
+          kExprLocalGet, 3,
+          kExprLocalGet, 1, kGCPrefix, kExprStructGet, node, 0,
+          kExprI32Add,
+          kExprLocalSet, 3,
+          kExprLocalGet, 1, kGCPrefix, kExprStructGet, node, 1,
+          kExprLocalSet, 1,
+          kExprBr, 0,
+        kExprEnd,
+      kExprEnd,
+      kExprLocalGet, 3])
+    .exportFunc();
+
+  let instance = builder.instantiate();
+  assertEquals(0, instance.exports.buildAndSum(1));
+  assertEquals(45, instance.exports.buildAndSum(10));
+  assertEquals(199990000, instance.exports.buildAndSum(20000));
+  gc();
+  assertEquals(199990000, instance.exports.buildAndSum(20000));
+})();
+
+(function TestArrayAllocation() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let array = builder.addArray(kWasmI32, true);
+
+  // Returns array[index] of a fresh array.new(value, length).
+  builder.addFunction("newAndGet", makeSig([kWasmI32, kWasmI32, kWasmI32],
+                                           [kWasmI32]))
+    .addBody([
+      kExprLocalGet, 0, kExprLocalGet, 1,
+      kGCPrefix, kExprArrayNew, array,
+      kExprLocalGet, 2,
+      kGCPrefix, kExprArrayGet, array])
+    .exportFunc();
+  builder.addFunction("newDefaultLength", kSig_i_i)
+    .addBody([
+      kExprLocalGet, 0,
+      kGCPrefix, kExprArrayNewDefault, array,
+      kGCPrefix, kExprArrayLen])
+    .exportFunc();
+  builder.addFunction("newFixedGet", kSig_i_i)
+    .addBody([
+      kExprI32Const, 11, kExprI32Const, 22, kExprI32Const, 33,
+      kGCPrefix, kExprArrayNewFixed, array, 3,
+      kExprLocalGet, 0,
+      kGCPrefix, kExprArrayGet, array])
+    .exportFunc();
+
+  let instance = builder.instantiate();
+  for (let i = 0; i < 10000; i++) {
+    assertEquals(i, instance.exports.newAndGet(i, 100, i % 100));
+  }
+  assertEquals(7, instance.exports.newAndGet(7, 1, 0));
+  // Too big for inline allocation.
+  assertEquals(3, instance.exports.newAndGet(3, 1000000, 999999));
+  assertTraps(kTrapArrayOutOfBounds, () => instance.exports.newAndGet(1, 0, 0));
+  assertEquals(0, instance.exports.newDefaultLength(0));
+  assertEquals(12345, instance.exports.newDefaultLength(12345));
+  assertEquals(1000000, instance.exports.newDefaultLength(1000000));
+  assertEquals(22, instance.exports.newFixedGet(1));
+  assertTraps(kTrapArrayOutOfBounds, () => instance.exports.newFixedGet(3));
+})();
+
+(function TestArrayCopy() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let array = builder.addArray(kWasmI32, true);
+  let global = builder.addGlobal(wasmRefNullType(array), true);
+
+  // global = [0, 1, ..., length - 1]
+  builder.addFunction("init", kSig_v_i)
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprLocalGet, 0,
+      kGCPrefix, kExprArrayNewDefault, array,
+      kExprGlobalSet, global.index,
+      kExprBlock, kWasmVoid,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprLocalGet, 0, kExprI32GeU, kExprBrIf, 1,
+          kExprGlobalGet, global.index,
+          kExprLocalGet, 1, kExprLocalGet, 1,
+          kGCPrefix, kExprArraySet, array,
+          kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalSet, 1,
+          kExprBr, 0,
+        kExprEnd,
+      kExprEnd])
+    .exportFunc();
+  // Copies within the global array: (dst_index, src_index, length).
+  builder.addFunction("copy", makeSig([kWasmI32, kWasmI32, kWasmI32], []))
+    .addBody([
+      kExprGlobalGet, global.index, kExprLocalGet, 0,
+      kExprGlobalGet, global.index, kExprLocalGet, 1,
+      kExprLocalGet, 2,
+      kGCPrefix, kExprArrayCopy, array, array])
+    .exportFunc();
+  builder.addFunction("copyToNull", kSig_v_v)
+    .addBody([
+      kExprRefNull, array, kExprI32Const, 0,
+      kExprGlobalGet, global.index, kExprI32Const, 0,
+      kExprI32Const, 0,
+      kGCPrefix, kExprArrayCopy, array, array])
+    .exportFunc();
+  builder.addFunction("get", kSig_i_i)
+    .addBody([
+      kExprGlobalGet, global.index, kExprLocalGet, 0,
+      kGCPrefix, kExprArrayGet, array])
+    .exportFunc();
+
+  let instance = builder.instantiate();
+  let get = instance.exports.get;
+  instance.exports.init(10);
+  instance.exports.copy(0, 5, 0);
+  assertEquals(0, get(0));
+  // Overlapping, regions move up.
+  instance.exports.copy(2, 0, 5);
+  assertEquals([0, 1, 0, 1, 2, 3, 4, 7, 8, 9],
+               Array.from({length: 10}, (_, i) => get(i)));
+  // Overlapping, regions move down.
+  instance.exports.copy(0, 1, 9);
+  assertEquals([1, 0, 1, 2, 3, 4, 7, 8, 9, 9],
+               Array.from({length: 10}, (_, i) => get(i)));
+  assertTraps(kTrapArrayOutOfBounds, () => instance.exports.copy(5, 0, 6));
+  assertTraps(kTrapArrayOutOfBounds, () => instance.exports.copy(0, 5, 6));
+  assertTraps(kTrapArrayOutOfBounds,
+              () => instance.exports.copy(1, 0, 0xffffffff));
+  assertTraps(kTrapNullDereference, () => instance.exports.copyToNull());
+  // Empty copies at the very end are fine.
+  instance.exports.copy(10, 10, 0);
+})();
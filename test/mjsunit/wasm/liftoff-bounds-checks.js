@@ -0,0 +1,49 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --liftoff --no-wasm-tier-up --no-wasm-trap-handler
+
+// Liftoff skips explicit bounds checks of an index register that was already
+// checked for the same or a larger end offset. Make sure that all accesses
+// which are not covered by an earlier check still trap.
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+const builder = new WasmModuleBuilder();
+builder.addMemory(1, 2);
+builder.addFunction("loadUpThenDown", kSig_i_i)
+    .addBody([
+      kExprLocalGet, 0, kExprI32LoadMem, 0, 0,
+      kExprLocalGet, 0, kExprI32LoadMem, 0, 4,
+      kExprI32Add,
+      kExprLocalGet, 0, kExprI32LoadMem, 0, 2,
+      kExprI32Add])
+    .exportFunc();
+builder.addFunction("loadAfterLocalSet", kSig_i_ii)
+    .addBody([
+      kExprLocalGet, 0, kExprI32LoadMem, 0, 0,
+      kExprLocalGet, 1, kExprLocalSet, 0,
+      kExprLocalGet, 0, kExprI32LoadMem, 0, 0,
+      kExprI32Add])
+    .exportFunc();
+builder.addFunction("loadAroundGrow", kSig_i_i)
+    .addBody([
+      kExprLocalGet, 0, kExprI32LoadMem, 0, 0,
+      kExprI32Const, 1, kExprMemoryGrow, kMemoryZero, kExprDrop,
+      kExprLocalGet, 0, kExprI32LoadMem, 0, 0,
+      kExprI32Add])
+    .exportFunc();
+const instance = builder.instantiate();
+const kPageSize = 65536;
+
+const {loadUpThenDown, loadAfterLocalSet, loadAroundGrow} = instance.exports;
+assertEquals(0, loadUpThenDown(kPageSize - 8));
+assertTraps(kTrapMemOutOfBounds, () => loadUpThenDown(kPageSize - 4));
+assertTraps(kTrapMemOutOfBounds, () => loadUpThenDown(kPageSize - 7));
+
+assertEquals(0, loadAfterLocalSet(0, kPageSize - 4));
+assertTraps(kTrapMemOutOfBounds, () => loadAfterLocalSet(0, kPageSize));
+
+assertEquals(0, loadAroundGrow(kPageSize - 4));
+assertTraps(kTrapMemOutOfBounds, () => loadAroundGrow(2 * kPageSize));
@@ -0,0 +1,44 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-liftoff --turbo-mid-tier-regalloc-instructions-limit=16
+
+// With a tiny instruction limit every function below is allocated by the
+// mid-tier register allocator, even though it has few virtual registers.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+builder.addFunction('sum', makeSig([kWasmI32], [kWasmI32]))
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 1,
+        kExprLocalGet, 0,
+        kExprI32Add,
+        kExprLocalSet, 1,
+        kExprLocalGet, 0,
+        kExprI32Const, 1,
+        kExprI32Sub,
+        kExprLocalTee, 0,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 1,
+    ])
+    .exportFunc();
+builder.addFunction('mix', makeSig([kWasmF64, kWasmF64], [kWasmF64]))
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kExprF64Mul,
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kExprF64Sub,
+      kExprF64Add,
+    ])
+    .exportFunc();
+
+const instance = builder.instantiate();
+assertEquals(5050, instance.exports.sum(100));
+assertEquals(2 * 3 + (2 - 3), instance.exports.mix(2, 3));
@@ -192,3 +192,42 @@ assertEquals("abc", instance1.exports.call_tolower("ABC"));
       () => String.prototype.toLocaleLowerCase.call(null, 'en'),
       'call_tolower');
 })();
+
+(function TestMathFunctions() {
+  console.log("Testing Math functions");
+  let builder = new WasmModuleBuilder();
+  let unary = ['abs', 'ceil', 'floor', 'sqrt', 'trunc'];
+  let binary = ['max', 'min'];
+  for (let name of unary) {
+    let imp = builder.addImport("m", name, kSig_d_d);
+    builder.addFunction('call_' + name, kSig_d_d).exportFunc().addBody([
+      kExprLocalGet, 0,
+      kExprCallFunction, imp,
+    ]);
+  }
+  for (let name of binary) {
+    let imp = builder.addImport("m", name, kSig_d_dd);
+    builder.addFunction('call_' + name, kSig_d_dd).exportFunc().addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kExprCallFunction, imp,
+    ]);
+  }
+  let imports = {};
+  for (let name of unary.concat(binary)) imports[name] = Math[name];
+  let wasm = builder.instantiate({ m: imports }).exports;
+  let inputs = [0, -0, 0.5, -0.5, 1.5, -2.5, 1e300, -Infinity, NaN];
+  for (let name of unary.concat(binary)) {
+    %WasmTierUpFunction(wasm['call_' + name]);
+  }
+  for (let x of inputs) {
+    for (let name of unary) {
+      assertEquals(Math[name](x), wasm['call_' + name](x));
+    }
+    for (let y of inputs) {
+      for (let name of binary) {
+        assertEquals(Math[name](x, y), wasm['call_' + name](x, y));
+      }
+    }
+  }
+})();
@@ -104,6 +104,10 @@ let interestingStrings = [
   'ab \ud800',         // Lone lead surrogate at the end.
   'ab \udc00',         // Lone trail surrogate at the end.
   'a \udc00\ud800 b',  // Swapped surrogate pair.
+  // Long ASCII prefixes, spanning several words or vector blocks.
+  'ascii prefix of more than thirty-two chars \xa9 tail',
+  'ascii prefix of more than thirty-two chars \ud800\udc00 tail',
+  'ascii prefix of more than thirty-two chars \ud800',
 ];
 
 function IsSurrogate(codepoint) {
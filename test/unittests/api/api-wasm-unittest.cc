@@ -161,6 +161,28 @@ TEST_F(ApiWasmTest, WasmCompileToWasmModuleObject) {
   CHECK(!maybe_module.IsEmpty());
 }
 
+TEST_F(ApiWasmTest, WasmCodeStatistics) {
+  // (func (result i32) (i32.const 42))
+  static const uint8_t kModuleBytes[]{
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // header
+      0x01, 0x05, 0x01, 0x60, 0x00, 0x01, 0x7f,        // type section
+      0x03, 0x02, 0x01, 0x00,                          // function section
+      0x0a, 0x06, 0x01, 0x04, 0x00, 0x41, 0x2a, 0x0b,  // code section
+  };
+  Local<Context> context = Context::New(isolate());
+  Context::Scope context_scope(context);
+  Local<WasmModuleObject> module =
+      WasmModuleObject::Compile(isolate(),
+                                {kModuleBytes, arraysize(kModuleBytes)})
+          .ToLocalChecked();
+  WasmModuleCodeStatistics stats =
+      module->GetCompiledModule().GetCodeStatistics();
+  // At least the jump table is allocated in the module's code space.
+  EXPECT_LT(0u, stats.generated_code_size());
+  EXPECT_LT(0u, stats.committed_code_size());
+  EXPECT_LE(stats.freed_code_size(), stats.generated_code_size());
+}
+
 TEST_F(ApiWasmTest, WasmStreamingSetCallback) {
   TestWasmStreaming(WasmStreamingMoreFunctionsCanBeSerializedCallback,
                     Promise::kPending);
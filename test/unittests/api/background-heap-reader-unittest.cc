@@ -0,0 +1,147 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-background-heap-reader.h"
+
+#include <string>
+#include <vector>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-typed-array.h"
+#include "src/base/platform/platform.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+
+using BackgroundHeapReaderTest = TestWithContext;
+
+namespace {
+
+class ReaderThread final : public base::Thread {
+ public:
+  ReaderThread(BackgroundHeapReader* reader, int id)
+      : base::Thread(base::Thread::Options("BackgroundHeapReader")),
+        reader_(reader),
+        id_(id) {}
+
+  void Run() override {
+    BackgroundHeapReader::Scope scope(reader_);
+    ASSERT_EQ(BackgroundHeapReader::Type::kObject, scope.GetType(id_));
+    for (int i = 0; i < scope.PropertyCount(id_); ++i) {
+      result_ += ReadString(scope, scope.PropertyKey(id_, i)) + "=" +
+                 ReadValue(scope, scope.PropertyValue(id_, i)) + ";";
+    }
+  }
+
+  const std::string& result() const { return result_; }
+
+ private:
+  static std::string ReadString(const BackgroundHeapReader::Scope& scope,
+                                int id) {
+    int length = scope.StringLength(id);
+    std::vector<uint16_t> chars(length);
+    scope.Write(id, chars.data(), 0, length);
+    std::string result;
+    for (uint16_t c : chars) {
+      result += c < 0x80 ? std::string(1, static_cast<char>(c)) : "?";
+    }
+    if (scope.IsOneByte(id) && length > 1) {
+      uint8_t c;
+      scope.WriteOneByte(id, &c, 1, 1);
+      EXPECT_EQ(chars[1], c);
+    }
+    return result;
+  }
+
+  static std::string ReadValue(const BackgroundHeapReader::Scope& scope,
+                               int id) {
+    switch (scope.GetType(id)) {
+      case BackgroundHeapReader::Type::kUndefined:
+        return "undefined";
+      case BackgroundHeapReader::Type::kNull:
+        return "null";
+      case BackgroundHeapReader::Type::kBoolean:
+        return scope.BooleanValue(id) ? "true" : "false";
+      case BackgroundHeapReader::Type::kNumber:
+        return std::to_string(static_cast<int>(scope.NumberValue(id)));
+      case BackgroundHeapReader::Type::kString:
+        return "'" + ReadString(scope, id) + "'";
+      case BackgroundHeapReader::Type::kTypedArray: {
+        const uint8_t* data =
+            static_cast<const uint8_t*>(scope.TypedArrayData(id));
+        std::string result = "[";
+        for (size_t i = 0; i < scope.TypedArrayByteLength(id); ++i) {
+          result += std::to_string(data[i]) + ",";
+        }
+        return result + "]";
+      }
+      case BackgroundHeapReader::Type::kObject: {
+        std::string result = "{";
+        for (int i = 0; i < scope.PropertyCount(id); ++i) {
+          result += ReadString(scope, scope.PropertyKey(id, i)) + ":" +
+                    ReadValue(scope, scope.PropertyValue(id, i)) + ",";
+        }
+        return result + "}";
+      }
+    }
+    UNREACHABLE();
+  }
+
+  BackgroundHeapReader* const reader_;
+  const int id_;
+  std::string result_;
+};
+
+}  // namespace
+
+TEST_F(BackgroundHeapReaderTest, ReadFrozenObject) {
+  BackgroundHeapReader reader(isolate());
+  int id = reader.Add(RunJS(
+      "var bytes = new Uint8Array([1, 2, 3]).subarray(1);"
+      "Object.freeze({"
+      "  name: 'a' + 'bc',"
+      "  two_byte: 'x\\u2603',"
+      "  count: 42,"
+      "  flag: true,"
+      "  none: null,"
+      "  bytes,"
+      "  nested: Object.freeze({ 0: undefined, list: Object.freeze([7]) }),"
+      "})"));
+  ASSERT_NE(BackgroundHeapReader::kUnsupported, id);
+
+  // The reader keeps the contents of detached buffers alive.
+  RunJS("bytes")
+      .As<TypedArray>()
+      ->Buffer()
+      ->Detach(Local<Value>())
+      .Check();
+
+  ReaderThread thread(&reader, id);
+  ASSERT_TRUE(thread.Start());
+  thread.Join();
+  EXPECT_EQ(
+      "name='abc';two_byte='x?';count=42;flag=true;none=null;bytes=[2,3,];"
+      "nested={0:undefined,list:{0:7,},};",
+      thread.result());
+}
+
+TEST_F(BackgroundHeapReaderTest, RejectUnsupportedValues) {
+  BackgroundHeapReader reader(isolate());
+  EXPECT_EQ(BackgroundHeapReader::kUnsupported, reader.Add(RunJS("({})")));
+  EXPECT_EQ(BackgroundHeapReader::kUnsupported,
+            reader.Add(RunJS("Symbol()")));
+  EXPECT_EQ(BackgroundHeapReader::kUnsupported,
+            reader.Add(RunJS("Object.freeze({ s: Symbol() })")));
+  EXPECT_EQ(BackgroundHeapReader::kUnsupported,
+            reader.Add(RunJS("Object.freeze({ get x() { return 1; } })")));
+  EXPECT_EQ(BackgroundHeapReader::kUnsupported,
+            reader.Add(RunJS("var o = {}; o.self = o; Object.freeze(o)")));
+  EXPECT_NE(BackgroundHeapReader::kUnsupported,
+            reader.Add(RunJS("Object.freeze({ a: 1 })")));
+}
+
+}  // namespace v8
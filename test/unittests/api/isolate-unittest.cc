@@ -5,10 +5,15 @@
 #include "src/execution/isolate.h"
 
 #include "include/libplatform/libplatform.h"
+#include "include/v8-isolate-pool.h"
 #include "include/v8-platform.h"
 #include "include/v8-template.h"
+#include "src/api/api-inl.h"
 #include "src/base/platform/semaphore.h"
+#include "src/execution/tiering-manager.h"
 #include "src/init/v8.h"
+#include "src/objects/js-function-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -164,4 +169,112 @@ TEST_F(IsolateTest, SetAddCrashKeyCallback) {
   EXPECT_EQ(crash_keys.size(), expected_keys_count);
 }
 
+using TieringPolicyTest = TestWithContext;
+
+TEST_F(TieringPolicyTest, OverridesFlags) {
+  if (!internal::v8_flags.lazy_feedback_allocation) return;
+  internal::Isolate* i_isolate =
+      reinterpret_cast<internal::Isolate*>(isolate());
+  Local<Function> f = Local<Function>::Cast(
+      RunJS("function f(a) { return a + 1; }; f(1); f"));
+  internal::Handle<internal::JSFunction> function =
+      internal::Handle<internal::JSFunction>::cast(Utils::OpenHandle(*f));
+  ASSERT_FALSE(function->has_feedback_vector());
+  int bytecode_length =
+      function->shared()->GetBytecodeArray(i_isolate)->length();
+
+  EXPECT_EQ(
+      internal::TieringManager::InterruptBudgetFor(i_isolate, *function),
+      internal::v8_flags.invocation_count_for_feedback_allocation *
+          bytecode_length);
+
+  Isolate::TieringPolicy policy;
+  policy.sparkplug_invocation_count = 3;
+  isolate()->SetTieringPolicy(policy);
+  EXPECT_EQ(
+      internal::TieringManager::InterruptBudgetFor(i_isolate, *function),
+      3 * bytecode_length);
+
+  // Fields left at zero fall back to the flags.
+  isolate()->SetTieringPolicy(Isolate::TieringPolicy());
+  EXPECT_EQ(
+      internal::TieringManager::InterruptBudgetFor(i_isolate, *function),
+      internal::v8_flags.invocation_count_for_feedback_allocation *
+          bytecode_length);
+}
+
+TEST_F(TieringPolicyTest, LargeFunctionsDelayFeedbackAllocation) {
+  if (!internal::v8_flags.lazy_feedback_allocation) return;
+  internal::Isolate* i_isolate =
+      reinterpret_cast<internal::Isolate*>(isolate());
+  Local<Function> f = Local<Function>::Cast(
+      RunJS("function f(a) { return a + 1; }; f(1); f"));
+  internal::Handle<internal::JSFunction> function =
+      internal::Handle<internal::JSFunction>::cast(Utils::OpenHandle(*f));
+  ASSERT_FALSE(function->has_feedback_vector());
+  int bytecode_length =
+      function->shared()->GetBytecodeArray(i_isolate)->length();
+  ASSERT_GT(bytecode_length, 4);
+  const int invocations =
+      internal::v8_flags.invocation_count_for_feedback_allocation;
+
+  // Pretend that |f| is a large function: the required invocation count
+  // grows with its size, up to --max-feedback-allocation-delay-factor.
+  internal::FlagScope<int> large_size(
+      &internal::v8_flags.feedback_allocation_large_function_size,
+      bytecode_length / 2);
+  internal::FlagScope<int> max_factor(
+      &internal::v8_flags.max_feedback_allocation_delay_factor, 10);
+  EXPECT_EQ(3, internal::TieringManager::FeedbackAllocationDelayFactor(
+                   bytecode_length));
+  EXPECT_EQ(
+      internal::TieringManager::InterruptBudgetFor(i_isolate, *function),
+      3 * invocations * bytecode_length);
+
+  {
+    internal::FlagScope<int> capped_factor(
+        &internal::v8_flags.max_feedback_allocation_delay_factor, 2);
+    EXPECT_EQ(
+        internal::TieringManager::InterruptBudgetFor(i_isolate, *function),
+        2 * invocations * bytecode_length);
+  }
+
+  // Functions below the size threshold are not delayed.
+  EXPECT_EQ(1, internal::TieringManager::FeedbackAllocationDelayFactor(
+                   bytecode_length / 2));
+}
+
+using IsolatePoolTest = TestWithPlatform;
+
+TEST_F(IsolatePoolTest, AcquireAndRelease) {
+  std::unique_ptr<ArrayBuffer::Allocator> allocator(
+      ArrayBuffer::Allocator::NewDefaultAllocator());
+  Isolate::CreateParams params;
+  params.array_buffer_allocator = allocator.get();
+
+  {
+    IsolatePool pool(params, 1);
+    for (int i = 0; i < 2; i++) {
+      Isolate* isolate = pool.Acquire();
+      ASSERT_NE(nullptr, isolate);
+      {
+        Isolate::Scope isolate_scope(isolate);
+        HandleScope handle_scope(isolate);
+        Local<Context> context = Context::New(isolate);
+        Context::Scope context_scope(context);
+        Local<String> source = String::NewFromUtf8Literal(isolate, "1 + 2");
+        Local<Value> result = Script::Compile(context, source)
+                                  .ToLocalChecked()
+                                  ->Run(context)
+                                  .ToLocalChecked();
+        EXPECT_EQ(3, result->Int32Value(context).FromJust());
+      }
+      pool.Release(isolate);
+    }
+    IsolatePool::Statistics stats = pool.GetStatistics();
+    EXPECT_EQ(2u, stats.hits + stats.misses);
+    EXPECT_LE(stats.available, 1u);
+  }
+}
+
 }  // namespace v8
@@ -21,6 +21,10 @@ TEST(CPUTest, FeatureImplications) {
   EXPECT_TRUE(!cpu.has_avx() || cpu.has_sse2());
   EXPECT_TRUE(!cpu.has_fma3() || cpu.has_avx());
   EXPECT_TRUE(!cpu.has_avx2() || cpu.has_avx());
+  EXPECT_TRUE(!cpu.has_avx512f() || cpu.has_avx2());
+  EXPECT_TRUE(!cpu.has_avx512dq() || cpu.has_avx512f());
+  EXPECT_TRUE(!cpu.has_avx512bw() || cpu.has_avx512f());
+  EXPECT_TRUE(!cpu.has_avx512vl() || cpu.has_avx512f());
 
   // arm features
   EXPECT_TRUE(!cpu.has_vfp3_d32() || cpu.has_vfp3());
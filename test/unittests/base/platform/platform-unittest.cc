@@ -13,6 +13,7 @@
 #include "testing/gtest/include/gtest/gtest.h"
 
 #ifdef V8_TARGET_OS_LINUX
+#include <sched.h>
 #include <sys/sysmacros.h>
 
 #include "src/base/platform/platform-linux.h"
@@ -171,6 +172,18 @@ TEST(OS, GetSharedLibraryAddresses) {
   EXPECT_EQ(shared_library_addresses[1].start, 0x12430000u - 0x62000);
 #endif
 }
+
+TEST(OS, NumaNodeAffinityScopeRestoresAffinity) {
+  cpu_set_t before;
+  ASSERT_EQ(0, sched_getaffinity(0, sizeof(before), &before));
+  {
+    // Node 0 exists on every NUMA system; without NUMA the scope is a no-op.
+    NumaNodeAffinityScope scope(0);
+  }
+  cpu_set_t after;
+  ASSERT_EQ(0, sched_getaffinity(0, sizeof(after), &after));
+  EXPECT_TRUE(CPU_EQUAL(&before, &after));
+}
 #endif  // V8_TARGET_OS_LINUX
 
 namespace {
@@ -0,0 +1,101 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/numbers/ryu-dtoa.h"
+
+#include <string.h>
+
+#include "src/base/numbers/bignum-dtoa.h"
+#include "src/base/numbers/double.h"
+#include "src/base/utils/random-number-generator.h"
+#include "test/unittests/gay-shortest.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+
+using RyuDtoaTest = ::testing::Test;
+
+namespace base {
+namespace test_ryu_dtoa {
+
+static const int kBufferSize = 100;
+
+static void CheckShortest(double v, const char* expected, int expected_point) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  RyuDtoa(v, buffer, &length, &point);
+  CHECK_EQ(0, strcmp(expected, buffer.begin()));
+  CHECK_EQ(static_cast<int>(strlen(expected)), length);
+  CHECK_EQ(expected_point, point);
+}
+
+TEST_F(RyuDtoaTest, RyuDtoaVariousDoubles) {
+  CheckShortest(1.0, "1", 1);
+  CheckShortest(1.5, "15", 1);
+  CheckShortest(0.1, "1", 0);
+  CheckShortest(100.0, "1", 3);
+  CheckShortest(123.456, "123456", 3);
+  CheckShortest(5e-324, "5", -323);
+  CheckShortest(1.7976931348623157e308, "17976931348623157", 309);
+  CheckShortest(4294967272.0, "4294967272", 10);
+  CheckShortest(4.1855804968213567e298, "4185580496821357", 299);
+  CheckShortest(5.5626846462680035e-309, "5562684646268003", -308);
+  CheckShortest(2147483648.0, "2147483648", 10);
+  // FastDtoa can't compute these.
+  CheckShortest(3.5844466002796428e+298, "35844466002796428", 299);
+  CheckShortest(Double(uint64_t{0x0010'0000'0000'0000}).value(),
+                "22250738585072014", -307);
+  CheckShortest(Double(uint64_t{0x000F'FFFF'FFFF'FFFF}).value(),
+                "2225073858507201", -307);
+  // Powers of two have a closer lower boundary.
+  CheckShortest(9007199254740992.0, "9007199254740992", 16);
+  CheckShortest(1e23, "1", 24);
+}
+
+TEST_F(RyuDtoaTest, RyuDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    RyuDtoa(current_test.v, buffer, &length, &point);
+    CHECK_GE(kRyuDtoaMaximalLength, length);
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.begin()));
+  }
+}
+
+TEST_F(RyuDtoaTest, RyuDtoaMatchesBignumDtoa) {
+  char ryu_container[kBufferSize];
+  char bignum_container[kBufferSize];
+  Vector<char> ryu_buffer(ryu_container, kBufferSize);
+  Vector<char> bignum_buffer(bignum_container, kBufferSize);
+  int ryu_length, ryu_point, bignum_length, bignum_point;
+
+  RandomNumberGenerator rng(42);
+  for (int i = 0; i < 100000; ++i) {
+    uint64_t bits;
+    rng.NextBytes(&bits, sizeof(bits));
+    // Clear the sign and skip NaNs and infinities.
+    double v = Double(bits & ~Double::kSignMask).value();
+    if (v == 0 || Double(v).IsSpecial()) continue;
+    RyuDtoa(v, ryu_buffer, &ryu_length, &ryu_point);
+    BignumDtoa(v, BIGNUM_DTOA_SHORTEST, 0, bignum_buffer, &bignum_length,
+               &bignum_point);
+    bignum_buffer[bignum_length] = '\0';
+    CHECK_EQ(bignum_length, ryu_length);
+    CHECK_EQ(bignum_point, ryu_point);
+    CHECK_EQ(0, strcmp(bignum_buffer.begin(), ryu_buffer.begin()));
+  }
+}
+
+}  // namespace test_ryu_dtoa
+}  // namespace base
+}  // namespace v8
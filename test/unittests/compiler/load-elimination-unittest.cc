@@ -4,8 +4,10 @@
 
 #include "src/compiler/load-elimination.h"
 
+#include "src/codegen/callable.h"
 #include "src/compiler/access-builder.h"
 #include "src/compiler/js-graph.h"
+#include "src/compiler/linkage.h"
 #include "src/compiler/node.h"
 #include "src/compiler/simplified-operator.h"
 #include "test/unittests/compiler/graph-reducer-unittest.h"
@@ -496,6 +498,45 @@ TEST_F(LoadEliminationTest, AliasAnalysisForFinishRegion) {
   EXPECT_EQ(value0, r.replacement());
 }
 
+TEST_F(LoadEliminationTest, LoadFieldAndAllocateCallAndLoadField) {
+  Node* object = Parameter(Type::Any(), 0);
+  Node* size = Parameter(Type::Any(), 1);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+  FieldAccess const access = {kTaggedBase,         kTaggedSize,
+                              MaybeHandle<Name>(), OptionalMapRef(),
+                              Type::Any(),         MachineType::AnyTagged(),
+                              kNoWriteBarrier};
+
+  StrictMock<MockAdvancedReducerEditor> editor;
+  LoadElimination load_elimination(&editor, broker(), jsgraph(), zone());
+
+  load_elimination.Reduce(graph()->start());
+
+  Node* load1 = effect = graph()->NewNode(simplified()->LoadField(access),
+                                          object, effect, control);
+  load_elimination.Reduce(load1);
+
+  // The allocation builtin does not write to existing objects, so the field
+  // is still known after calling it.
+  Callable callable =
+      Builtins::CallableFor(isolate(), Builtin::kAllocateInYoungGeneration);
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      zone(), callable.descriptor(), 0, CallDescriptor::kNoFlags,
+      Operator::kNoProperties);
+  Node* call = effect =
+      graph()->NewNode(common()->Call(call_descriptor),
+                       HeapConstant(callable.code()), size, effect, control);
+  load_elimination.Reduce(call);
+
+  Node* load2 = effect = graph()->NewNode(simplified()->LoadField(access),
+                                          object, effect, control);
+  EXPECT_CALL(editor, ReplaceWithValue(load2, load1, call, _));
+  Reduction r = load_elimination.Reduce(load2);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(load1, r.replacement());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -148,6 +148,34 @@ TEST_F(DebugPropertyIteratorTest, SkipsIndicesOnTypedArrays) {
   }
 }
 
+TEST_F(DebugPropertyIteratorTest, IteratesFastElementsInPlace) {
+  TryCatch try_catch(isolate());
+
+  Local<Value> array = RunJS("var a = [1, , 3]; a.x = 42; a");
+
+  auto iterator = PropertyIterator::Create(context(), array.As<Object>());
+  ASSERT_NE(iterator, nullptr);
+  char name_buffer[100];
+  // The hole is skipped, and the indices come before the names.
+  for (const char* index : {"0", "2"}) {
+    ASSERT_FALSE(iterator->Done());
+    EXPECT_TRUE(iterator->is_own());
+    EXPECT_TRUE(iterator->is_array_index());
+    iterator->name().As<v8::String>()->WriteUtf8(isolate(), name_buffer);
+    EXPECT_EQ(index, std::string(name_buffer));
+    ASSERT_TRUE(iterator->Advance().FromMaybe(false));
+  }
+  ASSERT_FALSE(iterator->Done());
+  EXPECT_FALSE(iterator->is_array_index());
+  iterator->name().As<v8::String>()->WriteUtf8(isolate(), name_buffer);
+  EXPECT_EQ("x", std::string(name_buffer));
+  // The elements don't show up again in the stage with all own properties.
+  while (!iterator->Done() && iterator->is_own()) {
+    EXPECT_FALSE(iterator->is_array_index());
+    ASSERT_TRUE(iterator->Advance().FromMaybe(false));
+  }
+}
+
 #if V8_CAN_CREATE_SHARED_HEAP_BOOL
 
 using SharedObjectDebugPropertyIteratorTest = TestJSSharedMemoryWithContext;
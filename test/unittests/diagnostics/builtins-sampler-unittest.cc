@@ -0,0 +1,74 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/diagnostics/builtins-sampler.h"
+
+#include <sstream>
+#include <string>
+#include <unordered_set>
+
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+using BuiltinsSamplerTest = TestWithContext;
+
+TEST_F(BuiltinsSamplerTest, LogFormat) {
+  BuiltinsSampler sampler(i_isolate(), 50);
+  sampler.StartSampling();
+  // Spend most of the time in builtins calling other builtins.
+  RunJS(
+      "for (let i = 0; i < 200; i++) {"
+      "  let a = [];"
+      "  for (let j = 0; j < 1000; j++) a.push(String(j));"
+      "  a.sort().join(',').split(',');"
+      "}");
+  sampler.StopSampling();
+
+  std::unordered_set<std::string> names;
+  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+       ++builtin) {
+    names.insert(Builtins::name(builtin));
+  }
+
+  // How many samples hit builtins depends on the platform, but whatever was
+  // sampled has to be in the format that mksnapshot reads.
+  std::ostringstream os;
+  sampler.Log(os);
+  std::istringstream lines(os.str());
+  bool saw_call_count = false;
+  bool saw_max_count = false;
+  for (std::string line; std::getline(lines, line);) {
+    std::istringstream line_stream(line);
+    std::string marker, name, count;
+    ASSERT_TRUE(std::getline(line_stream, marker, ','));
+    ASSERT_TRUE(std::getline(line_stream, name, ','));
+    EXPECT_EQ(1u, names.count(name));
+    if (marker == "builtin_count") {
+      EXPECT_FALSE(saw_call_count);
+    } else {
+      ASSERT_EQ("call_count", marker);
+      saw_call_count = true;
+      ASSERT_TRUE(std::getline(line_stream, name, ','));
+      EXPECT_EQ(1u, names.count(name));
+    }
+    ASSERT_TRUE(std::getline(line_stream, count, ','));
+    EXPECT_TRUE(line_stream.eof());
+    int value = std::stoi(count);
+    EXPECT_LE(0, value);
+    EXPECT_LE(value, 10000);
+    if (marker == "builtin_count" && value == 10000) saw_max_count = true;
+  }
+  EXPECT_EQ(!os.str().empty(), saw_max_count);
+
+  sampler.ResetCounts();
+  std::ostringstream empty;
+  sampler.Log(empty);
+  EXPECT_TRUE(empty.str().empty());
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -633,6 +633,50 @@ TEST_P(MicrotaskQueueTest, DetachGlobal_InactiveHandler) {
       Object::GetElement(isolate(), result, 1).ToHandleChecked()->IsFalse());
 }
 
+// Runs of promise reaction jobs share their entered context. Ensure that
+// switching between contexts, and to other kinds of microtasks, still enters
+// the right one.
+TEST_P(MicrotaskQueueTest, ReactionJobsFromSeveralContexts) {
+  Local<v8::Context> sub_context = v8::Context::New(v8_isolate());
+  Handle<NativeContext> sub_native_context =
+      Utils::OpenHandle(*sub_context)->native_context();
+  sub_native_context->set_microtask_queue(isolate(), microtask_queue());
+
+  Handle<JSArray> result =
+      RunJS<JSArray>("var result = []; var p = Promise.resolve(); result");
+  {
+    v8::Context::Scope scope(sub_context);
+    CHECK(sub_context->Global()
+              ->Set(sub_context, NewString("result"),
+                    Utils::ToLocal(Handle<JSReceiver>::cast(result)))
+              .FromJust());
+    RunJS("var p = Promise.resolve();");
+  }
+
+  RunJS("p.then(() => result.push(1)); p.then(() => result.push(2));");
+  {
+    v8::Context::Scope scope(sub_context);
+    RunJS("p.then(() => result.push(3));");
+  }
+  HandleScopeImplementer* hsi = isolate()->handle_scope_implementer();
+  size_t entered_context_count = hsi->EnteredContextCount();
+  microtask_queue()->EnqueueMicrotask(
+      *NewMicrotask([hsi, entered_context_count] {
+        EXPECT_EQ(entered_context_count, hsi->EnteredContextCount());
+      }));
+  RunJS("p.then(() => result.push(4));");
+
+  microtask_queue()->RunMicrotasks(isolate());
+  EXPECT_EQ(entered_context_count, hsi->EnteredContextCount());
+  EXPECT_EQ(4, Smi::ToInt(result->length()));
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(i + 1, Smi::ToInt(*Object::GetElement(isolate(), result, i)
+                                     .ToHandleChecked()));
+  }
+
+  sub_context->DetachGlobal();
+}
+
 TEST_P(MicrotaskQueueTest, MicrotasksScope) {
   ASSERT_NE(isolate()->default_microtask_queue(), microtask_queue());
   microtask_queue()->set_microtasks_policy(MicrotasksPolicy::kScoped);
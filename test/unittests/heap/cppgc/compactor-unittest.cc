@@ -23,6 +23,13 @@ class CompactableCustomSpace : public CustomSpace<CompactableCustomSpace> {
   static constexpr bool kSupportsCompaction = true;
 };
 
+class OtherCompactableCustomSpace
+    : public CustomSpace<OtherCompactableCustomSpace> {
+ public:
+  static constexpr size_t kSpaceIndex = 1;
+  static constexpr bool kSupportsCompaction = true;
+};
+
 namespace internal {
 
 namespace {
@@ -43,13 +50,15 @@ struct CompactableGCed : public GarbageCollected<CompactableGCed> {
 // static
 size_t CompactableGCed::g_destructor_callcount = 0;
 
-template <int kNumObjects>
+struct OtherSpaceCompactableGCed final : public CompactableGCed {};
+
+template <int kNumObjects, typename T = CompactableGCed>
 struct CompactableHolder
-    : public GarbageCollected<CompactableHolder<kNumObjects>> {
+    : public GarbageCollected<CompactableHolder<kNumObjects, T>> {
  public:
   explicit CompactableHolder(cppgc::AllocationHandle& allocation_handle) {
     for (int i = 0; i < kNumObjects; ++i)
-      objects[i] = MakeGarbageCollected<CompactableGCed>(allocation_handle);
+      objects[i] = MakeGarbageCollected<T>(allocation_handle);
   }
 
   void Trace(Visitor* visitor) const {
@@ -69,6 +78,8 @@ class CompactorTest : public testing::TestWithPlatform {
     Heap::HeapOptions options;
     options.custom_spaces.emplace_back(
         std::make_unique<CompactableCustomSpace>());
+    options.custom_spaces.emplace_back(
+        std::make_unique<OtherCompactableCustomSpace>());
     heap_ = Heap::Create(platform_, std::move(options));
   }
 
@@ -118,6 +129,11 @@ struct SpaceTrait<internal::CompactableGCed> {
   using Space = CompactableCustomSpace;
 };
 
+template <>
+struct SpaceTrait<internal::OtherSpaceCompactableGCed> {
+  using Space = OtherCompactableCustomSpace;
+};
+
 namespace internal {
 
 TEST_F(CompactorTest, NothingToCompact) {
@@ -184,6 +200,40 @@ TEST_F(CompactorTest, NonEmptySpaceHalfLive) {
   }
 }
 
+TEST_F(CompactorTest, SpacesOverBudgetAreSwept) {
+  static constexpr int kNumObjects = 10;
+  // Only a single space fits into the budget.
+  compactor().SetCompactionBudgetForTesting(1);
+  Persistent<CompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<CompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  Persistent<CompactableHolder<kNumObjects, OtherSpaceCompactableGCed>>
+      other_holder = MakeGarbageCollected<
+          CompactableHolder<kNumObjects, OtherSpaceCompactableGCed>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  CompactableGCed* references[kNumObjects] = {nullptr};
+  CompactableGCed* other_references[kNumObjects] = {nullptr};
+  for (int i = 0; i < kNumObjects; ++i) {
+    references[i] = holder->objects[i];
+    other_references[i] = other_holder->objects[i];
+  }
+  StartGC();
+  for (int i = 0; i < kNumObjects; i += 2) {
+    holder->objects[i] = nullptr;
+    other_holder->objects[i] = nullptr;
+  }
+  EndGC();
+  EXPECT_EQ(10u, CompactableGCed::g_destructor_callcount);
+  // Objects on the first space are compacted.
+  for (int i = 1; i < kNumObjects; i += 2) {
+    EXPECT_EQ(holder->objects[i], references[i / 2]);
+  }
+  // Objects on the other space are swept in place.
+  for (int i = 1; i < kNumObjects; i += 2) {
+    EXPECT_EQ(other_holder->objects[i], other_references[i]);
+  }
+}
+
 TEST_F(CompactorTest, CompactAcrossPages) {
   Persistent<CompactableHolder<1>> holder =
       MakeGarbageCollected<CompactableHolder<1>>(GetAllocationHandle(),
@@ -180,9 +180,30 @@ TEST_F(ConcurrentSweeperTest, BackgroundSweepOfNormalPage) {
   EXPECT_TRUE(FreeListContains(space, {unmarked_object}));
 }
 
+TEST_F(ConcurrentSweeperTest, BackgroundSweepOfEmptyNormalPage) {
+  // Empty pages without finalizers are returned to the backend right away.
+  using GCedType = NormalNonFinalizable;
+
+  auto* unmarked_object = MakeGarbageCollected<GCedType>(GetAllocationHandle());
+  auto* page = BasePage::FromPayload(unmarked_object);
+  auto& space = page->space();
+  ASSERT_EQ(1u, space.size());
+
+  StartSweeping();
+
+  // Wait for concurrent sweeping to finish.
+  WaitForConcurrentSweeping();
+
+  EXPECT_FALSE(PageInBackend(page));
+
+  FinishSweeping();
+
+  EXPECT_EQ(space.end(), std::find(space.begin(), space.end(), page));
+}
+
 TEST_F(ConcurrentSweeperTest, BackgroundSweepOfLargePage) {
-  // Non finalizable objects are swept right away but the page is only returned
-  // from the main thread.
+  // Non finalizable objects are swept right away and their pages are returned
+  // to the backend from the background thread.
   using GCedType = LargeNonFinalizable;
 
   auto* unmarked_object = MakeGarbageCollected<GCedType>(GetAllocationHandle());
@@ -209,15 +230,11 @@ TEST_F(ConcurrentSweeperTest, BackgroundSweepOfLargePage) {
     EXPECT_FALSE(hoh.IsMarked());
   }
 
-  // The page should not have been removed on the background threads.
-  EXPECT_TRUE(PageInBackend(unmarked_page));
+  // The page should have been removed on the background threads.
+  EXPECT_FALSE(PageInBackend(unmarked_page));
 
   FinishSweeping();
 
-  // Check that free list entries are created right away for non-finalizable
-  // objects, but not immediately returned to the space's freelist.
-  EXPECT_FALSE(PageInBackend(unmarked_page));
-
   // Check that marked pages are returned to space right away.
   EXPECT_NE(space.end(), std::find(space.begin(), space.end(), marked_page));
 }
@@ -289,9 +306,9 @@ TEST_F(ConcurrentSweeperTest, DeferredFinalizationOfLargePage) {
   EXPECT_FALSE(PageInBackend(page));
 }
 
-TEST_F(ConcurrentSweeperTest, DestroyLargePageOnMainThread) {
+TEST_F(ConcurrentSweeperTest, DestroyLargePageConcurrentlyToAllocation) {
   // This test fails with TSAN when large pages are destroyed concurrently
-  // without proper support by the backend.
+  // without proper synchronization in the backend.
   using GCedType = LargeNonFinalizable;
 
   auto* object = MakeGarbageCollected<GCedType>(GetAllocationHandle());
@@ -183,5 +183,24 @@ TEST(FreeListTest, Allocate) {
   EXPECT_EQ(0u, empty_block.size);
 }
 
+TEST(FreeListTest, AllocateChecksOnlyFirstEntryOfPartiallyFittingBucket) {
+  Block small(48);
+  Block big(56);
+  FreeList list;
+  list.Add({small.Address(), small.Size()});
+  list.Add({big.Address(), big.Size()});
+  // Both entries live in the same bucket and only the most recently added
+  // entry is checked.
+  const auto result = list.Allocate(56);
+  EXPECT_EQ(big.Address(), result.address);
+  EXPECT_EQ(big.Size(), result.size);
+  const auto no_fit = list.Allocate(56);
+  EXPECT_EQ(nullptr, no_fit.address);
+  EXPECT_EQ(0u, no_fit.size);
+  const auto fit = list.Allocate(48);
+  EXPECT_EQ(small.Address(), fit.address);
+  EXPECT_TRUE(list.IsEmpty());
+}
+
 }  // namespace internal
 }  // namespace cppgc
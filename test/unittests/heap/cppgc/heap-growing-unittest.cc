@@ -114,6 +114,25 @@ TEST(HeapGrowingTest, ConstantGrowingFactor) {
   EXPECT_EQ(1.5 * kObjectSize, growing.limit_for_atomic_gc());
 }
 
+TEST(HeapGrowingTest, NoMarkingSpeedWithoutMarkingTime) {
+  constexpr size_t kObjectSize = 10 * HeapGrowing::kMinLimitIncrease;
+  StatsCollector stats_collector(kNoPlatform);
+  FakeGarbageCollector gc(&stats_collector);
+  cppgc::Heap::ResourceConstraints constraints;
+  constraints.initial_heap_size_bytes = HeapGrowing::kMinLimitIncrease;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  gc.SetLiveBytes(kObjectSize);
+  FakeAllocate(&stats_collector, kObjectSize + 1);
+  EXPECT_EQ(1u, gc.epoch());
+  // The fake GC does not spend any time marking, which leaves the speed
+  // unknown and falls back to the default estimate.
+  EXPECT_EQ(0, growing.marking_speed_in_bytes_per_ms());
+  EXPECT_LE(kObjectSize, growing.limit_for_incremental_gc());
+  EXPECT_GT(growing.limit_for_atomic_gc(), growing.limit_for_incremental_gc());
+}
+
 TEST(HeapGrowingTest, SmallHeapGrowing) {
   // Larger constant to avoid running into special handling for smaller heaps.
   constexpr size_t kLargeAllocation = 100 * kMB;
@@ -659,6 +659,28 @@ class GCedWithCustomWeakCallback final
 size_t GCedWithCustomWeakCallback::custom_callback_called = 0;
 }  // namespace
 
+TEST_F(MinorGCTest, RememberedSlotsOnManyPages) {
+  // Large objects reside on separate pages, so that remembered slots are
+  // spread over enough pages to be visited in parallel.
+  static constexpr size_t kNumOldObjects = 16;
+  std::vector<Persistent<Large>> old_objects;
+  for (size_t i = 0; i < kNumOldObjects; ++i) {
+    old_objects.emplace_back(
+        MakeGarbageCollected<Large>(GetAllocationHandle()));
+  }
+  CollectMinor();
+  for (auto& old_object : old_objects) {
+    EXPECT_TRUE(IsHeapObjectOld(old_object.Get()));
+    old_object->next = MakeGarbageCollected<Small>(GetAllocationHandle());
+    EXPECT_TRUE(IsHeapObjectYoung(old_object->next.Get()));
+  }
+  CollectMinor();
+  EXPECT_EQ(0u, DestructedObjects());
+  for (auto& old_object : old_objects) {
+    EXPECT_TRUE(IsHeapObjectOld(old_object->next.Get()));
+  }
+}
+
 TEST_F(MinorGCTest, ReexecuteCustomCallback) {
   // Create an object with additional kBytesToAllocate bytes.
   Persistent<GCedWithCustomWeakCallback> old =
@@ -412,6 +412,22 @@ TEST_F(GCTracerTest, BackgroundScavengerScope) {
           .scopes[GCTracer::Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL]);
 }
 
+TEST_F(GCTracerTest, ScavengeTaskSamples) {
+  if (v8_flags.stress_incremental_marking) return;
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  StartTracing(tracer, GarbageCollector::SCAVENGER, StartTracingMode::kAtomic);
+  tracer->AddScavengeTaskSample(base::TimeDelta::FromMilliseconds(3));
+  tracer->AddScavengeTaskSample(base::TimeDelta::FromMilliseconds(7));
+  tracer->AddScavengeTaskSample(base::TimeDelta::FromMilliseconds(2));
+  StopTracing(tracer, GarbageCollector::SCAVENGER);
+  EXPECT_EQ(3, tracer->current_.scavenge_task_runs);
+  EXPECT_EQ(base::TimeDelta::FromMilliseconds(7),
+            tracer->current_.scavenge_task_max_duration);
+  EXPECT_EQ(base::TimeDelta::FromMilliseconds(12),
+            tracer->current_.scavenge_task_total_duration);
+}
+
 TEST_F(GCTracerTest, BackgroundMinorMSScope) {
   if (v8_flags.stress_incremental_marking) return;
   GCTracer* tracer = i_isolate()->heap()->tracer();
@@ -108,5 +108,43 @@ TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
           new_space_capacity, factor, Heap::HeapGrowingMode::kMinimal));
 }
 
+TEST_F(MemoryControllerTest, NewSpaceTargetCapacity) {
+  Heap* heap = i_isolate()->heap();
+  const size_t min_capacity = 1 * MB;
+  const size_t max_capacity = 16 * MB;
+  const size_t current_capacity = 4 * MB;
+  const double pause_target = 2.0;
+
+  // Without samples the capacity is kept.
+  EXPECT_EQ(current_capacity,
+            NewSpaceController::TargetCapacity(
+                heap, current_capacity, min_capacity, max_capacity, 0, 10,
+                1 * MB, pause_target));
+
+  // High throughput and low survival grow new space, but at most by the
+  // growing factor per step.
+  EXPECT_EQ(
+      std::min(max_capacity,
+               current_capacity *
+                   std::max(v8_flags.semi_space_growth_factor.value(), 2)),
+      NewSpaceController::TargetCapacity(heap, current_capacity, min_capacity,
+                                         max_capacity, 1 * MB, 1, 1 * MB,
+                                         pause_target));
+
+  // A slow scavenger with high survival is bounded by the pause target:
+  // 2 ms * 256 KB/ms / 50% = 1 MB.
+  EXPECT_EQ(2 * MB, NewSpaceController::TargetCapacity(
+                        heap, current_capacity, min_capacity, max_capacity,
+                        1 * MB, 50, 256 * KB, pause_target));
+  EXPECT_EQ(1 * MB, NewSpaceController::TargetCapacity(
+                        heap, 2 * MB, min_capacity, max_capacity, 1 * MB, 50,
+                        256 * KB, pause_target));
+
+  // Low throughput shrinks new space down to the minimum.
+  EXPECT_EQ(min_capacity, NewSpaceController::TargetCapacity(
+                              heap, 2 * MB, min_capacity, max_capacity, 1, 1,
+                              1 * MB, pause_target));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -7,6 +7,8 @@
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <string>
+#include <vector>
 
 #include "include/v8-isolate.h"
 #include "include/v8-object.h"
@@ -19,6 +21,7 @@
 #include "src/heap/safepoint.h"
 #include "src/heap/spaces-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/string-table.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -486,5 +489,32 @@ TEST_F(HeapTest, Regress978156) {
   heap->marking_state()->TryMarkAndAccountLiveBytes(filler);
 }
 
+TEST_F(HeapTest, StringTableIsClearedInChunks) {
+  // Enough strings for the string table to be cleared by several job items.
+  constexpr int kStrings = 200000;
+  Factory* factory = isolate()->factory();
+  StringTable* string_table = isolate()->string_table();
+  HandleScope handle_scope(isolate());
+  std::vector<Handle<String>> retained;
+  for (int i = 0; i < kStrings; i++) {
+    std::string name = "chunked-string-table-" + std::to_string(i);
+    if (i % 2 == 0) {
+      retained.push_back(factory->InternalizeUtf8String(name.c_str()));
+    } else {
+      HandleScope inner_scope(isolate());
+      factory->InternalizeUtf8String(name.c_str());
+    }
+  }
+  const int elements_before = string_table->NumberOfElements();
+
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap());
+  InvokeMajorGC();
+  EXPECT_LE(string_table->NumberOfElements(), elements_before - kStrings / 2);
+  for (int i = 0; i < kStrings; i += 2) {
+    std::string name = "chunked-string-table-" + std::to_string(i);
+    EXPECT_EQ(*retained[i / 2], *factory->InternalizeUtf8String(name.c_str()));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -306,5 +306,48 @@ TEST(MemoryReducer, FromRunToWait) {
   EXPECT_EQ(2000, state1.last_gc_time_ms());
 }
 
+TEST(MemoryReducer, ProcessMemoryBudget) {
+  if (!v8_flags.incremental_marking) return;
+
+  MemoryReducer::State state0(MemoryReducer::State::CreateDone(1.0, 0)),
+      state1(MemoryReducer::State::CreateDone(1.0, 0));
+
+  // Growing committed memory does not start the memory reducer.
+  MemoryReducer::Event event =
+      MarkCompactEventGarbageLeft(2, MemoryReducer::kCommittedMemoryDelta);
+  event.has_memory_budget = true;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(MemoryReducer::kDone, state1.id());
+
+  // A low allocation rate does not start a GC below the budget.
+  state0 = MemoryReducer::State::CreateWait(0, 1000.0, 1);
+  event = TimerEventLowAllocationRate(2000);
+  event.has_memory_budget = true;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(MemoryReducer::kDone, state1.id());
+
+  // Neither does the watchdog.
+  event = TimerEventHighAllocationRate(MemoryReducer::kWatchdogDelayMs + 2);
+  event.has_memory_budget = true;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(MemoryReducer::kDone, state1.id());
+
+  event = TimerEventLowAllocationRate(2000);
+  event.has_memory_budget = true;
+  event.approaching_memory_budget = true;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(MemoryReducer::kRun, state1.id());
+  EXPECT_EQ(1, state1.started_gcs());
+
+  // GCs are scheduled more eagerly close to the budget.
+  event = MarkCompactEventNoGarbageLeft(2000, 0);
+  event.has_memory_budget = true;
+  event.approaching_memory_budget = true;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(MemoryReducer::kWait, state1.id());
+  EXPECT_EQ(2000 + MemoryReducer::kShortDelayMs, state1.next_gc_start_ms());
+  EXPECT_EQ(2000, state1.last_gc_time_ms());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -386,6 +386,38 @@ TEST_F(ConstantArrayBuilderTest, AllocateEntriesWithFixedReservations) {
   }
 }
 
+TEST_F(ConstantArrayBuilderTest, SharesSmallConstantPools) {
+  AstValueFactory ast_factory(zone(), isolate()->ast_string_constants(),
+                              HashSeed(isolate()));
+  const AstRawString* name = ast_factory.GetOneByteString("shared_name");
+  const AstRawString* other = ast_factory.GetOneByteString("other_name");
+  ast_factory.Internalize(isolate());
+
+  auto build = [&](const AstRawString* second, int smi) {
+    ConstantArrayBuilder builder(zone());
+    builder.Insert(name);
+    if (second != nullptr) builder.Insert(second);
+    builder.Insert(Smi::FromInt(smi));
+    return builder.ToFixedArray(isolate());
+  };
+
+  Handle<FixedArray> first = build(other, 42);
+  ASSERT_EQ(3, first->length());
+  // An identical pool is shared.
+  CHECK_EQ(*first, *build(other, 42));
+  // Pools that differ in any entry are not.
+  CHECK_NE(*first, *build(other, 43));
+  CHECK_NE(*first, *build(nullptr, 42));
+
+  // Pools that don't start with a string are never shared.
+  ConstantArrayBuilder smi_builder(zone());
+  smi_builder.Insert(Smi::FromInt(1));
+  ConstantArrayBuilder smi_builder2(zone());
+  smi_builder2.Insert(Smi::FromInt(1));
+  CHECK_NE(*smi_builder.ToFixedArray(isolate()),
+           *smi_builder2.ToFixedArray(isolate()));
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #include "src/libplatform/default-platform.h"
 #include "src/base/platform/semaphore.h"
 #include "src/base/platform/time.h"
+#include "src/libplatform/default-worker-threads-task-runner.h"
 #include "testing/gmock/include/gmock/gmock.h"
 
 using testing::InSequence;
@@ -237,6 +238,21 @@ class TestBackgroundTask : public Task {
   bool* executed_;
 };
 
+class WorkerGroupTask : public Task {
+ public:
+  explicit WorkerGroupTask(int* group, base::Semaphore* sem = nullptr)
+      : group_(group), sem_(sem) {}
+
+  void Run() override {
+    *group_ = DefaultWorkerThreadsTaskRunner::CurrentGroup();
+    if (sem_) sem_->Signal();
+  }
+
+ private:
+  int* group_;
+  base::Semaphore* sem_;
+};
+
 }  // namespace
 
 TEST(CustomDefaultPlatformTest, RunBackgroundTask) {
@@ -252,6 +268,40 @@ TEST(CustomDefaultPlatformTest, RunBackgroundTask) {
   EXPECT_TRUE(task_executed);
 }
 
+TEST(CustomDefaultPlatformTest, WorkerGroups) {
+  DefaultPlatform platform(1);
+  int dummy;
+  Isolate* isolate = reinterpret_cast<Isolate*>(&dummy);
+  const int group = NewWorkerGroup(&platform);
+  EXPECT_NE(DefaultWorkerThreadsTaskRunner::kDefaultGroup, group);
+  SetWorkerGroup(&platform, isolate, group);
+
+  // Worker tasks posted within a scope for the isolate belong to its group.
+  base::Semaphore sem(0);
+  int worker_task_group = -1;
+  {
+    WorkerGroupScope scope(&platform, isolate);
+    EXPECT_EQ(group, DefaultWorkerThreadsTaskRunner::CurrentGroup());
+    platform.CallOnWorkerThread(
+        std::make_unique<WorkerGroupTask>(&worker_task_group, &sem));
+  }
+  EXPECT_EQ(DefaultWorkerThreadsTaskRunner::kDefaultGroup,
+            DefaultWorkerThreadsTaskRunner::CurrentGroup());
+  EXPECT_TRUE(sem.WaitFor(base::TimeDelta::FromSeconds(1)));
+  EXPECT_EQ(group, worker_task_group);
+
+  // So do the ones posted from its foreground tasks.
+  int foreground_task_group = -1;
+  platform.GetForegroundTaskRunner(isolate)->PostTask(
+      std::make_unique<WorkerGroupTask>(&foreground_task_group));
+  EXPECT_TRUE(platform.PumpMessageLoop(isolate));
+  EXPECT_EQ(group, foreground_task_group);
+  EXPECT_EQ(DefaultWorkerThreadsTaskRunner::kDefaultGroup,
+            DefaultWorkerThreadsTaskRunner::CurrentGroup());
+
+  platform.NotifyIsolateShutdown(isolate);
+}
+
 TEST(CustomDefaultPlatformTest, PostForegroundTaskAfterPlatformTermination) {
   std::shared_ptr<TaskRunner> foreground_taskrunner;
   {
@@ -133,6 +133,47 @@ class FakeClock {
 
 std::atomic<double> FakeClock::time_{0.0};
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskPriorityOrder) {
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime);
+
+  std::vector<int> order;
+  base::Semaphore blocker_started(0);
+  base::Semaphore blocker_release(0);
+  base::Semaphore semaphore(0);
+
+  // Keep the only worker busy until all tasks are queued.
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    blocker_started.Signal();
+    blocker_release.Wait();
+  }));
+  blocker_started.Wait();
+
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(1); }),
+                  TaskPriority::kBestEffort);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(2); }),
+                  TaskPriority::kUserVisible);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(3); }),
+                  TaskPriority::kUserBlocking);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(4); }),
+                  TaskPriority::kUserVisible);
+  runner.PostTask(std::make_unique<TestTask>([&] {
+                    order.push_back(5);
+                    semaphore.Signal();
+                  }),
+                  TaskPriority::kBestEffort);
+  blocker_release.Signal();
+
+  semaphore.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(5UL, order.size());
+  ASSERT_EQ(3, order[0]);
+  ASSERT_EQ(2, order[1]);
+  ASSERT_EQ(4, order[2]);
+  ASSERT_EQ(1, order[3]);
+  ASSERT_EQ(5, order[4]);
+}
+
 TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostDelayedTaskOrder) {
   FakeClock::set_time(0.0);
   DefaultWorkerThreadsTaskRunner runner(1, FakeClock::time);
@@ -268,6 +309,110 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostAfterTerminate) {
   ASSERT_EQ(1, order[0]);
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskFromWorkerThreads) {
+  DefaultWorkerThreadsTaskRunner runner(4, RealTime);
+
+  // Each task posts kFanOut more tasks from its worker thread until kDepth is
+  // reached. Tasks posted by one worker are stolen by the others.
+  constexpr int kFanOut = 4;
+  constexpr int kDepth = 4;
+  constexpr int kTotalTasks = 1 + 4 + 16 + 64 + 256;
+  std::atomic_int count{0};
+  base::Semaphore semaphore(0);
+  std::function<void(int)> run = [&](int depth) {
+    if (depth < kDepth) {
+      for (int i = 0; i < kFanOut; ++i) {
+        runner.PostTask(
+            std::make_unique<TestTask>([&run, depth] { run(depth + 1); }));
+      }
+    }
+    if (++count == kTotalTasks) semaphore.Signal();
+  };
+  runner.PostTask(std::make_unique<TestTask>([&run] { run(0); }));
+
+  semaphore.Wait();
+  runner.Terminate();
+  ASSERT_EQ(kTotalTasks, count);
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, GroupsTakeTurns) {
+  constexpr int kGroup = 1;
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime);
+
+  std::vector<int> order;
+  base::Semaphore started(0);
+  base::Semaphore blocked(0);
+  base::Semaphore semaphore(0);
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    started.Signal();
+    blocked.Wait();
+  }));
+  started.Wait();
+
+  // The groups take turns instead of running their tasks in posting order.
+  auto post = [&](int group, int id) {
+    DefaultWorkerThreadsTaskRunner::SetCurrentGroup(group);
+    runner.PostTask(std::make_unique<TestTask>([&, group, id] {
+      EXPECT_EQ(group, DefaultWorkerThreadsTaskRunner::CurrentGroup());
+      order.push_back(id);
+      if (order.size() == 5) semaphore.Signal();
+    }));
+  };
+  post(kGroup, 1);
+  post(kGroup, 2);
+  post(kGroup, 3);
+  post(DefaultWorkerThreadsTaskRunner::kDefaultGroup, 10);
+  post(DefaultWorkerThreadsTaskRunner::kDefaultGroup, 11);
+  DefaultWorkerThreadsTaskRunner::SetCurrentGroup(
+      DefaultWorkerThreadsTaskRunner::kDefaultGroup);
+  blocked.Signal();
+
+  semaphore.Wait();
+  runner.Terminate();
+  ASSERT_EQ(std::vector<int>({10, 1, 11, 2, 3}), order);
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, YieldToOtherGroups) {
+  constexpr int kGroup = 1;
+  constexpr int kNumThreads = 2;
+  DefaultWorkerThreadsTaskRunner runner(kNumThreads, RealTime);
+
+  // Occupy all workers with tasks of one group, which only return once they
+  // are asked to make room for the tasks of the default group.
+  std::atomic_bool done{false};
+  std::atomic_int num_yielded{0};
+  base::Semaphore started(0);
+  base::Semaphore finished(0);
+  DefaultWorkerThreadsTaskRunner::SetCurrentGroup(kGroup);
+  for (int i = 0; i < kNumThreads; ++i) {
+    runner.PostTask(std::make_unique<TestTask>([&] {
+      started.Signal();
+      while (!done) {
+        if (DefaultWorkerThreadsTaskRunner::ShouldYieldToOtherGroups()) {
+          num_yielded++;
+          break;
+        }
+      }
+      finished.Signal();
+    }));
+  }
+  DefaultWorkerThreadsTaskRunner::SetCurrentGroup(
+      DefaultWorkerThreadsTaskRunner::kDefaultGroup);
+  for (int i = 0; i < kNumThreads; ++i) started.Wait();
+
+  EXPECT_FALSE(DefaultWorkerThreadsTaskRunner::ShouldYieldToOtherGroups());
+  base::Semaphore semaphore(0);
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    done = true;
+    semaphore.Signal();
+  }));
+
+  semaphore.Wait();
+  for (int i = 0; i < kNumThreads; ++i) finished.Wait();
+  runner.Terminate();
+  ASSERT_LE(1, num_yielded);
+}
+
 TEST(DefaultWorkerThreadsTaskRunnerUnittest, NoIdleTasks) {
   DefaultWorkerThreadsTaskRunner runner(1, FakeClock::time);
 
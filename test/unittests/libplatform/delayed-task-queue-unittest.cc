@@ -0,0 +1,102 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/delayed-task-queue.h"
+
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/utils/random-number-generator.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+class RecordingTask : public Task {
+ public:
+  RecordingTask(int id, std::vector<int>* order) : id_(id), order_(order) {}
+
+  void Run() override { order_->push_back(id_); }
+
+ private:
+  const int id_;
+  std::vector<int>* order_;
+};
+
+double fake_time = 0.0;
+double FakeTime() { return fake_time; }
+
+// Runs all tasks that are due at the current fake time.
+void RunDueTasks(DelayedTaskQueue* queue) {
+  while (true) {
+    DelayedTaskQueue::MaybeNextTask next = queue->TryGetNext();
+    if (next.state != DelayedTaskQueue::MaybeNextTask::kTask) return;
+    next.task->Run();
+  }
+}
+
+}  // namespace
+
+TEST(DelayedTaskQueueTest, DelayedTasksRunInDeadlineOrder) {
+  fake_time = 0.0;
+  DelayedTaskQueue queue(FakeTime);
+  std::vector<int> order;
+
+  base::RandomNumberGenerator rng(42);
+  constexpr int kNumTasks = 1000;
+  std::vector<double> deadlines;
+  for (int i = 0; i < kNumTasks; ++i) {
+    // Few distinct deadlines, so that many tasks share one.
+    double delay = 1 + rng.NextInt(50);
+    deadlines.push_back(delay);
+    queue.AppendDelayed(std::make_unique<RecordingTask>(i, &order), delay);
+  }
+
+  DelayedTaskQueue::MaybeNextTask next = queue.TryGetNext();
+  EXPECT_EQ(DelayedTaskQueue::MaybeNextTask::kWaitDelayed, next.state);
+
+  for (fake_time = 1.0; fake_time <= 50.0; fake_time += 1.0) {
+    RunDueTasks(&queue);
+  }
+  ASSERT_EQ(static_cast<size_t>(kNumTasks), order.size());
+  for (int i = 1; i < kNumTasks; ++i) {
+    int previous = order[i - 1];
+    int current = order[i];
+    ASSERT_LE(deadlines[previous], deadlines[current]);
+    // Tasks with the same deadline run in posting order.
+    if (deadlines[previous] == deadlines[current]) {
+      ASSERT_LT(previous, current);
+    }
+  }
+
+  next = queue.TryGetNext();
+  EXPECT_EQ(DelayedTaskQueue::MaybeNextTask::kWaitIndefinite, next.state);
+  queue.Terminate();
+}
+
+TEST(DelayedTaskQueueTest, DelayedTasksKeepPriority) {
+  fake_time = 0.0;
+  DelayedTaskQueue queue(FakeTime);
+  std::vector<int> order;
+
+  queue.AppendDelayed(std::make_unique<RecordingTask>(1, &order), 1.0,
+                      TaskPriority::kBestEffort);
+  queue.AppendDelayed(std::make_unique<RecordingTask>(2, &order), 2.0,
+                      TaskPriority::kUserBlocking);
+  queue.Append(std::make_unique<RecordingTask>(3, &order),
+               TaskPriority::kUserVisible);
+
+  fake_time = 2.0;
+  RunDueTasks(&queue);
+  ASSERT_EQ(3u, order.size());
+  EXPECT_EQ(2, order[0]);
+  EXPECT_EQ(3, order[1]);
+  EXPECT_EQ(1, order[2]);
+  queue.Terminate();
+}
+
+}  // namespace platform
+}  // namespace v8
@@ -34,6 +34,8 @@
 
 #include "include/v8-function.h"
 #include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/wrappers.h"
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
 #include "src/codegen/compilation-cache.h"
@@ -1244,4 +1246,29 @@ TEST_F(LogTest, BuiltinsNotLoggedAsLazyCompile) {
         {"code-creation,JS,2,", std::string(buffer.begin())}));
   }
 }
+
+#if V8_OS_LINUX
+TEST_F(TestWithContext, PerfJitDumpAtRuntime) {
+  RunJS("function f(a) { return a + 1; } f(1);");
+  isolate()->SetPerfJitDumpEnabled(true);
+  RunJS("function g(a) { return f(a) * 2; } g(2);");
+  // Code moves are logged while the dump is enabled.
+  i::ManualGCScope manual_gc_scope(i_isolate());
+  i::v8_flags.compact_on_every_full_gc = true;
+  InvokeMajorGC();
+  isolate()->SetPerfJitDumpEnabled(false);
+
+  // The file is complete once the dump is disabled.
+  v8::base::EmbeddedVector<char, 32> file_name;
+  v8::base::SNPrintF(file_name, "./jit-%d.dump",
+                     v8::base::OS::GetCurrentProcessId());
+  FILE* file = v8::base::Fopen(file_name.begin(), "rb");
+  CHECK_NOT_NULL(file);
+  uint32_t magic = 0;
+  CHECK_EQ(1u, fread(&magic, sizeof(magic), 1, file));
+  CHECK_EQ(0x4A695444u, magic);
+  v8::base::Fclose(file);
+  CHECK_EQ(0, remove(file_name.begin()));
+}
+#endif  // V8_OS_LINUX
 }  // namespace v8
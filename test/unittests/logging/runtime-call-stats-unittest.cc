@@ -639,6 +639,41 @@ TEST_F(RuntimeCallStatsTest, ApiGetter) {
   EXPECT_EQ(kCustomCallbackTime * 4013, counter2()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, Sampling) {
+  TracingFlags::runtime_stats.store(
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING,
+      std::memory_order_relaxed);
+  RuntimeCallStatsSampler sampler(stats(), 1000);
+
+  RuntimeCallTimer timer;
+  stats()->Enter(&timer, counter_id());
+  // Only the current counter is maintained while sampling.
+  EXPECT_FALSE(timer.IsStarted());
+  EXPECT_EQ(counter(), stats()->current_counter());
+  sampler.DoSample();
+  sampler.DoSample();
+  stats()->Leave(&timer);
+  EXPECT_EQ(nullptr, stats()->current_counter());
+  sampler.DoSample();
+
+  EXPECT_EQ(2, sampler.Samples(counter_id()));
+  EXPECT_EQ(0, sampler.Samples(counter_id2()));
+  EXPECT_EQ(0, counter()->count());
+  EXPECT_EQ(0, counter()->time().InMicroseconds());
+
+  v8::metrics::RuntimeCallStatsSampled event;
+  sampler.TakeSamples(&event);
+  EXPECT_EQ(1000, event.sampling_interval_in_us);
+  EXPECT_EQ(3, event.total_sample_count);
+  ASSERT_EQ(1u, event.counters.size());
+  EXPECT_STREQ(counter()->name(), event.counters[0].name);
+  EXPECT_EQ(2, event.counters[0].sample_count);
+
+  sampler.TakeSamples(&event);
+  EXPECT_EQ(0, event.total_sample_count);
+  EXPECT_TRUE(event.counters.empty());
+}
+
 TEST_F(RuntimeCallStatsTest, GarbageCollection) {
   if (v8_flags.stress_incremental_marking) return;
   v8_flags.expose_gc = true;
@@ -32,6 +32,7 @@
 #include "src/base/numbers/bignum.h"
 #include "src/base/numbers/diy-fp.h"
 #include "src/base/numbers/double.h"
+#include "src/base/numbers/eisel-lemire.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/init/v8.h"
 #include "test/unittests/test-utils.h"
@@ -473,5 +474,43 @@ TEST_F(StrtodTest, RandomStrtod) {
   }
 }
 
+TEST_F(StrtodTest, EiselLemire) {
+  CHECK_EQ(0.0, EiselLemire(0, 0));
+  CHECK_EQ(0.0, EiselLemire(1, -400));
+  CHECK_EQ(1.0, EiselLemire(1, 0));
+  CHECK_EQ(0.1, EiselLemire(1, -1));
+  CHECK_EQ(1e23, EiselLemire(1, 23));
+  CHECK_EQ(1.7976931348623157e308, EiselLemire(17976931348623157, 292));
+  CHECK_EQ(V8_INFINITY, EiselLemire(17976931348623159, 292));
+  CHECK_EQ(V8_INFINITY, EiselLemire(1, 400));
+  // Subnormals, and rounding up to the smallest normal number.
+  CHECK_EQ(5e-324, EiselLemire(5, -324));
+  CHECK_EQ(5e-324, EiselLemire(24703282292062328, -340));
+  CHECK_EQ(0.0, EiselLemire(24703282292062327, -340));
+  CHECK_EQ(2.2250738585072014e-308, EiselLemire(22250738585072012, -324));
+  // Halfway cases round to even.
+  CHECK_EQ(9007199254740992.0, EiselLemire(9007199254740993, 0));
+  CHECK_EQ(9007199254740996.0, EiselLemire(9007199254740995, 0));
+  CHECK_EQ(9007199254740996.0, EiselLemire(90071992547409950, -1));
+
+  // Significands with up to 19 digits are exact.
+  base::RandomNumberGenerator rng;
+  char buffer[kBufferSize];
+  for (int length = 15; length <= 19; length++) {
+    for (int i = 0; i < 100; ++i) {
+      uint64_t significand = rng.NextInt(9) + 1;
+      buffer[0] = static_cast<char>('0' + significand);
+      for (int j = 1; j < length; ++j) {
+        int digit = rng.NextInt(10);
+        significand = significand * 10 + digit;
+        buffer[j] = static_cast<char>('0' + digit);
+      }
+      int exponent = DeterministicRandom() % (308 * 2 + 1) - 308;
+      Vector<const char> vector(buffer, length);
+      CHECK(CheckDouble(vector, exponent, EiselLemire(significand, exponent)));
+    }
+  }
+}
+
 }  // namespace base
 }  // namespace v8
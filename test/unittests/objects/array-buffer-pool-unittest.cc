@@ -0,0 +1,97 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdlib.h>
+
+#include <set>
+#include <utility>
+
+#include "src/objects/backing-store.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Records the memory that is still allocated, and checks that it is freed
+// with the length it was allocated with.
+class RecordingAllocator : public v8::ArrayBuffer::Allocator {
+ public:
+  ~RecordingAllocator() override { EXPECT_TRUE(allocations_.empty()); }
+
+  void* Allocate(size_t length) override {
+    void* data = calloc(length, 1);
+    allocations_.insert({data, length});
+    return data;
+  }
+  void* AllocateUninitialized(size_t length) override {
+    return Allocate(length);
+  }
+  void Free(void* data, size_t length) override {
+    EXPECT_EQ(1u, allocations_.erase({data, length}));
+    free(data);
+  }
+
+ private:
+  std::set<std::pair<void*, size_t>> allocations_;
+};
+
+}  // namespace
+
+TEST(ArrayBufferPoolTest, SizeClasses) {
+  EXPECT_FALSE(ArrayBufferPool::IsPoolable(0));
+  EXPECT_TRUE(ArrayBufferPool::IsPoolable(1));
+  EXPECT_TRUE(ArrayBufferPool::IsPoolable(64 * KB));
+  EXPECT_FALSE(ArrayBufferPool::IsPoolable(64 * KB + 1));
+  EXPECT_EQ(size_t{4 * KB}, ArrayBufferPool::AllocationLength(1));
+  EXPECT_EQ(size_t{4 * KB}, ArrayBufferPool::AllocationLength(4 * KB));
+  EXPECT_EQ(size_t{8 * KB}, ArrayBufferPool::AllocationLength(4 * KB + 1));
+  EXPECT_EQ(size_t{64 * KB}, ArrayBufferPool::AllocationLength(64 * KB));
+}
+
+TEST(ArrayBufferPoolTest, ReusesSizeClass) {
+  RecordingAllocator allocator;
+  ArrayBufferPool pool;
+  EXPECT_EQ(nullptr, pool.TryTake(100));
+
+  void* memory = allocator.Allocate(ArrayBufferPool::AllocationLength(100));
+  EXPECT_TRUE(pool.TryPut(memory, 100));
+  // Different size class.
+  EXPECT_EQ(nullptr, pool.TryTake(5000));
+  // Same size class.
+  EXPECT_EQ(memory, pool.TryTake(4000));
+  EXPECT_EQ(nullptr, pool.TryTake(4000));
+
+  EXPECT_TRUE(pool.TryPut(memory, 4000));
+  pool.TearDown(&allocator);
+}
+
+TEST(ArrayBufferPoolTest, Bounded) {
+  RecordingAllocator allocator;
+  ArrayBufferPool pool;
+  const size_t kLength = ArrayBufferPool::kMaxPooledByteLength;
+  for (size_t i = 0; i < ArrayBufferPool::kMaxPooledBytes / kLength; i++) {
+    EXPECT_TRUE(pool.TryPut(allocator.Allocate(kLength), kLength));
+  }
+  void* memory = allocator.Allocate(kLength);
+  EXPECT_FALSE(pool.TryPut(memory, kLength));
+  allocator.Free(memory, kLength);
+  pool.TearDown(&allocator);
+}
+
+TEST(ArrayBufferPoolTest, TearDown) {
+  RecordingAllocator allocator;
+  ArrayBufferPool pool;
+  EXPECT_TRUE(pool.TryPut(allocator.Allocate(8 * KB), 8 * KB));
+  EXPECT_TRUE(pool.TryPut(allocator.Allocate(12 * KB), 9 * KB));
+  pool.TearDown(&allocator);
+  // Memory freed after the tear down isn't pooled anymore.
+  void* memory = allocator.Allocate(4 * KB);
+  EXPECT_FALSE(pool.TryPut(memory, 4 * KB));
+  allocator.Free(memory, 4 * KB);
+}
+
+}  // namespace internal
+}  // namespace v8
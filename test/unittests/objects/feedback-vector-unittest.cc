@@ -5,6 +5,7 @@
 #include "src/api/api-inl.h"
 #include "src/execution/execution.h"
 #include "src/heap/factory.h"
+#include "src/ic/ic-stats.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/objects-inl.h"
 #include "test/unittests/test-utils.h"
@@ -776,5 +777,52 @@ TEST_F(FeedbackVectorTest, DefineNamedOwnIC) {
   CHECK_EQ(InlineCacheState::MONOMORPHIC, nexus.ic_state());
 }
 
+TEST_F(FeedbackVectorTest, ICSiteStatsTopMegamorphicSites) {
+  v8::HandleScope scope(v8_isolate());
+  TryRunJS("function f(o) { return o.x + o.y; }");
+  Handle<JSFunction> f = GetFunction("f");
+  SharedFunctionInfo shared = f->shared();
+
+  using State = InlineCacheState;
+  ICSiteStats stats;
+  // Slot 0 goes megamorphic and misses twice, slot 1 misses three times, and
+  // slot 2 never becomes megamorphic.
+  stats.RecordTransition(shared, 0, "LoadIC", false, State::UNINITIALIZED,
+                         State::MONOMORPHIC);
+  stats.RecordTransition(shared, 0, "LoadIC", false, State::MONOMORPHIC,
+                         State::MEGAMORPHIC);
+  stats.RecordTransition(shared, 1, "LoadIC", true, State::POLYMORPHIC,
+                         State::MEGAMORPHIC);
+  stats.RecordTransition(shared, 2, "StoreIC", false, State::UNINITIALIZED,
+                         State::MONOMORPHIC);
+  for (int i = 0; i < 2; i++) {
+    stats.RecordTransition(shared, 0, "LoadIC", false, State::MEGAMORPHIC,
+                           State::MEGAMORPHIC);
+  }
+  for (int i = 0; i < 3; i++) {
+    stats.RecordTransition(shared, 1, "LoadIC", true, State::MEGAMORPHIC,
+                           State::MEGAMORPHIC);
+  }
+  CHECK_EQ(3u, stats.site_count());
+
+  std::vector<const ICSiteStats::Site*> sites = stats.TopMegamorphicSites(10);
+  CHECK_EQ(2u, sites.size());
+  CHECK_EQ(1, sites[0]->slot);
+  CHECK_EQ(3u, sites[0]->megamorphic_misses);
+  EXPECT_EQ("KeyedLoadIC", sites[0]->type);
+  EXPECT_EQ("f", sites[0]->function_name);
+  CHECK_EQ(0, sites[1]->slot);
+  CHECK_EQ(2u, sites[1]->megamorphic_misses);
+  CHECK_EQ(1u, sites[1]->transitions[static_cast<int>(State::MONOMORPHIC)]);
+  CHECK_EQ(1u, sites[1]->transitions[static_cast<int>(State::MEGAMORPHIC)]);
+
+  sites = stats.TopMegamorphicSites(1);
+  CHECK_EQ(1u, sites.size());
+  CHECK_EQ(1, sites[0]->slot);
+
+  stats.Reset();
+  CHECK_EQ(0u, stats.site_count());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -2058,6 +2058,86 @@ TEST_F(ValueSerializerTestWithArrayBufferTransfer,
   ExpectScriptTrue("new Uint8Array(result.a).toString() === '0,1,128,255'");
 }
 
+TEST_F(ValueSerializerTest, RoundTripOutOfBandArrayBuffer) {
+  Local<Value> input_value = EvaluateScriptForInput(
+      "var small = new Uint8Array([1, 2, 3]);"
+      "var large = new Float64Array([0.5, 1.5, 2.5, 3.5]);"
+      "({small, large, view: new Uint8Array(large.buffer, 8, 8),"
+      "  buffer: large.buffer})");
+  std::vector<uint8_t> data;
+  std::vector<std::shared_ptr<BackingStore>> backing_stores;
+  {
+    Context::Scope scope(serialization_context());
+    ValueSerializer serializer(isolate());
+    serializer.SetOutOfBandArrayBufferThreshold(16);
+    serializer.WriteHeader();
+    ASSERT_TRUE(serializer.WriteValue(serialization_context(), input_value)
+                    .FromMaybe(false));
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    data.assign(buffer.first, buffer.first + buffer.second);
+    free(buffer.first);
+    backing_stores = serializer.ReleaseOutOfBandBackingStores();
+  }
+  // Only the large buffer is referenced, and only once.
+  ASSERT_EQ(1u, backing_stores.size());
+  EXPECT_EQ(32u, backing_stores[0]->ByteLength());
+
+  Local<Context> context = deserialization_context();
+  Context::Scope scope(context);
+  ValueDeserializer deserializer(isolate(), data.data(), data.size());
+  deserializer.SetOutOfBandBackingStores(backing_stores);
+  ASSERT_TRUE(deserializer.ReadHeader(context).FromMaybe(false));
+  Local<Value> result;
+  ASSERT_TRUE(deserializer.ReadValue(context).ToLocal(&result));
+  ASSERT_TRUE(context->Global()
+                  ->CreateDataProperty(context, StringFromUtf8("result"),
+                                       result)
+                  .FromMaybe(false));
+  ExpectScriptTrue("result.small.toString() === '1,2,3'");
+  ExpectScriptTrue("result.large.toString() === '0.5,1.5,2.5,3.5'");
+  ExpectScriptTrue("result.view.buffer === result.large.buffer");
+  ExpectScriptTrue("result.buffer === result.large.buffer");
+
+  // The deserialized buffer aliases the original contents.
+  Local<Value> large = result.As<Object>()
+                           ->Get(context, StringFromUtf8("large"))
+                           .ToLocalChecked();
+  EXPECT_EQ(backing_stores[0]->Data(),
+            large.As<Float64Array>()->Buffer()->GetBackingStore()->Data());
+}
+
+TEST_F(ValueSerializerTest, RoundTripArrayBufferCopiedInParallel) {
+  // Large enough to be split into several chunks, with a partial last chunk.
+  Local<Value> input_value = EvaluateScriptForInput(
+      "var array = new Uint32Array((9 << 20) / 4 + 3);"
+      "for (var i = 0; i < array.length; i++) array[i] = i * 2654435761;"
+      "array");
+  std::vector<uint8_t> parallel_data;
+  {
+    Context::Scope scope(serialization_context());
+    ValueSerializer serializer(isolate());
+    serializer.SetCopyArrayBuffersInParallel(true);
+    serializer.WriteHeader();
+    ASSERT_TRUE(serializer.WriteValue(serialization_context(), input_value)
+                    .FromMaybe(false));
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    parallel_data.assign(buffer.first, buffer.first + buffer.second);
+    free(buffer.first);
+  }
+  // The wire format does not depend on how the contents were copied.
+  EXPECT_EQ(EncodeTest(input_value), parallel_data);
+
+  Local<Value> value = DecodeTest(parallel_data);
+  ASSERT_TRUE(value->IsUint32Array());
+  ExpectScriptTrue(
+      "result.every((value, i) => value === ((i * 2654435761) >>> 0))");
+}
+
+TEST_F(ValueSerializerTest, DecodeInvalidOutOfBandArrayBuffer) {
+  // The referenced backing store index has not been provided.
+  InvalidDecodeTest({0xFF, 0x0F, 0x45, 0x00});
+}
+
 TEST_F(ValueSerializerTest, RoundTripTypedArray) {
   // Check that the right type comes out the other side for every kind of typed
   // array.
@@ -4,6 +4,7 @@
 
 #include "src/base/platform/platform.h"
 #include "src/objects/backing-store.h"
+#include "src/utils/allocation.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -71,6 +72,46 @@ TEST_F(BackingStoreTest, CopyWasmMemory) {
   EXPECT_EQ(3 * wasm::kWasmPageSize, bs2->byte_capacity());
 }
 
+TEST_F(BackingStoreTest, DiscardWasmMemory) {
+  auto backing_store = BackingStore::AllocateWasmMemory(
+      isolate(), 2, 2, WasmMemoryFlag::kWasmMemory32, SharedFlag::kNotShared);
+  CHECK(backing_store);
+  uint8_t* bytes = reinterpret_cast<uint8_t*>(backing_store->buffer_start());
+  size_t length = backing_store->byte_length();
+  memset(bytes, 0xab, length);
+
+  // Discard everything but the first and the last byte.
+  size_t discarded = backing_store->DiscardWasmMemory(1, length - 2);
+  EXPECT_LT(0u, discarded);
+  EXPECT_GE(length - 2, discarded);
+  EXPECT_EQ(0xab, bytes[0]);
+  EXPECT_EQ(0xab, bytes[length - 1]);
+  for (size_t i = 1; i < length - 1; ++i) ASSERT_EQ(0, bytes[i]);
+
+  // The memory is still usable.
+  bytes[length / 2] = 42;
+  EXPECT_EQ(42, bytes[length / 2]);
+}
+
+TEST_F(BackingStoreTest, DiscardZeroedWasmMemoryTail) {
+  auto backing_store = BackingStore::AllocateWasmMemory(
+      isolate(), 2, 2, WasmMemoryFlag::kWasmMemory32, SharedFlag::kNotShared);
+  CHECK(backing_store);
+  uint8_t* bytes = reinterpret_cast<uint8_t*>(backing_store->buffer_start());
+  size_t page_size = GetArrayBufferPageAllocator()->CommitPageSize();
+  bytes[0] = 1;
+  bytes[wasm::kWasmPageSize] = 2;
+  EXPECT_EQ(wasm::kWasmPageSize - page_size,
+            backing_store->DiscardZeroedWasmMemoryTail());
+  EXPECT_EQ(1, bytes[0]);
+  EXPECT_EQ(2, bytes[wasm::kWasmPageSize]);
+
+  bytes[wasm::kWasmPageSize] = 0;
+  EXPECT_EQ(2 * wasm::kWasmPageSize - page_size,
+            backing_store->DiscardZeroedWasmMemoryTail());
+  EXPECT_EQ(1, bytes[0]);
+}
+
 class GrowerThread : public base::Thread {
  public:
   GrowerThread(Isolate* isolate, uint32_t increment, uint32_t max,
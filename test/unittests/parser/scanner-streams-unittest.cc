@@ -413,6 +413,29 @@ TEST_F(ScannerStreamsTest, Utf8SingleByteChunks) {
   }
 }
 
+TEST_F(ScannerStreamsTest, Utf8SeekOverAsciiRuns) {
+  // Long ascii runs around a two-byte and a four-byte (surrogate pair)
+  // sequence, so that seeking skips over ascii in bulk.
+  std::string ascii(40, 'a');
+  std::string utf8 = ascii + "\xc3\xa4" + ascii + "\xf0\x9f\x98\x80" + ascii;
+  std::u16string ucs2 = std::u16string(40, u'a') + u"\u00e4" +
+                        std::u16string(40, u'a') + u"\U0001f600" +
+                        std::u16string(40, u'a');
+  for (size_t i = 0; i < ucs2.size(); i++) {
+    const char* chunks[] = {utf8.c_str(), ""};
+    ChunkSource chunk_source(chunks);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+        v8::internal::ScannerStream::For(
+            &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+    stream->Seek(i);
+    for (size_t j = i; j < ucs2.size(); j++) {
+      CHECK_EQ(static_cast<int>(ucs2[j]), stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream->Advance());
+  }
+}
+
 #define CHECK_EQU(v1, v2) CHECK_EQ(static_cast<int>(v1), static_cast<int>(v2))
 
 void TestCharacterStream(const char* reference, i::Utf16CharacterStream* stream,
@@ -2101,6 +2101,104 @@ TEST_F(RegExpTest, PeepholeSkipUntilGtOrNotBitInTable) {
                           BC_SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE)));
 }
 
+void CreatePeepholeSkipWhileCharInRangeBytecode(RegExpMacroAssembler* m) {
+  Label start;
+  m->Bind(&start);
+  m->LoadCurrentCharacter(0, nullptr, true);
+  m->CheckCharacterNotInRange('a', 'z', nullptr);
+  m->AdvanceCurrentPosition(1);
+  m->GoTo(&start);
+}
+
+TEST_F(RegExpTest, PeepholeSkipWhileCharInRange) {
+  Zone zone(i_isolate()->allocator(), ZONE_NAME);
+  Factory* factory = i_isolate()->factory();
+  HandleScope scope(i_isolate());
+
+  RegExpBytecodeGenerator orig(i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(i_isolate(), &zone);
+
+  CreatePeepholeSkipWhileCharInRangeBytecode(&orig);
+  CreatePeepholeSkipWhileCharInRangeBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("dummy");
+
+  v8_flags.regexp_peephole_optimization = false;
+  Handle<ByteArray> array = Handle<ByteArray>::cast(orig.GetCode(source));
+  int length = array->length();
+
+  v8_flags.regexp_peephole_optimization = true;
+  Handle<ByteArray> array_optimized =
+      Handle<ByteArray>::cast(opt.GetCode(source));
+  int length_optimized = array_optimized->length();
+
+  int length_expected = RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR) +
+                        RegExpBytecodeLength(BC_CHECK_CHAR_NOT_IN_RANGE) +
+                        RegExpBytecodeLength(BC_ADVANCE_CP_AND_GOTO) +
+                        RegExpBytecodeLength(BC_POP_BT);
+  int length_optimized_expected =
+      RegExpBytecodeLength(BC_SKIP_WHILE_CHAR_IN_RANGE) +
+      RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  CHECK_EQ(BC_SKIP_WHILE_CHAR_IN_RANGE, array_optimized->get(0));
+  CHECK_EQ(BC_POP_BT, array_optimized->get(
+                          RegExpBytecodeLength(BC_SKIP_WHILE_CHAR_IN_RANGE)));
+}
+
+void CreatePeepholeLiteralRunBytecode(RegExpMacroAssembler* m) {
+  m->LoadCurrentCharacter(0, nullptr, false);
+  m->CheckNotCharacter('a', nullptr);
+  m->LoadCurrentCharacter(1, nullptr, false);
+  m->CheckNotCharacter('b', nullptr);
+  m->LoadCurrentCharacter(2, nullptr, false);
+  m->CheckNotCharacter('c', nullptr);
+}
+
+TEST_F(RegExpTest, PeepholeLiteralRun) {
+  Zone zone(i_isolate()->allocator(), ZONE_NAME);
+  Factory* factory = i_isolate()->factory();
+  HandleScope scope(i_isolate());
+
+  RegExpBytecodeGenerator orig(i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(i_isolate(), &zone);
+
+  CreatePeepholeLiteralRunBytecode(&orig);
+  CreatePeepholeLiteralRunBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("dummy");
+
+  v8_flags.regexp_peephole_optimization = false;
+  Handle<ByteArray> array = Handle<ByteArray>::cast(orig.GetCode(source));
+  int length = array->length();
+
+  v8_flags.regexp_peephole_optimization = true;
+  Handle<ByteArray> array_optimized =
+      Handle<ByteArray>::cast(opt.GetCode(source));
+  int length_optimized = array_optimized->length();
+
+  int length_expected =
+      3 * (RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR_UNCHECKED) +
+           RegExpBytecodeLength(BC_CHECK_NOT_CHAR)) +
+      RegExpBytecodeLength(BC_POP_BT);
+  int length_optimized_expected =
+      RegExpBytecodeLength(BC_CHECK_NOT_2_CHARS_AT_UNCHECKED) +
+      RegExpBytecodeLength(BC_CHECK_NOT_CHAR_AT_UNCHECKED) +
+      RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  int pc = 0;
+  CHECK_EQ(BC_CHECK_NOT_2_CHARS_AT_UNCHECKED, array_optimized->get(pc));
+  pc += RegExpBytecodeLength(BC_CHECK_NOT_2_CHARS_AT_UNCHECKED);
+  CHECK_EQ(BC_CHECK_NOT_CHAR_AT_UNCHECKED, array_optimized->get(pc));
+  pc += RegExpBytecodeLength(BC_CHECK_NOT_CHAR_AT_UNCHECKED);
+  CHECK_EQ(BC_POP_BT, array_optimized->get(pc));
+}
+
 void CreatePeepholeLabelFixupsInsideBytecode(RegExpMacroAssembler* m,
                                              Label* dummy_before,
                                              Label* dummy_after,
@@ -0,0 +1,150 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-hasher.h"
+
+#include <string>
+
+#include "src/numbers/hash-seed-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/strings/string-hasher-inl.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Returns the hash with lane hashing disabled.
+template <typename Char>
+uint32_t CharacterWiseHash(const Char* chars, int length, uint64_t seed) {
+  uint32_t running_hash = static_cast<uint32_t>(seed);
+  for (int i = 0; i < length; i++) {
+    running_hash = StringHasher::AddCharacterCore(running_hash, chars[i]);
+  }
+  return String::CreateHashFieldValue(StringHasher::GetHashCore(running_hash),
+                                      String::HashFieldType::kHash);
+}
+
+std::string MakeString(int length, int offset = 0) {
+  std::string result;
+  for (int i = 0; i < length; i++) {
+    result.push_back(static_cast<char>('a' + (i * 7 + offset) % 26));
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(StringHasherTest, ShortStringsAreHashedCharacterWise) {
+  const uint64_t seed = 0x1234567890ABCDEF;
+  std::string str = MakeString(StringHasher::kMinLaneHashLength - 1);
+  EXPECT_EQ(CharacterWiseHash(str.data(), static_cast<int>(str.size()), seed),
+            StringHasher::HashSequentialString(
+                str.data(), static_cast<int>(str.size()), seed));
+}
+
+TEST(StringHasherTest, LaneHashDoesNotDependOnEncoding) {
+  const uint64_t seed = 42;
+  for (int length = StringHasher::kMinLaneHashLength;
+       length < StringHasher::kMinLaneHashLength + 2 * StringHasher::kHashLanes;
+       length++) {
+    std::string one_byte = MakeString(length);
+    std::u16string two_byte(one_byte.begin(), one_byte.end());
+    EXPECT_EQ(StringHasher::HashSequentialString(one_byte.data(), length, seed),
+              StringHasher::HashSequentialString(
+                  reinterpret_cast<const uint16_t*>(two_byte.data()), length,
+                  seed));
+  }
+}
+
+TEST(StringHasherTest, LaneHashDependsOnAllCharacters) {
+  const uint64_t seed = 42;
+  const int length = StringHasher::kMinLaneHashLength + 3;
+  std::string str = MakeString(length);
+  uint32_t hash = StringHasher::HashSequentialString(str.data(), length, seed);
+  EXPECT_NE(hash, StringHasher::HashSequentialString(str.data(), length,
+                                                     seed + 1));
+  for (int i = 0; i < length; i++) {
+    std::string changed = str;
+    changed[i] = '0';
+    EXPECT_NE(hash,
+              StringHasher::HashSequentialString(changed.data(), length, seed));
+  }
+  // Swapping characters between lanes changes the hash, too.
+  std::string swapped = str;
+  std::swap(swapped[0], swapped[1]);
+  EXPECT_NE(hash,
+            StringHasher::HashSequentialString(swapped.data(), length, seed));
+}
+
+namespace {
+
+class HashCachingResource : public v8::String::ExternalOneByteStringResource {
+ public:
+  HashCachingResource(const std::string* data, uint64_t* cached_hash)
+      : data_(data), cached_hash_(cached_hash) {}
+
+  const char* data() const override { return data_->data(); }
+  size_t length() const override { return data_->size(); }
+
+  void SetCachedHash(uint64_t hash) const override { *cached_hash_ = hash; }
+  bool GetCachedHash(uint64_t* hash) const override {
+    if (*cached_hash_ == 0) return false;
+    *hash = *cached_hash_;
+    return true;
+  }
+
+ private:
+  const std::string* data_;
+  uint64_t* cached_hash_;
+};
+
+}  // namespace
+
+using ExternalStringHashTest = TestWithIsolate;
+
+TEST_F(ExternalStringHashTest, CachesHashInResource) {
+  HandleScope scope(i_isolate());
+  const std::string data = MakeString(100);
+  uint64_t cached_hash = 0;
+
+  Handle<String> first =
+      factory()
+          ->NewExternalStringFromOneByte(
+              new HashCachingResource(&data, &cached_hash))
+          .ToHandleChecked();
+  EXPECT_FALSE(first->HasHashCode());
+  uint32_t hash = first->EnsureRawHash();
+  EXPECT_NE(0u, cached_hash);
+
+  Handle<String> second =
+      factory()
+          ->NewExternalStringFromOneByte(
+              new HashCachingResource(&data, &cached_hash))
+          .ToHandleChecked();
+  EXPECT_TRUE(second->HasHashCode());
+  EXPECT_EQ(hash, second->raw_hash_field());
+}
+
+TEST_F(ExternalStringHashTest, IgnoresHashForOtherSeed) {
+  HandleScope scope(i_isolate());
+  const std::string data = MakeString(100);
+  uint64_t seed = HashSeed(i_isolate());
+  uint32_t raw_hash = StringHasher::HashSequentialString(
+      data.data(), static_cast<int>(data.size()), seed + 1);
+  uint64_t cached_hash =
+      (uint64_t{static_cast<uint32_t>(seed + 1)} << 32) | raw_hash;
+
+  Handle<String> string =
+      factory()
+          ->NewExternalStringFromOneByte(
+              new HashCachingResource(&data, &cached_hash))
+          .ToHandleChecked();
+  EXPECT_FALSE(string->HasHashCode());
+}
+
+}  // namespace internal
+}  // namespace v8
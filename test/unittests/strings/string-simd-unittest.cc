@@ -0,0 +1,65 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-simd.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+template <typename Char>
+class SimdCharBlockTest : public ::testing::Test {};
+
+using CharTypes = ::testing::Types<uint8_t, uint16_t>;
+TYPED_TEST_SUITE(SimdCharBlockTest, CharTypes);
+
+TYPED_TEST(SimdCharBlockTest, MatchesScalarPredicates) {
+  using Char = TypeParam;
+  using Block = SimdCharBlock<Char>;
+  const Char probes[] = {0x00, 0x1F, 0x20, '"', '\\', 0x7F, 0x80, 0xFF};
+  Char chars[Block::kLanes];
+  for (int start = 0; start < 256; start += Block::kLanes) {
+    for (int i = 0; i < Block::kLanes; i++) {
+      chars[i] = static_cast<Char>(start + i);
+      if (sizeof(Char) == 2 && i % 3 == 0) chars[i] += 0xD700;
+    }
+    Block block = Block::Load(chars);
+    for (Char probe : probes) {
+      Char to = static_cast<Char>(
+          std::min<int>(probe + 0x10, std::numeric_limits<Char>::max()));
+      uint32_t equal = 0, less_or_equal = 0, less = 0, greater = 0,
+               in_range = 0;
+      for (int i = 0; i < Block::kLanes; i++) {
+        uint32_t bit = uint32_t{1} << i;
+        if (chars[i] == probe) equal |= bit;
+        if (chars[i] <= probe) less_or_equal |= bit;
+        if (chars[i] < probe) less |= bit;
+        if (chars[i] > probe) greater |= bit;
+        if (probe <= chars[i] && chars[i] <= to) in_range |= bit;
+      }
+      EXPECT_EQ(equal, block.EqualMask(probe));
+      EXPECT_EQ(less_or_equal, block.LessOrEqualMask(probe));
+      EXPECT_EQ(less, block.LessThanMask(probe));
+      EXPECT_EQ(greater, block.GreaterThanMask(probe));
+      EXPECT_EQ(in_range, block.InRangeMask(probe, to));
+    }
+  }
+}
+
+TEST(SimdCharBlockTwoByteTest, SurrogateRange) {
+  using Block = SimdCharBlock<uint16_t>;
+  uint16_t chars[Block::kLanes] = {'a',    0xD7FF, 0xD800, 0xDBFF,
+                                   0xDC00, 0xDFFF, 0xE000, 'z'};
+  Block block = Block::Load(chars);
+  EXPECT_EQ(0b00111100u, block.InRangeMask(0xD800, 0xDFFF));
+  EXPECT_EQ(2, Block::FirstLane(block.InRangeMask(0xD800, 0xDFFF)));
+  EXPECT_EQ(0b11u, Block::LanesBefore(2));
+}
+
+}  // namespace internal
+}  // namespace v8
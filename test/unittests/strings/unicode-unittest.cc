@@ -110,6 +110,41 @@ TEST(UnicodeTest, SurrogateOverrunsBuffer) {
   CHECK_EQ(output_utf16[0], 0x00);
 }
 
+TEST(UnicodeTest, NonAsciiStartTwoByte) {
+  std::vector<uint16_t> chars(40, 'a');
+  EXPECT_EQ(40, NonAsciiStart(chars.data(), 40));
+  for (int i = 0; i < 40; i++) {
+    chars[i] = 0x80;
+    EXPECT_EQ(i, NonAsciiStart(chars.data(), 40));
+    chars[i] = 0xFFFF;
+    EXPECT_EQ(i, NonAsciiStart(chars.data(), 40));
+    chars[i] = 'a';
+  }
+}
+
+TEST(UnicodeTest, AsciiRunsBetweenMultiByteSequences) {
+  // The decoder skips runs of ASCII characters in bulk. Check runs of all
+  // lengths around the vector width next to valid and invalid sequences.
+  const std::vector<uint8_t> kSequences[] = {
+      {0xC3, 0xA9}, {0xE2, 0x82, 0xAC}, {0xF0, 0x9F, 0x98, 0x80}, {0xFF},
+      {0xE2, 0x82}};
+  for (int run = 0; run < 40; run++) {
+    for (const std::vector<uint8_t>& sequence : kSequences) {
+      std::vector<uint8_t> bytes;
+      for (int i = 0; i < 3; i++) {
+        bytes.insert(bytes.end(), run, 'a' + i);
+        bytes.insert(bytes.end(), sequence.begin(), sequence.end());
+      }
+      bytes.insert(bytes.end(), run, 'z');
+      std::vector<unibrow::uchar> expected;
+      DecodeNormally(bytes, &expected);
+      std::vector<unibrow::uchar> output;
+      DecodeUtf16(bytes, &output);
+      EXPECT_EQ(expected, output);
+    }
+  }
+}
+
 TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   // Unfortunately, V8 has two UTF-8 decoders. This test checks that they
   // produce the same result. This test was inspired by
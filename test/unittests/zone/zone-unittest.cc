@@ -25,5 +25,56 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentsAreReused) {
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(100 * KB);
+    zone.Allocate<ZoneTestTag>(1000);
+    EXPECT_LT(0u, allocator.GetCurrentMemoryUsage());
+    EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+  }
+  // The segments of the destroyed zone are kept in the pool.
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  size_t pooled = allocator.GetPooledMemoryUsage();
+  EXPECT_LT(0u, pooled);
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1000);
+    EXPECT_GT(pooled, allocator.GetPooledMemoryUsage());
+  }
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+}
+
+#ifndef V8_USE_ADDRESS_SANITIZER
+TEST_F(ZoneTest, DeleteLastAllocation) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+
+  void* first = zone.Allocate<ZoneTestTag>(24);
+  void* second = zone.Allocate<ZoneTestTag>(20);
+  // Only the last allocation is returned to the zone.
+  zone.Delete<ZoneTestTag>(first, 24);
+  zone.Delete<ZoneTestTag>(second, 20);
+  EXPECT_EQ(second, zone.Allocate<ZoneTestTag>(16));
+}
+
+TEST_F(ZoneTest, GrowInPlace) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+
+  char* first = zone.AllocateArray<char>(10);
+  char* second = zone.AllocateArray<char>(10);
+  EXPECT_FALSE(zone.TryGrowArrayInPlace(first, 10, 20));
+  EXPECT_TRUE(zone.TryGrowArrayInPlace(second, 10, 20));
+  EXPECT_EQ(second + 24, zone.AllocateArray<char>(8));
+  // Growing beyond the current segment fails.
+  char* third = zone.AllocateArray<char>(8);
+  EXPECT_FALSE(zone.TryGrowArrayInPlace(third, 8, 1 * MB));
+}
+#endif  // V8_USE_ADDRESS_SANITIZER
+
 }  // namespace internal
 }  // namespace v8
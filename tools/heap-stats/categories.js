@@ -135,6 +135,7 @@ export const CATEGORIES = new Map([
       'MAP_TYPE',
       'NUMBER_STRING_CACHE_TYPE',
       'OBJECT_BOILERPLATE_DESCRIPTION_TYPE',
+      'OBJECT_KEYS_CACHE_TYPE',
       'OBJECT_TEMPLATE_INFO_TYPE',
       'OBJECT_TO_CODE_TYPE',
       'ODDBALL_TYPE',
@@ -142,6 +143,7 @@ export const CATEGORIES = new Map([
       'PROMISE_RESOLVE_THENABLE_JOB_INFO_TYPE',
       'PROPERTY_CELL_TYPE',
       'PROTOTYPE_INFO_TYPE',
+      'PROTOTYPE_TRANSITIONS_TYPE',
       'PROTOTYPE_USERS_TYPE',
       'REGEXP_MULTIPLE_CACHE_TYPE',
       'RETAINED_MAPS_TYPE',